@@ -8,14 +8,37 @@
  * @brief: IO definitions
  */
 #define __I     volatile const  /*< read-only */
-#define __O     volatile        /*< write-only */
 #define __IO    volatile        /*< read/write */
 
-#define __ASM           _asm
+/**
+ * @brief   Write-only register
+ * @note    A volatile qualifier can't forbid reads, so the register is wrapped in a struct:
+ *          x = GPIOA->BSRR and GPIOA->BSRR = x don't compile, the only accesses are
+ *          WRITE_REG() and CLEAR_REG(). The store is the same single STR as to a plain
+ *          volatile register.
+ */
+typedef struct
+{
+    __IO uint32_t Value;
+} __WO_uint32_t;
+
+#define __ASM           __asm
 #define __INLINE        inline
 #define __STATIC_INLINE static inline
 
 
+/**
+ * @brief   Field access helpers, built on the <REG>_<FIELD>_Pos / _Msk definitions
+ * @note    Both expand to constant expressions when VALUE is constant, so several fields
+ *          can be OR-ed together and written with one access:
+ *              MODIFY_REG(SysTick->CTRL,
+ *                         SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk,
+ *                         _VAL2FLD(SysTick_CTRL_CLKSOURCE, 1U) | _VAL2FLD(SysTick_CTRL_TICKINT, 1U));
+ */
+#define _VAL2FLD(field, value)    (((uint32_t)(value) << field ## _Pos) & field ## _Msk)
+#define _FLD2VAL(field, value)    (((uint32_t)(value) & field ## _Msk) >> field ## _Pos)
+
+
 /**
  * @brief   CMSIS_NVIC Nested Vectored Interrupt Controller
  */
@@ -30,13 +53,40 @@ typedef struct
     __IO uint32_t ICPR[8U];         /*< 0xE280-0xE29C Interrupt Clear-pending Register >*/
     uint32_t      RESERVED3[24U];   /*< 0xE2A0-0xE2FF>*/
     __IO uint32_t IABR[8U];         /*< 0xE300-0xE31C Interrupt Active Bit Register >*/
-    // check the rest later
+    uint32_t      RESERVED4[56U];   /*< 0xE320-0xE3FF >*/
+    __IO uint8_t  IP[240U];         /*< 0xE400-0xE4EF Interrupt Priority Register (8 bits wide, 1 byte per IRQ) >*/
+    uint32_t      RESERVED5[644U];  /*< 0xE4F0-0xEEFF >*/
+    __WO_uint32_t STIR;             /*< 0xEF00 Software Trigger Interrupt Register >*/
 } NVIC_Type;
 
 
+/**
+ * @brief   CMSIS_SCB System Control Block
+ * @note    Read stm32-cortexm4-mcus-mpus pg. 220
+ */
 typedef struct
 {
-
+    __I  uint32_t CPUID;            /*< 0xED00 CPUID Base Register >*/
+    __IO uint32_t ICSR;             /*< 0xED04 Interrupt Control and State Register >*/
+    __IO uint32_t VTOR;             /*< 0xED08 Vector Table Offset Register >*/
+    __IO uint32_t AIRCR;            /*< 0xED0C Application Interrupt and Reset Control Register >*/
+    __IO uint32_t SCR;              /*< 0xED10 System Control Register >*/
+    __IO uint32_t CCR;              /*< 0xED14 Configuration and Control Register >*/
+    __IO uint8_t  SHP[12U];         /*< 0xED18-0xED23 System Handlers Priority Registers (4-7, 8-11, 12-15) >*/
+    __IO uint32_t SHCSR;            /*< 0xED24 System Handler Control and State Register >*/
+    __IO uint32_t CFSR;             /*< 0xED28 Configurable Fault Status Register >*/
+    __IO uint32_t HFSR;             /*< 0xED2C HardFault Status Register >*/
+    __IO uint32_t DFSR;             /*< 0xED30 Debug Fault Status Register >*/
+    __IO uint32_t MMFAR;            /*< 0xED34 MemManage Fault Address Register >*/
+    __IO uint32_t BFAR;             /*< 0xED38 BusFault Address Register >*/
+    __IO uint32_t AFSR;             /*< 0xED3C Auxiliary Fault Status Register >*/
+    __I  uint32_t PFR[2U];          /*< 0xED40-0xED44 Processor Feature Register >*/
+    __I  uint32_t DFR;              /*< 0xED48 Debug Feature Register >*/
+    __I  uint32_t ADR;              /*< 0xED4C Auxiliary Feature Register >*/
+    __I  uint32_t MMFR[4U];         /*< 0xED50-0xED5C Memory Model Feature Register >*/
+    __I  uint32_t ISAR[5U];         /*< 0xED60-0xED70 Instruction Set Attributes Register >*/
+    uint32_t      RESERVED0[5U];    /*< 0xED74-0xED87 >*/
+    __IO uint32_t CPACR;            /*< 0xED88 Coprocessor Access Control Register >*/
 } SCB_Type;
 
 
@@ -49,16 +99,196 @@ typedef struct
 } SysTick_Type;
 
 
+/**
+ * @brief   CMSIS_DWT Data Watchpoint and Trace unit
+ * @note    CYCCNT counts core clock cycles once CoreDebug->DEMCR.TRCENA and DWT->CTRL.CYCCNTENA are set.
+ */
+typedef struct
+{
+    __IO uint32_t CTRL;             /*< 0x1000 Control Register >*/
+    __IO uint32_t CYCCNT;           /*< 0x1004 Cycle Count Register >*/
+    __IO uint32_t CPICNT;           /*< 0x1008 CPI Count Register >*/
+    __IO uint32_t EXCCNT;           /*< 0x100C Exception Overhead Count Register >*/
+    __IO uint32_t SLEEPCNT;         /*< 0x1010 Sleep Count Register >*/
+    __IO uint32_t LSUCNT;           /*< 0x1014 LSU Count Register >*/
+    __IO uint32_t FOLDCNT;          /*< 0x1018 Folded-instruction Count Register >*/
+    __I  uint32_t PCSR;             /*< 0x101C Program Counter Sample Register >*/
+    __IO uint32_t COMP0;            /*< 0x1020 Comparator Register 0 >*/
+    __IO uint32_t MASK0;            /*< 0x1024 Mask Register 0 >*/
+    __IO uint32_t FUNCTION0;        /*< 0x1028 Function Register 0 >*/
+    uint32_t      RESERVED0;
+    __IO uint32_t COMP1;            /*< 0x1030 Comparator Register 1 >*/
+    __IO uint32_t MASK1;            /*< 0x1034 Mask Register 1 >*/
+    __IO uint32_t FUNCTION1;        /*< 0x1038 Function Register 1 >*/
+    uint32_t      RESERVED1;
+    __IO uint32_t COMP2;            /*< 0x1040 Comparator Register 2 >*/
+    __IO uint32_t MASK2;            /*< 0x1044 Mask Register 2 >*/
+    __IO uint32_t FUNCTION2;        /*< 0x1048 Function Register 2 >*/
+    uint32_t      RESERVED2;
+    __IO uint32_t COMP3;            /*< 0x1050 Comparator Register 3 >*/
+    __IO uint32_t MASK3;            /*< 0x1054 Mask Register 3 >*/
+    __IO uint32_t FUNCTION3;        /*< 0x1058 Function Register 3 >*/
+} DWT_Type;
+
+
+/**
+ * @brief   CMSIS_FPU Floating Point Unit
+ */
+typedef struct
+{
+    uint32_t      RESERVED0;
+    __IO uint32_t FPCCR;            /*< 0xEF34 Floating-Point Context Control Register >*/
+    __IO uint32_t FPCAR;            /*< 0xEF38 Floating-Point Context Address Register >*/
+    __IO uint32_t FPDSCR;           /*< 0xEF3C Floating-Point Default Status Control Register >*/
+    __I  uint32_t MVFR0;            /*< 0xEF40 Media and FP Feature Register 0 >*/
+    __I  uint32_t MVFR1;            /*< 0xEF44 Media and FP Feature Register 1 >*/
+} FPU_Type;
+
+
+/**
+ * @brief   CMSIS_CoreDebug Core Debug registers
+ */
+typedef struct
+{
+    __IO uint32_t DHCSR;            /*< 0xEDF0 Debug Halting Control and Status Register >*/
+    __WO_uint32_t DCRSR;            /*< 0xEDF4 Debug Core Register Selector Register >*/
+    __IO uint32_t DCRDR;            /*< 0xEDF8 Debug Core Register Data Register >*/
+    __IO uint32_t DEMCR;            /*< 0xEDFC Debug Exception and Monitor Control Register >*/
+} CoreDebug_Type;
+
+
+/**
+ * @brief   CMSIS_ITM Instrumentation Trace Macrocell
+ * @note    A read of a stimulus port returns 1 when its FIFO can take a write. The
+ *          access width of the write (8, 16 or 32-bit) is the payload size of the packet.
+ */
+typedef struct
+{
+    __IO union
+    {
+        __IO uint8_t  u8;
+        __IO uint16_t u16;
+        __IO uint32_t u32;
+    } PORT[32U];                    /*< 0x0000-0x007C Stimulus Port Registers >*/
+    uint32_t      RESERVED0[864U];
+    __IO uint32_t TER;              /*< 0x0E00 Trace Enable Register >*/
+    uint32_t      RESERVED1[15U];
+    __IO uint32_t TPR;              /*< 0x0E40 Trace Privilege Register >*/
+    uint32_t      RESERVED2[15U];
+    __IO uint32_t TCR;              /*< 0x0E80 Trace Control Register >*/
+    uint32_t      RESERVED3[75U];
+    __WO_uint32_t LAR;              /*< 0x0FB0 Lock Access Register >*/
+    __I  uint32_t LSR;              /*< 0x0FB4 Lock Status Register >*/
+} ITM_Type;
+
+
+/**
+ * @brief   CMSIS_TPI Trace Port Interface Unit
+ * @note    Clocked by TRACECLKIN, which is HCLK on the STM32F4.
+ */
+typedef struct
+{
+    __I  uint32_t SSPSR;            /*< 0x000 Supported Parallel Port Size Register >*/
+    __IO uint32_t CSPSR;            /*< 0x004 Current Parallel Port Size Register >*/
+    uint32_t      RESERVED0[2U];
+    __IO uint32_t ACPR;             /*< 0x010 Asynchronous Clock Prescaler Register >*/
+    uint32_t      RESERVED1[55U];
+    __IO uint32_t SPPR;             /*< 0x0F0 Selected Pin Protocol Register >*/
+    uint32_t      RESERVED2[131U];
+    __I  uint32_t FFSR;             /*< 0x300 Formatter and Flush Status Register >*/
+    __IO uint32_t FFCR;             /*< 0x304 Formatter and Flush Control Register >*/
+} TPI_Type;
+
+
 
 /*----------------------- Memory mapping of Core Hardware -----------------------*/
 
+#define ITM_BASE        (0xE0000000UL)
 #define SysTick_BASE    (0xE000E010UL)
 #define NVIC_BASE       (0xE000E100UL)
-#define SCB_BASE        (0xE000ED00UL)  // is it right?????
+#define SCB_BASE        (0xE000ED00UL)  /*< System Control Space (0xE000E000) + 0x0D00 >*/
+#define DWT_BASE        (0xE0001000UL)
+#define CoreDebug_BASE  (0xE000EDF0UL)
+#define TPI_BASE        (0xE0040000UL)
+#define FPU_BASE        (0xE000EF30UL)
 
 #define SCB             ((SCB_Type      *)SCB_BASE)         /*< System Control Block >*/
 #define SysTick         ((SysTick_Type  *)SysTick_BASE)
 #define NVIC            ((NVIC_Type     *)NVIC_BASE)
+#define DWT             ((DWT_Type      *)DWT_BASE)
+#define CoreDebug       ((CoreDebug_Type *)CoreDebug_BASE)
+#define ITM             ((ITM_Type      *)ITM_BASE)
+#define TPI             ((TPI_Type      *)TPI_BASE)
+#define FPU             ((FPU_Type      *)FPU_BASE)
+
+/* DWT Control Register */
+#define DWT_CTRL_CYCCNTENA_Pos      0U
+#define DWT_CTRL_CYCCNTENA_Msk      (0x1UL << DWT_CTRL_CYCCNTENA_Pos)
+
+#define DWT_CTRL_SYNCTAP_Pos        10U     /*< CYCCNT tap for ITM synchronisation packets >*/
+#define DWT_CTRL_SYNCTAP_Msk        (0x3UL << DWT_CTRL_SYNCTAP_Pos)
+
+#define DWT_CTRL_NOCYCCNT_Pos       25U
+#define DWT_CTRL_NOCYCCNT_Msk       (0x1UL << DWT_CTRL_NOCYCCNT_Pos)
+
+/* ITM Trace Control Register */
+#define ITM_TCR_ITMENA_Pos          0U
+#define ITM_TCR_ITMENA_Msk          (0x1UL << ITM_TCR_ITMENA_Pos)
+
+#define ITM_TCR_TSENA_Pos           1U      /*< Local timestamp packets >*/
+#define ITM_TCR_TSENA_Msk           (0x1UL << ITM_TCR_TSENA_Pos)
+
+#define ITM_TCR_SYNCENA_Pos         2U
+#define ITM_TCR_SYNCENA_Msk         (0x1UL << ITM_TCR_SYNCENA_Pos)
+
+#define ITM_TCR_TXENA_Pos           3U      /*< Forward DWT packets >*/
+#define ITM_TCR_TXENA_Msk           (0x1UL << ITM_TCR_TXENA_Pos)
+
+#define ITM_TCR_SWOENA_Pos          4U      /*< Timestamps count on the SWO clock, not the core clock >*/
+#define ITM_TCR_SWOENA_Msk          (0x1UL << ITM_TCR_SWOENA_Pos)
+
+#define ITM_TCR_TSPRESCALE_Pos      8U
+#define ITM_TCR_TSPRESCALE_Msk      (0x3UL << ITM_TCR_TSPRESCALE_Pos)
+
+#define ITM_TCR_TRACEBUSID_Pos      16U
+#define ITM_TCR_TRACEBUSID_Msk      (0x7FUL << ITM_TCR_TRACEBUSID_Pos)
+
+#define ITM_TCR_BUSY_Pos            23U
+#define ITM_TCR_BUSY_Msk            (0x1UL << ITM_TCR_BUSY_Pos)
+
+#define ITM_LAR_KEY                 0xC5ACCE55UL    /*< Unlocks the ITM registers >*/
+
+/* TPI Asynchronous Clock Prescaler: SWO bit rate = TRACECLKIN / (PRESCALER + 1) */
+#define TPI_ACPR_PRESCALER_Pos      0U
+#define TPI_ACPR_PRESCALER_Msk      (0x1FFFUL << TPI_ACPR_PRESCALER_Pos)
+
+/* TPI Selected Pin Protocol */
+#define TPI_SPPR_TXMODE_Pos         0U
+#define TPI_SPPR_TXMODE_Msk         (0x3UL << TPI_SPPR_TXMODE_Pos)
+#define TPI_SPPR_TXMODE_MANCHESTER  (0x1UL << TPI_SPPR_TXMODE_Pos)
+#define TPI_SPPR_TXMODE_NRZ         (0x2UL << TPI_SPPR_TXMODE_Pos)
+
+/* TPI Formatter and Flush Control: EnFCont off passes the ITM stream through unformatted */
+#define TPI_FFCR_ENFCONT_Pos        1U
+#define TPI_FFCR_ENFCONT_Msk        (0x1UL << TPI_FFCR_ENFCONT_Pos)
+
+#define TPI_FFCR_TRIGIN_Pos         8U
+#define TPI_FFCR_TRIGIN_Msk         (0x1UL << TPI_FFCR_TRIGIN_Pos)
+
+/* FPU Floating-Point Context Control Register */
+#define FPU_FPCCR_LSPEN_Pos         30U     /*< Lazy state preservation >*/
+#define FPU_FPCCR_LSPEN_Msk         (0x1UL << FPU_FPCCR_LSPEN_Pos)
+
+#define FPU_FPCCR_ASPEN_Pos         31U     /*< Automatic FP context save on exception entry >*/
+#define FPU_FPCCR_ASPEN_Msk         (0x1UL << FPU_FPCCR_ASPEN_Pos)
+
+/* SCB Coprocessor Access Control Register: CP10/CP11 full access enables the FPU */
+#define SCB_CPACR_CP10_CP11_Pos     20U
+#define SCB_CPACR_CP10_CP11_Msk     (0xFUL << SCB_CPACR_CP10_CP11_Pos)
+
+/* CoreDebug Debug Exception and Monitor Control Register */
+#define CoreDebug_DEMCR_TRCENA_Pos  24U
+#define CoreDebug_DEMCR_TRCENA_Msk  (0x1UL << CoreDebug_DEMCR_TRCENA_Pos)
 
 /* SysTick Control and Status */
 #define SysTick_CTRL_ENABLE_Pos     0U
@@ -77,12 +307,284 @@ typedef struct
 #define SysTick_LOAD_RELOAD_Pos     0U
 #define SysTick_LOAD_RELOAD_Msk     (0xFFFFFFUL << SysTick_LOAD_RELOAD_Pos) /*< 3 bytes >*/
 
+/* SCB Interrupt Control and State Register */
+#define SCB_ICSR_VECTACTIVE_Pos     0U
+#define SCB_ICSR_VECTACTIVE_Msk     (0x1FFUL << SCB_ICSR_VECTACTIVE_Pos)
+
+#define SCB_ICSR_VECTPENDING_Pos    12U
+#define SCB_ICSR_VECTPENDING_Msk    (0x1FFUL << SCB_ICSR_VECTPENDING_Pos)
+
+#define SCB_ICSR_PENDSTCLR_Pos      25U
+#define SCB_ICSR_PENDSTCLR_Msk      (0x1UL << SCB_ICSR_PENDSTCLR_Pos)
+
+#define SCB_ICSR_PENDSTSET_Pos      26U
+#define SCB_ICSR_PENDSTSET_Msk      (0x1UL << SCB_ICSR_PENDSTSET_Pos)
+
+#define SCB_ICSR_PENDSVCLR_Pos      27U
+#define SCB_ICSR_PENDSVCLR_Msk      (0x1UL << SCB_ICSR_PENDSVCLR_Pos)
+
+#define SCB_ICSR_PENDSVSET_Pos      28U
+#define SCB_ICSR_PENDSVSET_Msk      (0x1UL << SCB_ICSR_PENDSVSET_Pos)
+
+#define SCB_ICSR_NMIPENDSET_Pos     31U
+#define SCB_ICSR_NMIPENDSET_Msk     (0x1UL << SCB_ICSR_NMIPENDSET_Pos)
+
+/* SCB Vector Table Offset Register */
+#define SCB_VTOR_TBLOFF_Pos         7U
+#define SCB_VTOR_TBLOFF_Msk         (0x1FFFFFFUL << SCB_VTOR_TBLOFF_Pos)
+
+/* SCB Application Interrupt and Reset Control Register */
+#define SCB_AIRCR_VECTRESET_Pos     0U
+#define SCB_AIRCR_VECTRESET_Msk     (0x1UL << SCB_AIRCR_VECTRESET_Pos)
 
+#define SCB_AIRCR_VECTCLRACTIVE_Pos 1U
+#define SCB_AIRCR_VECTCLRACTIVE_Msk (0x1UL << SCB_AIRCR_VECTCLRACTIVE_Pos)
 
+#define SCB_AIRCR_SYSRESETREQ_Pos   2U
+#define SCB_AIRCR_SYSRESETREQ_Msk   (0x1UL << SCB_AIRCR_SYSRESETREQ_Pos)
 
+#define SCB_AIRCR_PRIGROUP_Pos      8U
+#define SCB_AIRCR_PRIGROUP_Msk      (0x7UL << SCB_AIRCR_PRIGROUP_Pos)   /*< Binary point of the priority field >*/
+
+#define SCB_AIRCR_ENDIANESS_Pos     15U
+#define SCB_AIRCR_ENDIANESS_Msk     (0x1UL << SCB_AIRCR_ENDIANESS_Pos)
+
+#define SCB_AIRCR_VECTKEY_Pos       16U
+#define SCB_AIRCR_VECTKEY_Msk       (0xFFFFUL << SCB_AIRCR_VECTKEY_Pos) /*< Write 0x05FA, otherwise the write is ignored >*/
+
+/* SCB System Control Register */
+#define SCB_SCR_SLEEPONEXIT_Pos     1U
+#define SCB_SCR_SLEEPONEXIT_Msk     (0x1UL << SCB_SCR_SLEEPONEXIT_Pos)
+
+#define SCB_SCR_SLEEPDEEP_Pos       2U
+#define SCB_SCR_SLEEPDEEP_Msk       (0x1UL << SCB_SCR_SLEEPDEEP_Pos)
+
+#define SCB_SCR_SEVONPEND_Pos       4U
+#define SCB_SCR_SEVONPEND_Msk       (0x1UL << SCB_SCR_SEVONPEND_Pos)
+
+/* SCB Configuration Control Register */
+#define SCB_CCR_UNALIGN_TRP_Pos     3U
+#define SCB_CCR_UNALIGN_TRP_Msk     (0x1UL << SCB_CCR_UNALIGN_TRP_Pos)
+
+#define SCB_CCR_DIV_0_TRP_Pos       4U
+#define SCB_CCR_DIV_0_TRP_Msk       (0x1UL << SCB_CCR_DIV_0_TRP_Pos)
+
+#define SCB_CCR_STKALIGN_Pos        9U
+#define SCB_CCR_STKALIGN_Msk        (0x1UL << SCB_CCR_STKALIGN_Pos)
+
+/* SCB System Handler Control and State Register */
+#define SCB_SHCSR_MEMFAULTENA_Pos   16U
+#define SCB_SHCSR_MEMFAULTENA_Msk   (0x1UL << SCB_SHCSR_MEMFAULTENA_Pos)
+
+#define SCB_SHCSR_BUSFAULTENA_Pos   17U
+#define SCB_SHCSR_BUSFAULTENA_Msk   (0x1UL << SCB_SHCSR_BUSFAULTENA_Pos)
+
+#define SCB_SHCSR_USGFAULTENA_Pos   18U
+#define SCB_SHCSR_USGFAULTENA_Msk   (0x1UL << SCB_SHCSR_USGFAULTENA_Pos)
+
+
+
+
+
+
+/*----------------------- Core register access -----------------------*/
+/**
+ * @brief   Number of priority bits implemented in NVIC_IP/SCB_SHP (upper bits of each byte).
+ *          Device header should define it before including this file.
+ */
+#ifndef __NVIC_PRIO_BITS
+#define __NVIC_PRIO_BITS    4U
+#endif
+
+/* Key must be written into AIRCR[31:16] or the write is ignored */
+#define NVIC_AIRCR_VECTKEY  (0x05FAUL)
+
+/**
+ * @brief   Enable/Disable IRQ interrupts by clearing/setting PRIMASK (NMI & HardFault are not affected)
+ */
+__STATIC_INLINE void __enable_irq(void)
+{
+    __ASM volatile ("cpsie i" : : : "memory");
+}
+
+__STATIC_INLINE void __disable_irq(void)
+{
+    __ASM volatile ("cpsid i" : : : "memory");
+}
+
+__STATIC_INLINE uint32_t __get_PRIMASK(void)
+{
+    uint32_t result;
+
+    __ASM volatile ("MRS %0, primask" : "=r" (result) :: "memory");
+    return result;
+}
+
+__STATIC_INLINE void __set_PRIMASK(uint32_t priMask)
+{
+    __ASM volatile ("MSR primask, %0" : : "r" (priMask) : "memory");
+}
+
+/**
+ * @brief   Main Stack Pointer, whatever stack is in use
+ */
+__STATIC_INLINE uint32_t __get_MSP(void)
+{
+    uint32_t result;
+
+    __ASM volatile ("MRS %0, msp" : "=r" (result));
+    return result;
+}
+
+/**
+ * @brief   Interrupt Program Status Register: number of the active exception, 0 in thread mode
+ */
+__STATIC_INLINE uint32_t __get_IPSR(void)
+{
+    uint32_t result;
+
+    __ASM volatile ("MRS %0, ipsr" : "=r" (result));
+    return result;
+}
+
+/**
+ * @brief   Base Priority Mask register
+ * @note    BASEPRI = 0 -> no masking.
+ *          BASEPRI = N -> every exception with priority value >= N (lower or equal urgency) is masked,
+ *                         exceptions with value < N still preempt.
+ */
+__STATIC_INLINE uint32_t __get_BASEPRI(void)
+{
+    uint32_t result;
+
+    __ASM volatile ("MRS %0, basepri" : "=r" (result));
+    return result;
+}
+
+__STATIC_INLINE void __set_BASEPRI(uint32_t basePri)
+{
+    __ASM volatile ("MSR basepri, %0" : : "r" (basePri) : "memory");
+}
+
+/**
+ * @brief   BASEPRI_MAX only writes if the new value raises the masking level (or BASEPRI is 0),
+ *          so nested critical sections can never lower the mask by accident.
+ */
+__STATIC_INLINE void __set_BASEPRI_MAX(uint32_t basePri)
+{
+    __ASM volatile ("MSR basepri_max, %0" : : "r" (basePri) : "memory");
+}
+
+/**
+ * @brief   Memory barriers
+ *          DSB - all explicit memory accesses complete before the next instruction
+ *          ISB - flush the pipeline, following instructions are re-fetched
+ *          DMB - ordering of memory accesses before/after the barrier
+ */
+__STATIC_INLINE void __DSB(void)
+{
+    __ASM volatile ("dsb 0xF" ::: "memory");
+}
+
+__STATIC_INLINE void __ISB(void)
+{
+    __ASM volatile ("isb 0xF" ::: "memory");
+}
+
+__STATIC_INLINE void __DMB(void)
+{
+    __ASM volatile ("dmb 0xF" ::: "memory");
+}
+
+/**
+ * @brief   Hint instructions
+ *          WFI - sleep until an interrupt is pending (also wakes with PRIMASK set)
+ *          WFE - sleep until an event (SEV, interrupt, exclusive monitor cleared)
+ */
+__STATIC_INLINE void __NOP(void)
+{
+    __ASM volatile ("nop");
+}
+
+__STATIC_INLINE void __WFI(void)
+{
+    __ASM volatile ("wfi" ::: "memory");
+}
+
+__STATIC_INLINE void __WFE(void)
+{
+    __ASM volatile ("wfe" ::: "memory");
+}
+
+__STATIC_INLINE void __SEV(void)
+{
+    __ASM volatile ("sev");
+}
+
+/**
+ * @brief   Count leading zeros, __CLZ(0) = 32
+ */
+__STATIC_INLINE uint32_t __CLZ(uint32_t value)
+{
+    uint32_t result;
+
+    __ASM volatile ("clz %0, %1" : "=r" (result) : "r" (value));
+    return result;
+}
+
+/**
+ * @brief   Exclusive access
+ * @note    STREX returns 0 if the store happened, 1 if the exclusive monitor was lost
+ *          (an exception entry/return, or another exclusive access) and it must be retried.
+ */
+__STATIC_INLINE uint32_t __LDREXW(volatile uint32_t *addr)
+{
+    uint32_t result;
+
+    __ASM volatile ("ldrex %0, %1" : "=r" (result) : "Q" (*addr));
+    return result;
+}
+
+__STATIC_INLINE uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+    uint32_t result;
+
+    __ASM volatile ("strex %0, %2, %1" : "=&r" (result), "=Q" (*addr) : "r" (value));
+    return result;
+}
+
+__STATIC_INLINE void __CLREX(void)
+{
+    __ASM volatile ("clrex" ::: "memory");
+}
 
 
 /*----------------------- Inline functions -----------------------*/
+/**
+ * @brief   Set priority grouping (split between preempt priority and sub-priority)
+ * @note    Read stm32-cortexm4-mcus-mpus pg. 231
+ *          Only the values 0-7 are used. AIRCR needs VECTKEY on every write,
+ *          so the register is read, the key and PRIGROUP fields are replaced and written back.
+ * @param   PriorityGroup - PRIGROUP field value (binary point position)
+ * @retval  None
+ */
+__STATIC_INLINE void __NVIC_SetPriorityGrouping(uint32_t PriorityGroup)
+{
+    uint32_t reg_value;
+    uint32_t PriorityGroupTmp = (PriorityGroup & 0x07UL);
+
+    reg_value  = SCB->AIRCR;
+    reg_value &= ~((uint32_t)(SCB_AIRCR_VECTKEY_Msk | SCB_AIRCR_PRIGROUP_Msk));
+    reg_value |= ((uint32_t)NVIC_AIRCR_VECTKEY << SCB_AIRCR_VECTKEY_Pos) |
+                 (PriorityGroupTmp << SCB_AIRCR_PRIGROUP_Pos);
+    SCB->AIRCR = reg_value;
+}
+
+__STATIC_INLINE uint32_t __NVIC_GetPriorityGrouping(void)
+{
+    return ((uint32_t)((SCB->AIRCR & SCB_AIRCR_PRIGROUP_Msk) >> SCB_AIRCR_PRIGROUP_Pos));
+}
+
 /**
  * @brief   Enable a specific interrupt which is corresponding to input IRQ number
  * 
@@ -109,11 +611,207 @@ __STATIC_INLINE void __NVIC_EnableIRQ(IRQn_Type IRQn)
 }
 
 /**
- * @brief System Tick configuration
+ * @brief   Disable a specific interrupt
+ * @note    The IRQ may still be executing (or about to) after the ICER write,
+ *          DSB + ISB make sure the disable has taken effect before returning.
+ */
+__STATIC_INLINE void __NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        NVIC->ICER[((uint32_t)IRQn >> 5UL)] = (uint32_t)(1UL << ((uint32_t)IRQn & 0x1FUL));
+        __DSB();
+        __ISB();
+    }
+}
+
+/**
+ * @retval  1 - interrupt is enabled, 0 - disabled (or core exception)
+ */
+__STATIC_INLINE uint32_t __NVIC_GetEnableIRQ(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        return ((NVIC->ISER[((uint32_t)IRQn >> 5UL)] & (1UL << ((uint32_t)IRQn & 0x1FUL))) != 0UL) ? 1UL : 0UL;
+    }
+    return 0U;
+}
+
+/**
+ * @retval  1 - interrupt is pending, 0 - not pending (or core exception)
+ */
+__STATIC_INLINE uint32_t __NVIC_GetPendingIRQ(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        return ((NVIC->ISPR[((uint32_t)IRQn >> 5UL)] & (1UL << ((uint32_t)IRQn & 0x1FUL))) != 0UL) ? 1UL : 0UL;
+    }
+    return 0U;
+}
+
+__STATIC_INLINE void __NVIC_SetPendingIRQ(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        NVIC->ISPR[((uint32_t)IRQn >> 5UL)] = (uint32_t)(1UL << ((uint32_t)IRQn & 0x1FUL));
+    }
+}
+
+__STATIC_INLINE void __NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        NVIC->ICPR[((uint32_t)IRQn >> 5UL)] = (uint32_t)(1UL << ((uint32_t)IRQn & 0x1FUL));
+    }
+}
+
+/**
+ * @retval  1 - interrupt is active (being serviced or preempted), 0 - not active
+ */
+__STATIC_INLINE uint32_t __NVIC_GetActive(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        return ((NVIC->IABR[((uint32_t)IRQn >> 5UL)] & (1UL << ((uint32_t)IRQn & 0x1FUL))) != 0UL) ? 1UL : 0UL;
+    }
+    return 0U;
+}
+
+/**
+ * @brief   Set priority of a device interrupt or a core exception
+ * @note    Only the upper __NVIC_PRIO_BITS of each priority byte are implemented,
+ *          hence the value is shifted to the MSB side.
+ *          Core exceptions (IRQn < 0) live in SCB->SHP: SHP[0] = exception 4 (MemManage),
+ *          so the index is (IRQn & 0xF) - 4.
+ * @param   IRQn     - Interrupt number
+ * @param   priority - Encoded priority (0 = highest)
+ */
+__STATIC_INLINE void __NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        NVIC->IP[((uint32_t)IRQn)] = (uint8_t)((priority << (8U - __NVIC_PRIO_BITS)) & (uint32_t)0xFFUL);
+    }
+    else
+    {
+        SCB->SHP[(((uint32_t)IRQn) & 0xFUL) - 4UL] = (uint8_t)((priority << (8U - __NVIC_PRIO_BITS)) & (uint32_t)0xFFUL);
+    }
+}
+
+__STATIC_INLINE uint32_t __NVIC_GetPriority(IRQn_Type IRQn)
+{
+    if ((int32_t)(IRQn) >= 0)
+    {
+        return ((uint32_t)NVIC->IP[((uint32_t)IRQn)] >> (8U - __NVIC_PRIO_BITS));
+    }
+    return ((uint32_t)SCB->SHP[(((uint32_t)IRQn) & 0xFUL) - 4UL] >> (8U - __NVIC_PRIO_BITS));
+}
+
+/**
+ * @brief   Encode preempt priority & sub-priority into one priority value for the given grouping
+ * @note    With 4 implemented bits and PRIGROUP = G:
+ *              preempt bits = min(7 - G, 4)
+ *              sub bits     = 4 - preempt bits (at least 0)
+ *          Values out of range are clipped into their own field.
+ * @param   PriorityGroup       - Used priority group
+ * @param   PreemptPriority     - Preemptive priority value (starting from 0)
+ * @param   SubPriority         - Sub-priority value (starting from 0)
+ * @retval  Encoded priority, to be used with __NVIC_SetPriority()
+ */
+__STATIC_INLINE uint32_t NVIC_EncodePriority(uint32_t PriorityGroup, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+    uint32_t PriorityGroupTmp = (PriorityGroup & 0x07UL);
+    uint32_t PreemptPriorityBits;
+    uint32_t SubPriorityBits;
+
+    PreemptPriorityBits = ((7UL - PriorityGroupTmp) > (uint32_t)(__NVIC_PRIO_BITS)) ? (uint32_t)(__NVIC_PRIO_BITS) : (uint32_t)(7UL - PriorityGroupTmp);
+    SubPriorityBits     = ((PriorityGroupTmp + (uint32_t)(__NVIC_PRIO_BITS)) < (uint32_t)7UL) ? (uint32_t)0UL : (uint32_t)((PriorityGroupTmp - 7UL) + (uint32_t)(__NVIC_PRIO_BITS));
+
+    return (
+             ((PreemptPriority & (uint32_t)((1UL << (PreemptPriorityBits)) - 1UL)) << SubPriorityBits) |
+             ((SubPriority     & (uint32_t)((1UL << (SubPriorityBits    )) - 1UL)))
+           );
+}
+
+/**
+ * @brief   Reverse of NVIC_EncodePriority()
+ */
+__STATIC_INLINE void NVIC_DecodePriority(uint32_t Priority, uint32_t PriorityGroup, uint32_t *const pPreemptPriority, uint32_t *const pSubPriority)
+{
+    uint32_t PriorityGroupTmp = (PriorityGroup & 0x07UL);
+    uint32_t PreemptPriorityBits;
+    uint32_t SubPriorityBits;
+
+    PreemptPriorityBits = ((7UL - PriorityGroupTmp) > (uint32_t)(__NVIC_PRIO_BITS)) ? (uint32_t)(__NVIC_PRIO_BITS) : (uint32_t)(7UL - PriorityGroupTmp);
+    SubPriorityBits     = ((PriorityGroupTmp + (uint32_t)(__NVIC_PRIO_BITS)) < (uint32_t)7UL) ? (uint32_t)0UL : (uint32_t)((PriorityGroupTmp - 7UL) + (uint32_t)(__NVIC_PRIO_BITS));
+
+    *pPreemptPriority = (Priority >> SubPriorityBits) & (uint32_t)((1UL << (PreemptPriorityBits)) - 1UL);
+    *pSubPriority     = (Priority                   ) & (uint32_t)((1UL << (SubPriorityBits    )) - 1UL);
+}
+
+/**
+ * @brief   Vector table access through VTOR
+ * @note    Entry 0 is the initial MSP, entry 1 Reset_Handler, core exceptions follow,
+ *          so an IRQ number maps to entry (IRQn + 16).
+ *          Writing only makes sense when VTOR points into SRAM (see .ram_vector in the linker script).
+ *          DSB makes sure the new address is visible before the next exception entry fetches it.
+ */
+#define NVIC_USER_IRQ_OFFSET    16
+
+__STATIC_INLINE void __NVIC_SetVector(IRQn_Type IRQn, uint32_t vector)
+{
+    uint32_t *vectors = (uint32_t *)SCB->VTOR;
+
+    vectors[(int32_t)IRQn + NVIC_USER_IRQ_OFFSET] = vector;
+    __DSB();
+}
+
+__STATIC_INLINE uint32_t __NVIC_GetVector(IRQn_Type IRQn)
+{
+    uint32_t *vectors = (uint32_t *)SCB->VTOR;
+
+    return vectors[(int32_t)IRQn + NVIC_USER_IRQ_OFFSET];
+}
+
+/**
+ * @brief   Request a system reset (keeps the priority group setting)
+ */
+__STATIC_INLINE void __NVIC_SystemReset(void)
+{
+    __DSB();    /* Ensure all outstanding memory accesses including buffered writes are completed */
+    SCB->AIRCR = (uint32_t)((NVIC_AIRCR_VECTKEY << SCB_AIRCR_VECTKEY_Pos) |
+                            (SCB->AIRCR & SCB_AIRCR_PRIGROUP_Msk) |
+                            SCB_AIRCR_SYSRESETREQ_Msk);
+    __DSB();
+
+    for (;;) {
+        /* wait until reset */
+    }
+}
+
+/**
+ * @brief   System Tick configuration
+ * @note    Initializes the System Timer and its interrupt, and starts the System Tick Timer.
+ *          Counter is in free running mode to generate periodic interrupts.
+ *          SysTick gets the lowest priority, HAL_InitTick() can raise it afterwards.
+ * @param   ticks - Number of ticks between two interrupts
+ * @retval  0 - Function succeeded
+ *          1 - Function failed (reload value does not fit 24 bits)
  */
 __STATIC_INLINE uint32_t SysTick_Config(uint32_t ticks)
 {
-    return 0;
+    if ((ticks - 1UL) > SysTick_LOAD_RELOAD_Msk)
+    {
+        return (1UL);
+    }
+
+    SysTick->LOAD  = (uint32_t)(ticks - 1UL);
+    __NVIC_SetPriority(SysTick_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL);
+    SysTick->VAL   = 0UL;
+    SysTick->CTRL  = SysTick_CTRL_CLKSOURCE_Msk |
+                     SysTick_CTRL_TICKINT_Msk   |
+                     SysTick_CTRL_ENABLE_Msk;
+    return (0UL);
 }
 
 #endif // _CORE_CM4_H_
\ No newline at end of file
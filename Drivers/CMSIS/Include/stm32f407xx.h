@@ -11,19 +11,105 @@
 typedef enum
 {
     /*--------------- Processor Exceptions --------------*/
+    NonMaskableInt_IRQn     = -14,  /*< 2 Non Maskable Interrupt >*/
+    HardFault_IRQn          = -13,  /*< 3 Hard Fault (priority fixed at -1) >*/
+    MemoryManagement_IRQn   = -12,  /*< 4 Memory Management Interrupt >*/
+    BusFault_IRQn           = -11,  /*< 5 Bus Fault Interrupt >*/
+    UsageFault_IRQn         = -10,  /*< 6 Usage Fault Interrupt >*/
+    SVCall_IRQn             = -5,   /*< 11 SV Call Interrupt >*/
+    DebugMonitor_IRQn       = -4,   /*< 12 Debug Monitor Interrupt >*/
+    PendSV_IRQn             = -2,   /*< 14 Pend SV Interrupt >*/
+    SysTick_IRQn            = -1,   /*< 15 System Tick Interrupt >*/
 
     /*--------------- STM32 specific interrupt numbers ------------*/
-    WWDG_IRQn           = 0,    /*< Window Watchdog interrupt >*/
-
-    RCC_IRQn            = 5,    /*< RCC global interrupt >*/
-    EXTI0_IRQn          = 6,    /*< EXTI Line0 interrupt >*/
-    EXTI1_IRQn          = 7,    /*< EXTI Line1 interrupt >*/
-    EXTI2_IRQn          = 8,    /*< EXTI Line2 interrupt >*/
-    EXTI3_IRQn          = 9,    /*< EXTI Line3 interrupt >*/
-    EXTI4_IRQn          = 10,   /*< EXTI Line4 interrupt >*/
-    
+    WWDG_IRQn               = 0,   /*< Window Watchdog interrupt >*/
+    PVD_IRQn                = 1,   /*< PVD through EXTI Line detection interrupt >*/
+    TAMP_STAMP_IRQn         = 2,   /*< Tamper and TimeStamp interrupts through the EXTI line >*/
+    RTC_WKUP_IRQn           = 3,   /*< RTC Wakeup interrupt through the EXTI line >*/
+    FLASH_IRQn              = 4,   /*< FLASH global interrupt >*/
+    RCC_IRQn                = 5,   /*< RCC global interrupt >*/
+    EXTI0_IRQn              = 6,   /*< EXTI Line0 interrupt >*/
+    EXTI1_IRQn              = 7,   /*< EXTI Line1 interrupt >*/
+    EXTI2_IRQn              = 8,   /*< EXTI Line2 interrupt >*/
+    EXTI3_IRQn              = 9,   /*< EXTI Line3 interrupt >*/
+    EXTI4_IRQn              = 10,  /*< EXTI Line4 interrupt >*/
+    DMA1_Stream0_IRQn       = 11,  /*< DMA1 Stream 0 global interrupt >*/
+    DMA1_Stream1_IRQn       = 12,  /*< DMA1 Stream 1 global interrupt >*/
+    DMA1_Stream2_IRQn       = 13,  /*< DMA1 Stream 2 global interrupt >*/
+    DMA1_Stream3_IRQn       = 14,  /*< DMA1 Stream 3 global interrupt >*/
+    DMA1_Stream4_IRQn       = 15,  /*< DMA1 Stream 4 global interrupt >*/
+    DMA1_Stream5_IRQn       = 16,  /*< DMA1 Stream 5 global interrupt >*/
+    DMA1_Stream6_IRQn       = 17,  /*< DMA1 Stream 6 global interrupt >*/
+    ADC_IRQn                = 18,  /*< ADC1, ADC2 and ADC3 global interrupts >*/
+    CAN1_TX_IRQn            = 19,  /*< CAN1 TX interrupt >*/
+    CAN1_RX0_IRQn           = 20,  /*< CAN1 RX0 interrupt >*/
+    CAN1_RX1_IRQn           = 21,  /*< CAN1 RX1 interrupt >*/
+    CAN1_SCE_IRQn           = 22,  /*< CAN1 SCE interrupt >*/
+    EXTI9_5_IRQn            = 23,  /*< External Line[9:5] interrupts >*/
+    TIM1_BRK_TIM9_IRQn      = 24,  /*< TIM1 Break interrupt and TIM9 global interrupt >*/
+    TIM1_UP_TIM10_IRQn      = 25,  /*< TIM1 Update interrupt and TIM10 global interrupt >*/
+    TIM1_TRG_COM_TIM11_IRQn = 26,  /*< TIM1 Trigger and Commutation interrupt and TIM11 global interrupt >*/
+    TIM1_CC_IRQn            = 27,  /*< TIM1 Capture Compare interrupt >*/
+    TIM2_IRQn               = 28,  /*< TIM2 global interrupt >*/
+    TIM3_IRQn               = 29,  /*< TIM3 global interrupt >*/
+    TIM4_IRQn               = 30,  /*< TIM4 global interrupt >*/
+    I2C1_EV_IRQn            = 31,  /*< I2C1 Event interrupt >*/
+    I2C1_ER_IRQn            = 32,  /*< I2C1 Error interrupt >*/
+    I2C2_EV_IRQn            = 33,  /*< I2C2 Event interrupt >*/
+    I2C2_ER_IRQn            = 34,  /*< I2C2 Error interrupt >*/
+    SPI1_IRQn               = 35,  /*< SPI1 global interrupt >*/
+    SPI2_IRQn               = 36,  /*< SPI2 global interrupt >*/
+    USART1_IRQn             = 37,  /*< USART1 global interrupt >*/
+    USART2_IRQn             = 38,  /*< USART2 global interrupt >*/
+    USART3_IRQn             = 39,  /*< USART3 global interrupt >*/
+    EXTI15_10_IRQn          = 40,  /*< External Line[15:10] interrupts >*/
+    RTC_Alarm_IRQn          = 41,  /*< RTC Alarm (A and B) through EXTI Line interrupt >*/
+    OTG_FS_WKUP_IRQn        = 42,  /*< USB OTG FS Wakeup through EXTI line interrupt >*/
+    TIM8_BRK_TIM12_IRQn     = 43,  /*< TIM8 Break interrupt and TIM12 global interrupt >*/
+    TIM8_UP_TIM13_IRQn      = 44,  /*< TIM8 Update interrupt and TIM13 global interrupt >*/
+    TIM8_TRG_COM_TIM14_IRQn = 45,  /*< TIM8 Trigger and Commutation interrupt and TIM14 global interrupt >*/
+    TIM8_CC_IRQn            = 46,  /*< TIM8 Capture Compare global interrupt >*/
+    DMA1_Stream7_IRQn       = 47,  /*< DMA1 Stream7 interrupt >*/
+    FSMC_IRQn               = 48,  /*< FSMC global interrupt >*/
+    SDIO_IRQn               = 49,  /*< SDIO global interrupt >*/
+    TIM5_IRQn               = 50,  /*< TIM5 global interrupt >*/
+    SPI3_IRQn               = 51,  /*< SPI3 global interrupt >*/
+    UART4_IRQn              = 52,  /*< UART4 global interrupt >*/
+    UART5_IRQn              = 53,  /*< UART5 global interrupt >*/
+    TIM6_DAC_IRQn           = 54,  /*< TIM6 global and DAC1&2 underrun error interrupts >*/
+    TIM7_IRQn               = 55,  /*< TIM7 global interrupt >*/
+    DMA2_Stream0_IRQn       = 56,  /*< DMA2 Stream 0 global interrupt >*/
+    DMA2_Stream1_IRQn       = 57,  /*< DMA2 Stream 1 global interrupt >*/
+    DMA2_Stream2_IRQn       = 58,  /*< DMA2 Stream 2 global interrupt >*/
+    DMA2_Stream3_IRQn       = 59,  /*< DMA2 Stream 3 global interrupt >*/
+    DMA2_Stream4_IRQn       = 60,  /*< DMA2 Stream 4 global interrupt >*/
+    ETH_IRQn                = 61,  /*< Ethernet global interrupt >*/
+    ETH_WKUP_IRQn           = 62,  /*< Ethernet Wakeup through EXTI line interrupt >*/
+    CAN2_TX_IRQn            = 63,  /*< CAN2 TX interrupt >*/
+    CAN2_RX0_IRQn           = 64,  /*< CAN2 RX0 interrupt >*/
+    CAN2_RX1_IRQn           = 65,  /*< CAN2 RX1 interrupt >*/
+    CAN2_SCE_IRQn           = 66,  /*< CAN2 SCE interrupt >*/
+    OTG_FS_IRQn             = 67,  /*< USB OTG FS global interrupt >*/
+    DMA2_Stream5_IRQn       = 68,  /*< DMA2 Stream 5 global interrupt >*/
+    DMA2_Stream6_IRQn       = 69,  /*< DMA2 Stream 6 global interrupt >*/
+    DMA2_Stream7_IRQn       = 70,  /*< DMA2 Stream 7 global interrupt >*/
+    USART6_IRQn             = 71,  /*< USART6 global interrupt >*/
+    I2C3_EV_IRQn            = 72,  /*< I2C3 event interrupt >*/
+    I2C3_ER_IRQn            = 73,  /*< I2C3 error interrupt >*/
+    OTG_HS_EP1_OUT_IRQn     = 74,  /*< USB OTG HS End Point 1 Out global interrupt >*/
+    OTG_HS_EP1_IN_IRQn      = 75,  /*< USB OTG HS End Point 1 In global interrupt >*/
+    OTG_HS_WKUP_IRQn        = 76,  /*< USB OTG HS Wakeup through EXTI interrupt >*/
+    OTG_HS_IRQn             = 77,  /*< USB OTG HS global interrupt >*/
+    DCMI_IRQn               = 78,  /*< DCMI global interrupt >*/
+    RNG_IRQn                = 80,  /*< RNG global interrupt >*/
+    FPU_IRQn                = 81,  /*< FPU global interrupt >*/
 } IRQn_Type;
 
+/**
+ * @brief   Cortex-M4 processor configuration
+ */
+#define __NVIC_PRIO_BITS    4U      /*< STM32F4xx uses 4 bits for the priority levels >*/
+
 
 #include "core_cm4.h"
 #include <stdint.h>
@@ -96,9 +182,9 @@ typedef struct
     __IO uint32_t OTYPER;   /*< GPIO port output type register >*/
     __IO uint32_t OSPEEDR;  /*< GPIO port output speed register >*/
     __IO uint32_t PURDR;    /*< GPIO port pull-up/down register >*/
-    __IO uint32_t IDR;      /*< GPIO port input data register >*/
+    __I  uint32_t IDR;      /*< GPIO port input data register (read-only) >*/
     __IO uint32_t ODR;      /*< GPIO port output data register >*/
-    __IO uint32_t BSRR;     /*< GPIO port bit set/reset register >*/
+    __WO_uint32_t BSRR;     /*< GPIO port bit set/reset register (write-only, reads as 0) >*/
     __IO uint32_t LCKR;     /*< GPIO configuration lock register >*/
     __IO uint32_t AFRL;     /*< GPIO alternate func low register >*/
     __IO uint32_t AFRH;     /*< GPIO alternate func high register >*/
@@ -118,14 +204,361 @@ typedef struct
     __IO uint32_t PR;       /*< EXTI Pending Register >*/
 } EXTI_TypeDef;
 
+/**
+ * @brief   DMA Controller (DMA)
+ */
+typedef struct
+{
+    __IO uint32_t CR;       /*< DMA stream x configuration register >*/
+    __IO uint32_t NDTR;     /*< DMA stream x number of data register >*/
+    __IO uint32_t PAR;      /*< DMA stream x peripheral address register >*/
+    __IO uint32_t M0AR;     /*< DMA stream x memory 0 address register >*/
+    __IO uint32_t M1AR;     /*< DMA stream x memory 1 address register >*/
+    __IO uint32_t FCR;      /*< DMA stream x FIFO control register >*/
+} DMA_Stream_TypeDef;
+
+typedef struct
+{
+    __I  uint32_t LISR;     /*< DMA low interrupt status register (stream 0-3) >*/
+    __I  uint32_t HISR;     /*< DMA high interrupt status register (stream 4-7) >*/
+    __WO_uint32_t LIFCR;    /*< DMA low interrupt flag clear register >*/
+    __WO_uint32_t HIFCR;    /*< DMA high interrupt flag clear register >*/
+} DMA_TypeDef;
+
+/**
+ * @brief   Timers (TIM1 - TIM14)
+ * @note    Not every timer implements every register: RCR/BDTR only exist on TIM1/TIM8,
+ *          CCR3/CCR4 & DMA burst are missing on TIM9-14, TIM6/7 only have the time-base.
+ */
+typedef struct
+{
+    __IO uint32_t CR1;      /*< TIM control register 1 >*/
+    __IO uint32_t CR2;      /*< TIM control register 2 >*/
+    __IO uint32_t SMCR;     /*< TIM slave mode control register >*/
+    __IO uint32_t DIER;     /*< TIM DMA/interrupt enable register >*/
+    __IO uint32_t SR;       /*< TIM status register >*/
+    __WO_uint32_t EGR;      /*< TIM event generation register >*/
+    __IO uint32_t CCMR1;    /*< TIM capture/compare mode register 1 >*/
+    __IO uint32_t CCMR2;    /*< TIM capture/compare mode register 2 >*/
+    __IO uint32_t CCER;     /*< TIM capture/compare enable register >*/
+    __IO uint32_t CNT;      /*< TIM counter register >*/
+    __IO uint32_t PSC;      /*< TIM prescaler >*/
+    __IO uint32_t ARR;      /*< TIM auto-reload register >*/
+    __IO uint32_t RCR;      /*< TIM repetition counter register >*/
+    __IO uint32_t CCR1;     /*< TIM capture/compare register 1 >*/
+    __IO uint32_t CCR2;     /*< TIM capture/compare register 2 >*/
+    __IO uint32_t CCR3;     /*< TIM capture/compare register 3 >*/
+    __IO uint32_t CCR4;     /*< TIM capture/compare register 4 >*/
+    __IO uint32_t BDTR;     /*< TIM break and dead-time register >*/
+    __IO uint32_t DCR;      /*< TIM DMA control register >*/
+    __IO uint32_t DMAR;     /*< TIM DMA address for full transfer >*/
+    __IO uint32_t OR;       /*< TIM option register (TIM2/5/11) >*/
+} TIM_TypeDef;
+
+/**
+ * @brief   Analog to Digital Converter (ADC1 - ADC3)
+ */
+typedef struct
+{
+    __IO uint32_t SR;       /*< ADC status register >*/
+    __IO uint32_t CR1;      /*< ADC control register 1 >*/
+    __IO uint32_t CR2;      /*< ADC control register 2 >*/
+    __IO uint32_t SMPR1;    /*< ADC sample time register 1 (channels 10-18) >*/
+    __IO uint32_t SMPR2;    /*< ADC sample time register 2 (channels 0-9) >*/
+    __IO uint32_t JOFR1;    /*< ADC injected channel data offset register 1 >*/
+    __IO uint32_t JOFR2;    /*< ADC injected channel data offset register 2 >*/
+    __IO uint32_t JOFR3;    /*< ADC injected channel data offset register 3 >*/
+    __IO uint32_t JOFR4;    /*< ADC injected channel data offset register 4 >*/
+    __IO uint32_t HTR;      /*< ADC watchdog higher threshold register >*/
+    __IO uint32_t LTR;      /*< ADC watchdog lower threshold register >*/
+    __IO uint32_t SQR1;     /*< ADC regular sequence register 1 (ranks 13-16, length) >*/
+    __IO uint32_t SQR2;     /*< ADC regular sequence register 2 (ranks 7-12) >*/
+    __IO uint32_t SQR3;     /*< ADC regular sequence register 3 (ranks 1-6) >*/
+    __IO uint32_t JSQR;     /*< ADC injected sequence register >*/
+    __I  uint32_t JDR1;     /*< ADC injected data register 1 >*/
+    __I  uint32_t JDR2;     /*< ADC injected data register 2 >*/
+    __I  uint32_t JDR3;     /*< ADC injected data register 3 >*/
+    __I  uint32_t JDR4;     /*< ADC injected data register 4 >*/
+    __I  uint32_t DR;       /*< ADC regular data register >*/
+} ADC_TypeDef;
+
+typedef struct
+{
+    __I  uint32_t CSR;      /*< ADC common status register (flags of ADC1/2/3) >*/
+    __IO uint32_t CCR;      /*< ADC common control register >*/
+    __I  uint32_t CDR;      /*< ADC common regular data register for dual/triple modes >*/
+} ADC_Common_TypeDef;
+
+/**
+ * @brief   Digital to Analog Converter (DAC, channels 1 and 2)
+ */
+typedef struct
+{
+    __IO uint32_t CR;       /*< DAC control register >*/
+    __WO_uint32_t SWTRIGR;  /*< DAC software trigger register >*/
+    __IO uint32_t DHR12R1;  /*< DAC channel1 12-bit right-aligned data holding register >*/
+    __IO uint32_t DHR12L1;  /*< DAC channel1 12-bit left-aligned data holding register >*/
+    __IO uint32_t DHR8R1;   /*< DAC channel1 8-bit right-aligned data holding register >*/
+    __IO uint32_t DHR12R2;  /*< DAC channel2 12-bit right-aligned data holding register >*/
+    __IO uint32_t DHR12L2;  /*< DAC channel2 12-bit left-aligned data holding register >*/
+    __IO uint32_t DHR8R2;   /*< DAC channel2 8-bit right-aligned data holding register >*/
+    __IO uint32_t DHR12RD;  /*< Dual DAC 12-bit right-aligned data holding register >*/
+    __IO uint32_t DHR12LD;  /*< Dual DAC 12-bit left-aligned data holding register >*/
+    __IO uint32_t DHR8RD;   /*< Dual DAC 8-bit right-aligned data holding register >*/
+    __I  uint32_t DOR1;     /*< DAC channel1 data output register >*/
+    __I  uint32_t DOR2;     /*< DAC channel2 data output register >*/
+    __IO uint32_t SR;       /*< DAC status register >*/
+} DAC_TypeDef;
+
+/**
+ * @brief   Controller Area Network TX mailbox
+ */
+typedef struct
+{
+    __IO uint32_t TIR;      /*< CAN TX mailbox identifier register >*/
+    __IO uint32_t TDTR;     /*< CAN mailbox data length control and time stamp register >*/
+    __IO uint32_t TDLR;     /*< CAN mailbox data low register >*/
+    __IO uint32_t TDHR;     /*< CAN mailbox data high register >*/
+} CAN_TxMailBox_TypeDef;
+
+/**
+ * @brief   Controller Area Network FIFO mailbox
+ */
+typedef struct
+{
+    __IO uint32_t RIR;      /*< CAN receive FIFO mailbox identifier register >*/
+    __IO uint32_t RDTR;     /*< CAN receive FIFO mailbox data length control and time stamp register >*/
+    __IO uint32_t RDLR;     /*< CAN receive FIFO mailbox data low register >*/
+    __IO uint32_t RDHR;     /*< CAN receive FIFO mailbox data high register >*/
+} CAN_FIFOMailBox_TypeDef;
+
+/**
+ * @brief   Controller Area Network filter bank
+ */
+typedef struct
+{
+    __IO uint32_t FR1;      /*< CAN filter bank register 1 >*/
+    __IO uint32_t FR2;      /*< CAN filter bank register 2 >*/
+} CAN_FilterRegister_TypeDef;
+
+/**
+ * @brief   Controller Area Network (bxCAN, CAN1 master / CAN2 slave)
+ * @note    The 28 filter banks are shared and only accessible through CAN1.
+ */
+typedef struct
+{
+    __IO uint32_t MCR;                          /*< CAN master control register >*/
+    __IO uint32_t MSR;                          /*< CAN master status register >*/
+    __IO uint32_t TSR;                          /*< CAN transmit status register >*/
+    __IO uint32_t RF0R;                         /*< CAN receive FIFO 0 register >*/
+    __IO uint32_t RF1R;                         /*< CAN receive FIFO 1 register >*/
+    __IO uint32_t IER;                          /*< CAN interrupt enable register >*/
+    __IO uint32_t ESR;                          /*< CAN error status register >*/
+    __IO uint32_t BTR;                          /*< CAN bit timing register >*/
+    uint32_t      RESERVED0[88];                /*< Reserved: 0x020 - 0x17F >*/
+    CAN_TxMailBox_TypeDef      sTxMailBox[3];   /*< CAN TX mailboxes: 0x180 - 0x1AC >*/
+    CAN_FIFOMailBox_TypeDef    sFIFOMailBox[2]; /*< CAN FIFO mailboxes: 0x1B0 - 0x1CC >*/
+    uint32_t      RESERVED1[12];                /*< Reserved: 0x1D0 - 0x1FF >*/
+    __IO uint32_t FMR;                          /*< CAN filter master register >*/
+    __IO uint32_t FM1R;                         /*< CAN filter mode register >*/
+    uint32_t      RESERVED2;                    /*< Reserved: 0x208 >*/
+    __IO uint32_t FS1R;                         /*< CAN filter scale register >*/
+    uint32_t      RESERVED3;                    /*< Reserved: 0x210 >*/
+    __IO uint32_t FFA1R;                        /*< CAN filter FIFO assignment register >*/
+    uint32_t      RESERVED4;                    /*< Reserved: 0x218 >*/
+    __IO uint32_t FA1R;                         /*< CAN filter activation register >*/
+    uint32_t      RESERVED5[8];                 /*< Reserved: 0x220 - 0x23F >*/
+    CAN_FilterRegister_TypeDef sFilterRegister[28]; /*< CAN filter banks: 0x240 - 0x31C >*/
+} CAN_TypeDef;
+
+/**
+ * @brief   SD/SDIO/MMC card host interface
+ */
+typedef struct
+{
+    __IO uint32_t POWER;        /*< SDIO power control register >*/
+    __IO uint32_t CLKCR;        /*< SDIO clock control register >*/
+    __IO uint32_t ARG;          /*< SDIO argument register >*/
+    __IO uint32_t CMD;          /*< SDIO command register >*/
+    __I  uint32_t RESPCMD;      /*< SDIO command response register >*/
+    __I  uint32_t RESP1;        /*< SDIO response 1 register >*/
+    __I  uint32_t RESP2;        /*< SDIO response 2 register >*/
+    __I  uint32_t RESP3;        /*< SDIO response 3 register >*/
+    __I  uint32_t RESP4;        /*< SDIO response 4 register >*/
+    __IO uint32_t DTIMER;       /*< SDIO data timer register >*/
+    __IO uint32_t DLEN;         /*< SDIO data length register >*/
+    __IO uint32_t DCTRL;        /*< SDIO data control register >*/
+    __I  uint32_t DCOUNT;       /*< SDIO data counter register >*/
+    __I  uint32_t STA;          /*< SDIO status register >*/
+    __IO uint32_t ICR;          /*< SDIO interrupt clear register >*/
+    __IO uint32_t MASK;         /*< SDIO mask register >*/
+    uint32_t      RESERVED0[2]; /*< Reserved: 0x40 - 0x44 >*/
+    __I  uint32_t FIFOCNT;      /*< SDIO FIFO counter register >*/
+    uint32_t      RESERVED1[13];/*< Reserved: 0x4C - 0x7C >*/
+    __IO uint32_t FIFO;         /*< SDIO data FIFO register >*/
+} SDIO_TypeDef;
+
+/**
+ * @brief   Ethernet MAC, MMC counters, PTP and DMA
+ */
+typedef struct
+{
+    __IO uint32_t MACCR;        /*< MAC configuration register >*/
+    __IO uint32_t MACFFR;       /*< MAC frame filter register >*/
+    __IO uint32_t MACHTHR;      /*< MAC hash table high register >*/
+    __IO uint32_t MACHTLR;      /*< MAC hash table low register >*/
+    __IO uint32_t MACMIIAR;     /*< MAC MII address register >*/
+    __IO uint32_t MACMIIDR;     /*< MAC MII data register >*/
+    __IO uint32_t MACFCR;       /*< MAC flow control register >*/
+    __IO uint32_t MACVLANTR;    /*< MAC VLAN tag register >*/
+    uint32_t      RESERVED0[2]; /*< Reserved: 0x20 - 0x24 >*/
+    __IO uint32_t MACRWUFFR;    /*< MAC remote wakeup frame filter register >*/
+    __IO uint32_t MACPMTCSR;    /*< MAC PMT control and status register >*/
+    uint32_t      RESERVED1;    /*< Reserved: 0x30 >*/
+    __I  uint32_t MACDBGR;      /*< MAC debug register >*/
+    __IO uint32_t MACSR;        /*< MAC interrupt status register >*/
+    __IO uint32_t MACIMR;       /*< MAC interrupt mask register >*/
+    __IO uint32_t MACA0HR;      /*< MAC address 0 high register >*/
+    __IO uint32_t MACA0LR;      /*< MAC address 0 low register >*/
+    __IO uint32_t MACA1HR;      /*< MAC address 1 high register >*/
+    __IO uint32_t MACA1LR;      /*< MAC address 1 low register >*/
+    __IO uint32_t MACA2HR;      /*< MAC address 2 high register >*/
+    __IO uint32_t MACA2LR;      /*< MAC address 2 low register >*/
+    __IO uint32_t MACA3HR;      /*< MAC address 3 high register >*/
+    __IO uint32_t MACA3LR;      /*< MAC address 3 low register >*/
+    uint32_t      RESERVED2[40];/*< Reserved: 0x60 - 0xFC >*/
+    __IO uint32_t MMCCR;        /*< MMC control register >*/
+    __IO uint32_t MMCRIR;       /*< MMC receive interrupt register >*/
+    __IO uint32_t MMCTIR;       /*< MMC transmit interrupt register >*/
+    __IO uint32_t MMCRIMR;      /*< MMC receive interrupt mask register >*/
+    __IO uint32_t MMCTIMR;      /*< MMC transmit interrupt mask register >*/
+    uint32_t      RESERVED3[14];/*< Reserved: 0x114 - 0x148 >*/
+    __I  uint32_t MMCTGFSCCR;   /*< MMC TX good frames after a single collision counter >*/
+    __I  uint32_t MMCTGFMSCCR;  /*< MMC TX good frames after more than one collision counter >*/
+    uint32_t      RESERVED4[5]; /*< Reserved: 0x154 - 0x164 >*/
+    __I  uint32_t MMCTGFCR;     /*< MMC TX good frame counter >*/
+    uint32_t      RESERVED5[10];/*< Reserved: 0x16C - 0x190 >*/
+    __I  uint32_t MMCRFCECR;    /*< MMC RX frames with CRC error counter >*/
+    __I  uint32_t MMCRFAECR;    /*< MMC RX frames with alignment error counter >*/
+    uint32_t      RESERVED6[10];/*< Reserved: 0x19C - 0x1C0 >*/
+    __I  uint32_t MMCRGUFCR;    /*< MMC RX good unicast frames counter >*/
+    uint32_t      RESERVED7[334];   /*< Reserved: 0x1C8 - 0x6FC >*/
+    __IO uint32_t PTPTSCR;      /*< PTP time stamp control register >*/
+    __IO uint32_t PTPSSIR;      /*< PTP subsecond increment register >*/
+    __I  uint32_t PTPTSHR;      /*< PTP time stamp high register >*/
+    __I  uint32_t PTPTSLR;      /*< PTP time stamp low register >*/
+    __IO uint32_t PTPTSHUR;     /*< PTP time stamp high update register >*/
+    __IO uint32_t PTPTSLUR;     /*< PTP time stamp low update register >*/
+    __IO uint32_t PTPTSAR;      /*< PTP time stamp addend register >*/
+    __IO uint32_t PTPTTHR;      /*< PTP target time high register >*/
+    __IO uint32_t PTPTTLR;      /*< PTP target time low register >*/
+    uint32_t      RESERVED8;    /*< Reserved: 0x724 >*/
+    __I  uint32_t PTPTSSR;      /*< PTP time stamp status register >*/
+    uint32_t      RESERVED9[565];   /*< Reserved: 0x72C - 0xFFC >*/
+    __IO uint32_t DMABMR;       /*< DMA bus mode register >*/
+    __IO uint32_t DMATPDR;      /*< DMA transmit poll demand register >*/
+    __IO uint32_t DMARPDR;      /*< DMA receive poll demand register >*/
+    __IO uint32_t DMARDLAR;     /*< DMA receive descriptor list address register >*/
+    __IO uint32_t DMATDLAR;     /*< DMA transmit descriptor list address register >*/
+    __IO uint32_t DMASR;        /*< DMA status register >*/
+    __IO uint32_t DMAOMR;       /*< DMA operation mode register >*/
+    __IO uint32_t DMAIER;       /*< DMA interrupt enable register >*/
+    __IO uint32_t DMAMFBOCR;    /*< DMA missed frame and buffer overflow counter register >*/
+    __IO uint32_t DMARSWTR;     /*< DMA receive status watchdog timer register >*/
+    uint32_t      RESERVED10[8];/*< Reserved: 0x1028 - 0x1044 >*/
+    __I  uint32_t DMACHTDR;     /*< DMA current host transmit descriptor register >*/
+    __I  uint32_t DMACHRDR;     /*< DMA current host receive descriptor register >*/
+    __I  uint32_t DMACHTBAR;    /*< DMA current host transmit buffer address register >*/
+    __I  uint32_t DMACHRBAR;    /*< DMA current host receive buffer address register >*/
+} ETH_TypeDef;
+
+/**
+ * @brief   FLASH interface
+ */
+typedef struct
+{
+    __IO uint32_t ACR;          /*< FLASH access control register >*/
+    __IO uint32_t KEYR;         /*< FLASH key register >*/
+    __IO uint32_t OPTKEYR;      /*< FLASH option key register >*/
+    __IO uint32_t SR;           /*< FLASH status register >*/
+    __IO uint32_t CR;           /*< FLASH control register >*/
+    __IO uint32_t OPTCR;        /*< FLASH option control register >*/
+} FLASH_TypeDef;
+
+/**
+ * @brief   Power control (PWR)
+ */
+typedef struct
+{
+    __IO uint32_t CR;           /*< PWR power control register >*/
+    __IO uint32_t CSR;          /*< PWR power control/status register >*/
+} PWR_TypeDef;
+
+/**
+ * @brief   Real-time clock (RTC)
+ */
+typedef struct
+{
+    __IO uint32_t TR;           /*< RTC time register >*/
+    __IO uint32_t DR;           /*< RTC date register >*/
+    __IO uint32_t CR;           /*< RTC control register >*/
+    __IO uint32_t ISR;          /*< RTC initialization and status register >*/
+    __IO uint32_t PRER;         /*< RTC prescaler register >*/
+    __IO uint32_t WUTR;         /*< RTC wakeup timer register >*/
+    __IO uint32_t CALIBR;       /*< RTC calibration register >*/
+    __IO uint32_t ALRMAR;       /*< RTC alarm A register >*/
+    __IO uint32_t ALRMBR;       /*< RTC alarm B register >*/
+    __IO uint32_t WPR;          /*< RTC write protection register >*/
+    __IO uint32_t SSR;          /*< RTC sub second register >*/
+    __IO uint32_t SHIFTR;       /*< RTC shift control register >*/
+    __IO uint32_t TSTR;         /*< RTC time stamp time register >*/
+    __IO uint32_t TSDR;         /*< RTC time stamp date register >*/
+    __IO uint32_t TSSSR;        /*< RTC time stamp sub second register >*/
+    __IO uint32_t CALR;         /*< RTC calibration register >*/
+    __IO uint32_t TAFCR;        /*< RTC tamper and alternate function configuration register >*/
+    __IO uint32_t ALRMASSR;     /*< RTC alarm A sub second register >*/
+    __IO uint32_t ALRMBSSR;     /*< RTC alarm B sub second register >*/
+    uint32_t      RESERVED;     /*< Reserved: 0x4C >*/
+    __IO uint32_t BKPR[20];     /*< RTC backup registers 0 ~ 19 >*/
+} RTC_TypeDef;
+
+/**
+ * @brief   Debug MCU (DBGMCU)
+ */
+typedef struct
+{
+    __I  uint32_t IDCODE;       /*< MCU device ID code >*/
+    __IO uint32_t CR;           /*< Debug MCU configuration register >*/
+    __IO uint32_t APB1FZ;       /*< Debug MCU APB1 freeze register >*/
+    __IO uint32_t APB2FZ;       /*< Debug MCU APB2 freeze register >*/
+} DBGMCU_TypeDef;
+
+/**
+ * @brief   Flexible static memory controller, NOR/SRAM banks
+ * @note    BTCR[2n] is BCRn+1 (control), BTCR[2n+1] is BTRn+1 (read timing, or both
+ *          without extended mode). BWTR[2n] is BWTRn+1 (write timing, extended mode).
+ */
+typedef struct
+{
+    __IO uint32_t BTCR[8];      /*< NOR/PSRAM chip-select control and timing registers >*/
+} FSMC_Bank1_TypeDef;
+
+typedef struct
+{
+    __IO uint32_t BWTR[7];      /*< NOR/PSRAM write timing registers >*/
+} FSMC_Bank1E_TypeDef;
+
 /*****************************************************************/
 /*                  Peripheral Memory Map						 */
 /*****************************************************************/
 /**
  * @brief: Regions (512MB each, total 4GB)
  */
+#define FLASH_BASE          (0x08000000UL)                  /*< Main memory, sector 0 >*/
 #define SRAM_BASE           (0x20000000UL)
 #define PERIPH_BASE         (0x40000000UL)
+#define DBGMCU_BASE         (0xE0042000UL)                  /*< On the Cortex-M4 private peripheral bus >*/
+#define FSMC_BANK1_BASE     (0x60000000UL)                  /*< External NOR/SRAM, 4 x 64MB, NE1 ~ NE4 >*/
 
 /**
  * @brief: Peripheral memory map
@@ -134,7 +567,7 @@ typedef struct
 #define APB2PERIPH_BASE     (PERIPH_BASE + 0x00010000UL)
 #define AHB1PERIPH_BASE     (PERIPH_BASE + 0x00020000UL)
 #define AHB2PERIPH_BASE     (PERIPH_BASE + 0x10050000UL)    // is it right? HAL lib says it is 0x10000000 offset
-#define AHB3PERIPH_BASE     (PERIPH_BASE + 0x20000000UL)
+#define AHB3PERIPH_BASE     (PERIPH_BASE + 0x60000000UL)    /*< FSMC registers, 0x60000000 is the external memory itself >*/
 
 /**
  * @brief: APB1 peripherals
@@ -170,6 +603,10 @@ typedef struct
  */
 #define TIM1_BASE           (APB2PERIPH_BASE + 0x0000UL)
 #define TIM8_BASE           (APB2PERIPH_BASE + 0x0400UL)
+#define ADC1_BASE           (APB2PERIPH_BASE + 0x2000UL)
+#define ADC2_BASE           (APB2PERIPH_BASE + 0x2100UL)
+#define ADC3_BASE           (APB2PERIPH_BASE + 0x2200UL)
+#define ADC123_COMMON_BASE  (APB2PERIPH_BASE + 0x2300UL)
 #define USART1_BASE         (APB2PERIPH_BASE + 0x1000UL)
 #define USART6_BASE         (APB2PERIPH_BASE + 0x1400UL)
 #define SDIO_BASE           (APB2PERIPH_BASE + 0x2C00UL)
@@ -199,10 +636,34 @@ typedef struct
 #define DMA2_BASE           (AHB1PERIPH_BASE + 0x6400UL)
 #define ETH_BASE            (AHB1PERIPH_BASE + 0x8000UL)    /*< Ethernet MAC base address >*/
 
+/* DMA streams: 0x10 + 0x18 * stream */
+#define DMA1_Stream0_BASE   (DMA1_BASE + 0x010UL)
+#define DMA1_Stream1_BASE   (DMA1_BASE + 0x028UL)
+#define DMA1_Stream2_BASE   (DMA1_BASE + 0x040UL)
+#define DMA1_Stream3_BASE   (DMA1_BASE + 0x058UL)
+#define DMA1_Stream4_BASE   (DMA1_BASE + 0x070UL)
+#define DMA1_Stream5_BASE   (DMA1_BASE + 0x088UL)
+#define DMA1_Stream6_BASE   (DMA1_BASE + 0x0A0UL)
+#define DMA1_Stream7_BASE   (DMA1_BASE + 0x0B8UL)
+#define DMA2_Stream0_BASE   (DMA2_BASE + 0x010UL)
+#define DMA2_Stream1_BASE   (DMA2_BASE + 0x028UL)
+#define DMA2_Stream2_BASE   (DMA2_BASE + 0x040UL)
+#define DMA2_Stream3_BASE   (DMA2_BASE + 0x058UL)
+#define DMA2_Stream4_BASE   (DMA2_BASE + 0x070UL)
+#define DMA2_Stream5_BASE   (DMA2_BASE + 0x088UL)
+#define DMA2_Stream6_BASE   (DMA2_BASE + 0x0A0UL)
+#define DMA2_Stream7_BASE   (DMA2_BASE + 0x0B8UL)
+
  /**
  * @brief: AHB2 peripherals
  */
 
+/**
+ * @brief: AHB3 peripherals
+ */
+#define FSMC_Bank1_R_BASE   (AHB3PERIPH_BASE + 0x0000UL)
+#define FSMC_Bank1E_R_BASE  (AHB3PERIPH_BASE + 0x0104UL)
+
 /*****************************************************************/
 /*                  Peripheral Declaration						 */
 /*                  (be able to dereference)				     */
@@ -218,13 +679,69 @@ typedef struct
 #define GPIOH       ((GPIO_TypeDef *) GPIOH_BASE)
 #define GPIOI       ((GPIO_TypeDef *) GPIOI_BASE)
 
+#define TIM1        ((TIM_TypeDef *) TIM1_BASE)
+#define TIM2        ((TIM_TypeDef *) TIM2_BASE)
+#define TIM3        ((TIM_TypeDef *) TIM3_BASE)
+#define TIM4        ((TIM_TypeDef *) TIM4_BASE)
+#define TIM5        ((TIM_TypeDef *) TIM5_BASE)
+#define TIM6        ((TIM_TypeDef *) TIM6_BASE)
+#define TIM7        ((TIM_TypeDef *) TIM7_BASE)
+#define TIM8        ((TIM_TypeDef *) TIM8_BASE)
+#define TIM9        ((TIM_TypeDef *) TIM9_BASE)
+#define TIM10       ((TIM_TypeDef *) TIM10_BASE)
+#define TIM11       ((TIM_TypeDef *) TIM11_BASE)
+#define TIM12       ((TIM_TypeDef *) TIM12_BASE)
+#define TIM13       ((TIM_TypeDef *) TIM13_BASE)
+#define TIM14       ((TIM_TypeDef *) TIM14_BASE)
+
+#define ADC1        ((ADC_TypeDef *) ADC1_BASE)
+#define ADC2        ((ADC_TypeDef *) ADC2_BASE)
+#define ADC3        ((ADC_TypeDef *) ADC3_BASE)
+#define ADC123_COMMON ((ADC_Common_TypeDef *) ADC123_COMMON_BASE)
+
+#define DAC         ((DAC_TypeDef *) DAC_BASE)
+
+#define CAN1        ((CAN_TypeDef *) CAN1_BASE)
+#define CAN2        ((CAN_TypeDef *) CAN2_BASE)
+
+#define SDIO        ((SDIO_TypeDef *) SDIO_BASE)
+
+#define ETH         ((ETH_TypeDef *) ETH_BASE)
+
+#define DMA1        ((DMA_TypeDef *) DMA1_BASE)
+#define DMA2        ((DMA_TypeDef *) DMA2_BASE)
+#define DMA1_Stream0    ((DMA_Stream_TypeDef *) DMA1_Stream0_BASE)
+#define DMA1_Stream1    ((DMA_Stream_TypeDef *) DMA1_Stream1_BASE)
+#define DMA1_Stream2    ((DMA_Stream_TypeDef *) DMA1_Stream2_BASE)
+#define DMA1_Stream3    ((DMA_Stream_TypeDef *) DMA1_Stream3_BASE)
+#define DMA1_Stream4    ((DMA_Stream_TypeDef *) DMA1_Stream4_BASE)
+#define DMA1_Stream5    ((DMA_Stream_TypeDef *) DMA1_Stream5_BASE)
+#define DMA1_Stream6    ((DMA_Stream_TypeDef *) DMA1_Stream6_BASE)
+#define DMA1_Stream7    ((DMA_Stream_TypeDef *) DMA1_Stream7_BASE)
+#define DMA2_Stream0    ((DMA_Stream_TypeDef *) DMA2_Stream0_BASE)
+#define DMA2_Stream1    ((DMA_Stream_TypeDef *) DMA2_Stream1_BASE)
+#define DMA2_Stream2    ((DMA_Stream_TypeDef *) DMA2_Stream2_BASE)
+#define DMA2_Stream3    ((DMA_Stream_TypeDef *) DMA2_Stream3_BASE)
+#define DMA2_Stream4    ((DMA_Stream_TypeDef *) DMA2_Stream4_BASE)
+#define DMA2_Stream5    ((DMA_Stream_TypeDef *) DMA2_Stream5_BASE)
+#define DMA2_Stream6    ((DMA_Stream_TypeDef *) DMA2_Stream6_BASE)
+#define DMA2_Stream7    ((DMA_Stream_TypeDef *) DMA2_Stream7_BASE)
+
 //#define CRC         ((CRC_TypeDef *) CRC_BASE)
+#define RTC         ((RTC_TypeDef *) RTC_BASE)
+#define PWR         ((PWR_TypeDef *) PWR_BASE)
 #define RCC         ((RCC_TypeDef *) RCC_BASE)
+#define FLASH       ((FLASH_TypeDef *) FLASH_R_BASE)
 
 #define SYSCFG      ((SYSCFG_TypeDef *) SYSCFG_BASE)
 
 #define EXTI        ((EXTI_TypeDef *) EXTI_BASE)
 
+#define FSMC_Bank1  ((FSMC_Bank1_TypeDef *) FSMC_Bank1_R_BASE)
+#define FSMC_Bank1E ((FSMC_Bank1E_TypeDef *) FSMC_Bank1E_R_BASE)
+
+#define DBGMCU      ((DBGMCU_TypeDef *) DBGMCU_BASE)
+
 
 
 /*****************************************************************/
@@ -302,6 +819,18 @@ typedef struct
 #define RCC_CFGR_SWS_HSI                0x00000000U     /*< HSI is used as system clock >*/
 #define RCC_CFGR_SWS_HSE                0x00000004U     /*< HSE is used as system clock >*/
 #define RCC_CFGR_SWS_PLL                0x00000008U     /*< PLL is used as system clock >*/
+/* AHB prescaler: 0xxx = /1, 1000 ~ 1111 = /2 /4 /8 /16 /64 /128 /256 /512 */
+#define RCC_CFGR_HPRE_Pos               (4U)
+#define RCC_CFGR_HPRE_Msk               (0xFUL << RCC_CFGR_HPRE_Pos)
+#define RCC_CFGR_HPRE                   RCC_CFGR_HPRE_Msk
+/* APB low-speed prescaler (APB1): 0xx = /1, 100 ~ 111 = /2 /4 /8 /16 */
+#define RCC_CFGR_PPRE1_Pos              (10U)
+#define RCC_CFGR_PPRE1_Msk              (0x7UL << RCC_CFGR_PPRE1_Pos)
+#define RCC_CFGR_PPRE1                  RCC_CFGR_PPRE1_Msk
+/* APB high-speed prescaler (APB2) */
+#define RCC_CFGR_PPRE2_Pos              (13U)
+#define RCC_CFGR_PPRE2_Msk              (0x7UL << RCC_CFGR_PPRE2_Pos)
+#define RCC_CFGR_PPRE2                  RCC_CFGR_PPRE2_Msk
 
 /*------------- Bit definition of RCC_PLLCFGR register ---------------*/
 /* PLLM configuration */
@@ -315,15 +844,28 @@ typedef struct
 #define RCC_PLLCFGR_PLLM_4              (0x10UL << RCC_PLLCFGR_PLLM_Pos)
 #define RCC_PLLCFGR_PLLM_5              (0x20UL << RCC_PLLCFGR_PLLM_Pos)
 /* PLLN configuration */
-
-/* PLLP configuration */
-
+#define RCC_PLLCFGR_PLLN_Pos            (6U)
+#define RCC_PLLCFGR_PLLN_Msk            (0x1FFUL << RCC_PLLCFGR_PLLN_Pos)
+#define RCC_PLLCFGR_PLLN                RCC_PLLCFGR_PLLN_Msk
+/* PLLP configuration: 00 = /2, 01 = /4, 10 = /6, 11 = /8 */
+#define RCC_PLLCFGR_PLLP_Pos            (16U)
+#define RCC_PLLCFGR_PLLP_Msk            (0x3UL << RCC_PLLCFGR_PLLP_Pos)
+#define RCC_PLLCFGR_PLLP                RCC_PLLCFGR_PLLP_Msk
 /* PLLSRC - PLL source configuration */
 #define RCC_PLLCFGR_PLLSRC_Pos          (22U)
 #define RCC_PLLCFGR_PLLSRC_Msk          (0x1UL << RCC_PLLCFGR_PLLSRC_Pos)
 #define RCC_PLLCFGR_PLLSRC              RCC_PLLCFGR_PLLSRC_Msk
 #define RCC_PLLCFGR_PLLSRC_HSE          RCC_PLLCFGR_PLLSRC_Msk
 #define RCC_PLLCFGR_PLLSRC_HSI          0x00000000U
+/* PLLQ configuration */
+#define RCC_PLLCFGR_PLLQ_Pos            (24U)
+#define RCC_PLLCFGR_PLLQ_Msk            (0xFUL << RCC_PLLCFGR_PLLQ_Pos)
+#define RCC_PLLCFGR_PLLQ                RCC_PLLCFGR_PLLQ_Msk
+/* Bit definition of RCC_AHB1RSTR  */
+#define RCC_AHB1RSTR_ETHMACRST_Pos          (25U)
+#define RCC_AHB1RSTR_ETHMACRST_Msk          (0x1UL << RCC_AHB1RSTR_ETHMACRST_Pos)
+#define RCC_AHB1RSTR_ETHMACRST              RCC_AHB1RSTR_ETHMACRST_Msk
+
 /* Bit definition of RCC_AHB1ENR  */
 #define RCC_AHB1ENR_GPIOAEN_Pos             (0U)
 #define RCC_AHB1ENR_GPIOAEN_Msk             (0x1UL << RCC_AHB1ENR_GPIOAEN_Pos)
@@ -352,6 +894,151 @@ typedef struct
 #define RCC_AHB1ENR_GPIOIEN_Pos             (8U)
 #define RCC_AHB1ENR_GPIOIEN_Msk             (0x1UL << RCC_AHB1ENR_GPIOIEN_Pos)
 #define RCC_AHB1ENR_GPIOIEN                 RCC_AHB1ENR_GPIOIEN_Msk
+#define RCC_AHB1ENR_DMA1EN_Pos              (21U)
+#define RCC_AHB1ENR_DMA1EN_Msk              (0x1UL << RCC_AHB1ENR_DMA1EN_Pos)
+#define RCC_AHB1ENR_DMA1EN                  RCC_AHB1ENR_DMA1EN_Msk
+#define RCC_AHB1ENR_DMA2EN_Pos              (22U)
+#define RCC_AHB1ENR_DMA2EN_Msk              (0x1UL << RCC_AHB1ENR_DMA2EN_Pos)
+#define RCC_AHB1ENR_DMA2EN                  RCC_AHB1ENR_DMA2EN_Msk
+#define RCC_AHB1ENR_ETHMACEN_Pos            (25U)
+#define RCC_AHB1ENR_ETHMACEN_Msk            (0x1UL << RCC_AHB1ENR_ETHMACEN_Pos)
+#define RCC_AHB1ENR_ETHMACEN                RCC_AHB1ENR_ETHMACEN_Msk
+#define RCC_AHB1ENR_ETHMACTXEN_Pos          (26U)
+#define RCC_AHB1ENR_ETHMACTXEN_Msk          (0x1UL << RCC_AHB1ENR_ETHMACTXEN_Pos)
+#define RCC_AHB1ENR_ETHMACTXEN              RCC_AHB1ENR_ETHMACTXEN_Msk
+#define RCC_AHB1ENR_ETHMACRXEN_Pos          (27U)
+#define RCC_AHB1ENR_ETHMACRXEN_Msk          (0x1UL << RCC_AHB1ENR_ETHMACRXEN_Pos)
+#define RCC_AHB1ENR_ETHMACRXEN              RCC_AHB1ENR_ETHMACRXEN_Msk
+/* Bit definition of RCC_AHB3ENR  */
+#define RCC_AHB3ENR_FSMCEN_Pos              (0U)
+#define RCC_AHB3ENR_FSMCEN_Msk              (0x1UL << RCC_AHB3ENR_FSMCEN_Pos)
+#define RCC_AHB3ENR_FSMCEN                  RCC_AHB3ENR_FSMCEN_Msk
+/* Bit definition of RCC_APB1ENR  */
+#define RCC_APB1ENR_TIM2EN_Pos              (0U)
+#define RCC_APB1ENR_TIM2EN_Msk              (0x1UL << RCC_APB1ENR_TIM2EN_Pos)
+#define RCC_APB1ENR_TIM2EN                  RCC_APB1ENR_TIM2EN_Msk
+#define RCC_APB1ENR_TIM3EN_Pos              (1U)
+#define RCC_APB1ENR_TIM3EN_Msk              (0x1UL << RCC_APB1ENR_TIM3EN_Pos)
+#define RCC_APB1ENR_TIM3EN                  RCC_APB1ENR_TIM3EN_Msk
+#define RCC_APB1ENR_TIM4EN_Pos              (2U)
+#define RCC_APB1ENR_TIM4EN_Msk              (0x1UL << RCC_APB1ENR_TIM4EN_Pos)
+#define RCC_APB1ENR_TIM4EN                  RCC_APB1ENR_TIM4EN_Msk
+#define RCC_APB1ENR_TIM5EN_Pos              (3U)
+#define RCC_APB1ENR_TIM5EN_Msk              (0x1UL << RCC_APB1ENR_TIM5EN_Pos)
+#define RCC_APB1ENR_TIM5EN                  RCC_APB1ENR_TIM5EN_Msk
+#define RCC_APB1ENR_TIM6EN_Pos              (4U)
+#define RCC_APB1ENR_TIM6EN_Msk              (0x1UL << RCC_APB1ENR_TIM6EN_Pos)
+#define RCC_APB1ENR_TIM6EN                  RCC_APB1ENR_TIM6EN_Msk
+#define RCC_APB1ENR_TIM7EN_Pos              (5U)
+#define RCC_APB1ENR_TIM7EN_Msk              (0x1UL << RCC_APB1ENR_TIM7EN_Pos)
+#define RCC_APB1ENR_TIM7EN                  RCC_APB1ENR_TIM7EN_Msk
+#define RCC_APB1ENR_TIM12EN_Pos             (6U)
+#define RCC_APB1ENR_TIM12EN_Msk             (0x1UL << RCC_APB1ENR_TIM12EN_Pos)
+#define RCC_APB1ENR_TIM12EN                 RCC_APB1ENR_TIM12EN_Msk
+#define RCC_APB1ENR_TIM13EN_Pos             (7U)
+#define RCC_APB1ENR_TIM13EN_Msk             (0x1UL << RCC_APB1ENR_TIM13EN_Pos)
+#define RCC_APB1ENR_TIM13EN                 RCC_APB1ENR_TIM13EN_Msk
+#define RCC_APB1ENR_TIM14EN_Pos             (8U)
+#define RCC_APB1ENR_TIM14EN_Msk             (0x1UL << RCC_APB1ENR_TIM14EN_Pos)
+#define RCC_APB1ENR_TIM14EN                 RCC_APB1ENR_TIM14EN_Msk
+#define RCC_APB1ENR_CAN1EN_Pos              (25U)
+#define RCC_APB1ENR_CAN1EN_Msk              (0x1UL << RCC_APB1ENR_CAN1EN_Pos)
+#define RCC_APB1ENR_CAN1EN                  RCC_APB1ENR_CAN1EN_Msk
+#define RCC_APB1ENR_CAN2EN_Pos              (26U)
+#define RCC_APB1ENR_CAN2EN_Msk              (0x1UL << RCC_APB1ENR_CAN2EN_Pos)
+#define RCC_APB1ENR_CAN2EN                  RCC_APB1ENR_CAN2EN_Msk
+#define RCC_APB1ENR_DACEN_Pos               (29U)
+#define RCC_APB1ENR_DACEN_Msk               (0x1UL << RCC_APB1ENR_DACEN_Pos)
+#define RCC_APB1ENR_PWREN_Pos               (28U)
+#define RCC_APB1ENR_PWREN_Msk               (0x1UL << RCC_APB1ENR_PWREN_Pos)
+#define RCC_APB1ENR_PWREN                   RCC_APB1ENR_PWREN_Msk
+#define RCC_APB1ENR_DACEN                   RCC_APB1ENR_DACEN_Msk
+/* Bit definition of RCC_APB2ENR  */
+#define RCC_APB2ENR_TIM1EN_Pos              (0U)
+#define RCC_APB2ENR_TIM1EN_Msk              (0x1UL << RCC_APB2ENR_TIM1EN_Pos)
+#define RCC_APB2ENR_TIM1EN                  RCC_APB2ENR_TIM1EN_Msk
+#define RCC_APB2ENR_TIM8EN_Pos              (1U)
+#define RCC_APB2ENR_TIM8EN_Msk              (0x1UL << RCC_APB2ENR_TIM8EN_Pos)
+#define RCC_APB2ENR_TIM8EN                  RCC_APB2ENR_TIM8EN_Msk
+#define RCC_APB2ENR_ADC1EN_Pos              (8U)
+#define RCC_APB2ENR_ADC1EN_Msk              (0x1UL << RCC_APB2ENR_ADC1EN_Pos)
+#define RCC_APB2ENR_ADC1EN                  RCC_APB2ENR_ADC1EN_Msk
+#define RCC_APB2ENR_ADC2EN_Pos              (9U)
+#define RCC_APB2ENR_ADC2EN_Msk              (0x1UL << RCC_APB2ENR_ADC2EN_Pos)
+#define RCC_APB2ENR_ADC2EN                  RCC_APB2ENR_ADC2EN_Msk
+#define RCC_APB2ENR_ADC3EN_Pos              (10U)
+#define RCC_APB2ENR_ADC3EN_Msk              (0x1UL << RCC_APB2ENR_ADC3EN_Pos)
+#define RCC_APB2ENR_ADC3EN                  RCC_APB2ENR_ADC3EN_Msk
+#define RCC_APB2ENR_SDIOEN_Pos              (11U)
+#define RCC_APB2ENR_SDIOEN_Msk              (0x1UL << RCC_APB2ENR_SDIOEN_Pos)
+#define RCC_APB2ENR_SDIOEN                  RCC_APB2ENR_SDIOEN_Msk
+#define RCC_APB2ENR_SYSCFGEN_Pos            (14U)
+#define RCC_APB2ENR_SYSCFGEN_Msk            (0x1UL << RCC_APB2ENR_SYSCFGEN_Pos)
+#define RCC_APB2ENR_SYSCFGEN                RCC_APB2ENR_SYSCFGEN_Msk
+#define RCC_APB2ENR_TIM9EN_Pos              (16U)
+#define RCC_APB2ENR_TIM9EN_Msk              (0x1UL << RCC_APB2ENR_TIM9EN_Pos)
+#define RCC_APB2ENR_TIM9EN                  RCC_APB2ENR_TIM9EN_Msk
+#define RCC_APB2ENR_TIM10EN_Pos             (17U)
+#define RCC_APB2ENR_TIM10EN_Msk             (0x1UL << RCC_APB2ENR_TIM10EN_Pos)
+#define RCC_APB2ENR_TIM10EN                 RCC_APB2ENR_TIM10EN_Msk
+#define RCC_APB2ENR_TIM11EN_Pos             (18U)
+#define RCC_APB2ENR_TIM11EN_Msk             (0x1UL << RCC_APB2ENR_TIM11EN_Pos)
+#define RCC_APB2ENR_TIM11EN                 RCC_APB2ENR_TIM11EN_Msk
+
+/* Bit definition of RCC_BDCR */
+#define RCC_BDCR_LSEON_Pos                  (0U)
+#define RCC_BDCR_LSEON_Msk                  (0x1UL << RCC_BDCR_LSEON_Pos)
+#define RCC_BDCR_LSEON                      RCC_BDCR_LSEON_Msk
+#define RCC_BDCR_LSERDY_Pos                 (1U)
+#define RCC_BDCR_LSERDY_Msk                 (0x1UL << RCC_BDCR_LSERDY_Pos)
+#define RCC_BDCR_LSERDY                     RCC_BDCR_LSERDY_Msk
+#define RCC_BDCR_LSEBYP_Pos                 (2U)
+#define RCC_BDCR_LSEBYP_Msk                 (0x1UL << RCC_BDCR_LSEBYP_Pos)
+#define RCC_BDCR_LSEBYP                     RCC_BDCR_LSEBYP_Msk
+#define RCC_BDCR_RTCSEL_Pos                 (8U)
+#define RCC_BDCR_RTCSEL_Msk                 (0x3UL << RCC_BDCR_RTCSEL_Pos)
+#define RCC_BDCR_RTCSEL                     RCC_BDCR_RTCSEL_Msk
+#define RCC_BDCR_RTCEN_Pos                  (15U)
+#define RCC_BDCR_RTCEN_Msk                  (0x1UL << RCC_BDCR_RTCEN_Pos)
+#define RCC_BDCR_RTCEN                      RCC_BDCR_RTCEN_Msk
+#define RCC_BDCR_BDRST_Pos                  (16U)
+#define RCC_BDCR_BDRST_Msk                  (0x1UL << RCC_BDCR_BDRST_Pos)
+#define RCC_BDCR_BDRST                      RCC_BDCR_BDRST_Msk
+
+#define RCC_BDCR_RTCSEL_LSE                 (0x1UL << RCC_BDCR_RTCSEL_Pos)
+#define RCC_BDCR_RTCSEL_LSI                 (0x2UL << RCC_BDCR_RTCSEL_Pos)
+
+/* Bit definition of RCC_CSR */
+#define RCC_CSR_LSION_Pos                   (0U)
+#define RCC_CSR_LSION_Msk                   (0x1UL << RCC_CSR_LSION_Pos)
+#define RCC_CSR_LSION                       RCC_CSR_LSION_Msk
+#define RCC_CSR_LSIRDY_Pos                  (1U)
+#define RCC_CSR_LSIRDY_Msk                  (0x1UL << RCC_CSR_LSIRDY_Pos)
+#define RCC_CSR_LSIRDY                      RCC_CSR_LSIRDY_Msk
+#define RCC_CSR_RMVF_Pos                    (24U)
+#define RCC_CSR_RMVF_Msk                    (0x1UL << RCC_CSR_RMVF_Pos)
+#define RCC_CSR_RMVF                        RCC_CSR_RMVF_Msk
+#define RCC_CSR_BORRSTF_Pos                 (25U)
+#define RCC_CSR_BORRSTF_Msk                 (0x1UL << RCC_CSR_BORRSTF_Pos)
+#define RCC_CSR_BORRSTF                     RCC_CSR_BORRSTF_Msk
+#define RCC_CSR_PINRSTF_Pos                 (26U)
+#define RCC_CSR_PINRSTF_Msk                 (0x1UL << RCC_CSR_PINRSTF_Pos)
+#define RCC_CSR_PINRSTF                     RCC_CSR_PINRSTF_Msk
+#define RCC_CSR_PORRSTF_Pos                 (27U)
+#define RCC_CSR_PORRSTF_Msk                 (0x1UL << RCC_CSR_PORRSTF_Pos)
+#define RCC_CSR_PORRSTF                     RCC_CSR_PORRSTF_Msk
+#define RCC_CSR_SFTRSTF_Pos                 (28U)
+#define RCC_CSR_SFTRSTF_Msk                 (0x1UL << RCC_CSR_SFTRSTF_Pos)
+#define RCC_CSR_SFTRSTF                     RCC_CSR_SFTRSTF_Msk
+#define RCC_CSR_IWDGRSTF_Pos                (29U)
+#define RCC_CSR_IWDGRSTF_Msk                (0x1UL << RCC_CSR_IWDGRSTF_Pos)
+#define RCC_CSR_IWDGRSTF                    RCC_CSR_IWDGRSTF_Msk
+#define RCC_CSR_WWDGRSTF_Pos                (30U)
+#define RCC_CSR_WWDGRSTF_Msk                (0x1UL << RCC_CSR_WWDGRSTF_Pos)
+#define RCC_CSR_WWDGRSTF                    RCC_CSR_WWDGRSTF_Msk
+#define RCC_CSR_LPWRRSTF_Pos                (31U)
+#define RCC_CSR_LPWRRSTF_Msk                (0x1UL << RCC_CSR_LPWRRSTF_Pos)
+#define RCC_CSR_LPWRRSTF                    RCC_CSR_LPWRRSTF_Msk
 
 /*****************************************************************/
 /*                      GPIO peripheral						     */
@@ -653,6 +1340,2019 @@ typedef struct
 #define GPIO_ODR_ODR15                	GPIO_ODR_ODR15_Msk
 
 
+/*****************************************************************/
+/*                      DMA controller						     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* DMA stream x configuration register (DMA_SxCR) */
+#define DMA_SxCR_EN_Pos                     (0U)
+#define DMA_SxCR_EN_Msk                     (0x1UL << DMA_SxCR_EN_Pos)
+#define DMA_SxCR_EN                         DMA_SxCR_EN_Msk
+#define DMA_SxCR_DMEIE_Pos                  (1U)
+#define DMA_SxCR_DMEIE_Msk                  (0x1UL << DMA_SxCR_DMEIE_Pos)
+#define DMA_SxCR_DMEIE                      DMA_SxCR_DMEIE_Msk
+#define DMA_SxCR_TEIE_Pos                   (2U)
+#define DMA_SxCR_TEIE_Msk                   (0x1UL << DMA_SxCR_TEIE_Pos)
+#define DMA_SxCR_TEIE                       DMA_SxCR_TEIE_Msk
+#define DMA_SxCR_HTIE_Pos                   (3U)
+#define DMA_SxCR_HTIE_Msk                   (0x1UL << DMA_SxCR_HTIE_Pos)
+#define DMA_SxCR_HTIE                       DMA_SxCR_HTIE_Msk
+#define DMA_SxCR_TCIE_Pos                   (4U)
+#define DMA_SxCR_TCIE_Msk                   (0x1UL << DMA_SxCR_TCIE_Pos)
+#define DMA_SxCR_TCIE                       DMA_SxCR_TCIE_Msk
+#define DMA_SxCR_PFCTRL_Pos                 (5U)
+#define DMA_SxCR_PFCTRL_Msk                 (0x1UL << DMA_SxCR_PFCTRL_Pos)
+#define DMA_SxCR_PFCTRL                     DMA_SxCR_PFCTRL_Msk
+#define DMA_SxCR_DIR_Pos                    (6U)
+#define DMA_SxCR_DIR_Msk                    (0x3UL << DMA_SxCR_DIR_Pos)
+#define DMA_SxCR_DIR                        DMA_SxCR_DIR_Msk
+#define DMA_SxCR_CIRC_Pos                   (8U)
+#define DMA_SxCR_CIRC_Msk                   (0x1UL << DMA_SxCR_CIRC_Pos)
+#define DMA_SxCR_CIRC                       DMA_SxCR_CIRC_Msk
+#define DMA_SxCR_PINC_Pos                   (9U)
+#define DMA_SxCR_PINC_Msk                   (0x1UL << DMA_SxCR_PINC_Pos)
+#define DMA_SxCR_PINC                       DMA_SxCR_PINC_Msk
+#define DMA_SxCR_MINC_Pos                   (10U)
+#define DMA_SxCR_MINC_Msk                   (0x1UL << DMA_SxCR_MINC_Pos)
+#define DMA_SxCR_MINC                       DMA_SxCR_MINC_Msk
+#define DMA_SxCR_PSIZE_Pos                  (11U)
+#define DMA_SxCR_PSIZE_Msk                  (0x3UL << DMA_SxCR_PSIZE_Pos)
+#define DMA_SxCR_PSIZE                      DMA_SxCR_PSIZE_Msk
+#define DMA_SxCR_MSIZE_Pos                  (13U)
+#define DMA_SxCR_MSIZE_Msk                  (0x3UL << DMA_SxCR_MSIZE_Pos)
+#define DMA_SxCR_MSIZE                      DMA_SxCR_MSIZE_Msk
+#define DMA_SxCR_PINCOS_Pos                 (15U)
+#define DMA_SxCR_PINCOS_Msk                 (0x1UL << DMA_SxCR_PINCOS_Pos)
+#define DMA_SxCR_PINCOS                     DMA_SxCR_PINCOS_Msk
+#define DMA_SxCR_PL_Pos                     (16U)
+#define DMA_SxCR_PL_Msk                     (0x3UL << DMA_SxCR_PL_Pos)
+#define DMA_SxCR_PL                         DMA_SxCR_PL_Msk
+#define DMA_SxCR_DBM_Pos                    (18U)
+#define DMA_SxCR_DBM_Msk                    (0x1UL << DMA_SxCR_DBM_Pos)
+#define DMA_SxCR_DBM                        DMA_SxCR_DBM_Msk
+#define DMA_SxCR_CT_Pos                     (19U)
+#define DMA_SxCR_CT_Msk                     (0x1UL << DMA_SxCR_CT_Pos)
+#define DMA_SxCR_CT                         DMA_SxCR_CT_Msk
+#define DMA_SxCR_PBURST_Pos                 (21U)
+#define DMA_SxCR_PBURST_Msk                 (0x3UL << DMA_SxCR_PBURST_Pos)
+#define DMA_SxCR_PBURST                     DMA_SxCR_PBURST_Msk
+#define DMA_SxCR_MBURST_Pos                 (23U)
+#define DMA_SxCR_MBURST_Msk                 (0x3UL << DMA_SxCR_MBURST_Pos)
+#define DMA_SxCR_MBURST                     DMA_SxCR_MBURST_Msk
+#define DMA_SxCR_CHSEL_Pos                  (25U)
+#define DMA_SxCR_CHSEL_Msk                  (0x7UL << DMA_SxCR_CHSEL_Pos)
+#define DMA_SxCR_CHSEL                      DMA_SxCR_CHSEL_Msk
+/* DMA stream x FIFO control register (DMA_SxFCR) */
+#define DMA_SxFCR_FTH_Pos                   (0U)
+#define DMA_SxFCR_FTH_Msk                   (0x3UL << DMA_SxFCR_FTH_Pos)
+#define DMA_SxFCR_FTH                       DMA_SxFCR_FTH_Msk
+#define DMA_SxFCR_DMDIS_Pos                 (2U)
+#define DMA_SxFCR_DMDIS_Msk                 (0x1UL << DMA_SxFCR_DMDIS_Pos)
+#define DMA_SxFCR_DMDIS                     DMA_SxFCR_DMDIS_Msk
+#define DMA_SxFCR_FS_Pos                    (3U)
+#define DMA_SxFCR_FS_Msk                    (0x7UL << DMA_SxFCR_FS_Pos)
+#define DMA_SxFCR_FS                        DMA_SxFCR_FS_Msk
+#define DMA_SxFCR_FEIE_Pos                  (7U)
+#define DMA_SxFCR_FEIE_Msk                  (0x1UL << DMA_SxFCR_FEIE_Pos)
+#define DMA_SxFCR_FEIE                      DMA_SxFCR_FEIE_Msk
+/* DMA interrupt flags, relative to the stream's flag group (see DMA_FLAG_SHIFT in hal_dma) */
+#define DMA_FLAG_FEIF                   (0x01UL)    /*< FIFO error >*/
+#define DMA_FLAG_DMEIF                  (0x04UL)    /*< Direct mode error >*/
+#define DMA_FLAG_TEIF                   (0x08UL)    /*< Transfer error >*/
+#define DMA_FLAG_HTIF                   (0x10UL)    /*< Half transfer >*/
+#define DMA_FLAG_TCIF                   (0x20UL)    /*< Transfer complete >*/
+#define DMA_FLAG_ALL                    (0x3DUL)
+
+/*****************************************************************/
+/*                      TIM peripheral						     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* TIM control register 1 (TIMx_CR1) */
+#define TIM_CR1_CEN_Pos                     (0U)
+#define TIM_CR1_CEN_Msk                     (0x1UL << TIM_CR1_CEN_Pos)
+#define TIM_CR1_CEN                         TIM_CR1_CEN_Msk
+#define TIM_CR1_UDIS_Pos                    (1U)
+#define TIM_CR1_UDIS_Msk                    (0x1UL << TIM_CR1_UDIS_Pos)
+#define TIM_CR1_UDIS                        TIM_CR1_UDIS_Msk
+#define TIM_CR1_URS_Pos                     (2U)
+#define TIM_CR1_URS_Msk                     (0x1UL << TIM_CR1_URS_Pos)
+#define TIM_CR1_URS                         TIM_CR1_URS_Msk
+#define TIM_CR1_OPM_Pos                     (3U)
+#define TIM_CR1_OPM_Msk                     (0x1UL << TIM_CR1_OPM_Pos)
+#define TIM_CR1_OPM                         TIM_CR1_OPM_Msk
+#define TIM_CR1_DIR_Pos                     (4U)
+#define TIM_CR1_DIR_Msk                     (0x1UL << TIM_CR1_DIR_Pos)
+#define TIM_CR1_DIR                         TIM_CR1_DIR_Msk
+#define TIM_CR1_CMS_Pos                     (5U)
+#define TIM_CR1_CMS_Msk                     (0x3UL << TIM_CR1_CMS_Pos)
+#define TIM_CR1_CMS                         TIM_CR1_CMS_Msk
+#define TIM_CR1_ARPE_Pos                    (7U)
+#define TIM_CR1_ARPE_Msk                    (0x1UL << TIM_CR1_ARPE_Pos)
+#define TIM_CR1_ARPE                        TIM_CR1_ARPE_Msk
+#define TIM_CR1_CKD_Pos                     (8U)
+#define TIM_CR1_CKD_Msk                     (0x3UL << TIM_CR1_CKD_Pos)
+#define TIM_CR1_CKD                         TIM_CR1_CKD_Msk
+/* TIM control register 2 (TIMx_CR2) */
+#define TIM_CR2_CCPC_Pos                    (0U)
+#define TIM_CR2_CCPC_Msk                    (0x1UL << TIM_CR2_CCPC_Pos)
+#define TIM_CR2_CCPC                        TIM_CR2_CCPC_Msk
+#define TIM_CR2_CCUS_Pos                    (2U)
+#define TIM_CR2_CCUS_Msk                    (0x1UL << TIM_CR2_CCUS_Pos)
+#define TIM_CR2_CCUS                        TIM_CR2_CCUS_Msk
+#define TIM_CR2_CCDS_Pos                    (3U)
+#define TIM_CR2_CCDS_Msk                    (0x1UL << TIM_CR2_CCDS_Pos)
+#define TIM_CR2_CCDS                        TIM_CR2_CCDS_Msk
+#define TIM_CR2_MMS_Pos                     (4U)
+#define TIM_CR2_MMS_Msk                     (0x7UL << TIM_CR2_MMS_Pos)
+#define TIM_CR2_MMS                         TIM_CR2_MMS_Msk
+#define TIM_CR2_TI1S_Pos                    (7U)
+#define TIM_CR2_TI1S_Msk                    (0x1UL << TIM_CR2_TI1S_Pos)
+#define TIM_CR2_TI1S                        TIM_CR2_TI1S_Msk
+#define TIM_CR2_OIS1_Pos                    (8U)
+#define TIM_CR2_OIS1_Msk                    (0x1UL << TIM_CR2_OIS1_Pos)
+#define TIM_CR2_OIS1                        TIM_CR2_OIS1_Msk
+#define TIM_CR2_OIS1N_Pos                   (9U)
+#define TIM_CR2_OIS1N_Msk                   (0x1UL << TIM_CR2_OIS1N_Pos)
+#define TIM_CR2_OIS1N                       TIM_CR2_OIS1N_Msk
+#define TIM_CR2_OIS2_Pos                    (10U)
+#define TIM_CR2_OIS2_Msk                    (0x1UL << TIM_CR2_OIS2_Pos)
+#define TIM_CR2_OIS2                        TIM_CR2_OIS2_Msk
+#define TIM_CR2_OIS2N_Pos                   (11U)
+#define TIM_CR2_OIS2N_Msk                   (0x1UL << TIM_CR2_OIS2N_Pos)
+#define TIM_CR2_OIS2N                       TIM_CR2_OIS2N_Msk
+#define TIM_CR2_OIS3_Pos                    (12U)
+#define TIM_CR2_OIS3_Msk                    (0x1UL << TIM_CR2_OIS3_Pos)
+#define TIM_CR2_OIS3                        TIM_CR2_OIS3_Msk
+#define TIM_CR2_OIS3N_Pos                   (13U)
+#define TIM_CR2_OIS3N_Msk                   (0x1UL << TIM_CR2_OIS3N_Pos)
+#define TIM_CR2_OIS3N                       TIM_CR2_OIS3N_Msk
+#define TIM_CR2_OIS4_Pos                    (14U)
+#define TIM_CR2_OIS4_Msk                    (0x1UL << TIM_CR2_OIS4_Pos)
+#define TIM_CR2_OIS4                        TIM_CR2_OIS4_Msk
+/* TIM slave mode control register (TIMx_SMCR) */
+#define TIM_SMCR_SMS_Pos                    (0U)
+#define TIM_SMCR_SMS_Msk                    (0x7UL << TIM_SMCR_SMS_Pos)
+#define TIM_SMCR_SMS                        TIM_SMCR_SMS_Msk
+#define TIM_SMCR_TS_Pos                     (4U)
+#define TIM_SMCR_TS_Msk                     (0x7UL << TIM_SMCR_TS_Pos)
+#define TIM_SMCR_TS                         TIM_SMCR_TS_Msk
+#define TIM_SMCR_MSM_Pos                    (7U)
+#define TIM_SMCR_MSM_Msk                    (0x1UL << TIM_SMCR_MSM_Pos)
+#define TIM_SMCR_MSM                        TIM_SMCR_MSM_Msk
+#define TIM_SMCR_ETF_Pos                    (8U)
+#define TIM_SMCR_ETF_Msk                    (0xFUL << TIM_SMCR_ETF_Pos)
+#define TIM_SMCR_ETF                        TIM_SMCR_ETF_Msk
+#define TIM_SMCR_ETPS_Pos                   (12U)
+#define TIM_SMCR_ETPS_Msk                   (0x3UL << TIM_SMCR_ETPS_Pos)
+#define TIM_SMCR_ETPS                       TIM_SMCR_ETPS_Msk
+#define TIM_SMCR_ECE_Pos                    (14U)
+#define TIM_SMCR_ECE_Msk                    (0x1UL << TIM_SMCR_ECE_Pos)
+#define TIM_SMCR_ECE                        TIM_SMCR_ECE_Msk
+#define TIM_SMCR_ETP_Pos                    (15U)
+#define TIM_SMCR_ETP_Msk                    (0x1UL << TIM_SMCR_ETP_Pos)
+#define TIM_SMCR_ETP                        TIM_SMCR_ETP_Msk
+/* TIM DMA/interrupt enable register (TIMx_DIER) */
+#define TIM_DIER_UIE_Pos                    (0U)
+#define TIM_DIER_UIE_Msk                    (0x1UL << TIM_DIER_UIE_Pos)
+#define TIM_DIER_UIE                        TIM_DIER_UIE_Msk
+#define TIM_DIER_CC1IE_Pos                  (1U)
+#define TIM_DIER_CC1IE_Msk                  (0x1UL << TIM_DIER_CC1IE_Pos)
+#define TIM_DIER_CC1IE                      TIM_DIER_CC1IE_Msk
+#define TIM_DIER_CC2IE_Pos                  (2U)
+#define TIM_DIER_CC2IE_Msk                  (0x1UL << TIM_DIER_CC2IE_Pos)
+#define TIM_DIER_CC2IE                      TIM_DIER_CC2IE_Msk
+#define TIM_DIER_CC3IE_Pos                  (3U)
+#define TIM_DIER_CC3IE_Msk                  (0x1UL << TIM_DIER_CC3IE_Pos)
+#define TIM_DIER_CC3IE                      TIM_DIER_CC3IE_Msk
+#define TIM_DIER_CC4IE_Pos                  (4U)
+#define TIM_DIER_CC4IE_Msk                  (0x1UL << TIM_DIER_CC4IE_Pos)
+#define TIM_DIER_CC4IE                      TIM_DIER_CC4IE_Msk
+#define TIM_DIER_COMIE_Pos                  (5U)
+#define TIM_DIER_COMIE_Msk                  (0x1UL << TIM_DIER_COMIE_Pos)
+#define TIM_DIER_COMIE                      TIM_DIER_COMIE_Msk
+#define TIM_DIER_TIE_Pos                    (6U)
+#define TIM_DIER_TIE_Msk                    (0x1UL << TIM_DIER_TIE_Pos)
+#define TIM_DIER_TIE                        TIM_DIER_TIE_Msk
+#define TIM_DIER_BIE_Pos                    (7U)
+#define TIM_DIER_BIE_Msk                    (0x1UL << TIM_DIER_BIE_Pos)
+#define TIM_DIER_BIE                        TIM_DIER_BIE_Msk
+#define TIM_DIER_UDE_Pos                    (8U)
+#define TIM_DIER_UDE_Msk                    (0x1UL << TIM_DIER_UDE_Pos)
+#define TIM_DIER_UDE                        TIM_DIER_UDE_Msk
+#define TIM_DIER_CC1DE_Pos                  (9U)
+#define TIM_DIER_CC1DE_Msk                  (0x1UL << TIM_DIER_CC1DE_Pos)
+#define TIM_DIER_CC1DE                      TIM_DIER_CC1DE_Msk
+#define TIM_DIER_CC2DE_Pos                  (10U)
+#define TIM_DIER_CC2DE_Msk                  (0x1UL << TIM_DIER_CC2DE_Pos)
+#define TIM_DIER_CC2DE                      TIM_DIER_CC2DE_Msk
+#define TIM_DIER_CC3DE_Pos                  (11U)
+#define TIM_DIER_CC3DE_Msk                  (0x1UL << TIM_DIER_CC3DE_Pos)
+#define TIM_DIER_CC3DE                      TIM_DIER_CC3DE_Msk
+#define TIM_DIER_CC4DE_Pos                  (12U)
+#define TIM_DIER_CC4DE_Msk                  (0x1UL << TIM_DIER_CC4DE_Pos)
+#define TIM_DIER_CC4DE                      TIM_DIER_CC4DE_Msk
+#define TIM_DIER_COMDE_Pos                  (13U)
+#define TIM_DIER_COMDE_Msk                  (0x1UL << TIM_DIER_COMDE_Pos)
+#define TIM_DIER_COMDE                      TIM_DIER_COMDE_Msk
+#define TIM_DIER_TDE_Pos                    (14U)
+#define TIM_DIER_TDE_Msk                    (0x1UL << TIM_DIER_TDE_Pos)
+#define TIM_DIER_TDE                        TIM_DIER_TDE_Msk
+/* TIM status register (TIMx_SR) */
+#define TIM_SR_UIF_Pos                      (0U)
+#define TIM_SR_UIF_Msk                      (0x1UL << TIM_SR_UIF_Pos)
+#define TIM_SR_UIF                          TIM_SR_UIF_Msk
+#define TIM_SR_CC1IF_Pos                    (1U)
+#define TIM_SR_CC1IF_Msk                    (0x1UL << TIM_SR_CC1IF_Pos)
+#define TIM_SR_CC1IF                        TIM_SR_CC1IF_Msk
+#define TIM_SR_CC2IF_Pos                    (2U)
+#define TIM_SR_CC2IF_Msk                    (0x1UL << TIM_SR_CC2IF_Pos)
+#define TIM_SR_CC2IF                        TIM_SR_CC2IF_Msk
+#define TIM_SR_CC3IF_Pos                    (3U)
+#define TIM_SR_CC3IF_Msk                    (0x1UL << TIM_SR_CC3IF_Pos)
+#define TIM_SR_CC3IF                        TIM_SR_CC3IF_Msk
+#define TIM_SR_CC4IF_Pos                    (4U)
+#define TIM_SR_CC4IF_Msk                    (0x1UL << TIM_SR_CC4IF_Pos)
+#define TIM_SR_CC4IF                        TIM_SR_CC4IF_Msk
+#define TIM_SR_COMIF_Pos                    (5U)
+#define TIM_SR_COMIF_Msk                    (0x1UL << TIM_SR_COMIF_Pos)
+#define TIM_SR_COMIF                        TIM_SR_COMIF_Msk
+#define TIM_SR_TIF_Pos                      (6U)
+#define TIM_SR_TIF_Msk                      (0x1UL << TIM_SR_TIF_Pos)
+#define TIM_SR_TIF                          TIM_SR_TIF_Msk
+#define TIM_SR_BIF_Pos                      (7U)
+#define TIM_SR_BIF_Msk                      (0x1UL << TIM_SR_BIF_Pos)
+#define TIM_SR_BIF                          TIM_SR_BIF_Msk
+#define TIM_SR_CC1OF_Pos                    (9U)
+#define TIM_SR_CC1OF_Msk                    (0x1UL << TIM_SR_CC1OF_Pos)
+#define TIM_SR_CC1OF                        TIM_SR_CC1OF_Msk
+#define TIM_SR_CC2OF_Pos                    (10U)
+#define TIM_SR_CC2OF_Msk                    (0x1UL << TIM_SR_CC2OF_Pos)
+#define TIM_SR_CC2OF                        TIM_SR_CC2OF_Msk
+#define TIM_SR_CC3OF_Pos                    (11U)
+#define TIM_SR_CC3OF_Msk                    (0x1UL << TIM_SR_CC3OF_Pos)
+#define TIM_SR_CC3OF                        TIM_SR_CC3OF_Msk
+#define TIM_SR_CC4OF_Pos                    (12U)
+#define TIM_SR_CC4OF_Msk                    (0x1UL << TIM_SR_CC4OF_Pos)
+#define TIM_SR_CC4OF                        TIM_SR_CC4OF_Msk
+/* TIM event generation register (TIMx_EGR) */
+#define TIM_EGR_UG_Pos                      (0U)
+#define TIM_EGR_UG_Msk                      (0x1UL << TIM_EGR_UG_Pos)
+#define TIM_EGR_UG                          TIM_EGR_UG_Msk
+#define TIM_EGR_CC1G_Pos                    (1U)
+#define TIM_EGR_CC1G_Msk                    (0x1UL << TIM_EGR_CC1G_Pos)
+#define TIM_EGR_CC1G                        TIM_EGR_CC1G_Msk
+#define TIM_EGR_CC2G_Pos                    (2U)
+#define TIM_EGR_CC2G_Msk                    (0x1UL << TIM_EGR_CC2G_Pos)
+#define TIM_EGR_CC2G                        TIM_EGR_CC2G_Msk
+#define TIM_EGR_CC3G_Pos                    (3U)
+#define TIM_EGR_CC3G_Msk                    (0x1UL << TIM_EGR_CC3G_Pos)
+#define TIM_EGR_CC3G                        TIM_EGR_CC3G_Msk
+#define TIM_EGR_CC4G_Pos                    (4U)
+#define TIM_EGR_CC4G_Msk                    (0x1UL << TIM_EGR_CC4G_Pos)
+#define TIM_EGR_CC4G                        TIM_EGR_CC4G_Msk
+#define TIM_EGR_COMG_Pos                    (5U)
+#define TIM_EGR_COMG_Msk                    (0x1UL << TIM_EGR_COMG_Pos)
+#define TIM_EGR_COMG                        TIM_EGR_COMG_Msk
+#define TIM_EGR_TG_Pos                      (6U)
+#define TIM_EGR_TG_Msk                      (0x1UL << TIM_EGR_TG_Pos)
+#define TIM_EGR_TG                          TIM_EGR_TG_Msk
+#define TIM_EGR_BG_Pos                      (7U)
+#define TIM_EGR_BG_Msk                      (0x1UL << TIM_EGR_BG_Pos)
+#define TIM_EGR_BG                          TIM_EGR_BG_Msk
+/* TIM capture/compare mode register 1 (TIMx_CCMR1), output & input compare share the register */
+#define TIM_CCMR1_CC1S_Pos                  (0U)
+#define TIM_CCMR1_CC1S_Msk                  (0x3UL << TIM_CCMR1_CC1S_Pos)
+#define TIM_CCMR1_CC1S                      TIM_CCMR1_CC1S_Msk
+#define TIM_CCMR1_OC1FE_Pos                 (2U)
+#define TIM_CCMR1_OC1FE_Msk                 (0x1UL << TIM_CCMR1_OC1FE_Pos)
+#define TIM_CCMR1_OC1FE                     TIM_CCMR1_OC1FE_Msk
+#define TIM_CCMR1_OC1PE_Pos                 (3U)
+#define TIM_CCMR1_OC1PE_Msk                 (0x1UL << TIM_CCMR1_OC1PE_Pos)
+#define TIM_CCMR1_OC1PE                     TIM_CCMR1_OC1PE_Msk
+#define TIM_CCMR1_OC1M_Pos                  (4U)
+#define TIM_CCMR1_OC1M_Msk                  (0x7UL << TIM_CCMR1_OC1M_Pos)
+#define TIM_CCMR1_OC1M                      TIM_CCMR1_OC1M_Msk
+#define TIM_CCMR1_OC1CE_Pos                 (7U)
+#define TIM_CCMR1_OC1CE_Msk                 (0x1UL << TIM_CCMR1_OC1CE_Pos)
+#define TIM_CCMR1_OC1CE                     TIM_CCMR1_OC1CE_Msk
+#define TIM_CCMR1_CC2S_Pos                  (8U)
+#define TIM_CCMR1_CC2S_Msk                  (0x3UL << TIM_CCMR1_CC2S_Pos)
+#define TIM_CCMR1_CC2S                      TIM_CCMR1_CC2S_Msk
+#define TIM_CCMR1_OC2FE_Pos                 (10U)
+#define TIM_CCMR1_OC2FE_Msk                 (0x1UL << TIM_CCMR1_OC2FE_Pos)
+#define TIM_CCMR1_OC2FE                     TIM_CCMR1_OC2FE_Msk
+#define TIM_CCMR1_OC2PE_Pos                 (11U)
+#define TIM_CCMR1_OC2PE_Msk                 (0x1UL << TIM_CCMR1_OC2PE_Pos)
+#define TIM_CCMR1_OC2PE                     TIM_CCMR1_OC2PE_Msk
+#define TIM_CCMR1_OC2M_Pos                  (12U)
+#define TIM_CCMR1_OC2M_Msk                  (0x7UL << TIM_CCMR1_OC2M_Pos)
+#define TIM_CCMR1_OC2M                      TIM_CCMR1_OC2M_Msk
+#define TIM_CCMR1_OC2CE_Pos                 (15U)
+#define TIM_CCMR1_OC2CE_Msk                 (0x1UL << TIM_CCMR1_OC2CE_Pos)
+#define TIM_CCMR1_OC2CE                     TIM_CCMR1_OC2CE_Msk
+#define TIM_CCMR1_IC1PSC_Pos                (2U)
+#define TIM_CCMR1_IC1PSC_Msk                (0x3UL << TIM_CCMR1_IC1PSC_Pos)
+#define TIM_CCMR1_IC1PSC                    TIM_CCMR1_IC1PSC_Msk
+#define TIM_CCMR1_IC1F_Pos                  (4U)
+#define TIM_CCMR1_IC1F_Msk                  (0xFUL << TIM_CCMR1_IC1F_Pos)
+#define TIM_CCMR1_IC1F                      TIM_CCMR1_IC1F_Msk
+#define TIM_CCMR1_IC2PSC_Pos                (10U)
+#define TIM_CCMR1_IC2PSC_Msk                (0x3UL << TIM_CCMR1_IC2PSC_Pos)
+#define TIM_CCMR1_IC2PSC                    TIM_CCMR1_IC2PSC_Msk
+#define TIM_CCMR1_IC2F_Pos                  (12U)
+#define TIM_CCMR1_IC2F_Msk                  (0xFUL << TIM_CCMR1_IC2F_Pos)
+#define TIM_CCMR1_IC2F                      TIM_CCMR1_IC2F_Msk
+/* TIM capture/compare mode register 2 (TIMx_CCMR2) */
+#define TIM_CCMR2_CC3S_Pos                  (0U)
+#define TIM_CCMR2_CC3S_Msk                  (0x3UL << TIM_CCMR2_CC3S_Pos)
+#define TIM_CCMR2_CC3S                      TIM_CCMR2_CC3S_Msk
+#define TIM_CCMR2_OC3FE_Pos                 (2U)
+#define TIM_CCMR2_OC3FE_Msk                 (0x1UL << TIM_CCMR2_OC3FE_Pos)
+#define TIM_CCMR2_OC3FE                     TIM_CCMR2_OC3FE_Msk
+#define TIM_CCMR2_OC3PE_Pos                 (3U)
+#define TIM_CCMR2_OC3PE_Msk                 (0x1UL << TIM_CCMR2_OC3PE_Pos)
+#define TIM_CCMR2_OC3PE                     TIM_CCMR2_OC3PE_Msk
+#define TIM_CCMR2_OC3M_Pos                  (4U)
+#define TIM_CCMR2_OC3M_Msk                  (0x7UL << TIM_CCMR2_OC3M_Pos)
+#define TIM_CCMR2_OC3M                      TIM_CCMR2_OC3M_Msk
+#define TIM_CCMR2_OC3CE_Pos                 (7U)
+#define TIM_CCMR2_OC3CE_Msk                 (0x1UL << TIM_CCMR2_OC3CE_Pos)
+#define TIM_CCMR2_OC3CE                     TIM_CCMR2_OC3CE_Msk
+#define TIM_CCMR2_CC4S_Pos                  (8U)
+#define TIM_CCMR2_CC4S_Msk                  (0x3UL << TIM_CCMR2_CC4S_Pos)
+#define TIM_CCMR2_CC4S                      TIM_CCMR2_CC4S_Msk
+#define TIM_CCMR2_OC4FE_Pos                 (10U)
+#define TIM_CCMR2_OC4FE_Msk                 (0x1UL << TIM_CCMR2_OC4FE_Pos)
+#define TIM_CCMR2_OC4FE                     TIM_CCMR2_OC4FE_Msk
+#define TIM_CCMR2_OC4PE_Pos                 (11U)
+#define TIM_CCMR2_OC4PE_Msk                 (0x1UL << TIM_CCMR2_OC4PE_Pos)
+#define TIM_CCMR2_OC4PE                     TIM_CCMR2_OC4PE_Msk
+#define TIM_CCMR2_OC4M_Pos                  (12U)
+#define TIM_CCMR2_OC4M_Msk                  (0x7UL << TIM_CCMR2_OC4M_Pos)
+#define TIM_CCMR2_OC4M                      TIM_CCMR2_OC4M_Msk
+#define TIM_CCMR2_OC4CE_Pos                 (15U)
+#define TIM_CCMR2_OC4CE_Msk                 (0x1UL << TIM_CCMR2_OC4CE_Pos)
+#define TIM_CCMR2_OC4CE                     TIM_CCMR2_OC4CE_Msk
+#define TIM_CCMR2_IC3PSC_Pos                (2U)
+#define TIM_CCMR2_IC3PSC_Msk                (0x3UL << TIM_CCMR2_IC3PSC_Pos)
+#define TIM_CCMR2_IC3PSC                    TIM_CCMR2_IC3PSC_Msk
+#define TIM_CCMR2_IC3F_Pos                  (4U)
+#define TIM_CCMR2_IC3F_Msk                  (0xFUL << TIM_CCMR2_IC3F_Pos)
+#define TIM_CCMR2_IC3F                      TIM_CCMR2_IC3F_Msk
+#define TIM_CCMR2_IC4PSC_Pos                (10U)
+#define TIM_CCMR2_IC4PSC_Msk                (0x3UL << TIM_CCMR2_IC4PSC_Pos)
+#define TIM_CCMR2_IC4PSC                    TIM_CCMR2_IC4PSC_Msk
+#define TIM_CCMR2_IC4F_Pos                  (12U)
+#define TIM_CCMR2_IC4F_Msk                  (0xFUL << TIM_CCMR2_IC4F_Pos)
+#define TIM_CCMR2_IC4F                      TIM_CCMR2_IC4F_Msk
+/* TIM capture/compare enable register (TIMx_CCER), 4 bits per channel */
+#define TIM_CCER_CC1E_Pos                   (0U)
+#define TIM_CCER_CC1E_Msk                   (0x1UL << TIM_CCER_CC1E_Pos)
+#define TIM_CCER_CC1E                       TIM_CCER_CC1E_Msk
+#define TIM_CCER_CC1P_Pos                   (1U)
+#define TIM_CCER_CC1P_Msk                   (0x1UL << TIM_CCER_CC1P_Pos)
+#define TIM_CCER_CC1P                       TIM_CCER_CC1P_Msk
+#define TIM_CCER_CC1NE_Pos                  (2U)
+#define TIM_CCER_CC1NE_Msk                  (0x1UL << TIM_CCER_CC1NE_Pos)
+#define TIM_CCER_CC1NE                      TIM_CCER_CC1NE_Msk
+#define TIM_CCER_CC1NP_Pos                  (3U)
+#define TIM_CCER_CC1NP_Msk                  (0x1UL << TIM_CCER_CC1NP_Pos)
+#define TIM_CCER_CC1NP                      TIM_CCER_CC1NP_Msk
+#define TIM_CCER_CC2E_Pos                   (4U)
+#define TIM_CCER_CC2E_Msk                   (0x1UL << TIM_CCER_CC2E_Pos)
+#define TIM_CCER_CC2E                       TIM_CCER_CC2E_Msk
+#define TIM_CCER_CC2P_Pos                   (5U)
+#define TIM_CCER_CC2P_Msk                   (0x1UL << TIM_CCER_CC2P_Pos)
+#define TIM_CCER_CC2P                       TIM_CCER_CC2P_Msk
+#define TIM_CCER_CC2NE_Pos                  (6U)
+#define TIM_CCER_CC2NE_Msk                  (0x1UL << TIM_CCER_CC2NE_Pos)
+#define TIM_CCER_CC2NE                      TIM_CCER_CC2NE_Msk
+#define TIM_CCER_CC2NP_Pos                  (7U)
+#define TIM_CCER_CC2NP_Msk                  (0x1UL << TIM_CCER_CC2NP_Pos)
+#define TIM_CCER_CC2NP                      TIM_CCER_CC2NP_Msk
+#define TIM_CCER_CC3E_Pos                   (8U)
+#define TIM_CCER_CC3E_Msk                   (0x1UL << TIM_CCER_CC3E_Pos)
+#define TIM_CCER_CC3E                       TIM_CCER_CC3E_Msk
+#define TIM_CCER_CC3P_Pos                   (9U)
+#define TIM_CCER_CC3P_Msk                   (0x1UL << TIM_CCER_CC3P_Pos)
+#define TIM_CCER_CC3P                       TIM_CCER_CC3P_Msk
+#define TIM_CCER_CC3NE_Pos                  (10U)
+#define TIM_CCER_CC3NE_Msk                  (0x1UL << TIM_CCER_CC3NE_Pos)
+#define TIM_CCER_CC3NE                      TIM_CCER_CC3NE_Msk
+#define TIM_CCER_CC3NP_Pos                  (11U)
+#define TIM_CCER_CC3NP_Msk                  (0x1UL << TIM_CCER_CC3NP_Pos)
+#define TIM_CCER_CC3NP                      TIM_CCER_CC3NP_Msk
+#define TIM_CCER_CC4E_Pos                   (12U)
+#define TIM_CCER_CC4E_Msk                   (0x1UL << TIM_CCER_CC4E_Pos)
+#define TIM_CCER_CC4E                       TIM_CCER_CC4E_Msk
+#define TIM_CCER_CC4P_Pos                   (13U)
+#define TIM_CCER_CC4P_Msk                   (0x1UL << TIM_CCER_CC4P_Pos)
+#define TIM_CCER_CC4P                       TIM_CCER_CC4P_Msk
+#define TIM_CCER_CC4NP_Pos                  (15U)
+#define TIM_CCER_CC4NP_Msk                  (0x1UL << TIM_CCER_CC4NP_Pos)
+#define TIM_CCER_CC4NP                      TIM_CCER_CC4NP_Msk
+/* TIM break and dead-time register (TIMx_BDTR), TIM1/TIM8 only */
+#define TIM_BDTR_DTG_Pos                    (0U)
+#define TIM_BDTR_DTG_Msk                    (0xFFUL << TIM_BDTR_DTG_Pos)
+#define TIM_BDTR_DTG                        TIM_BDTR_DTG_Msk
+#define TIM_BDTR_LOCK_Pos                   (8U)
+#define TIM_BDTR_LOCK_Msk                   (0x3UL << TIM_BDTR_LOCK_Pos)
+#define TIM_BDTR_LOCK                       TIM_BDTR_LOCK_Msk
+#define TIM_BDTR_OSSI_Pos                   (10U)
+#define TIM_BDTR_OSSI_Msk                   (0x1UL << TIM_BDTR_OSSI_Pos)
+#define TIM_BDTR_OSSI                       TIM_BDTR_OSSI_Msk
+#define TIM_BDTR_OSSR_Pos                   (11U)
+#define TIM_BDTR_OSSR_Msk                   (0x1UL << TIM_BDTR_OSSR_Pos)
+#define TIM_BDTR_OSSR                       TIM_BDTR_OSSR_Msk
+#define TIM_BDTR_BKE_Pos                    (12U)
+#define TIM_BDTR_BKE_Msk                    (0x1UL << TIM_BDTR_BKE_Pos)
+#define TIM_BDTR_BKE                        TIM_BDTR_BKE_Msk
+#define TIM_BDTR_BKP_Pos                    (13U)
+#define TIM_BDTR_BKP_Msk                    (0x1UL << TIM_BDTR_BKP_Pos)
+#define TIM_BDTR_BKP                        TIM_BDTR_BKP_Msk
+#define TIM_BDTR_AOE_Pos                    (14U)
+#define TIM_BDTR_AOE_Msk                    (0x1UL << TIM_BDTR_AOE_Pos)
+#define TIM_BDTR_AOE                        TIM_BDTR_AOE_Msk
+#define TIM_BDTR_MOE_Pos                    (15U)
+#define TIM_BDTR_MOE_Msk                    (0x1UL << TIM_BDTR_MOE_Pos)
+#define TIM_BDTR_MOE                        TIM_BDTR_MOE_Msk
+/* TIM DMA control register (TIMx_DCR) */
+#define TIM_DCR_DBA_Pos                     (0U)
+#define TIM_DCR_DBA_Msk                     (0x1FUL << TIM_DCR_DBA_Pos)
+#define TIM_DCR_DBA                         TIM_DCR_DBA_Msk
+#define TIM_DCR_DBL_Pos                     (8U)
+#define TIM_DCR_DBL_Msk                     (0x1FUL << TIM_DCR_DBL_Pos)
+#define TIM_DCR_DBL                         TIM_DCR_DBL_Msk
+
+
+/*****************************************************************/
+/*                      ADC peripheral						     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* ADC status register (ADC_SR) */
+#define ADC_SR_AWD_Pos                      (0U)
+#define ADC_SR_AWD_Msk                      (0x1UL << ADC_SR_AWD_Pos)
+#define ADC_SR_AWD                          ADC_SR_AWD_Msk
+#define ADC_SR_EOC_Pos                      (1U)
+#define ADC_SR_EOC_Msk                      (0x1UL << ADC_SR_EOC_Pos)
+#define ADC_SR_EOC                          ADC_SR_EOC_Msk
+#define ADC_SR_JEOC_Pos                     (2U)
+#define ADC_SR_JEOC_Msk                     (0x1UL << ADC_SR_JEOC_Pos)
+#define ADC_SR_JEOC                         ADC_SR_JEOC_Msk
+#define ADC_SR_JSTRT_Pos                    (3U)
+#define ADC_SR_JSTRT_Msk                    (0x1UL << ADC_SR_JSTRT_Pos)
+#define ADC_SR_JSTRT                        ADC_SR_JSTRT_Msk
+#define ADC_SR_STRT_Pos                     (4U)
+#define ADC_SR_STRT_Msk                     (0x1UL << ADC_SR_STRT_Pos)
+#define ADC_SR_STRT                         ADC_SR_STRT_Msk
+#define ADC_SR_OVR_Pos                      (5U)
+#define ADC_SR_OVR_Msk                      (0x1UL << ADC_SR_OVR_Pos)
+#define ADC_SR_OVR                          ADC_SR_OVR_Msk
+/* ADC control register 1 (ADC_CR1) */
+#define ADC_CR1_AWDCH_Pos                   (0U)
+#define ADC_CR1_AWDCH_Msk                   (0x1FUL << ADC_CR1_AWDCH_Pos)
+#define ADC_CR1_AWDCH                       ADC_CR1_AWDCH_Msk
+#define ADC_CR1_EOCIE_Pos                   (5U)
+#define ADC_CR1_EOCIE_Msk                   (0x1UL << ADC_CR1_EOCIE_Pos)
+#define ADC_CR1_EOCIE                       ADC_CR1_EOCIE_Msk
+#define ADC_CR1_AWDIE_Pos                   (6U)
+#define ADC_CR1_AWDIE_Msk                   (0x1UL << ADC_CR1_AWDIE_Pos)
+#define ADC_CR1_AWDIE                       ADC_CR1_AWDIE_Msk
+#define ADC_CR1_JEOCIE_Pos                  (7U)
+#define ADC_CR1_JEOCIE_Msk                  (0x1UL << ADC_CR1_JEOCIE_Pos)
+#define ADC_CR1_JEOCIE                      ADC_CR1_JEOCIE_Msk
+#define ADC_CR1_SCAN_Pos                    (8U)
+#define ADC_CR1_SCAN_Msk                    (0x1UL << ADC_CR1_SCAN_Pos)
+#define ADC_CR1_SCAN                        ADC_CR1_SCAN_Msk
+#define ADC_CR1_AWDSGL_Pos                  (9U)
+#define ADC_CR1_AWDSGL_Msk                  (0x1UL << ADC_CR1_AWDSGL_Pos)
+#define ADC_CR1_AWDSGL                      ADC_CR1_AWDSGL_Msk
+#define ADC_CR1_JAUTO_Pos                   (10U)
+#define ADC_CR1_JAUTO_Msk                   (0x1UL << ADC_CR1_JAUTO_Pos)
+#define ADC_CR1_JAUTO                       ADC_CR1_JAUTO_Msk
+#define ADC_CR1_DISCEN_Pos                  (11U)
+#define ADC_CR1_DISCEN_Msk                  (0x1UL << ADC_CR1_DISCEN_Pos)
+#define ADC_CR1_DISCEN                      ADC_CR1_DISCEN_Msk
+#define ADC_CR1_JDISCEN_Pos                 (12U)
+#define ADC_CR1_JDISCEN_Msk                 (0x1UL << ADC_CR1_JDISCEN_Pos)
+#define ADC_CR1_JDISCEN                     ADC_CR1_JDISCEN_Msk
+#define ADC_CR1_DISCNUM_Pos                 (13U)
+#define ADC_CR1_DISCNUM_Msk                 (0x7UL << ADC_CR1_DISCNUM_Pos)
+#define ADC_CR1_DISCNUM                     ADC_CR1_DISCNUM_Msk
+#define ADC_CR1_JAWDEN_Pos                  (22U)
+#define ADC_CR1_JAWDEN_Msk                  (0x1UL << ADC_CR1_JAWDEN_Pos)
+#define ADC_CR1_JAWDEN                      ADC_CR1_JAWDEN_Msk
+#define ADC_CR1_AWDEN_Pos                   (23U)
+#define ADC_CR1_AWDEN_Msk                   (0x1UL << ADC_CR1_AWDEN_Pos)
+#define ADC_CR1_AWDEN                       ADC_CR1_AWDEN_Msk
+#define ADC_CR1_RES_Pos                     (24U)
+#define ADC_CR1_RES_Msk                     (0x3UL << ADC_CR1_RES_Pos)
+#define ADC_CR1_RES                         ADC_CR1_RES_Msk
+#define ADC_CR1_OVRIE_Pos                   (26U)
+#define ADC_CR1_OVRIE_Msk                   (0x1UL << ADC_CR1_OVRIE_Pos)
+#define ADC_CR1_OVRIE                       ADC_CR1_OVRIE_Msk
+/* ADC control register 2 (ADC_CR2) */
+#define ADC_CR2_ADON_Pos                    (0U)
+#define ADC_CR2_ADON_Msk                    (0x1UL << ADC_CR2_ADON_Pos)
+#define ADC_CR2_ADON                        ADC_CR2_ADON_Msk
+#define ADC_CR2_CONT_Pos                    (1U)
+#define ADC_CR2_CONT_Msk                    (0x1UL << ADC_CR2_CONT_Pos)
+#define ADC_CR2_CONT                        ADC_CR2_CONT_Msk
+#define ADC_CR2_DMA_Pos                     (8U)
+#define ADC_CR2_DMA_Msk                     (0x1UL << ADC_CR2_DMA_Pos)
+#define ADC_CR2_DMA                         ADC_CR2_DMA_Msk
+#define ADC_CR2_DDS_Pos                     (9U)
+#define ADC_CR2_DDS_Msk                     (0x1UL << ADC_CR2_DDS_Pos)
+#define ADC_CR2_DDS                         ADC_CR2_DDS_Msk
+#define ADC_CR2_EOCS_Pos                    (10U)
+#define ADC_CR2_EOCS_Msk                    (0x1UL << ADC_CR2_EOCS_Pos)
+#define ADC_CR2_EOCS                        ADC_CR2_EOCS_Msk
+#define ADC_CR2_ALIGN_Pos                   (11U)
+#define ADC_CR2_ALIGN_Msk                   (0x1UL << ADC_CR2_ALIGN_Pos)
+#define ADC_CR2_ALIGN                       ADC_CR2_ALIGN_Msk
+#define ADC_CR2_JEXTSEL_Pos                 (16U)
+#define ADC_CR2_JEXTSEL_Msk                 (0xFUL << ADC_CR2_JEXTSEL_Pos)
+#define ADC_CR2_JEXTSEL                     ADC_CR2_JEXTSEL_Msk
+#define ADC_CR2_JEXTEN_Pos                  (20U)
+#define ADC_CR2_JEXTEN_Msk                  (0x3UL << ADC_CR2_JEXTEN_Pos)
+#define ADC_CR2_JEXTEN                      ADC_CR2_JEXTEN_Msk
+#define ADC_CR2_JSWSTART_Pos                (22U)
+#define ADC_CR2_JSWSTART_Msk                (0x1UL << ADC_CR2_JSWSTART_Pos)
+#define ADC_CR2_JSWSTART                    ADC_CR2_JSWSTART_Msk
+#define ADC_CR2_EXTSEL_Pos                  (24U)
+#define ADC_CR2_EXTSEL_Msk                  (0xFUL << ADC_CR2_EXTSEL_Pos)
+#define ADC_CR2_EXTSEL                      ADC_CR2_EXTSEL_Msk
+#define ADC_CR2_EXTEN_Pos                   (28U)
+#define ADC_CR2_EXTEN_Msk                   (0x3UL << ADC_CR2_EXTEN_Pos)
+#define ADC_CR2_EXTEN                       ADC_CR2_EXTEN_Msk
+#define ADC_CR2_SWSTART_Pos                 (30U)
+#define ADC_CR2_SWSTART_Msk                 (0x1UL << ADC_CR2_SWSTART_Pos)
+#define ADC_CR2_SWSTART                     ADC_CR2_SWSTART_Msk
+/* ADC regular sequence register 1 (ADC_SQR1): sequence length - 1 */
+#define ADC_SQR1_L_Pos                      (20U)
+#define ADC_SQR1_L_Msk                      (0xFUL << ADC_SQR1_L_Pos)
+#define ADC_SQR1_L                          ADC_SQR1_L_Msk
+/* ADC injected sequence register (ADC_JSQR): sequence length - 1 */
+#define ADC_JSQR_JL_Pos                     (20U)
+#define ADC_JSQR_JL_Msk                     (0x3UL << ADC_JSQR_JL_Pos)
+#define ADC_JSQR_JL                         ADC_JSQR_JL_Msk
+/* ADC common control register (ADC_CCR) */
+#define ADC_CCR_MULTI_Pos                   (0U)
+#define ADC_CCR_MULTI_Msk                   (0x1FUL << ADC_CCR_MULTI_Pos)
+#define ADC_CCR_MULTI                       ADC_CCR_MULTI_Msk
+#define ADC_CCR_DELAY_Pos                   (8U)
+#define ADC_CCR_DELAY_Msk                   (0xFUL << ADC_CCR_DELAY_Pos)
+#define ADC_CCR_DELAY                       ADC_CCR_DELAY_Msk
+#define ADC_CCR_DDS_Pos                     (13U)
+#define ADC_CCR_DDS_Msk                     (0x1UL << ADC_CCR_DDS_Pos)
+#define ADC_CCR_DDS                         ADC_CCR_DDS_Msk
+#define ADC_CCR_DMA_Pos                     (14U)
+#define ADC_CCR_DMA_Msk                     (0x3UL << ADC_CCR_DMA_Pos)
+#define ADC_CCR_DMA                         ADC_CCR_DMA_Msk
+#define ADC_CCR_ADCPRE_Pos                  (16U)
+#define ADC_CCR_ADCPRE_Msk                  (0x3UL << ADC_CCR_ADCPRE_Pos)
+#define ADC_CCR_ADCPRE                      ADC_CCR_ADCPRE_Msk
+#define ADC_CCR_VBATE_Pos                   (22U)
+#define ADC_CCR_VBATE_Msk                   (0x1UL << ADC_CCR_VBATE_Pos)
+#define ADC_CCR_VBATE                       ADC_CCR_VBATE_Msk
+#define ADC_CCR_TSVREFE_Pos                 (23U)
+#define ADC_CCR_TSVREFE_Msk                 (0x1UL << ADC_CCR_TSVREFE_Pos)
+#define ADC_CCR_TSVREFE                     ADC_CCR_TSVREFE_Msk
+/* ADC common regular data register (ADC_CDR) */
+#define ADC_CDR_DATA1_Pos                   (0U)
+#define ADC_CDR_DATA1_Msk                   (0xFFFFUL << ADC_CDR_DATA1_Pos)
+#define ADC_CDR_DATA1                       ADC_CDR_DATA1_Msk
+#define ADC_CDR_DATA2_Pos                   (16U)
+#define ADC_CDR_DATA2_Msk                   (0xFFFFUL << ADC_CDR_DATA2_Pos)
+#define ADC_CDR_DATA2                       ADC_CDR_DATA2_Msk
+
+#define ADC_SQR_RANK_BITS                   (5U)        /*< Channel number field width in SQRx/JSQR >*/
+#define ADC_SMPR_CHANNEL_BITS               (3U)        /*< Sample time field width in SMPRx >*/
+
+
+/*****************************************************************/
+/*                      DAC peripheral						     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* DAC control register (DAC_CR) */
+#define DAC_CR_EN1_Pos                      (0U)
+#define DAC_CR_EN1_Msk                      (0x1UL << DAC_CR_EN1_Pos)
+#define DAC_CR_EN1                          DAC_CR_EN1_Msk
+#define DAC_CR_BOFF1_Pos                    (1U)
+#define DAC_CR_BOFF1_Msk                    (0x1UL << DAC_CR_BOFF1_Pos)
+#define DAC_CR_BOFF1                        DAC_CR_BOFF1_Msk
+#define DAC_CR_TEN1_Pos                     (2U)
+#define DAC_CR_TEN1_Msk                     (0x1UL << DAC_CR_TEN1_Pos)
+#define DAC_CR_TEN1                         DAC_CR_TEN1_Msk
+#define DAC_CR_TSEL1_Pos                    (3U)
+#define DAC_CR_TSEL1_Msk                    (0x7UL << DAC_CR_TSEL1_Pos)
+#define DAC_CR_TSEL1                        DAC_CR_TSEL1_Msk
+#define DAC_CR_WAVE1_Pos                    (6U)
+#define DAC_CR_WAVE1_Msk                    (0x3UL << DAC_CR_WAVE1_Pos)
+#define DAC_CR_WAVE1                        DAC_CR_WAVE1_Msk
+#define DAC_CR_MAMP1_Pos                    (8U)
+#define DAC_CR_MAMP1_Msk                    (0xFUL << DAC_CR_MAMP1_Pos)
+#define DAC_CR_MAMP1                        DAC_CR_MAMP1_Msk
+#define DAC_CR_DMAEN1_Pos                   (12U)
+#define DAC_CR_DMAEN1_Msk                   (0x1UL << DAC_CR_DMAEN1_Pos)
+#define DAC_CR_DMAEN1                       DAC_CR_DMAEN1_Msk
+#define DAC_CR_DMAUDRIE1_Pos                (13U)
+#define DAC_CR_DMAUDRIE1_Msk                (0x1UL << DAC_CR_DMAUDRIE1_Pos)
+#define DAC_CR_DMAUDRIE1                    DAC_CR_DMAUDRIE1_Msk
+#define DAC_CR_EN2_Pos                      (16U)
+#define DAC_CR_EN2_Msk                      (0x1UL << DAC_CR_EN2_Pos)
+#define DAC_CR_EN2                          DAC_CR_EN2_Msk
+#define DAC_CR_BOFF2_Pos                    (17U)
+#define DAC_CR_BOFF2_Msk                    (0x1UL << DAC_CR_BOFF2_Pos)
+#define DAC_CR_BOFF2                        DAC_CR_BOFF2_Msk
+#define DAC_CR_TEN2_Pos                     (18U)
+#define DAC_CR_TEN2_Msk                     (0x1UL << DAC_CR_TEN2_Pos)
+#define DAC_CR_TEN2                         DAC_CR_TEN2_Msk
+#define DAC_CR_TSEL2_Pos                    (19U)
+#define DAC_CR_TSEL2_Msk                    (0x7UL << DAC_CR_TSEL2_Pos)
+#define DAC_CR_TSEL2                        DAC_CR_TSEL2_Msk
+#define DAC_CR_WAVE2_Pos                    (22U)
+#define DAC_CR_WAVE2_Msk                    (0x3UL << DAC_CR_WAVE2_Pos)
+#define DAC_CR_WAVE2                        DAC_CR_WAVE2_Msk
+#define DAC_CR_MAMP2_Pos                    (24U)
+#define DAC_CR_MAMP2_Msk                    (0xFUL << DAC_CR_MAMP2_Pos)
+#define DAC_CR_MAMP2                        DAC_CR_MAMP2_Msk
+#define DAC_CR_DMAEN2_Pos                   (28U)
+#define DAC_CR_DMAEN2_Msk                   (0x1UL << DAC_CR_DMAEN2_Pos)
+#define DAC_CR_DMAEN2                       DAC_CR_DMAEN2_Msk
+#define DAC_CR_DMAUDRIE2_Pos                (29U)
+#define DAC_CR_DMAUDRIE2_Msk                (0x1UL << DAC_CR_DMAUDRIE2_Pos)
+#define DAC_CR_DMAUDRIE2                    DAC_CR_DMAUDRIE2_Msk
+
+/* DAC software trigger register (DAC_SWTRIGR) */
+#define DAC_SWTRIGR_SWTRIG1_Pos             (0U)
+#define DAC_SWTRIGR_SWTRIG1_Msk             (0x1UL << DAC_SWTRIGR_SWTRIG1_Pos)
+#define DAC_SWTRIGR_SWTRIG1                 DAC_SWTRIGR_SWTRIG1_Msk
+#define DAC_SWTRIGR_SWTRIG2_Pos             (1U)
+#define DAC_SWTRIGR_SWTRIG2_Msk             (0x1UL << DAC_SWTRIGR_SWTRIG2_Pos)
+#define DAC_SWTRIGR_SWTRIG2                 DAC_SWTRIGR_SWTRIG2_Msk
+
+/* Dual DAC 12-bit right-aligned data holding register (DAC_DHR12RD) */
+#define DAC_DHR12RD_DACC1DHR_Pos            (0U)
+#define DAC_DHR12RD_DACC1DHR_Msk            (0xFFFUL << DAC_DHR12RD_DACC1DHR_Pos)
+#define DAC_DHR12RD_DACC1DHR                DAC_DHR12RD_DACC1DHR_Msk
+#define DAC_DHR12RD_DACC2DHR_Pos            (16U)
+#define DAC_DHR12RD_DACC2DHR_Msk            (0xFFFUL << DAC_DHR12RD_DACC2DHR_Pos)
+#define DAC_DHR12RD_DACC2DHR                DAC_DHR12RD_DACC2DHR_Msk
+
+/* DAC status register (DAC_SR) */
+#define DAC_SR_DMAUDR1_Pos                  (13U)
+#define DAC_SR_DMAUDR1_Msk                  (0x1UL << DAC_SR_DMAUDR1_Pos)
+#define DAC_SR_DMAUDR1                      DAC_SR_DMAUDR1_Msk
+#define DAC_SR_DMAUDR2_Pos                  (29U)
+#define DAC_SR_DMAUDR2_Msk                  (0x1UL << DAC_SR_DMAUDR2_Pos)
+#define DAC_SR_DMAUDR2                      DAC_SR_DMAUDR2_Msk
+
+#define DAC_CR_CHANNEL2_SHIFT               (16U)       /*< Channel 2 fields of DAC_CR are channel 1 fields << 16 >*/
+
+
+/*****************************************************************/
+/*                      CAN peripheral						     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* CAN master control register (CAN_MCR) */
+#define CAN_MCR_INRQ_Pos                    (0U)
+#define CAN_MCR_INRQ_Msk                    (0x1UL << CAN_MCR_INRQ_Pos)
+#define CAN_MCR_INRQ                        CAN_MCR_INRQ_Msk
+#define CAN_MCR_SLEEP_Pos                   (1U)
+#define CAN_MCR_SLEEP_Msk                   (0x1UL << CAN_MCR_SLEEP_Pos)
+#define CAN_MCR_SLEEP                       CAN_MCR_SLEEP_Msk
+#define CAN_MCR_TXFP_Pos                    (2U)
+#define CAN_MCR_TXFP_Msk                    (0x1UL << CAN_MCR_TXFP_Pos)
+#define CAN_MCR_TXFP                        CAN_MCR_TXFP_Msk
+#define CAN_MCR_RFLM_Pos                    (3U)
+#define CAN_MCR_RFLM_Msk                    (0x1UL << CAN_MCR_RFLM_Pos)
+#define CAN_MCR_RFLM                        CAN_MCR_RFLM_Msk
+#define CAN_MCR_NART_Pos                    (4U)
+#define CAN_MCR_NART_Msk                    (0x1UL << CAN_MCR_NART_Pos)
+#define CAN_MCR_NART                        CAN_MCR_NART_Msk
+#define CAN_MCR_AWUM_Pos                    (5U)
+#define CAN_MCR_AWUM_Msk                    (0x1UL << CAN_MCR_AWUM_Pos)
+#define CAN_MCR_AWUM                        CAN_MCR_AWUM_Msk
+#define CAN_MCR_ABOM_Pos                    (6U)
+#define CAN_MCR_ABOM_Msk                    (0x1UL << CAN_MCR_ABOM_Pos)
+#define CAN_MCR_ABOM                        CAN_MCR_ABOM_Msk
+#define CAN_MCR_TTCM_Pos                    (7U)
+#define CAN_MCR_TTCM_Msk                    (0x1UL << CAN_MCR_TTCM_Pos)
+#define CAN_MCR_TTCM                        CAN_MCR_TTCM_Msk
+#define CAN_MCR_RESET_Pos                   (15U)
+#define CAN_MCR_RESET_Msk                   (0x1UL << CAN_MCR_RESET_Pos)
+#define CAN_MCR_RESET                       CAN_MCR_RESET_Msk
+#define CAN_MCR_DBF_Pos                     (16U)
+#define CAN_MCR_DBF_Msk                     (0x1UL << CAN_MCR_DBF_Pos)
+#define CAN_MCR_DBF                         CAN_MCR_DBF_Msk
+
+/* CAN master status register (CAN_MSR) */
+#define CAN_MSR_INAK_Pos                    (0U)
+#define CAN_MSR_INAK_Msk                    (0x1UL << CAN_MSR_INAK_Pos)
+#define CAN_MSR_INAK                        CAN_MSR_INAK_Msk
+#define CAN_MSR_SLAK_Pos                    (1U)
+#define CAN_MSR_SLAK_Msk                    (0x1UL << CAN_MSR_SLAK_Pos)
+#define CAN_MSR_SLAK                        CAN_MSR_SLAK_Msk
+#define CAN_MSR_ERRI_Pos                    (2U)
+#define CAN_MSR_ERRI_Msk                    (0x1UL << CAN_MSR_ERRI_Pos)
+#define CAN_MSR_ERRI                        CAN_MSR_ERRI_Msk
+#define CAN_MSR_WKUI_Pos                    (3U)
+#define CAN_MSR_WKUI_Msk                    (0x1UL << CAN_MSR_WKUI_Pos)
+#define CAN_MSR_WKUI                        CAN_MSR_WKUI_Msk
+#define CAN_MSR_SLAKI_Pos                   (4U)
+#define CAN_MSR_SLAKI_Msk                   (0x1UL << CAN_MSR_SLAKI_Pos)
+#define CAN_MSR_SLAKI                       CAN_MSR_SLAKI_Msk
+
+/* CAN transmit status register (CAN_TSR) */
+#define CAN_TSR_RQCP0_Pos                   (0U)
+#define CAN_TSR_RQCP0_Msk                   (0x1UL << CAN_TSR_RQCP0_Pos)
+#define CAN_TSR_RQCP0                       CAN_TSR_RQCP0_Msk
+#define CAN_TSR_TXOK0_Pos                   (1U)
+#define CAN_TSR_TXOK0_Msk                   (0x1UL << CAN_TSR_TXOK0_Pos)
+#define CAN_TSR_TXOK0                       CAN_TSR_TXOK0_Msk
+#define CAN_TSR_ALST0_Pos                   (2U)
+#define CAN_TSR_ALST0_Msk                   (0x1UL << CAN_TSR_ALST0_Pos)
+#define CAN_TSR_ALST0                       CAN_TSR_ALST0_Msk
+#define CAN_TSR_TERR0_Pos                   (3U)
+#define CAN_TSR_TERR0_Msk                   (0x1UL << CAN_TSR_TERR0_Pos)
+#define CAN_TSR_TERR0                       CAN_TSR_TERR0_Msk
+#define CAN_TSR_ABRQ0_Pos                   (7U)
+#define CAN_TSR_ABRQ0_Msk                   (0x1UL << CAN_TSR_ABRQ0_Pos)
+#define CAN_TSR_ABRQ0                       CAN_TSR_ABRQ0_Msk
+#define CAN_TSR_RQCP1_Pos                   (8U)
+#define CAN_TSR_RQCP1_Msk                   (0x1UL << CAN_TSR_RQCP1_Pos)
+#define CAN_TSR_RQCP1                       CAN_TSR_RQCP1_Msk
+#define CAN_TSR_TXOK1_Pos                   (9U)
+#define CAN_TSR_TXOK1_Msk                   (0x1UL << CAN_TSR_TXOK1_Pos)
+#define CAN_TSR_TXOK1                       CAN_TSR_TXOK1_Msk
+#define CAN_TSR_ALST1_Pos                   (10U)
+#define CAN_TSR_ALST1_Msk                   (0x1UL << CAN_TSR_ALST1_Pos)
+#define CAN_TSR_ALST1                       CAN_TSR_ALST1_Msk
+#define CAN_TSR_TERR1_Pos                   (11U)
+#define CAN_TSR_TERR1_Msk                   (0x1UL << CAN_TSR_TERR1_Pos)
+#define CAN_TSR_TERR1                       CAN_TSR_TERR1_Msk
+#define CAN_TSR_ABRQ1_Pos                   (15U)
+#define CAN_TSR_ABRQ1_Msk                   (0x1UL << CAN_TSR_ABRQ1_Pos)
+#define CAN_TSR_ABRQ1                       CAN_TSR_ABRQ1_Msk
+#define CAN_TSR_RQCP2_Pos                   (16U)
+#define CAN_TSR_RQCP2_Msk                   (0x1UL << CAN_TSR_RQCP2_Pos)
+#define CAN_TSR_RQCP2                       CAN_TSR_RQCP2_Msk
+#define CAN_TSR_TXOK2_Pos                   (17U)
+#define CAN_TSR_TXOK2_Msk                   (0x1UL << CAN_TSR_TXOK2_Pos)
+#define CAN_TSR_TXOK2                       CAN_TSR_TXOK2_Msk
+#define CAN_TSR_ALST2_Pos                   (18U)
+#define CAN_TSR_ALST2_Msk                   (0x1UL << CAN_TSR_ALST2_Pos)
+#define CAN_TSR_ALST2                       CAN_TSR_ALST2_Msk
+#define CAN_TSR_TERR2_Pos                   (19U)
+#define CAN_TSR_TERR2_Msk                   (0x1UL << CAN_TSR_TERR2_Pos)
+#define CAN_TSR_TERR2                       CAN_TSR_TERR2_Msk
+#define CAN_TSR_ABRQ2_Pos                   (23U)
+#define CAN_TSR_ABRQ2_Msk                   (0x1UL << CAN_TSR_ABRQ2_Pos)
+#define CAN_TSR_ABRQ2                       CAN_TSR_ABRQ2_Msk
+#define CAN_TSR_CODE_Pos                    (24U)
+#define CAN_TSR_CODE_Msk                    (0x3UL << CAN_TSR_CODE_Pos)
+#define CAN_TSR_CODE                        CAN_TSR_CODE_Msk
+#define CAN_TSR_TME0_Pos                    (26U)
+#define CAN_TSR_TME0_Msk                    (0x1UL << CAN_TSR_TME0_Pos)
+#define CAN_TSR_TME0                        CAN_TSR_TME0_Msk
+#define CAN_TSR_TME1_Pos                    (27U)
+#define CAN_TSR_TME1_Msk                    (0x1UL << CAN_TSR_TME1_Pos)
+#define CAN_TSR_TME1                        CAN_TSR_TME1_Msk
+#define CAN_TSR_TME2_Pos                    (28U)
+#define CAN_TSR_TME2_Msk                    (0x1UL << CAN_TSR_TME2_Pos)
+#define CAN_TSR_TME2                        CAN_TSR_TME2_Msk
+#define CAN_TSR_TME_Pos                     (26U)
+#define CAN_TSR_TME_Msk                     (0x7UL << CAN_TSR_TME_Pos)
+#define CAN_TSR_TME                         CAN_TSR_TME_Msk
+#define CAN_TSR_LOW0_Pos                    (29U)
+#define CAN_TSR_LOW0_Msk                    (0x1UL << CAN_TSR_LOW0_Pos)
+#define CAN_TSR_LOW0                        CAN_TSR_LOW0_Msk
+#define CAN_TSR_LOW1_Pos                    (30U)
+#define CAN_TSR_LOW1_Msk                    (0x1UL << CAN_TSR_LOW1_Pos)
+#define CAN_TSR_LOW1                        CAN_TSR_LOW1_Msk
+#define CAN_TSR_LOW2_Pos                    (31U)
+#define CAN_TSR_LOW2_Msk                    (0x1UL << CAN_TSR_LOW2_Pos)
+#define CAN_TSR_LOW2                        CAN_TSR_LOW2_Msk
+
+/* CAN receive FIFO 0 register (CAN_RF0R) */
+#define CAN_RF0R_FMP0_Pos                   (0U)
+#define CAN_RF0R_FMP0_Msk                   (0x3UL << CAN_RF0R_FMP0_Pos)
+#define CAN_RF0R_FMP0                       CAN_RF0R_FMP0_Msk
+#define CAN_RF0R_FULL0_Pos                  (3U)
+#define CAN_RF0R_FULL0_Msk                  (0x1UL << CAN_RF0R_FULL0_Pos)
+#define CAN_RF0R_FULL0                      CAN_RF0R_FULL0_Msk
+#define CAN_RF0R_FOVR0_Pos                  (4U)
+#define CAN_RF0R_FOVR0_Msk                  (0x1UL << CAN_RF0R_FOVR0_Pos)
+#define CAN_RF0R_FOVR0                      CAN_RF0R_FOVR0_Msk
+#define CAN_RF0R_RFOM0_Pos                  (5U)
+#define CAN_RF0R_RFOM0_Msk                  (0x1UL << CAN_RF0R_RFOM0_Pos)
+#define CAN_RF0R_RFOM0                      CAN_RF0R_RFOM0_Msk
+
+/* CAN receive FIFO 1 register (CAN_RF1R) */
+#define CAN_RF1R_FMP1_Pos                   (0U)
+#define CAN_RF1R_FMP1_Msk                   (0x3UL << CAN_RF1R_FMP1_Pos)
+#define CAN_RF1R_FMP1                       CAN_RF1R_FMP1_Msk
+#define CAN_RF1R_FULL1_Pos                  (3U)
+#define CAN_RF1R_FULL1_Msk                  (0x1UL << CAN_RF1R_FULL1_Pos)
+#define CAN_RF1R_FULL1                      CAN_RF1R_FULL1_Msk
+#define CAN_RF1R_FOVR1_Pos                  (4U)
+#define CAN_RF1R_FOVR1_Msk                  (0x1UL << CAN_RF1R_FOVR1_Pos)
+#define CAN_RF1R_FOVR1                      CAN_RF1R_FOVR1_Msk
+#define CAN_RF1R_RFOM1_Pos                  (5U)
+#define CAN_RF1R_RFOM1_Msk                  (0x1UL << CAN_RF1R_RFOM1_Pos)
+#define CAN_RF1R_RFOM1                      CAN_RF1R_RFOM1_Msk
+
+/* CAN interrupt enable register (CAN_IER) */
+#define CAN_IER_TMEIE_Pos                   (0U)
+#define CAN_IER_TMEIE_Msk                   (0x1UL << CAN_IER_TMEIE_Pos)
+#define CAN_IER_TMEIE                       CAN_IER_TMEIE_Msk
+#define CAN_IER_FMPIE0_Pos                  (1U)
+#define CAN_IER_FMPIE0_Msk                  (0x1UL << CAN_IER_FMPIE0_Pos)
+#define CAN_IER_FMPIE0                      CAN_IER_FMPIE0_Msk
+#define CAN_IER_FFIE0_Pos                   (2U)
+#define CAN_IER_FFIE0_Msk                   (0x1UL << CAN_IER_FFIE0_Pos)
+#define CAN_IER_FFIE0                       CAN_IER_FFIE0_Msk
+#define CAN_IER_FOVIE0_Pos                  (3U)
+#define CAN_IER_FOVIE0_Msk                  (0x1UL << CAN_IER_FOVIE0_Pos)
+#define CAN_IER_FOVIE0                      CAN_IER_FOVIE0_Msk
+#define CAN_IER_FMPIE1_Pos                  (4U)
+#define CAN_IER_FMPIE1_Msk                  (0x1UL << CAN_IER_FMPIE1_Pos)
+#define CAN_IER_FMPIE1                      CAN_IER_FMPIE1_Msk
+#define CAN_IER_FFIE1_Pos                   (5U)
+#define CAN_IER_FFIE1_Msk                   (0x1UL << CAN_IER_FFIE1_Pos)
+#define CAN_IER_FFIE1                       CAN_IER_FFIE1_Msk
+#define CAN_IER_FOVIE1_Pos                  (6U)
+#define CAN_IER_FOVIE1_Msk                  (0x1UL << CAN_IER_FOVIE1_Pos)
+#define CAN_IER_FOVIE1                      CAN_IER_FOVIE1_Msk
+#define CAN_IER_EWGIE_Pos                   (8U)
+#define CAN_IER_EWGIE_Msk                   (0x1UL << CAN_IER_EWGIE_Pos)
+#define CAN_IER_EWGIE                       CAN_IER_EWGIE_Msk
+#define CAN_IER_EPVIE_Pos                   (9U)
+#define CAN_IER_EPVIE_Msk                   (0x1UL << CAN_IER_EPVIE_Pos)
+#define CAN_IER_EPVIE                       CAN_IER_EPVIE_Msk
+#define CAN_IER_BOFIE_Pos                   (10U)
+#define CAN_IER_BOFIE_Msk                   (0x1UL << CAN_IER_BOFIE_Pos)
+#define CAN_IER_BOFIE                       CAN_IER_BOFIE_Msk
+#define CAN_IER_LECIE_Pos                   (11U)
+#define CAN_IER_LECIE_Msk                   (0x1UL << CAN_IER_LECIE_Pos)
+#define CAN_IER_LECIE                       CAN_IER_LECIE_Msk
+#define CAN_IER_ERRIE_Pos                   (15U)
+#define CAN_IER_ERRIE_Msk                   (0x1UL << CAN_IER_ERRIE_Pos)
+#define CAN_IER_ERRIE                       CAN_IER_ERRIE_Msk
+#define CAN_IER_WKUIE_Pos                   (16U)
+#define CAN_IER_WKUIE_Msk                   (0x1UL << CAN_IER_WKUIE_Pos)
+#define CAN_IER_WKUIE                       CAN_IER_WKUIE_Msk
+#define CAN_IER_SLKIE_Pos                   (17U)
+#define CAN_IER_SLKIE_Msk                   (0x1UL << CAN_IER_SLKIE_Pos)
+#define CAN_IER_SLKIE                       CAN_IER_SLKIE_Msk
+
+/* CAN error status register (CAN_ESR) */
+#define CAN_ESR_EWGF_Pos                    (0U)
+#define CAN_ESR_EWGF_Msk                    (0x1UL << CAN_ESR_EWGF_Pos)
+#define CAN_ESR_EWGF                        CAN_ESR_EWGF_Msk
+#define CAN_ESR_EPVF_Pos                    (1U)
+#define CAN_ESR_EPVF_Msk                    (0x1UL << CAN_ESR_EPVF_Pos)
+#define CAN_ESR_EPVF                        CAN_ESR_EPVF_Msk
+#define CAN_ESR_BOFF_Pos                    (2U)
+#define CAN_ESR_BOFF_Msk                    (0x1UL << CAN_ESR_BOFF_Pos)
+#define CAN_ESR_BOFF                        CAN_ESR_BOFF_Msk
+#define CAN_ESR_LEC_Pos                     (4U)
+#define CAN_ESR_LEC_Msk                     (0x7UL << CAN_ESR_LEC_Pos)
+#define CAN_ESR_LEC                         CAN_ESR_LEC_Msk
+#define CAN_ESR_TEC_Pos                     (16U)
+#define CAN_ESR_TEC_Msk                     (0xFFUL << CAN_ESR_TEC_Pos)
+#define CAN_ESR_TEC                         CAN_ESR_TEC_Msk
+#define CAN_ESR_REC_Pos                     (24U)
+#define CAN_ESR_REC_Msk                     (0xFFUL << CAN_ESR_REC_Pos)
+#define CAN_ESR_REC                         CAN_ESR_REC_Msk
+
+/* CAN bit timing register (CAN_BTR) */
+#define CAN_BTR_BRP_Pos                     (0U)
+#define CAN_BTR_BRP_Msk                     (0x3FFUL << CAN_BTR_BRP_Pos)
+#define CAN_BTR_BRP                         CAN_BTR_BRP_Msk
+#define CAN_BTR_TS1_Pos                     (16U)
+#define CAN_BTR_TS1_Msk                     (0xFUL << CAN_BTR_TS1_Pos)
+#define CAN_BTR_TS1                         CAN_BTR_TS1_Msk
+#define CAN_BTR_TS2_Pos                     (20U)
+#define CAN_BTR_TS2_Msk                     (0x7UL << CAN_BTR_TS2_Pos)
+#define CAN_BTR_TS2                         CAN_BTR_TS2_Msk
+#define CAN_BTR_SJW_Pos                     (24U)
+#define CAN_BTR_SJW_Msk                     (0x3UL << CAN_BTR_SJW_Pos)
+#define CAN_BTR_SJW                         CAN_BTR_SJW_Msk
+#define CAN_BTR_LBKM_Pos                    (30U)
+#define CAN_BTR_LBKM_Msk                    (0x1UL << CAN_BTR_LBKM_Pos)
+#define CAN_BTR_LBKM                        CAN_BTR_LBKM_Msk
+#define CAN_BTR_SILM_Pos                    (31U)
+#define CAN_BTR_SILM_Msk                    (0x1UL << CAN_BTR_SILM_Pos)
+#define CAN_BTR_SILM                        CAN_BTR_SILM_Msk
+
+/* CAN mailbox identifier registers (CAN_TIxR / CAN_RIxR) */
+#define CAN_TI0R_TXRQ_Pos                   (0U)
+#define CAN_TI0R_TXRQ_Msk                   (0x1UL << CAN_TI0R_TXRQ_Pos)
+#define CAN_TI0R_TXRQ                       CAN_TI0R_TXRQ_Msk
+#define CAN_TI0R_RTR_Pos                    (1U)
+#define CAN_TI0R_RTR_Msk                    (0x1UL << CAN_TI0R_RTR_Pos)
+#define CAN_TI0R_RTR                        CAN_TI0R_RTR_Msk
+#define CAN_TI0R_IDE_Pos                    (2U)
+#define CAN_TI0R_IDE_Msk                    (0x1UL << CAN_TI0R_IDE_Pos)
+#define CAN_TI0R_IDE                        CAN_TI0R_IDE_Msk
+#define CAN_TI0R_EXID_Pos                   (3U)
+#define CAN_TI0R_EXID_Msk                   (0x1FFFFFFFUL << CAN_TI0R_EXID_Pos)
+#define CAN_TI0R_EXID                       CAN_TI0R_EXID_Msk
+#define CAN_TI0R_STID_Pos                   (21U)
+#define CAN_TI0R_STID_Msk                   (0x7FFUL << CAN_TI0R_STID_Pos)
+#define CAN_TI0R_STID                       CAN_TI0R_STID_Msk
+
+/* CAN mailbox data length control and time stamp registers (CAN_TDTxR / CAN_RDTxR) */
+#define CAN_TDT0R_DLC_Pos                   (0U)
+#define CAN_TDT0R_DLC_Msk                   (0xFUL << CAN_TDT0R_DLC_Pos)
+#define CAN_TDT0R_DLC                       CAN_TDT0R_DLC_Msk
+#define CAN_TDT0R_TGT_Pos                   (8U)
+#define CAN_TDT0R_TGT_Msk                   (0x1UL << CAN_TDT0R_TGT_Pos)
+#define CAN_TDT0R_TGT                       CAN_TDT0R_TGT_Msk
+#define CAN_TDT0R_TIME_Pos                  (16U)
+#define CAN_TDT0R_TIME_Msk                  (0xFFFFUL << CAN_TDT0R_TIME_Pos)
+#define CAN_TDT0R_TIME                      CAN_TDT0R_TIME_Msk
+#define CAN_RDT0R_DLC_Pos                   (0U)
+#define CAN_RDT0R_DLC_Msk                   (0xFUL << CAN_RDT0R_DLC_Pos)
+#define CAN_RDT0R_DLC                       CAN_RDT0R_DLC_Msk
+#define CAN_RDT0R_FMI_Pos                   (8U)
+#define CAN_RDT0R_FMI_Msk                   (0xFFUL << CAN_RDT0R_FMI_Pos)
+#define CAN_RDT0R_FMI                       CAN_RDT0R_FMI_Msk
+#define CAN_RDT0R_TIME_Pos                  (16U)
+#define CAN_RDT0R_TIME_Msk                  (0xFFFFUL << CAN_RDT0R_TIME_Pos)
+#define CAN_RDT0R_TIME                      CAN_RDT0R_TIME_Msk
+
+/* CAN filter master register (CAN_FMR) */
+#define CAN_FMR_FINIT_Pos                   (0U)
+#define CAN_FMR_FINIT_Msk                   (0x1UL << CAN_FMR_FINIT_Pos)
+#define CAN_FMR_FINIT                       CAN_FMR_FINIT_Msk
+#define CAN_FMR_CAN2SB_Pos                  (8U)
+#define CAN_FMR_CAN2SB_Msk                  (0x3FUL << CAN_FMR_CAN2SB_Pos)
+#define CAN_FMR_CAN2SB                      CAN_FMR_CAN2SB_Msk
+
+#define CAN_FILTER_BANKS                    (28U)       /*< Filter banks shared by CAN1 and CAN2 >*/
+#define CAN_TX_MAILBOXES                    (3U)
+
+/*****************************************************************/
+/*                      SDIO peripheral						     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* SDIO power control register (SDIO_POWER) */
+#define SDIO_POWER_PWRCTRL_Pos              (0U)
+#define SDIO_POWER_PWRCTRL_Msk              (0x3UL << SDIO_POWER_PWRCTRL_Pos)
+#define SDIO_POWER_PWRCTRL                  SDIO_POWER_PWRCTRL_Msk
+
+/* SDIO clock control register (SDIO_CLKCR) */
+#define SDIO_CLKCR_CLKDIV_Pos               (0U)
+#define SDIO_CLKCR_CLKDIV_Msk               (0xFFUL << SDIO_CLKCR_CLKDIV_Pos)
+#define SDIO_CLKCR_CLKDIV                   SDIO_CLKCR_CLKDIV_Msk
+#define SDIO_CLKCR_CLKEN_Pos                (8U)
+#define SDIO_CLKCR_CLKEN_Msk                (0x1UL << SDIO_CLKCR_CLKEN_Pos)
+#define SDIO_CLKCR_CLKEN                    SDIO_CLKCR_CLKEN_Msk
+#define SDIO_CLKCR_PWRSAV_Pos               (9U)
+#define SDIO_CLKCR_PWRSAV_Msk               (0x1UL << SDIO_CLKCR_PWRSAV_Pos)
+#define SDIO_CLKCR_PWRSAV                   SDIO_CLKCR_PWRSAV_Msk
+#define SDIO_CLKCR_BYPASS_Pos               (10U)
+#define SDIO_CLKCR_BYPASS_Msk               (0x1UL << SDIO_CLKCR_BYPASS_Pos)
+#define SDIO_CLKCR_BYPASS                   SDIO_CLKCR_BYPASS_Msk
+#define SDIO_CLKCR_WIDBUS_Pos               (11U)
+#define SDIO_CLKCR_WIDBUS_Msk               (0x3UL << SDIO_CLKCR_WIDBUS_Pos)
+#define SDIO_CLKCR_WIDBUS                   SDIO_CLKCR_WIDBUS_Msk
+#define SDIO_CLKCR_NEGEDGE_Pos              (13U)
+#define SDIO_CLKCR_NEGEDGE_Msk              (0x1UL << SDIO_CLKCR_NEGEDGE_Pos)
+#define SDIO_CLKCR_NEGEDGE                  SDIO_CLKCR_NEGEDGE_Msk
+#define SDIO_CLKCR_HWFC_EN_Pos              (14U)
+#define SDIO_CLKCR_HWFC_EN_Msk              (0x1UL << SDIO_CLKCR_HWFC_EN_Pos)
+#define SDIO_CLKCR_HWFC_EN                  SDIO_CLKCR_HWFC_EN_Msk
+
+/* SDIO command register (SDIO_CMD) */
+#define SDIO_CMD_CMDINDEX_Pos               (0U)
+#define SDIO_CMD_CMDINDEX_Msk               (0x3FUL << SDIO_CMD_CMDINDEX_Pos)
+#define SDIO_CMD_CMDINDEX                   SDIO_CMD_CMDINDEX_Msk
+#define SDIO_CMD_WAITRESP_Pos               (6U)
+#define SDIO_CMD_WAITRESP_Msk               (0x3UL << SDIO_CMD_WAITRESP_Pos)
+#define SDIO_CMD_WAITRESP                   SDIO_CMD_WAITRESP_Msk
+#define SDIO_CMD_WAITINT_Pos                (8U)
+#define SDIO_CMD_WAITINT_Msk                (0x1UL << SDIO_CMD_WAITINT_Pos)
+#define SDIO_CMD_WAITINT                    SDIO_CMD_WAITINT_Msk
+#define SDIO_CMD_WAITPEND_Pos               (9U)
+#define SDIO_CMD_WAITPEND_Msk               (0x1UL << SDIO_CMD_WAITPEND_Pos)
+#define SDIO_CMD_WAITPEND                   SDIO_CMD_WAITPEND_Msk
+#define SDIO_CMD_CPSMEN_Pos                 (10U)
+#define SDIO_CMD_CPSMEN_Msk                 (0x1UL << SDIO_CMD_CPSMEN_Pos)
+#define SDIO_CMD_CPSMEN                     SDIO_CMD_CPSMEN_Msk
+#define SDIO_CMD_SDIOSUSPEND_Pos            (11U)
+#define SDIO_CMD_SDIOSUSPEND_Msk            (0x1UL << SDIO_CMD_SDIOSUSPEND_Pos)
+#define SDIO_CMD_SDIOSUSPEND                SDIO_CMD_SDIOSUSPEND_Msk
+#define SDIO_CMD_ENCMDCOMPL_Pos             (12U)
+#define SDIO_CMD_ENCMDCOMPL_Msk             (0x1UL << SDIO_CMD_ENCMDCOMPL_Pos)
+#define SDIO_CMD_ENCMDCOMPL                 SDIO_CMD_ENCMDCOMPL_Msk
+#define SDIO_CMD_NIEN_Pos                   (13U)
+#define SDIO_CMD_NIEN_Msk                   (0x1UL << SDIO_CMD_NIEN_Pos)
+#define SDIO_CMD_NIEN                       SDIO_CMD_NIEN_Msk
+#define SDIO_CMD_CEATACMD_Pos               (14U)
+#define SDIO_CMD_CEATACMD_Msk               (0x1UL << SDIO_CMD_CEATACMD_Pos)
+#define SDIO_CMD_CEATACMD                   SDIO_CMD_CEATACMD_Msk
+
+/* SDIO data length register (SDIO_DLEN) */
+#define SDIO_DLEN_DATALENGTH_Pos            (0U)
+#define SDIO_DLEN_DATALENGTH_Msk            (0x1FFFFFFUL << SDIO_DLEN_DATALENGTH_Pos)
+#define SDIO_DLEN_DATALENGTH                SDIO_DLEN_DATALENGTH_Msk
+
+/* SDIO data control register (SDIO_DCTRL) */
+#define SDIO_DCTRL_DTEN_Pos                 (0U)
+#define SDIO_DCTRL_DTEN_Msk                 (0x1UL << SDIO_DCTRL_DTEN_Pos)
+#define SDIO_DCTRL_DTEN                     SDIO_DCTRL_DTEN_Msk
+#define SDIO_DCTRL_DTDIR_Pos                (1U)
+#define SDIO_DCTRL_DTDIR_Msk                (0x1UL << SDIO_DCTRL_DTDIR_Pos)
+#define SDIO_DCTRL_DTDIR                    SDIO_DCTRL_DTDIR_Msk
+#define SDIO_DCTRL_DTMODE_Pos               (2U)
+#define SDIO_DCTRL_DTMODE_Msk               (0x1UL << SDIO_DCTRL_DTMODE_Pos)
+#define SDIO_DCTRL_DTMODE                   SDIO_DCTRL_DTMODE_Msk
+#define SDIO_DCTRL_DMAEN_Pos                (3U)
+#define SDIO_DCTRL_DMAEN_Msk                (0x1UL << SDIO_DCTRL_DMAEN_Pos)
+#define SDIO_DCTRL_DMAEN                    SDIO_DCTRL_DMAEN_Msk
+#define SDIO_DCTRL_DBLOCKSIZE_Pos           (4U)
+#define SDIO_DCTRL_DBLOCKSIZE_Msk           (0xFUL << SDIO_DCTRL_DBLOCKSIZE_Pos)
+#define SDIO_DCTRL_DBLOCKSIZE               SDIO_DCTRL_DBLOCKSIZE_Msk
+#define SDIO_DCTRL_RWSTART_Pos              (8U)
+#define SDIO_DCTRL_RWSTART_Msk              (0x1UL << SDIO_DCTRL_RWSTART_Pos)
+#define SDIO_DCTRL_RWSTART                  SDIO_DCTRL_RWSTART_Msk
+#define SDIO_DCTRL_RWSTOP_Pos               (9U)
+#define SDIO_DCTRL_RWSTOP_Msk               (0x1UL << SDIO_DCTRL_RWSTOP_Pos)
+#define SDIO_DCTRL_RWSTOP                   SDIO_DCTRL_RWSTOP_Msk
+#define SDIO_DCTRL_RWMOD_Pos                (10U)
+#define SDIO_DCTRL_RWMOD_Msk                (0x1UL << SDIO_DCTRL_RWMOD_Pos)
+#define SDIO_DCTRL_RWMOD                    SDIO_DCTRL_RWMOD_Msk
+#define SDIO_DCTRL_SDIOEN_Pos               (11U)
+#define SDIO_DCTRL_SDIOEN_Msk               (0x1UL << SDIO_DCTRL_SDIOEN_Pos)
+#define SDIO_DCTRL_SDIOEN                   SDIO_DCTRL_SDIOEN_Msk
+
+/* SDIO status register (SDIO_STA) */
+#define SDIO_STA_CCRCFAIL_Pos               (0U)
+#define SDIO_STA_CCRCFAIL_Msk               (0x1UL << SDIO_STA_CCRCFAIL_Pos)
+#define SDIO_STA_CCRCFAIL                   SDIO_STA_CCRCFAIL_Msk
+#define SDIO_STA_DCRCFAIL_Pos               (1U)
+#define SDIO_STA_DCRCFAIL_Msk               (0x1UL << SDIO_STA_DCRCFAIL_Pos)
+#define SDIO_STA_DCRCFAIL                   SDIO_STA_DCRCFAIL_Msk
+#define SDIO_STA_CTIMEOUT_Pos               (2U)
+#define SDIO_STA_CTIMEOUT_Msk               (0x1UL << SDIO_STA_CTIMEOUT_Pos)
+#define SDIO_STA_CTIMEOUT                   SDIO_STA_CTIMEOUT_Msk
+#define SDIO_STA_DTIMEOUT_Pos               (3U)
+#define SDIO_STA_DTIMEOUT_Msk               (0x1UL << SDIO_STA_DTIMEOUT_Pos)
+#define SDIO_STA_DTIMEOUT                   SDIO_STA_DTIMEOUT_Msk
+#define SDIO_STA_TXUNDERR_Pos               (4U)
+#define SDIO_STA_TXUNDERR_Msk               (0x1UL << SDIO_STA_TXUNDERR_Pos)
+#define SDIO_STA_TXUNDERR                   SDIO_STA_TXUNDERR_Msk
+#define SDIO_STA_RXOVERR_Pos                (5U)
+#define SDIO_STA_RXOVERR_Msk                (0x1UL << SDIO_STA_RXOVERR_Pos)
+#define SDIO_STA_RXOVERR                    SDIO_STA_RXOVERR_Msk
+#define SDIO_STA_CMDREND_Pos                (6U)
+#define SDIO_STA_CMDREND_Msk                (0x1UL << SDIO_STA_CMDREND_Pos)
+#define SDIO_STA_CMDREND                    SDIO_STA_CMDREND_Msk
+#define SDIO_STA_CMDSENT_Pos                (7U)
+#define SDIO_STA_CMDSENT_Msk                (0x1UL << SDIO_STA_CMDSENT_Pos)
+#define SDIO_STA_CMDSENT                    SDIO_STA_CMDSENT_Msk
+#define SDIO_STA_DATAEND_Pos                (8U)
+#define SDIO_STA_DATAEND_Msk                (0x1UL << SDIO_STA_DATAEND_Pos)
+#define SDIO_STA_DATAEND                    SDIO_STA_DATAEND_Msk
+#define SDIO_STA_STBITERR_Pos               (9U)
+#define SDIO_STA_STBITERR_Msk               (0x1UL << SDIO_STA_STBITERR_Pos)
+#define SDIO_STA_STBITERR                   SDIO_STA_STBITERR_Msk
+#define SDIO_STA_DBCKEND_Pos                (10U)
+#define SDIO_STA_DBCKEND_Msk                (0x1UL << SDIO_STA_DBCKEND_Pos)
+#define SDIO_STA_DBCKEND                    SDIO_STA_DBCKEND_Msk
+#define SDIO_STA_CMDACT_Pos                 (11U)
+#define SDIO_STA_CMDACT_Msk                 (0x1UL << SDIO_STA_CMDACT_Pos)
+#define SDIO_STA_CMDACT                     SDIO_STA_CMDACT_Msk
+#define SDIO_STA_TXACT_Pos                  (12U)
+#define SDIO_STA_TXACT_Msk                  (0x1UL << SDIO_STA_TXACT_Pos)
+#define SDIO_STA_TXACT                      SDIO_STA_TXACT_Msk
+#define SDIO_STA_RXACT_Pos                  (13U)
+#define SDIO_STA_RXACT_Msk                  (0x1UL << SDIO_STA_RXACT_Pos)
+#define SDIO_STA_RXACT                      SDIO_STA_RXACT_Msk
+#define SDIO_STA_TXFIFOHE_Pos               (14U)
+#define SDIO_STA_TXFIFOHE_Msk               (0x1UL << SDIO_STA_TXFIFOHE_Pos)
+#define SDIO_STA_TXFIFOHE                   SDIO_STA_TXFIFOHE_Msk
+#define SDIO_STA_RXFIFOHF_Pos               (15U)
+#define SDIO_STA_RXFIFOHF_Msk               (0x1UL << SDIO_STA_RXFIFOHF_Pos)
+#define SDIO_STA_RXFIFOHF                   SDIO_STA_RXFIFOHF_Msk
+#define SDIO_STA_TXFIFOF_Pos                (16U)
+#define SDIO_STA_TXFIFOF_Msk                (0x1UL << SDIO_STA_TXFIFOF_Pos)
+#define SDIO_STA_TXFIFOF                    SDIO_STA_TXFIFOF_Msk
+#define SDIO_STA_RXFIFOF_Pos                (17U)
+#define SDIO_STA_RXFIFOF_Msk                (0x1UL << SDIO_STA_RXFIFOF_Pos)
+#define SDIO_STA_RXFIFOF                    SDIO_STA_RXFIFOF_Msk
+#define SDIO_STA_TXFIFOE_Pos                (18U)
+#define SDIO_STA_TXFIFOE_Msk                (0x1UL << SDIO_STA_TXFIFOE_Pos)
+#define SDIO_STA_TXFIFOE                    SDIO_STA_TXFIFOE_Msk
+#define SDIO_STA_RXFIFOE_Pos                (19U)
+#define SDIO_STA_RXFIFOE_Msk                (0x1UL << SDIO_STA_RXFIFOE_Pos)
+#define SDIO_STA_RXFIFOE                    SDIO_STA_RXFIFOE_Msk
+#define SDIO_STA_TXDAVL_Pos                 (20U)
+#define SDIO_STA_TXDAVL_Msk                 (0x1UL << SDIO_STA_TXDAVL_Pos)
+#define SDIO_STA_TXDAVL                     SDIO_STA_TXDAVL_Msk
+#define SDIO_STA_RXDAVL_Pos                 (21U)
+#define SDIO_STA_RXDAVL_Msk                 (0x1UL << SDIO_STA_RXDAVL_Pos)
+#define SDIO_STA_RXDAVL                     SDIO_STA_RXDAVL_Msk
+#define SDIO_STA_SDIOIT_Pos                 (22U)
+#define SDIO_STA_SDIOIT_Msk                 (0x1UL << SDIO_STA_SDIOIT_Pos)
+#define SDIO_STA_SDIOIT                     SDIO_STA_SDIOIT_Msk
+#define SDIO_STA_CEATAEND_Pos               (23U)
+#define SDIO_STA_CEATAEND_Msk               (0x1UL << SDIO_STA_CEATAEND_Pos)
+#define SDIO_STA_CEATAEND                   SDIO_STA_CEATAEND_Msk
+
+/* SDIO interrupt clear register (SDIO_ICR) */
+#define SDIO_ICR_CCRCFAILC_Pos              (0U)
+#define SDIO_ICR_CCRCFAILC_Msk              (0x1UL << SDIO_ICR_CCRCFAILC_Pos)
+#define SDIO_ICR_CCRCFAILC                  SDIO_ICR_CCRCFAILC_Msk
+#define SDIO_ICR_DCRCFAILC_Pos              (1U)
+#define SDIO_ICR_DCRCFAILC_Msk              (0x1UL << SDIO_ICR_DCRCFAILC_Pos)
+#define SDIO_ICR_DCRCFAILC                  SDIO_ICR_DCRCFAILC_Msk
+#define SDIO_ICR_CTIMEOUTC_Pos              (2U)
+#define SDIO_ICR_CTIMEOUTC_Msk              (0x1UL << SDIO_ICR_CTIMEOUTC_Pos)
+#define SDIO_ICR_CTIMEOUTC                  SDIO_ICR_CTIMEOUTC_Msk
+#define SDIO_ICR_DTIMEOUTC_Pos              (3U)
+#define SDIO_ICR_DTIMEOUTC_Msk              (0x1UL << SDIO_ICR_DTIMEOUTC_Pos)
+#define SDIO_ICR_DTIMEOUTC                  SDIO_ICR_DTIMEOUTC_Msk
+#define SDIO_ICR_TXUNDERRC_Pos              (4U)
+#define SDIO_ICR_TXUNDERRC_Msk              (0x1UL << SDIO_ICR_TXUNDERRC_Pos)
+#define SDIO_ICR_TXUNDERRC                  SDIO_ICR_TXUNDERRC_Msk
+#define SDIO_ICR_RXOVERRC_Pos               (5U)
+#define SDIO_ICR_RXOVERRC_Msk               (0x1UL << SDIO_ICR_RXOVERRC_Pos)
+#define SDIO_ICR_RXOVERRC                   SDIO_ICR_RXOVERRC_Msk
+#define SDIO_ICR_CMDRENDC_Pos               (6U)
+#define SDIO_ICR_CMDRENDC_Msk               (0x1UL << SDIO_ICR_CMDRENDC_Pos)
+#define SDIO_ICR_CMDRENDC                   SDIO_ICR_CMDRENDC_Msk
+#define SDIO_ICR_CMDSENTC_Pos               (7U)
+#define SDIO_ICR_CMDSENTC_Msk               (0x1UL << SDIO_ICR_CMDSENTC_Pos)
+#define SDIO_ICR_CMDSENTC                   SDIO_ICR_CMDSENTC_Msk
+#define SDIO_ICR_DATAENDC_Pos               (8U)
+#define SDIO_ICR_DATAENDC_Msk               (0x1UL << SDIO_ICR_DATAENDC_Pos)
+#define SDIO_ICR_DATAENDC                   SDIO_ICR_DATAENDC_Msk
+#define SDIO_ICR_STBITERRC_Pos              (9U)
+#define SDIO_ICR_STBITERRC_Msk              (0x1UL << SDIO_ICR_STBITERRC_Pos)
+#define SDIO_ICR_STBITERRC                  SDIO_ICR_STBITERRC_Msk
+#define SDIO_ICR_DBCKENDC_Pos               (10U)
+#define SDIO_ICR_DBCKENDC_Msk               (0x1UL << SDIO_ICR_DBCKENDC_Pos)
+#define SDIO_ICR_DBCKENDC                   SDIO_ICR_DBCKENDC_Msk
+#define SDIO_ICR_SDIOITC_Pos                (22U)
+#define SDIO_ICR_SDIOITC_Msk                (0x1UL << SDIO_ICR_SDIOITC_Pos)
+#define SDIO_ICR_SDIOITC                    SDIO_ICR_SDIOITC_Msk
+#define SDIO_ICR_CEATAENDC_Pos              (23U)
+#define SDIO_ICR_CEATAENDC_Msk              (0x1UL << SDIO_ICR_CEATAENDC_Pos)
+#define SDIO_ICR_CEATAENDC                  SDIO_ICR_CEATAENDC_Msk
+
+/* SDIO mask register (SDIO_MASK) */
+#define SDIO_MASK_CCRCFAILIE_Pos            (0U)
+#define SDIO_MASK_CCRCFAILIE_Msk            (0x1UL << SDIO_MASK_CCRCFAILIE_Pos)
+#define SDIO_MASK_CCRCFAILIE                SDIO_MASK_CCRCFAILIE_Msk
+#define SDIO_MASK_DCRCFAILIE_Pos            (1U)
+#define SDIO_MASK_DCRCFAILIE_Msk            (0x1UL << SDIO_MASK_DCRCFAILIE_Pos)
+#define SDIO_MASK_DCRCFAILIE                SDIO_MASK_DCRCFAILIE_Msk
+#define SDIO_MASK_CTIMEOUTIE_Pos            (2U)
+#define SDIO_MASK_CTIMEOUTIE_Msk            (0x1UL << SDIO_MASK_CTIMEOUTIE_Pos)
+#define SDIO_MASK_CTIMEOUTIE                SDIO_MASK_CTIMEOUTIE_Msk
+#define SDIO_MASK_DTIMEOUTIE_Pos            (3U)
+#define SDIO_MASK_DTIMEOUTIE_Msk            (0x1UL << SDIO_MASK_DTIMEOUTIE_Pos)
+#define SDIO_MASK_DTIMEOUTIE                SDIO_MASK_DTIMEOUTIE_Msk
+#define SDIO_MASK_TXUNDERRIE_Pos            (4U)
+#define SDIO_MASK_TXUNDERRIE_Msk            (0x1UL << SDIO_MASK_TXUNDERRIE_Pos)
+#define SDIO_MASK_TXUNDERRIE                SDIO_MASK_TXUNDERRIE_Msk
+#define SDIO_MASK_RXOVERRIE_Pos             (5U)
+#define SDIO_MASK_RXOVERRIE_Msk             (0x1UL << SDIO_MASK_RXOVERRIE_Pos)
+#define SDIO_MASK_RXOVERRIE                 SDIO_MASK_RXOVERRIE_Msk
+#define SDIO_MASK_CMDRENDIE_Pos             (6U)
+#define SDIO_MASK_CMDRENDIE_Msk             (0x1UL << SDIO_MASK_CMDRENDIE_Pos)
+#define SDIO_MASK_CMDRENDIE                 SDIO_MASK_CMDRENDIE_Msk
+#define SDIO_MASK_CMDSENTIE_Pos             (7U)
+#define SDIO_MASK_CMDSENTIE_Msk             (0x1UL << SDIO_MASK_CMDSENTIE_Pos)
+#define SDIO_MASK_CMDSENTIE                 SDIO_MASK_CMDSENTIE_Msk
+#define SDIO_MASK_DATAENDIE_Pos             (8U)
+#define SDIO_MASK_DATAENDIE_Msk             (0x1UL << SDIO_MASK_DATAENDIE_Pos)
+#define SDIO_MASK_DATAENDIE                 SDIO_MASK_DATAENDIE_Msk
+#define SDIO_MASK_STBITERRIE_Pos            (9U)
+#define SDIO_MASK_STBITERRIE_Msk            (0x1UL << SDIO_MASK_STBITERRIE_Pos)
+#define SDIO_MASK_STBITERRIE                SDIO_MASK_STBITERRIE_Msk
+#define SDIO_MASK_DBCKENDIE_Pos             (10U)
+#define SDIO_MASK_DBCKENDIE_Msk             (0x1UL << SDIO_MASK_DBCKENDIE_Pos)
+#define SDIO_MASK_DBCKENDIE                 SDIO_MASK_DBCKENDIE_Msk
+#define SDIO_MASK_CMDACTIE_Pos              (11U)
+#define SDIO_MASK_CMDACTIE_Msk              (0x1UL << SDIO_MASK_CMDACTIE_Pos)
+#define SDIO_MASK_CMDACTIE                  SDIO_MASK_CMDACTIE_Msk
+#define SDIO_MASK_TXACTIE_Pos               (12U)
+#define SDIO_MASK_TXACTIE_Msk               (0x1UL << SDIO_MASK_TXACTIE_Pos)
+#define SDIO_MASK_TXACTIE                   SDIO_MASK_TXACTIE_Msk
+#define SDIO_MASK_RXACTIE_Pos               (13U)
+#define SDIO_MASK_RXACTIE_Msk               (0x1UL << SDIO_MASK_RXACTIE_Pos)
+#define SDIO_MASK_RXACTIE                   SDIO_MASK_RXACTIE_Msk
+#define SDIO_MASK_TXFIFOHEIE_Pos            (14U)
+#define SDIO_MASK_TXFIFOHEIE_Msk            (0x1UL << SDIO_MASK_TXFIFOHEIE_Pos)
+#define SDIO_MASK_TXFIFOHEIE                SDIO_MASK_TXFIFOHEIE_Msk
+#define SDIO_MASK_RXFIFOHFIE_Pos            (15U)
+#define SDIO_MASK_RXFIFOHFIE_Msk            (0x1UL << SDIO_MASK_RXFIFOHFIE_Pos)
+#define SDIO_MASK_RXFIFOHFIE                SDIO_MASK_RXFIFOHFIE_Msk
+#define SDIO_MASK_TXFIFOFIE_Pos             (16U)
+#define SDIO_MASK_TXFIFOFIE_Msk             (0x1UL << SDIO_MASK_TXFIFOFIE_Pos)
+#define SDIO_MASK_TXFIFOFIE                 SDIO_MASK_TXFIFOFIE_Msk
+#define SDIO_MASK_RXFIFOFIE_Pos             (17U)
+#define SDIO_MASK_RXFIFOFIE_Msk             (0x1UL << SDIO_MASK_RXFIFOFIE_Pos)
+#define SDIO_MASK_RXFIFOFIE                 SDIO_MASK_RXFIFOFIE_Msk
+#define SDIO_MASK_TXFIFOEIE_Pos             (18U)
+#define SDIO_MASK_TXFIFOEIE_Msk             (0x1UL << SDIO_MASK_TXFIFOEIE_Pos)
+#define SDIO_MASK_TXFIFOEIE                 SDIO_MASK_TXFIFOEIE_Msk
+#define SDIO_MASK_RXFIFOEIE_Pos             (19U)
+#define SDIO_MASK_RXFIFOEIE_Msk             (0x1UL << SDIO_MASK_RXFIFOEIE_Pos)
+#define SDIO_MASK_RXFIFOEIE                 SDIO_MASK_RXFIFOEIE_Msk
+#define SDIO_MASK_TXDAVLIE_Pos              (20U)
+#define SDIO_MASK_TXDAVLIE_Msk              (0x1UL << SDIO_MASK_TXDAVLIE_Pos)
+#define SDIO_MASK_TXDAVLIE                  SDIO_MASK_TXDAVLIE_Msk
+#define SDIO_MASK_RXDAVLIE_Pos              (21U)
+#define SDIO_MASK_RXDAVLIE_Msk              (0x1UL << SDIO_MASK_RXDAVLIE_Pos)
+#define SDIO_MASK_RXDAVLIE                  SDIO_MASK_RXDAVLIE_Msk
+#define SDIO_MASK_SDIOITIE_Pos              (22U)
+#define SDIO_MASK_SDIOITIE_Msk              (0x1UL << SDIO_MASK_SDIOITIE_Pos)
+#define SDIO_MASK_SDIOITIE                  SDIO_MASK_SDIOITIE_Msk
+#define SDIO_MASK_CEATAENDIE_Pos            (23U)
+#define SDIO_MASK_CEATAENDIE_Msk            (0x1UL << SDIO_MASK_CEATAENDIE_Pos)
+#define SDIO_MASK_CEATAENDIE                SDIO_MASK_CEATAENDIE_Msk
+
+#define SDIO_ICR_STATIC                     (0x00C007FFUL)  /*< All clearable flags >*/
+
+/*****************************************************************/
+/*                      FLASH peripheral					     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* FLASH access control register (FLASH_ACR) */
+#define FLASH_ACR_LATENCY_Pos               (0U)
+#define FLASH_ACR_LATENCY_Msk               (0x7UL << FLASH_ACR_LATENCY_Pos)
+#define FLASH_ACR_LATENCY                   FLASH_ACR_LATENCY_Msk
+#define FLASH_ACR_PRFTEN_Pos                (8U)
+#define FLASH_ACR_PRFTEN_Msk                (0x1UL << FLASH_ACR_PRFTEN_Pos)
+#define FLASH_ACR_PRFTEN                    FLASH_ACR_PRFTEN_Msk
+#define FLASH_ACR_ICEN_Pos                  (9U)
+#define FLASH_ACR_ICEN_Msk                  (0x1UL << FLASH_ACR_ICEN_Pos)
+#define FLASH_ACR_ICEN                      FLASH_ACR_ICEN_Msk
+#define FLASH_ACR_DCEN_Pos                  (10U)
+#define FLASH_ACR_DCEN_Msk                  (0x1UL << FLASH_ACR_DCEN_Pos)
+#define FLASH_ACR_DCEN                      FLASH_ACR_DCEN_Msk
+#define FLASH_ACR_ICRST_Pos                 (11U)
+#define FLASH_ACR_ICRST_Msk                 (0x1UL << FLASH_ACR_ICRST_Pos)
+#define FLASH_ACR_ICRST                     FLASH_ACR_ICRST_Msk
+#define FLASH_ACR_DCRST_Pos                 (12U)
+#define FLASH_ACR_DCRST_Msk                 (0x1UL << FLASH_ACR_DCRST_Pos)
+#define FLASH_ACR_DCRST                     FLASH_ACR_DCRST_Msk
+
+/* FLASH status register (FLASH_SR) */
+#define FLASH_SR_EOP_Pos                    (0U)
+#define FLASH_SR_EOP_Msk                    (0x1UL << FLASH_SR_EOP_Pos)
+#define FLASH_SR_EOP                        FLASH_SR_EOP_Msk
+#define FLASH_SR_OPERR_Pos                    (1U)
+#define FLASH_SR_OPERR_Msk                    (0x1UL << FLASH_SR_OPERR_Pos)
+#define FLASH_SR_OPERR                        FLASH_SR_OPERR_Msk
+#define FLASH_SR_WRPERR_Pos                 (4U)
+#define FLASH_SR_WRPERR_Msk                 (0x1UL << FLASH_SR_WRPERR_Pos)
+#define FLASH_SR_WRPERR                     FLASH_SR_WRPERR_Msk
+#define FLASH_SR_PGAERR_Pos                 (5U)
+#define FLASH_SR_PGAERR_Msk                 (0x1UL << FLASH_SR_PGAERR_Pos)
+#define FLASH_SR_PGAERR                     FLASH_SR_PGAERR_Msk
+#define FLASH_SR_PGPERR_Pos                 (6U)
+#define FLASH_SR_PGPERR_Msk                 (0x1UL << FLASH_SR_PGPERR_Pos)
+#define FLASH_SR_PGPERR                     FLASH_SR_PGPERR_Msk
+#define FLASH_SR_PGSERR_Pos                 (7U)
+#define FLASH_SR_PGSERR_Msk                 (0x1UL << FLASH_SR_PGSERR_Pos)
+#define FLASH_SR_PGSERR                     FLASH_SR_PGSERR_Msk
+#define FLASH_SR_BSY_Pos                    (16U)
+#define FLASH_SR_BSY_Msk                    (0x1UL << FLASH_SR_BSY_Pos)
+#define FLASH_SR_BSY                        FLASH_SR_BSY_Msk
+
+/* FLASH control register (FLASH_CR) */
+#define FLASH_CR_PG_Pos                     (0U)
+#define FLASH_CR_PG_Msk                     (0x1UL << FLASH_CR_PG_Pos)
+#define FLASH_CR_PG                         FLASH_CR_PG_Msk
+#define FLASH_CR_SER_Pos                    (1U)
+#define FLASH_CR_SER_Msk                    (0x1UL << FLASH_CR_SER_Pos)
+#define FLASH_CR_SER                        FLASH_CR_SER_Msk
+#define FLASH_CR_MER_Pos                    (2U)
+#define FLASH_CR_MER_Msk                    (0x1UL << FLASH_CR_MER_Pos)
+#define FLASH_CR_MER                        FLASH_CR_MER_Msk
+#define FLASH_CR_SNB_Pos                    (3U)
+#define FLASH_CR_SNB_Msk                    (0xFUL << FLASH_CR_SNB_Pos)
+#define FLASH_CR_SNB                        FLASH_CR_SNB_Msk
+#define FLASH_CR_PSIZE_Pos                  (8U)
+#define FLASH_CR_PSIZE_Msk                  (0x3UL << FLASH_CR_PSIZE_Pos)
+#define FLASH_CR_PSIZE                      FLASH_CR_PSIZE_Msk
+#define FLASH_CR_STRT_Pos                   (16U)
+#define FLASH_CR_STRT_Msk                   (0x1UL << FLASH_CR_STRT_Pos)
+#define FLASH_CR_STRT                       FLASH_CR_STRT_Msk
+#define FLASH_CR_EOPIE_Pos                  (24U)
+#define FLASH_CR_EOPIE_Msk                  (0x1UL << FLASH_CR_EOPIE_Pos)
+#define FLASH_CR_EOPIE                      FLASH_CR_EOPIE_Msk
+#define FLASH_CR_ERRIE_Pos                  (25U)
+#define FLASH_CR_ERRIE_Msk                  (0x1UL << FLASH_CR_ERRIE_Pos)
+#define FLASH_CR_ERRIE                      FLASH_CR_ERRIE_Msk
+#define FLASH_CR_LOCK_Pos                   (31U)
+#define FLASH_CR_LOCK_Msk                   (0x1UL << FLASH_CR_LOCK_Pos)
+#define FLASH_CR_LOCK                       FLASH_CR_LOCK_Msk
+
+/* FLASH option control register (FLASH_OPTCR) */
+#define FLASH_OPTCR_OPTLOCK_Pos             (0U)
+#define FLASH_OPTCR_OPTLOCK_Msk             (0x1UL << FLASH_OPTCR_OPTLOCK_Pos)
+#define FLASH_OPTCR_OPTLOCK                 FLASH_OPTCR_OPTLOCK_Msk
+#define FLASH_OPTCR_OPTSTRT_Pos             (1U)
+#define FLASH_OPTCR_OPTSTRT_Msk             (0x1UL << FLASH_OPTCR_OPTSTRT_Pos)
+#define FLASH_OPTCR_OPTSTRT                 FLASH_OPTCR_OPTSTRT_Msk
+#define FLASH_OPTCR_BOR_LEV_Pos             (2U)
+#define FLASH_OPTCR_BOR_LEV_Msk             (0x3UL << FLASH_OPTCR_BOR_LEV_Pos)
+#define FLASH_OPTCR_BOR_LEV                 FLASH_OPTCR_BOR_LEV_Msk
+#define FLASH_OPTCR_RDP_Pos                 (8U)
+#define FLASH_OPTCR_RDP_Msk                 (0xFFUL << FLASH_OPTCR_RDP_Pos)
+#define FLASH_OPTCR_RDP                     FLASH_OPTCR_RDP_Msk
+#define FLASH_OPTCR_nWRP_Pos                (16U)
+#define FLASH_OPTCR_nWRP_Msk                (0xFFFUL << FLASH_OPTCR_nWRP_Pos)
+#define FLASH_OPTCR_nWRP                    FLASH_OPTCR_nWRP_Msk
+
+#define FLASH_SR_STATIC                     (0x000000F3UL)  /*< All write-1-to-clear flags >*/
+
+/*****************************************************************/
+/*                      PWR peripheral					     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* PWR power control register (PWR_CR) */
+#define PWR_CR_LPDS_Pos                     (0U)
+#define PWR_CR_LPDS_Msk                     (0x1UL << PWR_CR_LPDS_Pos)
+#define PWR_CR_LPDS                         PWR_CR_LPDS_Msk
+#define PWR_CR_PDDS_Pos                     (1U)
+#define PWR_CR_PDDS_Msk                     (0x1UL << PWR_CR_PDDS_Pos)
+#define PWR_CR_PDDS                         PWR_CR_PDDS_Msk
+#define PWR_CR_CWUF_Pos                     (2U)
+#define PWR_CR_CWUF_Msk                     (0x1UL << PWR_CR_CWUF_Pos)
+#define PWR_CR_CWUF                         PWR_CR_CWUF_Msk
+#define PWR_CR_CSBF_Pos                     (3U)
+#define PWR_CR_CSBF_Msk                     (0x1UL << PWR_CR_CSBF_Pos)
+#define PWR_CR_CSBF                         PWR_CR_CSBF_Msk
+#define PWR_CR_PVDE_Pos                     (4U)
+#define PWR_CR_PVDE_Msk                     (0x1UL << PWR_CR_PVDE_Pos)
+#define PWR_CR_PVDE                         PWR_CR_PVDE_Msk
+#define PWR_CR_PLS_Pos                      (5U)
+#define PWR_CR_PLS_Msk                      (0x7UL << PWR_CR_PLS_Pos)
+#define PWR_CR_PLS                          PWR_CR_PLS_Msk
+#define PWR_CR_DBP_Pos                      (8U)
+#define PWR_CR_DBP_Msk                      (0x1UL << PWR_CR_DBP_Pos)
+#define PWR_CR_DBP                          PWR_CR_DBP_Msk
+#define PWR_CR_FPDS_Pos                     (9U)
+#define PWR_CR_FPDS_Msk                     (0x1UL << PWR_CR_FPDS_Pos)
+#define PWR_CR_FPDS                         PWR_CR_FPDS_Msk
+#define PWR_CR_VOS_Pos                      (14U)
+#define PWR_CR_VOS_Msk                      (0x1UL << PWR_CR_VOS_Pos)
+#define PWR_CR_VOS                          PWR_CR_VOS_Msk
+
+/* PWR power control/status register (PWR_CSR) */
+#define PWR_CSR_WUF_Pos                     (0U)
+#define PWR_CSR_WUF_Msk                     (0x1UL << PWR_CSR_WUF_Pos)
+#define PWR_CSR_WUF                         PWR_CSR_WUF_Msk
+#define PWR_CSR_SBF_Pos                     (1U)
+#define PWR_CSR_SBF_Msk                     (0x1UL << PWR_CSR_SBF_Pos)
+#define PWR_CSR_SBF                         PWR_CSR_SBF_Msk
+#define PWR_CSR_PVDO_Pos                    (2U)
+#define PWR_CSR_PVDO_Msk                    (0x1UL << PWR_CSR_PVDO_Pos)
+#define PWR_CSR_PVDO                        PWR_CSR_PVDO_Msk
+#define PWR_CSR_BRR_Pos                     (3U)
+#define PWR_CSR_BRR_Msk                     (0x1UL << PWR_CSR_BRR_Pos)
+#define PWR_CSR_BRR                         PWR_CSR_BRR_Msk
+#define PWR_CSR_EWUP_Pos                    (8U)
+#define PWR_CSR_EWUP_Msk                    (0x1UL << PWR_CSR_EWUP_Pos)
+#define PWR_CSR_EWUP                        PWR_CSR_EWUP_Msk
+#define PWR_CSR_BRE_Pos                     (9U)
+#define PWR_CSR_BRE_Msk                     (0x1UL << PWR_CSR_BRE_Pos)
+#define PWR_CSR_BRE                         PWR_CSR_BRE_Msk
+#define PWR_CSR_VOSRDY_Pos                  (14U)
+#define PWR_CSR_VOSRDY_Msk                  (0x1UL << PWR_CSR_VOSRDY_Pos)
+#define PWR_CSR_VOSRDY                      PWR_CSR_VOSRDY_Msk
+
+/*****************************************************************/
+/*                      RTC peripheral					     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* RTC time register (RTC_TR) */
+#define RTC_TR_SU_Pos                       (0U)
+#define RTC_TR_SU_Msk                       (0xFUL << RTC_TR_SU_Pos)
+#define RTC_TR_SU                           RTC_TR_SU_Msk
+#define RTC_TR_ST_Pos                       (4U)
+#define RTC_TR_ST_Msk                       (0x7UL << RTC_TR_ST_Pos)
+#define RTC_TR_ST                           RTC_TR_ST_Msk
+#define RTC_TR_MNU_Pos                      (8U)
+#define RTC_TR_MNU_Msk                      (0xFUL << RTC_TR_MNU_Pos)
+#define RTC_TR_MNU                          RTC_TR_MNU_Msk
+#define RTC_TR_MNT_Pos                      (12U)
+#define RTC_TR_MNT_Msk                      (0x7UL << RTC_TR_MNT_Pos)
+#define RTC_TR_MNT                          RTC_TR_MNT_Msk
+#define RTC_TR_HU_Pos                       (16U)
+#define RTC_TR_HU_Msk                       (0xFUL << RTC_TR_HU_Pos)
+#define RTC_TR_HU                           RTC_TR_HU_Msk
+#define RTC_TR_HT_Pos                       (20U)
+#define RTC_TR_HT_Msk                       (0x3UL << RTC_TR_HT_Pos)
+#define RTC_TR_HT                           RTC_TR_HT_Msk
+#define RTC_TR_PM_Pos                       (22U)
+#define RTC_TR_PM_Msk                       (0x1UL << RTC_TR_PM_Pos)
+#define RTC_TR_PM                           RTC_TR_PM_Msk
+
+/* RTC control register (RTC_CR) */
+#define RTC_CR_WUCKSEL_Pos                  (0U)
+#define RTC_CR_WUCKSEL_Msk                  (0x7UL << RTC_CR_WUCKSEL_Pos)
+#define RTC_CR_WUCKSEL                      RTC_CR_WUCKSEL_Msk
+#define RTC_CR_TSEDGE_Pos                   (3U)
+#define RTC_CR_TSEDGE_Msk                   (0x1UL << RTC_CR_TSEDGE_Pos)
+#define RTC_CR_TSEDGE                       RTC_CR_TSEDGE_Msk
+#define RTC_CR_REFCKON_Pos                  (4U)
+#define RTC_CR_REFCKON_Msk                  (0x1UL << RTC_CR_REFCKON_Pos)
+#define RTC_CR_REFCKON                      RTC_CR_REFCKON_Msk
+#define RTC_CR_BYPSHAD_Pos                  (5U)
+#define RTC_CR_BYPSHAD_Msk                  (0x1UL << RTC_CR_BYPSHAD_Pos)
+#define RTC_CR_BYPSHAD                      RTC_CR_BYPSHAD_Msk
+#define RTC_CR_FMT_Pos                      (6U)
+#define RTC_CR_FMT_Msk                      (0x1UL << RTC_CR_FMT_Pos)
+#define RTC_CR_FMT                          RTC_CR_FMT_Msk
+#define RTC_CR_DCE_Pos                      (7U)
+#define RTC_CR_DCE_Msk                      (0x1UL << RTC_CR_DCE_Pos)
+#define RTC_CR_DCE                          RTC_CR_DCE_Msk
+#define RTC_CR_ALRAE_Pos                    (8U)
+#define RTC_CR_ALRAE_Msk                    (0x1UL << RTC_CR_ALRAE_Pos)
+#define RTC_CR_ALRAE                        RTC_CR_ALRAE_Msk
+#define RTC_CR_ALRBE_Pos                    (9U)
+#define RTC_CR_ALRBE_Msk                    (0x1UL << RTC_CR_ALRBE_Pos)
+#define RTC_CR_ALRBE                        RTC_CR_ALRBE_Msk
+#define RTC_CR_WUTE_Pos                     (10U)
+#define RTC_CR_WUTE_Msk                     (0x1UL << RTC_CR_WUTE_Pos)
+#define RTC_CR_WUTE                         RTC_CR_WUTE_Msk
+#define RTC_CR_TSE_Pos                      (11U)
+#define RTC_CR_TSE_Msk                      (0x1UL << RTC_CR_TSE_Pos)
+#define RTC_CR_TSE                          RTC_CR_TSE_Msk
+#define RTC_CR_ALRAIE_Pos                   (12U)
+#define RTC_CR_ALRAIE_Msk                   (0x1UL << RTC_CR_ALRAIE_Pos)
+#define RTC_CR_ALRAIE                       RTC_CR_ALRAIE_Msk
+#define RTC_CR_ALRBIE_Pos                   (13U)
+#define RTC_CR_ALRBIE_Msk                   (0x1UL << RTC_CR_ALRBIE_Pos)
+#define RTC_CR_ALRBIE                       RTC_CR_ALRBIE_Msk
+#define RTC_CR_WUTIE_Pos                    (14U)
+#define RTC_CR_WUTIE_Msk                    (0x1UL << RTC_CR_WUTIE_Pos)
+#define RTC_CR_WUTIE                        RTC_CR_WUTIE_Msk
+#define RTC_CR_TSIE_Pos                     (15U)
+#define RTC_CR_TSIE_Msk                     (0x1UL << RTC_CR_TSIE_Pos)
+#define RTC_CR_TSIE                         RTC_CR_TSIE_Msk
+
+/* RTC initialization and status register (RTC_ISR) */
+#define RTC_ISR_ALRAWF_Pos                  (0U)
+#define RTC_ISR_ALRAWF_Msk                  (0x1UL << RTC_ISR_ALRAWF_Pos)
+#define RTC_ISR_ALRAWF                      RTC_ISR_ALRAWF_Msk
+#define RTC_ISR_ALRBWF_Pos                  (1U)
+#define RTC_ISR_ALRBWF_Msk                  (0x1UL << RTC_ISR_ALRBWF_Pos)
+#define RTC_ISR_ALRBWF                      RTC_ISR_ALRBWF_Msk
+#define RTC_ISR_WUTWF_Pos                   (2U)
+#define RTC_ISR_WUTWF_Msk                   (0x1UL << RTC_ISR_WUTWF_Pos)
+#define RTC_ISR_WUTWF                       RTC_ISR_WUTWF_Msk
+#define RTC_ISR_SHPF_Pos                    (3U)
+#define RTC_ISR_SHPF_Msk                    (0x1UL << RTC_ISR_SHPF_Pos)
+#define RTC_ISR_SHPF                        RTC_ISR_SHPF_Msk
+#define RTC_ISR_INITS_Pos                   (4U)
+#define RTC_ISR_INITS_Msk                   (0x1UL << RTC_ISR_INITS_Pos)
+#define RTC_ISR_INITS                       RTC_ISR_INITS_Msk
+#define RTC_ISR_RSF_Pos                     (5U)
+#define RTC_ISR_RSF_Msk                     (0x1UL << RTC_ISR_RSF_Pos)
+#define RTC_ISR_RSF                         RTC_ISR_RSF_Msk
+#define RTC_ISR_INITF_Pos                   (6U)
+#define RTC_ISR_INITF_Msk                   (0x1UL << RTC_ISR_INITF_Pos)
+#define RTC_ISR_INITF                       RTC_ISR_INITF_Msk
+#define RTC_ISR_INIT_Pos                    (7U)
+#define RTC_ISR_INIT_Msk                    (0x1UL << RTC_ISR_INIT_Pos)
+#define RTC_ISR_INIT                        RTC_ISR_INIT_Msk
+#define RTC_ISR_ALRAF_Pos                   (8U)
+#define RTC_ISR_ALRAF_Msk                   (0x1UL << RTC_ISR_ALRAF_Pos)
+#define RTC_ISR_ALRAF                       RTC_ISR_ALRAF_Msk
+#define RTC_ISR_ALRBF_Pos                   (9U)
+#define RTC_ISR_ALRBF_Msk                   (0x1UL << RTC_ISR_ALRBF_Pos)
+#define RTC_ISR_ALRBF                       RTC_ISR_ALRBF_Msk
+#define RTC_ISR_WUTF_Pos                    (10U)
+#define RTC_ISR_WUTF_Msk                    (0x1UL << RTC_ISR_WUTF_Pos)
+#define RTC_ISR_WUTF                        RTC_ISR_WUTF_Msk
+#define RTC_ISR_TSF_Pos                     (11U)
+#define RTC_ISR_TSF_Msk                     (0x1UL << RTC_ISR_TSF_Pos)
+#define RTC_ISR_TSF                         RTC_ISR_TSF_Msk
+
+/* RTC prescaler register (RTC_PRER) */
+#define RTC_PRER_PREDIV_S_Pos               (0U)
+#define RTC_PRER_PREDIV_S_Msk               (0x7FFFUL << RTC_PRER_PREDIV_S_Pos)
+#define RTC_PRER_PREDIV_S                   RTC_PRER_PREDIV_S_Msk
+#define RTC_PRER_PREDIV_A_Pos               (16U)
+#define RTC_PRER_PREDIV_A_Msk               (0x7FUL << RTC_PRER_PREDIV_A_Pos)
+#define RTC_PRER_PREDIV_A                   RTC_PRER_PREDIV_A_Msk
+
+/* RTC wakeup timer register (RTC_WUTR) */
+#define RTC_WUTR_WUT_Pos                    (0U)
+#define RTC_WUTR_WUT_Msk                    (0xFFFFUL << RTC_WUTR_WUT_Pos)
+#define RTC_WUTR_WUT                        RTC_WUTR_WUT_Msk
+
+/* RTC sub second register (RTC_SSR) */
+#define RTC_SSR_SS_Pos                      (0U)
+#define RTC_SSR_SS_Msk                      (0xFFFFUL << RTC_SSR_SS_Pos)
+#define RTC_SSR_SS                          RTC_SSR_SS_Msk
+
+#define RTC_WPR_KEY1                        (0xCAUL)        /*< Write protection unlock sequence >*/
+#define RTC_WPR_KEY2                        (0x53UL)
+
+/*****************************************************************/
+/*                      FSMC peripheral					         */
+/*                      bit definition							 */
+/*****************************************************************/
+/* SRAM/NOR-Flash chip-select control registers (FSMC_BCR1 ~ 4) */
+#define FSMC_BCRx_MBKEN_Pos                 (0U)
+#define FSMC_BCRx_MBKEN_Msk                 (0x1UL << FSMC_BCRx_MBKEN_Pos)
+#define FSMC_BCRx_MBKEN                     FSMC_BCRx_MBKEN_Msk
+#define FSMC_BCRx_MUXEN_Pos                 (1U)
+#define FSMC_BCRx_MUXEN_Msk                 (0x1UL << FSMC_BCRx_MUXEN_Pos)
+#define FSMC_BCRx_MUXEN                     FSMC_BCRx_MUXEN_Msk
+#define FSMC_BCRx_MTYP_Pos                  (2U)
+#define FSMC_BCRx_MTYP_Msk                  (0x3UL << FSMC_BCRx_MTYP_Pos)
+#define FSMC_BCRx_MTYP                      FSMC_BCRx_MTYP_Msk
+#define FSMC_BCRx_MWID_Pos                  (4U)
+#define FSMC_BCRx_MWID_Msk                  (0x3UL << FSMC_BCRx_MWID_Pos)
+#define FSMC_BCRx_MWID                      FSMC_BCRx_MWID_Msk
+#define FSMC_BCRx_FACCEN_Pos                (6U)
+#define FSMC_BCRx_FACCEN_Msk                (0x1UL << FSMC_BCRx_FACCEN_Pos)
+#define FSMC_BCRx_FACCEN                    FSMC_BCRx_FACCEN_Msk
+#define FSMC_BCRx_BURSTEN_Pos               (8U)
+#define FSMC_BCRx_BURSTEN_Msk               (0x1UL << FSMC_BCRx_BURSTEN_Pos)
+#define FSMC_BCRx_BURSTEN                   FSMC_BCRx_BURSTEN_Msk
+#define FSMC_BCRx_WAITPOL_Pos               (9U)
+#define FSMC_BCRx_WAITPOL_Msk               (0x1UL << FSMC_BCRx_WAITPOL_Pos)
+#define FSMC_BCRx_WAITPOL                   FSMC_BCRx_WAITPOL_Msk
+#define FSMC_BCRx_WRAPMOD_Pos               (10U)
+#define FSMC_BCRx_WRAPMOD_Msk               (0x1UL << FSMC_BCRx_WRAPMOD_Pos)
+#define FSMC_BCRx_WRAPMOD                   FSMC_BCRx_WRAPMOD_Msk
+#define FSMC_BCRx_WAITCFG_Pos               (11U)
+#define FSMC_BCRx_WAITCFG_Msk               (0x1UL << FSMC_BCRx_WAITCFG_Pos)
+#define FSMC_BCRx_WAITCFG                   FSMC_BCRx_WAITCFG_Msk
+#define FSMC_BCRx_WREN_Pos                  (12U)
+#define FSMC_BCRx_WREN_Msk                  (0x1UL << FSMC_BCRx_WREN_Pos)
+#define FSMC_BCRx_WREN                      FSMC_BCRx_WREN_Msk
+#define FSMC_BCRx_WAITEN_Pos                (13U)
+#define FSMC_BCRx_WAITEN_Msk                (0x1UL << FSMC_BCRx_WAITEN_Pos)
+#define FSMC_BCRx_WAITEN                    FSMC_BCRx_WAITEN_Msk
+#define FSMC_BCRx_EXTMOD_Pos                (14U)
+#define FSMC_BCRx_EXTMOD_Msk                (0x1UL << FSMC_BCRx_EXTMOD_Pos)
+#define FSMC_BCRx_EXTMOD                    FSMC_BCRx_EXTMOD_Msk
+#define FSMC_BCRx_ASYNCWAIT_Pos             (15U)
+#define FSMC_BCRx_ASYNCWAIT_Msk             (0x1UL << FSMC_BCRx_ASYNCWAIT_Pos)
+#define FSMC_BCRx_ASYNCWAIT                 FSMC_BCRx_ASYNCWAIT_Msk
+#define FSMC_BCRx_CBURSTRW_Pos              (19U)
+#define FSMC_BCRx_CBURSTRW_Msk              (0x1UL << FSMC_BCRx_CBURSTRW_Pos)
+#define FSMC_BCRx_CBURSTRW                  FSMC_BCRx_CBURSTRW_Msk
+
+/* SRAM/NOR-Flash chip-select timing registers (FSMC_BTR1 ~ 4) */
+#define FSMC_BTRx_ADDSET_Pos                (0U)
+#define FSMC_BTRx_ADDSET_Msk                (0xFUL << FSMC_BTRx_ADDSET_Pos)
+#define FSMC_BTRx_ADDSET                    FSMC_BTRx_ADDSET_Msk
+#define FSMC_BTRx_ADDHLD_Pos                (4U)
+#define FSMC_BTRx_ADDHLD_Msk                (0xFUL << FSMC_BTRx_ADDHLD_Pos)
+#define FSMC_BTRx_ADDHLD                    FSMC_BTRx_ADDHLD_Msk
+#define FSMC_BTRx_DATAST_Pos                (8U)
+#define FSMC_BTRx_DATAST_Msk                (0xFFUL << FSMC_BTRx_DATAST_Pos)
+#define FSMC_BTRx_DATAST                    FSMC_BTRx_DATAST_Msk
+#define FSMC_BTRx_BUSTURN_Pos               (16U)
+#define FSMC_BTRx_BUSTURN_Msk               (0xFUL << FSMC_BTRx_BUSTURN_Pos)
+#define FSMC_BTRx_BUSTURN                   FSMC_BTRx_BUSTURN_Msk
+#define FSMC_BTRx_CLKDIV_Pos                (20U)
+#define FSMC_BTRx_CLKDIV_Msk                (0xFUL << FSMC_BTRx_CLKDIV_Pos)
+#define FSMC_BTRx_CLKDIV                    FSMC_BTRx_CLKDIV_Msk
+#define FSMC_BTRx_DATLAT_Pos                (24U)
+#define FSMC_BTRx_DATLAT_Msk                (0xFUL << FSMC_BTRx_DATLAT_Pos)
+#define FSMC_BTRx_DATLAT                    FSMC_BTRx_DATLAT_Msk
+#define FSMC_BTRx_ACCMOD_Pos                (28U)
+#define FSMC_BTRx_ACCMOD_Msk                (0x3UL << FSMC_BTRx_ACCMOD_Pos)
+#define FSMC_BTRx_ACCMOD                    FSMC_BTRx_ACCMOD_Msk
+
+/* SRAM/NOR-Flash write timing registers (FSMC_BWTR1 ~ 4) */
+#define FSMC_BWTRx_ADDSET_Pos               (0U)
+#define FSMC_BWTRx_ADDSET_Msk               (0xFUL << FSMC_BWTRx_ADDSET_Pos)
+#define FSMC_BWTRx_ADDSET                   FSMC_BWTRx_ADDSET_Msk
+#define FSMC_BWTRx_ADDHLD_Pos               (4U)
+#define FSMC_BWTRx_ADDHLD_Msk               (0xFUL << FSMC_BWTRx_ADDHLD_Pos)
+#define FSMC_BWTRx_ADDHLD                   FSMC_BWTRx_ADDHLD_Msk
+#define FSMC_BWTRx_DATAST_Pos               (8U)
+#define FSMC_BWTRx_DATAST_Msk               (0xFFUL << FSMC_BWTRx_DATAST_Pos)
+#define FSMC_BWTRx_DATAST                   FSMC_BWTRx_DATAST_Msk
+#define FSMC_BWTRx_CLKDIV_Pos               (20U)
+#define FSMC_BWTRx_CLKDIV_Msk               (0xFUL << FSMC_BWTRx_CLKDIV_Pos)
+#define FSMC_BWTRx_CLKDIV                   FSMC_BWTRx_CLKDIV_Msk
+#define FSMC_BWTRx_DATLAT_Pos               (24U)
+#define FSMC_BWTRx_DATLAT_Msk               (0xFUL << FSMC_BWTRx_DATLAT_Pos)
+#define FSMC_BWTRx_DATLAT                   FSMC_BWTRx_DATLAT_Msk
+#define FSMC_BWTRx_ACCMOD_Pos               (28U)
+#define FSMC_BWTRx_ACCMOD_Msk               (0x3UL << FSMC_BWTRx_ACCMOD_Pos)
+#define FSMC_BWTRx_ACCMOD                   FSMC_BWTRx_ACCMOD_Msk
+
+/*****************************************************************/
+/*                      DBGMCU peripheral					     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* Debug MCU configuration register (DBGMCU_CR) */
+#define DBGMCU_CR_DBG_SLEEP_Pos             (0U)
+#define DBGMCU_CR_DBG_SLEEP_Msk             (0x1UL << DBGMCU_CR_DBG_SLEEP_Pos)
+#define DBGMCU_CR_DBG_SLEEP                 DBGMCU_CR_DBG_SLEEP_Msk
+#define DBGMCU_CR_DBG_STOP_Pos              (1U)
+#define DBGMCU_CR_DBG_STOP_Msk              (0x1UL << DBGMCU_CR_DBG_STOP_Pos)
+#define DBGMCU_CR_DBG_STOP                  DBGMCU_CR_DBG_STOP_Msk
+#define DBGMCU_CR_DBG_STANDBY_Pos           (2U)
+#define DBGMCU_CR_DBG_STANDBY_Msk           (0x1UL << DBGMCU_CR_DBG_STANDBY_Pos)
+#define DBGMCU_CR_DBG_STANDBY               DBGMCU_CR_DBG_STANDBY_Msk
+#define DBGMCU_CR_TRACE_IOEN_Pos            (5U)
+#define DBGMCU_CR_TRACE_IOEN_Msk            (0x1UL << DBGMCU_CR_TRACE_IOEN_Pos)
+#define DBGMCU_CR_TRACE_IOEN                DBGMCU_CR_TRACE_IOEN_Msk
+#define DBGMCU_CR_TRACE_MODE_Pos            (6U)
+#define DBGMCU_CR_TRACE_MODE_Msk            (0x3UL << DBGMCU_CR_TRACE_MODE_Pos)
+#define DBGMCU_CR_TRACE_MODE                DBGMCU_CR_TRACE_MODE_Msk
+
+/*****************************************************************/
+/*                      SYSCFG peripheral					     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* SYSCFG peripheral mode configuration register (SYSCFG_PMC) */
+#define SYSCFG_PMC_MII_RMII_SEL_Pos         (23U)
+#define SYSCFG_PMC_MII_RMII_SEL_Msk         (0x1UL << SYSCFG_PMC_MII_RMII_SEL_Pos)
+#define SYSCFG_PMC_MII_RMII_SEL             SYSCFG_PMC_MII_RMII_SEL_Msk
+
+/*****************************************************************/
+/*                      ETH peripheral						     */
+/*                      bit definition							 */
+/*****************************************************************/
+/* ETH MAC configuration register (ETH_MACCR) */
+#define ETH_MACCR_RE_Pos                    (2U)
+#define ETH_MACCR_RE_Msk                    (0x1UL << ETH_MACCR_RE_Pos)
+#define ETH_MACCR_RE                        ETH_MACCR_RE_Msk
+#define ETH_MACCR_TE_Pos                    (3U)
+#define ETH_MACCR_TE_Msk                    (0x1UL << ETH_MACCR_TE_Pos)
+#define ETH_MACCR_TE                        ETH_MACCR_TE_Msk
+#define ETH_MACCR_DC_Pos                    (4U)
+#define ETH_MACCR_DC_Msk                    (0x1UL << ETH_MACCR_DC_Pos)
+#define ETH_MACCR_DC                        ETH_MACCR_DC_Msk
+#define ETH_MACCR_BL_Pos                    (5U)
+#define ETH_MACCR_BL_Msk                    (0x3UL << ETH_MACCR_BL_Pos)
+#define ETH_MACCR_BL                        ETH_MACCR_BL_Msk
+#define ETH_MACCR_APCS_Pos                  (7U)
+#define ETH_MACCR_APCS_Msk                  (0x1UL << ETH_MACCR_APCS_Pos)
+#define ETH_MACCR_APCS                      ETH_MACCR_APCS_Msk
+#define ETH_MACCR_RD_Pos                    (9U)
+#define ETH_MACCR_RD_Msk                    (0x1UL << ETH_MACCR_RD_Pos)
+#define ETH_MACCR_RD                        ETH_MACCR_RD_Msk
+#define ETH_MACCR_IPCO_Pos                  (10U)
+#define ETH_MACCR_IPCO_Msk                  (0x1UL << ETH_MACCR_IPCO_Pos)
+#define ETH_MACCR_IPCO                      ETH_MACCR_IPCO_Msk
+#define ETH_MACCR_DM_Pos                    (11U)
+#define ETH_MACCR_DM_Msk                    (0x1UL << ETH_MACCR_DM_Pos)
+#define ETH_MACCR_DM                        ETH_MACCR_DM_Msk
+#define ETH_MACCR_LM_Pos                    (12U)
+#define ETH_MACCR_LM_Msk                    (0x1UL << ETH_MACCR_LM_Pos)
+#define ETH_MACCR_LM                        ETH_MACCR_LM_Msk
+#define ETH_MACCR_ROD_Pos                   (13U)
+#define ETH_MACCR_ROD_Msk                   (0x1UL << ETH_MACCR_ROD_Pos)
+#define ETH_MACCR_ROD                       ETH_MACCR_ROD_Msk
+#define ETH_MACCR_FES_Pos                   (14U)
+#define ETH_MACCR_FES_Msk                   (0x1UL << ETH_MACCR_FES_Pos)
+#define ETH_MACCR_FES                       ETH_MACCR_FES_Msk
+#define ETH_MACCR_CSD_Pos                   (16U)
+#define ETH_MACCR_CSD_Msk                   (0x1UL << ETH_MACCR_CSD_Pos)
+#define ETH_MACCR_CSD                       ETH_MACCR_CSD_Msk
+#define ETH_MACCR_IFG_Pos                   (17U)
+#define ETH_MACCR_IFG_Msk                   (0x7UL << ETH_MACCR_IFG_Pos)
+#define ETH_MACCR_IFG                       ETH_MACCR_IFG_Msk
+#define ETH_MACCR_JD_Pos                    (22U)
+#define ETH_MACCR_JD_Msk                    (0x1UL << ETH_MACCR_JD_Pos)
+#define ETH_MACCR_JD                        ETH_MACCR_JD_Msk
+#define ETH_MACCR_WD_Pos                    (23U)
+#define ETH_MACCR_WD_Msk                    (0x1UL << ETH_MACCR_WD_Pos)
+#define ETH_MACCR_WD                        ETH_MACCR_WD_Msk
+#define ETH_MACCR_CSTF_Pos                  (25U)
+#define ETH_MACCR_CSTF_Msk                  (0x1UL << ETH_MACCR_CSTF_Pos)
+#define ETH_MACCR_CSTF                      ETH_MACCR_CSTF_Msk
+
+/* ETH MAC frame filter register (ETH_MACFFR) */
+#define ETH_MACFFR_PM_Pos                   (0U)
+#define ETH_MACFFR_PM_Msk                   (0x1UL << ETH_MACFFR_PM_Pos)
+#define ETH_MACFFR_PM                       ETH_MACFFR_PM_Msk
+#define ETH_MACFFR_HU_Pos                   (1U)
+#define ETH_MACFFR_HU_Msk                   (0x1UL << ETH_MACFFR_HU_Pos)
+#define ETH_MACFFR_HU                       ETH_MACFFR_HU_Msk
+#define ETH_MACFFR_HM_Pos                   (2U)
+#define ETH_MACFFR_HM_Msk                   (0x1UL << ETH_MACFFR_HM_Pos)
+#define ETH_MACFFR_HM                       ETH_MACFFR_HM_Msk
+#define ETH_MACFFR_DAIF_Pos                 (3U)
+#define ETH_MACFFR_DAIF_Msk                 (0x1UL << ETH_MACFFR_DAIF_Pos)
+#define ETH_MACFFR_DAIF                     ETH_MACFFR_DAIF_Msk
+#define ETH_MACFFR_PAM_Pos                  (4U)
+#define ETH_MACFFR_PAM_Msk                  (0x1UL << ETH_MACFFR_PAM_Pos)
+#define ETH_MACFFR_PAM                      ETH_MACFFR_PAM_Msk
+#define ETH_MACFFR_BFD_Pos                  (5U)
+#define ETH_MACFFR_BFD_Msk                  (0x1UL << ETH_MACFFR_BFD_Pos)
+#define ETH_MACFFR_BFD                      ETH_MACFFR_BFD_Msk
+#define ETH_MACFFR_PCF_Pos                  (6U)
+#define ETH_MACFFR_PCF_Msk                  (0x3UL << ETH_MACFFR_PCF_Pos)
+#define ETH_MACFFR_PCF                      ETH_MACFFR_PCF_Msk
+#define ETH_MACFFR_SAIF_Pos                 (8U)
+#define ETH_MACFFR_SAIF_Msk                 (0x1UL << ETH_MACFFR_SAIF_Pos)
+#define ETH_MACFFR_SAIF                     ETH_MACFFR_SAIF_Msk
+#define ETH_MACFFR_SAF_Pos                  (9U)
+#define ETH_MACFFR_SAF_Msk                  (0x1UL << ETH_MACFFR_SAF_Pos)
+#define ETH_MACFFR_SAF                      ETH_MACFFR_SAF_Msk
+#define ETH_MACFFR_HPF_Pos                  (10U)
+#define ETH_MACFFR_HPF_Msk                  (0x1UL << ETH_MACFFR_HPF_Pos)
+#define ETH_MACFFR_HPF                      ETH_MACFFR_HPF_Msk
+#define ETH_MACFFR_RA_Pos                   (31U)
+#define ETH_MACFFR_RA_Msk                   (0x1UL << ETH_MACFFR_RA_Pos)
+#define ETH_MACFFR_RA                       ETH_MACFFR_RA_Msk
+
+/* ETH MAC MII address register (ETH_MACMIIAR) */
+#define ETH_MACMIIAR_MB_Pos                 (0U)
+#define ETH_MACMIIAR_MB_Msk                 (0x1UL << ETH_MACMIIAR_MB_Pos)
+#define ETH_MACMIIAR_MB                     ETH_MACMIIAR_MB_Msk
+#define ETH_MACMIIAR_MW_Pos                 (1U)
+#define ETH_MACMIIAR_MW_Msk                 (0x1UL << ETH_MACMIIAR_MW_Pos)
+#define ETH_MACMIIAR_MW                     ETH_MACMIIAR_MW_Msk
+#define ETH_MACMIIAR_CR_Pos                 (2U)
+#define ETH_MACMIIAR_CR_Msk                 (0x7UL << ETH_MACMIIAR_CR_Pos)
+#define ETH_MACMIIAR_CR                     ETH_MACMIIAR_CR_Msk
+#define ETH_MACMIIAR_MR_Pos                 (6U)
+#define ETH_MACMIIAR_MR_Msk                 (0x1FUL << ETH_MACMIIAR_MR_Pos)
+#define ETH_MACMIIAR_MR                     ETH_MACMIIAR_MR_Msk
+#define ETH_MACMIIAR_PA_Pos                 (11U)
+#define ETH_MACMIIAR_PA_Msk                 (0x1FUL << ETH_MACMIIAR_PA_Pos)
+#define ETH_MACMIIAR_PA                     ETH_MACMIIAR_PA_Msk
+
+/* ETH MAC MII data register (ETH_MACMIIDR) */
+#define ETH_MACMIIDR_MD_Pos                 (0U)
+#define ETH_MACMIIDR_MD_Msk                 (0xFFFFUL << ETH_MACMIIDR_MD_Pos)
+#define ETH_MACMIIDR_MD                     ETH_MACMIIDR_MD_Msk
+
+/* ETH MAC interrupt mask register (ETH_MACIMR) */
+#define ETH_MACIMR_PMTIM_Pos                (3U)
+#define ETH_MACIMR_PMTIM_Msk                (0x1UL << ETH_MACIMR_PMTIM_Pos)
+#define ETH_MACIMR_PMTIM                    ETH_MACIMR_PMTIM_Msk
+#define ETH_MACIMR_TSTIM_Pos                (9U)
+#define ETH_MACIMR_TSTIM_Msk                (0x1UL << ETH_MACIMR_TSTIM_Pos)
+#define ETH_MACIMR_TSTIM                    ETH_MACIMR_TSTIM_Msk
+
+/* ETH MAC address 0 high register (ETH_MACA0HR) */
+#define ETH_MACA0HR_MACA0H_Pos              (0U)
+#define ETH_MACA0HR_MACA0H_Msk              (0xFFFFUL << ETH_MACA0HR_MACA0H_Pos)
+#define ETH_MACA0HR_MACA0H                  ETH_MACA0HR_MACA0H_Msk
+
+/* ETH MMC control register (ETH_MMCCR) */
+#define ETH_MMCCR_CR_Pos                    (0U)
+#define ETH_MMCCR_CR_Msk                    (0x1UL << ETH_MMCCR_CR_Pos)
+#define ETH_MMCCR_CR                        ETH_MMCCR_CR_Msk
+#define ETH_MMCCR_CSR_Pos                   (1U)
+#define ETH_MMCCR_CSR_Msk                   (0x1UL << ETH_MMCCR_CSR_Pos)
+#define ETH_MMCCR_CSR                       ETH_MMCCR_CSR_Msk
+#define ETH_MMCCR_ROR_Pos                   (2U)
+#define ETH_MMCCR_ROR_Msk                   (0x1UL << ETH_MMCCR_ROR_Pos)
+#define ETH_MMCCR_ROR                       ETH_MMCCR_ROR_Msk
+#define ETH_MMCCR_MCF_Pos                   (3U)
+#define ETH_MMCCR_MCF_Msk                   (0x1UL << ETH_MMCCR_MCF_Pos)
+#define ETH_MMCCR_MCF                       ETH_MMCCR_MCF_Msk
+
+/* ETH MMC receive interrupt mask register (ETH_MMCRIMR) */
+#define ETH_MMCRIMR_RFCEM_Pos               (5U)
+#define ETH_MMCRIMR_RFCEM_Msk               (0x1UL << ETH_MMCRIMR_RFCEM_Pos)
+#define ETH_MMCRIMR_RFCEM                   ETH_MMCRIMR_RFCEM_Msk
+#define ETH_MMCRIMR_RFAEM_Pos               (6U)
+#define ETH_MMCRIMR_RFAEM_Msk               (0x1UL << ETH_MMCRIMR_RFAEM_Pos)
+#define ETH_MMCRIMR_RFAEM                   ETH_MMCRIMR_RFAEM_Msk
+#define ETH_MMCRIMR_RGUFM_Pos               (17U)
+#define ETH_MMCRIMR_RGUFM_Msk               (0x1UL << ETH_MMCRIMR_RGUFM_Pos)
+#define ETH_MMCRIMR_RGUFM                   ETH_MMCRIMR_RGUFM_Msk
+
+/* ETH MMC transmit interrupt mask register (ETH_MMCTIMR) */
+#define ETH_MMCTIMR_TGFSCM_Pos              (14U)
+#define ETH_MMCTIMR_TGFSCM_Msk              (0x1UL << ETH_MMCTIMR_TGFSCM_Pos)
+#define ETH_MMCTIMR_TGFSCM                  ETH_MMCTIMR_TGFSCM_Msk
+#define ETH_MMCTIMR_TGFMSCM_Pos             (15U)
+#define ETH_MMCTIMR_TGFMSCM_Msk             (0x1UL << ETH_MMCTIMR_TGFMSCM_Pos)
+#define ETH_MMCTIMR_TGFMSCM                 ETH_MMCTIMR_TGFMSCM_Msk
+#define ETH_MMCTIMR_TGFM_Pos                (21U)
+#define ETH_MMCTIMR_TGFM_Msk                (0x1UL << ETH_MMCTIMR_TGFM_Pos)
+#define ETH_MMCTIMR_TGFM                    ETH_MMCTIMR_TGFM_Msk
+
+/* ETH DMA bus mode register (ETH_DMABMR) */
+#define ETH_DMABMR_SR_Pos                   (0U)
+#define ETH_DMABMR_SR_Msk                   (0x1UL << ETH_DMABMR_SR_Pos)
+#define ETH_DMABMR_SR                       ETH_DMABMR_SR_Msk
+#define ETH_DMABMR_DA_Pos                   (1U)
+#define ETH_DMABMR_DA_Msk                   (0x1UL << ETH_DMABMR_DA_Pos)
+#define ETH_DMABMR_DA                       ETH_DMABMR_DA_Msk
+#define ETH_DMABMR_DSL_Pos                  (2U)
+#define ETH_DMABMR_DSL_Msk                  (0x1FUL << ETH_DMABMR_DSL_Pos)
+#define ETH_DMABMR_DSL                      ETH_DMABMR_DSL_Msk
+#define ETH_DMABMR_EDFE_Pos                 (7U)
+#define ETH_DMABMR_EDFE_Msk                 (0x1UL << ETH_DMABMR_EDFE_Pos)
+#define ETH_DMABMR_EDFE                     ETH_DMABMR_EDFE_Msk
+#define ETH_DMABMR_PBL_Pos                  (8U)
+#define ETH_DMABMR_PBL_Msk                  (0x3FUL << ETH_DMABMR_PBL_Pos)
+#define ETH_DMABMR_PBL                      ETH_DMABMR_PBL_Msk
+#define ETH_DMABMR_RTPR_Pos                 (14U)
+#define ETH_DMABMR_RTPR_Msk                 (0x3UL << ETH_DMABMR_RTPR_Pos)
+#define ETH_DMABMR_RTPR                     ETH_DMABMR_RTPR_Msk
+#define ETH_DMABMR_FB_Pos                   (16U)
+#define ETH_DMABMR_FB_Msk                   (0x1UL << ETH_DMABMR_FB_Pos)
+#define ETH_DMABMR_FB                       ETH_DMABMR_FB_Msk
+#define ETH_DMABMR_RDP_Pos                  (17U)
+#define ETH_DMABMR_RDP_Msk                  (0x3FUL << ETH_DMABMR_RDP_Pos)
+#define ETH_DMABMR_RDP                      ETH_DMABMR_RDP_Msk
+#define ETH_DMABMR_USP_Pos                  (23U)
+#define ETH_DMABMR_USP_Msk                  (0x1UL << ETH_DMABMR_USP_Pos)
+#define ETH_DMABMR_USP                      ETH_DMABMR_USP_Msk
+#define ETH_DMABMR_FPM_Pos                  (24U)
+#define ETH_DMABMR_FPM_Msk                  (0x1UL << ETH_DMABMR_FPM_Pos)
+#define ETH_DMABMR_FPM                      ETH_DMABMR_FPM_Msk
+#define ETH_DMABMR_AAB_Pos                  (25U)
+#define ETH_DMABMR_AAB_Msk                  (0x1UL << ETH_DMABMR_AAB_Pos)
+#define ETH_DMABMR_AAB                      ETH_DMABMR_AAB_Msk
+#define ETH_DMABMR_MB_Pos                   (26U)
+#define ETH_DMABMR_MB_Msk                   (0x1UL << ETH_DMABMR_MB_Pos)
+#define ETH_DMABMR_MB                       ETH_DMABMR_MB_Msk
+
+/* ETH DMA status register (ETH_DMASR) */
+#define ETH_DMASR_TS_Pos                    (0U)
+#define ETH_DMASR_TS_Msk                    (0x1UL << ETH_DMASR_TS_Pos)
+#define ETH_DMASR_TS                        ETH_DMASR_TS_Msk
+#define ETH_DMASR_TPSS_Pos                  (1U)
+#define ETH_DMASR_TPSS_Msk                  (0x1UL << ETH_DMASR_TPSS_Pos)
+#define ETH_DMASR_TPSS                      ETH_DMASR_TPSS_Msk
+#define ETH_DMASR_TBUS_Pos                  (2U)
+#define ETH_DMASR_TBUS_Msk                  (0x1UL << ETH_DMASR_TBUS_Pos)
+#define ETH_DMASR_TBUS                      ETH_DMASR_TBUS_Msk
+#define ETH_DMASR_TJTS_Pos                  (3U)
+#define ETH_DMASR_TJTS_Msk                  (0x1UL << ETH_DMASR_TJTS_Pos)
+#define ETH_DMASR_TJTS                      ETH_DMASR_TJTS_Msk
+#define ETH_DMASR_ROS_Pos                   (4U)
+#define ETH_DMASR_ROS_Msk                   (0x1UL << ETH_DMASR_ROS_Pos)
+#define ETH_DMASR_ROS                       ETH_DMASR_ROS_Msk
+#define ETH_DMASR_TUS_Pos                   (5U)
+#define ETH_DMASR_TUS_Msk                   (0x1UL << ETH_DMASR_TUS_Pos)
+#define ETH_DMASR_TUS                       ETH_DMASR_TUS_Msk
+#define ETH_DMASR_RS_Pos                    (6U)
+#define ETH_DMASR_RS_Msk                    (0x1UL << ETH_DMASR_RS_Pos)
+#define ETH_DMASR_RS                        ETH_DMASR_RS_Msk
+#define ETH_DMASR_RBUS_Pos                  (7U)
+#define ETH_DMASR_RBUS_Msk                  (0x1UL << ETH_DMASR_RBUS_Pos)
+#define ETH_DMASR_RBUS                      ETH_DMASR_RBUS_Msk
+#define ETH_DMASR_RPSS_Pos                  (8U)
+#define ETH_DMASR_RPSS_Msk                  (0x1UL << ETH_DMASR_RPSS_Pos)
+#define ETH_DMASR_RPSS                      ETH_DMASR_RPSS_Msk
+#define ETH_DMASR_RWTS_Pos                  (9U)
+#define ETH_DMASR_RWTS_Msk                  (0x1UL << ETH_DMASR_RWTS_Pos)
+#define ETH_DMASR_RWTS                      ETH_DMASR_RWTS_Msk
+#define ETH_DMASR_ETS_Pos                   (10U)
+#define ETH_DMASR_ETS_Msk                   (0x1UL << ETH_DMASR_ETS_Pos)
+#define ETH_DMASR_ETS                       ETH_DMASR_ETS_Msk
+#define ETH_DMASR_FBES_Pos                  (13U)
+#define ETH_DMASR_FBES_Msk                  (0x1UL << ETH_DMASR_FBES_Pos)
+#define ETH_DMASR_FBES                      ETH_DMASR_FBES_Msk
+#define ETH_DMASR_ERS_Pos                   (14U)
+#define ETH_DMASR_ERS_Msk                   (0x1UL << ETH_DMASR_ERS_Pos)
+#define ETH_DMASR_ERS                       ETH_DMASR_ERS_Msk
+#define ETH_DMASR_AIS_Pos                   (15U)
+#define ETH_DMASR_AIS_Msk                   (0x1UL << ETH_DMASR_AIS_Pos)
+#define ETH_DMASR_AIS                       ETH_DMASR_AIS_Msk
+#define ETH_DMASR_NIS_Pos                   (16U)
+#define ETH_DMASR_NIS_Msk                   (0x1UL << ETH_DMASR_NIS_Pos)
+#define ETH_DMASR_NIS                       ETH_DMASR_NIS_Msk
+#define ETH_DMASR_RPS_Pos                   (17U)
+#define ETH_DMASR_RPS_Msk                   (0x7UL << ETH_DMASR_RPS_Pos)
+#define ETH_DMASR_RPS                       ETH_DMASR_RPS_Msk
+#define ETH_DMASR_TPS_Pos                   (20U)
+#define ETH_DMASR_TPS_Msk                   (0x7UL << ETH_DMASR_TPS_Pos)
+#define ETH_DMASR_TPS                       ETH_DMASR_TPS_Msk
+#define ETH_DMASR_EBS_Pos                   (23U)
+#define ETH_DMASR_EBS_Msk                   (0x7UL << ETH_DMASR_EBS_Pos)
+#define ETH_DMASR_EBS                       ETH_DMASR_EBS_Msk
+#define ETH_DMASR_MMCS_Pos                  (27U)
+#define ETH_DMASR_MMCS_Msk                  (0x1UL << ETH_DMASR_MMCS_Pos)
+#define ETH_DMASR_MMCS                      ETH_DMASR_MMCS_Msk
+#define ETH_DMASR_PMTS_Pos                  (28U)
+#define ETH_DMASR_PMTS_Msk                  (0x1UL << ETH_DMASR_PMTS_Pos)
+#define ETH_DMASR_PMTS                      ETH_DMASR_PMTS_Msk
+#define ETH_DMASR_TSTS_Pos                  (29U)
+#define ETH_DMASR_TSTS_Msk                  (0x1UL << ETH_DMASR_TSTS_Pos)
+#define ETH_DMASR_TSTS                      ETH_DMASR_TSTS_Msk
+
+/* ETH DMA operation mode register (ETH_DMAOMR) */
+#define ETH_DMAOMR_SR_Pos                   (1U)
+#define ETH_DMAOMR_SR_Msk                   (0x1UL << ETH_DMAOMR_SR_Pos)
+#define ETH_DMAOMR_SR                       ETH_DMAOMR_SR_Msk
+#define ETH_DMAOMR_OSF_Pos                  (2U)
+#define ETH_DMAOMR_OSF_Msk                  (0x1UL << ETH_DMAOMR_OSF_Pos)
+#define ETH_DMAOMR_OSF                      ETH_DMAOMR_OSF_Msk
+#define ETH_DMAOMR_RTC_Pos                  (3U)
+#define ETH_DMAOMR_RTC_Msk                  (0x3UL << ETH_DMAOMR_RTC_Pos)
+#define ETH_DMAOMR_RTC                      ETH_DMAOMR_RTC_Msk
+#define ETH_DMAOMR_FUGF_Pos                 (6U)
+#define ETH_DMAOMR_FUGF_Msk                 (0x1UL << ETH_DMAOMR_FUGF_Pos)
+#define ETH_DMAOMR_FUGF                     ETH_DMAOMR_FUGF_Msk
+#define ETH_DMAOMR_FEF_Pos                  (7U)
+#define ETH_DMAOMR_FEF_Msk                  (0x1UL << ETH_DMAOMR_FEF_Pos)
+#define ETH_DMAOMR_FEF                      ETH_DMAOMR_FEF_Msk
+#define ETH_DMAOMR_ST_Pos                   (13U)
+#define ETH_DMAOMR_ST_Msk                   (0x1UL << ETH_DMAOMR_ST_Pos)
+#define ETH_DMAOMR_ST                       ETH_DMAOMR_ST_Msk
+#define ETH_DMAOMR_TTC_Pos                  (14U)
+#define ETH_DMAOMR_TTC_Msk                  (0x7UL << ETH_DMAOMR_TTC_Pos)
+#define ETH_DMAOMR_TTC                      ETH_DMAOMR_TTC_Msk
+#define ETH_DMAOMR_FTF_Pos                  (20U)
+#define ETH_DMAOMR_FTF_Msk                  (0x1UL << ETH_DMAOMR_FTF_Pos)
+#define ETH_DMAOMR_FTF                      ETH_DMAOMR_FTF_Msk
+#define ETH_DMAOMR_TSF_Pos                  (21U)
+#define ETH_DMAOMR_TSF_Msk                  (0x1UL << ETH_DMAOMR_TSF_Pos)
+#define ETH_DMAOMR_TSF                      ETH_DMAOMR_TSF_Msk
+#define ETH_DMAOMR_DFRF_Pos                 (24U)
+#define ETH_DMAOMR_DFRF_Msk                 (0x1UL << ETH_DMAOMR_DFRF_Pos)
+#define ETH_DMAOMR_DFRF                     ETH_DMAOMR_DFRF_Msk
+#define ETH_DMAOMR_RSF_Pos                  (25U)
+#define ETH_DMAOMR_RSF_Msk                  (0x1UL << ETH_DMAOMR_RSF_Pos)
+#define ETH_DMAOMR_RSF                      ETH_DMAOMR_RSF_Msk
+#define ETH_DMAOMR_DTCEFD_Pos               (26U)
+#define ETH_DMAOMR_DTCEFD_Msk               (0x1UL << ETH_DMAOMR_DTCEFD_Pos)
+#define ETH_DMAOMR_DTCEFD                   ETH_DMAOMR_DTCEFD_Msk
+
+/* ETH DMA interrupt enable register (ETH_DMAIER) */
+#define ETH_DMAIER_TIE_Pos                  (0U)
+#define ETH_DMAIER_TIE_Msk                  (0x1UL << ETH_DMAIER_TIE_Pos)
+#define ETH_DMAIER_TIE                      ETH_DMAIER_TIE_Msk
+#define ETH_DMAIER_TPSIE_Pos                (1U)
+#define ETH_DMAIER_TPSIE_Msk                (0x1UL << ETH_DMAIER_TPSIE_Pos)
+#define ETH_DMAIER_TPSIE                    ETH_DMAIER_TPSIE_Msk
+#define ETH_DMAIER_TBUIE_Pos                (2U)
+#define ETH_DMAIER_TBUIE_Msk                (0x1UL << ETH_DMAIER_TBUIE_Pos)
+#define ETH_DMAIER_TBUIE                    ETH_DMAIER_TBUIE_Msk
+#define ETH_DMAIER_TJTIE_Pos                (3U)
+#define ETH_DMAIER_TJTIE_Msk                (0x1UL << ETH_DMAIER_TJTIE_Pos)
+#define ETH_DMAIER_TJTIE                    ETH_DMAIER_TJTIE_Msk
+#define ETH_DMAIER_ROIE_Pos                 (4U)
+#define ETH_DMAIER_ROIE_Msk                 (0x1UL << ETH_DMAIER_ROIE_Pos)
+#define ETH_DMAIER_ROIE                     ETH_DMAIER_ROIE_Msk
+#define ETH_DMAIER_TUIE_Pos                 (5U)
+#define ETH_DMAIER_TUIE_Msk                 (0x1UL << ETH_DMAIER_TUIE_Pos)
+#define ETH_DMAIER_TUIE                     ETH_DMAIER_TUIE_Msk
+#define ETH_DMAIER_RIE_Pos                  (6U)
+#define ETH_DMAIER_RIE_Msk                  (0x1UL << ETH_DMAIER_RIE_Pos)
+#define ETH_DMAIER_RIE                      ETH_DMAIER_RIE_Msk
+#define ETH_DMAIER_RBUIE_Pos                (7U)
+#define ETH_DMAIER_RBUIE_Msk                (0x1UL << ETH_DMAIER_RBUIE_Pos)
+#define ETH_DMAIER_RBUIE                    ETH_DMAIER_RBUIE_Msk
+#define ETH_DMAIER_RPSIE_Pos                (8U)
+#define ETH_DMAIER_RPSIE_Msk                (0x1UL << ETH_DMAIER_RPSIE_Pos)
+#define ETH_DMAIER_RPSIE                    ETH_DMAIER_RPSIE_Msk
+#define ETH_DMAIER_RWTIE_Pos                (9U)
+#define ETH_DMAIER_RWTIE_Msk                (0x1UL << ETH_DMAIER_RWTIE_Pos)
+#define ETH_DMAIER_RWTIE                    ETH_DMAIER_RWTIE_Msk
+#define ETH_DMAIER_ETIE_Pos                 (10U)
+#define ETH_DMAIER_ETIE_Msk                 (0x1UL << ETH_DMAIER_ETIE_Pos)
+#define ETH_DMAIER_ETIE                     ETH_DMAIER_ETIE_Msk
+#define ETH_DMAIER_FBEIE_Pos                (13U)
+#define ETH_DMAIER_FBEIE_Msk                (0x1UL << ETH_DMAIER_FBEIE_Pos)
+#define ETH_DMAIER_FBEIE                    ETH_DMAIER_FBEIE_Msk
+#define ETH_DMAIER_ERIE_Pos                 (14U)
+#define ETH_DMAIER_ERIE_Msk                 (0x1UL << ETH_DMAIER_ERIE_Pos)
+#define ETH_DMAIER_ERIE                     ETH_DMAIER_ERIE_Msk
+#define ETH_DMAIER_AISE_Pos                 (15U)
+#define ETH_DMAIER_AISE_Msk                 (0x1UL << ETH_DMAIER_AISE_Pos)
+#define ETH_DMAIER_AISE                     ETH_DMAIER_AISE_Msk
+#define ETH_DMAIER_NISE_Pos                 (16U)
+#define ETH_DMAIER_NISE_Msk                 (0x1UL << ETH_DMAIER_NISE_Pos)
+#define ETH_DMAIER_NISE                     ETH_DMAIER_NISE_Msk
+
+/* ETH DMA missed frame and buffer overflow counter register (ETH_DMAMFBOCR) */
+#define ETH_DMAMFBOCR_MFC_Pos               (0U)
+#define ETH_DMAMFBOCR_MFC_Msk               (0xFFFFUL << ETH_DMAMFBOCR_MFC_Pos)
+#define ETH_DMAMFBOCR_MFC                   ETH_DMAMFBOCR_MFC_Msk
+#define ETH_DMAMFBOCR_OMFC_Pos              (16U)
+#define ETH_DMAMFBOCR_OMFC_Msk              (0x1UL << ETH_DMAMFBOCR_OMFC_Pos)
+#define ETH_DMAMFBOCR_OMFC                  ETH_DMAMFBOCR_OMFC_Msk
+#define ETH_DMAMFBOCR_MFA_Pos               (17U)
+#define ETH_DMAMFBOCR_MFA_Msk               (0x7FFUL << ETH_DMAMFBOCR_MFA_Pos)
+#define ETH_DMAMFBOCR_MFA                   ETH_DMAMFBOCR_MFA_Msk
+#define ETH_DMAMFBOCR_OFOC_Pos              (28U)
+#define ETH_DMAMFBOCR_OFOC_Msk              (0x1UL << ETH_DMAMFBOCR_OFOC_Pos)
+#define ETH_DMAMFBOCR_OFOC                  ETH_DMAMFBOCR_OFOC_Msk
+
+/* ETH DMA receive status watchdog timer register (ETH_DMARSWTR) */
+#define ETH_DMARSWTR_RSWTC_Pos              (0U)
+#define ETH_DMARSWTR_RSWTC_Msk              (0xFFUL << ETH_DMARSWTR_RSWTC_Pos)
+#define ETH_DMARSWTR_RSWTC                  ETH_DMARSWTR_RSWTC_Msk
+
+#define ETH_DMASR_STATIC                    (0x0001E7FFUL)  /*< All write-1-to-clear flags >*/
+
+
 /*****************************************************************/
 /*                      Useful Macros							 */
 /*****************************************************************/
@@ -670,4 +3370,53 @@ typedef struct
                                         ((INSTANCE) == GPIOI))
 
 
-#endif // _STM32F407XX_H_
+/**
+ * @brief: check TIM instance
+ */
+#define IS_TIM_INSTANCE(INSTANCE)           (((INSTANCE) == TIM1)  || ((INSTANCE) == TIM2)  || \
+                                             ((INSTANCE) == TIM3)  || ((INSTANCE) == TIM4)  || \
+                                             ((INSTANCE) == TIM5)  || ((INSTANCE) == TIM6)  || \
+                                             ((INSTANCE) == TIM7)  || ((INSTANCE) == TIM8)  || \
+                                             ((INSTANCE) == TIM9)  || ((INSTANCE) == TIM10) || \
+                                             ((INSTANCE) == TIM11) || ((INSTANCE) == TIM12) || \
+                                             ((INSTANCE) == TIM13) || ((INSTANCE) == TIM14))
+#define IS_TIM_ADVANCED_INSTANCE(INSTANCE)  (((INSTANCE) == TIM1) || ((INSTANCE) == TIM8))
+#define IS_TIM_32B_COUNTER_INSTANCE(INSTANCE) (((INSTANCE) == TIM2) || ((INSTANCE) == TIM5))
+#define IS_TIM_DMABURST_INSTANCE(INSTANCE)  (((INSTANCE) == TIM1) || ((INSTANCE) == TIM2) || \
+                                             ((INSTANCE) == TIM3) || ((INSTANCE) == TIM4) || \
+                                             ((INSTANCE) == TIM5) || ((INSTANCE) == TIM8))
+#define IS_TIM_APB2_INSTANCE(INSTANCE)      (((INSTANCE) == TIM1) || ((INSTANCE) == TIM8) || \
+                                             ((INSTANCE) == TIM9) || ((INSTANCE) == TIM10) || ((INSTANCE) == TIM11))
+
+/**
+ * @brief: check DMA stream instance
+ */
+#define IS_DMA_STREAM_ALL_INSTANCE(INSTANCE) ((((uint32_t)(INSTANCE) >= DMA1_Stream0_BASE) && ((uint32_t)(INSTANCE) <= DMA1_Stream7_BASE)) || \
+                                              (((uint32_t)(INSTANCE) >= DMA2_Stream0_BASE) && ((uint32_t)(INSTANCE) <= DMA2_Stream7_BASE)))
+
+
+/**
+ * @brief: check ADC instance
+ */
+#define IS_ADC_ALL_INSTANCE(INSTANCE)       (((INSTANCE) == ADC1) || ((INSTANCE) == ADC2) || ((INSTANCE) == ADC3))
+
+
+/**
+ * @brief: check CAN instance
+ */
+#define IS_CAN_ALL_INSTANCE(INSTANCE)       (((INSTANCE) == CAN1) || ((INSTANCE) == CAN2))
+
+
+/**
+ * @brief: check SDIO instance
+ */
+#define IS_SDIO_ALL_INSTANCE(INSTANCE)      ((INSTANCE) == SDIO)
+
+
+/**
+ * @brief: check ETH instance
+ */
+#define IS_ETH_ALL_INSTANCE(INSTANCE)       ((INSTANCE) == ETH)
+
+
+#endif // _STM32F407XX_H_
\ No newline at end of file
@@ -33,8 +33,18 @@ typedef enum {
 #define CLEAR_BIT(REG, BIT)     ((REG) &= ~(BIT))
 #define READ_BIT(REG, BIT)      ((REG) & (BIT))
 /* Register operation */
-#define CLEAR_REG(REG)          ((REG) &= (0x0))
-#define WRITE_REG(REG, VAL)     ((REG) & (VAL))
+#define CLEAR_REG(REG)          WRITE_REG((REG), 0x0U)  /* plain store, no read needed */
+/* A write-only register (__WO_uint32_t) is stored through its member, anything else directly */
+#define WRITE_REG(REG, VAL)     (*_Generic(&(REG), __WO_uint32_t *: &((__WO_uint32_t *)&(REG))->Value, \
+                                                   default: &(REG)) = (VAL))
+#define READ_REG(REG)           ((REG))
+/**
+ * @brief   Read-modify-write with a single read and a single write of the register.
+ * @note    Several field updates of the same register should be merged into one CLEARMASK/SETMASK pair
+ *          (see _VAL2FLD) instead of calling SET_BIT/CLEAR_BIT once per field, each of them is a
+ *          separate volatile RMW the compiler is not allowed to combine.
+ */
+#define MODIFY_REG(REG, CLEARMASK, SETMASK)  WRITE_REG((REG), (((READ_REG(REG)) & (~(CLEARMASK))) | (SETMASK)))
 
 
 
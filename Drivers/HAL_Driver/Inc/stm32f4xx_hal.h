@@ -7,6 +7,16 @@
 #include "stm32f4xx_hal_gpio.h"
 #include "stm32f4xx_hal_rcc.h"
 #include "stm32f4xx_hal_cortex.h"
+#include "stm32f4xx_hal_dma.h"
+#include "stm32f4xx_hal_tim.h"
+#include "stm32f4xx_hal_adc.h"
+#include "stm32f4xx_hal_dac.h"
+#include "stm32f4xx_hal_can.h"
+#include "stm32f4xx_hal_sd.h"
+#include "stm32f4xx_hal_fsmc.h"
+#include "stm32f4xx_hal_eth.h"
+#include "stm32f4xx_hal_flash.h"
+#include "stm32f4xx_hal_pwr.h"
 
 /* Initialization & Configuration functions */
 HAL_StatusTypeDef HAL_Init(void);
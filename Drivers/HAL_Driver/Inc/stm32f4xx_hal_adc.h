@@ -0,0 +1,379 @@
+#ifndef _STM32F4XX_HAL_ADC_H_
+#define _STM32F4XX_HAL_ADC_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal_def.h"
+#include "stm32f4xx_hal_dma.h"
+
+/**
+ * @brief   ADC1/ADC2/ADC3
+ * @note    ADCCLK = PCLK2 / ClockPrescaler, 36 MHz max. A 12-bit conversion takes
+ *          sampling time + 12 ADCCLK, i.e. 15 cycles (2.4 MSPS) with 3-cycle sampling.
+ *          Triple interleaved mode (ADC_TRIPLEMODE_INTERL, DMA mode 2, 5-cycle delay)
+ *          staggers the three ADCs on one channel for 7.2 MSPS.
+ *
+ *          Multi-ADC modes: every ADC is set up with HAL_ADC_Init() and its own
+ *          channels, ADC1 (master) gets the trigger, then HAL_ADCEx_MultiModeConfigChannel()
+ *          and HAL_ADCEx_MultiModeStart_DMA() on ADC1 move the data of all ADCs through
+ *          the common data register with ADC1's DMA stream (DMA2 stream 0 or 4, channel 0).
+ *
+ *          Circular DMA gives double buffering: ConvHalfCplt reports the first half of the
+ *          buffer while the second one is written and ConvCplt the second half.
+ *          HAL_ADCEx_MultiBufferStart_DMA() streams into two separate buffers instead
+ *          (DMA double buffer mode): ConvCplt reports buffer 0, ConvM1Cplt buffer 1.
+ */
+
+/**
+ * @brief: Regular group / common configuration
+ */
+typedef struct
+{
+    uint32_t ClockPrescaler;        /*< Common to all ADCs. See @ref ADC_ClockPrescaler >*/
+    uint32_t Resolution;            /*< See @ref ADC_Resolution >*/
+    uint32_t DataAlign;             /*< ADC_DATAALIGN_RIGHT / LEFT >*/
+    uint32_t ScanConvMode;          /*< ENABLE: convert the NbrOfConversion ranks, DISABLE: rank 1 only >*/
+    uint32_t EOCSelection;          /*< ADC_EOC_SEQ_CONV / ADC_EOC_SINGLE_CONV >*/
+    uint32_t ContinuousConvMode;    /*< ENABLE: restart the sequence when done >*/
+    uint32_t NbrOfConversion;       /*< Regular sequence length, 1 ~ 16 >*/
+    uint32_t DiscontinuousConvMode; /*< ENABLE: NbrOfDiscConversion ranks per trigger >*/
+    uint32_t NbrOfDiscConversion;   /*< 1 ~ 8 >*/
+    uint32_t ExternalTrigConv;      /*< See @ref ADC_External_trigger_Regular, ADC_SOFTWARE_START >*/
+    uint32_t ExternalTrigConvEdge;  /*< See @ref ADC_External_trigger_edge >*/
+    uint32_t DMAContinuousRequests; /*< ENABLE: keep issuing DMA requests (circular buffers) >*/
+} ADC_InitTypeDef;
+
+/**
+ * @brief: Regular channel configuration
+ */
+typedef struct
+{
+    uint32_t Channel;               /*< ADC_CHANNEL_0 ~ ADC_CHANNEL_18 >*/
+    uint32_t Rank;                  /*< Position in the regular sequence, 1 ~ 16 >*/
+    uint32_t SamplingTime;          /*< See @ref ADC_Sampling_Time >*/
+} ADC_ChannelConfTypeDef;
+
+/**
+ * @brief: Injected channel configuration
+ */
+typedef struct
+{
+    uint32_t InjectedChannel;       /*< ADC_CHANNEL_0 ~ ADC_CHANNEL_18 >*/
+    uint32_t InjectedRank;          /*< 1 ~ 4 >*/
+    uint32_t InjectedSamplingTime;  /*< See @ref ADC_Sampling_Time >*/
+    uint32_t InjectedOffset;        /*< Subtracted from the result, 0x000 ~ 0xFFF >*/
+    uint32_t InjectedNbrOfConversion; /*< Injected sequence length, 1 ~ 4 >*/
+    uint32_t AutoInjectedConv;      /*< ENABLE: injected group follows every regular group >*/
+    uint32_t ExternalTrigInjecConv; /*< See @ref ADC_External_trigger_Injected, ADC_INJECTED_SOFTWARE_START >*/
+    uint32_t ExternalTrigInjecConvEdge; /*< See @ref ADC_External_trigger_edge >*/
+} ADC_InjectionConfTypeDef;
+
+/**
+ * @brief: Dual/triple mode configuration
+ */
+typedef struct
+{
+    uint32_t Mode;                  /*< See @ref ADC_Multi_Mode >*/
+    uint32_t DMAAccessMode;         /*< See @ref ADC_Direct_memory_access_mode_for_multi_mode >*/
+    uint32_t TwoSamplingDelay;      /*< Interleaved modes: ADC_TWOSAMPLINGDELAY_5CYCLES ~ 20CYCLES >*/
+} ADC_MultiModeTypeDef;
+
+/**
+ * @brief: Oversampling by accumulation of DMA frames
+ * @note   A frame is one pass of the conversion sequence as laid out in the DMA buffer,
+ *         in 16-bit samples: NbrOfConversion for one ADC, and every ADC's results in CDR
+ *         order in multi mode (a DMA mode 2 word holds two samples, low half first;
+ *         DMA mode 3 packs two 8-bit samples per half-word and is refused).
+ *         Ratio frames are summed per sample position and Sum >> RightShift is written
+ *         to Result; e.g. Ratio 16 and RightShift 2 gives 14-bit results.
+ */
+typedef struct
+{
+    uint32_t Ratio;                 /*< Frames per result, 0 or 1 = disabled >*/
+    uint32_t RightShift;            /*< 0 ~ 16 >*/
+    uint32_t FrameLength;           /*< Samples per frame, 1 ~ ADC_OVERSAMPLING_MAX_FRAME >*/
+    uint16_t *Result;               /*< FrameLength results >*/
+} ADC_OversamplingTypeDef;
+
+#define ADC_OVERSAMPLING_MAX_FRAME  16U
+
+/**
+ * @brief: ADC state (bit field)
+ */
+#define HAL_ADC_STATE_RESET         0x00000000U
+#define HAL_ADC_STATE_READY         0x00000001U
+#define HAL_ADC_STATE_REG_BUSY      0x00000100U     /*< Regular group running >*/
+#define HAL_ADC_STATE_INJ_BUSY      0x00001000U     /*< Injected group running >*/
+#define HAL_ADC_STATE_ERROR         0x00000010U
+
+/**
+ * @brief: ADC handle
+ */
+typedef struct __ADC_HandleTypeDef
+{
+    ADC_TypeDef                 *Instance;
+    ADC_InitTypeDef             Init;
+    DMA_HandleTypeDef           *DMA_Handle;
+    ADC_OversamplingTypeDef     Oversampling;
+    __IO uint32_t               State;          /*< See HAL_ADC_STATE_xxx >*/
+    __IO uint32_t               ErrorCode;      /*< See @ref ADC_Error_Code >*/
+
+    /* Oversampling state */
+    uint32_t                    OvsSum[ADC_OVERSAMPLING_MAX_FRAME];
+    uint32_t                    OvsFrames;      /*< Frames summed so far >*/
+    uint32_t                    OvsPos;         /*< Sample position inside the current frame >*/
+    uint16_t                    *DmaBuffer;
+    uint16_t                    *DmaBuffer1;    /*< Second buffer in double buffer mode, else NULL >*/
+    uint32_t                    DmaSamples;     /*< Buffer length in 16-bit samples >*/
+} ADC_HandleTypeDef;
+
+/*--------------------------------- Macros ---------------------------------*/
+/**
+ * @defgroup ADC_Error_Code
+ */
+#define HAL_ADC_ERROR_NONE          0x00U
+#define HAL_ADC_ERROR_INTERNAL      0x01U       /*< ADC did not start/stop >*/
+#define HAL_ADC_ERROR_OVR           0x02U       /*< Overrun, a result was lost >*/
+#define HAL_ADC_ERROR_DMA           0x04U
+#define HAL_ADC_ERROR_TIMEOUT       0x08U
+
+/**
+ * @defgroup ADC_ClockPrescaler
+ */
+#define ADC_CLOCK_SYNC_PCLK_DIV2    (0x0UL << ADC_CCR_ADCPRE_Pos)
+#define ADC_CLOCK_SYNC_PCLK_DIV4    (0x1UL << ADC_CCR_ADCPRE_Pos)
+#define ADC_CLOCK_SYNC_PCLK_DIV6    (0x2UL << ADC_CCR_ADCPRE_Pos)
+#define ADC_CLOCK_SYNC_PCLK_DIV8    (0x3UL << ADC_CCR_ADCPRE_Pos)
+
+/**
+ * @defgroup ADC_Resolution
+ */
+#define ADC_RESOLUTION_12B          (0x0UL << ADC_CR1_RES_Pos)      /*< 15 ADCCLK with 3-cycle sampling >*/
+#define ADC_RESOLUTION_10B          (0x1UL << ADC_CR1_RES_Pos)
+#define ADC_RESOLUTION_8B           (0x2UL << ADC_CR1_RES_Pos)
+#define ADC_RESOLUTION_6B           (0x3UL << ADC_CR1_RES_Pos)
+
+#define ADC_DATAALIGN_RIGHT         0x00000000U
+#define ADC_DATAALIGN_LEFT          ADC_CR2_ALIGN
+
+#define ADC_EOC_SEQ_CONV            0x00000000U     /*< EOC at the end of the sequence >*/
+#define ADC_EOC_SINGLE_CONV         ADC_CR2_EOCS    /*< EOC after each conversion (overrun detection) >*/
+
+/**
+ * @defgroup ADC_Channels
+ */
+#define ADC_CHANNEL_0               0U
+#define ADC_CHANNEL_1               1U
+#define ADC_CHANNEL_2               2U
+#define ADC_CHANNEL_3               3U
+#define ADC_CHANNEL_4               4U
+#define ADC_CHANNEL_5               5U
+#define ADC_CHANNEL_6               6U
+#define ADC_CHANNEL_7               7U
+#define ADC_CHANNEL_8               8U
+#define ADC_CHANNEL_9               9U
+#define ADC_CHANNEL_10              10U
+#define ADC_CHANNEL_11              11U
+#define ADC_CHANNEL_12              12U
+#define ADC_CHANNEL_13              13U
+#define ADC_CHANNEL_14              14U
+#define ADC_CHANNEL_15              15U
+#define ADC_CHANNEL_16              16U
+#define ADC_CHANNEL_17              17U
+#define ADC_CHANNEL_18              18U
+#define ADC_CHANNEL_TEMPSENSOR      ADC_CHANNEL_16  /*< ADC1 only >*/
+#define ADC_CHANNEL_VREFINT         ADC_CHANNEL_17  /*< ADC1 only >*/
+#define ADC_CHANNEL_VBAT            ADC_CHANNEL_18  /*< ADC1 only >*/
+
+/**
+ * @defgroup ADC_Sampling_Time
+ */
+#define ADC_SAMPLETIME_3CYCLES      0x0U
+#define ADC_SAMPLETIME_15CYCLES     0x1U
+#define ADC_SAMPLETIME_28CYCLES     0x2U
+#define ADC_SAMPLETIME_56CYCLES     0x3U
+#define ADC_SAMPLETIME_84CYCLES     0x4U
+#define ADC_SAMPLETIME_112CYCLES    0x5U
+#define ADC_SAMPLETIME_144CYCLES    0x6U
+#define ADC_SAMPLETIME_480CYCLES    0x7U
+
+/**
+ * @defgroup ADC_External_trigger_edge
+ */
+#define ADC_EXTERNALTRIGCONVEDGE_NONE           0x0U
+#define ADC_EXTERNALTRIGCONVEDGE_RISING         0x1U
+#define ADC_EXTERNALTRIGCONVEDGE_FALLING        0x2U
+#define ADC_EXTERNALTRIGCONVEDGE_RISINGFALLING  0x3U
+
+/**
+ * @defgroup ADC_External_trigger_Regular
+ */
+#define ADC_EXTERNALTRIGCONV_T1_CC1     0x00U
+#define ADC_EXTERNALTRIGCONV_T1_CC2     0x01U
+#define ADC_EXTERNALTRIGCONV_T1_CC3     0x02U
+#define ADC_EXTERNALTRIGCONV_T2_CC2     0x03U
+#define ADC_EXTERNALTRIGCONV_T2_CC3     0x04U
+#define ADC_EXTERNALTRIGCONV_T2_CC4     0x05U
+#define ADC_EXTERNALTRIGCONV_T2_TRGO    0x06U
+#define ADC_EXTERNALTRIGCONV_T3_CC1     0x07U
+#define ADC_EXTERNALTRIGCONV_T3_TRGO    0x08U
+#define ADC_EXTERNALTRIGCONV_T4_CC4     0x09U
+#define ADC_EXTERNALTRIGCONV_T5_CC1     0x0AU
+#define ADC_EXTERNALTRIGCONV_T5_CC2     0x0BU
+#define ADC_EXTERNALTRIGCONV_T5_CC3     0x0CU
+#define ADC_EXTERNALTRIGCONV_T8_CC1     0x0DU
+#define ADC_EXTERNALTRIGCONV_T8_TRGO    0x0EU
+#define ADC_EXTERNALTRIGCONV_EXT_IT11   0x0FU
+#define ADC_SOFTWARE_START              0x10U
+
+/**
+ * @defgroup ADC_External_trigger_Injected
+ */
+#define ADC_EXTERNALTRIGINJECCONV_T1_CC4    0x00U
+#define ADC_EXTERNALTRIGINJECCONV_T1_TRGO   0x01U
+#define ADC_EXTERNALTRIGINJECCONV_T2_CC1    0x02U
+#define ADC_EXTERNALTRIGINJECCONV_T2_TRGO   0x03U
+#define ADC_EXTERNALTRIGINJECCONV_T3_CC2    0x04U
+#define ADC_EXTERNALTRIGINJECCONV_T3_CC4    0x05U
+#define ADC_EXTERNALTRIGINJECCONV_T4_CC1    0x06U
+#define ADC_EXTERNALTRIGINJECCONV_T4_CC2    0x07U
+#define ADC_EXTERNALTRIGINJECCONV_T4_CC3    0x08U
+#define ADC_EXTERNALTRIGINJECCONV_T4_TRGO   0x09U
+#define ADC_EXTERNALTRIGINJECCONV_T5_CC4    0x0AU
+#define ADC_EXTERNALTRIGINJECCONV_T5_TRGO   0x0BU
+#define ADC_EXTERNALTRIGINJECCONV_T8_CC2    0x0CU
+#define ADC_EXTERNALTRIGINJECCONV_T8_CC3    0x0DU
+#define ADC_EXTERNALTRIGINJECCONV_T8_CC4    0x0EU
+#define ADC_EXTERNALTRIGINJECCONV_EXT_IT15  0x0FU
+#define ADC_INJECTED_SOFTWARE_START         0x10U
+
+#define ADC_INJECTED_RANK_1         1U
+#define ADC_INJECTED_RANK_2         2U
+#define ADC_INJECTED_RANK_3         3U
+#define ADC_INJECTED_RANK_4         4U
+
+/**
+ * @defgroup ADC_Multi_Mode
+ */
+#define ADC_MODE_INDEPENDENT                0x00U
+#define ADC_DUALMODE_REGSIMULT_INJECSIMULT  0x01U
+#define ADC_DUALMODE_REGSIMULT_ALTERTRIG    0x02U
+#define ADC_DUALMODE_INJECSIMULT            0x05U
+#define ADC_DUALMODE_REGSIMULT              0x06U
+#define ADC_DUALMODE_INTERL                 0x07U
+#define ADC_DUALMODE_ALTERTRIG              0x09U
+#define ADC_TRIPLEMODE_REGSIMULT_INJECSIMULT 0x11U
+#define ADC_TRIPLEMODE_REGSIMULT_ALTERTRIG  0x12U
+#define ADC_TRIPLEMODE_INJECSIMULT          0x15U
+#define ADC_TRIPLEMODE_REGSIMULT            0x16U
+#define ADC_TRIPLEMODE_INTERL               0x17U
+#define ADC_TRIPLEMODE_ALTERTRIG            0x19U
+
+/**
+ * @defgroup ADC_Direct_memory_access_mode_for_multi_mode
+ */
+#define ADC_DMAACCESSMODE_DISABLED  (0x0UL << ADC_CCR_DMA_Pos)
+#define ADC_DMAACCESSMODE_1         (0x1UL << ADC_CCR_DMA_Pos)  /*< One half-word per request, ADC1, ADC2, ADC3, ADC1... >*/
+#define ADC_DMAACCESSMODE_2         (0x2UL << ADC_CCR_DMA_Pos)  /*< One word per request, two 12-bit samples >*/
+#define ADC_DMAACCESSMODE_3         (0x3UL << ADC_CCR_DMA_Pos)  /*< One half-word per request, two 8-bit samples >*/
+
+#define ADC_TWOSAMPLINGDELAY_5CYCLES    (0x0UL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_6CYCLES    (0x1UL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_7CYCLES    (0x2UL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_8CYCLES    (0x3UL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_9CYCLES    (0x4UL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_10CYCLES   (0x5UL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_11CYCLES   (0x6UL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_12CYCLES   (0x7UL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_13CYCLES   (0x8UL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_14CYCLES   (0x9UL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_15CYCLES   (0xAUL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_16CYCLES   (0xBUL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_17CYCLES   (0xCUL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_18CYCLES   (0xDUL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_19CYCLES   (0xEUL << ADC_CCR_DELAY_Pos)
+#define ADC_TWOSAMPLINGDELAY_20CYCLES   (0xFUL << ADC_CCR_DELAY_Pos)
+
+/**
+ * @brief   Interrupt enable bits (ADC_CR1) and flags (ADC_SR)
+ */
+#define ADC_IT_EOC                  ADC_CR1_EOCIE
+#define ADC_IT_AWD                  ADC_CR1_AWDIE
+#define ADC_IT_JEOC                 ADC_CR1_JEOCIE
+#define ADC_IT_OVR                  ADC_CR1_OVRIE
+
+#define ADC_FLAG_AWD                ADC_SR_AWD
+#define ADC_FLAG_EOC                ADC_SR_EOC
+#define ADC_FLAG_JEOC               ADC_SR_JEOC
+#define ADC_FLAG_JSTRT              ADC_SR_JSTRT
+#define ADC_FLAG_STRT               ADC_SR_STRT
+#define ADC_FLAG_OVR                ADC_SR_OVR
+
+#define IS_ADC_CHANNEL(CHANNEL)     ((CHANNEL) <= ADC_CHANNEL_18)
+#define IS_ADC_REGULAR_RANK(RANK)   (((RANK) >= 1U) && ((RANK) <= 16U))
+#define IS_ADC_INJECTED_RANK(RANK)  (((RANK) >= 1U) && ((RANK) <= 4U))
+#define IS_ADC_SAMPLE_TIME(TIME)    ((TIME) <= ADC_SAMPLETIME_480CYCLES)
+
+#define __HAL_ADC_ENABLE(__HANDLE__)                SET_BIT((__HANDLE__)->Instance->CR2, ADC_CR2_ADON)
+#define __HAL_ADC_DISABLE(__HANDLE__)               CLEAR_BIT((__HANDLE__)->Instance->CR2, ADC_CR2_ADON)
+#define __HAL_ADC_ENABLE_IT(__HANDLE__, __IT__)     SET_BIT((__HANDLE__)->Instance->CR1, (__IT__))
+#define __HAL_ADC_DISABLE_IT(__HANDLE__, __IT__)    CLEAR_BIT((__HANDLE__)->Instance->CR1, (__IT__))
+#define __HAL_ADC_GET_FLAG(__HANDLE__, __FLAG__)    (((__HANDLE__)->Instance->SR & (__FLAG__)) == (__FLAG__))
+/* SR bits are rc_w0 */
+#define __HAL_ADC_CLEAR_FLAG(__HANDLE__, __FLAG__)  WRITE_REG((__HANDLE__)->Instance->SR, (uint32_t)~(__FLAG__))
+
+/*------------------------------ HAL_ADC APIs ----------------------------------*/
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_DeInit(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, const ADC_ChannelConfTypeDef *sConfig);
+
+/* Regular group */
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef *hadc, uint32_t Timeout);
+HAL_StatusTypeDef HAL_ADC_Start_IT(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_Stop_IT(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint16_t *pData, uint32_t Length);
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADCEx_MultiBufferStart_DMA(ADC_HandleTypeDef *hadc, uint16_t *pData0, uint16_t *pData1,
+                                                 uint32_t Length);
+uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef *hadc);
+
+/* Injected group */
+HAL_StatusTypeDef HAL_ADCEx_InjectedConfigChannel(ADC_HandleTypeDef *hadc, const ADC_InjectionConfTypeDef *sConfigInjected);
+HAL_StatusTypeDef HAL_ADCEx_InjectedStart(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADCEx_InjectedStop(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADCEx_InjectedPollForConversion(ADC_HandleTypeDef *hadc, uint32_t Timeout);
+HAL_StatusTypeDef HAL_ADCEx_InjectedStart_IT(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef HAL_ADCEx_InjectedStop_IT(ADC_HandleTypeDef *hadc);
+uint32_t HAL_ADCEx_InjectedGetValue(ADC_HandleTypeDef *hadc, uint32_t InjectedRank);
+
+/* Dual/triple modes */
+HAL_StatusTypeDef HAL_ADCEx_MultiModeConfigChannel(ADC_HandleTypeDef *hadc, const ADC_MultiModeTypeDef *multimode);
+HAL_StatusTypeDef HAL_ADCEx_MultiModeStart_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t Length);
+HAL_StatusTypeDef HAL_ADCEx_MultiModeStop_DMA(ADC_HandleTypeDef *hadc);
+uint32_t HAL_ADCEx_MultiModeGetValue(ADC_HandleTypeDef *hadc);
+
+/* Oversampling */
+HAL_StatusTypeDef HAL_ADCEx_OversamplingConfig(ADC_HandleTypeDef *hadc, const ADC_OversamplingTypeDef *sOversampling);
+
+/* IRQ handler and callbacks */
+void HAL_ADC_IRQHandler(ADC_HandleTypeDef *hadc);
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADCEx_ConvM1CpltCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADCEx_InjectedConvCpltCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADCEx_OversamplingCpltCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef *hadc);
+void HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc);
+
+uint32_t HAL_ADC_GetState(ADC_HandleTypeDef *hadc);
+uint32_t HAL_ADC_GetError(ADC_HandleTypeDef *hadc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STM32F4XX_HAL_ADC_H_
\ No newline at end of file
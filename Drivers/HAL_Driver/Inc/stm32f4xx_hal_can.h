@@ -0,0 +1,216 @@
+#ifndef _STM32F4XX_HAL_CAN_H_
+#define _STM32F4XX_HAL_CAN_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal_def.h"
+
+/**
+ * @brief   bxCAN (CAN1 / CAN2)
+ * @note    CAN2 needs the CAN1 clock as well: the filter banks live in CAN1.
+ *          CAN1 owns banks 0 ~ CAN2SB - 1 and CAN2 the rest, see
+ *          HAL_CANEx_SetSlaveStartFilterBank().
+ *
+ *          Reception: HAL_CANEx_OptimizeFilters() packs the wanted IDs/masks into the
+ *          controller's banks, so unwanted frames are dropped by hardware. Each filter
+ *          names an RX ring; the FIFO interrupt drains the hardware FIFO and routes every
+ *          frame by its filter match index into that ring. The application reads frames
+ *          in place (HAL_CAN_RxRingPeek() / HAL_CAN_RxRingRelease()).
+ *
+ *          Transmission: HAL_CAN_Transmit() queues frames in a priority queue ordered as
+ *          bus arbitration would; the three mailboxes always hold the highest priority
+ *          pending frames. A frame that outranks every mailbox aborts the lowest one,
+ *          which is queued again, so a slow low priority frame never delays an urgent one.
+ *
+ *          HAL_CAN_IRQHandler() serves the TX, RX0, RX1 and SCE vectors.
+ */
+
+/**
+ * @brief: Controller configuration
+ */
+typedef struct
+{
+    uint32_t Bitrate;               /*< bit/s, e.g. 500000 >*/
+    uint32_t SamplePoint;           /*< Per mille of the bit time, e.g. 875 >*/
+    uint32_t SyncJumpWidth;         /*< 1 ~ 4 tq, limited to TS2 >*/
+    uint32_t Mode;                  /*< See @ref CAN_Operating_Mode >*/
+    uint32_t AutoBusOff;            /*< ENABLE: leave bus-off automatically after 128 x 11 recessive bits >*/
+    uint32_t AutoWakeUp;            /*< ENABLE: leave sleep on bus activity >*/
+    uint32_t AutoRetransmission;    /*< ENABLE: retry until success (DISABLE sets NART) >*/
+    uint32_t ReceiveFifoLocked;     /*< ENABLE: keep the oldest frames when a FIFO overruns >*/
+} CAN_InitTypeDef;
+
+/**
+ * @brief: CAN frame, as queued for transmission and as stored in the RX rings
+ */
+typedef struct
+{
+    uint32_t Id;                    /*< 11-bit standard or 29-bit extended identifier >*/
+    uint8_t  IdType;                /*< CAN_ID_STD / CAN_ID_EXT >*/
+    uint8_t  Rtr;                   /*< CAN_RTR_DATA / CAN_RTR_REMOTE >*/
+    uint8_t  Dlc;                   /*< 0 ~ 8 >*/
+    uint8_t  FilterMatchIndex;      /*< RX: filter that accepted the frame >*/
+    uint16_t Timestamp;             /*< RX: bit time counter at SOF >*/
+    union {
+        uint8_t  Data[8];
+        uint32_t Word[2];           /*< Data as moved to/from TDLR/TDHR, RDLR/RDHR >*/
+    };
+} CAN_FrameTypeDef;
+
+/**
+ * @brief: Single producer (FIFO interrupt) / single consumer frame ring
+ */
+typedef struct
+{
+    CAN_FrameTypeDef            *Buffer;
+    uint32_t                    Mask;           /*< Size - 1, Size a power of 2 >*/
+    __IO uint32_t               Head;           /*< Written by the interrupt only >*/
+    __IO uint32_t               Tail;           /*< Written by the consumer only >*/
+    __IO uint32_t               Dropped;        /*< Frames lost because the ring was full >*/
+} CAN_RxRingTypeDef;
+
+/**
+ * @brief: One wanted identifier or identifier/mask pair
+ * @note   Mask bits set to 1 must match, 0 are don't care. An all-ones mask
+ *         (CAN_MASK_STD_EXACT / CAN_MASK_EXT_EXACT) with Rtr CAN_RTR_DATA or
+ *         CAN_RTR_REMOTE is an exact identifier and may go to a list bank; with
+ *         CAN_FILTER_RTR_ANY it takes a mask slot. Every bank class matches the
+ *         frame type Rtr asks for.
+ */
+typedef struct
+{
+    uint32_t Id;
+    uint32_t Mask;
+    uint32_t IdType;                /*< CAN_ID_STD / CAN_ID_EXT >*/
+    uint32_t Rtr;                   /*< CAN_RTR_DATA (0) / CAN_RTR_REMOTE / CAN_FILTER_RTR_ANY >*/
+    uint32_t Fifo;                  /*< CAN_FILTER_FIFO0 / CAN_FILTER_FIFO1 >*/
+    uint32_t Ring;                  /*< RX ring index, 0 ~ CAN_RX_RINGS_MAX - 1 >*/
+} CAN_FilterTypeDef;
+
+/**
+ * @brief: Outcome of HAL_CANEx_OptimizeFilters()
+ */
+typedef struct
+{
+    uint32_t BanksUsed;             /*< Of the controller's banks >*/
+    uint32_t BanksAvailable;
+    uint32_t Merged;                /*< Filters folded into a wider mask to fit (accept extra IDs) >*/
+} CAN_FilterReportTypeDef;
+
+/**
+ * @brief: CAN state
+ */
+typedef enum
+{
+    HAL_CAN_STATE_RESET     = 0x00U,
+    HAL_CAN_STATE_READY     = 0x01U,        /*< Initialization mode, filters and rings configurable >*/
+    HAL_CAN_STATE_LISTENING = 0x02U,        /*< On the bus >*/
+    HAL_CAN_STATE_ERROR     = 0x04U
+} HAL_CAN_StateTypeDef;
+
+#define CAN_RX_RINGS_MAX            8U
+#define CAN_FMI_MAX                 (CAN_FILTER_BANKS * 4U)     /*< Filter numbers per FIFO, 16-bit list banks >*/
+
+/**
+ * @brief: CAN handle
+ */
+typedef struct __CAN_HandleTypeDef
+{
+    CAN_TypeDef                 *Instance;
+    CAN_InitTypeDef             Init;
+    __IO HAL_CAN_StateTypeDef   State;
+    __IO uint32_t               ErrorCode;      /*< See @ref CAN_Error_Code >*/
+    __IO uint32_t               LastErrorStatus;/*< ESR at the last error interrupt >*/
+
+    /* Reception */
+    CAN_RxRingTypeDef           *RxRings[CAN_RX_RINGS_MAX];
+    uint8_t                     FmiRoute[2][CAN_FMI_MAX];   /*< Filter match index -> ring, per FIFO >*/
+    __IO uint32_t               RxUnrouted;     /*< Frames accepted by no configured filter >*/
+
+    /* Transmission */
+    CAN_FrameTypeDef            *TxQueue;       /*< Binary heap, highest priority first >*/
+    uint32_t                    TxQueueSize;
+    uint32_t                    TxQueueCount;
+    CAN_FrameTypeDef            TxMailbox[CAN_TX_MAILBOXES];    /*< Copy of the frame in each mailbox >*/
+    uint32_t                    TxMailboxBusy;  /*< Bit n: mailbox n owned by the scheduler >*/
+    uint32_t                    TxAbortPending; /*< Bit n: mailbox n abort requested for a higher priority frame >*/
+} CAN_HandleTypeDef;
+
+/*--------------------------------- Macros ---------------------------------*/
+/**
+ * @defgroup CAN_Error_Code
+ */
+#define HAL_CAN_ERROR_NONE          0x00U
+#define HAL_CAN_ERROR_EWG           0x01U       /*< Error warning (TEC/REC >= 96) >*/
+#define HAL_CAN_ERROR_EPV           0x02U       /*< Error passive (TEC/REC > 127) >*/
+#define HAL_CAN_ERROR_BOF           0x04U       /*< Bus-off >*/
+#define HAL_CAN_ERROR_RX_FOV0       0x08U       /*< FIFO 0 overrun >*/
+#define HAL_CAN_ERROR_RX_FOV1       0x10U       /*< FIFO 1 overrun >*/
+#define HAL_CAN_ERROR_TX            0x20U       /*< Transmission failed (arbitration lost or error with NART) >*/
+#define HAL_CAN_ERROR_TIMEOUT       0x40U
+#define HAL_CAN_ERROR_BITTIMING     0x80U       /*< No exact bit timing for Bitrate from PCLK1 >*/
+
+/**
+ * @defgroup CAN_Operating_Mode (BTR bits)
+ */
+#define CAN_MODE_NORMAL             0x00000000U
+#define CAN_MODE_LOOPBACK           CAN_BTR_LBKM
+#define CAN_MODE_SILENT             CAN_BTR_SILM
+#define CAN_MODE_SILENT_LOOPBACK    (CAN_BTR_LBKM | CAN_BTR_SILM)
+
+#define CAN_ID_STD                  0U
+#define CAN_ID_EXT                  1U
+#define CAN_RTR_DATA                0U
+#define CAN_RTR_REMOTE              1U
+
+#define CAN_FILTER_FIFO0            0U
+#define CAN_FILTER_FIFO1            1U
+#define CAN_FILTER_RTR_ANY          2U          /*< CAN_FilterTypeDef.Rtr: data and remote frames >*/
+
+#define CAN_MASK_STD_EXACT          0x000007FFU
+#define CAN_MASK_EXT_EXACT          0x1FFFFFFFU
+
+#define IS_CAN_STDID(ID)            ((ID) <= CAN_MASK_STD_EXACT)
+#define IS_CAN_EXTID(ID)            ((ID) <= CAN_MASK_EXT_EXACT)
+#define IS_CAN_DLC(DLC)             ((DLC) <= 8U)
+
+/*------------------------------ HAL_CAN APIs ----------------------------------*/
+HAL_StatusTypeDef HAL_CAN_Init(CAN_HandleTypeDef *hcan, CAN_FrameTypeDef *TxQueue, uint32_t TxQueueSize);
+HAL_StatusTypeDef HAL_CAN_DeInit(CAN_HandleTypeDef *hcan);
+HAL_StatusTypeDef HAL_CAN_Start(CAN_HandleTypeDef *hcan);
+HAL_StatusTypeDef HAL_CAN_Stop(CAN_HandleTypeDef *hcan);
+HAL_StatusTypeDef HAL_CAN_ComputeBitTiming(uint32_t PclkFreq, uint32_t Bitrate, uint32_t SamplePoint,
+                                           uint32_t SyncJumpWidth, uint32_t *pBtr);
+
+/* Filters */
+HAL_StatusTypeDef HAL_CANEx_SetSlaveStartFilterBank(uint32_t SlaveStartFilterBank);
+HAL_StatusTypeDef HAL_CANEx_OptimizeFilters(CAN_HandleTypeDef *hcan, const CAN_FilterTypeDef *pFilters, uint32_t Count,
+                                            CAN_FilterReportTypeDef *pReport);
+
+/* Reception */
+HAL_StatusTypeDef HAL_CAN_RxRingInit(CAN_RxRingTypeDef *Ring, CAN_FrameTypeDef *Buffer, uint32_t Size);
+HAL_StatusTypeDef HAL_CAN_AttachRxRing(CAN_HandleTypeDef *hcan, uint32_t Index, CAN_RxRingTypeDef *Ring);
+const CAN_FrameTypeDef *HAL_CAN_RxRingPeek(CAN_RxRingTypeDef *Ring);
+void HAL_CAN_RxRingRelease(CAN_RxRingTypeDef *Ring);
+uint32_t HAL_CAN_RxRingCount(const CAN_RxRingTypeDef *Ring);
+
+/* Transmission */
+HAL_StatusTypeDef HAL_CAN_Transmit(CAN_HandleTypeDef *hcan, const CAN_FrameTypeDef *pFrame);
+uint32_t HAL_CAN_GetTxPending(CAN_HandleTypeDef *hcan);
+
+/* IRQ handler and callbacks */
+void HAL_CAN_IRQHandler(CAN_HandleTypeDef *hcan);
+void HAL_CAN_RxCallback(CAN_HandleTypeDef *hcan, uint32_t RingMask);
+void HAL_CAN_TxCompleteCallback(CAN_HandleTypeDef *hcan, const CAN_FrameTypeDef *pFrame);
+void HAL_CAN_ErrorCallback(CAN_HandleTypeDef *hcan);
+
+HAL_CAN_StateTypeDef HAL_CAN_GetState(CAN_HandleTypeDef *hcan);
+uint32_t HAL_CAN_GetError(CAN_HandleTypeDef *hcan);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STM32F4XX_HAL_CAN_H_
\ No newline at end of file
@@ -5,7 +5,21 @@
  extern "C" {
 #endif
 
-
+/**
+ * @brief   System configuration
+ */
+#define TICK_INT_PRIORITY   0x0FU   /*< SysTick preempt priority (lowest) >*/
+
+/**
+ * @brief   Event trace hooks in the HAL entry points, recorded by trace.c with USE_HAL_TRACE
+ * @note    Compiled out otherwise, the arguments are not evaluated.
+ */
+#ifdef USE_HAL_TRACE
+    #include "trace.h"
+    #define HAL_TRACE(KIND, ID, ARG)    TRC_Record(TRC_INFO((KIND), (ID), (ARG)))
+#else
+    #define HAL_TRACE(KIND, ID, ARG)    ((void)0U)
+#endif
 
 
 
@@ -3,7 +3,81 @@
 
 #include "stm32f4xx_hal.h"
 
+/**
+ * @defgroup NVIC_Priority_Group
+ * @note     STM32F4 implements 4 priority bits, the group selects how many of them are preempt bits
+ */
+#define NVIC_PRIORITYGROUP_0    0x00000007U     /*< 0 bits for pre-emption priority, 4 bits for sub-priority >*/
+#define NVIC_PRIORITYGROUP_1    0x00000006U     /*< 1 bit  for pre-emption priority, 3 bits for sub-priority >*/
+#define NVIC_PRIORITYGROUP_2    0x00000005U     /*< 2 bits for pre-emption priority, 2 bits for sub-priority >*/
+#define NVIC_PRIORITYGROUP_3    0x00000004U     /*< 3 bits for pre-emption priority, 1 bit  for sub-priority >*/
+#define NVIC_PRIORITYGROUP_4    0x00000003U     /*< 4 bits for pre-emption priority, 0 bits for sub-priority >*/
+
+#define IS_NVIC_PRIORITY_GROUP(GROUP)       (((GROUP) == NVIC_PRIORITYGROUP_0) || \
+                                             ((GROUP) == NVIC_PRIORITYGROUP_1) || \
+                                             ((GROUP) == NVIC_PRIORITYGROUP_2) || \
+                                             ((GROUP) == NVIC_PRIORITYGROUP_3) || \
+                                             ((GROUP) == NVIC_PRIORITYGROUP_4))
+#define IS_NVIC_PREEMPTION_PRIORITY(PRIO)   ((PRIO) < 0x10U)
+#define IS_NVIC_SUB_PRIORITY(PRIO)          ((PRIO) < 0x10U)
+#define IS_NVIC_DEVICE_IRQ(IRQ)             ((IRQ) >= (IRQn_Type)0x00U)
+#define IS_NVIC_VECTOR_IRQ(IRQ)             (((IRQ) >= NonMaskableInt_IRQn) && ((IRQ) <= FPU_IRQn))
+
+/**
+ * @brief   Interrupt/exception handler, as stored in the vector table
+ */
+typedef void (*pNVIC_HandlerTypeDef)(void);
+
+/**
+ * @brief   NVIC APIs
+ */
+void HAL_NVIC_SetPriorityGrouping(uint32_t PriorityGroup);
+uint32_t HAL_NVIC_GetPriorityGrouping(void);
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_GetPriority(IRQn_Type IRQn, uint32_t PriorityGroup, uint32_t *pPreemptPriority, uint32_t *pSubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_SystemReset(void);
+
+uint32_t HAL_NVIC_GetPendingIRQ(IRQn_Type IRQn);
+void HAL_NVIC_SetPendingIRQ(IRQn_Type IRQn);
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+uint32_t HAL_NVIC_GetActive(IRQn_Type IRQn);
+
+HAL_StatusTypeDef HAL_NVIC_SetVector(IRQn_Type IRQn, pNVIC_HandlerTypeDef Handler, pNVIC_HandlerTypeDef *pPrevHandler);
+pNVIC_HandlerTypeDef HAL_NVIC_GetVector(IRQn_Type IRQn);
+
 uint32_t HAL_SYSTICK_Config(uint32_t TicksNumb);
 
+/**
+ * @brief   Priority-masking critical section
+ * @note    Only interrupts whose preempt priority is numerically >= PreemptPriority are masked,
+ *          more urgent ISRs (lower number) keep running. Sections can be nested, the mask
+ *          is only ever raised inside and put back by the matching exit.
+ *          PreemptPriority = 0 is not allowed (BASEPRI = 0 means "no masking"), use __disable_irq() for that.
+ *
+ *          uint32_t key = HAL_NVIC_EnterCritical(5U);
+ *          ... touch data shared with ISRs of preempt priority 5..15 ...
+ *          HAL_NVIC_ExitCritical(key);
+ */
+__STATIC_INLINE uint32_t HAL_NVIC_EnterCritical(uint32_t PreemptPriority)
+{
+    uint32_t prev = __get_BASEPRI();
+    uint32_t preempt_bits = 7UL - __NVIC_GetPriorityGrouping();
+
+    if (preempt_bits > __NVIC_PRIO_BITS) {
+        preempt_bits = __NVIC_PRIO_BITS;
+    }
+    /* Preempt field sits at the top of the implemented bits, sub-priority bits below it are left 0 */
+    __set_BASEPRI_MAX((PreemptPriority << (8U - preempt_bits)) & 0xFFUL);
+    __ISB();
+
+    return prev;
+}
+
+__STATIC_INLINE void HAL_NVIC_ExitCritical(uint32_t PrevMask)
+{
+    __set_BASEPRI(PrevMask);
+}
 
-#endif // _STM32F4XX_HAL_CORTEX_H_
\ No newline at end of file
+#endif // _STM32F4XX_HAL_CORTEX_H_
@@ -0,0 +1,209 @@
+#ifndef _STM32F4XX_HAL_DAC_H_
+#define _STM32F4XX_HAL_DAC_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal_def.h"
+#include "stm32f4xx_hal_dma.h"
+
+/**
+ * @brief   DAC channel 1 (PA4) / channel 2 (PA5)
+ * @note    Pins must be in analog mode. A conversion is triggered by TEN/TSEL: with no
+ *          trigger DHR is moved to DOR one APB1 cycle after the write, with a trigger
+ *          three cycles after the trigger edge. Settling is ~3 us with the output buffer.
+ *
+ *          Streaming: a basic timer (TIM6/TIM7, HAL_TIMEx_MasterConfigSynchronization()
+ *          with TIM_TRGO_UPDATE) clocks the samples, each trigger issues one DMA request
+ *          and the buffer is played from memory with no CPU per sample. DMA1 channel 7,
+ *          stream 5 for DAC channel 1, stream 6 for channel 2. With a circular stream the
+ *          half/full callbacks tell which half of the buffer may be refilled, e.g. with
+ *          HAL_DACEx_DDSSynthesize().
+ *
+ *          Dual mode: both channels share one trigger and one DMA stream (channel 1's)
+ *          moving 32-bit words to DHR12RD, so both outputs update on the same edge.
+ */
+
+/**
+ * @brief: Channel configuration
+ */
+typedef struct
+{
+    uint32_t Trigger;               /*< See @ref DAC_Trigger >*/
+    uint32_t OutputBuffer;          /*< DAC_OUTPUTBUFFER_ENABLE / DISABLE >*/
+} DAC_ChannelConfTypeDef;
+
+/**
+ * @brief: Direct digital synthesis state
+ * @note   The 32-bit phase accumulator wraps once per period: the output frequency is
+ *         Increment * SampleRate / 2^32, a resolution of 0.02 Hz at 100 kSPS. The phase
+ *         is kept between calls so consecutive buffer halves join without a glitch.
+ */
+typedef struct
+{
+    uint32_t Waveform;              /*< See @ref DAC_DDS_Waveform >*/
+    uint32_t Phase;                 /*< Phase accumulator, 2^32 = one period >*/
+    uint32_t Increment;             /*< Tuning word, see HAL_DACEx_DDSTuningWord() >*/
+    uint32_t Amplitude;             /*< Peak deviation from Offset, 0 ~ 2048 >*/
+    uint32_t Offset;                /*< Output at zero phase, 0 ~ 4095 >*/
+} DAC_DDSTypeDef;
+
+/**
+ * @brief: DAC state
+ */
+typedef enum
+{
+    HAL_DAC_STATE_RESET     = 0x00U,
+    HAL_DAC_STATE_READY     = 0x01U,
+    HAL_DAC_STATE_BUSY      = 0x02U,
+    HAL_DAC_STATE_ERROR     = 0x04U
+} HAL_DAC_StateTypeDef;
+
+/**
+ * @brief: DAC handle
+ */
+typedef struct __DAC_HandleTypeDef
+{
+    DAC_TypeDef                 *Instance;
+    __IO HAL_DAC_StateTypeDef   State;
+    __IO uint32_t               ErrorCode;      /*< See @ref DAC_Error_Code >*/
+    DMA_HandleTypeDef           *DMA_Handle1;   /*< Channel 1 and dual mode >*/
+    DMA_HandleTypeDef           *DMA_Handle2;   /*< Channel 2 >*/
+} DAC_HandleTypeDef;
+
+/*--------------------------------- Macros ---------------------------------*/
+/**
+ * @defgroup DAC_Error_Code
+ */
+#define HAL_DAC_ERROR_NONE          0x00U
+#define HAL_DAC_ERROR_DMAUNDERRUNCH1 0x01U      /*< Trigger came before the previous DMA transfer >*/
+#define HAL_DAC_ERROR_DMAUNDERRUNCH2 0x02U
+#define HAL_DAC_ERROR_DMA           0x04U
+
+/**
+ * @brief   Channel selection: shift of the channel fields in DAC_CR
+ */
+#define DAC_CHANNEL_1               0U
+#define DAC_CHANNEL_2               DAC_CR_CHANNEL2_SHIFT
+
+/**
+ * @defgroup DAC_Trigger (TEN1 | TSEL1, channel 1 layout)
+ */
+#define DAC_TRIGGER_NONE            0x00000000U     /*< DOR follows DHR writes >*/
+#define DAC_TRIGGER_T6_TRGO         (DAC_CR_TEN1 | (0x0UL << DAC_CR_TSEL1_Pos))
+#define DAC_TRIGGER_T8_TRGO         (DAC_CR_TEN1 | (0x1UL << DAC_CR_TSEL1_Pos))
+#define DAC_TRIGGER_T7_TRGO         (DAC_CR_TEN1 | (0x2UL << DAC_CR_TSEL1_Pos))
+#define DAC_TRIGGER_T5_TRGO         (DAC_CR_TEN1 | (0x3UL << DAC_CR_TSEL1_Pos))
+#define DAC_TRIGGER_T2_TRGO         (DAC_CR_TEN1 | (0x4UL << DAC_CR_TSEL1_Pos))
+#define DAC_TRIGGER_T4_TRGO         (DAC_CR_TEN1 | (0x5UL << DAC_CR_TSEL1_Pos))
+#define DAC_TRIGGER_EXT_IT9         (DAC_CR_TEN1 | (0x6UL << DAC_CR_TSEL1_Pos))
+#define DAC_TRIGGER_SOFTWARE        (DAC_CR_TEN1 | (0x7UL << DAC_CR_TSEL1_Pos))
+
+#define DAC_OUTPUTBUFFER_ENABLE     0x00000000U
+#define DAC_OUTPUTBUFFER_DISABLE    DAC_CR_BOFF1    /*< Rail-to-rail but needs a high impedance load >*/
+
+/**
+ * @defgroup DAC_Data_Alignment
+ * @note    Offset of the data holding register from DHR12R1 (DHR12RD for dual writes)
+ */
+#define DAC_ALIGN_12B_R             0x00000000U
+#define DAC_ALIGN_12B_L             0x00000004U
+#define DAC_ALIGN_8B_R              0x00000008U
+
+/**
+ * @defgroup DAC_Wave_Amplitude (MAMP1, channel 1 layout)
+ * @note    Triangle: peak-to-peak amplitude 2^n - 1 added to DHR.
+ *          Noise: LFSR bits [n-1:0] unmasked.
+ */
+#define DAC_TRIANGLEAMPLITUDE_1     (0x0UL << DAC_CR_MAMP1_Pos)
+#define DAC_TRIANGLEAMPLITUDE_3     (0x1UL << DAC_CR_MAMP1_Pos)
+#define DAC_TRIANGLEAMPLITUDE_7     (0x2UL << DAC_CR_MAMP1_Pos)
+#define DAC_TRIANGLEAMPLITUDE_15    (0x3UL << DAC_CR_MAMP1_Pos)
+#define DAC_TRIANGLEAMPLITUDE_31    (0x4UL << DAC_CR_MAMP1_Pos)
+#define DAC_TRIANGLEAMPLITUDE_63    (0x5UL << DAC_CR_MAMP1_Pos)
+#define DAC_TRIANGLEAMPLITUDE_127   (0x6UL << DAC_CR_MAMP1_Pos)
+#define DAC_TRIANGLEAMPLITUDE_255   (0x7UL << DAC_CR_MAMP1_Pos)
+#define DAC_TRIANGLEAMPLITUDE_511   (0x8UL << DAC_CR_MAMP1_Pos)
+#define DAC_TRIANGLEAMPLITUDE_1023  (0x9UL << DAC_CR_MAMP1_Pos)
+#define DAC_TRIANGLEAMPLITUDE_2047  (0xAUL << DAC_CR_MAMP1_Pos)
+#define DAC_TRIANGLEAMPLITUDE_4095  (0xBUL << DAC_CR_MAMP1_Pos)
+
+#define DAC_LFSRUNMASK_BIT0         (0x0UL << DAC_CR_MAMP1_Pos)
+#define DAC_LFSRUNMASK_BITS1_0      (0x1UL << DAC_CR_MAMP1_Pos)
+#define DAC_LFSRUNMASK_BITS3_0      (0x3UL << DAC_CR_MAMP1_Pos)
+#define DAC_LFSRUNMASK_BITS7_0      (0x7UL << DAC_CR_MAMP1_Pos)
+#define DAC_LFSRUNMASK_BITS11_0     (0xBUL << DAC_CR_MAMP1_Pos)
+
+#define DAC_WAVE_NONE               (0x0UL << DAC_CR_WAVE1_Pos)
+#define DAC_WAVE_NOISE              (0x1UL << DAC_CR_WAVE1_Pos)
+#define DAC_WAVE_TRIANGLE           (0x2UL << DAC_CR_WAVE1_Pos)
+
+/**
+ * @defgroup DAC_DDS_Waveform
+ */
+#define DAC_DDS_WAVE_SINE           0U
+#define DAC_DDS_WAVE_TRIANGLE       1U
+#define DAC_DDS_WAVE_SAWTOOTH       2U
+#define DAC_DDS_WAVE_SQUARE         3U
+
+#define IS_DAC_CHANNEL(CHANNEL)     (((CHANNEL) == DAC_CHANNEL_1) || ((CHANNEL) == DAC_CHANNEL_2))
+#define IS_DAC_ALIGN(ALIGN)         (((ALIGN) == DAC_ALIGN_12B_R) || ((ALIGN) == DAC_ALIGN_12B_L) || ((ALIGN) == DAC_ALIGN_8B_R))
+#define IS_DAC_TRIGGER(TRIGGER)     (((TRIGGER) & ~(DAC_CR_TEN1 | DAC_CR_TSEL1)) == 0U)
+#define IS_DAC_AMPLITUDE(AMP)       ((AMP) <= DAC_TRIANGLEAMPLITUDE_4095)
+
+#define __HAL_DAC_ENABLE(__HANDLE__, __CHANNEL__)   SET_BIT((__HANDLE__)->Instance->CR, DAC_CR_EN1 << (__CHANNEL__))
+#define __HAL_DAC_DISABLE(__HANDLE__, __CHANNEL__)  CLEAR_BIT((__HANDLE__)->Instance->CR, DAC_CR_EN1 << (__CHANNEL__))
+#define __HAL_DAC_GET_FLAG(__HANDLE__, __FLAG__)    (((__HANDLE__)->Instance->SR & (__FLAG__)) == (__FLAG__))
+/* SR bits are rc_w1 */
+#define __HAL_DAC_CLEAR_FLAG(__HANDLE__, __FLAG__)  WRITE_REG((__HANDLE__)->Instance->SR, (__FLAG__))
+
+/*------------------------------ HAL_DAC APIs ----------------------------------*/
+HAL_StatusTypeDef HAL_DAC_Init(DAC_HandleTypeDef *hdac);
+HAL_StatusTypeDef HAL_DAC_DeInit(DAC_HandleTypeDef *hdac);
+HAL_StatusTypeDef HAL_DAC_ConfigChannel(DAC_HandleTypeDef *hdac, const DAC_ChannelConfTypeDef *sConfig, uint32_t Channel);
+
+/* Single channel */
+HAL_StatusTypeDef HAL_DAC_Start(DAC_HandleTypeDef *hdac, uint32_t Channel);
+HAL_StatusTypeDef HAL_DAC_Stop(DAC_HandleTypeDef *hdac, uint32_t Channel);
+HAL_StatusTypeDef HAL_DAC_SetValue(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t Alignment, uint32_t Data);
+uint32_t HAL_DAC_GetValue(DAC_HandleTypeDef *hdac, uint32_t Channel);
+HAL_StatusTypeDef HAL_DAC_Start_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel, const uint16_t *pData, uint32_t Length, uint32_t Alignment);
+HAL_StatusTypeDef HAL_DAC_Stop_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel);
+
+/* Dual channel */
+HAL_StatusTypeDef HAL_DACEx_DualStart(DAC_HandleTypeDef *hdac);
+HAL_StatusTypeDef HAL_DACEx_DualStop(DAC_HandleTypeDef *hdac);
+HAL_StatusTypeDef HAL_DACEx_DualSetValue(DAC_HandleTypeDef *hdac, uint32_t Alignment, uint32_t Data1, uint32_t Data2);
+HAL_StatusTypeDef HAL_DACEx_DualSoftwareTrigger(DAC_HandleTypeDef *hdac);
+HAL_StatusTypeDef HAL_DACEx_DualStart_DMA(DAC_HandleTypeDef *hdac, const uint32_t *pData, uint32_t Length, uint32_t Alignment);
+HAL_StatusTypeDef HAL_DACEx_DualStop_DMA(DAC_HandleTypeDef *hdac);
+
+/* Built-in wave generation */
+HAL_StatusTypeDef HAL_DACEx_TriangleWaveGenerate(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t Amplitude);
+HAL_StatusTypeDef HAL_DACEx_NoiseWaveGenerate(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t Amplitude);
+
+/* Direct digital synthesis */
+uint32_t HAL_DACEx_DDSTuningWord(uint32_t Frequency, uint32_t SampleRate);
+void HAL_DACEx_DDSSynthesize(DAC_DDSTypeDef *dds, uint16_t *pBuffer, uint32_t Count);
+void HAL_DACEx_DDSSynthesizeDual(DAC_DDSTypeDef *dds1, DAC_DDSTypeDef *dds2, uint32_t *pBuffer, uint32_t Count);
+
+/* IRQ handler and callbacks */
+void HAL_DAC_IRQHandler(DAC_HandleTypeDef *hdac);
+void HAL_DAC_ConvCpltCallbackCh1(DAC_HandleTypeDef *hdac);
+void HAL_DAC_ConvHalfCpltCallbackCh1(DAC_HandleTypeDef *hdac);
+void HAL_DAC_ErrorCallbackCh1(DAC_HandleTypeDef *hdac);
+void HAL_DAC_DMAUnderrunCallbackCh1(DAC_HandleTypeDef *hdac);
+void HAL_DACEx_ConvCpltCallbackCh2(DAC_HandleTypeDef *hdac);
+void HAL_DACEx_ConvHalfCpltCallbackCh2(DAC_HandleTypeDef *hdac);
+void HAL_DACEx_ErrorCallbackCh2(DAC_HandleTypeDef *hdac);
+void HAL_DACEx_DMAUnderrunCallbackCh2(DAC_HandleTypeDef *hdac);
+
+HAL_DAC_StateTypeDef HAL_DAC_GetState(DAC_HandleTypeDef *hdac);
+uint32_t HAL_DAC_GetError(DAC_HandleTypeDef *hdac);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STM32F4XX_HAL_DAC_H_
\ No newline at end of file
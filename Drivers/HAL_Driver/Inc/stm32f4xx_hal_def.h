@@ -30,6 +30,15 @@ typedef enum
 #define __weak      __attribute__((weak))
 #define __NOINLINE  __attribute__((noinline))
 
+/**
+ * @brief   Link a DMA handle to a peripheral handle,
+ *          e.g. __HAL_LINKDMA(&htim1, hdma[TIM_DMA_ID_UPDATE], hdma_tim1_up) or __HAL_LINKDMA(&hadc1, DMA_Handle, hdma_adc1)
+ */
+#define __HAL_LINKDMA(__HANDLE__, __PPP_DMA_FIELD__, __DMA_HANDLE__) do { \
+                                                    (__HANDLE__)->__PPP_DMA_FIELD__ = &(__DMA_HANDLE__); \
+                                                    (__DMA_HANDLE__).Parent = (__HANDLE__); \
+                                                } while (0U)
+
 /*-------------------------------------------------------------*/
 
 
@@ -0,0 +1,172 @@
+#ifndef _STM32F4XX_HAL_DMA_H_
+#define _STM32F4XX_HAL_DMA_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal_def.h"
+
+/**
+ * @brief: DMA stream configuration structure
+ */
+typedef struct
+{
+    uint32_t Channel;               /*< Request channel of the stream.    See @ref DMA_Channel >*/
+    uint32_t Direction;             /*< Transfer direction.               See @ref DMA_Direction >*/
+    uint32_t PeriphInc;             /*< Increment peripheral address.     DMA_PINC_ENABLE/DISABLE >*/
+    uint32_t MemInc;                /*< Increment memory address.         DMA_MINC_ENABLE/DISABLE >*/
+    uint32_t PeriphDataAlignment;   /*< Peripheral data width.            See @ref DMA_Data_Alignment >*/
+    uint32_t MemDataAlignment;      /*< Memory data width.                See @ref DMA_Data_Alignment >*/
+    uint32_t Mode;                  /*< DMA_NORMAL / DMA_CIRCULAR / DMA_PFCTRL >*/
+    uint32_t Priority;              /*< See @ref DMA_Priority >*/
+    uint32_t FIFOMode;              /*< DMA_FIFOMODE_DISABLE (direct mode) / DMA_FIFOMODE_ENABLE >*/
+    uint32_t FIFOThreshold;         /*< See @ref DMA_FIFO_Threshold, used when FIFO mode is enabled >*/
+    uint32_t MemBurst;              /*< See @ref DMA_Burst, used when FIFO mode is enabled >*/
+    uint32_t PeriphBurst;           /*< See @ref DMA_Burst, used when FIFO mode is enabled >*/
+} DMA_InitTypeDef;
+
+/**
+ * @brief: DMA state
+ */
+typedef enum
+{
+    HAL_DMA_STATE_RESET     = 0x00U,
+    HAL_DMA_STATE_READY     = 0x01U,
+    HAL_DMA_STATE_BUSY      = 0x02U,
+    HAL_DMA_STATE_ERROR     = 0x03U,
+} HAL_DMA_StateTypeDef;
+
+/**
+ * @brief: DMA handle
+ * @note:  Callbacks are plain function pointers, set by the owning driver (TIM, ADC, ...) or by the user.
+ *         Parent points back to that driver's handle.
+ */
+typedef struct __DMA_HandleTypeDef
+{
+    DMA_Stream_TypeDef              *Instance;      /*< DMAx_Streamy >*/
+    DMA_InitTypeDef                 Init;
+    __IO HAL_DMA_StateTypeDef       State;
+    void                            *Parent;
+    void (*XferCpltCallback)(struct __DMA_HandleTypeDef *hdma);         /*< Transfer complete (memory 0 in double buffer mode) >*/
+    void (*XferHalfCpltCallback)(struct __DMA_HandleTypeDef *hdma);     /*< Half transfer >*/
+    void (*XferM1CpltCallback)(struct __DMA_HandleTypeDef *hdma);       /*< Memory 1 transfer complete (double buffer mode) >*/
+    void (*XferErrorCallback)(struct __DMA_HandleTypeDef *hdma);
+    __IO uint32_t                   ErrorCode;      /*< See @ref DMA_Error_Code >*/
+    DMA_TypeDef                     *StreamBaseAddress; /*< DMA1/DMA2, for the status/clear registers >*/
+    uint32_t                        StreamIndex;    /*< Flag shift of the stream inside LISR/HISR >*/
+} DMA_HandleTypeDef;
+
+/*--------------------------------- Macros ---------------------------------*/
+/**
+ * @defgroup DMA_Error_Code
+ */
+#define HAL_DMA_ERROR_NONE          0x00000000U
+#define HAL_DMA_ERROR_TE            0x00000001U     /*< Transfer error >*/
+#define HAL_DMA_ERROR_FE            0x00000002U     /*< FIFO error >*/
+#define HAL_DMA_ERROR_DME           0x00000004U     /*< Direct mode error >*/
+#define HAL_DMA_ERROR_TIMEOUT       0x00000020U
+#define HAL_DMA_ERROR_PARAM         0x00000040U
+
+/**
+ * @defgroup DMA_Channel
+ */
+#define DMA_CHANNEL_0               (0x0UL << DMA_SxCR_CHSEL_Pos)
+#define DMA_CHANNEL_1               (0x1UL << DMA_SxCR_CHSEL_Pos)
+#define DMA_CHANNEL_2               (0x2UL << DMA_SxCR_CHSEL_Pos)
+#define DMA_CHANNEL_3               (0x3UL << DMA_SxCR_CHSEL_Pos)
+#define DMA_CHANNEL_4               (0x4UL << DMA_SxCR_CHSEL_Pos)
+#define DMA_CHANNEL_5               (0x5UL << DMA_SxCR_CHSEL_Pos)
+#define DMA_CHANNEL_6               (0x6UL << DMA_SxCR_CHSEL_Pos)
+#define DMA_CHANNEL_7               (0x7UL << DMA_SxCR_CHSEL_Pos)
+
+/**
+ * @defgroup DMA_Direction
+ */
+#define DMA_PERIPH_TO_MEMORY        (0x0UL << DMA_SxCR_DIR_Pos)
+#define DMA_MEMORY_TO_PERIPH        (0x1UL << DMA_SxCR_DIR_Pos)
+#define DMA_MEMORY_TO_MEMORY        (0x2UL << DMA_SxCR_DIR_Pos)     /*< DMA2 only >*/
+
+#define DMA_PINC_ENABLE             DMA_SxCR_PINC
+#define DMA_PINC_DISABLE            0x00000000U
+#define DMA_MINC_ENABLE             DMA_SxCR_MINC
+#define DMA_MINC_DISABLE            0x00000000U
+
+/**
+ * @defgroup DMA_Data_Alignment
+ */
+#define DMA_PDATAALIGN_BYTE         (0x0UL << DMA_SxCR_PSIZE_Pos)
+#define DMA_PDATAALIGN_HALFWORD     (0x1UL << DMA_SxCR_PSIZE_Pos)
+#define DMA_PDATAALIGN_WORD         (0x2UL << DMA_SxCR_PSIZE_Pos)
+#define DMA_MDATAALIGN_BYTE         (0x0UL << DMA_SxCR_MSIZE_Pos)
+#define DMA_MDATAALIGN_HALFWORD     (0x1UL << DMA_SxCR_MSIZE_Pos)
+#define DMA_MDATAALIGN_WORD         (0x2UL << DMA_SxCR_MSIZE_Pos)
+
+#define DMA_NORMAL                  0x00000000U
+#define DMA_CIRCULAR                DMA_SxCR_CIRC
+#define DMA_PFCTRL                  DMA_SxCR_PFCTRL     /*< Peripheral flow control (SDIO): the peripheral ends the transfer, NDTR is ignored >*/
+
+/**
+ * @defgroup DMA_Priority
+ */
+#define DMA_PRIORITY_LOW            (0x0UL << DMA_SxCR_PL_Pos)
+#define DMA_PRIORITY_MEDIUM         (0x1UL << DMA_SxCR_PL_Pos)
+#define DMA_PRIORITY_HIGH           (0x2UL << DMA_SxCR_PL_Pos)
+#define DMA_PRIORITY_VERY_HIGH      (0x3UL << DMA_SxCR_PL_Pos)
+
+#define DMA_FIFOMODE_DISABLE        0x00000000U
+#define DMA_FIFOMODE_ENABLE         DMA_SxFCR_DMDIS
+
+/**
+ * @defgroup DMA_FIFO_Threshold
+ */
+#define DMA_FIFO_THRESHOLD_1QUARTERFULL (0x0UL << DMA_SxFCR_FTH_Pos)
+#define DMA_FIFO_THRESHOLD_HALFFULL     (0x1UL << DMA_SxFCR_FTH_Pos)
+#define DMA_FIFO_THRESHOLD_3QUARTERSFULL (0x2UL << DMA_SxFCR_FTH_Pos)
+#define DMA_FIFO_THRESHOLD_FULL         (0x3UL << DMA_SxFCR_FTH_Pos)
+
+/**
+ * @defgroup DMA_Burst
+ */
+#define DMA_MBURST_SINGLE           (0x0UL << DMA_SxCR_MBURST_Pos)
+#define DMA_MBURST_INC4             (0x1UL << DMA_SxCR_MBURST_Pos)
+#define DMA_MBURST_INC8             (0x2UL << DMA_SxCR_MBURST_Pos)
+#define DMA_MBURST_INC16            (0x3UL << DMA_SxCR_MBURST_Pos)
+#define DMA_PBURST_SINGLE           (0x0UL << DMA_SxCR_PBURST_Pos)
+#define DMA_PBURST_INC4             (0x1UL << DMA_SxCR_PBURST_Pos)
+#define DMA_PBURST_INC8             (0x2UL << DMA_SxCR_PBURST_Pos)
+#define DMA_PBURST_INC16            (0x3UL << DMA_SxCR_PBURST_Pos)
+
+/**
+ * @brief   Interrupt enable bits (DMA_SxCR)
+ */
+#define DMA_IT_TC                   DMA_SxCR_TCIE
+#define DMA_IT_HT                   DMA_SxCR_HTIE
+#define DMA_IT_TE                   DMA_SxCR_TEIE
+#define DMA_IT_DME                  DMA_SxCR_DMEIE
+
+#define __HAL_DMA_ENABLE(__HANDLE__)        SET_BIT((__HANDLE__)->Instance->CR, DMA_SxCR_EN)
+#define __HAL_DMA_DISABLE(__HANDLE__)       CLEAR_BIT((__HANDLE__)->Instance->CR, DMA_SxCR_EN)
+#define __HAL_DMA_GET_COUNTER(__HANDLE__)   ((__HANDLE__)->Instance->NDTR)
+
+#define IS_DMA_BUFFER_SIZE(SIZE)    (((SIZE) >= 0x01U) && ((SIZE) < 0x10000U))
+
+/*------------------------------ HAL_DMA APIs ----------------------------------*/
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma);
+
+HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+HAL_StatusTypeDef HAL_DMAEx_MultiBufferStart_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                              uint32_t SecondMemAddress, uint32_t DataLength);
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma);
+
+HAL_DMA_StateTypeDef HAL_DMA_GetState(DMA_HandleTypeDef *hdma);
+uint32_t HAL_DMA_GetError(DMA_HandleTypeDef *hdma);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STM32F4XX_HAL_DMA_H_
\ No newline at end of file
@@ -0,0 +1,268 @@
+#ifndef _STM32F4XX_HAL_ETH_H_
+#define _STM32F4XX_HAL_ETH_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal_def.h"
+
+/**
+ * @brief   Ethernet MAC and its DMA, 10/100 Mbit, MII or RMII
+ * @note    Pins (AF11) and the PHY reference clock (25 MHz MII, 50 MHz RMII) must be up
+ *          before HAL_ETH_Init(): the DMA reset does not complete without the PHY clocks.
+ *          The driver selects MII/RMII in SYSCFG and enables/resets the MAC itself, as
+ *          the interface is only latched while the MAC is held in reset.
+ *
+ *          Zero copy: packet buffers go to the DMA as they are, in both directions.
+ *          - RX: every RX descriptor holds one buffer of Init.RxBufferSize bytes (a whole
+ *            frame). HAL_ETH_ReadFrame() hands the buffer of a received frame to the
+ *            caller and puts a fresh one, from HAL_ETH_RxAllocateCallback(), in its place.
+ *            The caller frees the buffer (back to its pool) whenever it is done with it.
+ *          - TX: HAL_ETH_Transmit() puts the fragments of a frame (e.g. headers and
+ *            payload) on consecutive descriptors. The buffers belong to the DMA until
+ *            HAL_ETH_ReleaseTxBuffers() returns the frame's Token to
+ *            HAL_ETH_TxFreeCallback().
+ *          The first descriptor of a TX frame is handed to the DMA last, so it never
+ *          starts on a partly written frame.
+ *
+ *          Checksum offload (Init.ChecksumOffload): RX IPv4/IPv6 header and TCP/UDP/ICMP
+ *          checksums are checked by the MAC, frames that fail are dropped by the DMA;
+ *          ETH_RxFrameTypeDef.Checksum tells the stack when it can skip its own check.
+ *          TX checksums are inserted per frame (ETH_TxFrameTypeDef.Checksum), the stack
+ *          leaves the checksum fields at 0 (ETH_TX_CSUM_FULL). Needs store and forward,
+ *          which is always on.
+ *
+ *          Interrupt coalescing:
+ *          - RX: only every RxCoalesceFrames-th frame raises the interrupt at once, the
+ *            others arm the receive watchdog, which raises it RxCoalesceUsecs later. A
+ *            burst costs one interrupt, a lone frame waits at most RxCoalesceUsecs.
+ *          - TX: the completion interrupt is requested on every TxCoalesceFrames-th
+ *            frame only; HAL_ETH_Transmit() also reclaims by itself when the ring is full.
+ *
+ *          HAL_ETH_ReadFrame(), HAL_ETH_Transmit() and HAL_ETH_ReleaseTxBuffers() are
+ *          called from one thread (the network stack); HAL_ETH_IRQHandler() only signals
+ *          it through HAL_ETH_RxCpltCallback() / HAL_ETH_TxCpltCallback().
+ *
+ *          No data cache on the F4, descriptors and buffers may be anywhere in SRAM
+ *          (not the CCM RAM, which the DMA cannot reach).
+ */
+
+/**
+ * @brief: DMA descriptor, normal format (DES0 ~ DES3) followed by words for the driver
+ * @note   Ring mode, one buffer per descriptor: the descriptors are an array, the last
+ *         one carries the end of ring bit. The DMA skips the driver words (DMABMR.DSL).
+ */
+typedef struct
+{
+    __IO uint32_t Status;           /*< DES0: OWN and status, TX: FS/LS/IC/CIC/TER >*/
+    __IO uint32_t Control;          /*< DES1: buffer size, RX: DIC/RER >*/
+    __IO uint32_t Buffer1;          /*< DES2: buffer address >*/
+    __IO uint32_t Buffer2;          /*< DES3: not used >*/
+    void          *Buf;             /*< Buffer1 as a pointer >*/
+    void          *Token;           /*< TX: returned by HAL_ETH_TxFreeCallback(), on the last descriptor of a frame >*/
+} ETH_DMADescTypeDef;
+
+/**
+ * @brief: MAC configuration
+ */
+typedef struct
+{
+    uint8_t  MACAddr[6];            /*< Station address, MACAddr[0] first on the wire >*/
+    uint32_t MediaInterface;        /*< ETH_MEDIA_INTERFACE_MII / ETH_MEDIA_INTERFACE_RMII >*/
+    uint32_t ChecksumOffload;       /*< ENABLE: RX checks and TX insertion of IP/TCP/UDP/ICMP checksums >*/
+    uint32_t RxCoalesceFrames;      /*< Interrupt at once on every N-th frame, 1 = each frame >*/
+    uint32_t RxCoalesceUsecs;       /*< Receive watchdog for the others, needed if RxCoalesceFrames > 1 >*/
+    uint32_t TxCoalesceFrames;      /*< Completion interrupt every N-th frame, 1 = each frame >*/
+    ETH_DMADescTypeDef *RxDesc;     /*< RX ring, RxDescCount descriptors, word aligned >*/
+    uint32_t RxDescCount;
+    ETH_DMADescTypeDef *TxDesc;     /*< TX ring, TxDescCount descriptors, word aligned >*/
+    uint32_t TxDescCount;
+    uint32_t RxBufferSize;          /*< Bytes per RX buffer, multiple of 4, >= ETH_MAX_FRAME_SIZE >*/
+} ETH_InitTypeDef;
+
+/**
+ * @brief: Received frame, the buffer now belongs to the caller
+ */
+typedef struct
+{
+    void     *Buffer;               /*< From HAL_ETH_RxAllocateCallback(), frame at offset 0 >*/
+    uint32_t Length;                /*< Destination address to payload end, without the FCS >*/
+    uint32_t Checksum;              /*< See @ref ETH_Rx_Checksum >*/
+} ETH_RxFrameTypeDef;
+
+/**
+ * @brief: One piece of a frame to transmit
+ */
+typedef struct
+{
+    const void *Data;
+    uint32_t   Length;              /*< 1 ~ ETH_TX_FRAGMENT_MAX bytes >*/
+} ETH_BufferTypeDef;
+
+/**
+ * @brief: Frame to transmit, the fragments are sent back to back without copy
+ */
+typedef struct
+{
+    const ETH_BufferTypeDef *Fragments;
+    uint32_t FragmentCount;         /*< 1 ~ TxDescCount, one descriptor each >*/
+    uint32_t Checksum;              /*< See @ref ETH_Tx_Checksum >*/
+    void     *Token;                /*< Handed to HAL_ETH_TxFreeCallback() once sent, e.g. the pbuf >*/
+} ETH_TxFrameTypeDef;
+
+/**
+ * @brief: Counters
+ */
+typedef struct
+{
+    uint32_t RxFrames;
+    uint32_t RxErrors;              /*< Dropped by the driver: CRC, overflow, spanning descriptors >*/
+    uint32_t RxNoBuffer;            /*< RX ring ran empty (DMA suspended), frames are missed >*/
+    uint32_t RxAllocFailed;         /*< HAL_ETH_RxAllocateCallback() returned NULL >*/
+    uint32_t TxFrames;
+    uint32_t TxErrors;              /*< Sent with an error status (collisions, underflow, ...) >*/
+    uint32_t TxRingFull;            /*< HAL_ETH_Transmit() returned HAL_BUSY >*/
+    uint32_t Interrupts;
+} ETH_StatsTypeDef;
+
+/**
+ * @brief: ETH state
+ */
+typedef enum
+{
+    HAL_ETH_STATE_RESET     = 0x00U,
+    HAL_ETH_STATE_READY     = 0x01U,        /*< Initialized, MAC and DMA stopped >*/
+    HAL_ETH_STATE_STARTED   = 0x02U,
+    HAL_ETH_STATE_ERROR     = 0x04U         /*< DMA bus error, HAL_ETH_Init() again >*/
+} HAL_ETH_StateTypeDef;
+
+/**
+ * @brief: ETH handle
+ */
+typedef struct __ETH_HandleTypeDef
+{
+    ETH_TypeDef                 *Instance;
+    ETH_InitTypeDef             Init;
+    __IO HAL_ETH_StateTypeDef   State;
+    __IO uint32_t               ErrorCode;      /*< See @ref ETH_Error_Code >*/
+    uint32_t                    RxHead;         /*< Next descriptor to complete >*/
+    uint32_t                    RxFill;         /*< Next descriptor to get a buffer >*/
+    uint32_t                    RxEmpty;        /*< Descriptors without buffer, RxFill ~ RxHead - 1 >*/
+    uint32_t                    RxArmed;        /*< Buffers armed since the last one with an immediate interrupt >*/
+    uint32_t                    TxHead;         /*< Next free descriptor >*/
+    uint32_t                    TxClean;        /*< Oldest descriptor not reclaimed >*/
+    uint32_t                    TxUsed;         /*< Descriptors from TxClean on, not reclaimed >*/
+    uint32_t                    TxQueued;       /*< Frames since the last one with a completion interrupt >*/
+    ETH_StatsTypeDef            Stats;
+} ETH_HandleTypeDef;
+
+/*--------------------------------- Macros ---------------------------------*/
+/**
+ * @defgroup ETH_Error_Code
+ */
+#define HAL_ETH_ERROR_NONE          0x00000000U
+#define HAL_ETH_ERROR_PARAM         0x00000001U     /*< Ring sizes, buffer size or coalescing settings >*/
+#define HAL_ETH_ERROR_TIMEOUT       0x00000002U     /*< DMA reset (no PHY clock), FIFO flush or MDIO >*/
+#define HAL_ETH_ERROR_ALLOC         0x00000004U     /*< Not enough RX buffers to fill the ring >*/
+#define HAL_ETH_ERROR_DMA           0x00000008U     /*< Fatal bus error, the DMA has stopped >*/
+
+/**
+ * @defgroup ETH_Rx_Checksum
+ */
+#define ETH_RX_CSUM_NONE            0x00U           /*< Not checked: offload off, not IP or unsupported payload >*/
+#define ETH_RX_CSUM_OK              0x01U           /*< IP header and TCP/UDP/ICMP payload checksums verified >*/
+#define ETH_RX_CSUM_IP_ONLY         0x02U           /*< IP header verified, payload not checked >*/
+
+/**
+ * @defgroup ETH_Tx_Checksum
+ */
+#define ETH_TX_CSUM_NONE            0x00000000U
+#define ETH_TX_CSUM_IP_HEADER       0x00400000U     /*< IPv4 header checksum only >*/
+#define ETH_TX_CSUM_IP_PAYLOAD      0x00800000U     /*< IP header and TCP/UDP/ICMP, the stack puts the pseudo header sum in the field >*/
+#define ETH_TX_CSUM_FULL            0x00C00000U     /*< IP header and TCP/UDP/ICMP, pseudo header by the MAC >*/
+
+#define ETH_MEDIA_INTERFACE_MII     0x00000000U
+#define ETH_MEDIA_INTERFACE_RMII    SYSCFG_PMC_MII_RMII_SEL
+
+#define ETH_SPEED_10M               0x00000000U
+#define ETH_SPEED_100M              ETH_MACCR_FES
+#define ETH_DUPLEX_HALF             0x00000000U
+#define ETH_DUPLEX_FULL             ETH_MACCR_DM
+
+#define ETH_MAX_FRAME_SIZE          1522U           /*< VLAN tagged, with FCS >*/
+#define ETH_RX_BUF_SIZE             1536U           /*< Suggested Init.RxBufferSize >*/
+#define ETH_TX_FRAGMENT_MAX         0x1FFFU         /*< TBS1 >*/
+
+/**
+ * @brief: TX descriptor, DES0 (normal format, control bits set by the driver)
+ */
+#define ETH_DMATXDESC_OWN           0x80000000U     /*< Owned by the DMA >*/
+#define ETH_DMATXDESC_IC            0x40000000U     /*< Interrupt on completion >*/
+#define ETH_DMATXDESC_LS            0x20000000U     /*< Last segment of the frame >*/
+#define ETH_DMATXDESC_FS            0x10000000U     /*< First segment of the frame >*/
+#define ETH_DMATXDESC_CIC           0x00C00000U     /*< Checksum insertion control >*/
+#define ETH_DMATXDESC_TER           0x00200000U     /*< Transmit end of ring >*/
+#define ETH_DMATXDESC_ES            0x00008000U     /*< Error summary >*/
+#define ETH_DMATXDESC_TBS1          0x00001FFFU     /*< DES1: buffer 1 size >*/
+
+/**
+ * @brief: RX descriptor, DES0 (status, written back by the DMA) and DES1
+ */
+#define ETH_DMARXDESC_OWN           0x80000000U
+#define ETH_DMARXDESC_FL            0x3FFF0000U     /*< Frame length, with FCS >*/
+#define ETH_DMARXDESC_FL_Pos        16U
+#define ETH_DMARXDESC_ES            0x00008000U     /*< Error summary >*/
+#define ETH_DMARXDESC_DE            0x00004000U     /*< Descriptor error (frame does not fit) >*/
+#define ETH_DMARXDESC_OE            0x00000800U     /*< Overflow >*/
+#define ETH_DMARXDESC_FS            0x00000200U
+#define ETH_DMARXDESC_LS            0x00000100U
+#define ETH_DMARXDESC_IPHCE         0x00000080U     /*< IP header checksum error / giant frame >*/
+#define ETH_DMARXDESC_LC            0x00000040U     /*< Late collision >*/
+#define ETH_DMARXDESC_FT            0x00000020U     /*< Frame type, IPv4/IPv6 when offload is on >*/
+#define ETH_DMARXDESC_RWT           0x00000010U     /*< Receive watchdog timeout (jabber) >*/
+#define ETH_DMARXDESC_RE            0x00000008U     /*< MII receive error >*/
+#define ETH_DMARXDESC_CE            0x00000002U     /*< CRC error >*/
+#define ETH_DMARXDESC_PCE           0x00000001U     /*< Payload checksum error >*/
+#define ETH_DMARXDESC_DIC           0x80000000U     /*< DES1: no interrupt on completion >*/
+#define ETH_DMARXDESC_RER           0x00008000U     /*< DES1: receive end of ring >*/
+#define ETH_DMARXDESC_RBS1          0x00001FFFU     /*< DES1: buffer 1 size >*/
+
+#define IS_ETH_MEDIA_INTERFACE(MEDIA)   (((MEDIA) == ETH_MEDIA_INTERFACE_MII) || ((MEDIA) == ETH_MEDIA_INTERFACE_RMII))
+#define IS_ETH_SPEED(SPEED)             (((SPEED) == ETH_SPEED_10M) || ((SPEED) == ETH_SPEED_100M))
+#define IS_ETH_DUPLEX(DUPLEX)           (((DUPLEX) == ETH_DUPLEX_HALF) || ((DUPLEX) == ETH_DUPLEX_FULL))
+#define IS_ETH_TX_CSUM(CSUM)            (((CSUM) & ~ETH_DMATXDESC_CIC) == 0U)
+
+/*------------------------------ HAL_ETH APIs ----------------------------------*/
+HAL_StatusTypeDef HAL_ETH_Init(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_DeInit(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_Start(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_Stop(ETH_HandleTypeDef *heth);
+void HAL_ETH_SetLink(ETH_HandleTypeDef *heth, uint32_t Speed, uint32_t Duplex);
+
+/* Frames, zero copy */
+HAL_StatusTypeDef HAL_ETH_ReadFrame(ETH_HandleTypeDef *heth, ETH_RxFrameTypeDef *Frame);
+uint32_t HAL_ETH_RxRefill(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_Transmit(ETH_HandleTypeDef *heth, const ETH_TxFrameTypeDef *Frame);
+uint32_t HAL_ETH_ReleaseTxBuffers(ETH_HandleTypeDef *heth);
+
+/* PHY management (MDIO, clause 22) */
+HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint32_t PhyAddr, uint32_t Reg, uint32_t *Value);
+HAL_StatusTypeDef HAL_ETH_WritePHYRegister(ETH_HandleTypeDef *heth, uint32_t PhyAddr, uint32_t Reg, uint32_t Value);
+
+/* IRQ handler and callbacks */
+void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth);
+void *HAL_ETH_RxAllocateCallback(ETH_HandleTypeDef *heth);
+void HAL_ETH_TxFreeCallback(ETH_HandleTypeDef *heth, void *Token);
+void HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *heth);
+void HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth);
+void HAL_ETH_ErrorCallback(ETH_HandleTypeDef *heth);
+
+HAL_ETH_StateTypeDef HAL_ETH_GetState(ETH_HandleTypeDef *heth);
+uint32_t HAL_ETH_GetError(ETH_HandleTypeDef *heth);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STM32F4XX_HAL_ETH_H_
\ No newline at end of file
@@ -0,0 +1,116 @@
+#ifndef _STM32F4XX_HAL_FLASH_H_
+#define _STM32F4XX_HAL_FLASH_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal_def.h"
+
+/**
+ * @brief   Embedded flash: sector erase and programming
+ * @note    1 MB in 12 sectors: 0 ~ 3 are 16 KB, 4 is 64 KB, 5 ~ 11 are 128 KB. Erase sets a
+ *          whole sector to 0xFF, programming can only clear bits.
+ *
+ *          The parallelism (PSIZE) is set by the supply voltage range, and it decides how
+ *          many bytes one program operation writes and how fast a sector is erased:
+ *          - FLASH_VOLTAGE_RANGE_1 (1.8 - 2.1 V): x8
+ *          - FLASH_VOLTAGE_RANGE_2 (2.1 - 2.7 V): x16
+ *          - FLASH_VOLTAGE_RANGE_3 (2.7 - 3.6 V): x32, ~16 us per word, ~1 s per 128 KB
+ *          - FLASH_VOLTAGE_RANGE_4 (2.7 - 3.6 V and 8 - 9 V on VPP): x64, half the time
+ *          HAL_FLASH_Init() derives ProgramSize from it; HAL_FLASH_Program() takes whole
+ *          ProgramSize units, write-combining of smaller updates is left to the caller
+ *          (see flashdev.h).
+ *
+ *          The CPU stalls on any flash fetch while an operation runs (single bank), so
+ *          interrupt handlers that must keep running have to live in RAM. Erase and
+ *          program are polled, the interrupt is not used.
+ */
+
+/**
+ * @brief: FLASH configuration
+ */
+typedef struct
+{
+    uint32_t VoltageRange;          /*< FLASH_VOLTAGE_RANGE_1 ~ 4 >*/
+} FLASH_InitTypeDef;
+
+/**
+ * @brief: FLASH state
+ */
+typedef enum
+{
+    HAL_FLASH_STATE_RESET   = 0x00U,
+    HAL_FLASH_STATE_READY   = 0x01U,
+    HAL_FLASH_STATE_ERROR   = 0x02U         /*< Last operation failed, see ErrorCode >*/
+} HAL_FLASH_StateTypeDef;
+
+/**
+ * @brief: FLASH handle
+ */
+typedef struct
+{
+    FLASH_TypeDef               *Instance;
+    FLASH_InitTypeDef           Init;
+    uint32_t                    ProgramSize;    /*< Bytes per program operation: 1, 2, 4 or 8 >*/
+    HAL_FLASH_StateTypeDef      State;
+    uint32_t                    ErrorCode;      /*< See @ref FLASH_Error_Code >*/
+} FLASH_HandleTypeDef;
+
+/*--------------------------------- Macros ---------------------------------*/
+/**
+ * @defgroup FLASH_Error_Code
+ */
+#define HAL_FLASH_ERROR_NONE        0x00000000U
+#define HAL_FLASH_ERROR_PARAM       0x00000001U     /*< Address, size or sector out of range >*/
+#define HAL_FLASH_ERROR_WRP         0x00000002U     /*< Write protected sector >*/
+#define HAL_FLASH_ERROR_PGA         0x00000004U     /*< Program alignment (crossed a 128-bit row) >*/
+#define HAL_FLASH_ERROR_PGP         0x00000008U     /*< Program parallelism, access size != PSIZE >*/
+#define HAL_FLASH_ERROR_PGS         0x00000010U     /*< Program sequence >*/
+#define HAL_FLASH_ERROR_OPERATION   0x00000020U
+#define HAL_FLASH_ERROR_TIMEOUT     0x00000040U
+#define HAL_FLASH_ERROR_LOCKED      0x00000080U     /*< Unlock sequence refused (wrong keys, reset needed) >*/
+
+#define FLASH_VOLTAGE_RANGE_1       0x00000000U             /*< x8 >*/
+#define FLASH_VOLTAGE_RANGE_2       (0x1UL << FLASH_CR_PSIZE_Pos)   /*< x16 >*/
+#define FLASH_VOLTAGE_RANGE_3       (0x2UL << FLASH_CR_PSIZE_Pos)   /*< x32 >*/
+#define FLASH_VOLTAGE_RANGE_4       (0x3UL << FLASH_CR_PSIZE_Pos)   /*< x64, external VPP >*/
+
+#define FLASH_SECTOR_COUNT          12U
+#define FLASH_END                   (FLASH_BASE + 0x100000UL)       /*< 1 MB >*/
+#define FLASH_KEY1                  0x45670123U
+#define FLASH_KEY2                  0xCDEF89ABU
+
+#define IS_FLASH_VOLTAGE_RANGE(RANGE)   (((RANGE) & ~FLASH_CR_PSIZE) == 0U)
+#define IS_FLASH_SECTOR(SECTOR)         ((SECTOR) < FLASH_SECTOR_COUNT)
+
+/* Caches and prefetch (FLASH_ACR) */
+#define __HAL_FLASH_PREFETCH_BUFFER_ENABLE()    SET_BIT(FLASH->ACR, FLASH_ACR_PRFTEN)
+#define __HAL_FLASH_INSTRUCTION_CACHE_ENABLE()  SET_BIT(FLASH->ACR, FLASH_ACR_ICEN)
+#define __HAL_FLASH_INSTRUCTION_CACHE_DISABLE() CLEAR_BIT(FLASH->ACR, FLASH_ACR_ICEN)
+#define __HAL_FLASH_DATA_CACHE_ENABLE()         SET_BIT(FLASH->ACR, FLASH_ACR_DCEN)
+#define __HAL_FLASH_DATA_CACHE_DISABLE()        CLEAR_BIT(FLASH->ACR, FLASH_ACR_DCEN)
+#define __HAL_FLASH_DATA_CACHE_RESET()          do { SET_BIT(FLASH->ACR, FLASH_ACR_DCRST); \
+                                                     CLEAR_BIT(FLASH->ACR, FLASH_ACR_DCRST); } while (0)
+
+/*------------------------------ HAL_FLASH APIs ----------------------------------*/
+HAL_StatusTypeDef HAL_FLASH_Init(FLASH_HandleTypeDef *hflash);
+HAL_StatusTypeDef HAL_FLASH_Unlock(FLASH_HandleTypeDef *hflash);
+void HAL_FLASH_Lock(FLASH_HandleTypeDef *hflash);
+
+/* Unlocked, polled */
+HAL_StatusTypeDef HAL_FLASH_EraseSector(FLASH_HandleTypeDef *hflash, uint32_t Sector);
+HAL_StatusTypeDef HAL_FLASH_Program(FLASH_HandleTypeDef *hflash, uint32_t Address, const void *Data, uint32_t Length);
+
+/* Geometry */
+uint32_t HAL_FLASH_GetSectorAddress(uint32_t Sector);
+uint32_t HAL_FLASH_GetSectorSize(uint32_t Sector);
+
+HAL_FLASH_StateTypeDef HAL_FLASH_GetState(FLASH_HandleTypeDef *hflash);
+uint32_t HAL_FLASH_GetError(FLASH_HandleTypeDef *hflash);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STM32F4XX_HAL_FLASH_H_
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifndef _STM32F4XX_HAL_FSMC_H_
+#define _STM32F4XX_HAL_FSMC_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal_def.h"
+
+/**
+ * @brief   FSMC NOR/SRAM banks: asynchronous SRAM, PSRAM, NOR and 8080-style devices
+ * @note    Bank n (NEn) is mapped at FSMC_BANK1_BASE + 64MB * (n - 1): reads and writes
+ *          there become bus cycles on the pins. HADDR[25:0] drives A[25:0] with an 8-bit
+ *          bus, HADDR[25:1] with a 16-bit one (A0 is then the halfword address). A word
+ *          access on a 16-bit bus is split into two consecutive halfword cycles.
+ *
+ *          Timing is given in ns, as the device datasheet lists it, and converted to HCLK
+ *          cycles (rounded up) by HAL_FSMC_NORSRAM_Init(). Only asynchronous mode 1 is
+ *          used: an address setup phase (ADDSET) then a strobe phase (DATAST), NOE for
+ *          reads, NWE for writes. The controller adds an HCLK cycle or two of its own to
+ *          each access, which only makes the cycle longer. With write timing given,
+ *          extended mode takes it from BWTR, so that slow reads (typical of displays)
+ *          don't slow down writes.
+ *
+ *          Cycle counts depend on HCLK: call HAL_FSMC_NORSRAM_UpdateClock() after any
+ *          HCLK change. The FSMC clock (__HAL_RCC_FSMC_CLK_ENABLE()) and the pins (AF12,
+ *          very high speed) are set up by the caller.
+ */
+
+/**
+ * @brief: Bank timing and bus configuration
+ */
+typedef struct
+{
+    uint32_t MemoryType;            /*< FSMC_MEMORY_TYPE_SRAM / PSRAM / NOR >*/
+    uint32_t DataWidth;             /*< FSMC_DATA_WIDTH_8 / 16 >*/
+    uint32_t WriteEnable;           /*< FSMC_WRITE_ENABLE / DISABLE >*/
+    uint32_t AddressSetupNs;        /*< Address valid to NOE falling, 0 ~ 15 HCLK >*/
+    uint32_t DataSetupNs;           /*< NOE low time, 1 ~ 255 HCLK >*/
+    uint32_t BusTurnNs;             /*< Idle time after each access, 0 ~ 15 HCLK >*/
+    uint32_t WriteAddressSetupNs;   /*< Address valid to NWE falling >*/
+    uint32_t WriteDataSetupNs;      /*< NWE low time, 0 = writes use the read timing >*/
+} FSMC_NORSRAM_InitTypeDef;
+
+/**
+ * @brief: NOR/SRAM bank handle
+ */
+typedef struct
+{
+    uint32_t Bank;                  /*< FSMC_NORSRAM_BANK1 ~ 4 >*/
+    FSMC_NORSRAM_InitTypeDef Init;
+    uint32_t BaseAddress;           /*< Where the bank is mapped, set by HAL_FSMC_NORSRAM_Init() >*/
+    uint32_t ReadTiming;            /*< BTR value in use >*/
+    uint32_t WriteTiming;           /*< BWTR value in use, 0 without extended mode >*/
+} FSMC_NORSRAM_HandleTypeDef;
+
+/*--------------------------------- Macros ---------------------------------*/
+#define FSMC_NORSRAM_BANK1          0U      /*< NE1 >*/
+#define FSMC_NORSRAM_BANK2          1U      /*< NE2 >*/
+#define FSMC_NORSRAM_BANK3          2U      /*< NE3 >*/
+#define FSMC_NORSRAM_BANK4          3U      /*< NE4 >*/
+#define FSMC_NORSRAM_BANK_SIZE      0x04000000UL
+#define FSMC_NORSRAM_ADDRESS(BANK)  (FSMC_BANK1_BASE + ((uint32_t)(BANK) * FSMC_NORSRAM_BANK_SIZE))
+
+#define FSMC_MEMORY_TYPE_SRAM       (0x0UL << FSMC_BCRx_MTYP_Pos)
+#define FSMC_MEMORY_TYPE_PSRAM      (0x1UL << FSMC_BCRx_MTYP_Pos)
+#define FSMC_MEMORY_TYPE_NOR        (0x2UL << FSMC_BCRx_MTYP_Pos)
+
+#define FSMC_DATA_WIDTH_8           (0x0UL << FSMC_BCRx_MWID_Pos)
+#define FSMC_DATA_WIDTH_16          (0x1UL << FSMC_BCRx_MWID_Pos)
+
+#define FSMC_WRITE_DISABLE          0x00000000U
+#define FSMC_WRITE_ENABLE           FSMC_BCRx_WREN
+
+#define FSMC_ADDSET_MAX             15U     /*< HCLK cycles >*/
+#define FSMC_DATAST_MAX             255U
+#define FSMC_BUSTURN_MAX            15U
+
+#define IS_FSMC_NORSRAM_BANK(BANK)  ((BANK) <= FSMC_NORSRAM_BANK4)
+
+/*------------------------------ HAL_FSMC APIs ----------------------------------*/
+HAL_StatusTypeDef HAL_FSMC_NORSRAM_Init(FSMC_NORSRAM_HandleTypeDef *hsram);
+HAL_StatusTypeDef HAL_FSMC_NORSRAM_DeInit(FSMC_NORSRAM_HandleTypeDef *hsram);
+HAL_StatusTypeDef HAL_FSMC_NORSRAM_UpdateClock(FSMC_NORSRAM_HandleTypeDef *hsram);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STM32F4XX_HAL_FSMC_H_
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 
 #include "stm32f4xx_hal_def.h"
+#include "stm32f4xx_hal_gpio_ex.h"
 
 /**
  * @brief: GPIO Init structure
@@ -17,6 +18,33 @@ typedef struct
 } GPIO_InitTypeDef;
 
 
+/**
+ * @brief: Saved configuration of one port (see HAL_GPIO_SavePorts)
+ */
+typedef struct
+{
+    uint32_t MODER;
+    uint32_t OSPEEDR;
+    uint32_t PUPDR;
+    uint32_t AFRL;
+    uint32_t AFRH;
+    uint16_t OTYPER;        /* only 16 bits are used in OTYPER & ODR */
+    uint16_t ODR;
+} GPIO_PortStateTypeDef;
+
+/**
+ * @brief: Snapshot of a set of ports, taken before STOP mode and restored on wake-up
+ */
+typedef struct
+{
+    uint32_t PortMask;                      /* bit n set = port n (A = 0 ... I = 8) is captured */
+    GPIO_PortStateTypeDef Port[GPIO_PORT_I + 1U];
+} GPIO_SnapshotTypeDef;
+
+#define GPIO_PORTMASK(PORT)     (1UL << (PORT))         /* e.g. GPIO_PORTMASK(GPIO_PORT_A) | GPIO_PORTMASK(GPIO_PORT_D) */
+#define GPIO_PORTMASK_ALL       0x000001FFUL
+
+
 /**
  * @brief   Bit SET & RESET
  */
@@ -100,6 +128,7 @@ typedef enum
  */
 void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
 void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin);
+void HAL_GPIO_AFPortInit(GPIO_TypeDef *GPIOx, const GPIO_AFPortTypeDef *AFPort, GPIO_InitTypeDef *GPIO_Init);
 
 GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
 void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
@@ -107,6 +136,10 @@ void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
 
 HAL_StatusTypeDef HAL_GPIO_LockPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
 
+void HAL_GPIO_SavePorts(GPIO_SnapshotTypeDef *Snapshot, uint32_t PortMask);
+void HAL_GPIO_LowPowerPorts(const GPIO_SnapshotTypeDef *Snapshot, const uint16_t *KeepPins);
+void HAL_GPIO_RestorePorts(const GPIO_SnapshotTypeDef *Snapshot);
+
 void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin);
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
 
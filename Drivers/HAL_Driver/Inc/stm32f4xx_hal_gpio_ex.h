@@ -0,0 +1,519 @@
+#ifndef _STM32F4XX_HAL_GPIO_EX_H_
+#define _STM32F4XX_HAL_GPIO_EX_H_
+
+#include "stm32f4xx_hal_def.h"
+
+/**
+ * @brief   GPIO_alternate_define
+ * @note    Alternate function numbers (RM - pg. 272, DS - Table 9)
+ */
+#define GPIO_AF0_SYS        0x00U   /*< MCO, SWD/JTAG, TRACE >*/
+#define GPIO_AF1_TIM1       0x01U
+#define GPIO_AF1_TIM2       0x01U
+#define GPIO_AF2_TIM3       0x02U
+#define GPIO_AF2_TIM4       0x02U
+#define GPIO_AF2_TIM5       0x02U
+#define GPIO_AF3_TIM8       0x03U
+#define GPIO_AF3_TIM9       0x03U
+#define GPIO_AF3_TIM10      0x03U
+#define GPIO_AF3_TIM11      0x03U
+#define GPIO_AF4_I2C1       0x04U
+#define GPIO_AF4_I2C2       0x04U
+#define GPIO_AF4_I2C3       0x04U
+#define GPIO_AF5_SPI1       0x05U
+#define GPIO_AF5_SPI2       0x05U
+#define GPIO_AF6_SPI3       0x06U
+#define GPIO_AF7_USART1     0x07U
+#define GPIO_AF7_USART2     0x07U
+#define GPIO_AF7_USART3     0x07U
+#define GPIO_AF8_UART4      0x08U
+#define GPIO_AF8_UART5      0x08U
+#define GPIO_AF8_USART6     0x08U
+#define GPIO_AF9_CAN1       0x09U
+#define GPIO_AF9_CAN2       0x09U
+#define GPIO_AF9_TIM12      0x09U
+#define GPIO_AF9_TIM13      0x09U
+#define GPIO_AF9_TIM14      0x09U
+#define GPIO_AF10_OTG_FS    0x0AU
+#define GPIO_AF10_OTG_HS    0x0AU
+#define GPIO_AF11_ETH       0x0BU
+#define GPIO_AF12_FSMC      0x0CU
+#define GPIO_AF12_SDIO      0x0CU
+#define GPIO_AF12_OTG_HS_FS 0x0CU
+#define GPIO_AF13_DCMI      0x0DU
+#define GPIO_AF15_EVENTOUT  0x0FU
+
+#define IS_GPIO_AF(AF)      ((AF) <= 0x0FU)
+
+/**
+ * @brief   Port index (A = 0 ... I = 8)
+ */
+#define GPIO_PORT_A     0U
+#define GPIO_PORT_B     1U
+#define GPIO_PORT_C     2U
+#define GPIO_PORT_D     3U
+#define GPIO_PORT_E     4U
+#define GPIO_PORT_F     5U
+#define GPIO_PORT_G     6U
+#define GPIO_PORT_H     7U
+#define GPIO_PORT_I     8U
+
+#define GPIO_GET_INDEX(__GPIOx__)   ((uint32_t)(((uint32_t)(__GPIOx__) - GPIOA_BASE) / 0x400UL))
+#define GPIO_PORT_INSTANCE(__INDEX__)   ((GPIO_TypeDef *)(GPIOA_BASE + ((uint32_t)(__INDEX__) * 0x400UL)))
+
+/**
+ * @brief   Pin-mux entry: one peripheral signal on one pin
+ * @details 0-7:   AF number
+ *          8-15:  Pin number
+ *          16-23: Port index + 1 (0 means "no signal", used to pad argument lists)
+ *          Fields are 8 bits wide on purpose, so an out of range AF/pin stays visible
+ *          to the compile-time checks below instead of spilling into the next field.
+ */
+#define GPIO_MUX(PORT, PIN, AF)     ((((uint32_t)(PORT) + 1U) << 16U) | ((uint32_t)(PIN) << 8U) | (uint32_t)(AF))
+#define GPIO_MUX_NONE               0U
+
+#define GPIO_MUX_PORT(M)            (((uint32_t)(M) >> 16U) - 1U)
+#define GPIO_MUX_PIN(M)             (((uint32_t)(M) >> 8U) & 0xFFU)
+#define GPIO_MUX_AF(M)              ((uint32_t)(M) & 0xFFU)
+
+#define GPIO_MUX_IS_VALID(M)        (((M) == GPIO_MUX_NONE) || \
+                                     ((GPIO_MUX_PORT(M) <= GPIO_PORT_I) && (GPIO_MUX_PIN(M) < 16U) && (GPIO_MUX_AF(M) <= 0x0FU)))
+#define GPIO_MUX_PINMASK(M)         (((M) == GPIO_MUX_NONE) ? 0U : (1UL << (GPIO_MUX_PIN(M) & 0x0FU)))
+#define GPIO_MUX_AFRL(M)            ((((M) != GPIO_MUX_NONE) && (GPIO_MUX_PIN(M) < 8U)) ? \
+                                     ((GPIO_MUX_AF(M) & 0x0FU) << ((GPIO_MUX_PIN(M) & 0x07U) * 4U)) : 0U)
+#define GPIO_MUX_AFRH(M)            ((((M) != GPIO_MUX_NONE) && (GPIO_MUX_PIN(M) >= 8U)) ? \
+                                     ((GPIO_MUX_AF(M) & 0x0FU) << ((GPIO_MUX_PIN(M) & 0x07U) * 4U)) : 0U)
+#define GPIO_MUX_AFRL_MSK(M)        ((((M) != GPIO_MUX_NONE) && (GPIO_MUX_PIN(M) < 8U)) ? (0xFUL << ((GPIO_MUX_PIN(M) & 0x07U) * 4U)) : 0U)
+#define GPIO_MUX_AFRH_MSK(M)        ((((M) != GPIO_MUX_NONE) && (GPIO_MUX_PIN(M) >= 8U)) ? (0xFUL << ((GPIO_MUX_PIN(M) & 0x07U) * 4U)) : 0U)
+#define GPIO_MUX_ON_PORT(M, PORT)   (((M) == GPIO_MUX_NONE) || (GPIO_MUX_PORT(M) == (PORT)))
+
+/*------------------------------- STM32F407 pin-mux table -------------------------------*/
+/**
+ * @brief   GPIO_MUX_<signal>_P<port><pin>
+ * @note    Only the signal/pin pairs listed in the datasheet exist here, so using a signal
+ *          on a pin it is not routed to (or with the wrong AF) does not compile.
+ */
+/* AF0 - System */
+#define GPIO_MUX_MCO1_PA8                   GPIO_MUX(GPIO_PORT_A, 8U, 0U)
+#define GPIO_MUX_MCO2_PC9                   GPIO_MUX(GPIO_PORT_C, 9U, 0U)
+#define GPIO_MUX_TRACESWO_PB3               GPIO_MUX(GPIO_PORT_B, 3U, 0U)
+/* AF1 - TIM1 / TIM2 */
+#define GPIO_MUX_TIM1_CH1_PA8               GPIO_MUX(GPIO_PORT_A, 8U, 1U)
+#define GPIO_MUX_TIM1_CH1_PE9               GPIO_MUX(GPIO_PORT_E, 9U, 1U)
+#define GPIO_MUX_TIM1_CH2_PA9               GPIO_MUX(GPIO_PORT_A, 9U, 1U)
+#define GPIO_MUX_TIM1_CH2_PE11              GPIO_MUX(GPIO_PORT_E, 11U, 1U)
+#define GPIO_MUX_TIM1_CH3_PA10              GPIO_MUX(GPIO_PORT_A, 10U, 1U)
+#define GPIO_MUX_TIM1_CH3_PE13              GPIO_MUX(GPIO_PORT_E, 13U, 1U)
+#define GPIO_MUX_TIM1_CH4_PA11              GPIO_MUX(GPIO_PORT_A, 11U, 1U)
+#define GPIO_MUX_TIM1_CH4_PE14              GPIO_MUX(GPIO_PORT_E, 14U, 1U)
+#define GPIO_MUX_TIM1_CH1N_PA7              GPIO_MUX(GPIO_PORT_A, 7U, 1U)
+#define GPIO_MUX_TIM1_CH1N_PB13             GPIO_MUX(GPIO_PORT_B, 13U, 1U)
+#define GPIO_MUX_TIM1_CH1N_PE8              GPIO_MUX(GPIO_PORT_E, 8U, 1U)
+#define GPIO_MUX_TIM1_CH2N_PB0              GPIO_MUX(GPIO_PORT_B, 0U, 1U)
+#define GPIO_MUX_TIM1_CH2N_PB14             GPIO_MUX(GPIO_PORT_B, 14U, 1U)
+#define GPIO_MUX_TIM1_CH2N_PE10             GPIO_MUX(GPIO_PORT_E, 10U, 1U)
+#define GPIO_MUX_TIM1_CH3N_PB1              GPIO_MUX(GPIO_PORT_B, 1U, 1U)
+#define GPIO_MUX_TIM1_CH3N_PB15             GPIO_MUX(GPIO_PORT_B, 15U, 1U)
+#define GPIO_MUX_TIM1_CH3N_PE12             GPIO_MUX(GPIO_PORT_E, 12U, 1U)
+#define GPIO_MUX_TIM1_BKIN_PA6              GPIO_MUX(GPIO_PORT_A, 6U, 1U)
+#define GPIO_MUX_TIM1_BKIN_PB12             GPIO_MUX(GPIO_PORT_B, 12U, 1U)
+#define GPIO_MUX_TIM1_BKIN_PE15             GPIO_MUX(GPIO_PORT_E, 15U, 1U)
+#define GPIO_MUX_TIM1_ETR_PA12              GPIO_MUX(GPIO_PORT_A, 12U, 1U)
+#define GPIO_MUX_TIM1_ETR_PE7               GPIO_MUX(GPIO_PORT_E, 7U, 1U)
+#define GPIO_MUX_TIM2_CH1_PA0               GPIO_MUX(GPIO_PORT_A, 0U, 1U)
+#define GPIO_MUX_TIM2_CH1_PA5               GPIO_MUX(GPIO_PORT_A, 5U, 1U)
+#define GPIO_MUX_TIM2_CH1_PA15              GPIO_MUX(GPIO_PORT_A, 15U, 1U)
+#define GPIO_MUX_TIM2_CH2_PA1               GPIO_MUX(GPIO_PORT_A, 1U, 1U)
+#define GPIO_MUX_TIM2_CH2_PB3               GPIO_MUX(GPIO_PORT_B, 3U, 1U)
+#define GPIO_MUX_TIM2_CH3_PA2               GPIO_MUX(GPIO_PORT_A, 2U, 1U)
+#define GPIO_MUX_TIM2_CH3_PB10              GPIO_MUX(GPIO_PORT_B, 10U, 1U)
+#define GPIO_MUX_TIM2_CH4_PA3               GPIO_MUX(GPIO_PORT_A, 3U, 1U)
+#define GPIO_MUX_TIM2_CH4_PB11              GPIO_MUX(GPIO_PORT_B, 11U, 1U)
+/* AF2 - TIM3 / TIM4 / TIM5 */
+#define GPIO_MUX_TIM3_CH1_PA6               GPIO_MUX(GPIO_PORT_A, 6U, 2U)
+#define GPIO_MUX_TIM3_CH1_PB4               GPIO_MUX(GPIO_PORT_B, 4U, 2U)
+#define GPIO_MUX_TIM3_CH1_PC6               GPIO_MUX(GPIO_PORT_C, 6U, 2U)
+#define GPIO_MUX_TIM3_CH2_PA7               GPIO_MUX(GPIO_PORT_A, 7U, 2U)
+#define GPIO_MUX_TIM3_CH2_PB5               GPIO_MUX(GPIO_PORT_B, 5U, 2U)
+#define GPIO_MUX_TIM3_CH2_PC7               GPIO_MUX(GPIO_PORT_C, 7U, 2U)
+#define GPIO_MUX_TIM3_CH3_PB0               GPIO_MUX(GPIO_PORT_B, 0U, 2U)
+#define GPIO_MUX_TIM3_CH3_PC8               GPIO_MUX(GPIO_PORT_C, 8U, 2U)
+#define GPIO_MUX_TIM3_CH4_PB1               GPIO_MUX(GPIO_PORT_B, 1U, 2U)
+#define GPIO_MUX_TIM3_CH4_PC9               GPIO_MUX(GPIO_PORT_C, 9U, 2U)
+#define GPIO_MUX_TIM4_CH1_PB6               GPIO_MUX(GPIO_PORT_B, 6U, 2U)
+#define GPIO_MUX_TIM4_CH1_PD12              GPIO_MUX(GPIO_PORT_D, 12U, 2U)
+#define GPIO_MUX_TIM4_CH2_PB7               GPIO_MUX(GPIO_PORT_B, 7U, 2U)
+#define GPIO_MUX_TIM4_CH2_PD13              GPIO_MUX(GPIO_PORT_D, 13U, 2U)
+#define GPIO_MUX_TIM4_CH3_PB8               GPIO_MUX(GPIO_PORT_B, 8U, 2U)
+#define GPIO_MUX_TIM4_CH3_PD14              GPIO_MUX(GPIO_PORT_D, 14U, 2U)
+#define GPIO_MUX_TIM4_CH4_PB9               GPIO_MUX(GPIO_PORT_B, 9U, 2U)
+#define GPIO_MUX_TIM4_CH4_PD15              GPIO_MUX(GPIO_PORT_D, 15U, 2U)
+#define GPIO_MUX_TIM5_CH1_PA0               GPIO_MUX(GPIO_PORT_A, 0U, 2U)
+#define GPIO_MUX_TIM5_CH1_PH10              GPIO_MUX(GPIO_PORT_H, 10U, 2U)
+#define GPIO_MUX_TIM5_CH2_PA1               GPIO_MUX(GPIO_PORT_A, 1U, 2U)
+#define GPIO_MUX_TIM5_CH2_PH11              GPIO_MUX(GPIO_PORT_H, 11U, 2U)
+#define GPIO_MUX_TIM5_CH3_PA2               GPIO_MUX(GPIO_PORT_A, 2U, 2U)
+#define GPIO_MUX_TIM5_CH3_PH12              GPIO_MUX(GPIO_PORT_H, 12U, 2U)
+#define GPIO_MUX_TIM5_CH4_PA3               GPIO_MUX(GPIO_PORT_A, 3U, 2U)
+#define GPIO_MUX_TIM5_CH4_PI0               GPIO_MUX(GPIO_PORT_I, 0U, 2U)
+/* AF3 - TIM8 / TIM9 / TIM10 / TIM11 */
+#define GPIO_MUX_TIM8_CH1_PC6               GPIO_MUX(GPIO_PORT_C, 6U, 3U)
+#define GPIO_MUX_TIM8_CH1_PI5               GPIO_MUX(GPIO_PORT_I, 5U, 3U)
+#define GPIO_MUX_TIM8_CH2_PC7               GPIO_MUX(GPIO_PORT_C, 7U, 3U)
+#define GPIO_MUX_TIM8_CH2_PI6               GPIO_MUX(GPIO_PORT_I, 6U, 3U)
+#define GPIO_MUX_TIM8_CH3_PC8               GPIO_MUX(GPIO_PORT_C, 8U, 3U)
+#define GPIO_MUX_TIM8_CH3_PI7               GPIO_MUX(GPIO_PORT_I, 7U, 3U)
+#define GPIO_MUX_TIM8_CH4_PC9               GPIO_MUX(GPIO_PORT_C, 9U, 3U)
+#define GPIO_MUX_TIM8_CH4_PI2               GPIO_MUX(GPIO_PORT_I, 2U, 3U)
+#define GPIO_MUX_TIM8_CH1N_PA5              GPIO_MUX(GPIO_PORT_A, 5U, 3U)
+#define GPIO_MUX_TIM8_CH1N_PA7              GPIO_MUX(GPIO_PORT_A, 7U, 3U)
+#define GPIO_MUX_TIM8_CH1N_PH13             GPIO_MUX(GPIO_PORT_H, 13U, 3U)
+#define GPIO_MUX_TIM8_CH2N_PB0              GPIO_MUX(GPIO_PORT_B, 0U, 3U)
+#define GPIO_MUX_TIM8_CH2N_PB14             GPIO_MUX(GPIO_PORT_B, 14U, 3U)
+#define GPIO_MUX_TIM8_CH2N_PH14             GPIO_MUX(GPIO_PORT_H, 14U, 3U)
+#define GPIO_MUX_TIM8_CH3N_PB1              GPIO_MUX(GPIO_PORT_B, 1U, 3U)
+#define GPIO_MUX_TIM8_CH3N_PB15             GPIO_MUX(GPIO_PORT_B, 15U, 3U)
+#define GPIO_MUX_TIM8_CH3N_PH15             GPIO_MUX(GPIO_PORT_H, 15U, 3U)
+#define GPIO_MUX_TIM8_BKIN_PA6              GPIO_MUX(GPIO_PORT_A, 6U, 3U)
+#define GPIO_MUX_TIM8_BKIN_PI4              GPIO_MUX(GPIO_PORT_I, 4U, 3U)
+#define GPIO_MUX_TIM8_ETR_PA0               GPIO_MUX(GPIO_PORT_A, 0U, 3U)
+#define GPIO_MUX_TIM8_ETR_PI3               GPIO_MUX(GPIO_PORT_I, 3U, 3U)
+#define GPIO_MUX_TIM9_CH1_PA2               GPIO_MUX(GPIO_PORT_A, 2U, 3U)
+#define GPIO_MUX_TIM9_CH1_PE5               GPIO_MUX(GPIO_PORT_E, 5U, 3U)
+#define GPIO_MUX_TIM9_CH2_PA3               GPIO_MUX(GPIO_PORT_A, 3U, 3U)
+#define GPIO_MUX_TIM9_CH2_PE6               GPIO_MUX(GPIO_PORT_E, 6U, 3U)
+#define GPIO_MUX_TIM10_CH1_PB8              GPIO_MUX(GPIO_PORT_B, 8U, 3U)
+#define GPIO_MUX_TIM10_CH1_PF6              GPIO_MUX(GPIO_PORT_F, 6U, 3U)
+#define GPIO_MUX_TIM11_CH1_PB9              GPIO_MUX(GPIO_PORT_B, 9U, 3U)
+#define GPIO_MUX_TIM11_CH1_PF7              GPIO_MUX(GPIO_PORT_F, 7U, 3U)
+/* AF4 - I2C1 / I2C2 / I2C3 */
+#define GPIO_MUX_I2C1_SCL_PB6               GPIO_MUX(GPIO_PORT_B, 6U, 4U)
+#define GPIO_MUX_I2C1_SCL_PB8               GPIO_MUX(GPIO_PORT_B, 8U, 4U)
+#define GPIO_MUX_I2C1_SDA_PB7               GPIO_MUX(GPIO_PORT_B, 7U, 4U)
+#define GPIO_MUX_I2C1_SDA_PB9               GPIO_MUX(GPIO_PORT_B, 9U, 4U)
+#define GPIO_MUX_I2C2_SCL_PB10              GPIO_MUX(GPIO_PORT_B, 10U, 4U)
+#define GPIO_MUX_I2C2_SCL_PF1               GPIO_MUX(GPIO_PORT_F, 1U, 4U)
+#define GPIO_MUX_I2C2_SCL_PH4               GPIO_MUX(GPIO_PORT_H, 4U, 4U)
+#define GPIO_MUX_I2C2_SDA_PB11              GPIO_MUX(GPIO_PORT_B, 11U, 4U)
+#define GPIO_MUX_I2C2_SDA_PF0               GPIO_MUX(GPIO_PORT_F, 0U, 4U)
+#define GPIO_MUX_I2C2_SDA_PH5               GPIO_MUX(GPIO_PORT_H, 5U, 4U)
+#define GPIO_MUX_I2C3_SCL_PA8               GPIO_MUX(GPIO_PORT_A, 8U, 4U)
+#define GPIO_MUX_I2C3_SCL_PH7               GPIO_MUX(GPIO_PORT_H, 7U, 4U)
+#define GPIO_MUX_I2C3_SDA_PC9               GPIO_MUX(GPIO_PORT_C, 9U, 4U)
+#define GPIO_MUX_I2C3_SDA_PH8               GPIO_MUX(GPIO_PORT_H, 8U, 4U)
+/* AF5 - SPI1 / SPI2 */
+#define GPIO_MUX_SPI1_NSS_PA4               GPIO_MUX(GPIO_PORT_A, 4U, 5U)
+#define GPIO_MUX_SPI1_NSS_PA15              GPIO_MUX(GPIO_PORT_A, 15U, 5U)
+#define GPIO_MUX_SPI1_SCK_PA5               GPIO_MUX(GPIO_PORT_A, 5U, 5U)
+#define GPIO_MUX_SPI1_SCK_PB3               GPIO_MUX(GPIO_PORT_B, 3U, 5U)
+#define GPIO_MUX_SPI1_MISO_PA6              GPIO_MUX(GPIO_PORT_A, 6U, 5U)
+#define GPIO_MUX_SPI1_MISO_PB4              GPIO_MUX(GPIO_PORT_B, 4U, 5U)
+#define GPIO_MUX_SPI1_MOSI_PA7              GPIO_MUX(GPIO_PORT_A, 7U, 5U)
+#define GPIO_MUX_SPI1_MOSI_PB5              GPIO_MUX(GPIO_PORT_B, 5U, 5U)
+#define GPIO_MUX_SPI2_NSS_PB9               GPIO_MUX(GPIO_PORT_B, 9U, 5U)
+#define GPIO_MUX_SPI2_NSS_PB12              GPIO_MUX(GPIO_PORT_B, 12U, 5U)
+#define GPIO_MUX_SPI2_NSS_PI0               GPIO_MUX(GPIO_PORT_I, 0U, 5U)
+#define GPIO_MUX_SPI2_SCK_PB10              GPIO_MUX(GPIO_PORT_B, 10U, 5U)
+#define GPIO_MUX_SPI2_SCK_PB13              GPIO_MUX(GPIO_PORT_B, 13U, 5U)
+#define GPIO_MUX_SPI2_SCK_PI1               GPIO_MUX(GPIO_PORT_I, 1U, 5U)
+#define GPIO_MUX_SPI2_MISO_PB14             GPIO_MUX(GPIO_PORT_B, 14U, 5U)
+#define GPIO_MUX_SPI2_MISO_PC2              GPIO_MUX(GPIO_PORT_C, 2U, 5U)
+#define GPIO_MUX_SPI2_MISO_PI2              GPIO_MUX(GPIO_PORT_I, 2U, 5U)
+#define GPIO_MUX_SPI2_MOSI_PB15             GPIO_MUX(GPIO_PORT_B, 15U, 5U)
+#define GPIO_MUX_SPI2_MOSI_PC3              GPIO_MUX(GPIO_PORT_C, 3U, 5U)
+#define GPIO_MUX_SPI2_MOSI_PI3              GPIO_MUX(GPIO_PORT_I, 3U, 5U)
+/* AF6 - SPI3 */
+#define GPIO_MUX_SPI3_NSS_PA4               GPIO_MUX(GPIO_PORT_A, 4U, 6U)
+#define GPIO_MUX_SPI3_NSS_PA15              GPIO_MUX(GPIO_PORT_A, 15U, 6U)
+#define GPIO_MUX_SPI3_SCK_PB3               GPIO_MUX(GPIO_PORT_B, 3U, 6U)
+#define GPIO_MUX_SPI3_SCK_PC10              GPIO_MUX(GPIO_PORT_C, 10U, 6U)
+#define GPIO_MUX_SPI3_MISO_PB4              GPIO_MUX(GPIO_PORT_B, 4U, 6U)
+#define GPIO_MUX_SPI3_MISO_PC11             GPIO_MUX(GPIO_PORT_C, 11U, 6U)
+#define GPIO_MUX_SPI3_MOSI_PB5              GPIO_MUX(GPIO_PORT_B, 5U, 6U)
+#define GPIO_MUX_SPI3_MOSI_PC12             GPIO_MUX(GPIO_PORT_C, 12U, 6U)
+/* AF7 - USART1 / USART2 / USART3 */
+#define GPIO_MUX_USART1_TX_PA9              GPIO_MUX(GPIO_PORT_A, 9U, 7U)
+#define GPIO_MUX_USART1_TX_PB6              GPIO_MUX(GPIO_PORT_B, 6U, 7U)
+#define GPIO_MUX_USART1_RX_PA10             GPIO_MUX(GPIO_PORT_A, 10U, 7U)
+#define GPIO_MUX_USART1_RX_PB7              GPIO_MUX(GPIO_PORT_B, 7U, 7U)
+#define GPIO_MUX_USART2_TX_PA2              GPIO_MUX(GPIO_PORT_A, 2U, 7U)
+#define GPIO_MUX_USART2_TX_PD5              GPIO_MUX(GPIO_PORT_D, 5U, 7U)
+#define GPIO_MUX_USART2_RX_PA3              GPIO_MUX(GPIO_PORT_A, 3U, 7U)
+#define GPIO_MUX_USART2_RX_PD6              GPIO_MUX(GPIO_PORT_D, 6U, 7U)
+#define GPIO_MUX_USART3_TX_PB10             GPIO_MUX(GPIO_PORT_B, 10U, 7U)
+#define GPIO_MUX_USART3_TX_PC10             GPIO_MUX(GPIO_PORT_C, 10U, 7U)
+#define GPIO_MUX_USART3_TX_PD8              GPIO_MUX(GPIO_PORT_D, 8U, 7U)
+#define GPIO_MUX_USART3_RX_PB11             GPIO_MUX(GPIO_PORT_B, 11U, 7U)
+#define GPIO_MUX_USART3_RX_PC11             GPIO_MUX(GPIO_PORT_C, 11U, 7U)
+#define GPIO_MUX_USART3_RX_PD9              GPIO_MUX(GPIO_PORT_D, 9U, 7U)
+/* AF8 - UART4 / UART5 / USART6 */
+#define GPIO_MUX_UART4_TX_PA0               GPIO_MUX(GPIO_PORT_A, 0U, 8U)
+#define GPIO_MUX_UART4_TX_PC10              GPIO_MUX(GPIO_PORT_C, 10U, 8U)
+#define GPIO_MUX_UART4_RX_PA1               GPIO_MUX(GPIO_PORT_A, 1U, 8U)
+#define GPIO_MUX_UART4_RX_PC11              GPIO_MUX(GPIO_PORT_C, 11U, 8U)
+#define GPIO_MUX_UART5_TX_PC12              GPIO_MUX(GPIO_PORT_C, 12U, 8U)
+#define GPIO_MUX_UART5_RX_PD2               GPIO_MUX(GPIO_PORT_D, 2U, 8U)
+#define GPIO_MUX_USART6_TX_PC6              GPIO_MUX(GPIO_PORT_C, 6U, 8U)
+#define GPIO_MUX_USART6_TX_PG14             GPIO_MUX(GPIO_PORT_G, 14U, 8U)
+#define GPIO_MUX_USART6_RX_PC7              GPIO_MUX(GPIO_PORT_C, 7U, 8U)
+#define GPIO_MUX_USART6_RX_PG9              GPIO_MUX(GPIO_PORT_G, 9U, 8U)
+/* AF9 - CAN1 / CAN2 / TIM12 / TIM13 / TIM14 */
+#define GPIO_MUX_CAN1_RX_PA11               GPIO_MUX(GPIO_PORT_A, 11U, 9U)
+#define GPIO_MUX_CAN1_RX_PB8                GPIO_MUX(GPIO_PORT_B, 8U, 9U)
+#define GPIO_MUX_CAN1_RX_PD0                GPIO_MUX(GPIO_PORT_D, 0U, 9U)
+#define GPIO_MUX_CAN1_RX_PI9                GPIO_MUX(GPIO_PORT_I, 9U, 9U)
+#define GPIO_MUX_CAN1_TX_PA12               GPIO_MUX(GPIO_PORT_A, 12U, 9U)
+#define GPIO_MUX_CAN1_TX_PB9                GPIO_MUX(GPIO_PORT_B, 9U, 9U)
+#define GPIO_MUX_CAN1_TX_PD1                GPIO_MUX(GPIO_PORT_D, 1U, 9U)
+#define GPIO_MUX_CAN1_TX_PH13               GPIO_MUX(GPIO_PORT_H, 13U, 9U)
+#define GPIO_MUX_CAN2_RX_PB5                GPIO_MUX(GPIO_PORT_B, 5U, 9U)
+#define GPIO_MUX_CAN2_RX_PB12               GPIO_MUX(GPIO_PORT_B, 12U, 9U)
+#define GPIO_MUX_CAN2_TX_PB6                GPIO_MUX(GPIO_PORT_B, 6U, 9U)
+#define GPIO_MUX_CAN2_TX_PB13               GPIO_MUX(GPIO_PORT_B, 13U, 9U)
+#define GPIO_MUX_TIM12_CH1_PB14             GPIO_MUX(GPIO_PORT_B, 14U, 9U)
+#define GPIO_MUX_TIM12_CH2_PB15             GPIO_MUX(GPIO_PORT_B, 15U, 9U)
+#define GPIO_MUX_TIM13_CH1_PA6              GPIO_MUX(GPIO_PORT_A, 6U, 9U)
+#define GPIO_MUX_TIM14_CH1_PA7              GPIO_MUX(GPIO_PORT_A, 7U, 9U)
+/* AF11 - ETH (RMII) */
+#define GPIO_MUX_ETH_RMII_REF_CLK_PA1       GPIO_MUX(GPIO_PORT_A, 1U, 11U)
+#define GPIO_MUX_ETH_MDIO_PA2               GPIO_MUX(GPIO_PORT_A, 2U, 11U)
+#define GPIO_MUX_ETH_RMII_CRS_DV_PA7        GPIO_MUX(GPIO_PORT_A, 7U, 11U)
+#define GPIO_MUX_ETH_MDC_PC1                GPIO_MUX(GPIO_PORT_C, 1U, 11U)
+#define GPIO_MUX_ETH_RMII_RXD0_PC4          GPIO_MUX(GPIO_PORT_C, 4U, 11U)
+#define GPIO_MUX_ETH_RMII_RXD1_PC5          GPIO_MUX(GPIO_PORT_C, 5U, 11U)
+#define GPIO_MUX_ETH_RMII_TX_EN_PB11        GPIO_MUX(GPIO_PORT_B, 11U, 11U)
+#define GPIO_MUX_ETH_RMII_TX_EN_PG11        GPIO_MUX(GPIO_PORT_G, 11U, 11U)
+#define GPIO_MUX_ETH_RMII_TXD0_PB12         GPIO_MUX(GPIO_PORT_B, 12U, 11U)
+#define GPIO_MUX_ETH_RMII_TXD0_PG13         GPIO_MUX(GPIO_PORT_G, 13U, 11U)
+#define GPIO_MUX_ETH_RMII_TXD1_PB13         GPIO_MUX(GPIO_PORT_B, 13U, 11U)
+#define GPIO_MUX_ETH_RMII_TXD1_PG14         GPIO_MUX(GPIO_PORT_G, 14U, 11U)
+/* AF12 - FSMC / SDIO */
+#define GPIO_MUX_FSMC_D0_PD14               GPIO_MUX(GPIO_PORT_D, 14U, 12U)
+#define GPIO_MUX_FSMC_D1_PD15               GPIO_MUX(GPIO_PORT_D, 15U, 12U)
+#define GPIO_MUX_FSMC_D2_PD0                GPIO_MUX(GPIO_PORT_D, 0U, 12U)
+#define GPIO_MUX_FSMC_D3_PD1                GPIO_MUX(GPIO_PORT_D, 1U, 12U)
+#define GPIO_MUX_FSMC_D4_PE7                GPIO_MUX(GPIO_PORT_E, 7U, 12U)
+#define GPIO_MUX_FSMC_D5_PE8                GPIO_MUX(GPIO_PORT_E, 8U, 12U)
+#define GPIO_MUX_FSMC_D6_PE9                GPIO_MUX(GPIO_PORT_E, 9U, 12U)
+#define GPIO_MUX_FSMC_D7_PE10               GPIO_MUX(GPIO_PORT_E, 10U, 12U)
+#define GPIO_MUX_FSMC_D8_PE11               GPIO_MUX(GPIO_PORT_E, 11U, 12U)
+#define GPIO_MUX_FSMC_D9_PE12               GPIO_MUX(GPIO_PORT_E, 12U, 12U)
+#define GPIO_MUX_FSMC_D10_PE13              GPIO_MUX(GPIO_PORT_E, 13U, 12U)
+#define GPIO_MUX_FSMC_D11_PE14              GPIO_MUX(GPIO_PORT_E, 14U, 12U)
+#define GPIO_MUX_FSMC_D12_PE15              GPIO_MUX(GPIO_PORT_E, 15U, 12U)
+#define GPIO_MUX_FSMC_D13_PD8               GPIO_MUX(GPIO_PORT_D, 8U, 12U)
+#define GPIO_MUX_FSMC_D14_PD9               GPIO_MUX(GPIO_PORT_D, 9U, 12U)
+#define GPIO_MUX_FSMC_D15_PD10              GPIO_MUX(GPIO_PORT_D, 10U, 12U)
+#define GPIO_MUX_FSMC_NOE_PD4               GPIO_MUX(GPIO_PORT_D, 4U, 12U)
+#define GPIO_MUX_FSMC_NWE_PD5               GPIO_MUX(GPIO_PORT_D, 5U, 12U)
+#define GPIO_MUX_FSMC_NE1_PD7               GPIO_MUX(GPIO_PORT_D, 7U, 12U)
+#define GPIO_MUX_FSMC_NE2_PG9               GPIO_MUX(GPIO_PORT_G, 9U, 12U)
+#define GPIO_MUX_FSMC_NE3_PG10              GPIO_MUX(GPIO_PORT_G, 10U, 12U)
+#define GPIO_MUX_FSMC_NE4_PG12              GPIO_MUX(GPIO_PORT_G, 12U, 12U)
+#define GPIO_MUX_FSMC_A16_PD11              GPIO_MUX(GPIO_PORT_D, 11U, 12U)
+#define GPIO_MUX_FSMC_A17_PD12              GPIO_MUX(GPIO_PORT_D, 12U, 12U)
+#define GPIO_MUX_FSMC_A18_PD13              GPIO_MUX(GPIO_PORT_D, 13U, 12U)
+#define GPIO_MUX_FSMC_A19_PE3               GPIO_MUX(GPIO_PORT_E, 3U, 12U)
+#define GPIO_MUX_FSMC_A20_PE4               GPIO_MUX(GPIO_PORT_E, 4U, 12U)
+#define GPIO_MUX_SDIO_D0_PC8                GPIO_MUX(GPIO_PORT_C, 8U, 12U)
+#define GPIO_MUX_SDIO_D1_PC9                GPIO_MUX(GPIO_PORT_C, 9U, 12U)
+#define GPIO_MUX_SDIO_D2_PC10               GPIO_MUX(GPIO_PORT_C, 10U, 12U)
+#define GPIO_MUX_SDIO_D3_PC11               GPIO_MUX(GPIO_PORT_C, 11U, 12U)
+#define GPIO_MUX_SDIO_CK_PC12               GPIO_MUX(GPIO_PORT_C, 12U, 12U)
+#define GPIO_MUX_SDIO_CMD_PD2               GPIO_MUX(GPIO_PORT_D, 2U, 12U)
+
+/*------------------------------- Port AF configuration -------------------------------*/
+/**
+ * @brief   Alternate function setup of a whole port, computed at compile time
+ * @note    Build it with GPIO_AF_PORT_DEFINE(), apply it with HAL_GPIO_AFPortInit():
+ *          AFRL and AFRH are then written once each, there is no per-pin lookup at runtime.
+ */
+typedef struct
+{
+    uint32_t Port;          /*< Port index, must match the GPIOx passed to HAL_GPIO_AFPortInit >*/
+    uint32_t Pin;           /*< Pins switched to alternate function >*/
+    uint32_t AFRL;          /*< AFRL value for those pins >*/
+    uint32_t AFRLMsk;       /*< AFRL nibbles owned by those pins >*/
+    uint32_t AFRH;          /*< AFRH value for those pins >*/
+    uint32_t AFRHMsk;       /*< AFRH nibbles owned by those pins >*/
+} GPIO_AFPortTypeDef;
+
+/* Private: every helper takes exactly 16 signals (a port has 16 pins), callers pad with GPIO_MUX_NONE */
+#define _GPIO_AF_PAD16(...)         _GPIO_AF_ARG17(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U)
+#define _GPIO_AF_ARG17(m0,m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,m16,...) m16
+#define _GPIO_AF_OR16(m0,m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,...) \
+        (GPIO_MUX_PINMASK(m0) | \
+        GPIO_MUX_PINMASK(m1) | \
+        GPIO_MUX_PINMASK(m2) | \
+        GPIO_MUX_PINMASK(m3) | \
+        GPIO_MUX_PINMASK(m4) | \
+        GPIO_MUX_PINMASK(m5) | \
+        GPIO_MUX_PINMASK(m6) | \
+        GPIO_MUX_PINMASK(m7) | \
+        GPIO_MUX_PINMASK(m8) | \
+        GPIO_MUX_PINMASK(m9) | \
+        GPIO_MUX_PINMASK(m10) | \
+        GPIO_MUX_PINMASK(m11) | \
+        GPIO_MUX_PINMASK(m12) | \
+        GPIO_MUX_PINMASK(m13) | \
+        GPIO_MUX_PINMASK(m14) | \
+        GPIO_MUX_PINMASK(m15))
+#define _GPIO_AF_SUM16(m0,m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,...) \
+        (GPIO_MUX_PINMASK(m0) + \
+        GPIO_MUX_PINMASK(m1) + \
+        GPIO_MUX_PINMASK(m2) + \
+        GPIO_MUX_PINMASK(m3) + \
+        GPIO_MUX_PINMASK(m4) + \
+        GPIO_MUX_PINMASK(m5) + \
+        GPIO_MUX_PINMASK(m6) + \
+        GPIO_MUX_PINMASK(m7) + \
+        GPIO_MUX_PINMASK(m8) + \
+        GPIO_MUX_PINMASK(m9) + \
+        GPIO_MUX_PINMASK(m10) + \
+        GPIO_MUX_PINMASK(m11) + \
+        GPIO_MUX_PINMASK(m12) + \
+        GPIO_MUX_PINMASK(m13) + \
+        GPIO_MUX_PINMASK(m14) + \
+        GPIO_MUX_PINMASK(m15))
+#define _GPIO_AF_VALID16(m0,m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,...) \
+        (GPIO_MUX_IS_VALID(m0) && \
+        GPIO_MUX_IS_VALID(m1) && \
+        GPIO_MUX_IS_VALID(m2) && \
+        GPIO_MUX_IS_VALID(m3) && \
+        GPIO_MUX_IS_VALID(m4) && \
+        GPIO_MUX_IS_VALID(m5) && \
+        GPIO_MUX_IS_VALID(m6) && \
+        GPIO_MUX_IS_VALID(m7) && \
+        GPIO_MUX_IS_VALID(m8) && \
+        GPIO_MUX_IS_VALID(m9) && \
+        GPIO_MUX_IS_VALID(m10) && \
+        GPIO_MUX_IS_VALID(m11) && \
+        GPIO_MUX_IS_VALID(m12) && \
+        GPIO_MUX_IS_VALID(m13) && \
+        GPIO_MUX_IS_VALID(m14) && \
+        GPIO_MUX_IS_VALID(m15))
+#define _GPIO_AF_PORTOF16(m0,m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,...) \
+        GPIO_MUX_PORT(m0)
+#define _GPIO_AF_SAMEPORT16(m0,m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,...) \
+        (GPIO_MUX_ON_PORT(m0, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m1, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m2, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m3, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m4, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m5, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m6, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m7, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m8, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m9, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m10, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m11, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m12, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m13, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m14, GPIO_MUX_PORT(m0)) && \
+        GPIO_MUX_ON_PORT(m15, GPIO_MUX_PORT(m0)))
+#define _GPIO_AF_AFRL16(m0,m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,...) \
+        (GPIO_MUX_AFRL(m0) | \
+        GPIO_MUX_AFRL(m1) | \
+        GPIO_MUX_AFRL(m2) | \
+        GPIO_MUX_AFRL(m3) | \
+        GPIO_MUX_AFRL(m4) | \
+        GPIO_MUX_AFRL(m5) | \
+        GPIO_MUX_AFRL(m6) | \
+        GPIO_MUX_AFRL(m7) | \
+        GPIO_MUX_AFRL(m8) | \
+        GPIO_MUX_AFRL(m9) | \
+        GPIO_MUX_AFRL(m10) | \
+        GPIO_MUX_AFRL(m11) | \
+        GPIO_MUX_AFRL(m12) | \
+        GPIO_MUX_AFRL(m13) | \
+        GPIO_MUX_AFRL(m14) | \
+        GPIO_MUX_AFRL(m15))
+#define _GPIO_AF_AFRLMSK16(m0,m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,...) \
+        (GPIO_MUX_AFRL_MSK(m0) | \
+        GPIO_MUX_AFRL_MSK(m1) | \
+        GPIO_MUX_AFRL_MSK(m2) | \
+        GPIO_MUX_AFRL_MSK(m3) | \
+        GPIO_MUX_AFRL_MSK(m4) | \
+        GPIO_MUX_AFRL_MSK(m5) | \
+        GPIO_MUX_AFRL_MSK(m6) | \
+        GPIO_MUX_AFRL_MSK(m7) | \
+        GPIO_MUX_AFRL_MSK(m8) | \
+        GPIO_MUX_AFRL_MSK(m9) | \
+        GPIO_MUX_AFRL_MSK(m10) | \
+        GPIO_MUX_AFRL_MSK(m11) | \
+        GPIO_MUX_AFRL_MSK(m12) | \
+        GPIO_MUX_AFRL_MSK(m13) | \
+        GPIO_MUX_AFRL_MSK(m14) | \
+        GPIO_MUX_AFRL_MSK(m15))
+#define _GPIO_AF_AFRH16(m0,m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,...) \
+        (GPIO_MUX_AFRH(m0) | \
+        GPIO_MUX_AFRH(m1) | \
+        GPIO_MUX_AFRH(m2) | \
+        GPIO_MUX_AFRH(m3) | \
+        GPIO_MUX_AFRH(m4) | \
+        GPIO_MUX_AFRH(m5) | \
+        GPIO_MUX_AFRH(m6) | \
+        GPIO_MUX_AFRH(m7) | \
+        GPIO_MUX_AFRH(m8) | \
+        GPIO_MUX_AFRH(m9) | \
+        GPIO_MUX_AFRH(m10) | \
+        GPIO_MUX_AFRH(m11) | \
+        GPIO_MUX_AFRH(m12) | \
+        GPIO_MUX_AFRH(m13) | \
+        GPIO_MUX_AFRH(m14) | \
+        GPIO_MUX_AFRH(m15))
+#define _GPIO_AF_AFRHMSK16(m0,m1,m2,m3,m4,m5,m6,m7,m8,m9,m10,m11,m12,m13,m14,m15,...) \
+        (GPIO_MUX_AFRH_MSK(m0) | \
+        GPIO_MUX_AFRH_MSK(m1) | \
+        GPIO_MUX_AFRH_MSK(m2) | \
+        GPIO_MUX_AFRH_MSK(m3) | \
+        GPIO_MUX_AFRH_MSK(m4) | \
+        GPIO_MUX_AFRH_MSK(m5) | \
+        GPIO_MUX_AFRH_MSK(m6) | \
+        GPIO_MUX_AFRH_MSK(m7) | \
+        GPIO_MUX_AFRH_MSK(m8) | \
+        GPIO_MUX_AFRH_MSK(m9) | \
+        GPIO_MUX_AFRH_MSK(m10) | \
+        GPIO_MUX_AFRH_MSK(m11) | \
+        GPIO_MUX_AFRH_MSK(m12) | \
+        GPIO_MUX_AFRH_MSK(m13) | \
+        GPIO_MUX_AFRH_MSK(m14) | \
+        GPIO_MUX_AFRH_MSK(m15))
+
+#define GPIO_AF_PINS(...)           _GPIO_AF_OR16(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U)
+#define GPIO_AF_NO_CONFLICT(...)    (_GPIO_AF_OR16(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U) == _GPIO_AF_SUM16(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U))
+#define GPIO_AF_ALL_VALID(...)      _GPIO_AF_VALID16(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U)
+#define GPIO_AF_SAME_PORT(...)      _GPIO_AF_SAMEPORT16(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U)
+#define GPIO_AF_AT_MOST_16(...)     (_GPIO_AF_PAD16(__VA_ARGS__) == GPIO_MUX_NONE)
+
+#define GPIO_AF_PORT_INIT(...)  {                                                           \
+        .Port    = _GPIO_AF_PORTOF16(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U),      \
+        .Pin     = _GPIO_AF_OR16(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U),          \
+        .AFRL    = _GPIO_AF_AFRL16(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U),        \
+        .AFRLMsk = _GPIO_AF_AFRLMSK16(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U),     \
+        .AFRH    = _GPIO_AF_AFRH16(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U),        \
+        .AFRHMsk = _GPIO_AF_AFRHMSK16(__VA_ARGS__, 0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U,0U),     \
+    }
+
+/**
+ * @brief   Define a checked, constant port AF configuration
+ * @note    Any of these is a compile error:
+ *            - two signals on the same pin
+ *            - signals from different ports in one configuration
+ *            - an AF number > 15 or a pin number > 15 (hand-written GPIO_MUX entries)
+ *            - more than 16 signals
+ *
+ *          GPIO_AF_PORT_DEFINE(spi1_pins, GPIO_MUX_SPI1_SCK_PA5,
+ *                                         GPIO_MUX_SPI1_MISO_PA6,
+ *                                         GPIO_MUX_SPI1_MOSI_PA7);
+ *          ...
+ *          HAL_GPIO_AFPortInit(GPIOA, &spi1_pins, &GPIO_InitStruct);
+ */
+#define GPIO_AF_PORT_DEFINE(NAME, ...)                                                                  \
+    _Static_assert(GPIO_AF_AT_MOST_16(__VA_ARGS__), "GPIO AF: more than 16 signals on one port");       \
+    _Static_assert(GPIO_AF_ALL_VALID(__VA_ARGS__),  "GPIO AF: invalid port, pin or AF number");         \
+    _Static_assert(GPIO_AF_SAME_PORT(__VA_ARGS__),  "GPIO AF: signals belong to different ports");      \
+    _Static_assert(GPIO_AF_NO_CONFLICT(__VA_ARGS__), "GPIO AF: two signals mapped on the same pin");    \
+    static const GPIO_AFPortTypeDef NAME = GPIO_AF_PORT_INIT(__VA_ARGS__)
+
+#endif // _STM32F4XX_HAL_GPIO_EX_H_
\ No newline at end of file
@@ -0,0 +1,61 @@
+#ifndef _STM32F4XX_HAL_PWR_H_
+#define _STM32F4XX_HAL_PWR_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal_def.h"
+
+/**
+ * @brief   Power control: low-power modes, backup domain access, voltage scaling
+ * @note    The PWR clock must be enabled first (__HAL_RCC_PWR_CLK_ENABLE()).
+ *
+ *          - SLEEP: the core clock stops, peripherals, DMA and SysTick keep running.
+ *            Any interrupt wakes it up in a few cycles.
+ *          - STOP: all clocks in the 1.2 V domain stop (PLL, HSI, HSE off), SRAM and
+ *            registers are kept. Only EXTI lines wake it up (GPIO, RTC wakeup on line 22,
+ *            RTC alarm on line 17...), and the core restarts on HSI 16 MHz: PLL and HSE
+ *            have to be started again by software. The low-power regulator and the flash
+ *            power-down each cut the STOP current further and add to the wake time.
+ *
+ *          Both enter with WFI. With PRIMASK set the core still wakes up on a pending
+ *          interrupt but does not take it, so the caller can restore the clocks before
+ *          any handler runs.
+ */
+
+/*--------------------------------- Macros ---------------------------------*/
+/**
+ * @defgroup PWR_STOP_Regulator
+ * @note    PWR_FLASH_POWERDOWN can be OR'ed with either regulator setting
+ */
+#define PWR_MAINREGULATOR_ON            0x00000000U
+#define PWR_LOWPOWERREGULATOR_ON        PWR_CR_LPDS
+#define PWR_FLASH_POWERDOWN             PWR_CR_FPDS
+
+#define IS_PWR_STOP_REGULATOR(REG)      (((REG) & ~(PWR_CR_LPDS | PWR_CR_FPDS)) == 0U)
+
+/**
+ * @defgroup PWR_Regulator_Voltage_Scale
+ * @note    Scale 1 is needed above 144 MHz
+ */
+#define PWR_REGULATOR_VOLTAGE_SCALE1    PWR_CR_VOS
+#define PWR_REGULATOR_VOLTAGE_SCALE2    0x00000000U
+
+/**
+ * @brief   Select the regulator voltage scale, only while the PLL is off
+ */
+#define __HAL_PWR_VOLTAGESCALING_CONFIG(__REGULATOR__)  MODIFY_REG(PWR->CR, PWR_CR_VOS, (__REGULATOR__))
+
+/*------------------------------ HAL_PWR APIs ----------------------------------*/
+void HAL_PWR_EnableBkUpAccess(void);
+void HAL_PWR_DisableBkUpAccess(void);
+
+void HAL_PWR_EnterSLEEPMode(void);
+void HAL_PWR_EnterSTOPMode(uint32_t Regulator);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STM32F4XX_HAL_PWR_H_
\ No newline at end of file
@@ -99,6 +99,8 @@ typedef struct
  *          @arg RCC_HSE_OFF    : Turn off HSE Osc
  *          @arg RCC_HSE_ON     : Turn on HSE Osc
  *          @arg RCC_HSE_BYPASS : HSE Osc bypassed with the external clock (HSE Osc must be disabled first)
+ * @note:  HSEBYP can only be written while HSEON is 0, so the two bits are separate
+ *         accesses in that order, not one MODIFY_REG().
  */
 #define __HAL_RCC_HSE_CONFIG(__STATE__)                     \
                 do {                                        \
@@ -160,9 +162,66 @@ typedef struct
                                             UNUSED(tempreg); \
                                         } while(0U)
 
+/**
+ * @brief   Generic form of the clock enable macros above, same read-back delay
+ */
+#define __HAL_RCC_CLK_ENABLE(__REG__, __BIT__)  do { \
+                                            __IO uint32_t tempreg = 0x00U; \
+                                            SET_BIT((__REG__), (__BIT__)); \
+                                            tempreg = READ_BIT((__REG__), (__BIT__)); \
+                                            UNUSED(tempreg); \
+                                        } while (0U)
+#define __HAL_RCC_CLK_DISABLE(__REG__, __BIT__) CLEAR_BIT((__REG__), (__BIT__))
+
+#define __HAL_RCC_DMA1_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->AHB1ENR, RCC_AHB1ENR_DMA1EN)
+#define __HAL_RCC_DMA2_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->AHB1ENR, RCC_AHB1ENR_DMA2EN)
+#define __HAL_RCC_FSMC_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->AHB3ENR, RCC_AHB3ENR_FSMCEN)
+
+#define __HAL_RCC_TIM1_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB2ENR, RCC_APB2ENR_TIM1EN)
+#define __HAL_RCC_TIM2_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_TIM2EN)
+#define __HAL_RCC_TIM3_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_TIM3EN)
+#define __HAL_RCC_TIM4_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_TIM4EN)
+#define __HAL_RCC_TIM5_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_TIM5EN)
+#define __HAL_RCC_TIM6_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_TIM6EN)
+#define __HAL_RCC_TIM7_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_TIM7EN)
+#define __HAL_RCC_TIM8_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB2ENR, RCC_APB2ENR_TIM8EN)
+#define __HAL_RCC_TIM9_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB2ENR, RCC_APB2ENR_TIM9EN)
+#define __HAL_RCC_TIM10_CLK_ENABLE()    __HAL_RCC_CLK_ENABLE(RCC->APB2ENR, RCC_APB2ENR_TIM10EN)
+#define __HAL_RCC_TIM11_CLK_ENABLE()    __HAL_RCC_CLK_ENABLE(RCC->APB2ENR, RCC_APB2ENR_TIM11EN)
+#define __HAL_RCC_TIM12_CLK_ENABLE()    __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_TIM12EN)
+#define __HAL_RCC_TIM13_CLK_ENABLE()    __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_TIM13EN)
+#define __HAL_RCC_TIM14_CLK_ENABLE()    __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_TIM14EN)
+
+#define __HAL_RCC_ADC1_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB2ENR, RCC_APB2ENR_ADC1EN)
+#define __HAL_RCC_ADC2_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB2ENR, RCC_APB2ENR_ADC2EN)
+#define __HAL_RCC_ADC3_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB2ENR, RCC_APB2ENR_ADC3EN)
+
+#define __HAL_RCC_CAN1_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_CAN1EN)
+#define __HAL_RCC_CAN2_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_CAN2EN)
+#define __HAL_RCC_DAC_CLK_ENABLE()      __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_DACEN)
+#define __HAL_RCC_PWR_CLK_ENABLE()      __HAL_RCC_CLK_ENABLE(RCC->APB1ENR, RCC_APB1ENR_PWREN)
+#define __HAL_RCC_SDIO_CLK_ENABLE()     __HAL_RCC_CLK_ENABLE(RCC->APB2ENR, RCC_APB2ENR_SDIOEN)
+#define __HAL_RCC_SYSCFG_CLK_ENABLE()   __HAL_RCC_CLK_ENABLE(RCC->APB2ENR, RCC_APB2ENR_SYSCFGEN)
+#define __HAL_RCC_ETHMAC_CLK_ENABLE()   __HAL_RCC_CLK_ENABLE(RCC->AHB1ENR, RCC_AHB1ENR_ETHMACEN | \
+                                                          RCC_AHB1ENR_ETHMACTXEN | RCC_AHB1ENR_ETHMACRXEN)
+#define __HAL_RCC_ETHMAC_CLK_DISABLE()  __HAL_RCC_CLK_DISABLE(RCC->AHB1ENR, RCC_AHB1ENR_ETHMACEN | \
+                                                          RCC_AHB1ENR_ETHMACTXEN | RCC_AHB1ENR_ETHMACRXEN)
+
+/**
+ * @brief   RCC peripheral reset
+ */
+#define __HAL_RCC_ETHMAC_FORCE_RESET()      SET_BIT(RCC->AHB1RSTR, RCC_AHB1RSTR_ETHMACRST)
+#define __HAL_RCC_ETHMAC_RELEASE_RESET()    CLEAR_BIT(RCC->AHB1RSTR, RCC_AHB1RSTR_ETHMACRST)
+
 /*------------------------------ HAL_RCC APIs ----------------------------------*/
 HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct);
 
+uint32_t HAL_RCC_GetSysClockFreq(void);
+uint32_t HAL_RCC_GetHCLKFreq(void);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint32_t HAL_RCC_GetPCLK2Freq(void);
+uint32_t HAL_RCC_GetPLL48CLKFreq(void);
+
 
 
 #ifdef __cplusplus
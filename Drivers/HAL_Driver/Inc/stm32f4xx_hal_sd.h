@@ -0,0 +1,170 @@
+#ifndef _STM32F4XX_HAL_SD_H_
+#define _STM32F4XX_HAL_SD_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal_def.h"
+#include "stm32f4xx_hal_dma.h"
+
+/**
+ * @brief   SD card (SDSC / SDHC / SDXC) on the SDIO host, 1 or 4-bit bus
+ * @note    Pins: CK PC12, CMD PD2, D0..D3 PC8..PC11, AF12, pull-ups on CMD and D0..D3.
+ *          SDIOCLK is PLL48CLK (48 MHz): the bus runs at 48 / (CLKDIV + 2), so 400 kHz for
+ *          identification and up to 24 MHz (default speed) for transfers, ~10 MB/s on a
+ *          4-bit bus. Bypass / high speed is not used.
+ *
+ *          Transfers are DMA only: DMA2 channel 4, stream 3 (hdmarx) or 6 (hdmatx), the
+ *          same stream may be linked as both. The stream must be set up with DMA_PFCTRL
+ *          (the SDIO ends the transfer), word sizes on both sides, FIFO full threshold and
+ *          INC4 bursts on both sides, very high priority. Direction is set by the driver.
+ *
+ *          Hardware flow control is left off (errata: CK glitches with HWFC_EN), so the
+ *          DMA has to keep up with the FIFO; avoid long bursts from other masters on the
+ *          same bus matrix slave while a transfer runs.
+ *
+ *          Multi-block writes are preceded by ACMD23 with the block count: the card may
+ *          pre-erase the whole range, which is what makes CMD25 much faster than single
+ *          block writes. After a write completes the card is still programming (busy on
+ *          D0); HAL_SD_GetCardState() returns HAL_SD_CARD_TRANSFER once it is done.
+ */
+
+/**
+ * @brief: SD bus configuration
+ */
+typedef struct
+{
+    uint32_t ClockFreq;             /*< Transfer bus clock in Hz, <= SD_TRANSFER_CLOCK_MAX. Rounded down >*/
+    uint32_t BusWide;               /*< SD_BUS_WIDE_1B / SD_BUS_WIDE_4B >*/
+    uint32_t ClockPowerSave;        /*< SD_CLOCK_POWER_SAVE_DISABLE / ENABLE: stop CK while the bus is idle >*/
+} SD_InitTypeDef;
+
+/**
+ * @brief: Card information, filled by HAL_SD_Init()
+ */
+typedef struct
+{
+    uint32_t CardType;              /*< SD_CARD_SDSC / SD_CARD_SDHC_SDXC >*/
+    uint32_t Rca;                   /*< Relative card address >*/
+    uint32_t BlockCount;            /*< Capacity in SD_BLOCK_SIZE blocks >*/
+    uint32_t BusClock;              /*< Actual transfer bus clock in Hz >*/
+    uint32_t Cid[4];                /*< Raw CID, Cid[0] = bits 127:96 >*/
+    uint32_t Csd[4];                /*< Raw CSD, Csd[0] = bits 127:96 >*/
+} SD_CardInfoTypeDef;
+
+/**
+ * @brief: SD state
+ */
+typedef enum
+{
+    HAL_SD_STATE_RESET      = 0x00U,
+    HAL_SD_STATE_READY      = 0x01U,
+    HAL_SD_STATE_BUSY       = 0x02U,        /*< DMA transfer in progress >*/
+    HAL_SD_STATE_ERROR      = 0x04U         /*< Identification failed >*/
+} HAL_SD_StateTypeDef;
+
+/**
+ * @brief: Card state (CURRENT_STATE of the R1 status)
+ */
+typedef enum
+{
+    HAL_SD_CARD_READY           = 0x01U,
+    HAL_SD_CARD_IDENTIFICATION  = 0x02U,
+    HAL_SD_CARD_STANDBY         = 0x03U,
+    HAL_SD_CARD_TRANSFER        = 0x04U,    /*< Idle, selected >*/
+    HAL_SD_CARD_SENDING         = 0x05U,
+    HAL_SD_CARD_RECEIVING       = 0x06U,
+    HAL_SD_CARD_PROGRAMMING     = 0x07U,    /*< Busy writing or erasing >*/
+    HAL_SD_CARD_DISCONNECTED    = 0x08U,
+    HAL_SD_CARD_ERROR           = 0xFFU     /*< CMD13 failed >*/
+} HAL_SD_CardStateTypeDef;
+
+/**
+ * @brief: SD handle
+ */
+typedef struct __SD_HandleTypeDef
+{
+    SDIO_TypeDef                *Instance;
+    SD_InitTypeDef              Init;
+    SD_CardInfoTypeDef          Card;
+    __IO HAL_SD_StateTypeDef    State;
+    __IO uint32_t               ErrorCode;      /*< See @ref SD_Error_Code >*/
+    __IO uint32_t               Context;        /*< See @ref SD_Context, transfer in progress >*/
+    uint32_t                    DataTimeout;    /*< DTIMER value, bus clock cycles >*/
+    DMA_HandleTypeDef           *hdmarx;
+    DMA_HandleTypeDef           *hdmatx;
+} SD_HandleTypeDef;
+
+/*--------------------------------- Macros ---------------------------------*/
+/**
+ * @defgroup SD_Error_Code
+ */
+#define HAL_SD_ERROR_NONE           0x00000000U
+#define HAL_SD_ERROR_CMD_CRC_FAIL   0x00000001U     /*< Command response CRC check failed >*/
+#define HAL_SD_ERROR_DATA_CRC_FAIL  0x00000002U     /*< Data block CRC check failed >*/
+#define HAL_SD_ERROR_CMD_RSP_TIMEOUT 0x00000004U    /*< No command response >*/
+#define HAL_SD_ERROR_DATA_TIMEOUT   0x00000008U
+#define HAL_SD_ERROR_TX_UNDERRUN    0x00000010U     /*< DMA did not keep up with the bus >*/
+#define HAL_SD_ERROR_RX_OVERRUN     0x00000020U
+#define HAL_SD_ERROR_START_BIT      0x00000040U     /*< Start bit missing on a data line (4-bit) >*/
+#define HAL_SD_ERROR_CARD_STATUS    0x00000080U     /*< R1 error bits set (address, erase, CRC, ...) >*/
+#define HAL_SD_ERROR_UNSUPPORTED    0x00000100U     /*< Not an SD memory card, or voltage range refused >*/
+#define HAL_SD_ERROR_CLOCK          0x00000200U     /*< PLL48CLK not running >*/
+#define HAL_SD_ERROR_ADDRESS        0x00000400U     /*< Block range beyond the card capacity >*/
+#define HAL_SD_ERROR_DMA            0x00000800U
+#define HAL_SD_ERROR_TIMEOUT        0x00001000U     /*< Software timeout (command path or busy card) >*/
+
+/**
+ * @defgroup SD_Context
+ */
+#define SD_CONTEXT_NONE             0x00U
+#define SD_CONTEXT_READ             0x01U
+#define SD_CONTEXT_WRITE            0x02U
+#define SD_CONTEXT_MULTIBLOCK       0x04U           /*< Needs CMD12 at the end >*/
+
+#define SD_CARD_SDSC                0x00U           /*< Byte addressed, <= 2 GB >*/
+#define SD_CARD_SDHC_SDXC           0x01U           /*< Block addressed >*/
+
+#define SD_BUS_WIDE_1B              0x00000000U
+#define SD_BUS_WIDE_4B              (0x1UL << SDIO_CLKCR_WIDBUS_Pos)
+
+#define SD_CLOCK_POWER_SAVE_DISABLE 0x00000000U
+#define SD_CLOCK_POWER_SAVE_ENABLE  SDIO_CLKCR_PWRSAV
+
+#define SD_BLOCK_SIZE               512U
+#define SD_INIT_CLOCK               400000U         /*< Identification mode maximum >*/
+#define SD_TRANSFER_CLOCK_MAX       24000000U       /*< 48 MHz / 2, within the 25 MHz default speed >*/
+#define SD_MAX_XFER_BLOCKS          256U            /*< Per command, keeps the DMA NDTR in range >*/
+
+#define IS_SD_BUS_WIDE(WIDE)        (((WIDE) == SD_BUS_WIDE_1B) || ((WIDE) == SD_BUS_WIDE_4B))
+#define IS_SD_XFER_BLOCKS(COUNT)    (((COUNT) >= 1U) && ((COUNT) <= SD_MAX_XFER_BLOCKS))
+
+/*------------------------------ HAL_SD APIs ----------------------------------*/
+HAL_StatusTypeDef HAL_SD_Init(SD_HandleTypeDef *hsd);
+HAL_StatusTypeDef HAL_SD_DeInit(SD_HandleTypeDef *hsd);
+
+/* DMA transfers, completion through the callbacks (or HAL_SD_GetState() == READY) */
+HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks);
+HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, const uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks);
+HAL_StatusTypeDef HAL_SD_Abort(SD_HandleTypeDef *hsd);
+
+/* Card management (polled commands, not while a transfer runs) */
+HAL_StatusTypeDef HAL_SD_Erase(SD_HandleTypeDef *hsd, uint32_t BlockStart, uint32_t BlockEnd);
+HAL_SD_CardStateTypeDef HAL_SD_GetCardState(SD_HandleTypeDef *hsd);
+HAL_StatusTypeDef HAL_SD_WaitCardReady(SD_HandleTypeDef *hsd, uint32_t Timeout);
+
+/* IRQ handler and callbacks */
+void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd);
+void HAL_SD_TxCpltCallback(SD_HandleTypeDef *hsd);
+void HAL_SD_RxCpltCallback(SD_HandleTypeDef *hsd);
+void HAL_SD_ErrorCallback(SD_HandleTypeDef *hsd);
+
+HAL_SD_StateTypeDef HAL_SD_GetState(SD_HandleTypeDef *hsd);
+uint32_t HAL_SD_GetError(SD_HandleTypeDef *hsd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STM32F4XX_HAL_SD_H_
\ No newline at end of file
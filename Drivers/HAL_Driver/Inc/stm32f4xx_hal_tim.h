@@ -0,0 +1,374 @@
+#ifndef _STM32F4XX_HAL_TIM_H_
+#define _STM32F4XX_HAL_TIM_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal_def.h"
+#include "stm32f4xx_hal_dma.h"
+
+/**
+ * @brief: Time base configuration
+ */
+typedef struct
+{
+    uint32_t Prescaler;             /*< Counter clock = timer clock / (Prescaler + 1), 0x0000 ~ 0xFFFF >*/
+    uint32_t CounterMode;           /*< See @ref TIM_Counter_Mode >*/
+    uint32_t Period;                /*< Auto-reload value, 16 bit (32 bit on TIM2/TIM5) >*/
+    uint32_t ClockDivision;         /*< tDTS for dead-time and input filters. See @ref TIM_ClockDivision >*/
+    uint32_t RepetitionCounter;     /*< TIM1/TIM8 only: update event every (RepetitionCounter + 1) periods >*/
+    uint32_t AutoReloadPreload;     /*< TIM_AUTORELOAD_PRELOAD_DISABLE / ENABLE >*/
+} TIM_Base_InitTypeDef;
+
+/**
+ * @brief: Output compare / PWM channel configuration
+ */
+typedef struct
+{
+    uint32_t OCMode;                /*< See @ref TIM_Output_Compare_Mode >*/
+    uint32_t Pulse;                 /*< Compare value loaded into CCRx >*/
+    uint32_t OCPolarity;            /*< TIM_OCPOLARITY_HIGH / LOW >*/
+    uint32_t OCNPolarity;           /*< TIM_OCNPOLARITY_HIGH / LOW, TIM1/TIM8 only >*/
+    uint32_t OCFastMode;            /*< TIM_OCFAST_DISABLE / ENABLE, PWM modes only >*/
+    uint32_t OCIdleState;           /*< TIM_OCIDLESTATE_SET / RESET, TIM1/TIM8 only >*/
+    uint32_t OCNIdleState;          /*< TIM_OCNIDLESTATE_SET / RESET, TIM1/TIM8 only >*/
+} TIM_OC_InitTypeDef;
+
+/**
+ * @brief: Input capture channel configuration
+ */
+typedef struct
+{
+    uint32_t ICPolarity;            /*< See @ref TIM_Input_Capture_Polarity >*/
+    uint32_t ICSelection;           /*< See @ref TIM_Input_Capture_Selection >*/
+    uint32_t ICPrescaler;           /*< See @ref TIM_Input_Capture_Prescaler >*/
+    uint32_t ICFilter;              /*< Digital filter, 0x0 ~ 0xF >*/
+} TIM_IC_InitTypeDef;
+
+/**
+ * @brief: Break and dead-time configuration (TIM1/TIM8)
+ */
+typedef struct
+{
+    uint32_t OffStateRunMode;       /*< TIM_OSSR_ENABLE / DISABLE >*/
+    uint32_t OffStateIDLEMode;      /*< TIM_OSSI_ENABLE / DISABLE >*/
+    uint32_t LockLevel;             /*< See @ref TIM_Lock_level >*/
+    uint32_t DeadTime;              /*< Raw DTG field 0x00 ~ 0xFF, see HAL_TIMEx_DeadTimeEncode() >*/
+    uint32_t BreakState;            /*< TIM_BREAK_ENABLE / DISABLE >*/
+    uint32_t BreakPolarity;         /*< TIM_BREAKPOLARITY_LOW / HIGH >*/
+    uint32_t AutomaticOutput;       /*< TIM_AUTOMATICOUTPUT_ENABLE / DISABLE >*/
+} TIM_BreakDeadTimeConfigTypeDef;
+
+/**
+ * @brief: TIM state
+ */
+typedef enum
+{
+    HAL_TIM_STATE_RESET     = 0x00U,
+    HAL_TIM_STATE_READY     = 0x01U,
+    HAL_TIM_STATE_BUSY      = 0x02U,
+    HAL_TIM_STATE_ERROR     = 0x04U,
+} HAL_TIM_StateTypeDef;
+
+/**
+ * @brief: Channel that triggered the current callback
+ */
+typedef enum
+{
+    HAL_TIM_ACTIVE_CHANNEL_1        = 0x01U,
+    HAL_TIM_ACTIVE_CHANNEL_2        = 0x02U,
+    HAL_TIM_ACTIVE_CHANNEL_3        = 0x04U,
+    HAL_TIM_ACTIVE_CHANNEL_4        = 0x08U,
+    HAL_TIM_ACTIVE_CHANNEL_CLEARED  = 0x00U,
+} HAL_TIM_ActiveChannel;
+
+/**
+ * @brief: DMA handle index in TIM_HandleTypeDef.hdma
+ */
+#define TIM_DMA_ID_UPDATE       0U
+#define TIM_DMA_ID_CC1          1U
+#define TIM_DMA_ID_CC2          2U
+#define TIM_DMA_ID_CC3          3U
+#define TIM_DMA_ID_CC4          4U
+#define TIM_DMA_ID_MAX          5U
+
+/**
+ * @brief: TIM handle
+ */
+typedef struct
+{
+    TIM_TypeDef                 *Instance;
+    TIM_Base_InitTypeDef        Init;
+    HAL_TIM_ActiveChannel       Channel;
+    DMA_HandleTypeDef           *hdma[TIM_DMA_ID_MAX];  /*< Linked by the user, see __HAL_LINKDMA >*/
+    __IO HAL_TIM_StateTypeDef   State;
+} TIM_HandleTypeDef;
+
+/*--------------------------------- Macros ---------------------------------*/
+/**
+ * @defgroup TIM_Channel
+ * @note     The value is the channel's bit offset in CCER and 4x its CCRx index.
+ */
+#define TIM_CHANNEL_1               0x00000000U
+#define TIM_CHANNEL_2               0x00000004U
+#define TIM_CHANNEL_3               0x00000008U
+#define TIM_CHANNEL_4               0x0000000CU
+#define IS_TIM_CHANNELS(CHANNEL)    (((CHANNEL) == TIM_CHANNEL_1) || ((CHANNEL) == TIM_CHANNEL_2) || \
+                                     ((CHANNEL) == TIM_CHANNEL_3) || ((CHANNEL) == TIM_CHANNEL_4))
+#define IS_TIM_COMPLEMENTARY_CHANNELS(CHANNEL) (((CHANNEL) == TIM_CHANNEL_1) || ((CHANNEL) == TIM_CHANNEL_2) || \
+                                                ((CHANNEL) == TIM_CHANNEL_3))
+
+/**
+ * @defgroup TIM_Counter_Mode
+ */
+#define TIM_COUNTERMODE_UP              0x00000000U
+#define TIM_COUNTERMODE_DOWN            TIM_CR1_DIR
+#define TIM_COUNTERMODE_CENTERALIGNED1  (0x1UL << TIM_CR1_CMS_Pos)
+#define TIM_COUNTERMODE_CENTERALIGNED2  (0x2UL << TIM_CR1_CMS_Pos)
+#define TIM_COUNTERMODE_CENTERALIGNED3  (0x3UL << TIM_CR1_CMS_Pos)
+
+/**
+ * @defgroup TIM_ClockDivision
+ */
+#define TIM_CLOCKDIVISION_DIV1          0x00000000U
+#define TIM_CLOCKDIVISION_DIV2          (0x1UL << TIM_CR1_CKD_Pos)
+#define TIM_CLOCKDIVISION_DIV4          (0x2UL << TIM_CR1_CKD_Pos)
+
+#define TIM_AUTORELOAD_PRELOAD_DISABLE  0x00000000U
+#define TIM_AUTORELOAD_PRELOAD_ENABLE   TIM_CR1_ARPE
+
+/**
+ * @defgroup TIM_Output_Compare_Mode
+ */
+#define TIM_OCMODE_TIMING               (0x0UL << TIM_CCMR1_OC1M_Pos)
+#define TIM_OCMODE_ACTIVE               (0x1UL << TIM_CCMR1_OC1M_Pos)
+#define TIM_OCMODE_INACTIVE             (0x2UL << TIM_CCMR1_OC1M_Pos)
+#define TIM_OCMODE_TOGGLE               (0x3UL << TIM_CCMR1_OC1M_Pos)
+#define TIM_OCMODE_FORCED_INACTIVE      (0x4UL << TIM_CCMR1_OC1M_Pos)
+#define TIM_OCMODE_FORCED_ACTIVE        (0x5UL << TIM_CCMR1_OC1M_Pos)
+#define TIM_OCMODE_PWM1                 (0x6UL << TIM_CCMR1_OC1M_Pos)
+#define TIM_OCMODE_PWM2                 (0x7UL << TIM_CCMR1_OC1M_Pos)
+
+#define TIM_OCPOLARITY_HIGH             0x00000000U
+#define TIM_OCPOLARITY_LOW              TIM_CCER_CC1P
+#define TIM_OCNPOLARITY_HIGH            0x00000000U
+#define TIM_OCNPOLARITY_LOW             TIM_CCER_CC1NP
+#define TIM_OCFAST_DISABLE              0x00000000U
+#define TIM_OCFAST_ENABLE               TIM_CCMR1_OC1FE
+#define TIM_OCIDLESTATE_RESET           0x00000000U
+#define TIM_OCIDLESTATE_SET             TIM_CR2_OIS1
+#define TIM_OCNIDLESTATE_RESET          0x00000000U
+#define TIM_OCNIDLESTATE_SET            TIM_CR2_OIS1N
+
+/**
+ * @defgroup TIM_Input_Capture_Polarity
+ */
+#define TIM_ICPOLARITY_RISING           0x00000000U
+#define TIM_ICPOLARITY_FALLING          TIM_CCER_CC1P
+#define TIM_ICPOLARITY_BOTHEDGE         (TIM_CCER_CC1P | TIM_CCER_CC1NP)
+
+/**
+ * @defgroup TIM_Input_Capture_Selection
+ */
+#define TIM_ICSELECTION_DIRECTTI        (0x1UL << TIM_CCMR1_CC1S_Pos)   /*< ICx on TIx >*/
+#define TIM_ICSELECTION_INDIRECTTI      (0x2UL << TIM_CCMR1_CC1S_Pos)   /*< IC1 on TI2, IC2 on TI1, ... >*/
+#define TIM_ICSELECTION_TRC             (0x3UL << TIM_CCMR1_CC1S_Pos)
+
+/**
+ * @defgroup TIM_Input_Capture_Prescaler
+ */
+#define TIM_ICPSC_DIV1                  (0x0UL << TIM_CCMR1_IC1PSC_Pos)
+#define TIM_ICPSC_DIV2                  (0x1UL << TIM_CCMR1_IC1PSC_Pos)
+#define TIM_ICPSC_DIV4                  (0x2UL << TIM_CCMR1_IC1PSC_Pos)
+#define TIM_ICPSC_DIV8                  (0x3UL << TIM_CCMR1_IC1PSC_Pos)
+
+/**
+ * @defgroup TIM_Break_Dead_Time
+ */
+#define TIM_OSSR_DISABLE                0x00000000U
+#define TIM_OSSR_ENABLE                 TIM_BDTR_OSSR
+#define TIM_OSSI_DISABLE                0x00000000U
+#define TIM_OSSI_ENABLE                 TIM_BDTR_OSSI
+#define TIM_BREAK_DISABLE               0x00000000U
+#define TIM_BREAK_ENABLE                TIM_BDTR_BKE
+#define TIM_BREAKPOLARITY_LOW           0x00000000U
+#define TIM_BREAKPOLARITY_HIGH          TIM_BDTR_BKP
+#define TIM_AUTOMATICOUTPUT_DISABLE     0x00000000U
+#define TIM_AUTOMATICOUTPUT_ENABLE      TIM_BDTR_AOE
+
+/**
+ * @defgroup TIM_Lock_level
+ */
+#define TIM_LOCKLEVEL_OFF               (0x0UL << TIM_BDTR_LOCK_Pos)
+#define TIM_LOCKLEVEL_1                 (0x1UL << TIM_BDTR_LOCK_Pos)
+#define TIM_LOCKLEVEL_2                 (0x2UL << TIM_BDTR_LOCK_Pos)
+#define TIM_LOCKLEVEL_3                 (0x3UL << TIM_BDTR_LOCK_Pos)
+
+/**
+ * @defgroup TIM_Master_Mode_Selection (TRGO source for ADC/DAC triggers and slave timers)
+ */
+#define TIM_TRGO_RESET                  (0x0UL << TIM_CR2_MMS_Pos)
+#define TIM_TRGO_ENABLE                 (0x1UL << TIM_CR2_MMS_Pos)
+#define TIM_TRGO_UPDATE                 (0x2UL << TIM_CR2_MMS_Pos)
+#define TIM_TRGO_OC1                    (0x3UL << TIM_CR2_MMS_Pos)
+#define TIM_TRGO_OC1REF                 (0x4UL << TIM_CR2_MMS_Pos)
+#define TIM_TRGO_OC2REF                 (0x5UL << TIM_CR2_MMS_Pos)
+#define TIM_TRGO_OC3REF                 (0x6UL << TIM_CR2_MMS_Pos)
+#define TIM_TRGO_OC4REF                 (0x7UL << TIM_CR2_MMS_Pos)
+
+/**
+ * @defgroup TIM_Interrupt / TIM_DMA / TIM_Flag
+ */
+#define TIM_IT_UPDATE                   TIM_DIER_UIE
+#define TIM_IT_CC1                      TIM_DIER_CC1IE
+#define TIM_IT_CC2                      TIM_DIER_CC2IE
+#define TIM_IT_CC3                      TIM_DIER_CC3IE
+#define TIM_IT_CC4                      TIM_DIER_CC4IE
+#define TIM_IT_COM                      TIM_DIER_COMIE
+#define TIM_IT_TRIGGER                  TIM_DIER_TIE
+#define TIM_IT_BREAK                    TIM_DIER_BIE
+
+#define TIM_DMA_UPDATE                  TIM_DIER_UDE
+#define TIM_DMA_CC1                     TIM_DIER_CC1DE
+#define TIM_DMA_CC2                     TIM_DIER_CC2DE
+#define TIM_DMA_CC3                     TIM_DIER_CC3DE
+#define TIM_DMA_CC4                     TIM_DIER_CC4DE
+
+#define TIM_FLAG_UPDATE                 TIM_SR_UIF
+#define TIM_FLAG_CC1                    TIM_SR_CC1IF
+#define TIM_FLAG_CC2                    TIM_SR_CC2IF
+#define TIM_FLAG_CC3                    TIM_SR_CC3IF
+#define TIM_FLAG_CC4                    TIM_SR_CC4IF
+#define TIM_FLAG_COM                    TIM_SR_COMIF
+#define TIM_FLAG_TRIGGER                TIM_SR_TIF
+#define TIM_FLAG_BREAK                  TIM_SR_BIF
+#define TIM_FLAG_CC1OF                  TIM_SR_CC1OF
+#define TIM_FLAG_CC2OF                  TIM_SR_CC2OF
+#define TIM_FLAG_CC3OF                  TIM_SR_CC3OF
+#define TIM_FLAG_CC4OF                  TIM_SR_CC4OF
+
+/**
+ * @defgroup TIM_DMA_Base_address
+ * @note     Register index (offset / 4) of the first register written by a DMA burst
+ */
+#define TIM_DMABASE_CR1                 0x00000000U
+#define TIM_DMABASE_DIER                0x00000003U
+#define TIM_DMABASE_CCMR1               0x00000006U
+#define TIM_DMABASE_CCMR2               0x00000007U
+#define TIM_DMABASE_CCER                0x00000008U
+#define TIM_DMABASE_PSC                 0x0000000AU
+#define TIM_DMABASE_ARR                 0x0000000BU
+#define TIM_DMABASE_RCR                 0x0000000CU
+#define TIM_DMABASE_CCR1                0x0000000DU
+#define TIM_DMABASE_CCR2                0x0000000EU
+#define TIM_DMABASE_CCR3                0x0000000FU
+#define TIM_DMABASE_CCR4                0x00000010U
+#define TIM_DMABASE_BDTR                0x00000011U
+
+/**
+ * @defgroup TIM_DMA_Burst_Length
+ */
+#define TIM_DMABURSTLENGTH(N)           ((uint32_t)((N) - 1U) << TIM_DCR_DBL_Pos)     /*< N = 1 ~ 18 transfers >*/
+#define TIM_DMABURSTLENGTH_1TRANSFER    TIM_DMABURSTLENGTH(1U)
+#define TIM_DMABURSTLENGTH_2TRANSFERS   TIM_DMABURSTLENGTH(2U)
+#define TIM_DMABURSTLENGTH_3TRANSFERS   TIM_DMABURSTLENGTH(3U)
+#define TIM_DMABURSTLENGTH_4TRANSFERS   TIM_DMABURSTLENGTH(4U)
+#define IS_TIM_DMA_LENGTH(LENGTH)       ((((LENGTH) & ~TIM_DCR_DBL_Msk) == 0U) && \
+                                         ((LENGTH) <= TIM_DMABURSTLENGTH(18U)))
+#define IS_TIM_DMA_BASE(BASE)           ((BASE) <= TIM_DMABASE_BDTR)
+
+/**
+ * @brief   TIM register helpers
+ */
+#define __HAL_TIM_ENABLE(__HANDLE__)            SET_BIT((__HANDLE__)->Instance->CR1, TIM_CR1_CEN)
+#define __HAL_TIM_DISABLE(__HANDLE__)           CLEAR_BIT((__HANDLE__)->Instance->CR1, TIM_CR1_CEN)
+#define __HAL_TIM_MOE_ENABLE(__HANDLE__)        SET_BIT((__HANDLE__)->Instance->BDTR, TIM_BDTR_MOE)
+#define __HAL_TIM_MOE_DISABLE(__HANDLE__)       CLEAR_BIT((__HANDLE__)->Instance->BDTR, TIM_BDTR_MOE)
+/* Any channel output or complementary output still enabled */
+#define TIM_CCER_CCxE_MASK                      (TIM_CCER_CC1E | TIM_CCER_CC2E | TIM_CCER_CC3E | TIM_CCER_CC4E)
+#define TIM_CCER_CCxNE_MASK                     (TIM_CCER_CC1NE | TIM_CCER_CC2NE | TIM_CCER_CC3NE)
+#define __HAL_TIM_CHANNELS_ACTIVE(__HANDLE__)   (((__HANDLE__)->Instance->CCER & (TIM_CCER_CCxE_MASK | TIM_CCER_CCxNE_MASK)) != 0U)
+
+#define __HAL_TIM_ENABLE_IT(__HANDLE__, __IT__)     SET_BIT((__HANDLE__)->Instance->DIER, (__IT__))
+#define __HAL_TIM_DISABLE_IT(__HANDLE__, __IT__)    CLEAR_BIT((__HANDLE__)->Instance->DIER, (__IT__))
+#define __HAL_TIM_ENABLE_DMA(__HANDLE__, __DMA__)   SET_BIT((__HANDLE__)->Instance->DIER, (__DMA__))
+#define __HAL_TIM_DISABLE_DMA(__HANDLE__, __DMA__)  CLEAR_BIT((__HANDLE__)->Instance->DIER, (__DMA__))
+#define __HAL_TIM_GET_FLAG(__HANDLE__, __FLAG__)    (((__HANDLE__)->Instance->SR & (__FLAG__)) == (__FLAG__))
+/* SR bits are rc_w0: write 0 to the flags being cleared, 1 elsewhere */
+#define __HAL_TIM_CLEAR_FLAG(__HANDLE__, __FLAG__)  WRITE_REG((__HANDLE__)->Instance->SR, (uint32_t)~(__FLAG__))
+
+#define __HAL_TIM_SET_COMPARE(__HANDLE__, __CHANNEL__, __COMPARE__) \
+                                                (*(&(__HANDLE__)->Instance->CCR1 + ((__CHANNEL__) >> 2U)) = (__COMPARE__))
+#define __HAL_TIM_GET_COMPARE(__HANDLE__, __CHANNEL__)  (*(&(__HANDLE__)->Instance->CCR1 + ((__CHANNEL__) >> 2U)))
+#define __HAL_TIM_SET_COUNTER(__HANDLE__, __COUNTER__)  WRITE_REG((__HANDLE__)->Instance->CNT, (__COUNTER__))
+#define __HAL_TIM_GET_COUNTER(__HANDLE__)               READ_REG((__HANDLE__)->Instance->CNT)
+#define __HAL_TIM_SET_AUTORELOAD(__HANDLE__, __AUTORELOAD__) do { \
+                                                    WRITE_REG((__HANDLE__)->Instance->ARR, (__AUTORELOAD__)); \
+                                                    (__HANDLE__)->Init.Period = (__AUTORELOAD__); \
+                                                } while (0U)
+#define __HAL_TIM_GET_AUTORELOAD(__HANDLE__)            READ_REG((__HANDLE__)->Instance->ARR)
+#define __HAL_TIM_SET_PRESCALER(__HANDLE__, __PRESC__)  WRITE_REG((__HANDLE__)->Instance->PSC, (__PRESC__))
+
+/*------------------------------ HAL_TIM APIs ----------------------------------*/
+/* Time base */
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_DeInit(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim);
+
+/* Output compare */
+HAL_StatusTypeDef HAL_TIM_OC_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *sConfig, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_OC_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_OC_Stop(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_OC_Start_IT(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_OC_Stop_IT(TIM_HandleTypeDef *htim, uint32_t Channel);
+
+/* PWM */
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *sConfig, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_PWM_Stop(TIM_HandleTypeDef *htim, uint32_t Channel);
+
+/* Input capture */
+HAL_StatusTypeDef HAL_TIM_IC_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_IC_InitTypeDef *sConfig, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_IC_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_IC_Stop(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_IC_Start_IT(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_IC_Stop_IT(TIM_HandleTypeDef *htim, uint32_t Channel);
+uint32_t HAL_TIM_ReadCapturedValue(TIM_HandleTypeDef *htim, uint32_t Channel);
+
+/* DMA burst */
+HAL_StatusTypeDef HAL_TIM_DMABurst_WriteStart(TIM_HandleTypeDef *htim, uint32_t BurstBaseAddress, uint32_t BurstRequestSrc,
+                                              const uint32_t *BurstBuffer, uint32_t BurstLength, uint32_t BurstCount);
+HAL_StatusTypeDef HAL_TIM_DMABurst_WriteStop(TIM_HandleTypeDef *htim, uint32_t BurstRequestSrc);
+
+/* Advanced timers (TIM1/TIM8) */
+HAL_StatusTypeDef HAL_TIMEx_PWMN_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIMEx_PWMN_Stop(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIMEx_ConfigBreakDeadTime(TIM_HandleTypeDef *htim, const TIM_BreakDeadTimeConfigTypeDef *sBreakDeadTimeConfig);
+uint32_t HAL_TIMEx_DeadTimeEncode(uint32_t DeadTimeTicks);
+
+/* Master mode */
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, uint32_t MasterOutputTrigger);
+
+/* IRQ handler and callbacks */
+void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim);
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim);
+void HAL_TIM_OC_DelayElapsedCallback(TIM_HandleTypeDef *htim);
+void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim);
+void HAL_TIM_TriggerCallback(TIM_HandleTypeDef *htim);
+void HAL_TIMEx_BreakCallback(TIM_HandleTypeDef *htim);
+void HAL_TIM_DMABurstHalfCpltCallback(TIM_HandleTypeDef *htim);
+void HAL_TIM_DMABurstCpltCallback(TIM_HandleTypeDef *htim);
+void HAL_TIM_ErrorCallback(TIM_HandleTypeDef *htim);
+
+HAL_TIM_StateTypeDef HAL_TIM_GetState(TIM_HandleTypeDef *htim);
+uint32_t HAL_TIM_GetClockFreq(TIM_TypeDef *TIMx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _STM32F4XX_HAL_TIM_H_
\ No newline at end of file
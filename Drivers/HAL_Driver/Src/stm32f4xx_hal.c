@@ -18,7 +18,8 @@ HAL_StatusTypeDef HAL_Init(void)
     // __HAL_FLASH_DATA_CACHE_ENABLE():
     // __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
     
-    //HAL_NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_4);
+    /* Set Interrupt Group Priority: 4 bits preemption, no sub-priority */
+    HAL_NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_4);
 
     //HAL_InitTick(TICK_INT_PRIORITY);
     
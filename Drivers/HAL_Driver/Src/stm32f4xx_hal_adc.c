@@ -0,0 +1,744 @@
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief: Private macros
+ */
+#define ADC_STAB_DELAY_US       3U          /* tSTAB after ADON */
+#define ADC_MULTI_IS_TRIPLE(CCR) (((CCR) & 0x10U) != 0U)
+
+/**
+ * @brief: Private functions
+ */
+static void ADC_Enable(ADC_HandleTypeDef *hadc);
+static uint32_t ADC_IsSlave(const ADC_HandleTypeDef *hadc);
+static void ADC_SetSampleTime(ADC_TypeDef *ADCx, uint32_t Channel, uint32_t SamplingTime);
+static void ADC_EnableInternalChannel(ADC_HandleTypeDef *hadc, uint32_t Channel);
+static HAL_StatusTypeDef ADC_StartDMA(ADC_HandleTypeDef *hadc, uint32_t SrcAddress, void *pData, void *pData1,
+                                      uint32_t Length, uint32_t Samples);
+static void ADC_Accumulate(ADC_HandleTypeDef *hadc, const uint16_t *pData, uint32_t Count);
+static void ADC_DMAConvCplt(DMA_HandleTypeDef *hdma);
+static void ADC_DMAHalfConvCplt(DMA_HandleTypeDef *hdma);
+static void ADC_DMAM1ConvCplt(DMA_HandleTypeDef *hdma);
+static void ADC_DMAError(DMA_HandleTypeDef *hdma);
+
+/*------------------------------------------- Init -------------------------------------------*/
+/**
+ * @brief   Initialize an ADC and its regular group according to hadc->Init
+ * @note    The ADC clock must be enabled before (__HAL_RCC_ADCx_CLK_ENABLE()).
+ *          ClockPrescaler is common to the three ADCs. The ADC is left powered down,
+ *          the start functions power it up.
+ * @retval  HAL status
+ */
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc)
+{
+    uint32_t cr1, cr2;
+
+    if (hadc == NULL) {
+        return HAL_ERROR;
+    }
+    assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+    assert_param((hadc->Init.NbrOfConversion >= 1U) && (hadc->Init.NbrOfConversion <= 16U));
+
+    MODIFY_REG(ADC123_COMMON->CCR, ADC_CCR_ADCPRE, hadc->Init.ClockPrescaler);
+
+    cr1 = hadc->Init.Resolution;
+    if (hadc->Init.ScanConvMode != DISABLE) {
+        cr1 |= ADC_CR1_SCAN;
+    }
+    if (hadc->Init.DiscontinuousConvMode != DISABLE) {
+        assert_param((hadc->Init.NbrOfDiscConversion >= 1U) && (hadc->Init.NbrOfDiscConversion <= 8U));
+        cr1 |= ADC_CR1_DISCEN | ((hadc->Init.NbrOfDiscConversion - 1U) << ADC_CR1_DISCNUM_Pos);
+    }
+    MODIFY_REG(hadc->Instance->CR1, ADC_CR1_RES | ADC_CR1_SCAN | ADC_CR1_DISCEN | ADC_CR1_DISCNUM, cr1);
+
+    cr2 = hadc->Init.DataAlign | hadc->Init.EOCSelection;
+    if (hadc->Init.ContinuousConvMode != DISABLE) {
+        cr2 |= ADC_CR2_CONT;
+    }
+    if (hadc->Init.DMAContinuousRequests != DISABLE) {
+        cr2 |= ADC_CR2_DDS;
+    }
+    if (hadc->Init.ExternalTrigConv != ADC_SOFTWARE_START) {
+        cr2 |= (hadc->Init.ExternalTrigConv << ADC_CR2_EXTSEL_Pos) | (hadc->Init.ExternalTrigConvEdge << ADC_CR2_EXTEN_Pos);
+    }
+    MODIFY_REG(hadc->Instance->CR2, ADC_CR2_ALIGN | ADC_CR2_EOCS | ADC_CR2_CONT | ADC_CR2_DDS |
+                                    ADC_CR2_EXTSEL | ADC_CR2_EXTEN, cr2);
+
+    MODIFY_REG(hadc->Instance->SQR1, ADC_SQR1_L, (hadc->Init.NbrOfConversion - 1U) << ADC_SQR1_L_Pos);
+
+    hadc->Oversampling.Ratio = 0U;
+    hadc->ErrorCode = HAL_ADC_ERROR_NONE;
+    hadc->State = HAL_ADC_STATE_READY;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_DeInit(ADC_HandleTypeDef *hadc)
+{
+    if (hadc == NULL) {
+        return HAL_ERROR;
+    }
+    __HAL_ADC_DISABLE(hadc);
+    CLEAR_REG(hadc->Instance->CR1);
+    CLEAR_REG(hadc->Instance->CR2);
+    CLEAR_REG(hadc->Instance->SQR1);
+    CLEAR_REG(hadc->Instance->JSQR);
+    CLEAR_REG(hadc->Instance->SR);
+    hadc->State = HAL_ADC_STATE_RESET;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Put a channel at a rank of the regular sequence
+ * @note    Channels 16 (temperature), 17 (VREFINT) and 18 (VBAT) exist on ADC1 only,
+ *          their internal path is switched on here. Temperature and VBAT share the input,
+ *          VBAT takes precedence.
+ */
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, const ADC_ChannelConfTypeDef *sConfig)
+{
+    uint32_t shift;
+
+    assert_param(IS_ADC_CHANNEL(sConfig->Channel));
+    assert_param(IS_ADC_REGULAR_RANK(sConfig->Rank));
+    assert_param(IS_ADC_SAMPLE_TIME(sConfig->SamplingTime));
+
+    ADC_SetSampleTime(hadc->Instance, sConfig->Channel, sConfig->SamplingTime);
+
+    /* SQR3: ranks 1-6, SQR2: 7-12, SQR1: 13-16 */
+    shift = ((sConfig->Rank - 1U) % 6U) * ADC_SQR_RANK_BITS;
+    if (sConfig->Rank <= 6U) {
+        MODIFY_REG(hadc->Instance->SQR3, 0x1FUL << shift, sConfig->Channel << shift);
+    }
+    else if (sConfig->Rank <= 12U) {
+        MODIFY_REG(hadc->Instance->SQR2, 0x1FUL << shift, sConfig->Channel << shift);
+    }
+    else {
+        MODIFY_REG(hadc->Instance->SQR1, 0x1FUL << shift, sConfig->Channel << shift);
+    }
+
+    ADC_EnableInternalChannel(hadc, sConfig->Channel);
+    return HAL_OK;
+}
+
+/*------------------------------------------- Regular group -------------------------------------------*/
+/**
+ * @brief   Power up the ADC and start the regular group
+ * @note    With a software trigger the sequence starts now, otherwise on the next trigger.
+ *          In multi-ADC modes only ADC1 starts the group, ADC2/ADC3 are only powered up.
+ */
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef *hadc)
+{
+    if ((hadc->State & HAL_ADC_STATE_REG_BUSY) != 0U) {
+        return HAL_BUSY;
+    }
+    ADC_Enable(hadc);
+    hadc->State = (hadc->State & ~HAL_ADC_STATE_READY) | HAL_ADC_STATE_REG_BUSY;
+    hadc->ErrorCode = HAL_ADC_ERROR_NONE;
+
+    __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_EOC | ADC_FLAG_OVR);
+    if ((ADC_IsSlave(hadc) == 0U) && (hadc->Init.ExternalTrigConv == ADC_SOFTWARE_START)) {
+        SET_BIT(hadc->Instance->CR2, ADC_CR2_SWSTART);
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief   Stop conversions and power the ADC down
+ * @note    Also stops the injected group.
+ */
+HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef *hadc)
+{
+    __HAL_ADC_DISABLE(hadc);
+    hadc->State = HAL_ADC_STATE_READY;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Wait for the end of conversion (sequence, or single conversion with ADC_EOC_SINGLE_CONV)
+ * @param   Timeout - Status register polls before giving up
+ */
+HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef *hadc, uint32_t Timeout)
+{
+    while (__HAL_ADC_GET_FLAG(hadc, ADC_FLAG_EOC) == 0U) {
+        if (Timeout-- == 0U) {
+            hadc->ErrorCode |= HAL_ADC_ERROR_TIMEOUT;
+            return HAL_TIMEOUT;
+        }
+    }
+    __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_STRT | ADC_FLAG_EOC);
+
+    if ((hadc->Init.ContinuousConvMode == DISABLE) && (hadc->Init.ExternalTrigConv == ADC_SOFTWARE_START) &&
+        (hadc->Init.EOCSelection == ADC_EOC_SEQ_CONV)) {
+        hadc->State = (hadc->State & ~HAL_ADC_STATE_REG_BUSY) | HAL_ADC_STATE_READY;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Start_IT(ADC_HandleTypeDef *hadc)
+{
+    __HAL_ADC_ENABLE_IT(hadc, ADC_IT_EOC | ADC_IT_OVR);
+    if (HAL_ADC_Start(hadc) != HAL_OK) {
+        __HAL_ADC_DISABLE_IT(hadc, ADC_IT_EOC | ADC_IT_OVR);
+        return HAL_BUSY;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Stop_IT(ADC_HandleTypeDef *hadc)
+{
+    __HAL_ADC_DISABLE_IT(hadc, ADC_IT_EOC | ADC_IT_OVR);
+    return HAL_ADC_Stop(hadc);
+}
+
+/**
+ * @brief   Start the regular group with results moved by DMA
+ * @note    With a circular DMA stream and DMAContinuousRequests enabled, pData is a
+ *          double buffer: HAL_ADC_ConvHalfCpltCallback() when the first half is ready,
+ *          HAL_ADC_ConvCpltCallback() for the second half. The stream must use
+ *          half-word memory/peripheral alignment.
+ * @param   pData  - Result buffer
+ * @param   Length - Number of results, 1 ~ 65535 (even for double buffering)
+ */
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint16_t *pData, uint32_t Length)
+{
+    if ((pData == NULL) || (hadc->DMA_Handle == NULL)) {
+        return HAL_ERROR;
+    }
+    return ADC_StartDMA(hadc, (uint32_t)&hadc->Instance->DR, pData, NULL, Length, Length);
+}
+
+/**
+ * @brief   Stream the regular group into two buffers, with the DMA double buffer mode
+ * @note    The stream fills pData0 then pData1 and starts over, without stopping and
+ *          without CPU work in between: HAL_ADC_ConvCpltCallback() reports pData0 full,
+ *          HAL_ADCEx_ConvM1CpltCallback() pData1. A buffer may be processed until the
+ *          other one is full. Unlike the circular half/full scheme the buffers need not
+ *          be contiguous, e.g. each can be handed to a consumer as a block.
+ *          Needs DMAContinuousRequests enabled; oversampling applies to each buffer.
+ * @param   Length - Results per buffer, 1 ~ 65535
+ */
+HAL_StatusTypeDef HAL_ADCEx_MultiBufferStart_DMA(ADC_HandleTypeDef *hadc, uint16_t *pData0, uint16_t *pData1,
+                                                 uint32_t Length)
+{
+    if ((pData0 == NULL) || (pData1 == NULL) || (hadc->DMA_Handle == NULL) ||
+        (hadc->Init.DMAContinuousRequests == DISABLE)) {
+        return HAL_ERROR;
+    }
+    return ADC_StartDMA(hadc, (uint32_t)&hadc->Instance->DR, pData0, pData1, Length, Length);
+}
+
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef *hadc)
+{
+    HAL_StatusTypeDef status;
+
+    __HAL_ADC_DISABLE(hadc);
+    CLEAR_BIT(hadc->Instance->CR2, ADC_CR2_DMA);
+    __HAL_ADC_DISABLE_IT(hadc, ADC_IT_OVR);
+    status = HAL_DMA_Abort(hadc->DMA_Handle);
+    hadc->State = HAL_ADC_STATE_READY;
+
+    return status;
+}
+
+uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef *hadc)
+{
+    return hadc->Instance->DR;
+}
+
+/*------------------------------------------- Injected group -------------------------------------------*/
+/**
+ * @brief   Configure one rank of the injected group and the group trigger
+ * @note    With a sequence shorter than 4 the hardware converts JSQR from the end
+ *          (JSQ[4 - n + 1] .. JSQ4), the rank is placed accordingly: configure
+ *          InjectedNbrOfConversion the same for every rank. Rank n lands in JDRn.
+ *          A timer trigger (e.g. ADC_EXTERNALTRIGINJECCONV_T1_CC4) samples the group at
+ *          a precise point of the PWM period, interrupting the regular group.
+ */
+HAL_StatusTypeDef HAL_ADCEx_InjectedConfigChannel(ADC_HandleTypeDef *hadc, const ADC_InjectionConfTypeDef *sConfigInjected)
+{
+    uint32_t nbr = sConfigInjected->InjectedNbrOfConversion;
+    uint32_t rank = sConfigInjected->InjectedRank;
+    uint32_t shift, cr2 = 0U;
+
+    assert_param(IS_ADC_CHANNEL(sConfigInjected->InjectedChannel));
+    assert_param(IS_ADC_INJECTED_RANK(rank));
+    assert_param(IS_ADC_SAMPLE_TIME(sConfigInjected->InjectedSamplingTime));
+
+    if ((nbr < 1U) || (nbr > 4U) || (rank > nbr) || (sConfigInjected->InjectedOffset > 0xFFFU) ||
+        ((sConfigInjected->AutoInjectedConv != DISABLE) &&
+         (sConfigInjected->ExternalTrigInjecConv != ADC_INJECTED_SOFTWARE_START))) {
+        return HAL_ERROR;
+    }
+
+    ADC_SetSampleTime(hadc->Instance, sConfigInjected->InjectedChannel, sConfigInjected->InjectedSamplingTime);
+
+    shift = (4U - nbr + rank - 1U) * ADC_SQR_RANK_BITS;
+    MODIFY_REG(hadc->Instance->JSQR, ADC_JSQR_JL | (0x1FUL << shift),
+               ((nbr - 1U) << ADC_JSQR_JL_Pos) | (sConfigInjected->InjectedChannel << shift));
+    *(&hadc->Instance->JOFR1 + (rank - 1U)) = sConfigInjected->InjectedOffset;
+
+    if (sConfigInjected->ExternalTrigInjecConv != ADC_INJECTED_SOFTWARE_START) {
+        cr2 = (sConfigInjected->ExternalTrigInjecConv << ADC_CR2_JEXTSEL_Pos) |
+              (sConfigInjected->ExternalTrigInjecConvEdge << ADC_CR2_JEXTEN_Pos);
+    }
+    MODIFY_REG(hadc->Instance->CR2, ADC_CR2_JEXTSEL | ADC_CR2_JEXTEN, cr2);
+    MODIFY_REG(hadc->Instance->CR1, ADC_CR1_JAUTO, (sConfigInjected->AutoInjectedConv != DISABLE) ? ADC_CR1_JAUTO : 0U);
+
+    ADC_EnableInternalChannel(hadc, sConfigInjected->InjectedChannel);
+    return HAL_OK;
+}
+
+/**
+ * @brief   Power up the ADC and start (or arm, with a trigger) the injected group
+ */
+HAL_StatusTypeDef HAL_ADCEx_InjectedStart(ADC_HandleTypeDef *hadc)
+{
+    if ((hadc->State & HAL_ADC_STATE_INJ_BUSY) != 0U) {
+        return HAL_BUSY;
+    }
+    ADC_Enable(hadc);
+    hadc->State = (hadc->State & ~HAL_ADC_STATE_READY) | HAL_ADC_STATE_INJ_BUSY;
+
+    __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_JEOC | ADC_FLAG_JSTRT);
+    if ((ADC_IsSlave(hadc) == 0U) && ((hadc->Instance->CR2 & ADC_CR2_JEXTEN) == 0U) &&
+        ((hadc->Instance->CR1 & ADC_CR1_JAUTO) == 0U)) {
+        SET_BIT(hadc->Instance->CR2, ADC_CR2_JSWSTART);
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief   Stop the injected group, the ADC is powered down unless the regular group runs
+ */
+HAL_StatusTypeDef HAL_ADCEx_InjectedStop(ADC_HandleTypeDef *hadc)
+{
+    if ((hadc->Instance->CR1 & ADC_CR1_JAUTO) != 0U) {
+        /* Auto-injected conversions stop with the regular group */
+        return HAL_ERROR;
+    }
+    CLEAR_BIT(hadc->Instance->CR2, ADC_CR2_JEXTEN);
+    hadc->State &= ~HAL_ADC_STATE_INJ_BUSY;
+    if ((hadc->State & HAL_ADC_STATE_REG_BUSY) == 0U) {
+        __HAL_ADC_DISABLE(hadc);
+        hadc->State |= HAL_ADC_STATE_READY;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADCEx_InjectedPollForConversion(ADC_HandleTypeDef *hadc, uint32_t Timeout)
+{
+    while (__HAL_ADC_GET_FLAG(hadc, ADC_FLAG_JEOC) == 0U) {
+        if (Timeout-- == 0U) {
+            hadc->ErrorCode |= HAL_ADC_ERROR_TIMEOUT;
+            return HAL_TIMEOUT;
+        }
+    }
+    __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_JSTRT | ADC_FLAG_JEOC);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADCEx_InjectedStart_IT(ADC_HandleTypeDef *hadc)
+{
+    __HAL_ADC_ENABLE_IT(hadc, ADC_IT_JEOC);
+    if (HAL_ADCEx_InjectedStart(hadc) != HAL_OK) {
+        __HAL_ADC_DISABLE_IT(hadc, ADC_IT_JEOC);
+        return HAL_BUSY;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADCEx_InjectedStop_IT(ADC_HandleTypeDef *hadc)
+{
+    __HAL_ADC_DISABLE_IT(hadc, ADC_IT_JEOC);
+    return HAL_ADCEx_InjectedStop(hadc);
+}
+
+/**
+ * @brief   Result of an injected rank (offset already subtracted, sign extended by hardware)
+ * @param   InjectedRank - ADC_INJECTED_RANK_1 ~ 4
+ */
+uint32_t HAL_ADCEx_InjectedGetValue(ADC_HandleTypeDef *hadc, uint32_t InjectedRank)
+{
+    assert_param(IS_ADC_INJECTED_RANK(InjectedRank));
+    return *(&hadc->Instance->JDR1 + (InjectedRank - 1U));
+}
+
+/*------------------------------------------- Multi mode -------------------------------------------*/
+/**
+ * @brief   Select the dual/triple mode, common DMA access and interleaving delay
+ * @note    hadc must be ADC1. Every ADC involved keeps its own HAL_ADC_Init()/ConfigChannel()
+ *          setup; only ADC1 needs a trigger, the slaves follow it.
+ *          DMA modes: 1 for regular simultaneous triple mode, 2 for dual/triple
+ *          interleaved and dual simultaneous (two 12-bit samples per word), 3 likewise
+ *          with 6/8-bit resolution.
+ */
+HAL_StatusTypeDef HAL_ADCEx_MultiModeConfigChannel(ADC_HandleTypeDef *hadc, const ADC_MultiModeTypeDef *multimode)
+{
+    if (hadc->Instance != ADC1) {
+        return HAL_ERROR;
+    }
+    MODIFY_REG(ADC123_COMMON->CCR, ADC_CCR_MULTI | ADC_CCR_DMA | ADC_CCR_DELAY,
+               multimode->Mode | multimode->DMAAccessMode | multimode->TwoSamplingDelay);
+    return HAL_OK;
+}
+
+/**
+ * @brief   Start a dual/triple mode acquisition through the common data register
+ * @note    Powers up ADC2 (and ADC3 in triple modes) with ADC1, then starts ADC1.
+ *          Half/full callbacks are called on the ADC1 handle.
+ * @note    No oversampling in DMA mode 3: a half-word holds two 8-bit samples, HAL_ERROR.
+ * @param   pData  - Buffer, DMA items of the common DMA access mode
+ *                   (words in mode 2, half-words in modes 1 and 3)
+ * @param   Length - Number of DMA items, 1 ~ 65535
+ */
+HAL_StatusTypeDef HAL_ADCEx_MultiModeStart_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t Length)
+{
+    uint32_t ccr = ADC123_COMMON->CCR;
+    uint32_t samples = Length;
+
+    if ((hadc->Instance != ADC1) || (pData == NULL) || (hadc->DMA_Handle == NULL) ||
+        ((ccr & ADC_CCR_MULTI) == ADC_MODE_INDEPENDENT) || ((ccr & ADC_CCR_DMA) == ADC_DMAACCESSMODE_DISABLED)) {
+        return HAL_ERROR;
+    }
+    if (((ccr & ADC_CCR_DMA) == ADC_DMAACCESSMODE_3) && (hadc->Oversampling.Ratio >= 2U)) {
+        return HAL_ERROR;
+    }
+    if ((ccr & ADC_CCR_DMA) == ADC_DMAACCESSMODE_2) {
+        samples = Length * 2U;
+    }
+
+    /* Slaves first, so they are ready when the master triggers them */
+    SET_BIT(ADC2->CR2, ADC_CR2_ADON);
+    if (ADC_MULTI_IS_TRIPLE(ccr)) {
+        SET_BIT(ADC3->CR2, ADC_CR2_ADON);
+    }
+    MODIFY_REG(ADC123_COMMON->CCR, ADC_CCR_DDS, (hadc->Init.DMAContinuousRequests != DISABLE) ? ADC_CCR_DDS : 0U);
+
+    return ADC_StartDMA(hadc, (uint32_t)&ADC123_COMMON->CDR, pData, NULL, Length, samples);
+}
+
+HAL_StatusTypeDef HAL_ADCEx_MultiModeStop_DMA(ADC_HandleTypeDef *hadc)
+{
+    HAL_StatusTypeDef status;
+
+    if (hadc->Instance != ADC1) {
+        return HAL_ERROR;
+    }
+    CLEAR_BIT(ADC1->CR2, ADC_CR2_ADON);
+    CLEAR_BIT(ADC2->CR2, ADC_CR2_ADON);
+    CLEAR_BIT(ADC3->CR2, ADC_CR2_ADON);
+    CLEAR_BIT(ADC123_COMMON->CCR, ADC_CCR_DDS);
+    __HAL_ADC_DISABLE_IT(hadc, ADC_IT_OVR);
+    status = HAL_DMA_Abort(hadc->DMA_Handle);
+    hadc->State = HAL_ADC_STATE_READY;
+
+    return status;
+}
+
+/**
+ * @brief   Last dual mode result: ADC2 in bits 31:16, ADC1 in bits 15:0
+ */
+uint32_t HAL_ADCEx_MultiModeGetValue(ADC_HandleTypeDef *hadc)
+{
+    UNUSED(hadc);
+    return ADC123_COMMON->CDR;
+}
+
+/*------------------------------------------- Oversampling -------------------------------------------*/
+/**
+ * @brief   Enable (Ratio >= 2) or disable oversampling on the DMA completion path
+ * @note    Applies to the next HAL_ADC_Start_DMA() / HAL_ADCEx_MultiModeStart_DMA().
+ *          Each half buffer is summed into the accumulators as it completes, every Ratio
+ *          frames the Result array is written and HAL_ADCEx_OversamplingCpltCallback()
+ *          is called, before the half/full callback of that half. The sums are 32-bit,
+ *          so Ratio up to 65536 is safe at 16-bit sample width.
+ */
+HAL_StatusTypeDef HAL_ADCEx_OversamplingConfig(ADC_HandleTypeDef *hadc, const ADC_OversamplingTypeDef *sOversampling)
+{
+    if ((hadc->State & HAL_ADC_STATE_REG_BUSY) != 0U) {
+        return HAL_BUSY;
+    }
+    if ((sOversampling->Ratio >= 2U) &&
+        ((sOversampling->Ratio > 0x10000U) || (sOversampling->RightShift > 16U) || (sOversampling->Result == NULL) ||
+         (sOversampling->FrameLength == 0U) || (sOversampling->FrameLength > ADC_OVERSAMPLING_MAX_FRAME))) {
+        return HAL_ERROR;
+    }
+    hadc->Oversampling = *sOversampling;
+    return HAL_OK;
+}
+
+/*------------------------------------------- IRQ -------------------------------------------*/
+/**
+ * @brief   Handle an ADC interrupt, to be called from ADC_IRQHandler for each ADC in use
+ *          (the three ADCs share one vector)
+ */
+void HAL_ADC_IRQHandler(ADC_HandleTypeDef *hadc)
+{
+    uint32_t cr1 = hadc->Instance->CR1;
+    uint32_t sr = hadc->Instance->SR;
+
+    if (((cr1 & ADC_IT_EOC) != 0U) && ((sr & ADC_FLAG_EOC) != 0U))
+    {
+        /* Single software-started sequence: done */
+        if ((hadc->Init.ContinuousConvMode == DISABLE) && (hadc->Init.ExternalTrigConv == ADC_SOFTWARE_START) &&
+            (hadc->Init.EOCSelection == ADC_EOC_SEQ_CONV)) {
+            __HAL_ADC_DISABLE_IT(hadc, ADC_IT_EOC);
+            hadc->State = (hadc->State & ~HAL_ADC_STATE_REG_BUSY) | HAL_ADC_STATE_READY;
+        }
+        __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_STRT | ADC_FLAG_EOC);
+        HAL_ADC_ConvCpltCallback(hadc);
+    }
+
+    if (((cr1 & ADC_IT_JEOC) != 0U) && ((sr & ADC_FLAG_JEOC) != 0U))
+    {
+        if (((hadc->Instance->CR2 & ADC_CR2_JEXTEN) == 0U) && ((cr1 & ADC_CR1_JAUTO) == 0U)) {
+            __HAL_ADC_DISABLE_IT(hadc, ADC_IT_JEOC);
+            hadc->State &= ~HAL_ADC_STATE_INJ_BUSY;
+            if ((hadc->State & HAL_ADC_STATE_REG_BUSY) == 0U) {
+                hadc->State |= HAL_ADC_STATE_READY;
+            }
+        }
+        __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_JSTRT | ADC_FLAG_JEOC);
+        HAL_ADCEx_InjectedConvCpltCallback(hadc);
+    }
+
+    if (((cr1 & ADC_IT_AWD) != 0U) && ((sr & ADC_FLAG_AWD) != 0U))
+    {
+        __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_AWD);
+        HAL_ADC_LevelOutOfWindowCallback(hadc);
+    }
+
+    if (((cr1 & ADC_IT_OVR) != 0U) && ((sr & ADC_FLAG_OVR) != 0U))
+    {
+        /* DMA requests stop on overrun: the acquisition has to be restarted */
+        __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_OVR);
+        hadc->ErrorCode |= HAL_ADC_ERROR_OVR;
+        HAL_ADC_ErrorCallback(hadc);
+    }
+}
+
+__weak void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    UNUSED(hadc);
+}
+
+__weak void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    UNUSED(hadc);
+}
+
+__weak void HAL_ADCEx_ConvM1CpltCallback(ADC_HandleTypeDef *hadc)
+{
+    UNUSED(hadc);
+}
+
+__weak void HAL_ADCEx_InjectedConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    UNUSED(hadc);
+}
+
+__weak void HAL_ADCEx_OversamplingCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    UNUSED(hadc);
+}
+
+__weak void HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef *hadc)
+{
+    UNUSED(hadc);
+}
+
+__weak void HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc)
+{
+    UNUSED(hadc);
+}
+
+uint32_t HAL_ADC_GetState(ADC_HandleTypeDef *hadc)
+{
+    return hadc->State;
+}
+
+uint32_t HAL_ADC_GetError(ADC_HandleTypeDef *hadc)
+{
+    return hadc->ErrorCode;
+}
+
+/*---------------------------------- Private functions ----------------------------------*/
+/* Power up, waiting tSTAB the first time */
+static void ADC_Enable(ADC_HandleTypeDef *hadc)
+{
+    __IO uint32_t counter;
+
+    if ((hadc->Instance->CR2 & ADC_CR2_ADON) == 0U) {
+        __HAL_ADC_ENABLE(hadc);
+        /* At least one core cycle per iteration */
+        counter = ADC_STAB_DELAY_US * (HAL_RCC_GetHCLKFreq() / 1000000U);
+        while (counter != 0U) {
+            counter--;
+        }
+    }
+}
+
+/* ADC2/ADC3 in a multi-ADC mode: triggered by ADC1, never started on their own */
+static uint32_t ADC_IsSlave(const ADC_HandleTypeDef *hadc)
+{
+    return ((hadc->Instance != ADC1) && ((ADC123_COMMON->CCR & ADC_CCR_MULTI) != ADC_MODE_INDEPENDENT)) ? 1U : 0U;
+}
+
+/* SMPR2: channels 0-9, SMPR1: 10-18, 3 bits each */
+static void ADC_SetSampleTime(ADC_TypeDef *ADCx, uint32_t Channel, uint32_t SamplingTime)
+{
+    uint32_t shift;
+
+    if (Channel < 10U) {
+        shift = Channel * ADC_SMPR_CHANNEL_BITS;
+        MODIFY_REG(ADCx->SMPR2, 0x7UL << shift, SamplingTime << shift);
+    }
+    else {
+        shift = (Channel - 10U) * ADC_SMPR_CHANNEL_BITS;
+        MODIFY_REG(ADCx->SMPR1, 0x7UL << shift, SamplingTime << shift);
+    }
+}
+
+static void ADC_EnableInternalChannel(ADC_HandleTypeDef *hadc, uint32_t Channel)
+{
+    if (hadc->Instance != ADC1) {
+        return;
+    }
+    if (Channel == ADC_CHANNEL_VBAT) {
+        SET_BIT(ADC123_COMMON->CCR, ADC_CCR_VBATE);
+    }
+    else if ((Channel == ADC_CHANNEL_TEMPSENSOR) || (Channel == ADC_CHANNEL_VREFINT)) {
+        SET_BIT(ADC123_COMMON->CCR, ADC_CCR_TSVREFE);
+    }
+}
+
+/* Common part of the single, double buffer and multi-ADC DMA starts, pData1 != NULL for double buffering */
+static HAL_StatusTypeDef ADC_StartDMA(ADC_HandleTypeDef *hadc, uint32_t SrcAddress, void *pData, void *pData1,
+                                      uint32_t Length, uint32_t Samples)
+{
+    DMA_HandleTypeDef *hdma = hadc->DMA_Handle;
+    HAL_StatusTypeDef status;
+    uint32_t i;
+
+    if ((hadc->State & HAL_ADC_STATE_REG_BUSY) != 0U) {
+        return HAL_BUSY;
+    }
+
+    hadc->DmaBuffer = (uint16_t *)pData;
+    hadc->DmaBuffer1 = (uint16_t *)pData1;
+    hadc->DmaSamples = Samples;
+    hadc->OvsFrames = 0U;
+    hadc->OvsPos = 0U;
+    for (i = 0U; i < ADC_OVERSAMPLING_MAX_FRAME; i++) {
+        hadc->OvsSum[i] = 0U;
+    }
+
+    hdma->Parent = hadc;
+    hdma->XferCpltCallback = ADC_DMAConvCplt;
+    hdma->XferHalfCpltCallback = (pData1 == NULL) ? ADC_DMAHalfConvCplt : NULL;
+    hdma->XferM1CpltCallback = (pData1 == NULL) ? NULL : ADC_DMAM1ConvCplt;
+    hdma->XferErrorCallback = ADC_DMAError;
+
+    ADC_Enable(hadc);
+    hadc->State = (hadc->State & ~HAL_ADC_STATE_READY) | HAL_ADC_STATE_REG_BUSY;
+    hadc->ErrorCode = HAL_ADC_ERROR_NONE;
+
+    __HAL_ADC_CLEAR_FLAG(hadc, ADC_FLAG_EOC | ADC_FLAG_OVR);
+    __HAL_ADC_ENABLE_IT(hadc, ADC_IT_OVR);
+
+    if (pData1 == NULL) {
+        status = HAL_DMA_Start_IT(hdma, SrcAddress, (uint32_t)pData, Length);
+    }
+    else {
+        status = HAL_DMAEx_MultiBufferStart_IT(hdma, SrcAddress, (uint32_t)pData, (uint32_t)pData1, Length);
+    }
+    if (status != HAL_OK) {
+        hadc->State = (hadc->State & ~HAL_ADC_STATE_REG_BUSY) | HAL_ADC_STATE_READY;
+        return HAL_BUSY;
+    }
+    /* Toggle DMA so a request pending from a previous run is dropped */
+    CLEAR_BIT(hadc->Instance->CR2, ADC_CR2_DMA);
+    SET_BIT(hadc->Instance->CR2, ADC_CR2_DMA);
+
+    if (hadc->Init.ExternalTrigConv == ADC_SOFTWARE_START) {
+        SET_BIT(hadc->Instance->CR2, ADC_CR2_SWSTART);
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief   Sum Count samples into the oversampling accumulators
+ * @note    Frames may straddle the two halves of the buffer, the position inside the
+ *          current frame is kept between calls.
+ */
+static void ADC_Accumulate(ADC_HandleTypeDef *hadc, const uint16_t *pData, uint32_t Count)
+{
+    ADC_OversamplingTypeDef *ovs = &hadc->Oversampling;
+    uint32_t pos = hadc->OvsPos;
+    uint32_t i;
+
+    while (Count-- != 0U)
+    {
+        hadc->OvsSum[pos] += *pData++;
+        if (++pos < ovs->FrameLength) {
+            continue;
+        }
+        pos = 0U;
+        if (++hadc->OvsFrames < ovs->Ratio) {
+            continue;
+        }
+        for (i = 0U; i < ovs->FrameLength; i++) {
+            ovs->Result[i] = (uint16_t)(hadc->OvsSum[i] >> ovs->RightShift);
+            hadc->OvsSum[i] = 0U;
+        }
+        hadc->OvsFrames = 0U;
+        HAL_ADCEx_OversamplingCpltCallback(hadc);
+    }
+    hadc->OvsPos = pos;
+}
+
+static void ADC_DMAHalfConvCplt(DMA_HandleTypeDef *hdma)
+{
+    ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)hdma->Parent;
+
+    if (hadc->Oversampling.Ratio >= 2U) {
+        ADC_Accumulate(hadc, hadc->DmaBuffer, hadc->DmaSamples / 2U);
+    }
+    HAL_ADC_ConvHalfCpltCallback(hadc);
+}
+
+static void ADC_DMAConvCplt(DMA_HandleTypeDef *hdma)
+{
+    ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)hdma->Parent;
+    uint32_t half = (hadc->DmaBuffer1 == NULL) ? (hadc->DmaSamples / 2U) : 0U;
+
+    if (hadc->Oversampling.Ratio >= 2U) {
+        ADC_Accumulate(hadc, &hadc->DmaBuffer[half], hadc->DmaSamples - half);
+    }
+    /* One-shot buffer: the acquisition is over */
+    if ((hdma->Init.Mode != DMA_CIRCULAR) && (hadc->DmaBuffer1 == NULL)) {
+        hadc->State = (hadc->State & ~HAL_ADC_STATE_REG_BUSY) | HAL_ADC_STATE_READY;
+    }
+    HAL_ADC_ConvCpltCallback(hadc);
+}
+
+/* Double buffer mode: memory 1 full */
+static void ADC_DMAM1ConvCplt(DMA_HandleTypeDef *hdma)
+{
+    ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)hdma->Parent;
+
+    if (hadc->Oversampling.Ratio >= 2U) {
+        ADC_Accumulate(hadc, hadc->DmaBuffer1, hadc->DmaSamples);
+    }
+    HAL_ADCEx_ConvM1CpltCallback(hadc);
+}
+
+static void ADC_DMAError(DMA_HandleTypeDef *hdma)
+{
+    ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)hdma->Parent;
+
+    hadc->State = HAL_ADC_STATE_ERROR;
+    hadc->ErrorCode |= HAL_ADC_ERROR_DMA;
+    HAL_ADC_ErrorCallback(hadc);
+}
\ No newline at end of file
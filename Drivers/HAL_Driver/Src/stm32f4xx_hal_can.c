@@ -0,0 +1,1021 @@
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief: Private macros
+ */
+#define CAN_TIMEOUT             100000U     /* MSR/RFxR status polls */
+#define CAN_NO_ROUTE            0xFFU
+#define CAN_F16_IDE             0x08U       /* IDE bit of a 16-bit filter */
+#define CAN_F16_RTR             0x10U       /* RTR bit of a 16-bit filter */
+
+/* The optimizer keeps RTR as one more identifier bit, above the identifier */
+#define CAN_FILTER_RTR_STD      (CAN_MASK_STD_EXACT + 1U)
+#define CAN_FILTER_RTR_EXT      (CAN_MASK_EXT_EXACT + 1U)
+
+/* Optimizer id or mask to filter register layout */
+#define CAN_F16(X)              ((((X) & CAN_MASK_STD_EXACT) << 5U) | ((((X) & CAN_FILTER_RTR_STD) != 0U) ? CAN_F16_RTR : 0U))
+#define CAN_F32_STD(X)          ((((X) & CAN_MASK_STD_EXACT) << 21U) | ((((X) & CAN_FILTER_RTR_STD) != 0U) ? CAN_TI0R_RTR : 0U))
+#define CAN_F32_EXT(X)          ((((X) & CAN_MASK_EXT_EXACT) << 3U) | ((((X) & CAN_FILTER_RTR_EXT) != 0U) ? CAN_TI0R_RTR : 0U) | \
+                                 CAN_TI0R_IDE)
+
+/* Filter classes, in bank write order */
+#define CAN_CLASS_M32           0U          /* Extended id/mask, 1 per bank */
+#define CAN_CLASS_L32           1U          /* Exact extended id, 2 per bank */
+#define CAN_CLASS_M16           2U          /* Standard id/mask, 2 per bank */
+#define CAN_CLASS_L16           3U          /* Exact standard id, 4 per bank */
+#define CAN_CLASSES             4U
+
+/**
+ * @brief: Working copy of one filter for the optimizer
+ */
+typedef struct
+{
+    uint32_t Id;
+    uint32_t Mask;
+    uint8_t  Ext;
+    uint8_t  Fifo;
+    uint8_t  Ring;
+    uint8_t  Class;
+} CAN_FilterEntryTypeDef;
+
+static CAN_FilterEntryTypeDef CAN_FilterWork[CAN_FMI_MAX];
+
+/**
+ * @brief: Private functions
+ */
+static HAL_StatusTypeDef CAN_WaitMsr(CAN_TypeDef *CANx, uint32_t Flag, uint32_t State);
+static uint32_t CAN_DrainFifo(CAN_HandleTypeDef *hcan, uint32_t Fifo);
+static uint32_t CAN_TxKey(const CAN_FrameTypeDef *pFrame);
+static uint32_t CAN_TxBefore(const CAN_FrameTypeDef *a, const CAN_FrameTypeDef *b);
+static void CAN_TxPush(CAN_HandleTypeDef *hcan, const CAN_FrameTypeDef *pFrame, uint32_t Requeue);
+static void CAN_TxPop(CAN_HandleTypeDef *hcan);
+static void CAN_TxSchedule(CAN_HandleTypeDef *hcan);
+static uint32_t CAN_Popcount(uint32_t Value);
+static uint32_t CAN_ClassOf(uint32_t Ext, uint32_t Mask);
+static uint32_t CAN_BanksFor(const uint32_t *pCount, uint32_t *pToM16, uint32_t *pToL32);
+static uint32_t CAN_BanksTotal(uint32_t Count[2][CAN_CLASSES]);
+static void CAN_WriteBank(uint32_t Bank, uint32_t Fifo, uint32_t List, uint32_t Scale32, uint32_t FR1, uint32_t FR2);
+
+/*------------------------------------------- Init -------------------------------------------*/
+/**
+ * @brief   Compute BTR for Bitrate from the CAN clock
+ * @note    Searches every prescaler for an exact bit time of 8 ~ 25 tq and keeps the
+ *          one closest to SamplePoint, preferring more tq per bit on ties.
+ *          1 tq sync + TS1 (1 ~ 16) + TS2 (1 ~ 8), sample point at (1 + TS1) / N.
+ * @param   PclkFreq      - CAN kernel clock (PCLK1)
+ * @param   SamplePoint   - Per mille, e.g. 875 (CANopen), 800
+ * @param   SyncJumpWidth - 1 ~ 4 tq, limited to TS2
+ * @param   pBtr          - BRP/TS1/TS2/SJW fields of BTR
+ * @retval  HAL_ERROR if no prescaler divides PclkFreq to an exact bit time
+ */
+HAL_StatusTypeDef HAL_CAN_ComputeBitTiming(uint32_t PclkFreq, uint32_t Bitrate, uint32_t SamplePoint,
+                                           uint32_t SyncJumpWidth, uint32_t *pBtr)
+{
+    uint32_t brp, ntq, ts1, ts2, sp, err;
+    uint32_t best_err = 0xFFFFFFFFU, best_ntq = 0U, best_btr = 0U;
+
+    if ((Bitrate == 0U) || (SamplePoint >= 1000U) || (SyncJumpWidth < 1U) || (SyncJumpWidth > 4U)) {
+        return HAL_ERROR;
+    }
+
+    for (brp = 1U; brp <= 1024U; brp++)
+    {
+        if ((PclkFreq % brp) != 0U) {
+            continue;
+        }
+        if (((PclkFreq / brp) % Bitrate) != 0U) {
+            continue;
+        }
+        ntq = PclkFreq / brp / Bitrate;
+        if ((ntq < 8U) || (ntq > 25U)) {
+            continue;
+        }
+
+        /* Sync + TS1 rounded to the wanted sample point, then clamped to the field ranges */
+        ts1 = ((ntq * SamplePoint + 500U) / 1000U) - 1U;
+        if (ts1 > 16U) {
+            ts1 = 16U;
+        }
+        ts2 = ntq - 1U - ts1;
+        if (ts2 > 8U) {
+            ts2 = 8U;
+            ts1 = ntq - 1U - ts2;
+        }
+        if ((ts2 < 1U) || (ts1 < 1U) || (ts1 > 16U)) {
+            continue;
+        }
+
+        sp = ((1U + ts1) * 1000U) / ntq;
+        err = (sp > SamplePoint) ? (sp - SamplePoint) : (SamplePoint - sp);
+        if ((err < best_err) || ((err == best_err) && (ntq > best_ntq))) {
+            best_err = err;
+            best_ntq = ntq;
+            best_btr = ((brp - 1U) << CAN_BTR_BRP_Pos) | ((ts1 - 1U) << CAN_BTR_TS1_Pos) |
+                       ((ts2 - 1U) << CAN_BTR_TS2_Pos) |
+                       ((((SyncJumpWidth < ts2) ? SyncJumpWidth : ts2) - 1U) << CAN_BTR_SJW_Pos);
+        }
+    }
+
+    if (best_ntq == 0U) {
+        return HAL_ERROR;
+    }
+    *pBtr = best_btr;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Initialize a controller and leave it in initialization mode
+ * @note    The clock (__HAL_RCC_CANx_CLK_ENABLE(), CAN1 as well for CAN2) and the pins
+ *          must be set up before. Bit timing comes from PCLK1, see HAL_CAN_ComputeBitTiming().
+ *          Filters and rings can then be configured, HAL_CAN_Start() joins the bus.
+ * @param   TxQueue     - Storage of the transmit priority queue
+ * @param   TxQueueSize - Frames, queued and in mailboxes together
+ */
+HAL_StatusTypeDef HAL_CAN_Init(CAN_HandleTypeDef *hcan, CAN_FrameTypeDef *TxQueue, uint32_t TxQueueSize)
+{
+    uint32_t mcr, btr, i;
+
+    if ((hcan == NULL) || (TxQueue == NULL) || (TxQueueSize == 0U)) {
+        return HAL_ERROR;
+    }
+    assert_param(IS_CAN_ALL_INSTANCE(hcan->Instance));
+
+    /* Sleep -> initialization mode */
+    CLEAR_BIT(hcan->Instance->MCR, CAN_MCR_SLEEP);
+    SET_BIT(hcan->Instance->MCR, CAN_MCR_INRQ);
+    if ((CAN_WaitMsr(hcan->Instance, CAN_MSR_SLAK, 0U) != HAL_OK) ||
+        (CAN_WaitMsr(hcan->Instance, CAN_MSR_INAK, CAN_MSR_INAK) != HAL_OK)) {
+        hcan->ErrorCode = HAL_CAN_ERROR_TIMEOUT;
+        hcan->State = HAL_CAN_STATE_ERROR;
+        return HAL_TIMEOUT;
+    }
+
+    if (HAL_CAN_ComputeBitTiming(HAL_RCC_GetPCLK1Freq(), hcan->Init.Bitrate, hcan->Init.SamplePoint,
+                                 hcan->Init.SyncJumpWidth, &btr) != HAL_OK) {
+        hcan->ErrorCode = HAL_CAN_ERROR_BITTIMING;
+        hcan->State = HAL_CAN_STATE_ERROR;
+        return HAL_ERROR;
+    }
+    WRITE_REG(hcan->Instance->BTR, btr | hcan->Init.Mode);
+
+    /* TXFP = 0: mailboxes leave in identifier order, the scheduler relies on it */
+    mcr = 0U;
+    if (hcan->Init.AutoBusOff != DISABLE) {
+        mcr |= CAN_MCR_ABOM;
+    }
+    if (hcan->Init.AutoWakeUp != DISABLE) {
+        mcr |= CAN_MCR_AWUM;
+    }
+    if (hcan->Init.AutoRetransmission == DISABLE) {
+        mcr |= CAN_MCR_NART;
+    }
+    if (hcan->Init.ReceiveFifoLocked != DISABLE) {
+        mcr |= CAN_MCR_RFLM;
+    }
+    MODIFY_REG(hcan->Instance->MCR, CAN_MCR_TTCM | CAN_MCR_ABOM | CAN_MCR_AWUM | CAN_MCR_NART |
+                                    CAN_MCR_RFLM | CAN_MCR_TXFP, mcr);
+
+    for (i = 0U; i < CAN_RX_RINGS_MAX; i++) {
+        hcan->RxRings[i] = NULL;
+    }
+    for (i = 0U; i < CAN_FMI_MAX; i++) {
+        hcan->FmiRoute[0][i] = CAN_NO_ROUTE;
+        hcan->FmiRoute[1][i] = CAN_NO_ROUTE;
+    }
+    hcan->RxUnrouted = 0U;
+
+    hcan->TxQueue = TxQueue;
+    hcan->TxQueueSize = TxQueueSize;
+    hcan->TxQueueCount = 0U;
+    hcan->TxMailboxBusy = 0U;
+    hcan->TxAbortPending = 0U;
+
+    hcan->ErrorCode = HAL_CAN_ERROR_NONE;
+    hcan->State = HAL_CAN_STATE_READY;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Software reset of the controller, filters are kept
+ */
+HAL_StatusTypeDef HAL_CAN_DeInit(CAN_HandleTypeDef *hcan)
+{
+    if (hcan == NULL) {
+        return HAL_ERROR;
+    }
+    CLEAR_REG(hcan->Instance->IER);
+    SET_BIT(hcan->Instance->MCR, CAN_MCR_RESET);
+    hcan->State = HAL_CAN_STATE_RESET;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Enable the interrupts and join the bus
+ * @note    The controller synchronizes on 11 recessive bits: a disconnected or
+ *          dominant-stuck bus times out.
+ */
+HAL_StatusTypeDef HAL_CAN_Start(CAN_HandleTypeDef *hcan)
+{
+    if (hcan->State != HAL_CAN_STATE_READY) {
+        return HAL_ERROR;
+    }
+    WRITE_REG(hcan->Instance->IER, CAN_IER_TMEIE | CAN_IER_FMPIE0 | CAN_IER_FOVIE0 | CAN_IER_FMPIE1 |
+                                   CAN_IER_FOVIE1 | CAN_IER_EWGIE | CAN_IER_EPVIE | CAN_IER_BOFIE | CAN_IER_ERRIE);
+    CLEAR_BIT(hcan->Instance->MCR, CAN_MCR_INRQ);
+    if (CAN_WaitMsr(hcan->Instance, CAN_MSR_INAK, 0U) != HAL_OK) {
+        hcan->ErrorCode |= HAL_CAN_ERROR_TIMEOUT;
+        return HAL_TIMEOUT;
+    }
+    hcan->State = HAL_CAN_STATE_LISTENING;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Leave the bus: back to initialization mode, pending mailboxes aborted
+ * @note    Aborted frames are dropped; frames still queued stay queued.
+ */
+HAL_StatusTypeDef HAL_CAN_Stop(CAN_HandleTypeDef *hcan)
+{
+    uint32_t primask;
+
+    SET_BIT(hcan->Instance->MCR, CAN_MCR_INRQ);
+    if (CAN_WaitMsr(hcan->Instance, CAN_MSR_INAK, CAN_MSR_INAK) != HAL_OK) {
+        hcan->ErrorCode |= HAL_CAN_ERROR_TIMEOUT;
+        return HAL_TIMEOUT;
+    }
+    CLEAR_REG(hcan->Instance->IER);
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    WRITE_REG(hcan->Instance->TSR, CAN_TSR_ABRQ0 | CAN_TSR_ABRQ1 | CAN_TSR_ABRQ2 |
+                                   CAN_TSR_RQCP0 | CAN_TSR_RQCP1 | CAN_TSR_RQCP2);
+    hcan->TxMailboxBusy = 0U;
+    hcan->TxAbortPending = 0U;
+    __set_PRIMASK(primask);
+
+    hcan->State = HAL_CAN_STATE_READY;
+    return HAL_OK;
+}
+
+/*------------------------------------------- Filters -------------------------------------------*/
+/**
+ * @brief   Split the 28 filter banks: CAN1 gets 0 ~ SlaveStartFilterBank - 1, CAN2 the rest
+ * @param   SlaveStartFilterBank - 1 ~ 27 (reset value 14)
+ */
+HAL_StatusTypeDef HAL_CANEx_SetSlaveStartFilterBank(uint32_t SlaveStartFilterBank)
+{
+    if ((SlaveStartFilterBank == 0U) || (SlaveStartFilterBank >= CAN_FILTER_BANKS)) {
+        return HAL_ERROR;
+    }
+    SET_BIT(CAN1->FMR, CAN_FMR_FINIT);
+    MODIFY_REG(CAN1->FMR, CAN_FMR_CAN2SB, SlaveStartFilterBank << CAN_FMR_CAN2SB_Pos);
+    CLEAR_BIT(CAN1->FMR, CAN_FMR_FINIT);
+    return HAL_OK;
+}
+
+/**
+ * @brief   Pack wanted identifiers into as few of the controller's filter banks as possible
+ * @note    Each bank is one of: 4 exact standard IDs (16-bit list), 2 standard id/mask
+ *          (16-bit mask), 2 exact extended IDs (32-bit list) or 1 extended id/mask
+ *          (32-bit mask). Exact standard IDs also fill spare 16-bit mask slots and a spare
+ *          32-bit list slot when that saves a bank; the split is chosen by exhaustive search
+ *          per FIFO. Unused slots of a bank repeat one of its entries. Exact means the frame
+ *          type too (Rtr data or remote); the RTR bit is written in list and mask slots
+ *          alike, so a filter matches the same frames whatever bank class it lands in.
+ *
+ *          If the banks still do not fit, filters of the same FIFO, ring and identifier
+ *          type are merged, each time the pair that saves the most banks while keeping the
+ *          most mask bits (so the fewest extra IDs), until they fit. pReport->Merged tells
+ *          how many merges were needed; those rings may then see IDs beyond the list, and
+ *          remote frames if data and remote filters were merged.
+ *
+ *          Every bank of the controller is rewritten and the FMI routing table rebuilt.
+ *          Reception on both controllers pauses while FINIT is set.
+ * @param   pFilters - Wanted filters, at most CAN_FMI_MAX
+ * @param   pReport  - Optional, banks used and merges
+ * @retval  HAL_ERROR, with nothing written, on a bad ring, FIFO or Rtr, on the same filter
+ *          (identifier, mask, types and FIFO) given twice with different rings, or when
+ *          no merge makes the banks fit
+ */
+HAL_StatusTypeDef HAL_CANEx_OptimizeFilters(CAN_HandleTypeDef *hcan, const CAN_FilterTypeDef *pFilters, uint32_t Count,
+                                            CAN_FilterReportTypeDef *pReport)
+{
+    CAN_FilterEntryTypeDef *work = CAN_FilterWork;
+    CAN_FilterEntryTypeDef *e;
+    uint32_t count[2][CAN_CLASSES] = {{0U}};
+    uint32_t tmp[CAN_CLASSES];
+    uint32_t first, end, avail, n, i, j, f, c, width, rtr, merged = 0U;
+    uint32_t total, best_banks, best_pop, best_i = 0U, best_j = 0U, banks, pop, mask, cls;
+    uint32_t to_m16, to_l32, bank, fmi;
+    uint8_t order[CAN_FMI_MAX];
+    uint32_t nclass[CAN_CLASSES], k;
+    uint32_t v[4];
+    uint32_t cache[2][CAN_CLASSES][CAN_CLASSES][CAN_CLASSES];
+
+    if ((Count == 0U) || (Count > CAN_FMI_MAX)) {
+        return HAL_ERROR;
+    }
+    assert_param(IS_CAN_ALL_INSTANCE(hcan->Instance));
+
+    /* Controller's bank range */
+    k = (CAN1->FMR & CAN_FMR_CAN2SB) >> CAN_FMR_CAN2SB_Pos;
+    first = (hcan->Instance == CAN1) ? 0U : k;
+    end = (hcan->Instance == CAN1) ? k : CAN_FILTER_BANKS;
+    avail = end - first;
+
+    /* Normalize and drop duplicates */
+    n = 0U;
+    for (i = 0U; i < Count; i++)
+    {
+        if ((pFilters[i].Ring >= CAN_RX_RINGS_MAX) || (pFilters[i].Fifo > CAN_FILTER_FIFO1) ||
+            (pFilters[i].Rtr > CAN_FILTER_RTR_ANY)) {
+            return HAL_ERROR;
+        }
+        width = (pFilters[i].IdType == CAN_ID_EXT) ? CAN_MASK_EXT_EXACT : CAN_MASK_STD_EXACT;
+        rtr = width + 1U;
+        e = &work[n];
+        e->Mask = (pFilters[i].Mask & width) | ((pFilters[i].Rtr != CAN_FILTER_RTR_ANY) ? rtr : 0U);
+        e->Id = (pFilters[i].Id | ((pFilters[i].Rtr == CAN_RTR_REMOTE) ? rtr : 0U)) & e->Mask;
+        e->Ext = (pFilters[i].IdType == CAN_ID_EXT) ? 1U : 0U;
+        e->Fifo = (uint8_t)pFilters[i].Fifo;
+        e->Ring = (uint8_t)pFilters[i].Ring;
+        e->Class = (uint8_t)CAN_ClassOf(e->Ext, e->Mask);
+
+        for (j = 0U; j < n; j++) {
+            if ((work[j].Id == e->Id) && (work[j].Mask == e->Mask) && (work[j].Ext == e->Ext) && (work[j].Fifo == e->Fifo)) {
+                break;
+            }
+        }
+        if (j == n) {
+            count[e->Fifo][e->Class]++;
+            n++;
+        }
+        else if (work[j].Ring != e->Ring) {
+            /* One filter, one route: the frames can't go to both rings */
+            return HAL_ERROR;
+        }
+    }
+
+    /* Merge until the banks fit */
+    total = CAN_BanksTotal(count);
+    while (total > avail)
+    {
+        best_banks = 0xFFFFFFFFU;
+        best_pop = 0U;
+        /* Banks after a merge depend only on the classes involved */
+        for (f = 0U; f < (2U * CAN_CLASSES * CAN_CLASSES * CAN_CLASSES); f++) {
+            (&cache[0][0][0][0])[f] = 0xFFFFFFFFU;
+        }
+        for (i = 0U; i < n; i++)
+        {
+            for (j = i + 1U; j < n; j++)
+            {
+                if ((work[i].Fifo != work[j].Fifo) || (work[i].Ring != work[j].Ring) || (work[i].Ext != work[j].Ext)) {
+                    continue;
+                }
+                f = work[i].Fifo;
+                mask = work[i].Mask & work[j].Mask & ~(work[i].Id ^ work[j].Id);
+                cls = CAN_ClassOf(work[i].Ext, mask);
+
+                banks = cache[f][work[i].Class][work[j].Class][cls];
+                if (banks == 0xFFFFFFFFU) {
+                    for (c = 0U; c < CAN_CLASSES; c++) {
+                        tmp[c] = count[f][c];
+                    }
+                    tmp[work[i].Class]--;
+                    tmp[work[j].Class]--;
+                    tmp[cls]++;
+                    banks = total - CAN_BanksFor(count[f], NULL, NULL) + CAN_BanksFor(tmp, NULL, NULL);
+                    cache[f][work[i].Class][work[j].Class][cls] = banks;
+                }
+                pop = CAN_Popcount(mask);
+
+                if ((banks < best_banks) || ((banks == best_banks) && (pop > best_pop))) {
+                    best_banks = banks;
+                    best_pop = pop;
+                    best_i = i;
+                    best_j = j;
+                }
+            }
+        }
+        if (best_banks == 0xFFFFFFFFU) {
+            return HAL_ERROR;
+        }
+
+        f = work[best_i].Fifo;
+        count[f][work[best_i].Class]--;
+        count[f][work[best_j].Class]--;
+        work[best_i].Mask &= work[best_j].Mask & ~(work[best_i].Id ^ work[best_j].Id);
+        work[best_i].Id &= work[best_i].Mask;
+        work[best_i].Class = (uint8_t)CAN_ClassOf(work[best_i].Ext, work[best_i].Mask);
+        count[f][work[best_i].Class]++;
+        work[best_j] = work[n - 1U];
+        n--;
+        merged++;
+        total = CAN_BanksTotal(count);
+    }
+
+    /* Write the banks, FIFO 0 first; filter numbers count per FIFO from the first bank */
+    SET_BIT(CAN1->FMR, CAN_FMR_FINIT);
+    for (i = 0U; i < CAN_FMI_MAX; i++) {
+        hcan->FmiRoute[0][i] = CAN_NO_ROUTE;
+        hcan->FmiRoute[1][i] = CAN_NO_ROUTE;
+    }
+    bank = first;
+
+    for (f = 0U; f < 2U; f++)
+    {
+        fmi = 0U;
+        (void)CAN_BanksFor(count[f], &to_m16, &to_l32);
+
+        /* Order this FIFO's entries by class; the last exact standard IDs move up */
+        k = 0U;
+        for (c = 0U; c < CAN_CLASSES; c++)
+        {
+            nclass[c] = 0U;
+            for (i = 0U; i < n; i++) {
+                if ((work[i].Fifo == f) && (work[i].Class == c)) {
+                    order[k++] = (uint8_t)i;
+                    nclass[c]++;
+                }
+            }
+        }
+        /* order: M32 | L32 | M16 | L16; moving the L16 tail into L32/M16 keeps class runs contiguous */
+        i = nclass[CAN_CLASS_M32] + nclass[CAN_CLASS_L32];
+        for (j = 0U; j < to_l32; j++) {
+            uint8_t t = order[k - 1U - j];
+            uint32_t m;
+            for (m = k - 1U - j; m > i; m--) {
+                order[m] = order[m - 1U];
+            }
+            order[i++] = t;
+        }
+        nclass[CAN_CLASS_L32] += to_l32;
+        nclass[CAN_CLASS_L16] -= to_l32;
+        nclass[CAN_CLASS_M16] += to_m16;
+        nclass[CAN_CLASS_L16] -= to_m16;
+
+        i = 0U;
+        for (c = 0U; c < CAN_CLASSES; c++)
+        {
+            uint32_t per = (c == CAN_CLASS_M32) ? 1U : ((c == CAN_CLASS_L16) ? 4U : 2U);
+            uint32_t left = nclass[c];
+
+            while (left != 0U)
+            {
+                uint32_t used = (left < per) ? left : per;
+
+                for (j = 0U; j < per; j++)
+                {
+                    e = &work[order[i + ((j < used) ? j : 0U)]];
+                    hcan->FmiRoute[f][fmi + j] = e->Ring;
+                    switch (c)
+                    {
+                        case CAN_CLASS_M32:
+                            v[0] = e->Ext ? CAN_F32_EXT(e->Id) : CAN_F32_STD(e->Id);
+                            v[1] = e->Ext ? CAN_F32_EXT(e->Mask) : (CAN_F32_STD(e->Mask) | CAN_TI0R_IDE);
+                            break;
+                        case CAN_CLASS_L32:
+                            v[j] = e->Ext ? CAN_F32_EXT(e->Id) : CAN_F32_STD(e->Id);
+                            break;
+                        case CAN_CLASS_M16:
+                            /* Moved exact IDs keep their all-ones mask, RTR included */
+                            v[j] = CAN_F16(e->Id) | ((CAN_F16(e->Mask) | CAN_F16_IDE) << 16U);
+                            break;
+                        default:
+                            v[j] = CAN_F16(e->Id);
+                            break;
+                    }
+                }
+
+                if (bank >= end) {
+                    CLEAR_BIT(CAN1->FMR, CAN_FMR_FINIT);
+                    return HAL_ERROR;
+                }
+                switch (c)
+                {
+                    case CAN_CLASS_M32: CAN_WriteBank(bank, f, 0U, 1U, v[0], v[1]); break;
+                    case CAN_CLASS_L32: CAN_WriteBank(bank, f, 1U, 1U, v[0], v[1]); break;
+                    case CAN_CLASS_M16: CAN_WriteBank(bank, f, 0U, 0U, v[0], v[1]); break;
+                    default:            CAN_WriteBank(bank, f, 1U, 0U, v[0] | (v[1] << 16U), v[2] | (v[3] << 16U)); break;
+                }
+                bank++;
+                fmi += per;
+                i += used;
+                left -= used;
+            }
+        }
+    }
+
+    /* Unused banks of this controller */
+    for (; bank < end; bank++) {
+        CLEAR_BIT(CAN1->FA1R, 1UL << bank);
+    }
+    CLEAR_BIT(CAN1->FMR, CAN_FMR_FINIT);
+
+    if (pReport != NULL) {
+        pReport->BanksUsed = total;
+        pReport->BanksAvailable = avail;
+        pReport->Merged = merged;
+    }
+    return HAL_OK;
+}
+
+/*------------------------------------------- Reception -------------------------------------------*/
+/**
+ * @param   Size - Frames, a power of 2
+ */
+HAL_StatusTypeDef HAL_CAN_RxRingInit(CAN_RxRingTypeDef *Ring, CAN_FrameTypeDef *Buffer, uint32_t Size)
+{
+    if ((Buffer == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U)) {
+        return HAL_ERROR;
+    }
+    Ring->Buffer = Buffer;
+    Ring->Mask = Size - 1U;
+    Ring->Head = 0U;
+    Ring->Tail = 0U;
+    Ring->Dropped = 0U;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Give frames routed to ring Index (CAN_FilterTypeDef.Ring) to Ring
+ */
+HAL_StatusTypeDef HAL_CAN_AttachRxRing(CAN_HandleTypeDef *hcan, uint32_t Index, CAN_RxRingTypeDef *Ring)
+{
+    if (Index >= CAN_RX_RINGS_MAX) {
+        return HAL_ERROR;
+    }
+    hcan->RxRings[Index] = Ring;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Oldest frame of a ring, read in place
+ * @retval  NULL if the ring is empty. The frame stays valid until HAL_CAN_RxRingRelease().
+ */
+const CAN_FrameTypeDef *HAL_CAN_RxRingPeek(CAN_RxRingTypeDef *Ring)
+{
+    uint32_t tail = Ring->Tail;
+
+    if (Ring->Head == tail) {
+        return NULL;
+    }
+    /* Frame contents after the index */
+    __DMB();
+    return &Ring->Buffer[tail & Ring->Mask];
+}
+
+/**
+ * @brief   Hand the peeked frame back to the interrupt
+ */
+void HAL_CAN_RxRingRelease(CAN_RxRingTypeDef *Ring)
+{
+    __DMB();
+    Ring->Tail = Ring->Tail + 1U;
+}
+
+uint32_t HAL_CAN_RxRingCount(const CAN_RxRingTypeDef *Ring)
+{
+    return Ring->Head - Ring->Tail;
+}
+
+/*------------------------------------------- Transmission -------------------------------------------*/
+/**
+ * @brief   Queue a frame for transmission in bus priority order
+ * @note    Frames with the same identifier leave in call order. Callable from thread
+ *          and interrupt context.
+ * @retval  HAL_BUSY if the queue is full
+ */
+HAL_StatusTypeDef HAL_CAN_Transmit(CAN_HandleTypeDef *hcan, const CAN_FrameTypeDef *pFrame)
+{
+    uint32_t primask, busy;
+
+    assert_param((pFrame->IdType == CAN_ID_EXT) ? IS_CAN_EXTID(pFrame->Id) : IS_CAN_STDID(pFrame->Id));
+    if (pFrame->Dlc > 8U) {
+        return HAL_ERROR;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    busy = CAN_Popcount(hcan->TxMailboxBusy);
+    if ((hcan->TxQueueCount + busy) >= hcan->TxQueueSize) {
+        __set_PRIMASK(primask);
+        return HAL_BUSY;
+    }
+    CAN_TxPush(hcan, pFrame, 0U);
+    CAN_TxSchedule(hcan);
+    __set_PRIMASK(primask);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Frames queued or in a mailbox
+ */
+uint32_t HAL_CAN_GetTxPending(CAN_HandleTypeDef *hcan)
+{
+    return hcan->TxQueueCount + CAN_Popcount(hcan->TxMailboxBusy);
+}
+
+/*------------------------------------------- IRQ -------------------------------------------*/
+/**
+ * @brief   Handle the TX, RX0, RX1 and SCE interrupts of a controller
+ */
+void HAL_CAN_IRQHandler(CAN_HandleTypeDef *hcan)
+{
+    CAN_FrameTypeDef done[CAN_TX_MAILBOXES];
+    uint32_t ndone = 0U, error = 0U, rings = 0U;
+    uint32_t ier = hcan->Instance->IER;
+    uint32_t tsr, esr, m, bit, primask;
+
+    /* Transmit mailboxes */
+    tsr = hcan->Instance->TSR;
+    if (((ier & CAN_IER_TMEIE) != 0U) && ((tsr & (CAN_TSR_RQCP0 | CAN_TSR_RQCP1 | CAN_TSR_RQCP2)) != 0U))
+    {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        for (m = 0U; m < CAN_TX_MAILBOXES; m++)
+        {
+            if ((tsr & (CAN_TSR_RQCP0 << (8U * m))) == 0U) {
+                continue;
+            }
+            /* RQCP also clears TXOK, ALST and TERR */
+            WRITE_REG(hcan->Instance->TSR, CAN_TSR_RQCP0 << (8U * m));
+            bit = 1UL << m;
+            if ((hcan->TxMailboxBusy & bit) == 0U) {
+                continue;
+            }
+            hcan->TxMailboxBusy &= ~bit;
+
+            if ((tsr & (CAN_TSR_TXOK0 << (8U * m))) != 0U) {
+                done[ndone++] = hcan->TxMailbox[m];
+            }
+            else if ((hcan->TxAbortPending & bit) != 0U) {
+                /* Preempted by a higher priority frame: back in the queue, order kept */
+                CAN_TxPush(hcan, &hcan->TxMailbox[m], 1U);
+            }
+            else {
+                hcan->ErrorCode |= HAL_CAN_ERROR_TX;
+                error = 1U;
+            }
+            hcan->TxAbortPending &= ~bit;
+        }
+        CAN_TxSchedule(hcan);
+        __set_PRIMASK(primask);
+
+        for (m = 0U; m < ndone; m++) {
+            HAL_CAN_TxCompleteCallback(hcan, &done[m]);
+        }
+    }
+
+    /* Receive FIFOs */
+    if ((ier & CAN_IER_FMPIE0) != 0U) {
+        rings |= CAN_DrainFifo(hcan, CAN_FILTER_FIFO0);
+    }
+    if ((ier & CAN_IER_FMPIE1) != 0U) {
+        rings |= CAN_DrainFifo(hcan, CAN_FILTER_FIFO1);
+    }
+    if (((ier & CAN_IER_FOVIE0) != 0U) && ((hcan->Instance->RF0R & CAN_RF0R_FOVR0) != 0U)) {
+        WRITE_REG(hcan->Instance->RF0R, CAN_RF0R_FOVR0);
+        hcan->ErrorCode |= HAL_CAN_ERROR_RX_FOV0;
+        error = 1U;
+    }
+    if (((ier & CAN_IER_FOVIE1) != 0U) && ((hcan->Instance->RF1R & CAN_RF1R_FOVR1) != 0U)) {
+        WRITE_REG(hcan->Instance->RF1R, CAN_RF1R_FOVR1);
+        hcan->ErrorCode |= HAL_CAN_ERROR_RX_FOV1;
+        error = 1U;
+    }
+    if (rings != 0U) {
+        HAL_CAN_RxCallback(hcan, rings);
+    }
+
+    /* Status change / error */
+    if (((ier & CAN_IER_ERRIE) != 0U) && ((hcan->Instance->MSR & CAN_MSR_ERRI) != 0U))
+    {
+        esr = hcan->Instance->ESR;
+        hcan->LastErrorStatus = esr;
+        if ((esr & CAN_ESR_EWGF) != 0U) {
+            hcan->ErrorCode |= HAL_CAN_ERROR_EWG;
+        }
+        if ((esr & CAN_ESR_EPVF) != 0U) {
+            hcan->ErrorCode |= HAL_CAN_ERROR_EPV;
+        }
+        if ((esr & CAN_ESR_BOFF) != 0U) {
+            hcan->ErrorCode |= HAL_CAN_ERROR_BOF;
+        }
+        WRITE_REG(hcan->Instance->MSR, CAN_MSR_ERRI);
+        error = 1U;
+    }
+
+    if (error != 0U) {
+        HAL_CAN_ErrorCallback(hcan);
+    }
+}
+
+/**
+ * @brief   Frames were added to the rings in RingMask (bit n = ring n)
+ */
+__weak void HAL_CAN_RxCallback(CAN_HandleTypeDef *hcan, uint32_t RingMask)
+{
+    UNUSED(hcan);
+    UNUSED(RingMask);
+}
+
+__weak void HAL_CAN_TxCompleteCallback(CAN_HandleTypeDef *hcan, const CAN_FrameTypeDef *pFrame)
+{
+    UNUSED(hcan);
+    UNUSED(pFrame);
+}
+
+__weak void HAL_CAN_ErrorCallback(CAN_HandleTypeDef *hcan)
+{
+    UNUSED(hcan);
+}
+
+HAL_CAN_StateTypeDef HAL_CAN_GetState(CAN_HandleTypeDef *hcan)
+{
+    return hcan->State;
+}
+
+uint32_t HAL_CAN_GetError(CAN_HandleTypeDef *hcan)
+{
+    return hcan->ErrorCode;
+}
+
+/*---------------------------------- Private functions ----------------------------------*/
+static HAL_StatusTypeDef CAN_WaitMsr(CAN_TypeDef *CANx, uint32_t Flag, uint32_t State)
+{
+    uint32_t timeout = CAN_TIMEOUT;
+
+    while ((CANx->MSR & Flag) != State) {
+        if (timeout-- == 0U) {
+            return HAL_TIMEOUT;
+        }
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief   Move every pending frame of a FIFO into the ring of its filter
+ * @retval  Mask of the rings that received frames
+ */
+static uint32_t CAN_DrainFifo(CAN_HandleTypeDef *hcan, uint32_t Fifo)
+{
+    __IO uint32_t *rfr = (Fifo == CAN_FILTER_FIFO0) ? &hcan->Instance->RF0R : &hcan->Instance->RF1R;
+    CAN_FIFOMailBox_TypeDef *mb = &hcan->Instance->sFIFOMailBox[Fifo];
+    CAN_RxRingTypeDef *ring;
+    CAN_FrameTypeDef *frame;
+    uint32_t rir, rdtr, fmi, route, head, timeout;
+    uint32_t rings = 0U;
+
+    while ((*rfr & CAN_RF0R_FMP0) != 0U)
+    {
+        rir = mb->RIR;
+        rdtr = mb->RDTR;
+        fmi = (rdtr & CAN_RDT0R_FMI) >> CAN_RDT0R_FMI_Pos;
+        route = (fmi < CAN_FMI_MAX) ? hcan->FmiRoute[Fifo][fmi] : CAN_NO_ROUTE;
+        ring = (route < CAN_RX_RINGS_MAX) ? hcan->RxRings[route] : NULL;
+
+        if (ring == NULL) {
+            hcan->RxUnrouted++;
+        }
+        else if ((ring->Head - ring->Tail) > ring->Mask) {
+            ring->Dropped++;
+        }
+        else {
+            head = ring->Head;
+            frame = &ring->Buffer[head & ring->Mask];
+            if ((rir & CAN_TI0R_IDE) != 0U) {
+                frame->Id = rir >> CAN_TI0R_EXID_Pos;
+                frame->IdType = CAN_ID_EXT;
+            }
+            else {
+                frame->Id = rir >> CAN_TI0R_STID_Pos;
+                frame->IdType = CAN_ID_STD;
+            }
+            frame->Rtr = ((rir & CAN_TI0R_RTR) != 0U) ? CAN_RTR_REMOTE : CAN_RTR_DATA;
+            frame->Dlc = (uint8_t)(rdtr & CAN_RDT0R_DLC);
+            frame->FilterMatchIndex = (uint8_t)fmi;
+            frame->Timestamp = (uint16_t)(rdtr >> CAN_RDT0R_TIME_Pos);
+            frame->Word[0] = mb->RDLR;
+            frame->Word[1] = mb->RDHR;
+            /* Publish the frame after its contents */
+            __DMB();
+            ring->Head = head + 1U;
+            rings |= 1UL << route;
+        }
+
+        /* Release the output mailbox; RFOM clears once the next frame is visible */
+        WRITE_REG(*rfr, CAN_RF0R_RFOM0);
+        timeout = CAN_TIMEOUT;
+        while (((*rfr & CAN_RF0R_RFOM0) != 0U) && (timeout-- != 0U)) {
+        }
+    }
+    return rings;
+}
+
+/**
+ * @brief   Arbitration order key: base ID, then IDE (standard wins), then extension, then RTR
+ */
+static uint32_t CAN_TxKey(const CAN_FrameTypeDef *pFrame)
+{
+    uint32_t key;
+
+    if (pFrame->IdType == CAN_ID_EXT) {
+        key = ((pFrame->Id >> 18U) << 19U) | (1UL << 18U) | (pFrame->Id & 0x3FFFFU);
+    }
+    else {
+        key = pFrame->Id << 19U;
+    }
+    return (key << 1U) | pFrame->Rtr;
+}
+
+/* a leaves before b: lower key, then older sequence (kept in Timestamp while queued) */
+static uint32_t CAN_TxBefore(const CAN_FrameTypeDef *a, const CAN_FrameTypeDef *b)
+{
+    uint32_t ka = CAN_TxKey(a);
+    uint32_t kb = CAN_TxKey(b);
+
+    if (ka != kb) {
+        return (ka < kb) ? 1U : 0U;
+    }
+    return ((int16_t)(a->Timestamp - b->Timestamp) < 0) ? 1U : 0U;
+}
+
+static void CAN_TxPush(CAN_HandleTypeDef *hcan, const CAN_FrameTypeDef *pFrame, uint32_t Requeue)
+{
+    static uint16_t seq = 0U;
+    CAN_FrameTypeDef *heap = hcan->TxQueue;
+    CAN_FrameTypeDef item = *pFrame;
+    uint32_t i = hcan->TxQueueCount++;
+    uint32_t parent;
+
+    /* New frames get a sequence number, requeued ones keep theirs */
+    if (Requeue == 0U) {
+        item.Timestamp = seq++;
+    }
+    while (i != 0U)
+    {
+        parent = (i - 1U) / 2U;
+        if (CAN_TxBefore(&item, &heap[parent]) == 0U) {
+            break;
+        }
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = item;
+}
+
+static void CAN_TxPop(CAN_HandleTypeDef *hcan)
+{
+    CAN_FrameTypeDef *heap = hcan->TxQueue;
+    uint32_t n = --hcan->TxQueueCount;
+    uint32_t i = 0U, child;
+
+    while ((child = 2U * i + 1U) < n)
+    {
+        if (((child + 1U) < n) && (CAN_TxBefore(&heap[child + 1U], &heap[child]) != 0U)) {
+            child++;
+        }
+        if (CAN_TxBefore(&heap[child], &heap[n]) == 0U) {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = heap[n];
+}
+
+/**
+ * @brief   Keep the highest priority frames in the mailboxes, interrupts masked
+ */
+static void CAN_TxSchedule(CAN_HandleTypeDef *hcan)
+{
+    CAN_TxMailBox_TypeDef *mb;
+    const CAN_FrameTypeDef *top;
+    uint32_t free, m, worst, key;
+
+    while (hcan->TxQueueCount != 0U)
+    {
+        top = &hcan->TxQueue[0];
+        key = CAN_TxKey(top);
+
+        /* Same identifier already in a mailbox: the hardware would not keep their order */
+        for (m = 0U; m < CAN_TX_MAILBOXES; m++) {
+            if (((hcan->TxMailboxBusy & (1UL << m)) != 0U) && (CAN_TxKey(&hcan->TxMailbox[m]) == key)) {
+                return;
+            }
+        }
+
+        free = ((hcan->Instance->TSR & CAN_TSR_TME) >> CAN_TSR_TME_Pos) & ~hcan->TxMailboxBusy & 0x7U;
+        if (free != 0U)
+        {
+            m = (free & 1U) ? 0U : ((free & 2U) ? 1U : 2U);
+            mb = &hcan->Instance->sTxMailBox[m];
+            hcan->TxMailbox[m] = *top;
+            hcan->TxMailboxBusy |= 1UL << m;
+            CAN_TxPop(hcan);
+
+            top = &hcan->TxMailbox[m];
+            mb->TDTR = top->Dlc;
+            mb->TDLR = top->Word[0];
+            mb->TDHR = top->Word[1];
+            mb->TIR = ((top->IdType == CAN_ID_EXT) ? ((top->Id << CAN_TI0R_EXID_Pos) | CAN_TI0R_IDE)
+                                                   : (top->Id << CAN_TI0R_STID_Pos)) |
+                      ((top->Rtr != CAN_RTR_DATA) ? CAN_TI0R_RTR : 0U) | CAN_TI0R_TXRQ;
+            continue;
+        }
+
+        /* All mailboxes taken: preempt the lowest priority one if the queue head outranks it */
+        worst = CAN_TX_MAILBOXES;
+        for (m = 0U; m < CAN_TX_MAILBOXES; m++) {
+            if ((hcan->TxAbortPending & (1UL << m)) != 0U) {
+                return;
+            }
+            if ((hcan->TxMailboxBusy & (1UL << m)) == 0U) {
+                continue;
+            }
+            if ((worst == CAN_TX_MAILBOXES) || (CAN_TxBefore(&hcan->TxMailbox[worst], &hcan->TxMailbox[m]) != 0U)) {
+                worst = m;
+            }
+        }
+        if ((worst != CAN_TX_MAILBOXES) && (CAN_TxBefore(top, &hcan->TxMailbox[worst]) != 0U)) {
+            WRITE_REG(hcan->Instance->TSR, CAN_TSR_ABRQ0 << (8U * worst));
+            hcan->TxAbortPending |= 1UL << worst;
+        }
+        return;
+    }
+}
+
+static uint32_t CAN_Popcount(uint32_t Value)
+{
+    uint32_t n = 0U;
+
+    while (Value != 0U) {
+        Value &= Value - 1U;
+        n++;
+    }
+    return n;
+}
+
+static uint32_t CAN_ClassOf(uint32_t Ext, uint32_t Mask)
+{
+    if (Ext != 0U) {
+        return (Mask == (CAN_MASK_EXT_EXACT | CAN_FILTER_RTR_EXT)) ? CAN_CLASS_L32 : CAN_CLASS_M32;
+    }
+    return (Mask == (CAN_MASK_STD_EXACT | CAN_FILTER_RTR_STD)) ? CAN_CLASS_L16 : CAN_CLASS_M16;
+}
+
+/**
+ * @brief   Fewest banks for the class counts of one FIFO
+ * @param   pToM16 - Exact standard IDs to place in 16-bit mask slots (optional)
+ * @param   pToL32 - Exact standard ID to place in the spare 32-bit list slot (optional)
+ */
+static uint32_t CAN_BanksFor(const uint32_t *pCount, uint32_t *pToM16, uint32_t *pToL32)
+{
+    uint32_t l16 = pCount[CAN_CLASS_L16];
+    uint32_t best = 0xFFFFFFFFU, best_k = 0U, best_j = 0U;
+    uint32_t j, k, jmax, banks;
+
+    jmax = (((pCount[CAN_CLASS_L32] & 1U) != 0U) && (l16 != 0U)) ? 1U : 0U;
+    for (j = 0U; j <= jmax; j++)
+    {
+        for (k = 0U; k <= (l16 - j); k++)
+        {
+            banks = pCount[CAN_CLASS_M32] + ((pCount[CAN_CLASS_L32] + j + 1U) / 2U) +
+                    ((pCount[CAN_CLASS_M16] + k + 1U) / 2U) + ((l16 - j - k + 3U) / 4U);
+            if (banks < best) {
+                best = banks;
+                best_k = k;
+                best_j = j;
+            }
+        }
+    }
+    if (pToM16 != NULL) {
+        *pToM16 = best_k;
+    }
+    if (pToL32 != NULL) {
+        *pToL32 = best_j;
+    }
+    return best;
+}
+
+static uint32_t CAN_BanksTotal(uint32_t Count[2][CAN_CLASSES])
+{
+    return CAN_BanksFor(Count[0], NULL, NULL) + CAN_BanksFor(Count[1], NULL, NULL);
+}
+
+/* FINIT must be set */
+static void CAN_WriteBank(uint32_t Bank, uint32_t Fifo, uint32_t List, uint32_t Scale32, uint32_t FR1, uint32_t FR2)
+{
+    uint32_t bit = 1UL << Bank;
+
+    CLEAR_BIT(CAN1->FA1R, bit);
+    MODIFY_REG(CAN1->FM1R, bit, (List != 0U) ? bit : 0U);
+    MODIFY_REG(CAN1->FS1R, bit, (Scale32 != 0U) ? bit : 0U);
+    MODIFY_REG(CAN1->FFA1R, bit, (Fifo != 0U) ? bit : 0U);
+    CAN1->sFilterRegister[Bank].FR1 = FR1;
+    CAN1->sFilterRegister[Bank].FR2 = FR2;
+    SET_BIT(CAN1->FA1R, bit);
+}
\ No newline at end of file
@@ -1,5 +1,141 @@
 #include "stm32f4xx_hal.h"
 
+/**
+ * @brief   Set the priority grouping field (preemption priority and subpriority)
+ * @note    When NVIC_PRIORITYGROUP_0 is selected, IRQ preemption is no more possible.
+ *          The pending IRQ priority will be managed only by the subpriority.
+ * @param   PriorityGroup - refer @NVIC_Priority_Group
+ * @retval  None
+ */
+void HAL_NVIC_SetPriorityGrouping(uint32_t PriorityGroup)
+{
+    assert_param(IS_NVIC_PRIORITY_GROUP(PriorityGroup));
+
+    __NVIC_SetPriorityGrouping(PriorityGroup);
+}
+
+uint32_t HAL_NVIC_GetPriorityGrouping(void)
+{
+    return __NVIC_GetPriorityGrouping();
+}
+
+/**
+ * @brief   Set the priority of an interrupt
+ * @note    Lower value = higher urgency. An IRQ only preempts another one when its
+ *          preempt priority is strictly lower, sub-priority only orders pending IRQs.
+ * @param   IRQn            - External interrupt number or core exception (< 0)
+ * @param   PreemptPriority - 0..15, the number of usable values depends on the priority group
+ * @param   SubPriority     - 0..15, the number of usable values depends on the priority group
+ * @retval  None
+ */
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+    uint32_t prioritygroup;
+
+    assert_param(IS_NVIC_SUB_PRIORITY(SubPriority));
+    assert_param(IS_NVIC_PREEMPTION_PRIORITY(PreemptPriority));
+
+    prioritygroup = __NVIC_GetPriorityGrouping();
+
+    __NVIC_SetPriority(IRQn, NVIC_EncodePriority(prioritygroup, PreemptPriority, SubPriority));
+}
+
+/**
+ * @brief   Get the priority of an interrupt, split according to PriorityGroup
+ */
+void HAL_NVIC_GetPriority(IRQn_Type IRQn, uint32_t PriorityGroup, uint32_t *pPreemptPriority, uint32_t *pSubPriority)
+{
+    assert_param(IS_NVIC_PRIORITY_GROUP(PriorityGroup));
+
+    NVIC_DecodePriority(__NVIC_GetPriority(IRQn), PriorityGroup, pPreemptPriority, pSubPriority);
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    assert_param(IS_NVIC_DEVICE_IRQ(IRQn));
+
+    __NVIC_EnableIRQ(IRQn);
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    assert_param(IS_NVIC_DEVICE_IRQ(IRQn));
+
+    __NVIC_DisableIRQ(IRQn);
+}
+
+void HAL_NVIC_SystemReset(void)
+{
+    __NVIC_SystemReset();
+}
+
+/**
+ * @brief   Pending/active status of an external interrupt
+ * @retval  0 - not pending/active, 1 - pending/active
+ */
+uint32_t HAL_NVIC_GetPendingIRQ(IRQn_Type IRQn)
+{
+    assert_param(IS_NVIC_DEVICE_IRQ(IRQn));
+
+    return __NVIC_GetPendingIRQ(IRQn);
+}
+
+void HAL_NVIC_SetPendingIRQ(IRQn_Type IRQn)
+{
+    assert_param(IS_NVIC_DEVICE_IRQ(IRQn));
+
+    __NVIC_SetPendingIRQ(IRQn);
+}
+
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+    assert_param(IS_NVIC_DEVICE_IRQ(IRQn));
+
+    __NVIC_ClearPendingIRQ(IRQn);
+}
+
+uint32_t HAL_NVIC_GetActive(IRQn_Type IRQn)
+{
+    assert_param(IS_NVIC_DEVICE_IRQ(IRQn));
+
+    return __NVIC_GetActive(IRQn);
+}
+
+/**
+ * @brief   Install a handler for an interrupt/exception at runtime
+ * @note    The startup code copies the vector table into SRAM and points VTOR to it,
+ *          so a driver can bind a specialized handler (e.g. DMA mode vs IRQ mode)
+ *          instead of branching inside one generic handler.
+ *          The store is a single aligned word, so it is safe even while the IRQ is enabled:
+ *          an exception entry fetches either the old or the new handler, never a mix.
+ * @param   IRQn         - Interrupt number (core exceptions allowed, except Reset)
+ * @param   Handler      - New handler
+ * @param   pPrevHandler - Receives the previous handler (can be NULL)
+ * @retval  HAL_ERROR if VTOR does not point into SRAM (table is read-only)
+ */
+HAL_StatusTypeDef HAL_NVIC_SetVector(IRQn_Type IRQn, pNVIC_HandlerTypeDef Handler, pNVIC_HandlerTypeDef *pPrevHandler)
+{
+    assert_param(IS_NVIC_VECTOR_IRQ(IRQn));
+
+    if ((SCB->VTOR & 0xF0000000UL) != SRAM_BASE || Handler == NULL) {
+        return HAL_ERROR;
+    }
+
+    if (pPrevHandler != NULL) {
+        *pPrevHandler = (pNVIC_HandlerTypeDef)__NVIC_GetVector(IRQn);
+    }
+    __NVIC_SetVector(IRQn, (uint32_t)Handler);
+
+    return HAL_OK;
+}
+
+pNVIC_HandlerTypeDef HAL_NVIC_GetVector(IRQn_Type IRQn)
+{
+    assert_param(IS_NVIC_VECTOR_IRQ(IRQn));
+
+    return (pNVIC_HandlerTypeDef)__NVIC_GetVector(IRQn);
+}
+
 /**
  * @brief Initialize System Timer and its interrupt, and starts the System Tick Timer.
  * @param TicksNumb specifies the ticks (number of ticks between 2 interrupts)
@@ -9,4 +145,4 @@
 uint32_t HAL_SYSTICK_Config(uint32_t TicksNumb)
 {
     return SysTick_Config(TicksNumb);
-}
\ No newline at end of file
+}
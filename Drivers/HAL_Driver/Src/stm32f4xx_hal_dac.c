@@ -0,0 +1,543 @@
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief: Private macros
+ */
+#define DAC_DHR12R2_OFFSET      0x0CU       /* DHR12R2 - DHR12R1 */
+
+/**
+ * @brief: Quarter sine period, 64 steps + end point, Q15
+ */
+static const int16_t DAC_SineQuarter[65] = {
+        0,   804,  1608,  2410,  3212,  4011,  4808,  5602,
+     6393,  7179,  7962,  8739,  9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+    32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767
+};
+
+/**
+ * @brief: Private functions
+ */
+static HAL_StatusTypeDef DAC_StartDMA(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t SrcAddress,
+                                      uint32_t DstAddress, uint32_t Length);
+static int32_t DAC_DDSWave(uint32_t Waveform, uint32_t Phase);
+static uint32_t DAC_DDSNext(DAC_DDSTypeDef *dds);
+static void DAC_DMAConvCpltCh1(DMA_HandleTypeDef *hdma);
+static void DAC_DMAHalfConvCpltCh1(DMA_HandleTypeDef *hdma);
+static void DAC_DMAErrorCh1(DMA_HandleTypeDef *hdma);
+static void DAC_DMAConvCpltCh2(DMA_HandleTypeDef *hdma);
+static void DAC_DMAHalfConvCpltCh2(DMA_HandleTypeDef *hdma);
+static void DAC_DMAErrorCh2(DMA_HandleTypeDef *hdma);
+static void DAC_DMAChannelDone(DAC_HandleTypeDef *hdac, uint32_t Channel);
+
+/*------------------------------------------- Init -------------------------------------------*/
+/**
+ * @brief   Initialize the DAC handle
+ * @note    The DAC clock must be enabled before (__HAL_RCC_DAC_CLK_ENABLE()).
+ */
+HAL_StatusTypeDef HAL_DAC_Init(DAC_HandleTypeDef *hdac)
+{
+    if (hdac == NULL) {
+        return HAL_ERROR;
+    }
+    hdac->ErrorCode = HAL_DAC_ERROR_NONE;
+    hdac->State = HAL_DAC_STATE_READY;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DAC_DeInit(DAC_HandleTypeDef *hdac)
+{
+    if (hdac == NULL) {
+        return HAL_ERROR;
+    }
+    CLEAR_REG(hdac->Instance->CR);
+    __HAL_DAC_CLEAR_FLAG(hdac, DAC_SR_DMAUDR1 | DAC_SR_DMAUDR2);
+    hdac->State = HAL_DAC_STATE_RESET;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Set the trigger and output buffer of a channel, wave generation off
+ * @note    The trigger selection can not change while the channel is enabled.
+ * @param   Channel - DAC_CHANNEL_1 / DAC_CHANNEL_2
+ */
+HAL_StatusTypeDef HAL_DAC_ConfigChannel(DAC_HandleTypeDef *hdac, const DAC_ChannelConfTypeDef *sConfig, uint32_t Channel)
+{
+    assert_param(IS_DAC_CHANNEL(Channel));
+    assert_param(IS_DAC_TRIGGER(sConfig->Trigger));
+
+    if ((hdac->Instance->CR & (DAC_CR_EN1 << Channel)) != 0U) {
+        return HAL_BUSY;
+    }
+    MODIFY_REG(hdac->Instance->CR, (DAC_CR_BOFF1 | DAC_CR_TEN1 | DAC_CR_TSEL1 | DAC_CR_WAVE1 | DAC_CR_MAMP1) << Channel,
+               (sConfig->Trigger | sConfig->OutputBuffer) << Channel);
+    return HAL_OK;
+}
+
+/*------------------------------------------- Single channel -------------------------------------------*/
+/**
+ * @brief   Enable a channel
+ * @note    With DAC_TRIGGER_SOFTWARE the value already in DHR is converted now.
+ */
+HAL_StatusTypeDef HAL_DAC_Start(DAC_HandleTypeDef *hdac, uint32_t Channel)
+{
+    assert_param(IS_DAC_CHANNEL(Channel));
+
+    __HAL_DAC_ENABLE(hdac, Channel);
+    if ((hdac->Instance->CR & ((DAC_CR_TEN1 | DAC_CR_TSEL1) << Channel)) == (DAC_TRIGGER_SOFTWARE << Channel)) {
+        WRITE_REG(hdac->Instance->SWTRIGR, (Channel == DAC_CHANNEL_1) ? DAC_SWTRIGR_SWTRIG1 : DAC_SWTRIGR_SWTRIG2);
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DAC_Stop(DAC_HandleTypeDef *hdac, uint32_t Channel)
+{
+    assert_param(IS_DAC_CHANNEL(Channel));
+
+    __HAL_DAC_DISABLE(hdac, Channel);
+    return HAL_OK;
+}
+
+/**
+ * @brief   Write the data holding register of a channel
+ * @param   Alignment - See @ref DAC_Data_Alignment
+ * @param   Data      - 12-bit (right), 16-bit with 12 significant MSBs (left) or 8-bit value
+ */
+HAL_StatusTypeDef HAL_DAC_SetValue(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t Alignment, uint32_t Data)
+{
+    uint32_t dhr = (uint32_t)&hdac->Instance->DHR12R1 + Alignment;
+
+    assert_param(IS_DAC_CHANNEL(Channel));
+    assert_param(IS_DAC_ALIGN(Alignment));
+
+    if (Channel == DAC_CHANNEL_2) {
+        dhr += DAC_DHR12R2_OFFSET;
+    }
+    *(__IO uint32_t *)dhr = Data;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Value currently converted by a channel (DOR)
+ */
+uint32_t HAL_DAC_GetValue(DAC_HandleTypeDef *hdac, uint32_t Channel)
+{
+    return (Channel == DAC_CHANNEL_1) ? hdac->Instance->DOR1 : hdac->Instance->DOR2;
+}
+
+/**
+ * @brief   Stream a buffer to a channel, one sample per trigger
+ * @note    The channel needs a trigger (ConfigChannel) and its DMA stream linked
+ *          (__HAL_LINKDMA(hdac, DMA_Handle1, hdma)) set up memory-to-peripheral, half-word
+ *          memory size, word peripheral size, DMA_CIRCULAR for continuous playback.
+ * @param   pData     - Samples, in the layout of Alignment
+ * @param   Length    - Number of samples, 1 ~ 65535
+ */
+HAL_StatusTypeDef HAL_DAC_Start_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel, const uint16_t *pData, uint32_t Length, uint32_t Alignment)
+{
+    uint32_t dhr = (uint32_t)&hdac->Instance->DHR12R1 + Alignment;
+
+    assert_param(IS_DAC_CHANNEL(Channel));
+    assert_param(IS_DAC_ALIGN(Alignment));
+
+    if (Channel == DAC_CHANNEL_2) {
+        dhr += DAC_DHR12R2_OFFSET;
+    }
+    return DAC_StartDMA(hdac, Channel, (uint32_t)pData, dhr, Length);
+}
+
+HAL_StatusTypeDef HAL_DAC_Stop_DMA(DAC_HandleTypeDef *hdac, uint32_t Channel)
+{
+    DMA_HandleTypeDef *hdma = (Channel == DAC_CHANNEL_1) ? hdac->DMA_Handle1 : hdac->DMA_Handle2;
+    HAL_StatusTypeDef status;
+
+    assert_param(IS_DAC_CHANNEL(Channel));
+
+    if (hdma == NULL) {
+        return HAL_ERROR;
+    }
+    CLEAR_BIT(hdac->Instance->CR, DAC_CR_EN1 << Channel);
+    DAC_DMAChannelDone(hdac, Channel);
+    status = HAL_DMA_Abort(hdma);
+
+    return status;
+}
+
+/*------------------------------------------- Dual channel -------------------------------------------*/
+/**
+ * @brief   Enable both channels with a single CR write
+ */
+HAL_StatusTypeDef HAL_DACEx_DualStart(DAC_HandleTypeDef *hdac)
+{
+    SET_BIT(hdac->Instance->CR, DAC_CR_EN1 | DAC_CR_EN2);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DACEx_DualStop(DAC_HandleTypeDef *hdac)
+{
+    CLEAR_BIT(hdac->Instance->CR, DAC_CR_EN1 | DAC_CR_EN2);
+    return HAL_OK;
+}
+
+/**
+ * @brief   Load both channels with one write to DHR12RD/DHR12LD/DHR8RD
+ * @note    Without trigger both outputs change on the same APB1 cycle, with a trigger
+ *          on the same trigger edge.
+ * @param   Data1 - Channel 1 value
+ * @param   Data2 - Channel 2 value
+ */
+HAL_StatusTypeDef HAL_DACEx_DualSetValue(DAC_HandleTypeDef *hdac, uint32_t Alignment, uint32_t Data1, uint32_t Data2)
+{
+    uint32_t data;
+
+    assert_param(IS_DAC_ALIGN(Alignment));
+
+    if (Alignment == DAC_ALIGN_8B_R) {
+        data = (Data2 << 8U) | Data1;
+    }
+    else {
+        data = (Data2 << 16U) | Data1;
+    }
+    *(__IO uint32_t *)((uint32_t)&hdac->Instance->DHR12RD + Alignment) = data;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Software trigger on both channels at once
+ */
+HAL_StatusTypeDef HAL_DACEx_DualSoftwareTrigger(DAC_HandleTypeDef *hdac)
+{
+    WRITE_REG(hdac->Instance->SWTRIGR, DAC_SWTRIGR_SWTRIG1 | DAC_SWTRIGR_SWTRIG2);
+    return HAL_OK;
+}
+
+/**
+ * @brief   Stream words to DHR12RD: both channels update together from one DMA stream
+ * @note    Both channels must use the same trigger. Uses DMA_Handle1 (word memory and
+ *          peripheral size) and the channel 1 callbacks.
+ * @param   pData  - Words of (channel 2 << 16) | channel 1 (see HAL_DACEx_DDSSynthesizeDual())
+ * @param   Length - Number of words, 1 ~ 65535
+ */
+HAL_StatusTypeDef HAL_DACEx_DualStart_DMA(DAC_HandleTypeDef *hdac, const uint32_t *pData, uint32_t Length, uint32_t Alignment)
+{
+    uint32_t cr = hdac->Instance->CR;
+    HAL_StatusTypeDef status;
+
+    assert_param(IS_DAC_ALIGN(Alignment));
+
+    if (((cr >> DAC_CR_CHANNEL2_SHIFT) & (DAC_CR_TEN1 | DAC_CR_TSEL1)) != (cr & (DAC_CR_TEN1 | DAC_CR_TSEL1))) {
+        return HAL_ERROR;
+    }
+    status = DAC_StartDMA(hdac, DAC_CHANNEL_1, (uint32_t)pData, (uint32_t)&hdac->Instance->DHR12RD + Alignment, Length);
+    if (status == HAL_OK) {
+        __HAL_DAC_ENABLE(hdac, DAC_CHANNEL_2);
+    }
+    return status;
+}
+
+HAL_StatusTypeDef HAL_DACEx_DualStop_DMA(DAC_HandleTypeDef *hdac)
+{
+    __HAL_DAC_DISABLE(hdac, DAC_CHANNEL_2);
+    return HAL_DAC_Stop_DMA(hdac, DAC_CHANNEL_1);
+}
+
+/*------------------------------------------- Wave generation -------------------------------------------*/
+/**
+ * @brief   Hardware triangle: each trigger steps a counter 0 ~ Amplitude ~ 0 added to DHR
+ * @note    The channel needs a trigger. DHR + Amplitude must stay within 4095.
+ *          The output period is 2 * (Amplitude + 1) triggers.
+ * @param   Amplitude - See @ref DAC_Wave_Amplitude, DAC_TRIANGLEAMPLITUDE_xxx
+ */
+HAL_StatusTypeDef HAL_DACEx_TriangleWaveGenerate(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t Amplitude)
+{
+    assert_param(IS_DAC_CHANNEL(Channel));
+    assert_param(IS_DAC_AMPLITUDE(Amplitude));
+
+    MODIFY_REG(hdac->Instance->CR, (DAC_CR_WAVE1 | DAC_CR_MAMP1) << Channel, (DAC_WAVE_TRIANGLE | Amplitude) << Channel);
+    return HAL_OK;
+}
+
+/**
+ * @brief   Hardware noise: each trigger adds the masked 12-bit LFSR to DHR
+ * @param   Amplitude - See @ref DAC_Wave_Amplitude, DAC_LFSRUNMASK_xxx
+ */
+HAL_StatusTypeDef HAL_DACEx_NoiseWaveGenerate(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t Amplitude)
+{
+    assert_param(IS_DAC_CHANNEL(Channel));
+    assert_param(IS_DAC_AMPLITUDE(Amplitude));
+
+    MODIFY_REG(hdac->Instance->CR, (DAC_CR_WAVE1 | DAC_CR_MAMP1) << Channel, (DAC_WAVE_NOISE | Amplitude) << Channel);
+    return HAL_OK;
+}
+
+/*------------------------------------------- DDS -------------------------------------------*/
+/**
+ * @brief   Tuning word for Frequency at SampleRate: Frequency * 2^32 / SampleRate, rounded
+ * @param   Frequency  - Output frequency in Hz, below SampleRate / 2
+ * @param   SampleRate - Trigger rate in Hz
+ */
+uint32_t HAL_DACEx_DDSTuningWord(uint32_t Frequency, uint32_t SampleRate)
+{
+    if (SampleRate == 0U) {
+        return 0U;
+    }
+    return (uint32_t)((((uint64_t)Frequency << 32U) + (SampleRate / 2U)) / SampleRate);
+}
+
+/**
+ * @brief   Synthesize Count 12-bit right-aligned samples and advance the phase
+ * @note    Meant to be called from the half/full callbacks on the half just played.
+ *          Sine uses a 64-step quarter-wave table with linear interpolation
+ *          (error below 1 LSB at 12 bits).
+ */
+void HAL_DACEx_DDSSynthesize(DAC_DDSTypeDef *dds, uint16_t *pBuffer, uint32_t Count)
+{
+    while (Count-- != 0U) {
+        *pBuffer++ = (uint16_t)DAC_DDSNext(dds);
+    }
+}
+
+/**
+ * @brief   Synthesize Count DHR12RD words, channel 1 from dds1, channel 2 from dds2
+ */
+void HAL_DACEx_DDSSynthesizeDual(DAC_DDSTypeDef *dds1, DAC_DDSTypeDef *dds2, uint32_t *pBuffer, uint32_t Count)
+{
+    while (Count-- != 0U) {
+        *pBuffer++ = DAC_DDSNext(dds1) | (DAC_DDSNext(dds2) << 16U);
+    }
+}
+
+/*------------------------------------------- IRQ -------------------------------------------*/
+/**
+ * @brief   Handle DMA underrun, to be called from TIM6_DAC_IRQHandler
+ * @note    On underrun the channel stops issuing DMA requests; the stream has to be
+ *          restarted (trigger rate too high for the DMA/bus load).
+ */
+void HAL_DAC_IRQHandler(DAC_HandleTypeDef *hdac)
+{
+    uint32_t cr = hdac->Instance->CR;
+    uint32_t sr = hdac->Instance->SR;
+
+    if (((cr & DAC_CR_DMAUDRIE1) != 0U) && ((sr & DAC_SR_DMAUDR1) != 0U))
+    {
+        __HAL_DAC_CLEAR_FLAG(hdac, DAC_SR_DMAUDR1);
+        CLEAR_BIT(hdac->Instance->CR, DAC_CR_DMAEN1);
+        hdac->ErrorCode |= HAL_DAC_ERROR_DMAUNDERRUNCH1;
+        hdac->State = HAL_DAC_STATE_ERROR;
+        HAL_DAC_DMAUnderrunCallbackCh1(hdac);
+    }
+
+    if (((cr & DAC_CR_DMAUDRIE2) != 0U) && ((sr & DAC_SR_DMAUDR2) != 0U))
+    {
+        __HAL_DAC_CLEAR_FLAG(hdac, DAC_SR_DMAUDR2);
+        CLEAR_BIT(hdac->Instance->CR, DAC_CR_DMAEN2);
+        hdac->ErrorCode |= HAL_DAC_ERROR_DMAUNDERRUNCH2;
+        hdac->State = HAL_DAC_STATE_ERROR;
+        HAL_DACEx_DMAUnderrunCallbackCh2(hdac);
+    }
+}
+
+__weak void HAL_DAC_ConvCpltCallbackCh1(DAC_HandleTypeDef *hdac)
+{
+    UNUSED(hdac);
+}
+
+__weak void HAL_DAC_ConvHalfCpltCallbackCh1(DAC_HandleTypeDef *hdac)
+{
+    UNUSED(hdac);
+}
+
+__weak void HAL_DAC_ErrorCallbackCh1(DAC_HandleTypeDef *hdac)
+{
+    UNUSED(hdac);
+}
+
+__weak void HAL_DAC_DMAUnderrunCallbackCh1(DAC_HandleTypeDef *hdac)
+{
+    UNUSED(hdac);
+}
+
+__weak void HAL_DACEx_ConvCpltCallbackCh2(DAC_HandleTypeDef *hdac)
+{
+    UNUSED(hdac);
+}
+
+__weak void HAL_DACEx_ConvHalfCpltCallbackCh2(DAC_HandleTypeDef *hdac)
+{
+    UNUSED(hdac);
+}
+
+__weak void HAL_DACEx_ErrorCallbackCh2(DAC_HandleTypeDef *hdac)
+{
+    UNUSED(hdac);
+}
+
+__weak void HAL_DACEx_DMAUnderrunCallbackCh2(DAC_HandleTypeDef *hdac)
+{
+    UNUSED(hdac);
+}
+
+HAL_DAC_StateTypeDef HAL_DAC_GetState(DAC_HandleTypeDef *hdac)
+{
+    return hdac->State;
+}
+
+uint32_t HAL_DAC_GetError(DAC_HandleTypeDef *hdac)
+{
+    return hdac->ErrorCode;
+}
+
+/*---------------------------------- Private functions ----------------------------------*/
+/* Common part of the single and dual DMA starts */
+static HAL_StatusTypeDef DAC_StartDMA(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t SrcAddress,
+                                      uint32_t DstAddress, uint32_t Length)
+{
+    DMA_HandleTypeDef *hdma;
+
+    hdma = (Channel == DAC_CHANNEL_1) ? hdac->DMA_Handle1 : hdac->DMA_Handle2;
+    if ((hdma == NULL) || (SrcAddress == 0U) || ((hdac->Instance->CR & (DAC_CR_TEN1 << Channel)) == 0U)) {
+        return HAL_ERROR;
+    }
+    if (Channel == DAC_CHANNEL_1) {
+        hdma->XferCpltCallback = DAC_DMAConvCpltCh1;
+        hdma->XferHalfCpltCallback = DAC_DMAHalfConvCpltCh1;
+        hdma->XferErrorCallback = DAC_DMAErrorCh1;
+    }
+    else {
+        hdma->XferCpltCallback = DAC_DMAConvCpltCh2;
+        hdma->XferHalfCpltCallback = DAC_DMAHalfConvCpltCh2;
+        hdma->XferErrorCallback = DAC_DMAErrorCh2;
+    }
+    hdma->Parent = hdac;
+
+    if (HAL_DMA_Start_IT(hdma, SrcAddress, DstAddress, Length) != HAL_OK) {
+        return HAL_BUSY;
+    }
+    hdac->State = HAL_DAC_STATE_BUSY;
+    hdac->ErrorCode = HAL_DAC_ERROR_NONE;
+
+    __HAL_DAC_CLEAR_FLAG(hdac, DAC_SR_DMAUDR1 << Channel);
+    SET_BIT(hdac->Instance->CR, (DAC_CR_DMAEN1 | DAC_CR_DMAUDRIE1 | DAC_CR_EN1) << Channel);
+    return HAL_OK;
+}
+
+/* Q15 sample of a waveform at Phase */
+static int32_t DAC_DDSWave(uint32_t Waveform, uint32_t Phase)
+{
+    uint32_t x, idx, frac;
+    int32_t a, s;
+
+    switch (Waveform)
+    {
+        case DAC_DDS_WAVE_TRIANGLE:
+            x = Phase >> 15U;
+            if (x >= 0x10000U) {
+                x = 0x1FFFFU - x;
+            }
+            return (int32_t)x - 32768;
+
+        case DAC_DDS_WAVE_SAWTOOTH:
+            return (int32_t)(Phase >> 16U) - 32768;
+
+        case DAC_DDS_WAVE_SQUARE:
+            return (Phase < 0x80000000U) ? 32767 : -32767;
+
+        default:
+            break;
+    }
+
+    /* Sine: 2 bits quadrant, 6 bits table step, 8 bits interpolation */
+    x = (Phase >> 16U) & 0x3FFFU;
+    if ((Phase & 0x40000000U) != 0U) {
+        x = 0x4000U - x;
+    }
+    idx = x >> 8U;
+    frac = x & 0xFFU;
+    a = DAC_SineQuarter[idx];
+    s = (idx < 64U) ? (a + (((DAC_SineQuarter[idx + 1U] - a) * (int32_t)frac) >> 8)) : a;
+
+    return ((Phase & 0x80000000U) != 0U) ? -s : s;
+}
+
+/* Next 12-bit sample of a DDS channel */
+static uint32_t DAC_DDSNext(DAC_DDSTypeDef *dds)
+{
+    int32_t v = (int32_t)dds->Offset + (((int32_t)dds->Amplitude * DAC_DDSWave(dds->Waveform, dds->Phase)) >> 15);
+
+    dds->Phase += dds->Increment;
+    if (v < 0) {
+        v = 0;
+    }
+    else if (v > 4095) {
+        v = 4095;
+    }
+    return (uint32_t)v;
+}
+
+static void DAC_DMAConvCpltCh1(DMA_HandleTypeDef *hdma)
+{
+    DAC_HandleTypeDef *hdac = (DAC_HandleTypeDef *)hdma->Parent;
+
+    /* One-shot buffer: that channel is done with DMA */
+    if (hdma->Init.Mode != DMA_CIRCULAR) {
+        DAC_DMAChannelDone(hdac, DAC_CHANNEL_1);
+    }
+    HAL_DAC_ConvCpltCallbackCh1(hdac);
+}
+
+static void DAC_DMAHalfConvCpltCh1(DMA_HandleTypeDef *hdma)
+{
+    HAL_DAC_ConvHalfCpltCallbackCh1((DAC_HandleTypeDef *)hdma->Parent);
+}
+
+static void DAC_DMAErrorCh1(DMA_HandleTypeDef *hdma)
+{
+    DAC_HandleTypeDef *hdac = (DAC_HandleTypeDef *)hdma->Parent;
+
+    hdac->ErrorCode |= HAL_DAC_ERROR_DMA;
+    hdac->State = HAL_DAC_STATE_ERROR;
+    HAL_DAC_ErrorCallbackCh1(hdac);
+}
+
+static void DAC_DMAConvCpltCh2(DMA_HandleTypeDef *hdma)
+{
+    DAC_HandleTypeDef *hdac = (DAC_HandleTypeDef *)hdma->Parent;
+
+    /* One-shot buffer: that channel is done with DMA */
+    if (hdma->Init.Mode != DMA_CIRCULAR) {
+        DAC_DMAChannelDone(hdac, DAC_CHANNEL_2);
+    }
+    HAL_DACEx_ConvCpltCallbackCh2(hdac);
+}
+
+static void DAC_DMAHalfConvCpltCh2(DMA_HandleTypeDef *hdma)
+{
+    HAL_DACEx_ConvHalfCpltCallbackCh2((DAC_HandleTypeDef *)hdma->Parent);
+}
+
+static void DAC_DMAErrorCh2(DMA_HandleTypeDef *hdma)
+{
+    DAC_HandleTypeDef *hdac = (DAC_HandleTypeDef *)hdma->Parent;
+
+    hdac->ErrorCode |= HAL_DAC_ERROR_DMA;
+    hdac->State = HAL_DAC_STATE_ERROR;
+    HAL_DACEx_ErrorCallbackCh2(hdac);
+}
+
+/**
+ * @brief   Release a channel's DMA request, the handle is READY once neither channel uses DMA
+ */
+static void DAC_DMAChannelDone(DAC_HandleTypeDef *hdac, uint32_t Channel)
+{
+    CLEAR_BIT(hdac->Instance->CR, (DAC_CR_DMAEN1 | DAC_CR_DMAUDRIE1) << Channel);
+    if ((hdac->Instance->CR & (DAC_CR_DMAEN1 | DAC_CR_DMAEN2)) == 0U) {
+        hdac->State = HAL_DAC_STATE_READY;
+    }
+}
\ No newline at end of file
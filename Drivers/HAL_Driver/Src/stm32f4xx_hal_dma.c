@@ -0,0 +1,337 @@
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief: Private macros
+ */
+#define DMA_DISABLE_TIMEOUT     10000U      /* loop iterations waiting for EN to read back 0 */
+
+static const uint8_t dma_flag_shift[4] = {0U, 6U, 16U, 22U};   /* Stream 0-3 in LISR, 4-7 at the same shifts in HISR */
+
+/**
+ * @brief: Private functions
+ */
+static void DMA_CalcBaseAndBitshift(DMA_HandleTypeDef *hdma);
+static void DMA_SetConfig(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+static HAL_StatusTypeDef DMA_DisableStream(DMA_HandleTypeDef *hdma);
+static uint32_t DMA_GetFlags(DMA_HandleTypeDef *hdma);
+static void DMA_ClearFlags(DMA_HandleTypeDef *hdma, uint32_t Flags);
+
+/**
+ * @brief   Initialize a DMA stream according to hdma->Init
+ * @note    The stream is disabled first (a running stream ignores configuration writes).
+ * @param   hdma - DMA handle, Instance = DMAx_Streamy
+ * @retval  HAL status
+ */
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+    uint32_t cr;
+
+    if (hdma == NULL) {
+        return HAL_ERROR;
+    }
+    assert_param(IS_DMA_STREAM_ALL_INSTANCE(hdma->Instance));
+
+    DMA_CalcBaseAndBitshift(hdma);
+
+    if (DMA_DisableStream(hdma) != HAL_OK) {
+        return HAL_TIMEOUT;
+    }
+
+    /* Build the whole CR in one go, then write it once */
+    cr = hdma->Init.Channel | hdma->Init.Direction | hdma->Init.PeriphInc | hdma->Init.MemInc |
+         hdma->Init.PeriphDataAlignment | hdma->Init.MemDataAlignment | hdma->Init.Mode | hdma->Init.Priority;
+    /* Bursts are only allowed with the FIFO */
+    if (hdma->Init.FIFOMode == DMA_FIFOMODE_ENABLE) {
+        cr |= hdma->Init.MemBurst | hdma->Init.PeriphBurst;
+    }
+    WRITE_REG(hdma->Instance->CR, cr);
+    WRITE_REG(hdma->Instance->FCR, hdma->Init.FIFOMode | hdma->Init.FIFOThreshold);
+
+    DMA_ClearFlags(hdma, DMA_FLAG_ALL);
+
+    hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+    hdma->State = HAL_DMA_STATE_READY;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma)
+{
+    if (hdma == NULL) {
+        return HAL_ERROR;
+    }
+    if (hdma->State == HAL_DMA_STATE_BUSY) {
+        return HAL_BUSY;
+    }
+    DMA_CalcBaseAndBitshift(hdma);
+    if (DMA_DisableStream(hdma) != HAL_OK) {
+        return HAL_TIMEOUT;
+    }
+
+    CLEAR_REG(hdma->Instance->CR);
+    CLEAR_REG(hdma->Instance->NDTR);
+    CLEAR_REG(hdma->Instance->PAR);
+    CLEAR_REG(hdma->Instance->M0AR);
+    CLEAR_REG(hdma->Instance->M1AR);
+    WRITE_REG(hdma->Instance->FCR, 0x00000021U);    /* reset value */
+    DMA_ClearFlags(hdma, DMA_FLAG_ALL);
+
+    hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+    hdma->State = HAL_DMA_STATE_RESET;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Start a transfer without interrupts (caller polls NDTR or uses the peripheral's own events)
+ * @param   SrcAddress - Source (peripheral register for P2M, memory for M2P/M2M)
+ * @param   DstAddress - Destination
+ * @param   DataLength - Number of data items (of the peripheral data size), 1..65535
+ */
+HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength)
+{
+    assert_param(IS_DMA_BUFFER_SIZE(DataLength));
+
+    if (hdma->State != HAL_DMA_STATE_READY) {
+        return HAL_BUSY;
+    }
+    hdma->State = HAL_DMA_STATE_BUSY;
+    hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+
+    DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
+    __HAL_DMA_ENABLE(hdma);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Start a transfer with transfer complete / half / error interrupts
+ * @note    Half transfer interrupt is only enabled when XferHalfCpltCallback is set.
+ */
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength)
+{
+    uint32_t it = DMA_IT_TC | DMA_IT_TE | DMA_IT_DME;
+
+    assert_param(IS_DMA_BUFFER_SIZE(DataLength));
+
+    if (hdma->State != HAL_DMA_STATE_READY) {
+        return HAL_BUSY;
+    }
+    hdma->State = HAL_DMA_STATE_BUSY;
+    hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+
+    DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
+
+    if (hdma->XferHalfCpltCallback != NULL) {
+        it |= DMA_IT_HT;
+    }
+    /* Interrupt enables and EN in the same write */
+    MODIFY_REG(hdma->Instance->CR, DMA_IT_TC | DMA_IT_HT | DMA_IT_TE | DMA_IT_DME, it | DMA_SxCR_EN);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Start a double buffer transfer (peripheral <-> memory only)
+ * @note    The stream alternates between DstAddress (memory 0) and SecondMemAddress (memory 1)
+ *          without stopping; XferCpltCallback reports memory 0 complete, XferM1CpltCallback
+ *          memory 1. The buffer that was just completed may be processed while the other one
+ *          is filled. Circular mode is implied by the hardware.
+ */
+HAL_StatusTypeDef HAL_DMAEx_MultiBufferStart_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                              uint32_t SecondMemAddress, uint32_t DataLength)
+{
+    uint32_t it = DMA_IT_TC | DMA_IT_TE | DMA_IT_DME;
+
+    assert_param(IS_DMA_BUFFER_SIZE(DataLength));
+
+    if ((hdma->Init.Direction == DMA_MEMORY_TO_MEMORY) || (hdma->XferM1CpltCallback == NULL)) {
+        hdma->ErrorCode = HAL_DMA_ERROR_PARAM;
+        return HAL_ERROR;
+    }
+    if (hdma->State != HAL_DMA_STATE_READY) {
+        return HAL_BUSY;
+    }
+    hdma->State = HAL_DMA_STATE_BUSY;
+    hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+
+    DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
+    hdma->Instance->M1AR = SecondMemAddress;
+
+    if (hdma->XferHalfCpltCallback != NULL) {
+        it |= DMA_IT_HT;
+    }
+    /* Start on memory 0 */
+    MODIFY_REG(hdma->Instance->CR, DMA_IT_TC | DMA_IT_HT | DMA_IT_TE | DMA_IT_DME | DMA_SxCR_CT,
+               it | DMA_SxCR_DBM | DMA_SxCR_EN);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Stop an ongoing transfer
+ */
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma)
+{
+    CLEAR_BIT(hdma->Instance->CR, DMA_IT_TC | DMA_IT_HT | DMA_IT_TE | DMA_IT_DME);
+    CLEAR_BIT(hdma->Instance->FCR, DMA_SxFCR_FEIE);
+
+    if (DMA_DisableStream(hdma) != HAL_OK) {
+        hdma->ErrorCode |= HAL_DMA_ERROR_TIMEOUT;
+        hdma->State = HAL_DMA_STATE_ERROR;
+        return HAL_TIMEOUT;
+    }
+    DMA_ClearFlags(hdma, DMA_FLAG_ALL);
+    hdma->State = HAL_DMA_STATE_READY;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Handle a DMA stream interrupt, to be called from DMAx_Streamy_IRQHandler
+ * @note    Flags are read once and cleared in one write.
+ *          Double buffer mode: CT already points to the buffer being filled, so the
+ *          completed one is the other one.
+ */
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+    uint32_t flags = DMA_GetFlags(hdma);
+    uint32_t cr = hdma->Instance->CR;
+
+    /* Only handle the events whose interrupt is enabled */
+    if ((cr & DMA_IT_TE) == 0U)  { flags &= ~DMA_FLAG_TEIF; }
+    if ((cr & DMA_IT_DME) == 0U) { flags &= ~DMA_FLAG_DMEIF; }
+    if ((cr & DMA_IT_HT) == 0U)  { flags &= ~DMA_FLAG_HTIF; }
+    if ((cr & DMA_IT_TC) == 0U)  { flags &= ~DMA_FLAG_TCIF; }
+    if ((hdma->Instance->FCR & DMA_SxFCR_FEIE) == 0U) { flags &= ~DMA_FLAG_FEIF; }
+
+    if (flags == 0U) {
+        return;
+    }
+    DMA_ClearFlags(hdma, flags);
+
+    if ((flags & DMA_FLAG_TEIF) != 0U) {
+        hdma->ErrorCode |= HAL_DMA_ERROR_TE;
+    }
+    if ((flags & DMA_FLAG_DMEIF) != 0U) {
+        hdma->ErrorCode |= HAL_DMA_ERROR_DME;
+    }
+    if ((flags & DMA_FLAG_FEIF) != 0U) {
+        hdma->ErrorCode |= HAL_DMA_ERROR_FE;
+    }
+
+    if ((flags & DMA_FLAG_HTIF) != 0U)
+    {
+        if (hdma->XferHalfCpltCallback != NULL) {
+            hdma->XferHalfCpltCallback(hdma);
+        }
+    }
+
+    if ((flags & DMA_FLAG_TCIF) != 0U)
+    {
+        if ((cr & DMA_SxCR_DBM) != 0U)
+        {
+            /* CT = 1 -> hardware switched to memory 1, memory 0 is complete */
+            if ((cr & DMA_SxCR_CT) != 0U) {
+                if (hdma->XferCpltCallback != NULL) {
+                    hdma->XferCpltCallback(hdma);
+                }
+            }
+            else if (hdma->XferM1CpltCallback != NULL) {
+                hdma->XferM1CpltCallback(hdma);
+            }
+        }
+        else
+        {
+            /* Normal mode: the stream disabled itself */
+            if ((cr & DMA_SxCR_CIRC) == 0U) {
+                CLEAR_BIT(hdma->Instance->CR, DMA_IT_TC | DMA_IT_HT | DMA_IT_TE | DMA_IT_DME);
+                hdma->State = HAL_DMA_STATE_READY;
+            }
+            if (hdma->XferCpltCallback != NULL) {
+                hdma->XferCpltCallback(hdma);
+            }
+        }
+    }
+
+    /* Transfer error disables the stream in hardware, direct mode/FIFO errors are only reported */
+    if ((hdma->ErrorCode & HAL_DMA_ERROR_TE) != 0U)
+    {
+        (void)HAL_DMA_Abort(hdma);
+        hdma->State = HAL_DMA_STATE_ERROR;
+        if (hdma->XferErrorCallback != NULL) {
+            hdma->XferErrorCallback(hdma);
+        }
+    }
+}
+
+HAL_DMA_StateTypeDef HAL_DMA_GetState(DMA_HandleTypeDef *hdma)
+{
+    return hdma->State;
+}
+
+uint32_t HAL_DMA_GetError(DMA_HandleTypeDef *hdma)
+{
+    return hdma->ErrorCode;
+}
+
+/*---------------------------------- Private functions ----------------------------------*/
+/**
+ * @brief   Find DMA1/DMA2 and the flag position of the stream
+ * @note    Stream registers start at DMAx + 0x10 and are 0x18 bytes apart.
+ */
+static void DMA_CalcBaseAndBitshift(DMA_HandleTypeDef *hdma)
+{
+    uint32_t stream_number = (((uint32_t)hdma->Instance & 0xFFU) - 0x10U) / 0x18U;
+
+    hdma->StreamBaseAddress = (DMA_TypeDef *)((uint32_t)hdma->Instance & ~0x3FFUL);
+    hdma->StreamIndex = dma_flag_shift[stream_number & 0x03U] | ((stream_number & 0x04U) << 6U);   /* bit 8 = use HISR/HIFCR */
+}
+
+static uint32_t DMA_GetFlags(DMA_HandleTypeDef *hdma)
+{
+    uint32_t isr = ((hdma->StreamIndex & 0x100U) != 0U) ? hdma->StreamBaseAddress->HISR : hdma->StreamBaseAddress->LISR;
+
+    return (isr >> (hdma->StreamIndex & 0xFFU)) & DMA_FLAG_ALL;
+}
+
+static void DMA_ClearFlags(DMA_HandleTypeDef *hdma, uint32_t Flags)
+{
+    if ((hdma->StreamIndex & 0x100U) != 0U) {
+        WRITE_REG(hdma->StreamBaseAddress->HIFCR, Flags << (hdma->StreamIndex & 0xFFU));
+    }
+    else {
+        WRITE_REG(hdma->StreamBaseAddress->LIFCR, Flags << (hdma->StreamIndex & 0xFFU));
+    }
+}
+
+static HAL_StatusTypeDef DMA_DisableStream(DMA_HandleTypeDef *hdma)
+{
+    uint32_t timeout = DMA_DISABLE_TIMEOUT;
+
+    __HAL_DMA_DISABLE(hdma);
+    /* EN stays 1 until the current data item is finished */
+    while ((hdma->Instance->CR & DMA_SxCR_EN) != 0U) {
+        if (--timeout == 0U) {
+            return HAL_TIMEOUT;
+        }
+    }
+    return HAL_OK;
+}
+
+static void DMA_SetConfig(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength)
+{
+    CLEAR_BIT(hdma->Instance->CR, DMA_SxCR_DBM);
+    DMA_ClearFlags(hdma, DMA_FLAG_ALL);
+
+    hdma->Instance->NDTR = DataLength;
+
+    if (hdma->Init.Direction == DMA_MEMORY_TO_PERIPH) {
+        hdma->Instance->PAR  = DstAddress;
+        hdma->Instance->M0AR = SrcAddress;
+    }
+    else {
+        hdma->Instance->PAR  = SrcAddress;
+        hdma->Instance->M0AR = DstAddress;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,699 @@
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief: Private macros
+ */
+#define ETH_REG_TIMEOUT         100000U     /* Polls for a self-clearing bit (DMA reset, FIFO flush, MDIO) */
+#define ETH_REG_WRITE_DELAY     200U        /* Loops, > 4 MII clocks at 10 Mbit (errata: successive writes) */
+#define ETH_HOST_HCLK           168000000U  /* ETH_HOST builds have no RCC to ask */
+
+#define ETH_DMABMR_CONFIG       (ETH_DMABMR_AAB | ETH_DMABMR_FB | ETH_DMABMR_USP | \
+                                 (32UL << ETH_DMABMR_PBL_Pos) | (32UL << ETH_DMABMR_RDP_Pos))
+#define ETH_DMAIER_CONFIG       (ETH_DMAIER_NISE | ETH_DMAIER_RIE | ETH_DMAIER_TIE | \
+                                 ETH_DMAIER_AISE | ETH_DMAIER_RBUIE | ETH_DMAIER_FBEIE)
+#define ETH_DMASR_HANDLED       (ETH_DMASR_RS | ETH_DMASR_TS | ETH_DMASR_RBUS | ETH_DMASR_FBES)
+#define ETH_DESC_SKIP           ((sizeof(ETH_DMADescTypeDef) / 4U) - 4U)   /* Driver words after DES3 */
+#define ETH_RSWTC_UNIT          256U        /* HCLK cycles per receive watchdog count */
+#define ETH_FCS_SIZE            4U
+
+/* Frame errors that drop an RX frame. IPHCE means a giant frame without offload, it is
+   then added; with offload it flags non-IP frames (frames with bad checksums never arrive) */
+#define ETH_RX_DROP_ERRORS      (ETH_DMARXDESC_DE | ETH_DMARXDESC_OE | ETH_DMARXDESC_LC | \
+                                 ETH_DMARXDESC_RWT | ETH_DMARXDESC_RE | ETH_DMARXDESC_CE)
+
+#define ETH_NEXT(INDEX, COUNT)  ((((INDEX) + 1U) == (COUNT)) ? 0U : ((INDEX) + 1U))
+
+/* Bus address of a buffer or descriptor; truncated in ETH_HOST builds, where the ring
+   model uses the Buf pointers instead */
+#define ETH_ADDR(PTR)           ((uint32_t)(uintptr_t)(PTR))
+
+/* Descriptor writes must be complete before OWN changes hands. DMASR flags are write 1
+   to clear, which RAM standing in for the registers (ETH_HOST) does not do by itself */
+#ifdef ETH_HOST
+#define ETH_BARRIER()           __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define ETH_CLEAR_FLAGS(INSTANCE, FLAGS)    CLEAR_BIT((INSTANCE)->DMASR, (FLAGS))
+#else
+#define ETH_BARRIER()           __DMB()
+#define ETH_CLEAR_FLAGS(INSTANCE, FLAGS)    WRITE_REG((INSTANCE)->DMASR, (FLAGS))
+#endif
+
+/**
+ * @brief: Private functions
+ */
+static HAL_StatusTypeDef ETH_WaitBitClear(__IO uint32_t *Reg, uint32_t Bit);
+static void ETH_WriteReg(__IO uint32_t *Reg, uint32_t Value);
+static uint32_t ETH_MdcClockRange(uint32_t Hclk);
+static uint32_t ETH_RxWatchdog(uint32_t Hclk, uint32_t Usecs);
+static void ETH_RingsInit(ETH_HandleTypeDef *heth);
+static void ETH_RxArm(ETH_HandleTypeDef *heth, void *Buffer);
+static uint32_t ETH_RxChecksum(ETH_HandleTypeDef *heth, uint32_t Status);
+
+/*------------------------------------------- Init -------------------------------------------*/
+/**
+ * @brief   Reset and configure the MAC and DMA, fill the RX ring, MAC and DMA stay stopped
+ * @note    Link defaults to 100 Mbit full duplex until HAL_ETH_SetLink(). All MAC and MMC
+ *          interrupts are masked, only the DMA ones are used.
+ * @param   heth - ETH handle, Instance = ETH, Init filled, rings in SRAM
+ * @retval  HAL_OK, HAL_ERROR with ErrorCode set
+ */
+HAL_StatusTypeDef HAL_ETH_Init(ETH_HandleTypeDef *heth)
+{
+    ETH_InitTypeDef *init;
+    uint32_t hclk;
+
+    if (heth == NULL) {
+        return HAL_ERROR;
+    }
+    init = &heth->Init;
+    assert_param(IS_ETH_MEDIA_INTERFACE(init->MediaInterface));
+
+    heth->ErrorCode = HAL_ETH_ERROR_NONE;
+    if ((init->RxDesc == NULL) || (init->TxDesc == NULL) || (init->RxDescCount < 2U) || (init->TxDescCount < 2U) ||
+        (init->RxBufferSize < ETH_MAX_FRAME_SIZE) || (init->RxBufferSize > ETH_DMARXDESC_RBS1) ||
+        ((init->RxBufferSize & 3U) != 0U) || (init->RxCoalesceFrames == 0U) || (init->TxCoalesceFrames == 0U) ||
+        ((init->RxCoalesceFrames > 1U) && (init->RxCoalesceUsecs == 0U))) {
+        heth->ErrorCode = HAL_ETH_ERROR_PARAM;
+        return HAL_ERROR;
+    }
+
+#ifndef ETH_HOST
+    assert_param(IS_ETH_ALL_INSTANCE(heth->Instance));
+
+    /* MII/RMII is latched when the MAC leaves reset, and must be selected before its clocks run */
+    __HAL_RCC_SYSCFG_CLK_ENABLE();
+    __HAL_RCC_ETHMAC_FORCE_RESET();
+    MODIFY_REG(SYSCFG->PMC, SYSCFG_PMC_MII_RMII_SEL, init->MediaInterface);
+    __HAL_RCC_ETHMAC_CLK_ENABLE();
+    __HAL_RCC_ETHMAC_RELEASE_RESET();
+    hclk = HAL_RCC_GetHCLKFreq();
+#else
+    hclk = ETH_HOST_HCLK;
+#endif
+
+    /* Completes only with the PHY clocks running */
+    SET_BIT(heth->Instance->DMABMR, ETH_DMABMR_SR);
+    if (ETH_WaitBitClear(&heth->Instance->DMABMR, ETH_DMABMR_SR) != HAL_OK) {
+        heth->ErrorCode = HAL_ETH_ERROR_TIMEOUT;
+        heth->State = HAL_ETH_STATE_ERROR;
+        return HAL_ERROR;
+    }
+
+    /* MDC <= 2.5 MHz */
+    WRITE_REG(heth->Instance->MACMIIAR, ETH_MdcClockRange(hclk) << ETH_MACMIIAR_CR_Pos);
+
+    ETH_WriteReg(&heth->Instance->MACCR, ETH_MACCR_FES | ETH_MACCR_DM |
+                 ((init->ChecksumOffload == ENABLE) ? ETH_MACCR_IPCO : 0U));
+    /* Own address (perfect filter) and broadcasts */
+    ETH_WriteReg(&heth->Instance->MACFFR, 0U);
+    WRITE_REG(heth->Instance->MACA0HR, ((uint32_t)init->MACAddr[5] << 8) | init->MACAddr[4]);
+    WRITE_REG(heth->Instance->MACA0LR, ((uint32_t)init->MACAddr[3] << 24) | ((uint32_t)init->MACAddr[2] << 16) |
+                                       ((uint32_t)init->MACAddr[1] << 8) | init->MACAddr[0]);
+
+    /* The MMC counter interrupts are on after reset and would hold the ETH interrupt */
+    WRITE_REG(heth->Instance->MACIMR, ETH_MACIMR_TSTIM | ETH_MACIMR_PMTIM);
+    WRITE_REG(heth->Instance->MMCRIMR, ETH_MMCRIMR_RGUFM | ETH_MMCRIMR_RFAEM | ETH_MMCRIMR_RFCEM);
+    WRITE_REG(heth->Instance->MMCTIMR, ETH_MMCTIMR_TGFM | ETH_MMCTIMR_TGFMSCM | ETH_MMCTIMR_TGFSCM);
+
+    /* Store and forward both ways: needed by checksum insertion, and a frame never
+       underflows at 100 Mbit. OSF: the next TX frame is fetched while one is on the wire */
+    ETH_WriteReg(&heth->Instance->DMAOMR, ETH_DMAOMR_RSF | ETH_DMAOMR_TSF | ETH_DMAOMR_OSF);
+    WRITE_REG(heth->Instance->DMABMR, ETH_DMABMR_CONFIG | (ETH_DESC_SKIP << ETH_DMABMR_DSL_Pos));
+
+    heth->State = HAL_ETH_STATE_READY;
+    ETH_RingsInit(heth);
+    if (HAL_ETH_RxRefill(heth) == 0U) {
+        heth->ErrorCode = HAL_ETH_ERROR_ALLOC;
+        heth->State = HAL_ETH_STATE_ERROR;
+        return HAL_ERROR;
+    }
+    WRITE_REG(heth->Instance->DMARDLAR, ETH_ADDR(init->RxDesc));
+    WRITE_REG(heth->Instance->DMATDLAR, ETH_ADDR(init->TxDesc));
+
+    WRITE_REG(heth->Instance->DMARSWTR, ETH_RxWatchdog(hclk, init->RxCoalesceUsecs));
+    ETH_CLEAR_FLAGS(heth->Instance, ETH_DMASR_STATIC);
+    WRITE_REG(heth->Instance->DMAIER, ETH_DMAIER_CONFIG);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Stop and reset the MAC
+ * @note    TX frames still queued are not sent and their tokens are not returned; RX buffers
+ *          stay in Init.RxDesc[].Buf.
+ */
+HAL_StatusTypeDef HAL_ETH_DeInit(ETH_HandleTypeDef *heth)
+{
+    if (heth == NULL) {
+        return HAL_ERROR;
+    }
+    if (heth->State == HAL_ETH_STATE_STARTED) {
+        (void)HAL_ETH_Stop(heth);
+    }
+    CLEAR_REG(heth->Instance->DMAIER);
+#ifndef ETH_HOST
+    __HAL_RCC_ETHMAC_FORCE_RESET();
+    __HAL_RCC_ETHMAC_RELEASE_RESET();
+    __HAL_RCC_ETHMAC_CLK_DISABLE();
+#endif
+    heth->State = HAL_ETH_STATE_RESET;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Start transmission and reception
+ * @note    The DMA carries on where it stopped in both rings, frames still queued from
+ *          before HAL_ETH_Stop() are sent.
+ */
+HAL_StatusTypeDef HAL_ETH_Start(ETH_HandleTypeDef *heth)
+{
+    if (heth->State != HAL_ETH_STATE_READY) {
+        return HAL_ERROR;
+    }
+    ETH_WriteReg(&heth->Instance->MACCR, heth->Instance->MACCR | ETH_MACCR_TE);
+    SET_BIT(heth->Instance->DMAOMR, ETH_DMAOMR_FTF);
+    if (ETH_WaitBitClear(&heth->Instance->DMAOMR, ETH_DMAOMR_FTF) != HAL_OK) {
+        heth->ErrorCode |= HAL_ETH_ERROR_TIMEOUT;
+        return HAL_ERROR;
+    }
+    ETH_WriteReg(&heth->Instance->MACCR, heth->Instance->MACCR | ETH_MACCR_RE);
+    ETH_WriteReg(&heth->Instance->DMAOMR, heth->Instance->DMAOMR | ETH_DMAOMR_ST | ETH_DMAOMR_SR);
+    heth->State = HAL_ETH_STATE_STARTED;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Stop transmission and reception (e.g. link down or speed change)
+ * @note    A frame on the wire is cut off; the descriptors keep their ownership, nothing is
+ *          lost from the rings.
+ */
+HAL_StatusTypeDef HAL_ETH_Stop(ETH_HandleTypeDef *heth)
+{
+    HAL_StatusTypeDef status;
+
+    if (heth->State != HAL_ETH_STATE_STARTED) {
+        return HAL_ERROR;
+    }
+    ETH_WriteReg(&heth->Instance->DMAOMR, heth->Instance->DMAOMR & ~ETH_DMAOMR_ST);
+    ETH_WriteReg(&heth->Instance->MACCR, heth->Instance->MACCR & ~ETH_MACCR_RE);
+    SET_BIT(heth->Instance->DMAOMR, ETH_DMAOMR_FTF);
+    status = ETH_WaitBitClear(&heth->Instance->DMAOMR, ETH_DMAOMR_FTF);
+    if (status != HAL_OK) {
+        heth->ErrorCode |= HAL_ETH_ERROR_TIMEOUT;
+    }
+    ETH_WriteReg(&heth->Instance->MACCR, heth->Instance->MACCR & ~ETH_MACCR_TE);
+    ETH_WriteReg(&heth->Instance->DMAOMR, heth->Instance->DMAOMR & ~ETH_DMAOMR_SR);
+    heth->State = HAL_ETH_STATE_READY;
+
+    return status;
+}
+
+/**
+ * @brief   Set the speed and duplex the PHY negotiated
+ * @note    Change it with the MAC stopped (HAL_ETH_Stop() / HAL_ETH_Start()).
+ * @param   Speed - ETH_SPEED_10M / ETH_SPEED_100M
+ * @param   Duplex - ETH_DUPLEX_HALF / ETH_DUPLEX_FULL
+ */
+void HAL_ETH_SetLink(ETH_HandleTypeDef *heth, uint32_t Speed, uint32_t Duplex)
+{
+    assert_param(IS_ETH_SPEED(Speed));
+    assert_param(IS_ETH_DUPLEX(Duplex));
+
+    ETH_WriteReg(&heth->Instance->MACCR,
+                 (heth->Instance->MACCR & ~(ETH_MACCR_FES | ETH_MACCR_DM)) | Speed | Duplex);
+}
+
+/*------------------------------------------- Frames -------------------------------------------*/
+/**
+ * @brief   Take the next received frame, its buffer is handed over as it is
+ * @note    The descriptor gets a new buffer from HAL_ETH_RxAllocateCallback() straight away;
+ *          if there is none it stays empty (the ring shrinks) until a later call or
+ *          HAL_ETH_RxRefill() finds one. Frames with errors are dropped here and their
+ *          buffer goes back to the DMA.
+ * @param   Frame - Filled on HAL_OK
+ * @retval  HAL_OK, HAL_BUSY if no frame is waiting
+ */
+HAL_StatusTypeDef HAL_ETH_ReadFrame(ETH_HandleTypeDef *heth, ETH_RxFrameTypeDef *Frame)
+{
+    ETH_DMADescTypeDef *desc;
+    uint32_t status;
+    uint32_t errors;
+    void *buffer;
+
+    while (heth->RxEmpty < heth->Init.RxDescCount)
+    {
+        desc = &heth->Init.RxDesc[heth->RxHead];
+        status = desc->Status;
+        if ((status & ETH_DMARXDESC_OWN) != 0U) {
+            break;
+        }
+        ETH_BARRIER();
+        buffer = desc->Buf;
+        desc->Buf = NULL;
+        heth->RxHead = ETH_NEXT(heth->RxHead, heth->Init.RxDescCount);
+        heth->RxEmpty++;
+
+        errors = status & ETH_RX_DROP_ERRORS;
+        if (heth->Init.ChecksumOffload != ENABLE) {
+            errors |= status & ETH_DMARXDESC_IPHCE;
+        }
+        /* A frame spanning descriptors is too long for the buffers: every part is dropped */
+        if ((errors != 0U) || ((status & (ETH_DMARXDESC_FS | ETH_DMARXDESC_LS)) != (ETH_DMARXDESC_FS | ETH_DMARXDESC_LS)) ||
+            (((status & ETH_DMARXDESC_FL) >> ETH_DMARXDESC_FL_Pos) <= ETH_FCS_SIZE)) {
+            heth->Stats.RxErrors++;
+            ETH_RxArm(heth, buffer);
+            continue;
+        }
+
+        Frame->Buffer = buffer;
+        Frame->Length = ((status & ETH_DMARXDESC_FL) >> ETH_DMARXDESC_FL_Pos) - ETH_FCS_SIZE;
+        Frame->Checksum = ETH_RxChecksum(heth, status);
+        heth->Stats.RxFrames++;
+        (void)HAL_ETH_RxRefill(heth);
+        return HAL_OK;
+    }
+    (void)HAL_ETH_RxRefill(heth);
+
+    return HAL_BUSY;
+}
+
+/**
+ * @brief   Give buffers to the RX descriptors that have none and resume the DMA
+ * @retval  Number of buffers added
+ */
+uint32_t HAL_ETH_RxRefill(ETH_HandleTypeDef *heth)
+{
+    uint32_t added = 0U;
+    void *buffer;
+
+    while (heth->RxEmpty != 0U)
+    {
+        buffer = HAL_ETH_RxAllocateCallback(heth);
+        if (buffer == NULL) {
+            heth->Stats.RxAllocFailed++;
+            break;
+        }
+        assert_param(((uintptr_t)buffer & 3U) == 0U);
+        ETH_RxArm(heth, buffer);
+        added++;
+    }
+    /* The DMA suspends on a descriptor it does not own (RBUS) and only looks again on a poll demand */
+    if (added != 0U) {
+        ETH_BARRIER();
+        WRITE_REG(heth->Instance->DMARPDR, 0U);
+    }
+    return added;
+}
+
+/**
+ * @brief   Queue a frame, one descriptor per fragment, the data is not copied
+ * @note    The fragments must stay untouched until HAL_ETH_TxFreeCallback() returns
+ *          Frame->Token. When the ring is short of descriptors, completed frames are
+ *          reclaimed first.
+ * @param   Frame - Fragments make one Ethernet frame without FCS (the MAC pads and appends it)
+ * @retval  HAL_OK, HAL_BUSY if the ring is full, HAL_ERROR if stopped or Frame is invalid
+ */
+HAL_StatusTypeDef HAL_ETH_Transmit(ETH_HandleTypeDef *heth, const ETH_TxFrameTypeDef *Frame)
+{
+    ETH_DMADescTypeDef *first;
+    ETH_DMADescTypeDef *desc;
+    uint32_t count = heth->Init.TxDescCount;
+    uint32_t index = heth->TxHead;
+    uint32_t last = Frame->FragmentCount - 1U;
+    uint32_t status;
+    uint32_t i;
+
+    assert_param(IS_ETH_TX_CSUM(Frame->Checksum));
+
+    if ((heth->State != HAL_ETH_STATE_STARTED) || (Frame->FragmentCount == 0U) || (Frame->FragmentCount > count)) {
+        return HAL_ERROR;
+    }
+    for (i = 0U; i <= last; i++)
+    {
+        if ((Frame->Fragments[i].Length == 0U) || (Frame->Fragments[i].Length > ETH_TX_FRAGMENT_MAX)) {
+            return HAL_ERROR;
+        }
+    }
+    if ((count - heth->TxUsed) < Frame->FragmentCount)
+    {
+        (void)HAL_ETH_ReleaseTxBuffers(heth);
+        if ((count - heth->TxUsed) < Frame->FragmentCount) {
+            heth->Stats.TxRingFull++;
+            return HAL_BUSY;
+        }
+    }
+
+    /* Completion interrupt on every TxCoalesceFrames-th frame only */
+    heth->TxQueued++;
+    first = &heth->Init.TxDesc[index];
+    for (i = 0U; i <= last; i++)
+    {
+        desc = &heth->Init.TxDesc[index];
+        /* Checksum control is read from the first segment, the rest from the last */
+        status = (i == 0U) ? (ETH_DMATXDESC_FS | Frame->Checksum) : ETH_DMATXDESC_OWN;
+        if (i == last)
+        {
+            status |= ETH_DMATXDESC_LS;
+            if (heth->TxQueued >= heth->Init.TxCoalesceFrames) {
+                status |= ETH_DMATXDESC_IC;
+                heth->TxQueued = 0U;
+            }
+        }
+        if (index == (count - 1U)) {
+            status |= ETH_DMATXDESC_TER;
+        }
+        desc->Buf = (void *)Frame->Fragments[i].Data;
+        desc->Token = (i == last) ? Frame->Token : NULL;
+        desc->Buffer1 = ETH_ADDR(Frame->Fragments[i].Data);
+        desc->Control = Frame->Fragments[i].Length;
+        desc->Status = status;
+        index = ETH_NEXT(index, count);
+    }
+    heth->TxHead = index;
+    heth->TxUsed += Frame->FragmentCount;
+
+    /* The first descriptor goes last: the DMA sees the whole frame or none of it */
+    ETH_BARRIER();
+    first->Status |= ETH_DMATXDESC_OWN;
+    ETH_BARRIER();
+    WRITE_REG(heth->Instance->DMATPDR, 0U);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Reclaim the descriptors the DMA is done with
+ * @note    HAL_ETH_TxFreeCallback() is called with the Token of each frame sent.
+ * @retval  Number of frames completed
+ */
+uint32_t HAL_ETH_ReleaseTxBuffers(ETH_HandleTypeDef *heth)
+{
+    ETH_DMADescTypeDef *desc;
+    uint32_t status;
+    uint32_t frames = 0U;
+
+    while (heth->TxUsed != 0U)
+    {
+        desc = &heth->Init.TxDesc[heth->TxClean];
+        status = desc->Status;
+        if ((status & ETH_DMATXDESC_OWN) != 0U) {
+            break;
+        }
+        ETH_BARRIER();
+        /* Status is written back to the last descriptor of the frame */
+        if ((status & ETH_DMATXDESC_LS) != 0U)
+        {
+            if ((status & ETH_DMATXDESC_ES) != 0U) {
+                heth->Stats.TxErrors++;
+            }
+            else {
+                heth->Stats.TxFrames++;
+            }
+            frames++;
+            HAL_ETH_TxFreeCallback(heth, desc->Token);
+        }
+        desc->Buf = NULL;
+        desc->Token = NULL;
+        heth->TxClean = ETH_NEXT(heth->TxClean, heth->Init.TxDescCount);
+        heth->TxUsed--;
+    }
+    return frames;
+}
+
+/*------------------------------------------- PHY access -------------------------------------------*/
+/**
+ * @brief   Read a PHY register over MDIO (~30 us at 2.5 MHz)
+ * @param   PhyAddr - 0 ~ 31
+ * @param   Reg - 0 ~ 31
+ */
+HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint32_t PhyAddr, uint32_t Reg, uint32_t *Value)
+{
+    uint32_t miiar;
+
+    if (READ_BIT(heth->Instance->MACMIIAR, ETH_MACMIIAR_MB) != 0U) {
+        return HAL_BUSY;
+    }
+    miiar = READ_BIT(heth->Instance->MACMIIAR, ETH_MACMIIAR_CR);
+    miiar |= ((PhyAddr << ETH_MACMIIAR_PA_Pos) & ETH_MACMIIAR_PA) | ((Reg << ETH_MACMIIAR_MR_Pos) & ETH_MACMIIAR_MR);
+    WRITE_REG(heth->Instance->MACMIIAR, miiar | ETH_MACMIIAR_MB);
+    if (ETH_WaitBitClear(&heth->Instance->MACMIIAR, ETH_MACMIIAR_MB) != HAL_OK) {
+        heth->ErrorCode |= HAL_ETH_ERROR_TIMEOUT;
+        return HAL_ERROR;
+    }
+    *Value = READ_REG(heth->Instance->MACMIIDR) & ETH_MACMIIDR_MD;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Write a PHY register over MDIO
+ */
+HAL_StatusTypeDef HAL_ETH_WritePHYRegister(ETH_HandleTypeDef *heth, uint32_t PhyAddr, uint32_t Reg, uint32_t Value)
+{
+    uint32_t miiar;
+
+    if (READ_BIT(heth->Instance->MACMIIAR, ETH_MACMIIAR_MB) != 0U) {
+        return HAL_BUSY;
+    }
+    miiar = READ_BIT(heth->Instance->MACMIIAR, ETH_MACMIIAR_CR);
+    miiar |= ((PhyAddr << ETH_MACMIIAR_PA_Pos) & ETH_MACMIIAR_PA) | ((Reg << ETH_MACMIIAR_MR_Pos) & ETH_MACMIIAR_MR);
+    WRITE_REG(heth->Instance->MACMIIDR, Value & ETH_MACMIIDR_MD);
+    WRITE_REG(heth->Instance->MACMIIAR, miiar | ETH_MACMIIAR_MW | ETH_MACMIIAR_MB);
+    if (ETH_WaitBitClear(&heth->Instance->MACMIIAR, ETH_MACMIIAR_MB) != HAL_OK) {
+        heth->ErrorCode |= HAL_ETH_ERROR_TIMEOUT;
+        return HAL_ERROR;
+    }
+
+    return HAL_OK;
+}
+
+/*------------------------------------------- IRQ -------------------------------------------*/
+/**
+ * @brief   Handle the ETH interrupt, to be called from ETH_IRQHandler
+ * @note    Only signals: RS (frames received, or the receive watchdog expired) and RBUS
+ *          (RX ring empty) call HAL_ETH_RxCpltCallback(), TS HAL_ETH_TxCpltCallback(). The
+ *          network thread then reads, refills and reclaims. A fatal bus error stops the DMA.
+ */
+void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth)
+{
+    uint32_t status;
+
+    heth->Stats.Interrupts++;
+    for (;;)
+    {
+        status = READ_REG(heth->Instance->DMASR) & ETH_DMASR_HANDLED;
+        if (status == 0U) {
+            break;
+        }
+        if ((status & ETH_DMASR_FBES) != 0U)
+        {
+            CLEAR_REG(heth->Instance->DMAIER);
+            ETH_CLEAR_FLAGS(heth->Instance, ETH_DMASR_STATIC);
+            heth->ErrorCode |= HAL_ETH_ERROR_DMA;
+            heth->State = HAL_ETH_STATE_ERROR;
+            HAL_ETH_ErrorCallback(heth);
+            return;
+        }
+        /* Summary bits go with the flags; a flag raised meanwhile is seen on the next pass */
+        ETH_CLEAR_FLAGS(heth->Instance, status | ETH_DMASR_NIS | ETH_DMASR_AIS);
+
+        if ((status & ETH_DMASR_RBUS) != 0U) {
+            heth->Stats.RxNoBuffer++;
+        }
+        if ((status & (ETH_DMASR_RS | ETH_DMASR_RBUS)) != 0U) {
+            HAL_ETH_RxCpltCallback(heth);
+        }
+        if ((status & ETH_DMASR_TS) != 0U) {
+            HAL_ETH_TxCpltCallback(heth);
+        }
+    }
+}
+
+/**
+ * @brief   Supply an RX buffer of Init.RxBufferSize bytes, word aligned
+ * @retval  The buffer, NULL if none is free (the descriptor is retried later)
+ */
+__weak void *HAL_ETH_RxAllocateCallback(ETH_HandleTypeDef *heth)
+{
+    UNUSED(heth);
+    return NULL;
+}
+
+/**
+ * @brief   A transmitted frame's buffers are free again
+ */
+__weak void HAL_ETH_TxFreeCallback(ETH_HandleTypeDef *heth, void *Token)
+{
+    UNUSED(heth);
+    UNUSED(Token);
+}
+
+__weak void HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *heth)
+{
+    UNUSED(heth);
+}
+
+__weak void HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth)
+{
+    UNUSED(heth);
+}
+
+__weak void HAL_ETH_ErrorCallback(ETH_HandleTypeDef *heth)
+{
+    UNUSED(heth);
+}
+
+HAL_ETH_StateTypeDef HAL_ETH_GetState(ETH_HandleTypeDef *heth)
+{
+    return heth->State;
+}
+
+uint32_t HAL_ETH_GetError(ETH_HandleTypeDef *heth)
+{
+    return heth->ErrorCode;
+}
+
+/*------------------------------------------- Private functions -------------------------------------------*/
+static HAL_StatusTypeDef ETH_WaitBitClear(__IO uint32_t *Reg, uint32_t Bit)
+{
+    uint32_t timeout = ETH_REG_TIMEOUT;
+
+#ifdef ETH_HOST
+    /* No hardware behind the registers to clear it */
+    CLEAR_BIT(*Reg, Bit);
+#endif
+    while ((READ_BIT(*Reg, Bit) != 0U) && (--timeout != 0U)) {
+    }
+    if (timeout == 0U) {
+        return HAL_ERROR;
+    }
+    return HAL_OK;
+}
+
+/* Errata: a second write to a MAC/DMA register within 4 MII clocks may be lost, so each
+   write is repeated after that delay */
+static void ETH_WriteReg(__IO uint32_t *Reg, uint32_t Value)
+{
+    __IO uint32_t count = ETH_REG_WRITE_DELAY;
+
+    WRITE_REG(*Reg, Value);
+    while (count != 0U) {
+        count--;
+    }
+    WRITE_REG(*Reg, Value);
+}
+
+static uint32_t ETH_MdcClockRange(uint32_t Hclk)
+{
+    if (Hclk < 35000000U) {
+        return 2U;      /* HCLK / 16 */
+    }
+    if (Hclk < 60000000U) {
+        return 3U;      /* HCLK / 26 */
+    }
+    if (Hclk < 100000000U) {
+        return 0U;      /* HCLK / 42 */
+    }
+    if (Hclk < 150000000U) {
+        return 1U;      /* HCLK / 62 */
+    }
+    return 4U;          /* HCLK / 102 */
+}
+
+/* RSWTC, 256 HCLK cycles a count, rounded up (1 ~ 255) */
+static uint32_t ETH_RxWatchdog(uint32_t Hclk, uint32_t Usecs)
+{
+    uint64_t count;
+
+    if (Usecs == 0U) {
+        return 0U;
+    }
+    count = (((uint64_t)Hclk * Usecs) / 1000000U + (ETH_RSWTC_UNIT - 1U)) / ETH_RSWTC_UNIT;
+    if (count > ETH_DMARSWTR_RSWTC) {
+        count = ETH_DMARSWTR_RSWTC;
+    }
+    return (count == 0U) ? 1U : (uint32_t)count;
+}
+
+/* Both rings empty and owned by the CPU, end of ring marks in place */
+static void ETH_RingsInit(ETH_HandleTypeDef *heth)
+{
+    ETH_DMADescTypeDef *desc;
+    uint32_t i;
+
+    for (i = 0U; i < heth->Init.RxDescCount; i++)
+    {
+        desc = &heth->Init.RxDesc[i];
+        desc->Status = 0U;
+        desc->Control = (i == (heth->Init.RxDescCount - 1U)) ? ETH_DMARXDESC_RER : 0U;
+        desc->Buffer1 = 0U;
+        desc->Buffer2 = 0U;
+        desc->Buf = NULL;
+        desc->Token = NULL;
+    }
+    for (i = 0U; i < heth->Init.TxDescCount; i++)
+    {
+        desc = &heth->Init.TxDesc[i];
+        desc->Status = (i == (heth->Init.TxDescCount - 1U)) ? ETH_DMATXDESC_TER : 0U;
+        desc->Control = 0U;
+        desc->Buffer1 = 0U;
+        desc->Buffer2 = 0U;
+        desc->Buf = NULL;
+        desc->Token = NULL;
+    }
+    heth->RxHead = 0U;
+    heth->RxFill = 0U;
+    heth->RxEmpty = heth->Init.RxDescCount;
+    heth->RxArmed = 0U;
+    heth->TxHead = 0U;
+    heth->TxClean = 0U;
+    heth->TxUsed = 0U;
+    heth->TxQueued = 0U;
+}
+
+/* Give Buffer to the first empty descriptor (RxFill) and hand it to the DMA */
+static void ETH_RxArm(ETH_HandleTypeDef *heth, void *Buffer)
+{
+    ETH_DMADescTypeDef *desc = &heth->Init.RxDesc[heth->RxFill];
+    uint32_t control = heth->Init.RxBufferSize;
+
+    if (heth->RxFill == (heth->Init.RxDescCount - 1U)) {
+        control |= ETH_DMARXDESC_RER;
+    }
+    /* Buffers are filled in ring order, so every RxCoalesceFrames-th frame interrupts
+       at once and the receive watchdog covers the ones in between */
+    if (++heth->RxArmed >= heth->Init.RxCoalesceFrames) {
+        heth->RxArmed = 0U;
+    }
+    else {
+        control |= ETH_DMARXDESC_DIC;
+    }
+    desc->Buf = Buffer;
+    desc->Buffer1 = ETH_ADDR(Buffer);
+    desc->Control = control;
+    ETH_BARRIER();
+    desc->Status = ETH_DMARXDESC_OWN;
+
+    heth->RxFill = ETH_NEXT(heth->RxFill, heth->Init.RxDescCount);
+    heth->RxEmpty--;
+}
+
+/* Checksum offload result, from FT / IPHCE / PCE (normal descriptor format) */
+static uint32_t ETH_RxChecksum(ETH_HandleTypeDef *heth, uint32_t Status)
+{
+    if (heth->Init.ChecksumOffload != ENABLE) {
+        return ETH_RX_CSUM_NONE;
+    }
+    switch (Status & (ETH_DMARXDESC_FT | ETH_DMARXDESC_IPHCE | ETH_DMARXDESC_PCE))
+    {
+        case ETH_DMARXDESC_FT:
+            return ETH_RX_CSUM_OK;
+
+        case ETH_DMARXDESC_PCE:
+            return ETH_RX_CSUM_IP_ONLY;         /* payload type the engine does not handle */
+
+        default:
+            return ETH_RX_CSUM_NONE;            /* length frame, or not IPv4/IPv6 */
+    }
+}
\ No newline at end of file
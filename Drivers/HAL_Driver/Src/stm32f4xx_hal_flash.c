@@ -0,0 +1,221 @@
+#include "stm32f4xx_hal.h"
+#include <string.h>
+
+/**
+ * @brief: Private macros
+ */
+#define FLASH_PROGRAM_TIMEOUT   100000U         /* SR polls per program operation (16 us typ.) */
+#define FLASH_ERASE_TIMEOUT     200000000U      /* SR polls per sector erase (128 KB x8: 4 s max) */
+#define FLASH_SR_ERRORS         (FLASH_SR_WRPERR | FLASH_SR_PGAERR | FLASH_SR_PGPERR | FLASH_SR_PGSERR | FLASH_SR_OPERR)
+
+/**
+ * @brief: Private functions
+ */
+static HAL_StatusTypeDef FLASH_WaitDone(FLASH_HandleTypeDef *hflash, uint32_t Timeout);
+
+/*------------------------------------------- Init -------------------------------------------*/
+/**
+ * @brief   Set the program size from the voltage range and clear stale error flags
+ * @param   hflash - Instance = FLASH, Init.VoltageRange set to the board's supply
+ */
+HAL_StatusTypeDef HAL_FLASH_Init(FLASH_HandleTypeDef *hflash)
+{
+    if (hflash == NULL) {
+        return HAL_ERROR;
+    }
+    assert_param(IS_FLASH_VOLTAGE_RANGE(hflash->Init.VoltageRange));
+
+    hflash->ProgramSize = 1UL << (hflash->Init.VoltageRange >> FLASH_CR_PSIZE_Pos);
+    hflash->ErrorCode = HAL_FLASH_ERROR_NONE;
+    WRITE_REG(hflash->Instance->SR, FLASH_SR_STATIC);
+    hflash->State = HAL_FLASH_STATE_READY;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Unlock FLASH_CR for erase and program
+ * @note    A wrong key sequence locks CR until the next reset.
+ */
+HAL_StatusTypeDef HAL_FLASH_Unlock(FLASH_HandleTypeDef *hflash)
+{
+    if (READ_BIT(hflash->Instance->CR, FLASH_CR_LOCK) != 0U)
+    {
+        WRITE_REG(hflash->Instance->KEYR, FLASH_KEY1);
+        WRITE_REG(hflash->Instance->KEYR, FLASH_KEY2);
+        if (READ_BIT(hflash->Instance->CR, FLASH_CR_LOCK) != 0U) {
+            hflash->ErrorCode |= HAL_FLASH_ERROR_LOCKED;
+            return HAL_ERROR;
+        }
+    }
+    return HAL_OK;
+}
+
+void HAL_FLASH_Lock(FLASH_HandleTypeDef *hflash)
+{
+    SET_BIT(hflash->Instance->CR, FLASH_CR_LOCK);
+}
+
+/*------------------------------------------- Erase / program -------------------------------------------*/
+/**
+ * @brief   Erase one sector to 0xFF
+ * @note    Blocks for up to a few seconds (128 KB sector). The data cache is reset after,
+ *          it may hold lines of the old contents.
+ * @param   Sector - 0 ~ 11
+ */
+HAL_StatusTypeDef HAL_FLASH_EraseSector(FLASH_HandleTypeDef *hflash, uint32_t Sector)
+{
+    HAL_StatusTypeDef status;
+
+    if (Sector >= FLASH_SECTOR_COUNT) {
+        hflash->ErrorCode |= HAL_FLASH_ERROR_PARAM;
+        return HAL_ERROR;
+    }
+    if (FLASH_WaitDone(hflash, FLASH_PROGRAM_TIMEOUT) != HAL_OK) {
+        return HAL_ERROR;
+    }
+
+    MODIFY_REG(hflash->Instance->CR, FLASH_CR_PSIZE | FLASH_CR_SNB | FLASH_CR_PG | FLASH_CR_SER,
+               hflash->Init.VoltageRange | (Sector << FLASH_CR_SNB_Pos) | FLASH_CR_SER);
+    SET_BIT(hflash->Instance->CR, FLASH_CR_STRT);
+    status = FLASH_WaitDone(hflash, FLASH_ERASE_TIMEOUT);
+    CLEAR_BIT(hflash->Instance->CR, FLASH_CR_SER | FLASH_CR_SNB);
+
+    if (READ_BIT(hflash->Instance->ACR, FLASH_ACR_DCEN) != 0U)
+    {
+        __HAL_FLASH_DATA_CACHE_DISABLE();
+        __HAL_FLASH_DATA_CACHE_RESET();
+        __HAL_FLASH_DATA_CACHE_ENABLE();
+    }
+    return status;
+}
+
+/**
+ * @brief   Program whole units at the configured parallelism
+ * @note    Bits can only go from 1 to 0: programming over non-erased data ANDs it in.
+ *          x64 units are written as two words back to back, the flash interface collects
+ *          them into one operation.
+ * @param   Address - Aligned to ProgramSize
+ * @param   Data - Any alignment
+ * @param   Length - Multiple of ProgramSize
+ */
+HAL_StatusTypeDef HAL_FLASH_Program(FLASH_HandleTypeDef *hflash, uint32_t Address, const void *Data, uint32_t Length)
+{
+    const uint8_t *src = (const uint8_t *)Data;
+    uint32_t size = hflash->ProgramSize;
+    uint32_t word[2];
+    HAL_StatusTypeDef status = HAL_OK;
+
+    if (((Address & (size - 1U)) != 0U) || ((Length & (size - 1U)) != 0U) ||
+        (Address < FLASH_BASE) || (Address >= FLASH_END) || (Length > (FLASH_END - Address))) {
+        hflash->ErrorCode |= HAL_FLASH_ERROR_PARAM;
+        return HAL_ERROR;
+    }
+    if (FLASH_WaitDone(hflash, FLASH_PROGRAM_TIMEOUT) != HAL_OK) {
+        return HAL_ERROR;
+    }
+
+    MODIFY_REG(hflash->Instance->CR, FLASH_CR_PSIZE | FLASH_CR_SER, hflash->Init.VoltageRange | FLASH_CR_PG);
+    for (; Length != 0U; Length -= size, Address += size, src += size)
+    {
+        memcpy(word, src, size);
+        switch (size)
+        {
+            case 1U:
+                *(__IO uint8_t *)Address = (uint8_t)word[0];
+                break;
+
+            case 2U:
+                *(__IO uint16_t *)Address = (uint16_t)word[0];
+                break;
+
+            case 4U:
+                *(__IO uint32_t *)Address = word[0];
+                break;
+
+            default:
+                *(__IO uint32_t *)Address = word[0];
+                __ISB();
+                *(__IO uint32_t *)(Address + 4U) = word[1];
+                break;
+        }
+        status = FLASH_WaitDone(hflash, FLASH_PROGRAM_TIMEOUT);
+        if (status != HAL_OK) {
+            break;
+        }
+    }
+    CLEAR_BIT(hflash->Instance->CR, FLASH_CR_PG);
+
+    return status;
+}
+
+/*------------------------------------------- Geometry -------------------------------------------*/
+/**
+ * @brief   Start address of a sector, FLASH_END past the last one
+ */
+uint32_t HAL_FLASH_GetSectorAddress(uint32_t Sector)
+{
+    if (Sector < 4U) {
+        return FLASH_BASE + (Sector * 0x4000UL);
+    }
+    if (Sector < 5U) {
+        return FLASH_BASE + 0x10000UL;
+    }
+    if (Sector < FLASH_SECTOR_COUNT) {
+        return FLASH_BASE + ((Sector - 4U) * 0x20000UL);
+    }
+    return FLASH_END;
+}
+
+uint32_t HAL_FLASH_GetSectorSize(uint32_t Sector)
+{
+    return HAL_FLASH_GetSectorAddress(Sector + 1U) - HAL_FLASH_GetSectorAddress(Sector);
+}
+
+HAL_FLASH_StateTypeDef HAL_FLASH_GetState(FLASH_HandleTypeDef *hflash)
+{
+    return hflash->State;
+}
+
+uint32_t HAL_FLASH_GetError(FLASH_HandleTypeDef *hflash)
+{
+    return hflash->ErrorCode;
+}
+
+/*------------------------------------------- Private functions -------------------------------------------*/
+/* Wait for BSY to drop, then turn the error flags of the operation into ErrorCode */
+static HAL_StatusTypeDef FLASH_WaitDone(FLASH_HandleTypeDef *hflash, uint32_t Timeout)
+{
+    uint32_t sr;
+
+    while ((READ_BIT(hflash->Instance->SR, FLASH_SR_BSY) != 0U) && (--Timeout != 0U)) {
+    }
+    if (Timeout == 0U) {
+        hflash->ErrorCode |= HAL_FLASH_ERROR_TIMEOUT;
+        hflash->State = HAL_FLASH_STATE_ERROR;
+        return HAL_ERROR;
+    }
+
+    sr = READ_REG(hflash->Instance->SR);
+    WRITE_REG(hflash->Instance->SR, sr & FLASH_SR_STATIC);
+    if ((sr & FLASH_SR_ERRORS) == 0U) {
+        return HAL_OK;
+    }
+    if ((sr & FLASH_SR_WRPERR) != 0U) {
+        hflash->ErrorCode |= HAL_FLASH_ERROR_WRP;
+    }
+    if ((sr & FLASH_SR_PGAERR) != 0U) {
+        hflash->ErrorCode |= HAL_FLASH_ERROR_PGA;
+    }
+    if ((sr & FLASH_SR_PGPERR) != 0U) {
+        hflash->ErrorCode |= HAL_FLASH_ERROR_PGP;
+    }
+    if ((sr & FLASH_SR_PGSERR) != 0U) {
+        hflash->ErrorCode |= HAL_FLASH_ERROR_PGS;
+    }
+    if ((sr & FLASH_SR_OPERR) != 0U) {
+        hflash->ErrorCode |= HAL_FLASH_ERROR_OPERATION;
+    }
+    hflash->State = HAL_FLASH_STATE_ERROR;
+    return HAL_ERROR;
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief: Private macros
+ */
+/* BCR fields set by the driver, the others keep their reset value (bit 7 is reserved, set) */
+#define FSMC_BCR_OWNED          (FSMC_BCRx_MBKEN | FSMC_BCRx_MUXEN | FSMC_BCRx_MTYP | FSMC_BCRx_MWID |     \
+                                 FSMC_BCRx_FACCEN | FSMC_BCRx_BURSTEN | FSMC_BCRx_WAITEN | FSMC_BCRx_WREN | \
+                                 FSMC_BCRx_EXTMOD | FSMC_BCRx_ASYNCWAIT | FSMC_BCRx_CBURSTRW)
+/* Fields that don't matter in mode 1 are kept off their reserved value 0 */
+#define FSMC_BTR_FIXED          ((1UL << FSMC_BTRx_ADDHLD_Pos) | (1UL << FSMC_BTRx_CLKDIV_Pos))
+#define FSMC_BWTR_FIXED         ((1UL << FSMC_BWTRx_ADDHLD_Pos) | (1UL << FSMC_BWTRx_CLKDIV_Pos))
+
+#define FSMC_BCR(BANK)          (FSMC_Bank1->BTCR[(BANK) * 2U])
+#define FSMC_BTR(BANK)          (FSMC_Bank1->BTCR[((BANK) * 2U) + 1U])
+#define FSMC_BWTR(BANK)         (FSMC_Bank1E->BWTR[(BANK) * 2U])
+
+/**
+ * @brief   ns -> HCLK cycles, rounded up
+ */
+static uint32_t FSMC_Cycles(uint32_t Ns, uint32_t Hclk)
+{
+    return (uint32_t)((((uint64_t)Ns * Hclk) + 999999999U) / 1000000000U);
+}
+
+/**
+ * @brief   Turn the ns timing of hsram->Init into BTR / BWTR values at the current HCLK
+ * @retval  HAL_ERROR if a time needs more cycles than its field holds
+ */
+static HAL_StatusTypeDef FSMC_CalcTiming(FSMC_NORSRAM_HandleTypeDef *hsram)
+{
+    uint32_t hclk = HAL_RCC_GetHCLKFreq();
+    uint32_t addset = FSMC_Cycles(hsram->Init.AddressSetupNs, hclk);
+    uint32_t datast = FSMC_Cycles(hsram->Init.DataSetupNs, hclk);
+    uint32_t busturn = FSMC_Cycles(hsram->Init.BusTurnNs, hclk);
+
+    datast = (datast == 0U) ? 1U : datast;
+    if ((addset > FSMC_ADDSET_MAX) || (datast > FSMC_DATAST_MAX) || (busturn > FSMC_BUSTURN_MAX)) {
+        return HAL_ERROR;
+    }
+    hsram->ReadTiming = FSMC_BTR_FIXED | (addset << FSMC_BTRx_ADDSET_Pos) | (datast << FSMC_BTRx_DATAST_Pos) |
+                        (busturn << FSMC_BTRx_BUSTURN_Pos);
+    hsram->WriteTiming = 0U;
+
+    if (hsram->Init.WriteDataSetupNs != 0U) {
+        addset = FSMC_Cycles(hsram->Init.WriteAddressSetupNs, hclk);
+        datast = FSMC_Cycles(hsram->Init.WriteDataSetupNs, hclk);
+        if ((addset > FSMC_ADDSET_MAX) || (datast > FSMC_DATAST_MAX)) {
+            return HAL_ERROR;
+        }
+        hsram->WriteTiming = FSMC_BWTR_FIXED | (addset << FSMC_BWTRx_ADDSET_Pos) | (datast << FSMC_BWTRx_DATAST_Pos);
+    }
+    return HAL_OK;
+}
+
+/*------------------------------------------- Bank setup -------------------------------------------*/
+/**
+ * @brief   Configure and enable a NOR/SRAM bank according to hsram->Init
+ * @note    The bank is disabled while its timing changes. No access to it may be in
+ *          flight (no DMA running on it).
+ * @retval  HAL_ERROR on a bad bank, or timing out of range at the current HCLK
+ */
+HAL_StatusTypeDef HAL_FSMC_NORSRAM_Init(FSMC_NORSRAM_HandleTypeDef *hsram)
+{
+    uint32_t bcr;
+
+    if ((hsram == NULL) || !IS_FSMC_NORSRAM_BANK(hsram->Bank) || (FSMC_CalcTiming(hsram) != HAL_OK)) {
+        return HAL_ERROR;
+    }
+
+    bcr = hsram->Init.MemoryType | hsram->Init.DataWidth | hsram->Init.WriteEnable;
+    if (hsram->Init.MemoryType == FSMC_MEMORY_TYPE_NOR) {
+        bcr |= FSMC_BCRx_FACCEN;
+    }
+    if (hsram->WriteTiming != 0U) {
+        bcr |= FSMC_BCRx_EXTMOD;
+    }
+
+    CLEAR_BIT(FSMC_BCR(hsram->Bank), FSMC_BCRx_MBKEN);
+    WRITE_REG(FSMC_BTR(hsram->Bank), hsram->ReadTiming);
+    WRITE_REG(FSMC_BWTR(hsram->Bank), (hsram->WriteTiming != 0U) ? hsram->WriteTiming : 0x0FFFFFFFU);
+    MODIFY_REG(FSMC_BCR(hsram->Bank), FSMC_BCR_OWNED, bcr);
+    SET_BIT(FSMC_BCR(hsram->Bank), FSMC_BCRx_MBKEN);
+
+    hsram->BaseAddress = FSMC_NORSRAM_ADDRESS(hsram->Bank);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Disable a bank: accesses to its address range then fault
+ */
+HAL_StatusTypeDef HAL_FSMC_NORSRAM_DeInit(FSMC_NORSRAM_HandleTypeDef *hsram)
+{
+    if ((hsram == NULL) || !IS_FSMC_NORSRAM_BANK(hsram->Bank)) {
+        return HAL_ERROR;
+    }
+    CLEAR_BIT(FSMC_BCR(hsram->Bank), FSMC_BCRx_MBKEN);
+    return HAL_OK;
+}
+
+/**
+ * @brief   Recompute the cycle counts after HCLK changed
+ * @note    Call it right after the change. Until then, old cycle counts at a lower HCLK
+ *          are only slow, but at a higher HCLK they are too short for the device: no
+ *          access to the bank may come in between.
+ * @retval  HAL_ERROR if a time no longer fits at the new HCLK, the old timing stays
+ */
+HAL_StatusTypeDef HAL_FSMC_NORSRAM_UpdateClock(FSMC_NORSRAM_HandleTypeDef *hsram)
+{
+    uint32_t read = hsram->ReadTiming;
+    uint32_t write = hsram->WriteTiming;
+
+    if (FSMC_CalcTiming(hsram) != HAL_OK) {
+        hsram->ReadTiming = read;
+        hsram->WriteTiming = write;
+        return HAL_ERROR;
+    }
+    WRITE_REG(FSMC_BTR(hsram->Bank), hsram->ReadTiming);
+    if (hsram->WriteTiming != 0U) {
+        WRITE_REG(FSMC_BWTR(hsram->Bank), hsram->WriteTiming);
+    }
+    return HAL_OK;
+}
\ No newline at end of file
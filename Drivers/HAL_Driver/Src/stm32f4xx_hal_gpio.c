@@ -5,15 +5,56 @@
  */
 #define GPIO_NUMBER     16U
 
+/**
+ * @brief: Private functions
+ */
+static void GPIO_SetConfig(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init, const GPIO_AFPortTypeDef *AFPort);
+
 /**
  * @brief: Initializes GPIOx peripheral according to the params of GPIO_Init
+ * @note:  Clear/set masks of every selected pin are collected first, then each register
+ *         is updated with a single read-modify-write (instead of one RMW per pin and per field).
+ *         MODER is written last, so a pin only leaves its previous mode once it is fully configured.
  */
 void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+    HAL_TRACE(TRC_KIND_INSTANT, TRC_ID_GPIO_INIT + GPIO_GET_INDEX(GPIOx), GPIO_Init->Pin);
+    GPIO_SetConfig(GPIOx, GPIO_Init, NULL);
+}
+
+/**
+ * @brief   Switch every pin of a compile-time port AF configuration to its alternate function
+ * @note    AF numbers come from AFPort (see GPIO_AF_PORT_DEFINE), AFRL and AFRH are written once each.
+ *          GPIO_Init->Pin and GPIO_Init->Alternate are ignored, Mode only selects push-pull/open-drain.
+ * @param   GPIOx     - x is the port (A...I), must be the port AFPort was built for
+ * @param   AFPort    - Port AF configuration
+ * @param   GPIO_Init - Output type, speed and pull of the pins
+ * @retval  None
+ */
+void HAL_GPIO_AFPortInit(GPIO_TypeDef *GPIOx, const GPIO_AFPortTypeDef *AFPort, GPIO_InitTypeDef *GPIO_Init)
+{
+    GPIO_InitTypeDef init = *GPIO_Init;
+
+    assert_param(AFPort->Port == GPIO_GET_INDEX(GPIOx));
+
+    init.Pin  = AFPort->Pin;
+    init.Mode = MODE_AF | (GPIO_Init->Mode & OUTPUT_TYPE);
+    GPIO_SetConfig(GPIOx, &init, AFPort);
+}
+
+/**
+ * @brief: Configure pins of GPIOx, AF numbers are taken from AFPort when given, else from GPIO_Init->Alternate
+ */
+static void GPIO_SetConfig(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init, const GPIO_AFPortTypeDef *AFPort)
 {
     uint32_t position;
     uint32_t ioposition;
     uint32_t iocurrent = 0x00U;
-    uint32_t temp = 0x00U;
+    uint32_t moder_clr = 0x00U, moder_set = 0x00U;
+    uint32_t otyper_clr = 0x00U, otyper_set = 0x00U;
+    uint32_t ospeedr_clr = 0x00U, ospeedr_set = 0x00U;
+    uint32_t pupdr_clr = 0x00U, pupdr_set = 0x00U;
+    uint32_t afr_clr[2] = {0x00U, 0x00U}, afr_set[2] = {0x00U, 0x00U};   /* [0] = AFRL (pin 0-7), [1] = AFRH (pin 8-15) */
 
     /* Check params */
     // assert_param(IS_GPIO_ALL_INSTANCE(GPIOx));
@@ -35,47 +76,99 @@ void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
             {
                 /* Configure IO speed */
                 //assert_param(IS_GPIO_SPEED(GPIO_Init->Speed));
-                temp = GPIOx->OSPEEDR;
-                temp &= ~(GPIO_OSPEEDR_OSPEEDR0_Msk << (position*2U));  /* Clear 2 position bits. It's good to use OSPEEDR0 instead of hardcoding */
-                temp |= (GPIO_Init->Speed << (position*2U));
-                GPIOx->OSPEEDR = temp;
+                ospeedr_clr |= (GPIO_OSPEEDR_OSPEEDR0_Msk << (position*2U));  /* Clear 2 position bits. It's good to use OSPEEDR0 instead of hardcoding */
+                ospeedr_set |= (GPIO_Init->Speed << (position*2U));
 
                 /* Configure IO output type (we're in output mode now)*/
-                temp = GPIOx->OTYPER;
-                temp &= ~(GPIO_OTYPER_OT0 << position);
-                temp |= ((GPIO_Init->Mode & OUTPUT_TYPE) >> OUTPUT_TYPE_Pos) << position; /* Mask out output_type from Mode variable -> shift back to 0 pos before actually set OTYPER */
-                GPIOx->OTYPER = temp;
+                otyper_clr |= (GPIO_OTYPER_OT0 << position);
+                otyper_set |= ((GPIO_Init->Mode & OUTPUT_TYPE) >> OUTPUT_TYPE_Pos) << position; /* Mask out output_type from Mode variable -> shift back to 0 pos before actually set OTYPER */
             }
             /* Configure Pull resistors when mode is NOT analog (RM - pg. 281)*/
             if ((GPIO_Init->Mode & GPIO_MODE) != MODE_ANALOG)
             {
                 //assert_param(IS_GPIO_PULL(GPIO_Init->Pull));
-                temp = GPIOx->PURDR;
-                temp &= (GPIO_PUPDR_PUPDR0 << (position*2U));
-                temp |= (GPIO_Init->Pull << (position*2U));
-                GPIOx->PURDR = temp;
+                pupdr_clr |= (GPIO_PUPDR_PUPDR0 << (position*2U));
+                pupdr_set |= (GPIO_Init->Pull << (position*2U));
             }
             /* Configure Alternate Mode */
-            if ((GPIO_Init->Mode & GPIO_MODE) == MODE_AF)
+            if ((GPIO_Init->Mode & GPIO_MODE) == MODE_AF && AFPort == NULL)
             {
-                //assert_param(IS_GPIO_AF(GPIO_Init->Alternate))
-
+                assert_param(IS_GPIO_AF(GPIO_Init->Alternate));
+                /* 4 bits per pin, pin 0-7 in AFRL and pin 8-15 in AFRH */
+                afr_clr[position >> 3U] |= (0xFU << ((position & 0x07U) * 4U));
+                afr_set[position >> 3U] |= ((GPIO_Init->Alternate & 0xFU) << ((position & 0x07U) * 4U));
             }
             /* Configure MODE register */
-            temp = GPIOx->MODER;
-            temp &= ~(GPIO_MODER_MODE0 << (position * 2U));
-            temp |= ((GPIO_Init->Mode & GPIO_MODE) << (position * 2U)); /* GPIO_MODE_Pos = 0 -> no shift */
-            GPIOx->MODER = temp;
+            moder_clr |= (GPIO_MODER_MODE0 << (position * 2U));
+            moder_set |= ((GPIO_Init->Mode & GPIO_MODE) << (position * 2U)); /* GPIO_MODE_Pos = 0 -> no shift */
 
             /*----------------------- EXTI Mode (interrupt) configuration ---------------------------*/
 
         }
     }
+
+    /* One RMW per register, skip registers no selected pin touches */
+    if (ospeedr_clr != 0x00U) {
+        MODIFY_REG(GPIOx->OSPEEDR, ospeedr_clr, ospeedr_set);
+        MODIFY_REG(GPIOx->OTYPER, otyper_clr, otyper_set);
+    }
+    if (pupdr_clr != 0x00U) {
+        MODIFY_REG(GPIOx->PURDR, pupdr_clr, pupdr_set);
+    }
+    /* AF selection must be in place before MODER switches the pin to AF */
+    if (AFPort != NULL) {
+        afr_clr[0] = AFPort->AFRLMsk;   afr_set[0] = AFPort->AFRL;
+        afr_clr[1] = AFPort->AFRHMsk;   afr_set[1] = AFPort->AFRH;
+    }
+    if (afr_clr[0] != 0x00U) {
+        MODIFY_REG(GPIOx->AFRL, afr_clr[0], afr_set[0]);
+    }
+    if (afr_clr[1] != 0x00U) {
+        MODIFY_REG(GPIOx->AFRH, afr_clr[1], afr_set[1]);
+    }
+    if (moder_clr != 0x00U) {
+        MODIFY_REG(GPIOx->MODER, moder_clr, moder_set);
+    }
 }
 
+/**
+ * @brief   De-initialize GPIOx pins to their reset state (input floating, AF0, low speed, push-pull)
+ * @note    Same mask collecting as HAL_GPIO_Init: one RMW per register whatever the number of pins.
+ *          MODER goes first here, so the pins stop driving before the other fields are reset.
+ * @param   GPIOx - x is the port (A...I)
+ * @param   GPIO_Pin - specifies the port bits to be reset
+ * @retval  None
+ */
 void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
 {
+    uint32_t position;
+    uint32_t mask2 = 0x00U;                             /* 2-bit fields (MODER, OSPEEDR, PUPDR) */
+    uint32_t afr_clr[2] = {0x00U, 0x00U};               /* 4-bit fields, [0] = AFRL, [1] = AFRH */
+
+    assert_param(IS_GPIO_PIN(GPIO_Pin));
+
+    for (position = 0U; position < GPIO_NUMBER; position++)
+    {
+        if ((GPIO_Pin & (0x01U << position)) != 0x00U)
+        {
+            mask2 |= (GPIO_MODER_MODE0 << (position * 2U));
+            afr_clr[position >> 3U] |= (0xFU << ((position & 0x07U) * 4U));
+        }
+    }
 
+    if (mask2 == 0x00U) {
+        return;
+    }
+    CLEAR_BIT(GPIOx->MODER, mask2);
+    CLEAR_BIT(GPIOx->OSPEEDR, mask2);
+    CLEAR_BIT(GPIOx->OTYPER, GPIO_Pin & GPIO_PIN_MASK);
+    CLEAR_BIT(GPIOx->PURDR, mask2);
+    if (afr_clr[0] != 0x00U) {
+        CLEAR_BIT(GPIOx->AFRL, afr_clr[0]);
+    }
+    if (afr_clr[1] != 0x00U) {
+        CLEAR_BIT(GPIOx->AFRH, afr_clr[1]);
+    }
 }
 
 /**
@@ -115,9 +208,9 @@ void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState Pin
     //assert_param(IS_GPIO_PIN(GPIO_Pin));
 
     if (PinState != GPIO_PIN_RESET)
-        GPIOx->BSRR = GPIO_Pin;
+        WRITE_REG(GPIOx->BSRR, GPIO_Pin);
     else
-        GPIOx->BSRR = ((uint32_t)GPIO_Pin << 16U);    /* Reset bit (BRx) starts from 16th bit*/
+        WRITE_REG(GPIOx->BSRR, (uint32_t)GPIO_Pin << 16U);  /* Reset bit (BRx) starts from 16th bit*/
 }
 
 /**
@@ -148,21 +241,157 @@ void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
     set_state = (~odr & GPIO_Pin);
 
     /* Combine 2 methods above we can toggle the pin */
-    GPIOx->BSRR = reset_state | set_state;
+    WRITE_REG(GPIOx->BSRR, reset_state | set_state);
 }
 
 HAL_StatusTypeDef HAL_GPIO_LockPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
 {
+    UNUSED(GPIOx);
+    UNUSED(GPIO_Pin);
 
     return 0;
 }
 
+/**
+ * @brief   Handle the EXTI lines of GPIO_Pin: clear the pending ones, then call back
+ * @note    Lines sharing a vector (EXTI9_5, EXTI15_10) are served together, the
+ *          callback gets the mask of those that were pending.
+ * @param   GPIO_Pin - EXTI lines served by the calling vector
+ */
 void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin)
 {
+    uint32_t pending = EXTI->PR & GPIO_Pin;
+
+    if (pending != 0U) {
+        HAL_TRACE(TRC_KIND_BEGIN, TRC_ID_EXTI, pending);
+        EXTI->PR = pending;
+        HAL_GPIO_EXTI_Callback((uint16_t)pending);
+        HAL_TRACE(TRC_KIND_END, TRC_ID_EXTI, pending);
+    }
+}
+
+__weak void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+    UNUSED(GPIO_Pin);
+}
+
+/**
+ * @brief   Capture MODER/OTYPER/OSPEEDR/PUPDR/ODR/AFRL/AFRH of a set of ports
+ * @note    Port clocks must be enabled.
+ * @param   Snapshot - Where to store the configuration
+ * @param   PortMask - Ports to capture, see GPIO_PORTMASK()
+ * @retval  None
+ */
+void HAL_GPIO_SavePorts(GPIO_SnapshotTypeDef *Snapshot, uint32_t PortMask)
+{
+    uint32_t port;
+    GPIO_TypeDef *GPIOx;
+    GPIO_PortStateTypeDef *state;
+
+    Snapshot->PortMask = PortMask & GPIO_PORTMASK_ALL;
+
+    for (port = 0U; port <= GPIO_PORT_I; port++)
+    {
+        if ((Snapshot->PortMask & GPIO_PORTMASK(port)) == 0x00U) {
+            continue;
+        }
+        GPIOx = GPIO_PORT_INSTANCE(port);
+        state = &Snapshot->Port[port];
+
+        state->MODER   = GPIOx->MODER;
+        state->OTYPER  = (uint16_t)GPIOx->OTYPER;
+        state->OSPEEDR = GPIOx->OSPEEDR;
+        state->PUPDR   = GPIOx->PURDR;
+        state->ODR     = (uint16_t)GPIOx->ODR;
+        state->AFRL    = GPIOx->AFRL;
+        state->AFRH    = GPIOx->AFRH;
+    }
+}
+
+/**
+ * @brief   Put the captured ports into the lowest leakage configuration: analog mode, no pull
+ * @note    Only MODER and PUPDR are touched (2 writes per port), the rest of the configuration stays
+ *          in place so HAL_GPIO_RestorePorts() has little to write back.
+ *          PUPDR is cleared after MODER, a pin never floats as a digital input in between.
+ * @param   Snapshot - Snapshot taken by HAL_GPIO_SavePorts(), gives the ports and their current values
+ * @param   KeepPins - Per port (indexed A = 0 ... I = 8) pins to leave untouched, e.g. wake-up inputs
+ *                     or SWD (PA13/PA14). NULL = none.
+ * @retval  None
+ */
+void HAL_GPIO_LowPowerPorts(const GPIO_SnapshotTypeDef *Snapshot, const uint16_t *KeepPins)
+{
+    uint32_t port;
+    uint32_t position;
+    uint32_t keep2;
+    GPIO_TypeDef *GPIOx;
+    const GPIO_PortStateTypeDef *state;
 
+    for (port = 0U; port <= GPIO_PORT_I; port++)
+    {
+        if ((Snapshot->PortMask & GPIO_PORTMASK(port)) == 0x00U) {
+            continue;
+        }
+        GPIOx = GPIO_PORT_INSTANCE(port);
+        state = &Snapshot->Port[port];
+
+        /* Spread the 16 keep bits into 2-bit field masks */
+        keep2 = 0x00U;
+        if (KeepPins != NULL) {
+            for (position = 0U; position < GPIO_NUMBER; position++) {
+                if ((KeepPins[port] & (0x01U << position)) != 0x00U) {
+                    keep2 |= (GPIO_MODER_MODE0 << (position * 2U));
+                }
+            }
+        }
+
+        GPIOx->MODER = (state->MODER & keep2) | ~keep2;     /* MODE = 0b11 (analog) for every other pin */
+        GPIOx->PURDR = (state->PUPDR & keep2);
+    }
 }
 
-void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+/**
+ * @brief   Restore ports captured by HAL_GPIO_SavePorts()
+ * @note    Glitch-free order: output level (ODR), output type, speed, pulls and AF selection are set
+ *          first and MODER last, so a pin only starts driving once everything behind it is right.
+ *          Registers already holding the saved value are not written again (after
+ *          HAL_GPIO_LowPowerPorts() only PUPDR and MODER differ -> 2 writes per port).
+ * @param   Snapshot - Snapshot to restore
+ * @retval  None
+ */
+void HAL_GPIO_RestorePorts(const GPIO_SnapshotTypeDef *Snapshot)
 {
+    uint32_t port;
+    GPIO_TypeDef *GPIOx;
+    const GPIO_PortStateTypeDef *state;
+
+    for (port = 0U; port <= GPIO_PORT_I; port++)
+    {
+        if ((Snapshot->PortMask & GPIO_PORTMASK(port)) == 0x00U) {
+            continue;
+        }
+        GPIOx = GPIO_PORT_INSTANCE(port);
+        state = &Snapshot->Port[port];
 
-}
\ No newline at end of file
+        if ((uint16_t)GPIOx->ODR != state->ODR) {
+            GPIOx->ODR = state->ODR;
+        }
+        if ((uint16_t)GPIOx->OTYPER != state->OTYPER) {
+            GPIOx->OTYPER = state->OTYPER;
+        }
+        if (GPIOx->OSPEEDR != state->OSPEEDR) {
+            GPIOx->OSPEEDR = state->OSPEEDR;
+        }
+        if (GPIOx->PURDR != state->PUPDR) {
+            GPIOx->PURDR = state->PUPDR;
+        }
+        if (GPIOx->AFRL != state->AFRL) {
+            GPIOx->AFRL = state->AFRL;
+        }
+        if (GPIOx->AFRH != state->AFRH) {
+            GPIOx->AFRH = state->AFRH;
+        }
+        if (GPIOx->MODER != state->MODER) {
+            GPIOx->MODER = state->MODER;
+        }
+    }
+}
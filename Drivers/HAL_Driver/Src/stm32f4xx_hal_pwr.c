@@ -0,0 +1,46 @@
+#include "stm32f4xx_hal.h"
+
+/*------------------------------------------- Backup domain -------------------------------------------*/
+/**
+ * @brief   Allow writes to RCC_BDCR, the RTC and the backup registers
+ * @note    Off after reset to protect the backup domain from parasitic writes.
+ */
+void HAL_PWR_EnableBkUpAccess(void)
+{
+    SET_BIT(PWR->CR, PWR_CR_DBP);
+    (void)READ_REG(PWR->CR);    /* wait for the write to reach the PWR block */
+}
+
+void HAL_PWR_DisableBkUpAccess(void)
+{
+    CLEAR_BIT(PWR->CR, PWR_CR_DBP);
+}
+
+/*------------------------------------------- Low-power modes -------------------------------------------*/
+/**
+ * @brief   Enter SLEEP until the next interrupt
+ */
+void HAL_PWR_EnterSLEEPMode(void)
+{
+    CLEAR_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+    __DSB();
+    __WFI();
+}
+
+/**
+ * @brief   Enter STOP until an EXTI line fires
+ * @note    Returns on HSI, see the file header. An EXTI or RTC flag already pending
+ *          makes the core fall through without stopping, clear them before.
+ * @param   Regulator - See @ref PWR_STOP_Regulator
+ */
+void HAL_PWR_EnterSTOPMode(uint32_t Regulator)
+{
+    assert_param(IS_PWR_STOP_REGULATOR(Regulator));
+
+    MODIFY_REG(PWR->CR, PWR_CR_PDDS | PWR_CR_LPDS | PWR_CR_FPDS, Regulator);
+    SET_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+    __DSB();
+    __WFI();
+    __ISB();
+    CLEAR_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+}
\ No newline at end of file
@@ -1,5 +1,16 @@
 #include "stm32f4xx_hal.h"
 
+/**
+ * @brief: Prescaler shift for each HPRE / PPREx field value
+ */
+static const uint8_t AHBPrescTable[16] = {0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 1U, 2U, 3U, 4U, 6U, 7U, 8U, 9U};
+static const uint8_t APBPrescTable[8]  = {0U, 0U, 0U, 0U, 1U, 2U, 3U, 4U};
+
+/**
+ * @brief: Private functions
+ */
+static uint32_t RCC_GetPLLVCOFreq(void);
+
 HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef* RCC_OscInitStruct)
 {
     // uint32_t tickstart, pll_config;
@@ -52,4 +63,68 @@ HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef* RCC_OscInitStruct)
     
 
     return 0;
+}
+
+/**
+ * @brief   Compute SYSCLK from the current RCC configuration
+ * @note    Result is only as good as HSE_VALUE / HSI_VALUE.
+ *          PLL output = source / PLLM * PLLN / PLLP.
+ * @retval  SYSCLK in Hz
+ */
+uint32_t HAL_RCC_GetSysClockFreq(void)
+{
+    switch (__HAL_RCC_GET_SYSCLK_SOURCE())
+    {
+        case RCC_CFGR_SWS_HSE:
+            return HSE_VALUE;
+
+        case RCC_CFGR_SWS_PLL:
+            return RCC_GetPLLVCOFreq() / ((_FLD2VAL(RCC_PLLCFGR_PLLP, RCC->PLLCFGR) + 1U) * 2U);
+
+        case RCC_CFGR_SWS_HSI:
+        default:
+            return HSI_VALUE;
+    }
+}
+
+uint32_t HAL_RCC_GetHCLKFreq(void)
+{
+    return HAL_RCC_GetSysClockFreq() >> AHBPrescTable[_FLD2VAL(RCC_CFGR_HPRE, RCC->CFGR)];
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+    return HAL_RCC_GetHCLKFreq() >> APBPrescTable[_FLD2VAL(RCC_CFGR_PPRE1, RCC->CFGR)];
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void)
+{
+    return HAL_RCC_GetHCLKFreq() >> APBPrescTable[_FLD2VAL(RCC_CFGR_PPRE2, RCC->CFGR)];
+}
+
+/**
+ * @brief   PLL48CLK (USB OTG FS, SDIO and RNG kernel clock) = VCO / PLLQ
+ * @retval  Frequency in Hz, 0 if the PLL is off or PLLQ is invalid
+ */
+uint32_t HAL_RCC_GetPLL48CLKFreq(void)
+{
+    uint32_t pllq = _FLD2VAL(RCC_PLLCFGR_PLLQ, RCC->PLLCFGR);
+
+    if (((RCC->CR & RCC_CR_PLLRDY) == 0U) || (pllq < 2U)) {
+        return 0U;
+    }
+    return RCC_GetPLLVCOFreq() / pllq;
+}
+
+/* VCO output = source / PLLM * PLLN */
+static uint32_t RCC_GetPLLVCOFreq(void)
+{
+    uint32_t pllcfgr = RCC->PLLCFGR;
+    uint32_t pllm = _FLD2VAL(RCC_PLLCFGR_PLLM, pllcfgr);
+    uint32_t pllsrc = ((pllcfgr & RCC_PLLCFGR_PLLSRC) == RCC_PLLCFGR_PLLSRC_HSE) ? HSE_VALUE : HSI_VALUE;
+
+    if (pllm == 0U) {
+        return 0U;      /* invalid PLLM, PLL can't be running */
+    }
+    return (uint32_t)(((uint64_t)pllsrc * _FLD2VAL(RCC_PLLCFGR_PLLN, pllcfgr)) / pllm);
 }
\ No newline at end of file
@@ -0,0 +1,628 @@
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief: Private macros
+ */
+#define SD_CMD_TIMEOUT          100000U     /* STA polls for one command */
+#define SD_MAX_VOLT_TRIAL       0xFFFFU     /* ACMD41 retries, > 1 s at 400 kHz */
+#define SD_STOP_TIMEOUT         100000U     /* DMA stream / CMDACT polls at the end of a transfer */
+
+#define SD_RESP_NONE            0x00U
+#define SD_RESP_SHORT           (0x1UL << SDIO_CMD_WAITRESP_Pos)
+#define SD_RESP_LONG            (0x3UL << SDIO_CMD_WAITRESP_Pos)
+#define SD_RESP_NOCRC           0x100U      /* R3: CRC field is all ones, CCRCFAIL is expected */
+
+#define SD_CMD_GO_IDLE_STATE        0U
+#define SD_CMD_ALL_SEND_CID         2U
+#define SD_CMD_SEND_REL_ADDR        3U
+#define SD_CMD_SEL_DESEL_CARD       7U
+#define SD_CMD_SEND_IF_COND         8U
+#define SD_CMD_SEND_CSD             9U
+#define SD_CMD_STOP_TRANSMISSION    12U
+#define SD_CMD_SEND_STATUS          13U
+#define SD_CMD_SET_BLOCKLEN         16U
+#define SD_CMD_READ_SINGLE_BLOCK    17U
+#define SD_CMD_READ_MULT_BLOCK      18U
+#define SD_CMD_WRITE_SINGLE_BLOCK   24U
+#define SD_CMD_WRITE_MULT_BLOCK     25U
+#define SD_CMD_ERASE_WR_BLK_START   32U
+#define SD_CMD_ERASE_WR_BLK_END     33U
+#define SD_CMD_ERASE                38U
+#define SD_CMD_APP_CMD              55U
+#define SD_ACMD_SET_BUS_WIDTH       6U
+#define SD_ACMD_SET_WR_BLK_ERASE_COUNT 23U
+#define SD_ACMD_SD_SEND_OP_COND     41U
+#define SD_ACMD_SET_CLR_CARD_DETECT 42U
+
+#define SD_CHECK_PATTERN        0x000001AAU /* CMD8: 2.7-3.6 V, check pattern 0xAA */
+#define SD_OCR_VOLTAGE_WINDOW   0x00100000U /* 3.2-3.3 V */
+#define SD_OCR_HCS              0x40000000U /* Host supports SDHC/SDXC */
+#define SD_OCR_BUSY             0x80000000U /* Power up done */
+#define SD_R1_ERRORBITS         0xFDFFE008U /* Error bits of the card status */
+
+#define SD_FLAGS_CMD            (SDIO_ICR_CCRCFAILC | SDIO_ICR_CTIMEOUTC | SDIO_ICR_CMDRENDC | SDIO_ICR_CMDSENTC)
+#define SD_FLAGS_DATA_ERROR     (SDIO_STA_DCRCFAIL | SDIO_STA_DTIMEOUT | SDIO_STA_TXUNDERR | SDIO_STA_RXOVERR | SDIO_STA_STBITERR)
+#define SD_DCTRL_BLOCK_512      (9UL << SDIO_DCTRL_DBLOCKSIZE_Pos)
+
+/**
+ * @brief: Private functions
+ */
+static HAL_StatusTypeDef SD_SendCmd(SD_HandleTypeDef *hsd, uint32_t Cmd, uint32_t Arg, uint32_t Resp);
+static HAL_StatusTypeDef SD_SendCmdR1(SD_HandleTypeDef *hsd, uint32_t Cmd, uint32_t Arg);
+static HAL_StatusTypeDef SD_SendAppCmd(SD_HandleTypeDef *hsd, uint32_t Acmd, uint32_t Arg, uint32_t Resp);
+static HAL_StatusTypeDef SD_SetBusClock(SD_HandleTypeDef *hsd, uint32_t Freq, uint32_t BusWide, uint32_t PowerSave);
+static HAL_StatusTypeDef SD_Identify(SD_HandleTypeDef *hsd);
+static void SD_ParseCsd(SD_HandleTypeDef *hsd);
+static uint32_t SD_CardAddress(SD_HandleTypeDef *hsd, uint32_t BlockAdd);
+static void SD_EndTransfer(SD_HandleTypeDef *hsd);
+static void SD_Delay(uint32_t Microseconds);
+
+/*------------------------------------------- Init -------------------------------------------*/
+/**
+ * @brief   Power up the bus, identify the card and switch to the transfer clock and width
+ * @note    The SDIO and DMA2 clocks, the pins and the PLL (PLL48CLK = 48 MHz) must be set up
+ *          before. Takes a few hundred ms with some cards (ACMD41 power-up loop).
+ * @param   hsd - SD handle, Instance = SDIO, Init filled
+ * @retval  HAL_OK, HAL_ERROR with ErrorCode set if no usable card answered
+ */
+HAL_StatusTypeDef HAL_SD_Init(SD_HandleTypeDef *hsd)
+{
+    if (hsd == NULL) {
+        return HAL_ERROR;
+    }
+    assert_param(IS_SDIO_ALL_INSTANCE(hsd->Instance));
+    assert_param(IS_SD_BUS_WIDE(hsd->Init.BusWide));
+
+    hsd->ErrorCode = HAL_SD_ERROR_NONE;
+    hsd->Context = SD_CONTEXT_NONE;
+    hsd->State = HAL_SD_STATE_BUSY;
+
+    /* Identification runs at <= 400 kHz on one data line */
+    CLEAR_REG(hsd->Instance->MASK);
+    CLEAR_REG(hsd->Instance->DCTRL);
+    if (SD_SetBusClock(hsd, SD_INIT_CLOCK, SD_BUS_WIDE_1B, SD_CLOCK_POWER_SAVE_DISABLE) != HAL_OK) {
+        hsd->State = HAL_SD_STATE_ERROR;
+        return HAL_ERROR;
+    }
+    WRITE_REG(hsd->Instance->POWER, SDIO_POWER_PWRCTRL);
+    /* 1 ms supply ramp plus 74 clocks before the first command */
+    SD_Delay(2000U);
+
+    if (SD_Identify(hsd) != HAL_OK) {
+        hsd->State = HAL_SD_STATE_ERROR;
+        return HAL_ERROR;
+    }
+
+    /* 4-bit: disconnect the card's DAT3 pull-up (card detect) first, then widen both sides */
+    if (hsd->Init.BusWide == SD_BUS_WIDE_4B)
+    {
+        if ((SD_SendAppCmd(hsd, SD_ACMD_SET_CLR_CARD_DETECT, 0U, SD_RESP_SHORT) != HAL_OK) ||
+            (SD_SendAppCmd(hsd, SD_ACMD_SET_BUS_WIDTH, 2U, SD_RESP_SHORT) != HAL_OK)) {
+            hsd->State = HAL_SD_STATE_ERROR;
+            return HAL_ERROR;
+        }
+    }
+    if (SD_SetBusClock(hsd, hsd->Init.ClockFreq, hsd->Init.BusWide, hsd->Init.ClockPowerSave) != HAL_OK) {
+        hsd->State = HAL_SD_STATE_ERROR;
+        return HAL_ERROR;
+    }
+    /* 250 ms, the SDHC write busy limit (reads are bounded at 100 ms) */
+    hsd->DataTimeout = hsd->Card.BusClock / 4U;
+
+    WRITE_REG(hsd->Instance->ICR, SDIO_ICR_STATIC);
+    hsd->State = HAL_SD_STATE_READY;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SD_DeInit(SD_HandleTypeDef *hsd)
+{
+    if (hsd == NULL) {
+        return HAL_ERROR;
+    }
+    (void)HAL_SD_Abort(hsd);
+    CLEAR_REG(hsd->Instance->CLKCR);
+    CLEAR_REG(hsd->Instance->POWER);
+    hsd->State = HAL_SD_STATE_RESET;
+
+    return HAL_OK;
+}
+
+/*------------------------------------------- Transfers -------------------------------------------*/
+/**
+ * @brief   Read blocks with DMA (CMD17, or CMD18 + CMD12 for more than one)
+ * @note    The data path is armed before the command, the card starts sending ~100 clocks
+ *          after it. HAL_SD_RxCpltCallback() runs once the DMA FIFO has been flushed.
+ * @param   pData - Word aligned, NumberOfBlocks * SD_BLOCK_SIZE bytes
+ * @param   BlockAdd - First block (always in blocks, also on SDSC cards)
+ * @param   NumberOfBlocks - 1 ~ SD_MAX_XFER_BLOCKS
+ */
+HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks)
+{
+    uint32_t cmd;
+
+    assert_param(IS_SD_XFER_BLOCKS(NumberOfBlocks));
+    assert_param(((uint32_t)pData & 3U) == 0U);
+
+    if (hsd->State != HAL_SD_STATE_READY) {
+        return HAL_BUSY;
+    }
+    if ((BlockAdd >= hsd->Card.BlockCount) || (NumberOfBlocks > (hsd->Card.BlockCount - BlockAdd))) {
+        hsd->ErrorCode = HAL_SD_ERROR_ADDRESS;
+        return HAL_ERROR;
+    }
+    hsd->State = HAL_SD_STATE_BUSY;
+    hsd->ErrorCode = HAL_SD_ERROR_NONE;
+    hsd->Context = SD_CONTEXT_READ | ((NumberOfBlocks > 1U) ? SD_CONTEXT_MULTIBLOCK : 0U);
+
+    CLEAR_REG(hsd->Instance->DCTRL);
+    WRITE_REG(hsd->Instance->ICR, SDIO_ICR_STATIC);
+
+    hsd->hdmarx->Init.Direction = DMA_PERIPH_TO_MEMORY;
+    if ((HAL_DMA_Init(hsd->hdmarx) != HAL_OK) ||
+        (HAL_DMA_Start(hsd->hdmarx, (uint32_t)&hsd->Instance->FIFO, (uint32_t)pData,
+                       NumberOfBlocks * (SD_BLOCK_SIZE / 4U)) != HAL_OK)) {
+        hsd->ErrorCode = HAL_SD_ERROR_DMA;
+        hsd->Context = SD_CONTEXT_NONE;
+        hsd->State = HAL_SD_STATE_READY;
+        return HAL_ERROR;
+    }
+
+    WRITE_REG(hsd->Instance->DTIMER, hsd->DataTimeout);
+    WRITE_REG(hsd->Instance->DLEN, NumberOfBlocks * SD_BLOCK_SIZE);
+    WRITE_REG(hsd->Instance->MASK, SD_FLAGS_DATA_ERROR | SDIO_MASK_DATAENDIE);
+    WRITE_REG(hsd->Instance->DCTRL, SD_DCTRL_BLOCK_512 | SDIO_DCTRL_DTDIR | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN);
+
+    cmd = (NumberOfBlocks > 1U) ? SD_CMD_READ_MULT_BLOCK : SD_CMD_READ_SINGLE_BLOCK;
+    if (SD_SendCmdR1(hsd, cmd, SD_CardAddress(hsd, BlockAdd)) != HAL_OK) {
+        hsd->Context &= ~SD_CONTEXT_MULTIBLOCK;     /* the card never started, no CMD12 */
+        SD_EndTransfer(hsd);
+        return HAL_ERROR;
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Write blocks with DMA (CMD24, or ACMD23 + CMD25 + CMD12 for more than one)
+ * @note    ACMD23 tells the card how many blocks follow, so it can erase the whole range
+ *          up front instead of block by block. HAL_SD_TxCpltCallback() runs when the last
+ *          block has been acknowledged; the card then programs it (busy) for a while, see
+ *          HAL_SD_GetCardState().
+ * @param   pData - Word aligned, NumberOfBlocks * SD_BLOCK_SIZE bytes
+ * @param   BlockAdd - First block (always in blocks, also on SDSC cards)
+ * @param   NumberOfBlocks - 1 ~ SD_MAX_XFER_BLOCKS
+ */
+HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, const uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks)
+{
+    uint32_t cmd = SD_CMD_WRITE_SINGLE_BLOCK;
+
+    assert_param(IS_SD_XFER_BLOCKS(NumberOfBlocks));
+    assert_param(((uint32_t)pData & 3U) == 0U);
+
+    if (hsd->State != HAL_SD_STATE_READY) {
+        return HAL_BUSY;
+    }
+    if ((BlockAdd >= hsd->Card.BlockCount) || (NumberOfBlocks > (hsd->Card.BlockCount - BlockAdd))) {
+        hsd->ErrorCode = HAL_SD_ERROR_ADDRESS;
+        return HAL_ERROR;
+    }
+    hsd->State = HAL_SD_STATE_BUSY;
+    hsd->ErrorCode = HAL_SD_ERROR_NONE;
+    hsd->Context = SD_CONTEXT_WRITE;
+
+    CLEAR_REG(hsd->Instance->DCTRL);
+    WRITE_REG(hsd->Instance->ICR, SDIO_ICR_STATIC);
+
+    if (NumberOfBlocks > 1U)
+    {
+        /* Pre-erase hint, only valid for the next CMD25 */
+        if (SD_SendAppCmd(hsd, SD_ACMD_SET_WR_BLK_ERASE_COUNT, NumberOfBlocks, SD_RESP_SHORT) != HAL_OK) {
+            hsd->Context = SD_CONTEXT_NONE;
+            hsd->State = HAL_SD_STATE_READY;
+            return HAL_ERROR;
+        }
+        cmd = SD_CMD_WRITE_MULT_BLOCK;
+    }
+    if (SD_SendCmdR1(hsd, cmd, SD_CardAddress(hsd, BlockAdd)) != HAL_OK) {
+        hsd->Context = SD_CONTEXT_NONE;
+        hsd->State = HAL_SD_STATE_READY;
+        return HAL_ERROR;
+    }
+    if (NumberOfBlocks > 1U) {
+        hsd->Context |= SD_CONTEXT_MULTIBLOCK;
+    }
+
+    hsd->hdmatx->Init.Direction = DMA_MEMORY_TO_PERIPH;
+    if ((HAL_DMA_Init(hsd->hdmatx) != HAL_OK) ||
+        (HAL_DMA_Start(hsd->hdmatx, (uint32_t)pData, (uint32_t)&hsd->Instance->FIFO,
+                       NumberOfBlocks * (SD_BLOCK_SIZE / 4U)) != HAL_OK)) {
+        hsd->ErrorCode = HAL_SD_ERROR_DMA;
+        SD_EndTransfer(hsd);
+        return HAL_ERROR;
+    }
+
+    WRITE_REG(hsd->Instance->DTIMER, hsd->DataTimeout);
+    WRITE_REG(hsd->Instance->DLEN, NumberOfBlocks * SD_BLOCK_SIZE);
+    WRITE_REG(hsd->Instance->MASK, SD_FLAGS_DATA_ERROR | SDIO_MASK_DATAENDIE);
+    WRITE_REG(hsd->Instance->DCTRL, SD_DCTRL_BLOCK_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Stop a running transfer (CMD12 if the card is in a multi-block transfer)
+ * @note    No callback is called.
+ */
+HAL_StatusTypeDef HAL_SD_Abort(SD_HandleTypeDef *hsd)
+{
+    if (hsd->State != HAL_SD_STATE_BUSY) {
+        return HAL_OK;
+    }
+    CLEAR_REG(hsd->Instance->MASK);
+    SD_EndTransfer(hsd);
+
+    return HAL_OK;
+}
+
+/*------------------------------------------- Card management -------------------------------------------*/
+/**
+ * @brief   Erase a block range (CMD32 / CMD33 / CMD38)
+ * @note    Returns once the card has accepted CMD38, the erase itself runs in the card
+ *          (HAL_SD_CARD_PROGRAMMING) and can take seconds for large ranges. Erasing a log
+ *          area ahead of time keeps the erase out of the later writes.
+ * @param   BlockStart, BlockEnd - Inclusive range, in blocks
+ */
+HAL_StatusTypeDef HAL_SD_Erase(SD_HandleTypeDef *hsd, uint32_t BlockStart, uint32_t BlockEnd)
+{
+    if (hsd->State != HAL_SD_STATE_READY) {
+        return HAL_BUSY;
+    }
+    if ((BlockStart > BlockEnd) || (BlockEnd >= hsd->Card.BlockCount)) {
+        hsd->ErrorCode = HAL_SD_ERROR_ADDRESS;
+        return HAL_ERROR;
+    }
+    hsd->ErrorCode = HAL_SD_ERROR_NONE;
+
+    if ((SD_SendCmdR1(hsd, SD_CMD_ERASE_WR_BLK_START, SD_CardAddress(hsd, BlockStart)) != HAL_OK) ||
+        (SD_SendCmdR1(hsd, SD_CMD_ERASE_WR_BLK_END, SD_CardAddress(hsd, BlockEnd)) != HAL_OK) ||
+        (SD_SendCmdR1(hsd, SD_CMD_ERASE, 0U) != HAL_OK)) {
+        return HAL_ERROR;
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Read the card state with CMD13
+ * @note    Must not be called while a transfer is running (State == BUSY).
+ */
+HAL_SD_CardStateTypeDef HAL_SD_GetCardState(SD_HandleTypeDef *hsd)
+{
+    if (SD_SendCmdR1(hsd, SD_CMD_SEND_STATUS, hsd->Card.Rca << 16) != HAL_OK) {
+        return HAL_SD_CARD_ERROR;
+    }
+    return (HAL_SD_CardStateTypeDef)((hsd->Instance->RESP1 >> 9) & 0x0FU);
+}
+
+/**
+ * @brief   Wait until the transfer (if any) is done and the card is back in transfer state
+ * @param   Timeout - Maximum number of polls, shared by both waits: of the handle state
+ *                    while a transfer runs, then CMD13 polls (one poll ~ 2 us at 24 MHz)
+ * @retval  HAL_TIMEOUT with the transfer still running if it used up Timeout: it goes on
+ *          from the SDIO interrupt, ErrorCode is left to it
+ */
+HAL_StatusTypeDef HAL_SD_WaitCardReady(SD_HandleTypeDef *hsd, uint32_t Timeout)
+{
+    HAL_SD_CardStateTypeDef state;
+
+    while (hsd->State == HAL_SD_STATE_BUSY) {
+        /* ends from the SDIO interrupt */
+        if (Timeout-- == 0U) {
+            return HAL_TIMEOUT;
+        }
+    }
+    if (Timeout == 0U) {
+        Timeout = 1U;           /* one CMD13 at least, and --Timeout must not wrap */
+    }
+    if (hsd->ErrorCode != HAL_SD_ERROR_NONE) {
+        return HAL_ERROR;
+    }
+    do {
+        state = HAL_SD_GetCardState(hsd);
+        if (state == HAL_SD_CARD_TRANSFER) {
+            return HAL_OK;
+        }
+        if (state == HAL_SD_CARD_ERROR) {
+            return HAL_ERROR;
+        }
+    } while (--Timeout != 0U);
+
+    hsd->ErrorCode |= HAL_SD_ERROR_TIMEOUT;
+    return HAL_TIMEOUT;
+}
+
+/*------------------------------------------- IRQ -------------------------------------------*/
+/**
+ * @brief   Handle the SDIO interrupt, to be called from SDIO_IRQHandler
+ * @note    DATAEND (or a data error) ends the transfer: the DMA stream is stopped, which
+ *          flushes its FIFO to memory on reads, and CMD12 is sent for multi-block
+ *          transfers (a few us at the transfer clock).
+ */
+void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
+{
+    uint32_t sta = hsd->Instance->STA & hsd->Instance->MASK;
+    uint32_t context = hsd->Context;
+
+    if ((sta & (SD_FLAGS_DATA_ERROR | SDIO_STA_DATAEND)) == 0U) {
+        return;
+    }
+    CLEAR_REG(hsd->Instance->MASK);
+
+    if ((sta & SDIO_STA_DCRCFAIL) != 0U) { hsd->ErrorCode |= HAL_SD_ERROR_DATA_CRC_FAIL; }
+    if ((sta & SDIO_STA_DTIMEOUT) != 0U) { hsd->ErrorCode |= HAL_SD_ERROR_DATA_TIMEOUT; }
+    if ((sta & SDIO_STA_TXUNDERR) != 0U) { hsd->ErrorCode |= HAL_SD_ERROR_TX_UNDERRUN; }
+    if ((sta & SDIO_STA_RXOVERR) != 0U)  { hsd->ErrorCode |= HAL_SD_ERROR_RX_OVERRUN; }
+    if ((sta & SDIO_STA_STBITERR) != 0U) { hsd->ErrorCode |= HAL_SD_ERROR_START_BIT; }
+
+    SD_EndTransfer(hsd);
+
+    if (hsd->ErrorCode != HAL_SD_ERROR_NONE) {
+        HAL_SD_ErrorCallback(hsd);
+    }
+    else if ((context & SD_CONTEXT_READ) != 0U) {
+        HAL_SD_RxCpltCallback(hsd);
+    }
+    else {
+        HAL_SD_TxCpltCallback(hsd);
+    }
+}
+
+__weak void HAL_SD_TxCpltCallback(SD_HandleTypeDef *hsd)
+{
+    UNUSED(hsd);
+}
+
+__weak void HAL_SD_RxCpltCallback(SD_HandleTypeDef *hsd)
+{
+    UNUSED(hsd);
+}
+
+__weak void HAL_SD_ErrorCallback(SD_HandleTypeDef *hsd)
+{
+    UNUSED(hsd);
+}
+
+HAL_SD_StateTypeDef HAL_SD_GetState(SD_HandleTypeDef *hsd)
+{
+    return hsd->State;
+}
+
+uint32_t HAL_SD_GetError(SD_HandleTypeDef *hsd)
+{
+    return hsd->ErrorCode;
+}
+
+/*------------------------------------------- Private functions -------------------------------------------*/
+/* Send one command and wait for its response (or for CMDSENT with no response) */
+static HAL_StatusTypeDef SD_SendCmd(SD_HandleTypeDef *hsd, uint32_t Cmd, uint32_t Arg, uint32_t Resp)
+{
+    uint32_t timeout = SD_CMD_TIMEOUT;
+    uint32_t wait = (Resp & SD_RESP_LONG);
+    uint32_t done = (wait == SD_RESP_NONE) ? (SDIO_STA_CMDSENT | SDIO_STA_CTIMEOUT)
+                                           : (SDIO_STA_CMDREND | SDIO_STA_CCRCFAIL | SDIO_STA_CTIMEOUT);
+    uint32_t sta;
+
+    WRITE_REG(hsd->Instance->ICR, SD_FLAGS_CMD);
+    WRITE_REG(hsd->Instance->ARG, Arg);
+    WRITE_REG(hsd->Instance->CMD, Cmd | wait | SDIO_CMD_CPSMEN);
+
+    do {
+        sta = hsd->Instance->STA;
+        if (--timeout == 0U) {
+            hsd->ErrorCode |= HAL_SD_ERROR_TIMEOUT;
+            return HAL_TIMEOUT;
+        }
+    } while ((sta & done) == 0U);
+    WRITE_REG(hsd->Instance->ICR, SD_FLAGS_CMD);
+
+    if ((sta & SDIO_STA_CTIMEOUT) != 0U) {
+        hsd->ErrorCode |= HAL_SD_ERROR_CMD_RSP_TIMEOUT;
+        return HAL_ERROR;
+    }
+    if (((sta & SDIO_STA_CCRCFAIL) != 0U) && ((Resp & SD_RESP_NOCRC) == 0U)) {
+        hsd->ErrorCode |= HAL_SD_ERROR_CMD_CRC_FAIL;
+        return HAL_ERROR;
+    }
+
+    return HAL_OK;
+}
+
+/* Command with an R1 response: index echoed and no error bit in the card status */
+static HAL_StatusTypeDef SD_SendCmdR1(SD_HandleTypeDef *hsd, uint32_t Cmd, uint32_t Arg)
+{
+    if (SD_SendCmd(hsd, Cmd, Arg, SD_RESP_SHORT) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    if ((hsd->Instance->RESPCMD != Cmd) || ((hsd->Instance->RESP1 & SD_R1_ERRORBITS) != 0U)) {
+        hsd->ErrorCode |= HAL_SD_ERROR_CARD_STATUS;
+        return HAL_ERROR;
+    }
+
+    return HAL_OK;
+}
+
+/* CMD55 then the application command */
+static HAL_StatusTypeDef SD_SendAppCmd(SD_HandleTypeDef *hsd, uint32_t Acmd, uint32_t Arg, uint32_t Resp)
+{
+    if (SD_SendCmdR1(hsd, SD_CMD_APP_CMD, hsd->Card.Rca << 16) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    if (Resp == SD_RESP_SHORT) {
+        return SD_SendCmdR1(hsd, Acmd, Arg);
+    }
+    return SD_SendCmd(hsd, Acmd, Arg, Resp);
+}
+
+/*
+ * CK = PLL48CLK / (CLKDIV + 2), rounded down to at most Freq.
+ * PCLK2 must be >= 3/8 of CK for the APB side of the FIFO to keep up.
+ * Identification needs a free running clock, so power saving is only set afterwards.
+ */
+static HAL_StatusTypeDef SD_SetBusClock(SD_HandleTypeDef *hsd, uint32_t Freq, uint32_t BusWide, uint32_t PowerSave)
+{
+    uint32_t sdioclk = HAL_RCC_GetPLL48CLKFreq();
+    uint32_t pclk2 = HAL_RCC_GetPCLK2Freq();
+    uint32_t div;
+
+    if ((sdioclk == 0U) || (Freq == 0U)) {
+        hsd->ErrorCode |= HAL_SD_ERROR_CLOCK;
+        return HAL_ERROR;
+    }
+    if (Freq > SD_TRANSFER_CLOCK_MAX) {
+        Freq = SD_TRANSFER_CLOCK_MAX;
+    }
+    if (Freq > ((pclk2 / 3U) * 8U)) {
+        Freq = (pclk2 / 3U) * 8U;
+    }
+    div = (sdioclk + Freq - 1U) / Freq;
+    div = (div < 2U) ? 0U : (div - 2U);
+    if (div > (SDIO_CLKCR_CLKDIV_Msk >> SDIO_CLKCR_CLKDIV_Pos)) {
+        div = SDIO_CLKCR_CLKDIV_Msk >> SDIO_CLKCR_CLKDIV_Pos;
+    }
+
+    WRITE_REG(hsd->Instance->CLKCR, (div << SDIO_CLKCR_CLKDIV_Pos) | SDIO_CLKCR_CLKEN | BusWide | PowerSave);
+    hsd->Card.BusClock = sdioclk / (div + 2U);
+
+    return HAL_OK;
+}
+
+/* Identification: CMD0, CMD8, ACMD41 loop, CMD2, CMD3, CMD9, CMD7 (+ CMD16 on SDSC) */
+static HAL_StatusTypeDef SD_Identify(SD_HandleTypeDef *hsd)
+{
+    uint32_t trials = SD_MAX_VOLT_TRIAL;
+    uint32_t hcs = 0U;
+    uint32_t ocr;
+
+    hsd->Card.Rca = 0U;
+    if (SD_SendCmd(hsd, SD_CMD_GO_IDLE_STATE, 0U, SD_RESP_NONE) != HAL_OK) {
+        return HAL_ERROR;
+    }
+
+    /* Version 2.00+ cards echo the pattern; a timeout means version 1.x (SDSC only) */
+    if (SD_SendCmd(hsd, SD_CMD_SEND_IF_COND, SD_CHECK_PATTERN, SD_RESP_SHORT) == HAL_OK) {
+        if ((hsd->Instance->RESP1 & 0xFFFU) != SD_CHECK_PATTERN) {
+            hsd->ErrorCode |= HAL_SD_ERROR_UNSUPPORTED;
+            return HAL_ERROR;
+        }
+        hcs = SD_OCR_HCS;
+    }
+    hsd->ErrorCode = HAL_SD_ERROR_NONE;
+
+    do {
+        if (SD_SendAppCmd(hsd, SD_ACMD_SD_SEND_OP_COND, SD_OCR_VOLTAGE_WINDOW | hcs,
+                          SD_RESP_SHORT | SD_RESP_NOCRC) != HAL_OK) {
+            hsd->ErrorCode |= HAL_SD_ERROR_UNSUPPORTED;
+            return HAL_ERROR;
+        }
+        ocr = hsd->Instance->RESP1;
+        if (--trials == 0U) {
+            hsd->ErrorCode |= HAL_SD_ERROR_UNSUPPORTED;
+            return HAL_ERROR;
+        }
+    } while ((ocr & SD_OCR_BUSY) == 0U);
+    hsd->Card.CardType = ((ocr & SD_OCR_HCS) != 0U) ? SD_CARD_SDHC_SDXC : SD_CARD_SDSC;
+
+    if (SD_SendCmd(hsd, SD_CMD_ALL_SEND_CID, 0U, SD_RESP_LONG) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    hsd->Card.Cid[0] = hsd->Instance->RESP1;
+    hsd->Card.Cid[1] = hsd->Instance->RESP2;
+    hsd->Card.Cid[2] = hsd->Instance->RESP3;
+    hsd->Card.Cid[3] = hsd->Instance->RESP4;
+
+    /* R6: new RCA in the upper half */
+    if (SD_SendCmd(hsd, SD_CMD_SEND_REL_ADDR, 0U, SD_RESP_SHORT) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    hsd->Card.Rca = hsd->Instance->RESP1 >> 16;
+
+    if (SD_SendCmd(hsd, SD_CMD_SEND_CSD, hsd->Card.Rca << 16, SD_RESP_LONG) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    hsd->Card.Csd[0] = hsd->Instance->RESP1;
+    hsd->Card.Csd[1] = hsd->Instance->RESP2;
+    hsd->Card.Csd[2] = hsd->Instance->RESP3;
+    hsd->Card.Csd[3] = hsd->Instance->RESP4;
+    SD_ParseCsd(hsd);
+
+    if (SD_SendCmdR1(hsd, SD_CMD_SEL_DESEL_CARD, hsd->Card.Rca << 16) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    if (hsd->Card.CardType == SD_CARD_SDSC) {
+        return SD_SendCmdR1(hsd, SD_CMD_SET_BLOCKLEN, SD_BLOCK_SIZE);
+    }
+
+    return HAL_OK;
+}
+
+/* Capacity from the CSD, version 1.0 (SDSC) or 2.0 (SDHC/SDXC) layout */
+static void SD_ParseCsd(SD_HandleTypeDef *hsd)
+{
+    const uint32_t *csd = hsd->Card.Csd;
+    uint32_t csize, mult, bllen;
+
+    if ((csd[0] >> 30) != 0U)
+    {
+        /* C_SIZE [69:48], 512 KB units */
+        csize = ((csd[1] & 0x3FU) << 16) | (csd[2] >> 16);
+        hsd->Card.BlockCount = (csize + 1U) * 1024U;
+    }
+    else
+    {
+        /* (C_SIZE [73:62] + 1) * 2^(C_SIZE_MULT [49:47] + 2) blocks of 2^READ_BL_LEN [83:80] */
+        csize = ((csd[1] & 0x3FFU) << 2) | (csd[2] >> 30);
+        mult = (csd[2] >> 15) & 0x7U;
+        bllen = (csd[1] >> 16) & 0xFU;
+        hsd->Card.BlockCount = ((csize + 1U) << (mult + 2U)) << (bllen - 9U);
+    }
+}
+
+static uint32_t SD_CardAddress(SD_HandleTypeDef *hsd, uint32_t BlockAdd)
+{
+    return (hsd->Card.CardType == SD_CARD_SDSC) ? (BlockAdd * SD_BLOCK_SIZE) : BlockAdd;
+}
+
+/*
+ * Common end of a transfer: stop the data path and the stream (on reads this flushes
+ * the DMA FIFO to memory), stop the card, back to READY.
+ */
+static void SD_EndTransfer(SD_HandleTypeDef *hsd)
+{
+    DMA_HandleTypeDef *hdma = ((hsd->Context & SD_CONTEXT_READ) != 0U) ? hsd->hdmarx : hsd->hdmatx;
+    uint32_t timeout = SD_STOP_TIMEOUT;
+
+    CLEAR_REG(hsd->Instance->DCTRL);
+    if (HAL_DMA_Abort(hdma) != HAL_OK) {
+        hsd->ErrorCode |= HAL_SD_ERROR_DMA;
+    }
+    while (((hsd->Instance->STA & SDIO_STA_CMDACT) != 0U) && (--timeout != 0U)) {
+    }
+    if ((hsd->Context & SD_CONTEXT_MULTIBLOCK) != 0U) {
+        (void)SD_SendCmd(hsd, SD_CMD_STOP_TRANSMISSION, 0U, SD_RESP_SHORT);
+    }
+    WRITE_REG(hsd->Instance->ICR, SDIO_ICR_STATIC);
+
+    hsd->Context = SD_CONTEXT_NONE;
+    hsd->State = HAL_SD_STATE_READY;
+}
+
+/* Busy wait, only used at power up */
+static void SD_Delay(uint32_t Microseconds)
+{
+    __IO uint32_t count = (HAL_RCC_GetHCLKFreq() / 4000000U) * Microseconds;
+
+    while (count != 0U) {
+        count--;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,605 @@
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief: Private functions
+ */
+static void TIM_Base_SetConfig(TIM_TypeDef *TIMx, const TIM_Base_InitTypeDef *Structure);
+static void TIM_OC_SetConfig(TIM_TypeDef *TIMx, const TIM_OC_InitTypeDef *OC_Config, uint32_t Channel, uint32_t CCMRxBits);
+static void TIM_CCxChannelCmd(TIM_TypeDef *TIMx, uint32_t Channel, uint32_t CCxBits, uint32_t Enable);
+static void TIM_DisableIfIdle(TIM_HandleTypeDef *htim);
+static uint32_t TIM_DMA_GetId(uint32_t BurstRequestSrc);
+static void TIM_DMABurstCplt(DMA_HandleTypeDef *hdma);
+static void TIM_DMABurstHalfCplt(DMA_HandleTypeDef *hdma);
+static void TIM_DMAError(DMA_HandleTypeDef *hdma);
+
+/**
+ * @brief   CCMR1/CCMR2 holding the channel, and the channel's offset inside it (0 or 8)
+ */
+#define TIM_CCMR(TIMx, CHANNEL)         (((CHANNEL) < TIM_CHANNEL_3) ? &(TIMx)->CCMR1 : &(TIMx)->CCMR2)
+#define TIM_CCMR_SHIFT(CHANNEL)         (((CHANNEL) & 0x4U) << 1U)
+/* CCxIE / CCxDE for a channel */
+#define TIM_CHANNEL_IT(CHANNEL)         (TIM_DIER_CC1IE << ((CHANNEL) >> 2U))
+
+/*------------------------------------------- Time base -------------------------------------------*/
+/**
+ * @brief   Initialize the time base of a timer according to htim->Init
+ * @note    The timer clock must be enabled before (__HAL_RCC_TIMx_CLK_ENABLE()).
+ *          Counter is left stopped.
+ * @param   htim - TIM handle
+ * @retval  HAL status
+ */
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim)
+{
+    if (htim == NULL) {
+        return HAL_ERROR;
+    }
+    assert_param(IS_TIM_INSTANCE(htim->Instance));
+
+    TIM_Base_SetConfig(htim->Instance, &htim->Init);
+    htim->Channel = HAL_TIM_ACTIVE_CHANNEL_CLEARED;
+    htim->State = HAL_TIM_STATE_READY;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_DeInit(TIM_HandleTypeDef *htim)
+{
+    if (htim == NULL) {
+        return HAL_ERROR;
+    }
+    CLEAR_REG(htim->Instance->DIER);
+    __HAL_TIM_DISABLE(htim);
+    htim->State = HAL_TIM_STATE_RESET;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim)
+{
+    if (htim->State == HAL_TIM_STATE_RESET) {
+        return HAL_ERROR;
+    }
+    __HAL_TIM_ENABLE(htim);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop(TIM_HandleTypeDef *htim)
+{
+    /* The counter keeps running for the channels still enabled */
+    if (!__HAL_TIM_CHANNELS_ACTIVE(htim)) {
+        __HAL_TIM_DISABLE(htim);
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim)
+{
+    if (htim->State == HAL_TIM_STATE_RESET) {
+        return HAL_ERROR;
+    }
+    __HAL_TIM_ENABLE_IT(htim, TIM_IT_UPDATE);
+    __HAL_TIM_ENABLE(htim);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim)
+{
+    __HAL_TIM_DISABLE_IT(htim, TIM_IT_UPDATE);
+    if (!__HAL_TIM_CHANNELS_ACTIVE(htim)) {
+        __HAL_TIM_DISABLE(htim);
+    }
+    return HAL_OK;
+}
+
+/*------------------------------------------- Output compare -------------------------------------------*/
+/**
+ * @brief   Configure a channel in output compare mode
+ * @note    The channel output is disabled while it is reconfigured, HAL_TIM_OC_Start() enables it.
+ * @param   sConfig - Output compare configuration
+ * @param   Channel - TIM_CHANNEL_1 ~ TIM_CHANNEL_4
+ */
+HAL_StatusTypeDef HAL_TIM_OC_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *sConfig, uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    TIM_OC_SetConfig(htim->Instance, sConfig, Channel, 0U);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_OC_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    TIM_CCxChannelCmd(htim->Instance, Channel, TIM_CCER_CC1E, 1U);
+    /* Advanced timers gate all outputs with MOE */
+    if (IS_TIM_ADVANCED_INSTANCE(htim->Instance)) {
+        __HAL_TIM_MOE_ENABLE(htim);
+    }
+    __HAL_TIM_ENABLE(htim);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_OC_Stop(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    TIM_CCxChannelCmd(htim->Instance, Channel, TIM_CCER_CC1E, 0U);
+    TIM_DisableIfIdle(htim);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_OC_Start_IT(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    __HAL_TIM_ENABLE_IT(htim, TIM_CHANNEL_IT(Channel));
+    return HAL_TIM_OC_Start(htim, Channel);
+}
+
+HAL_StatusTypeDef HAL_TIM_OC_Stop_IT(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    __HAL_TIM_DISABLE_IT(htim, TIM_CHANNEL_IT(Channel));
+    return HAL_TIM_OC_Stop(htim, Channel);
+}
+
+/*------------------------------------------- PWM -------------------------------------------*/
+/**
+ * @brief   Configure a channel in PWM mode
+ * @note    CCRx preload is enabled, so a new compare value (from the CPU or a DMA burst)
+ *          only takes effect at the next update event and a period is never cut short.
+ *          On TIM1/TIM8 the complementary output uses OCNPolarity/OCNIdleState; dead-time
+ *          is set with HAL_TIMEx_ConfigBreakDeadTime().
+ */
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *sConfig, uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+    assert_param((sConfig->OCMode == TIM_OCMODE_PWM1) || (sConfig->OCMode == TIM_OCMODE_PWM2));
+
+    TIM_OC_SetConfig(htim->Instance, sConfig, Channel, TIM_CCMR1_OC1PE | sConfig->OCFastMode);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    return HAL_TIM_OC_Start(htim, Channel);
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Stop(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    return HAL_TIM_OC_Stop(htim, Channel);
+}
+
+/**
+ * @brief   Enable the complementary output CHxN of TIM1/TIM8 (channels 1 ~ 3)
+ */
+HAL_StatusTypeDef HAL_TIMEx_PWMN_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    assert_param(IS_TIM_ADVANCED_INSTANCE(htim->Instance));
+    assert_param(IS_TIM_COMPLEMENTARY_CHANNELS(Channel));
+
+    TIM_CCxChannelCmd(htim->Instance, Channel, TIM_CCER_CC1NE, 1U);
+    __HAL_TIM_MOE_ENABLE(htim);
+    __HAL_TIM_ENABLE(htim);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIMEx_PWMN_Stop(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    assert_param(IS_TIM_ADVANCED_INSTANCE(htim->Instance));
+    assert_param(IS_TIM_COMPLEMENTARY_CHANNELS(Channel));
+
+    TIM_CCxChannelCmd(htim->Instance, Channel, TIM_CCER_CC1NE, 0U);
+    TIM_DisableIfIdle(htim);
+    return HAL_OK;
+}
+
+/**
+ * @brief   Configure break input, lock level, off-states and dead-time of TIM1/TIM8
+ * @note    Writes BDTR once and keeps MOE; with a lock level set the locked fields
+ *          can only be written once after reset.
+ */
+HAL_StatusTypeDef HAL_TIMEx_ConfigBreakDeadTime(TIM_HandleTypeDef *htim, const TIM_BreakDeadTimeConfigTypeDef *sBreakDeadTimeConfig)
+{
+    uint32_t bdtr;
+
+    assert_param(IS_TIM_ADVANCED_INSTANCE(htim->Instance));
+    assert_param(sBreakDeadTimeConfig->DeadTime <= 0xFFU);
+
+    bdtr = sBreakDeadTimeConfig->DeadTime | sBreakDeadTimeConfig->LockLevel |
+           sBreakDeadTimeConfig->OffStateIDLEMode | sBreakDeadTimeConfig->OffStateRunMode |
+           sBreakDeadTimeConfig->BreakState | sBreakDeadTimeConfig->BreakPolarity |
+           sBreakDeadTimeConfig->AutomaticOutput;
+    MODIFY_REG(htim->Instance->BDTR, TIM_BDTR_DTG | TIM_BDTR_LOCK | TIM_BDTR_OSSI | TIM_BDTR_OSSR |
+               TIM_BDTR_BKE | TIM_BDTR_BKP | TIM_BDTR_AOE, bdtr);
+    return HAL_OK;
+}
+
+/**
+ * @brief   Convert a dead-time in tDTS ticks to the DTG field, rounded up
+ * @note    tDTS = 1 / (timer clock >> ClockDivision). DTG has four ranges:
+ *          0 ~ 127 step 1, 128 ~ 254 step 2, 256 ~ 504 step 8, 512 ~ 1008 step 16.
+ *          Longer dead-times saturate at 1008 ticks.
+ * @param   DeadTimeTicks - Dead-time in tDTS ticks
+ * @retval  Value for TIM_BreakDeadTimeConfigTypeDef.DeadTime
+ */
+uint32_t HAL_TIMEx_DeadTimeEncode(uint32_t DeadTimeTicks)
+{
+    if (DeadTimeTicks <= 127U) {
+        return DeadTimeTicks;
+    }
+    if (DeadTimeTicks <= 254U) {
+        return 0x80U | (((DeadTimeTicks + 1U) >> 1U) - 64U);
+    }
+    if (DeadTimeTicks <= 504U) {
+        return 0xC0U | (((DeadTimeTicks + 7U) >> 3U) - 32U);
+    }
+    if (DeadTimeTicks <= 1008U) {
+        return 0xE0U | (((DeadTimeTicks + 15U) >> 4U) - 32U);
+    }
+    return 0xFFU;
+}
+
+/*------------------------------------------- Master mode -------------------------------------------*/
+/**
+ * @brief   Select the event output on TRGO
+ * @note    TIM_TRGO_UPDATE turns the timer into a sample clock for the ADC/DAC
+ *          external triggers (TIM6/TIM7 have no channels and exist for this).
+ * @param   MasterOutputTrigger - See @ref TIM_Master_Mode_Selection
+ */
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, uint32_t MasterOutputTrigger)
+{
+    assert_param((MasterOutputTrigger & ~TIM_CR2_MMS) == 0U);
+
+    MODIFY_REG(htim->Instance->CR2, TIM_CR2_MMS, MasterOutputTrigger);
+    return HAL_OK;
+}
+
+/*------------------------------------------- Input capture -------------------------------------------*/
+/**
+ * @brief   Configure a channel in input capture mode
+ * @param   sConfig - Input capture configuration
+ * @param   Channel - TIM_CHANNEL_1 ~ TIM_CHANNEL_4
+ */
+HAL_StatusTypeDef HAL_TIM_IC_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_IC_InitTypeDef *sConfig, uint32_t Channel)
+{
+    TIM_TypeDef *TIMx = htim->Instance;
+    uint32_t shift = TIM_CCMR_SHIFT(Channel);
+
+    assert_param(IS_TIM_CHANNELS(Channel));
+    assert_param(sConfig->ICFilter <= 0xFU);
+
+    /* CCxS is only writable while the channel is off */
+    CLEAR_BIT(TIMx->CCER, TIM_CCER_CC1E << Channel);
+    MODIFY_REG(*TIM_CCMR(TIMx, Channel),
+               (TIM_CCMR1_CC1S | TIM_CCMR1_IC1PSC | TIM_CCMR1_IC1F) << shift,
+               (sConfig->ICSelection | sConfig->ICPrescaler | (sConfig->ICFilter << TIM_CCMR1_IC1F_Pos)) << shift);
+    MODIFY_REG(TIMx->CCER, (TIM_CCER_CC1P | TIM_CCER_CC1NP) << Channel, sConfig->ICPolarity << Channel);
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_IC_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    TIM_CCxChannelCmd(htim->Instance, Channel, TIM_CCER_CC1E, 1U);
+    __HAL_TIM_ENABLE(htim);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_IC_Stop(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    TIM_CCxChannelCmd(htim->Instance, Channel, TIM_CCER_CC1E, 0U);
+    TIM_DisableIfIdle(htim);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_IC_Start_IT(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    __HAL_TIM_ENABLE_IT(htim, TIM_CHANNEL_IT(Channel));
+    return HAL_TIM_IC_Start(htim, Channel);
+}
+
+HAL_StatusTypeDef HAL_TIM_IC_Stop_IT(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    __HAL_TIM_DISABLE_IT(htim, TIM_CHANNEL_IT(Channel));
+    return HAL_TIM_IC_Stop(htim, Channel);
+}
+
+uint32_t HAL_TIM_ReadCapturedValue(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    return __HAL_TIM_GET_COMPARE(htim, Channel);
+}
+
+/*------------------------------------------- DMA burst -------------------------------------------*/
+/**
+ * @brief   Write BurstLength consecutive timer registers from memory on every DMA request
+ * @note    Typical use: all four compare values per PWM period with one request,
+ *              HAL_TIM_DMABurst_WriteStart(&htim1, TIM_DMABASE_CCR1, TIM_DMA_UPDATE,
+ *                                          table, TIM_DMABURSTLENGTH_4TRANSFERS, periods);
+ *          The DMA handle must be linked to htim->hdma[] for the request source
+ *          (__HAL_LINKDMA) and initialized memory-to-peripheral, memory increment,
+ *          word data sizes. In DMA_CIRCULAR mode the table is replayed forever and
+ *          HAL_TIM_DMABurstHalfCpltCallback() tells which half may be refilled.
+ *          Update request mapping: TIM1_UP DMA2 Stream5 Ch6, TIM8_UP DMA2 Stream1 Ch7,
+ *          TIM2_UP DMA1 Stream1/7 Ch3, TIM3_UP DMA1 Stream2 Ch5, TIM4_UP DMA1 Stream6 Ch2,
+ *          TIM5_UP DMA1 Stream0/6 Ch6.
+ * @param   BurstBaseAddress - First register written, see @ref TIM_DMA_Base_address
+ * @param   BurstRequestSrc - TIM_DMA_UPDATE, TIM_DMA_CC1 ~ TIM_DMA_CC4
+ * @param   BurstBuffer - BurstLength words per request, BurstCount requests
+ * @param   BurstLength - See @ref TIM_DMA_Burst_Length
+ * @param   BurstCount - Number of requests covered by BurstBuffer
+ * @retval  HAL status
+ */
+HAL_StatusTypeDef HAL_TIM_DMABurst_WriteStart(TIM_HandleTypeDef *htim, uint32_t BurstBaseAddress, uint32_t BurstRequestSrc,
+                                              const uint32_t *BurstBuffer, uint32_t BurstLength, uint32_t BurstCount)
+{
+    uint32_t dma_id = TIM_DMA_GetId(BurstRequestSrc);
+    uint32_t length = ((BurstLength >> TIM_DCR_DBL_Pos) + 1U) * BurstCount;
+    DMA_HandleTypeDef *hdma;
+
+    assert_param(IS_TIM_DMABURST_INSTANCE(htim->Instance));
+    assert_param(IS_TIM_DMA_BASE(BurstBaseAddress));
+    assert_param(IS_TIM_DMA_LENGTH(BurstLength));
+
+    if ((dma_id >= TIM_DMA_ID_MAX) || (BurstBuffer == NULL) || (htim->hdma[dma_id] == NULL)) {
+        return HAL_ERROR;
+    }
+    hdma = htim->hdma[dma_id];
+
+    hdma->Parent = htim;
+    hdma->XferCpltCallback = TIM_DMABurstCplt;
+    /* Half transfer interrupt only matters when the table is replayed */
+    hdma->XferHalfCpltCallback = (hdma->Init.Mode == DMA_CIRCULAR) ? TIM_DMABurstHalfCplt : NULL;
+    hdma->XferErrorCallback = TIM_DMAError;
+
+    WRITE_REG(htim->Instance->DCR, BurstBaseAddress | BurstLength);
+    if (HAL_DMA_Start_IT(hdma, (uint32_t)BurstBuffer, (uint32_t)&htim->Instance->DMAR, length) != HAL_OK) {
+        return HAL_BUSY;
+    }
+    __HAL_TIM_ENABLE_DMA(htim, BurstRequestSrc);
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_DMABurst_WriteStop(TIM_HandleTypeDef *htim, uint32_t BurstRequestSrc)
+{
+    uint32_t dma_id = TIM_DMA_GetId(BurstRequestSrc);
+
+    if ((dma_id >= TIM_DMA_ID_MAX) || (htim->hdma[dma_id] == NULL)) {
+        return HAL_ERROR;
+    }
+    __HAL_TIM_DISABLE_DMA(htim, BurstRequestSrc);
+    return HAL_DMA_Abort(htim->hdma[dma_id]);
+}
+
+/*------------------------------------------- IRQ -------------------------------------------*/
+/**
+ * @brief   Handle a timer interrupt, to be called from TIMx_IRQHandler
+ * @note    SR is read once, only the enabled events are handled and they are cleared
+ *          in one write before the callbacks run, so an event raised again from a
+ *          callback is not lost.
+ */
+void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim)
+{
+    TIM_TypeDef *TIMx = htim->Instance;
+    /* Interrupt enable bits 0..7 line up with the status flags */
+    uint32_t pending = TIMx->SR & TIMx->DIER & 0xFFU;
+    uint32_t ch;
+
+    if (pending == 0U) {
+        return;
+    }
+    WRITE_REG(TIMx->SR, ~pending);
+
+    for (ch = 0U; ch < 4U; ch++)
+    {
+        if ((pending & (TIM_SR_CC1IF << ch)) != 0U)
+        {
+            uint32_t channel = ch << 2U;
+
+            htim->Channel = (HAL_TIM_ActiveChannel)(1U << ch);
+            if ((*TIM_CCMR(TIMx, channel) & (TIM_CCMR1_CC1S << TIM_CCMR_SHIFT(channel))) != 0U) {
+                HAL_TIM_IC_CaptureCallback(htim);
+            }
+            else {
+                HAL_TIM_OC_DelayElapsedCallback(htim);
+            }
+            htim->Channel = HAL_TIM_ACTIVE_CHANNEL_CLEARED;
+        }
+    }
+
+    if ((pending & TIM_SR_UIF) != 0U) {
+        HAL_TIM_PeriodElapsedCallback(htim);
+    }
+    if ((pending & TIM_SR_BIF) != 0U) {
+        HAL_TIMEx_BreakCallback(htim);
+    }
+    if ((pending & TIM_SR_TIF) != 0U) {
+        HAL_TIM_TriggerCallback(htim);
+    }
+}
+
+__weak void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+    UNUSED(htim);
+}
+
+__weak void HAL_TIM_OC_DelayElapsedCallback(TIM_HandleTypeDef *htim)
+{
+    UNUSED(htim);
+}
+
+__weak void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim)
+{
+    UNUSED(htim);
+}
+
+__weak void HAL_TIM_TriggerCallback(TIM_HandleTypeDef *htim)
+{
+    UNUSED(htim);
+}
+
+__weak void HAL_TIMEx_BreakCallback(TIM_HandleTypeDef *htim)
+{
+    UNUSED(htim);
+}
+
+__weak void HAL_TIM_DMABurstHalfCpltCallback(TIM_HandleTypeDef *htim)
+{
+    UNUSED(htim);
+}
+
+__weak void HAL_TIM_DMABurstCpltCallback(TIM_HandleTypeDef *htim)
+{
+    UNUSED(htim);
+}
+
+__weak void HAL_TIM_ErrorCallback(TIM_HandleTypeDef *htim)
+{
+    UNUSED(htim);
+}
+
+HAL_TIM_StateTypeDef HAL_TIM_GetState(TIM_HandleTypeDef *htim)
+{
+    return htim->State;
+}
+
+/**
+ * @brief   Kernel clock of a timer (before PSC)
+ * @note    Timers run at PCLKx when the APB prescaler is 1, at 2 x PCLKx otherwise.
+ */
+uint32_t HAL_TIM_GetClockFreq(TIM_TypeDef *TIMx)
+{
+    uint32_t ppre, pclk;
+
+    assert_param(IS_TIM_INSTANCE(TIMx));
+
+    if (IS_TIM_APB2_INSTANCE(TIMx)) {
+        ppre = _FLD2VAL(RCC_CFGR_PPRE2, RCC->CFGR);
+        pclk = HAL_RCC_GetPCLK2Freq();
+    }
+    else {
+        ppre = _FLD2VAL(RCC_CFGR_PPRE1, RCC->CFGR);
+        pclk = HAL_RCC_GetPCLK1Freq();
+    }
+    /* PPREx = 0xx -> APB not divided */
+    return ((ppre & 0x4U) == 0U) ? pclk : (pclk * 2U);
+}
+
+/*---------------------------------- Private functions ----------------------------------*/
+static void TIM_Base_SetConfig(TIM_TypeDef *TIMx, const TIM_Base_InitTypeDef *Structure)
+{
+    /* DIR/CMS are ignored by the timers that only count up */
+    MODIFY_REG(TIMx->CR1, TIM_CR1_DIR | TIM_CR1_CMS | TIM_CR1_CKD | TIM_CR1_ARPE,
+               Structure->CounterMode | Structure->ClockDivision | Structure->AutoReloadPreload);
+    WRITE_REG(TIMx->ARR, Structure->Period);
+    WRITE_REG(TIMx->PSC, Structure->Prescaler);
+    if (IS_TIM_ADVANCED_INSTANCE(TIMx)) {
+        WRITE_REG(TIMx->RCR, Structure->RepetitionCounter);
+    }
+
+    /* PSC (and RCR) are preloaded: force an update to load them now,
+       then drop the UIF it raised so enabling the update interrupt doesn't fire at once */
+    WRITE_REG(TIMx->EGR, TIM_EGR_UG);
+    WRITE_REG(TIMx->SR, (uint32_t)~TIM_SR_UIF);
+}
+
+/**
+ * @brief   Common output compare / PWM channel setup
+ * @param   CCMRxBits - Extra CCMR bits in channel 1 position (OC1PE, OC1FE)
+ */
+static void TIM_OC_SetConfig(TIM_TypeDef *TIMx, const TIM_OC_InitTypeDef *OC_Config, uint32_t Channel, uint32_t CCMRxBits)
+{
+    uint32_t shift = TIM_CCMR_SHIFT(Channel);
+    uint32_t ccer = OC_Config->OCPolarity;
+
+    /* Output off while the mode changes */
+    CLEAR_BIT(TIMx->CCER, (TIM_CCER_CC1E | TIM_CCER_CC1NE) << Channel);
+
+    MODIFY_REG(*TIM_CCMR(TIMx, Channel),
+               (TIM_CCMR1_CC1S | TIM_CCMR1_OC1FE | TIM_CCMR1_OC1PE | TIM_CCMR1_OC1M | TIM_CCMR1_OC1CE) << shift,
+               (OC_Config->OCMode | CCMRxBits) << shift);
+
+    if (IS_TIM_ADVANCED_INSTANCE(TIMx))
+    {
+        if (Channel != TIM_CHANNEL_4) {
+            ccer |= OC_Config->OCNPolarity;
+            MODIFY_REG(TIMx->CR2, (TIM_CR2_OIS1 | TIM_CR2_OIS1N) << (Channel >> 1U),
+                       (OC_Config->OCIdleState | OC_Config->OCNIdleState) << (Channel >> 1U));
+        }
+        else {
+            MODIFY_REG(TIMx->CR2, TIM_CR2_OIS4, OC_Config->OCIdleState << (Channel >> 1U));
+        }
+    }
+    MODIFY_REG(TIMx->CCER, (TIM_CCER_CC1P | TIM_CCER_CC1NP) << Channel, ccer << Channel);
+
+    *(&TIMx->CCR1 + (Channel >> 2U)) = OC_Config->Pulse;
+}
+
+static void TIM_CCxChannelCmd(TIM_TypeDef *TIMx, uint32_t Channel, uint32_t CCxBits, uint32_t Enable)
+{
+    if (Enable != 0U) {
+        SET_BIT(TIMx->CCER, CCxBits << Channel);
+    }
+    else {
+        CLEAR_BIT(TIMx->CCER, CCxBits << Channel);
+    }
+}
+
+/**
+ * @brief   Once the last channel is off, gate the outputs (MOE) and stop the counter
+ * @note    As long as any CCxE / CCxNE is still set, both are left alone: the other
+ *          channels of the timer keep running.
+ */
+static void TIM_DisableIfIdle(TIM_HandleTypeDef *htim)
+{
+    if (__HAL_TIM_CHANNELS_ACTIVE(htim)) {
+        return;
+    }
+    if (IS_TIM_ADVANCED_INSTANCE(htim->Instance)) {
+        __HAL_TIM_MOE_DISABLE(htim);
+    }
+    __HAL_TIM_DISABLE(htim);
+}
+
+static uint32_t TIM_DMA_GetId(uint32_t BurstRequestSrc)
+{
+    switch (BurstRequestSrc)
+    {
+        case TIM_DMA_UPDATE:    return TIM_DMA_ID_UPDATE;
+        case TIM_DMA_CC1:       return TIM_DMA_ID_CC1;
+        case TIM_DMA_CC2:       return TIM_DMA_ID_CC2;
+        case TIM_DMA_CC3:       return TIM_DMA_ID_CC3;
+        case TIM_DMA_CC4:       return TIM_DMA_ID_CC4;
+        default:                return TIM_DMA_ID_MAX;
+    }
+}
+
+static void TIM_DMABurstCplt(DMA_HandleTypeDef *hdma)
+{
+    HAL_TIM_DMABurstCpltCallback((TIM_HandleTypeDef *)hdma->Parent);
+}
+
+static void TIM_DMABurstHalfCplt(DMA_HandleTypeDef *hdma)
+{
+    HAL_TIM_DMABurstHalfCpltCallback((TIM_HandleTypeDef *)hdma->Parent);
+}
+
+static void TIM_DMAError(DMA_HandleTypeDef *hdma)
+{
+    TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)hdma->Parent;
+
+    htim->State = HAL_TIM_STATE_ERROR;
+    HAL_TIM_ErrorCallback(htim);
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+#ifndef _ATOMIC_H_
+#define _ATOMIC_H_
+
+/**
+ * @brief   Lock-free atomics and memory barriers
+ * @note    On the Cortex-M4 every read-modify-write is an LDREX/STREX retry loop: an
+ *          exception taken between the two clears the exclusive monitor, the STREX
+ *          fails and the update is redone, so these are safe between thread mode and
+ *          interrupts of any priority without masking anything. A failed compare
+ *          releases the monitor with CLREX.
+ *
+ *          Ordering: ATOMIC_Load() is an acquire, ATOMIC_Store() a release and every
+ *          read-modify-write is sequentially consistent (DMB on both sides).
+ *
+ *          Built for anything other than ARMv7-M (or with ATOMIC_HOST defined) the same
+ *          API maps onto C11 <stdatomic.h> (C++23 <stdatomic.h> in C++), so code using it
+ *          can be exercised with real threads on the host.
+ */
+
+#include <stdint.h>
+
+#if !defined(ATOMIC_HOST) && (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__))
+#define ATOMIC_EXCLUSIVE        1
+#include "stm32f4xx_hal.h"
+#else
+#define ATOMIC_EXCLUSIVE        0
+#include <stdatomic.h>
+#endif
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#if ATOMIC_EXCLUSIVE
+typedef volatile uint32_t ATOMIC_U32TypeDef;
+#else
+typedef _Atomic(uint32_t) ATOMIC_U32TypeDef;
+#endif
+
+/**
+ * @brief: Atomic flag, 0 = clear
+ */
+typedef ATOMIC_U32TypeDef ATOMIC_FlagTypeDef;
+
+#define ATOMIC_INIT(VALUE)      (VALUE)
+
+/*------------------------------ Barriers ----------------------------------*/
+#if ATOMIC_EXCLUSIVE
+
+/* Keep the compiler from moving memory accesses across this point */
+#define ATOMIC_CompilerBarrier()    __ASM volatile ("" ::: "memory")
+/* Order memory accesses (DMB) */
+#define ATOMIC_MemoryBarrier()      __DMB()
+/* Complete memory accesses before the next instruction (DSB), e.g. before WFI or after a
+   write that disables a peripheral interrupt */
+#define ATOMIC_DataSyncBarrier()    __DSB()
+/* Flush the pipeline (ISB), e.g. after changing CONTROL, VTOR or the MPU */
+#define ATOMIC_InstrSyncBarrier()   __ISB()
+
+#else
+
+#define ATOMIC_CompilerBarrier()    atomic_signal_fence(memory_order_seq_cst)
+#define ATOMIC_MemoryBarrier()      atomic_thread_fence(memory_order_seq_cst)
+#define ATOMIC_DataSyncBarrier()    atomic_thread_fence(memory_order_seq_cst)
+#define ATOMIC_InstrSyncBarrier()   atomic_thread_fence(memory_order_seq_cst)
+
+#endif
+
+/*------------------------------ Atomic APIs ----------------------------------*/
+#if ATOMIC_EXCLUSIVE
+
+__STATIC_INLINE uint32_t ATOMIC_Load(ATOMIC_U32TypeDef *Ptr)
+{
+    uint32_t value = *Ptr;
+
+    __DMB();
+    return value;
+}
+
+__STATIC_INLINE void ATOMIC_Store(ATOMIC_U32TypeDef *Ptr, uint32_t Value)
+{
+    __DMB();
+    *Ptr = Value;
+}
+
+__STATIC_INLINE uint32_t ATOMIC_Exchange(ATOMIC_U32TypeDef *Ptr, uint32_t Value)
+{
+    uint32_t old;
+
+    __DMB();
+    do {
+        old = __LDREXW(Ptr);
+    } while (__STREXW(Value, Ptr) != 0U);
+    __DMB();
+    return old;
+}
+
+/**
+ * @brief   Store Desired if *Ptr equals *Expected
+ * @retval  1 if stored, else 0 and *Expected receives the current value
+ */
+__STATIC_INLINE uint32_t ATOMIC_CompareExchange(ATOMIC_U32TypeDef *Ptr, uint32_t *Expected, uint32_t Desired)
+{
+    uint32_t old;
+
+    __DMB();
+    do {
+        old = __LDREXW(Ptr);
+        if (old != *Expected) {
+            __CLREX();
+            *Expected = old;
+            __DMB();
+            return 0U;
+        }
+    } while (__STREXW(Desired, Ptr) != 0U);
+    __DMB();
+    return 1U;
+}
+
+#define ATOMIC_DEFINE_FETCH_OP(NAME, EXPR)                                          \
+__STATIC_INLINE uint32_t ATOMIC_Fetch##NAME(ATOMIC_U32TypeDef *Ptr, uint32_t Value) \
+{                                                                                   \
+    uint32_t old;                                                                   \
+                                                                                    \
+    __DMB();                                                                        \
+    do {                                                                            \
+        old = __LDREXW(Ptr);                                                        \
+    } while (__STREXW((EXPR), Ptr) != 0U);                                          \
+    __DMB();                                                                        \
+    return old;                                                                     \
+}
+
+ATOMIC_DEFINE_FETCH_OP(Add, old + Value)
+ATOMIC_DEFINE_FETCH_OP(Sub, old - Value)
+ATOMIC_DEFINE_FETCH_OP(Or,  old | Value)
+ATOMIC_DEFINE_FETCH_OP(And, old & Value)
+ATOMIC_DEFINE_FETCH_OP(Xor, old ^ Value)
+
+#undef ATOMIC_DEFINE_FETCH_OP
+
+#else
+
+static inline uint32_t ATOMIC_Load(ATOMIC_U32TypeDef *Ptr)
+{
+    return atomic_load_explicit(Ptr, memory_order_acquire);
+}
+
+static inline void ATOMIC_Store(ATOMIC_U32TypeDef *Ptr, uint32_t Value)
+{
+    atomic_store_explicit(Ptr, Value, memory_order_release);
+}
+
+static inline uint32_t ATOMIC_Exchange(ATOMIC_U32TypeDef *Ptr, uint32_t Value)
+{
+    return atomic_exchange_explicit(Ptr, Value, memory_order_seq_cst);
+}
+
+static inline uint32_t ATOMIC_CompareExchange(ATOMIC_U32TypeDef *Ptr, uint32_t *Expected, uint32_t Desired)
+{
+    return atomic_compare_exchange_strong_explicit(Ptr, Expected, Desired,
+                                                   memory_order_seq_cst, memory_order_seq_cst) ? 1U : 0U;
+}
+
+static inline uint32_t ATOMIC_FetchAdd(ATOMIC_U32TypeDef *Ptr, uint32_t Value)
+{
+    return atomic_fetch_add_explicit(Ptr, Value, memory_order_seq_cst);
+}
+
+static inline uint32_t ATOMIC_FetchSub(ATOMIC_U32TypeDef *Ptr, uint32_t Value)
+{
+    return atomic_fetch_sub_explicit(Ptr, Value, memory_order_seq_cst);
+}
+
+static inline uint32_t ATOMIC_FetchOr(ATOMIC_U32TypeDef *Ptr, uint32_t Value)
+{
+    return atomic_fetch_or_explicit(Ptr, Value, memory_order_seq_cst);
+}
+
+static inline uint32_t ATOMIC_FetchAnd(ATOMIC_U32TypeDef *Ptr, uint32_t Value)
+{
+    return atomic_fetch_and_explicit(Ptr, Value, memory_order_seq_cst);
+}
+
+static inline uint32_t ATOMIC_FetchXor(ATOMIC_U32TypeDef *Ptr, uint32_t Value)
+{
+    return atomic_fetch_xor_explicit(Ptr, Value, memory_order_seq_cst);
+}
+
+#endif
+
+/**
+ * @brief   Set a flag
+ * @retval  Previous state: 0 means the caller set it (acquired)
+ */
+static inline uint32_t ATOMIC_FlagTestAndSet(ATOMIC_FlagTypeDef *Flag)
+{
+    return ATOMIC_Exchange(Flag, 1U);
+}
+
+static inline void ATOMIC_FlagClear(ATOMIC_FlagTypeDef *Flag)
+{
+    ATOMIC_Store(Flag, 0U);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _ATOMIC_H_
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   Micro-benchmark suite: HAL GPIO, interrupt entry, memory, DSP and allocator
+ * @note    Each case runs Iterations operations per sample, BENCH_SAMPLES samples after
+ *          one warm-up; min, median and max per operation are reported. Regressions are
+ *          checked on the median under QEMU and on the min on the host, where other
+ *          processes add noise.
+ *
+ *          Results are one JSON document, written line by line:
+ *          - on target over semihosting (SYS_WRITE0), then SYS_EXIT ends the run. Needs
+ *            a debugger or QEMU with semihosting on: a BKPT without one locks the core up.
+ *            Times are in core cycles from DWT CYCCNT, or from SysTick where CYCCNT does
+ *            not count (QEMU does not model the DWT).
+ *          - on the host (BENCH_HOST) to stdout, in ns. GPIO cases run on a GPIO port
+ *            in RAM, which stands for the register file; the interrupt and kernel cases
+ *            are left out.
+ *
+ *          The kernel cases come last: the suite starts the kernel (kernel.h) and goes on
+ *          in a thread, with a peer thread of the same priority. k_yield is one K_Yield()
+ *          from a thread to the other, the whole path; k_pendsv the PendSV part alone, as
+ *          K_GetStats() reports it (CYCCNT only). They publish the context switch time.
+ *
+ *          Tools/bench/ has the QEMU and host runners, the stored baselines and the
+ *          comparison with its regression threshold. Build the firmware with BENCH
+ *          defined to have main() run the suite.
+ */
+
+#define BENCH_SAMPLES           11U         /*< Samples per case, odd for a true median >*/
+#define BENCH_NAME_MAX          24U
+
+/**
+ * @brief: Benchmark case
+ * @note   Run performs Iterations operations. A case that measures itself (interrupt
+ *         latency) sets SelfTimed and returns the ticks of the Iterations operations;
+ *         others return 0 and are timed around the call.
+ */
+typedef struct
+{
+    const char  *Name;
+    uint32_t    (*Run)(uint32_t Iterations);
+    uint32_t    Iterations;
+    uint32_t    Bytes;                  /*< Bytes moved per operation, 0 if not a copy >*/
+    uint32_t    SelfTimed;
+} BENCH_CaseTypeDef;
+
+/**
+ * @brief: Result of one case, per operation in hundredths of a tick
+ */
+typedef struct
+{
+    uint32_t    Min;
+    uint32_t    Median;
+    uint32_t    Max;
+} BENCH_ResultTypeDef;
+
+/*------------------------------ Benchmark APIs ----------------------------------*/
+void BENCH_Run(void) __attribute__((noreturn));
+HAL_StatusTypeDef BENCH_RunCase(const BENCH_CaseTypeDef *Case, BENCH_ResultTypeDef *Result);
+uint32_t BENCH_Now(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BENCH_H_
\ No newline at end of file
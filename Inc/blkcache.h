@@ -0,0 +1,102 @@
+#ifndef _BLKCACHE_H_
+#define _BLKCACHE_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "blkdev.h"
+
+/**
+ * @brief   Write-back block cache with read-ahead, on a BLK_DeviceTypeDef
+ * @note    SlotCount blocks of BLK_BLOCK_SIZE bytes, one contiguous word-aligned array, so
+ *          runs of consecutive slots can be moved by a single multi-block command.
+ *          Lookup is a hash on the block number; replacement is CLOCK (second chance).
+ *          A block only earns its second chance with a hit, not when it is loaded, so a
+ *          stream of blocks used once moves the hand steadily: it lands in consecutive
+ *          slots and is written back as one CMD25 (up to MaxBlocks).
+ *
+ *          Writes only fill the cache. Once DirtyThreshold slots are dirty a write-back of
+ *          the oldest run is started and runs in the background while the caller keeps
+ *          filling other slots; BLKC_Service() (main loop, idle task) completes it and
+ *          starts the next one. A slot being written back is not touched until the
+ *          command has completed.
+ *
+ *          A read miss that continues the previous read fetches ReadAhead more blocks in
+ *          the same command.
+ *
+ *          Not reentrant: one thread uses a cache (the device completion is polled).
+ */
+
+#define BLKC_NIL                0xFFFFU
+
+/**
+ * @defgroup BLKC_Slot_Flags
+ */
+#define BLKC_SLOT_VALID         0x01U
+#define BLKC_SLOT_DIRTY         0x02U
+#define BLKC_SLOT_REF           0x04U       /*< Hit since the hand last passed >*/
+#define BLKC_SLOT_BUSY          0x08U       /*< Owned by the device command in flight >*/
+#define BLKC_SLOT_AHEAD         0x10U       /*< Read ahead, not used yet >*/
+
+/**
+ * @brief: Slot descriptor, one per cached block
+ */
+typedef struct
+{
+    uint32_t Lba;
+    uint16_t Next;                  /*< Next slot in the same hash chain >*/
+    uint16_t Head;                  /*< First slot of hash chain [index] >*/
+    uint8_t  Flags;                 /*< See @ref BLKC_Slot_Flags >*/
+} BLKC_SlotTypeDef;
+
+/**
+ * @brief: Statistics
+ */
+typedef struct
+{
+    uint32_t Hits;
+    uint32_t Misses;
+    uint32_t ReadAheadBlocks;       /*< Fetched ahead of a sequential read >*/
+    uint32_t ReadCommands;
+    uint32_t WriteCommands;
+    uint32_t WrittenBlocks;         /*< WrittenBlocks / WriteCommands = average run >*/
+    uint32_t Stalls;                /*< Waits for the device to free a slot >*/
+    uint32_t Errors;
+} BLKC_StatsTypeDef;
+
+/**
+ * @brief: Cache, storage provided by the caller
+ */
+typedef struct
+{
+    BLK_DeviceTypeDef   *Device;
+    uint8_t             *Data;          /*< SlotCount * BLK_BLOCK_SIZE bytes, word aligned >*/
+    BLKC_SlotTypeDef    *Slots;
+    uint32_t            SlotCount;      /*< Power of 2, 2 ~ 32768 >*/
+    uint32_t            Hand;           /*< CLOCK hand >*/
+    uint32_t            ReadAhead;      /*< Extra blocks on a sequential read miss >*/
+    uint32_t            DirtyThreshold; /*< Dirty slots that start a background write-back >*/
+    uint32_t            DirtyCount;
+    uint32_t            NextRead;       /*< Block following the last read, for sequential detection >*/
+    uint32_t            BusyOp;         /*< Device command in flight, 0 = none >*/
+    uint32_t            BusyFirst;      /*< Slots it owns >*/
+    uint32_t            BusyCount;
+    BLKC_StatsTypeDef   Stats;
+} BLKC_CacheTypeDef;
+
+/*------------------------------ Cache APIs ----------------------------------*/
+HAL_StatusTypeDef BLKC_Init(BLKC_CacheTypeDef *Cache, BLK_DeviceTypeDef *Device, void *Data,
+                            BLKC_SlotTypeDef *Slots, uint32_t SlotCount, uint32_t ReadAhead);
+HAL_StatusTypeDef BLKC_Read(BLKC_CacheTypeDef *Cache, uint32_t Lba, void *Buffer, uint32_t Count);
+HAL_StatusTypeDef BLKC_Write(BLKC_CacheTypeDef *Cache, uint32_t Lba, const void *Buffer, uint32_t Count);
+HAL_StatusTypeDef BLKC_PreErase(BLKC_CacheTypeDef *Cache, uint32_t Lba, uint32_t Count);
+HAL_StatusTypeDef BLKC_Flush(BLKC_CacheTypeDef *Cache);
+HAL_StatusTypeDef BLKC_Service(BLKC_CacheTypeDef *Cache);
+void BLKC_Invalidate(BLKC_CacheTypeDef *Cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BLKCACHE_H_
\ No newline at end of file
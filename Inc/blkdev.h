@@ -0,0 +1,83 @@
+#ifndef _BLKDEV_H_
+#define _BLKDEV_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   Block device interface, 512-byte blocks
+ * @note    Commands are asynchronous, one at a time: Read/Write/Erase start a command and
+ *          return, Poll() reports HAL_BUSY until it has completed, then the command
+ *          status (HAL_OK or HAL_ERROR) once, then HAL_OK while idle. The buffer of a
+ *          running command belongs to the device (DMA) until then.
+ *
+ *          Two backends:
+ *          - BLK_SdInit(): SD card through the SDIO HAL driver. A write is only complete
+ *            once the card has left the programming state, so Poll() issues CMD13 after
+ *            the DMA part is done.
+ *          - BLK_RamInit(): RAM disk. Data is moved when the command completes, after
+ *            Latency polls, like a DMA transfer would; builds without the SD driver
+ *            (BLK_HOST), so the block cache can be run and tested on the host.
+ */
+
+#define BLK_BLOCK_SIZE          512U
+
+struct BLK_Device;
+
+/**
+ * @brief: Block device, embedded first in each backend
+ */
+typedef struct BLK_Device
+{
+    uint32_t BlockCount;            /*< Capacity in blocks >*/
+    uint32_t MaxBlocks;             /*< Largest Count accepted by one command >*/
+    HAL_StatusTypeDef (*Read)(struct BLK_Device *Dev, uint32_t Lba, void *Buffer, uint32_t Count);
+    HAL_StatusTypeDef (*Write)(struct BLK_Device *Dev, uint32_t Lba, const void *Buffer, uint32_t Count);
+    HAL_StatusTypeDef (*Erase)(struct BLK_Device *Dev, uint32_t Lba, uint32_t Count);  /*< Optional, NULL if not supported >*/
+    HAL_StatusTypeDef (*Poll)(struct BLK_Device *Dev);
+} BLK_DeviceTypeDef;
+
+/**
+ * @brief: RAM disk
+ */
+typedef struct
+{
+    BLK_DeviceTypeDef   Dev;
+    uint8_t             *Storage;       /*< BlockCount * BLK_BLOCK_SIZE bytes >*/
+    uint32_t            Latency;        /*< Poll() calls a command stays busy >*/
+    uint32_t            Remaining;
+    uint32_t            Op;
+    uint32_t            Lba;
+    uint32_t            Count;
+    void                *Buffer;
+    uint32_t            Commands;       /*< Statistics: commands, blocks moved >*/
+    uint32_t            BlocksRead;
+    uint32_t            BlocksWritten;
+} BLK_RamDeviceTypeDef;
+
+/*------------------------------ Backends ----------------------------------*/
+HAL_StatusTypeDef BLK_RamInit(BLK_RamDeviceTypeDef *Ram, void *Storage, uint32_t BlockCount,
+                              uint32_t MaxBlocks, uint32_t Latency);
+
+#ifndef BLK_HOST
+/**
+ * @brief: SD card, on an initialized SDIO handle
+ */
+typedef struct
+{
+    BLK_DeviceTypeDef   Dev;
+    SD_HandleTypeDef    *hsd;
+    uint32_t            Programming;    /*< Write or erase sent, card may still be busy >*/
+} BLK_SdDeviceTypeDef;
+
+HAL_StatusTypeDef BLK_SdInit(BLK_SdDeviceTypeDef *Sd, SD_HandleTypeDef *hsd);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _BLKDEV_H_
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef _DEBOUNCE_H_
+#define _DEBOUNCE_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+#include "atomic.h"
+
+/**
+ * @brief   Bit-parallel input debouncer, whole GPIO ports sampled from TIM6
+ * @note    Each sample reads IDR once per port and runs the 16 pins through vertical
+ *          counters: bit n of Count[0..3] is the 4-bit counter of pin n. A pin counts
+ *          up while its input differs from the debounced state and restarts as soon as
+ *          it agrees again. When the count reaches the pin's stable time (Limit, same
+ *          layout) the debounced state flips and a press or release edge is latched.
+ *          The same ~40 instructions run per port whatever the pins do: no per-pin
+ *          loop, no branch on the data.
+ *
+ *          Stable times are per pin, 1 ~ DEB_SAMPLES_MAX samples, set in ms and rounded
+ *          up to whole samples: at 1 kHz, 1 ~ 15 ms. Lower the rate for longer times.
+ *
+ *          Pressed means the pin became active: high, or low for the pins given as
+ *          ActiveLow (buttons to ground with a pull-up). Edges accumulate until read by
+ *          DEB_GetEdges(), which takes them with one atomic exchange: none is lost or
+ *          seen twice, from any context.
+ *
+ *          DEB_Init() installs DEB_TIM_IRQHandler() in the RAM vector table. TIM6 clock
+ *          must be enabled by the caller (__HAL_RCC_TIM6_CLK_ENABLE()). TIM6 shares its
+ *          vector with the DAC underrun interrupt, which must stay disabled. To drive
+ *          the debouncer from another timebase, skip DEB_Start() and call DEB_Sample().
+ */
+
+#ifndef DEB_PORTS_MAX
+#define DEB_PORTS_MAX           4U          /*< Ports debounced >*/
+#endif
+
+#define DEB_COUNTER_BITS        4U
+#define DEB_SAMPLES_MAX         ((1UL << DEB_COUNTER_BITS) - 1UL)
+#define DEB_STABLE_MS_DEFAULT   10U         /*< Stable time given by DEB_AddPort() >*/
+
+#define DEB_RATE_MIN            100U        /*< Hz >*/
+#define DEB_RATE_MAX            20000U
+
+/**
+ * @brief: One debounced port
+ */
+typedef struct
+{
+    GPIO_TypeDef        *GPIOx;
+    uint32_t            Pins;               /*< Pins debounced, the others stay 0 >*/
+    uint32_t            ActiveLow;          /*< Pins active (pressed) when low >*/
+    __IO uint32_t       State;              /*< Debounced input level >*/
+    uint32_t            Count[DEB_COUNTER_BITS];    /*< Vertical counters, bit plane 0 first >*/
+    uint32_t            Limit[DEB_COUNTER_BITS];    /*< Stable time in samples, same layout >*/
+    ATOMIC_U32TypeDef   Edges;              /*< Pressed in bits 0-15, released in bits 16-31 >*/
+} DEB_PortTypeDef;
+
+/*------------------------------ Debouncer APIs ----------------------------------*/
+HAL_StatusTypeDef DEB_Init(uint32_t RateHz, uint32_t PreemptPriority);
+HAL_StatusTypeDef DEB_AddPort(GPIO_TypeDef *GPIOx, uint16_t Pins, uint16_t ActiveLow);
+HAL_StatusTypeDef DEB_SetStableTime(GPIO_TypeDef *GPIOx, uint16_t Pins, uint32_t Ms);
+HAL_StatusTypeDef DEB_Start(void);
+HAL_StatusTypeDef DEB_Stop(void);
+
+uint16_t DEB_GetActive(GPIO_TypeDef *GPIOx);
+uint32_t DEB_GetEdges(GPIO_TypeDef *GPIOx, uint16_t *Pressed, uint16_t *Released);
+
+void DEB_Sample(void);
+void DEB_TIM_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _DEBOUNCE_H_
\ No newline at end of file
@@ -0,0 +1,63 @@
+#ifndef _ETHMODEL_H_
+#define _ETHMODEL_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   Host model of the ETH DMA, runs the driver's descriptor rings on Linux
+ * @note    Build stm32f4xx_hal_eth.c and ethmodel.c with ETH_HOST defined, and point
+ *          heth->Instance at a zeroed ETH_TypeDef in RAM (register writes land there,
+ *          self-clearing bits are cleared by the driver itself in that build).
+ *
+ *          The model plays the DMA side of the hand-off: it only reads descriptors with
+ *          OWN set and hands them back by writing the status with OWN clear, follows the
+ *          end of ring marks and raises the DMASR flags the hardware would (RS, TS, RBUS,
+ *          the receive watchdog for descriptors with DIC). Frames move between test code
+ *          and the descriptors' buffers through the Buf pointers, host addresses do not
+ *          fit in DES2.
+ *
+ *          Breaches of the hand-off rules by the driver are counted in Violations:
+ *          - a TX frame whose descriptors after the first are not all owned by the DMA
+ *          - a frame start without FS, or a descriptor without buffer or size
+ *          - Buf and DES2 disagreeing, the last descriptor without end of ring mark
+ *
+ *          ETHM_IrqPending() stands for the interrupt line: call HAL_ETH_IRQHandler()
+ *          while it returns 1.
+ */
+
+/**
+ * @defgroup ETHM_Rx_Flags
+ */
+#define ETHM_RX_CRC_ERROR           0x01U       /*< Frame arrives with a bad FCS >*/
+#define ETHM_RX_IP                  0x02U       /*< IPv4/IPv6 frame, checksums verified (FT) >*/
+
+/**
+ * @brief: DMA model state
+ */
+typedef struct
+{
+    ETH_HandleTypeDef   *heth;
+    uint32_t            RxIndex;        /*< Current RX descriptor, as DMACHRDR >*/
+    uint32_t            TxIndex;        /*< Current TX descriptor, as DMACHTDR >*/
+    uint32_t            RxWatchdog;     /*< Ticks until RS, 0 = not running >*/
+    uint32_t            MissedFrames;   /*< No descriptor at frame start (DMAMFBOCR.MFC) >*/
+    uint32_t            Truncated;      /*< Ran out of descriptors within a frame (DE) >*/
+    uint32_t            Violations;     /*< Hand-off rules broken, see above >*/
+} ETHM_ModelTypeDef;
+
+/*------------------------------ Model APIs ----------------------------------*/
+void ETHM_Init(ETHM_ModelTypeDef *Model, ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef ETHM_Receive(ETHM_ModelTypeDef *Model, const void *Frame, uint32_t Length, uint32_t Flags);
+uint32_t ETHM_Transmit(ETHM_ModelTypeDef *Model, void *Frame, uint32_t Size, uint32_t *Checksum);
+void ETHM_Tick(ETHM_ModelTypeDef *Model, uint32_t Units);
+uint32_t ETHM_IrqPending(ETHM_ModelTypeDef *Model);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _ETHMODEL_H_
\ No newline at end of file
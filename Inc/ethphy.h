@@ -0,0 +1,82 @@
+#ifndef _ETHPHY_H_
+#define _ETHPHY_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   Ethernet PHY on the MAC's MDIO bus (IEEE 802.3 clause 22)
+ * @note    The standard registers cover reset, auto-negotiation and link status for any
+ *          PHY. What differs between parts goes in an ETHPHY_DriverTypeDef:
+ *          - Init: strap overrides after reset, e.g. MII or RMII mode
+ *          - GetMode: speed and duplex from the vendor status register (one read, and
+ *            also right for a link partner that does not negotiate)
+ *          Driver == NULL uses the standard registers only: the best mode both sides
+ *          advertise (ANAR & ANLPAR).
+ *
+ *          ETHPHY_Poll() (every ~100 ms from the network thread) follows the link: on a
+ *          change it stops the MAC, sets the new speed/duplex and starts it again.
+ */
+
+#define ETHPHY_ADDRESS_ANY          0xFFU       /*< Scan 0 ~ 31 for the first PHY that answers >*/
+
+/* Standard registers */
+#define ETHPHY_BMCR                 0x00U
+#define ETHPHY_BMSR                 0x01U
+#define ETHPHY_PHYID1               0x02U
+#define ETHPHY_PHYID2               0x03U
+#define ETHPHY_ANAR                 0x04U
+#define ETHPHY_ANLPAR               0x05U
+
+#define ETHPHY_BMCR_RESET           0x8000U
+#define ETHPHY_BMCR_ANENABLE        0x1000U
+#define ETHPHY_BMCR_ANRESTART       0x0200U
+#define ETHPHY_BMSR_ANCOMPLETE      0x0020U
+#define ETHPHY_BMSR_LINK            0x0004U     /*< Latched low: read twice for the current state >*/
+#define ETHPHY_AN_100FD             0x0100U
+#define ETHPHY_AN_100HD             0x0080U
+#define ETHPHY_AN_10FD              0x0040U
+#define ETHPHY_AN_10HD              0x0020U
+#define ETHPHY_AN_SELECTOR          0x0001U     /*< IEEE 802.3 >*/
+
+struct ETHPHY_Handle;
+
+/**
+ * @brief: PHY specifics
+ */
+typedef struct
+{
+    HAL_StatusTypeDef (*Init)(struct ETHPHY_Handle *Phy);       /*< After reset, optional >*/
+    HAL_StatusTypeDef (*GetMode)(struct ETHPHY_Handle *Phy, uint32_t *Speed, uint32_t *Duplex);
+} ETHPHY_DriverTypeDef;
+
+/**
+ * @brief: PHY handle
+ */
+typedef struct ETHPHY_Handle
+{
+    ETH_HandleTypeDef           *heth;
+    const ETHPHY_DriverTypeDef  *Driver;    /*< NULL: standard registers only >*/
+    uint32_t                    Address;
+    uint32_t                    Id;         /*< PHYID1 << 16 | PHYID2 >*/
+    uint32_t                    LinkUp;
+    uint32_t                    Speed;      /*< ETH_SPEED_10M / ETH_SPEED_100M, valid with LinkUp >*/
+    uint32_t                    Duplex;     /*< ETH_DUPLEX_HALF / ETH_DUPLEX_FULL >*/
+} ETHPHY_HandleTypeDef;
+
+extern const ETHPHY_DriverTypeDef ETHPHY_LAN8742;  /*< Microchip LAN8720A / LAN8742A, RMII >*/
+extern const ETHPHY_DriverTypeDef ETHPHY_DP83848;  /*< TI DP83848, MII or RMII >*/
+
+/*------------------------------ PHY APIs ----------------------------------*/
+HAL_StatusTypeDef ETHPHY_Init(ETHPHY_HandleTypeDef *Phy, ETH_HandleTypeDef *heth, uint32_t Address,
+                              const ETHPHY_DriverTypeDef *Driver);
+HAL_StatusTypeDef ETHPHY_Poll(ETHPHY_HandleTypeDef *Phy, uint32_t *Changed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _ETHPHY_H_
\ No newline at end of file
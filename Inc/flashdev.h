@@ -0,0 +1,91 @@
+#ifndef _FLASHDEV_H_
+#define _FLASHDEV_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   NOR flash region: equal-size sectors, memory-mapped reads, erase to 0xFF and
+ *          program in ProgramUnit bytes that can only clear bits
+ * @note    Backends implement Program (whole, aligned units) and Erase (one sector).
+ *          FDEV_Write() sits on top and combines small writes: bytes are collected in a
+ *          one-unit buffer and programmed once the writer moves past the unit, so a record
+ *          written field by field costs one program operation per unit, not per field.
+ *          Whole units in a write are programmed straight from the caller's data. The
+ *          bytes of a partial unit that were not written keep their flash contents, so
+ *          appending to a unit already programmed never needs a 0 -> 1 change.
+ *          FDEV_Flush() programs the partial unit; data is only in flash after it.
+ *
+ *          Two backends:
+ *          - FDEV_FlashInit(): internal flash sectors through the HAL FLASH driver
+ *          - FDEV_SimInit(): a RAM array that enforces the flash rules (alignment, no
+ *            0 -> 1 transition) and can cut the power after a number of program units;
+ *            builds without the HAL driver (FDEV_HOST) to test flash users on the host.
+ */
+
+struct FDEV_Device;
+
+/**
+ * @brief: Flash region, embedded first in each backend
+ */
+typedef struct FDEV_Device
+{
+    const uint8_t   *Memory;        /*< Region start, reads go straight to memory >*/
+    uint32_t        SectorSize;
+    uint32_t        SectorCount;
+    uint32_t        ProgramUnit;    /*< 1, 2, 4 or 8 bytes >*/
+    HAL_StatusTypeDef (*Program)(struct FDEV_Device *Dev, uint32_t Offset, const void *Data, uint32_t Length);
+    HAL_StatusTypeDef (*Erase)(struct FDEV_Device *Dev, uint32_t Sector);
+    uint32_t        Buffer[2];      /*< Write-combining unit >*/
+    uint32_t        BufferOffset;
+    uint32_t        BufferDirty;
+    uint32_t        Writes;         /*< Statistics: FDEV_Write() calls, units programmed, erases >*/
+    uint32_t        Units;
+    uint32_t        Erases;
+} FDEV_DeviceTypeDef;
+
+/**
+ * @brief: Simulated flash
+ */
+typedef struct
+{
+    FDEV_DeviceTypeDef  Dev;
+    uint8_t             *Storage;       /*< SectorCount * SectorSize bytes >*/
+    uint32_t            *EraseCounts;   /*< Per sector, may be NULL >*/
+    uint32_t            FailAfter;      /*< Units left before the power cut, 0 = never >*/
+    uint32_t            PowerLost;      /*< Set by the cut, every operation fails until FDEV_SimInit() >*/
+    uint32_t            Violations;     /*< Misaligned programs and 0 -> 1 transitions, refused >*/
+} FDEV_SimDeviceTypeDef;
+
+/*------------------------------ Region APIs ----------------------------------*/
+HAL_StatusTypeDef FDEV_Write(FDEV_DeviceTypeDef *Dev, uint32_t Offset, const void *Data, uint32_t Length);
+HAL_StatusTypeDef FDEV_Flush(FDEV_DeviceTypeDef *Dev);
+HAL_StatusTypeDef FDEV_Erase(FDEV_DeviceTypeDef *Dev, uint32_t Sector);
+
+/*------------------------------ Backends ----------------------------------*/
+HAL_StatusTypeDef FDEV_SimInit(FDEV_SimDeviceTypeDef *Sim, void *Storage, uint32_t SectorSize,
+                               uint32_t SectorCount, uint32_t ProgramUnit);
+
+#ifndef FDEV_HOST
+/**
+ * @brief: Internal flash sectors, on an initialized FLASH handle
+ */
+typedef struct
+{
+    FDEV_DeviceTypeDef  Dev;
+    FLASH_HandleTypeDef *hflash;
+    uint32_t            FirstSector;
+} FDEV_FlashDeviceTypeDef;
+
+HAL_StatusTypeDef FDEV_FlashInit(FDEV_FlashDeviceTypeDef *Flash, FLASH_HandleTypeDef *hflash,
+                                 uint32_t FirstSector, uint32_t SectorCount);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _FLASHDEV_H_
\ No newline at end of file
@@ -0,0 +1,141 @@
+#ifndef _KERNEL_H_
+#define _KERNEL_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   Preemptive micro-kernel
+ * @note    - Fixed priorities 1 ~ K_PRIORITY_MAX - 1 (higher value runs first), 0 is the idle thread.
+ *            Threads of equal priority run in FIFO order until they block or call K_Yield().
+ *          - Context switch in PendSV on the per-thread PSP stacks. The FPU registers s16-s31
+ *            are saved only for threads that have an active FP context (lazy stacking),
+ *            the others switch as fast as on an integer-only core.
+ *          - Interrupts with preempt priority < K_MAX_SYSCALL_PRIORITY are never masked by
+ *            the kernel and must not call it. The others may call K_SemGive() and the
+ *            K_NO_WAIT variants. Requires NVIC_PRIORITYGROUP_4 (set by HAL_Init()).
+ *          - Tickless idle: with only the idle thread ready, SysTick is reprogrammed to
+ *            expire at the next wake-up and the core sleeps in WFI.
+ *
+ *          K_Init() installs the SVCall, PendSV and SysTick handlers in the RAM vector table,
+ *          so it cannot be used together with the run-to-completion scheduler.
+ *
+ *          Switch time: K_GetStats() reports the PendSV cycles at run time. The bench suite
+ *          (bench.h) publishes it, k_yield for a whole K_Yield() hand-over and k_pendsv for
+ *          PendSV alone, and Tools/bench/ checks a run against the stored baseline.
+ */
+
+#define K_PRIORITY_MAX              32U
+#define K_MAX_SYSCALL_PRIORITY      5U          /*< Highest preempt priority allowed to call the kernel >*/
+#define K_TICK_HZ                   1000U
+#define K_IDLE_STACK_SIZE           256U        /*< bytes >*/
+#define K_STACK_CANARY              0xC0DEC0DEU /*< Lowest word of every stack >*/
+#define K_STACK_GUARD               64U         /*< bytes kept free above the canary, checked at each switch >*/
+
+#define K_NO_WAIT                   0x00000000U
+#define K_WAIT_FOREVER              0xFFFFFFFFU
+
+/**
+ * @brief: Thread state
+ */
+typedef enum
+{
+    K_STATE_READY       = 0x00U,    /*< Ready or running >*/
+    K_STATE_BLOCKED     = 0x01U,    /*< Waiting for an object and/or a timeout >*/
+    K_STATE_TERMINATED  = 0x02U,
+} K_StateTypeDef;
+
+typedef void (*K_ThreadFuncTypeDef)(void *Arg);
+
+struct K_Mutex;
+
+/**
+ * @brief: Thread control block
+ */
+typedef struct K_Thread
+{
+    uint32_t            *Sp;            /*< Saved PSP, must stay the first member (used by PendSV) >*/
+    uint32_t            *StackBase;     /*< Lowest address of the stack, holds K_STACK_CANARY >*/
+    uint32_t            StackSize;      /*< bytes >*/
+    uint32_t            BasePriority;   /*< Assigned priority >*/
+    uint32_t            Priority;       /*< Effective priority (raised by priority inheritance) >*/
+    K_StateTypeDef      State;
+    struct K_Thread     *Next;          /*< Ready list or wait list links >*/
+    struct K_Thread     *Prev;
+    struct K_Thread     **WaitList;     /*< Wait list the thread is queued on, NULL if none >*/
+    struct K_Thread     *DelayNext;     /*< Timeout list link >*/
+    uint32_t            WakeTick;
+    uint32_t            Delayed;        /*< On the timeout list >*/
+    struct K_Mutex      *BlockedMutex;  /*< Mutex being waited for (inheritance chain) >*/
+    struct K_Mutex      *MutexHeld;     /*< Mutexes owned >*/
+    HAL_StatusTypeDef   WaitResult;
+    const char          *Name;
+    uint32_t            SwitchCount;    /*< Times switched in >*/
+    struct K_Thread     *AllNext;       /*< Every thread created, see K_ThreadNext() >*/
+} K_ThreadTypeDef;
+
+/**
+ * @brief: Counting semaphore
+ */
+typedef struct
+{
+    uint32_t            Count;
+    uint32_t            MaxCount;
+    K_ThreadTypeDef     *Waiters;       /*< Highest priority first >*/
+} K_SemaphoreTypeDef;
+
+/**
+ * @brief: Recursive mutex with priority inheritance
+ */
+typedef struct K_Mutex
+{
+    K_ThreadTypeDef     *Owner;
+    uint32_t            LockCount;
+    K_ThreadTypeDef     *Waiters;       /*< Highest priority first >*/
+    struct K_Mutex      *NextHeld;      /*< Owner's list of held mutexes >*/
+} K_MutexTypeDef;
+
+/**
+ * @brief: Kernel statistics
+ */
+typedef struct
+{
+    uint32_t            SwitchCount;
+    uint32_t            LastSwitchCycles;   /*< PendSV entry to exit of the last switch, core cycles >*/
+    uint32_t            MaxSwitchCycles;
+    uint32_t            IdleSleeps;         /*< Tickless sleeps taken >*/
+    uint32_t            IdleTicksSuppressed;/*< Tick interrupts skipped by tickless idle >*/
+} K_StatsTypeDef;
+
+/*------------------------------ Kernel APIs ----------------------------------*/
+HAL_StatusTypeDef K_Init(void);
+HAL_StatusTypeDef K_ThreadCreate(K_ThreadTypeDef *Thread, const char *Name, K_ThreadFuncTypeDef Entry, void *Arg,
+                                 uint32_t *Stack, uint32_t StackSize, uint32_t Priority);
+void K_Start(void) __attribute__((noreturn));
+
+K_ThreadTypeDef *K_ThreadSelf(void);
+K_ThreadTypeDef *K_ThreadNext(const K_ThreadTypeDef *Thread);
+uint32_t K_ThreadStackPeak(const K_ThreadTypeDef *Thread);
+void K_Sleep(uint32_t Ticks);
+void K_Yield(void);
+uint32_t K_GetTick(void);
+
+HAL_StatusTypeDef K_SemInit(K_SemaphoreTypeDef *Sem, uint32_t InitialCount, uint32_t MaxCount);
+HAL_StatusTypeDef K_SemTake(K_SemaphoreTypeDef *Sem, uint32_t Timeout);
+HAL_StatusTypeDef K_SemGive(K_SemaphoreTypeDef *Sem);
+
+HAL_StatusTypeDef K_MutexInit(K_MutexTypeDef *Mutex);
+HAL_StatusTypeDef K_MutexLock(K_MutexTypeDef *Mutex, uint32_t Timeout);
+HAL_StatusTypeDef K_MutexUnlock(K_MutexTypeDef *Mutex);
+
+void K_GetStats(K_StatsTypeDef *Stats);
+void K_StackOverflowHook(K_ThreadTypeDef *Thread);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _KERNEL_H_
\ No newline at end of file
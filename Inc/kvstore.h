@@ -0,0 +1,77 @@
+#ifndef _KVSTORE_H_
+#define _KVSTORE_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "flashdev.h"
+
+/**
+ * @brief   Key-value store in flash: a log of records over a ring of 2 or more sectors
+ * @note    Keys are small integers (0 ~ KeyCount - 1), values up to KV_VALUE_MAX bytes.
+ *          A set appends one record (header with CRC, value) at the head of the log and
+ *          nothing is erased on the way, so an update costs its own size in program
+ *          operations instead of a sector erase.
+ *
+ *          The RAM index has one entry per key with the flash offset of its latest record,
+ *          so a get is one table lookup and one copy. It is rebuilt by KV_Mount() from a
+ *          scan of the log, oldest sector first.
+ *
+ *          Sectors are used in ring order and one is always kept erased. When the head
+ *          sector is full the log moves to the erased one and the oldest sector is
+ *          reclaimed: its live records are copied to the head, then it is erased. Every
+ *          sector is erased once per turn of the ring, the wear is even, and erase counts
+ *          are kept in the sector headers.
+ *
+ *          Power loss: a record whose CRC does not match is ignored and stepped over. A
+ *          header cut before its length was written is programmed to 0 at the next mount,
+ *          which makes it an empty record that never matches its CRC, and appends go on
+ *          after it. A reclaim cut before its erase leaves duplicates of live records, the
+ *          newer ones win and the reclaim is finished at the next mount, in the head.
+ *
+ *          Not thread safe; one caller at a time.
+ */
+
+#define KV_MAX_SECTORS          12U
+#define KV_VALUE_MAX            1024U           /*< Largest value, bytes >*/
+#define KV_NONE                 0xFFFFFFFFU     /*< Index entry of a key without value >*/
+
+/**
+ * @brief: Sector of the ring
+ */
+typedef struct
+{
+    uint32_t Sequence;          /*< Position in the log, KV_NONE: erased (spare) >*/
+    uint32_t EraseCount;
+    uint32_t Live;              /*< Bytes of records still referenced by the index >*/
+} KV_SectorTypeDef;
+
+/**
+ * @brief: Store
+ */
+typedef struct
+{
+    FDEV_DeviceTypeDef  *Dev;
+    uint32_t            *Index;         /*< KeyCount entries, offsets in the region >*/
+    uint32_t            KeyCount;
+    uint32_t            Head;           /*< Sector taking appends >*/
+    uint32_t            HeadUsed;       /*< Next append offset in the head sector >*/
+    uint32_t            LiveBytes;      /*< Sum of KV_SectorTypeDef.Live >*/
+    uint32_t            Capacity;       /*< LiveBytes limit that keeps reclaim possible >*/
+    KV_SectorTypeDef    Sectors[KV_MAX_SECTORS];
+    uint32_t            Sets;           /*< Statistics: records appended, sectors reclaimed >*/
+    uint32_t            Reclaims;
+} KV_StoreTypeDef;
+
+/*------------------------------ Store APIs ----------------------------------*/
+HAL_StatusTypeDef KV_Mount(KV_StoreTypeDef *Kv, FDEV_DeviceTypeDef *Dev, uint32_t *Index, uint32_t KeyCount);
+HAL_StatusTypeDef KV_Set(KV_StoreTypeDef *Kv, uint32_t Key, const void *Value, uint32_t Length);
+HAL_StatusTypeDef KV_Get(KV_StoreTypeDef *Kv, uint32_t Key, void *Value, uint32_t Size, uint32_t *Length);
+HAL_StatusTypeDef KV_Delete(KV_StoreTypeDef *Kv, uint32_t Key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _KVSTORE_H_
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef _LCD_H_
+#define _LCD_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   8080 parallel LCD on an FSMC bank, 16-bit RGB565, with DMA blits
+ * @note    The controller (ILI9341, ST7789, ILI9486, ... any MIPI DCS one on a 16-bit
+ *          8080 bus) sits on an FSMC NOR/SRAM bank: CS on NEx, WR on NWE, RD on NOE, and
+ *          D/C (RS) on one address line, e.g. A16 (PD11). A write to the bank base is a
+ *          command, a write with the RS line set is data: every pixel is a single store,
+ *          the FSMC generates the strobes.
+ *
+ *          LCD_Blit() and LCD_Fill() hand the pixels to a DMA2 stream, memory-to-memory
+ *          from the framebuffer to the data address, and return at once. Regions larger
+ *          than one DMA transfer (65535 pixels) or narrower than their framebuffer rows
+ *          are sent in several transfers, chained from the stream interrupt.
+ *          LCD_BlitCpltCallback() runs when the last one is done. DMA2 can't reach the
+ *          CCM RAM: framebuffers must be in SRAM or flash.
+ *
+ *          Timing comes from the controller datasheet and is converted to HCLK cycles:
+ *          write cycle and WR low time, read cycle and RD low time. Reads are usually
+ *          several times slower, they get their own timing (FSMC extended mode).
+ *
+ *          The panel init sequence (reset, sleep out, pixel format, orientation) is
+ *          controller specific and left to the caller: LCD_Command(). The FSMC and DMA2
+ *          clocks and the pins are set up by the caller. LCD_Init() installs
+ *          LCD_DMA_IRQHandler() in the RAM vector table.
+ */
+
+#define LCD_DCS_CASET           0x2AU       /*< Column address set >*/
+#define LCD_DCS_RASET           0x2BU       /*< Row (page) address set >*/
+#define LCD_DCS_RAMWR           0x2CU       /*< Memory write >*/
+
+#define LCD_DMA_MAX             0xFFFFU     /*< Pixels per DMA transfer >*/
+
+/**
+ * @brief: Panel and bus configuration
+ */
+typedef struct
+{
+    uint32_t            Bank;               /*< FSMC_NORSRAM_BANK1 ~ 4, on the LCD CS >*/
+    uint32_t            RsLine;             /*< FSMC address line on D/C (RS), 0 ~ 24 >*/
+    uint32_t            Width;              /*< Pixels, as currently oriented >*/
+    uint32_t            Height;
+    uint32_t            WriteCycleNs;       /*< twc >*/
+    uint32_t            WriteLowNs;         /*< twrl, WR low >*/
+    uint32_t            ReadCycleNs;        /*< trc (trcfm for frame memory reads) >*/
+    uint32_t            ReadLowNs;          /*< trdl, RD low >*/
+    DMA_Stream_TypeDef  *DmaStream;         /*< DMA2_Stream0 ~ 7: only DMA2 does memory to memory >*/
+    uint32_t            DmaPreemptPriority;
+} LCD_InitTypeDef;
+
+/*------------------------------ LCD APIs ----------------------------------*/
+HAL_StatusTypeDef LCD_Init(const LCD_InitTypeDef *Init);
+HAL_StatusTypeDef LCD_UpdateClock(void);
+HAL_StatusTypeDef LCD_SetSize(uint32_t Width, uint32_t Height);
+
+void LCD_WriteCommand(uint16_t Command);
+void LCD_WriteData(uint16_t Data);
+uint16_t LCD_ReadData(void);
+HAL_StatusTypeDef LCD_Command(uint8_t Command, const uint8_t *Params, uint32_t Count);
+HAL_StatusTypeDef LCD_SetWindow(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height);
+
+HAL_StatusTypeDef LCD_Blit(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height,
+                           const uint16_t *Pixels, uint32_t Stride);
+HAL_StatusTypeDef LCD_Fill(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, uint16_t Color);
+uint32_t LCD_IsBusy(void);
+HAL_StatusTypeDef LCD_WaitIdle(uint32_t Timeout);
+void LCD_BlitCpltCallback(HAL_StatusTypeDef Status);
+
+void LCD_DMA_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _LCD_H_
\ No newline at end of file
@@ -0,0 +1,68 @@
+#ifndef _LFQUEUE_H_
+#define _LFQUEUE_H_
+
+#include <stdint.h>
+#include "atomic.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @brief   Lock-free queues for interrupt to thread communication
+ * @note    Both queues are bounded, copy fixed-size items and take the storage from the
+ *          caller. Size (number of items) must be a power of 2.
+ *
+ *          LFQ_Spsc: one producer, one consumer, e.g. one UART RX interrupt feeding one
+ *          thread. Push and pop are wait-free: each side only writes its own index.
+ *
+ *          LFQ_Mpsc: any number of producers (interrupts of different priorities, threads)
+ *          and one consumer. A producer claims a slot with a compare-and-swap on Head and
+ *          publishes it through the slot sequence number, so a producer preempted between
+ *          the two only delays the consumer at that slot, never corrupts the queue.
+ *          Items come out in slot claim order.
+ */
+
+/**
+ * @brief: Single producer / single consumer ring
+ */
+typedef struct
+{
+    uint8_t             *Buffer;        /*< Size * ItemSize bytes >*/
+    uint32_t            ItemSize;       /*< bytes >*/
+    uint32_t            Mask;           /*< Size - 1 >*/
+    ATOMIC_U32TypeDef   Head;           /*< Written by the producer only >*/
+    ATOMIC_U32TypeDef   Tail;           /*< Written by the consumer only >*/
+} LFQ_SpscTypeDef;
+
+/**
+ * @brief: Multi producer / single consumer queue
+ */
+typedef struct
+{
+    uint8_t             *Buffer;        /*< Size * ItemSize bytes >*/
+    ATOMIC_U32TypeDef   *Seq;           /*< Size sequence numbers, one per slot >*/
+    uint32_t            ItemSize;       /*< bytes >*/
+    uint32_t            Mask;           /*< Size - 1 >*/
+    ATOMIC_U32TypeDef   Head;           /*< Next slot to claim (producers) >*/
+    ATOMIC_U32TypeDef   Tail;           /*< Next slot to read (consumer) >*/
+    ATOMIC_U32TypeDef   Dropped;        /*< Pushes rejected because the queue was full >*/
+} LFQ_MpscTypeDef;
+
+/*------------------------------ SPSC APIs ----------------------------------*/
+uint32_t LFQ_SpscInit(LFQ_SpscTypeDef *Queue, void *Buffer, uint32_t ItemSize, uint32_t Size);
+uint32_t LFQ_SpscPush(LFQ_SpscTypeDef *Queue, const void *Item);
+uint32_t LFQ_SpscPop(LFQ_SpscTypeDef *Queue, void *Item);
+uint32_t LFQ_SpscCount(LFQ_SpscTypeDef *Queue);
+
+/*------------------------------ MPSC APIs ----------------------------------*/
+uint32_t LFQ_MpscInit(LFQ_MpscTypeDef *Queue, void *Buffer, ATOMIC_U32TypeDef *Seq, uint32_t ItemSize, uint32_t Size);
+uint32_t LFQ_MpscPush(LFQ_MpscTypeDef *Queue, const void *Item);
+uint32_t LFQ_MpscPop(LFQ_MpscTypeDef *Queue, void *Item);
+uint32_t LFQ_MpscCount(LFQ_MpscTypeDef *Queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _LFQUEUE_H_
\ No newline at end of file
@@ -0,0 +1,63 @@
+#ifndef _MEMSTAT_H_
+#define _MEMSTAT_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   RAM use measured at run time: main stack and heap peaks, heap fragmentation
+ * @note    Reset_Handler paints the RAM between the heap start (_end) and the top of the
+ *          main stack with MEM_PAINT, right after .data and .bss are set up. The kernel
+ *          does the same for each thread stack. A word that still holds the pattern was never
+ *          written, so the deepest stack use is where the paint stops.
+ *
+ *          MEM_GetStackPeak() remembers the deepest word found and only scans below it,
+ *          until MEM_PAINT_RUN untouched words in a row. Each call costs about as much as
+ *          the stack grew since the last one. Stack left unwritten by a function (a large
+ *          local buffer only partly filled) is not seen. Thread stacks are small and
+ *          are scanned in full, see K_ThreadStackPeak().
+ *
+ *          Heap peak is the highest break _sbrk() ever gave out. newlib never returns
+ *          memory below it to the stack. Headroom is the RAM between that break and the
+ *          deepest main stack word: what neither has ever touched. This is the margin
+ *          _Min_Heap_Size and _Min_Stack_Size only guess.
+ *
+ *          Tools/mem/map_report.py gives the static side: section sizes per module
+ *          from the linker map.
+ */
+
+#define MEM_PAINT               0xA5A5A5A5U /*< Also hard-coded in the startup code >*/
+#define MEM_PAINT_RUN           16U         /*< Painted words in a row that end a stack scan >*/
+
+/**
+ * @brief: RAM use, bytes
+ */
+typedef struct
+{
+    uint32_t StackPeak;         /*< Deepest main stack use (_estack - lowest written word) >*/
+    uint32_t StackReserved;     /*< _Min_Stack_Size >*/
+    uint32_t HeapPeak;          /*< Highest heap break - _end >*/
+    uint32_t HeapArena;         /*< Current break - _end >*/
+    uint32_t HeapInUse;         /*< Allocated, allocator overhead included >*/
+    uint32_t HeapFree;          /*< Free inside the arena >*/
+    uint32_t HeapTopFree;       /*< Free chunk at the top of the arena >*/
+    uint32_t HeapFreeChunks;    /*< Free chunks below the top: holes >*/
+    uint32_t Fragmentation;     /*< Free bytes in holes, % of HeapFree >*/
+    uint32_t Headroom;          /*< Never touched by heap nor main stack >*/
+} MEM_StatsTypeDef;
+
+/*------------------------------ Memory statistics APIs ----------------------------------*/
+void MEM_Paint(uint32_t *Base, uint32_t Size);
+uint32_t MEM_Unused(const uint32_t *Base, uint32_t Size);
+
+uint32_t MEM_GetStackPeak(void);
+void MEM_GetStats(MEM_StatsTypeDef *Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _MEMSTAT_H_
\ No newline at end of file
@@ -0,0 +1,126 @@
+#ifndef _POWER_H_
+#define _POWER_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   Idle power manager: SLEEP or STOP, picked from the time to the next deadline
+ * @note    The idle loop calls PM_Idle() with interrupts masked and the time left until
+ *          the next thing it must do. The deepest state that fits is entered:
+ *          - PM_STATE_SLEEP: WFI, clocks running, wakes in a few cycles
+ *          - PM_STATE_STOP: STOP on the main regulator, flash kept on
+ *          - PM_STATE_STOP_LP: STOP on the low-power regulator with the flash powered
+ *            down, lowest current and slowest wake
+ *          A STOP state fits when the budget covers its break-even residency plus its
+ *          wake latency. The RTC wakeup timer (EXTI line 22, runs on LSE or LSI) is armed
+ *          to fire one wake latency before the deadline, so the clocks are back in time.
+ *
+ *          STOP stops the PLL and the peripheral clocks. It is not entered while a DMA
+ *          stream or the Ethernet DMA is enabled, nor while a state is held: drivers
+ *          with work in flight that no EXTI line can report (UART reception, ADC
+ *          conversions, CAN...) call PM_Hold(PM_STATE_STOP) and PM_Release() around it.
+ *          PM_Hold(PM_STATE_STOP_LP) only keeps the wake latency short.
+ *
+ *          After STOP the core runs on HSI. HSE and the PLL are restarted first thing,
+ *          the flash wait states are never lowered (the latency for the PLL speed is
+ *          kept while on HSI) so SYSCLK goes back to the PLL in one switch, and no
+ *          interrupt runs before that because PRIMASK is set.
+ *
+ *          Wake latency (wakeup timer event -> clocks restored) is measured on the RTC
+ *          at every timer wake; the worst seen replaces the initial value for the
+ *          decision. Time in each state is measured on the RTC (STOP) and on the DWT
+ *          cycle counter (SLEEP, DWT runs on FCLK).
+ *
+ *          SysTick and the timers stand still in STOP: PM_Idle() returns the time slept
+ *          for the caller to move its timebase forward. With the scheduler (sched.h),
+ *          the caller is its idle hook, already entered with interrupts masked and
+ *          nothing ready; with swtimer.h on a 1 ms tick:
+ *
+ *              void SCHED_IdleHook(void)
+ *              {
+ *                  uint32_t next = SWT_GetNextDeadline();
+ *                  uint32_t slept = PM_Idle((next == SWT_NO_DEADLINE) ? PM_FOREVER : (next * 1000U));
+ *
+ *                  tick += slept / 1000U;
+ *              }
+ *
+ *          A main loop of its own does the same between __disable_irq() and
+ *          __enable_irq(), once it has checked that no work is left.
+ *
+ *          PM_Init() owns the RTC: prescaler, shadow registers bypassed and wakeup timer.
+ *          It installs PM_RTC_WKUP_IRQHandler() in the RAM vector table.
+ */
+
+#define PM_FOREVER              0xFFFFFFFFU     /*< PM_Idle() budget: no deadline >*/
+
+#define PM_RTC_LSE              0U              /*< 32.768 kHz crystal >*/
+#define PM_RTC_LSI              1U              /*< Internal RC, 17 ~ 47 kHz: give its measured frequency >*/
+
+/**
+ * @brief: Idle states, shallow to deep
+ */
+typedef enum
+{
+    PM_STATE_SLEEP      = 0x00U,
+    PM_STATE_STOP       = 0x01U,
+    PM_STATE_STOP_LP    = 0x02U
+} PM_StateTypeDef;
+
+#define PM_STATE_COUNT          3U
+
+/**
+ * @brief: Power manager configuration
+ */
+typedef struct
+{
+    uint32_t RtcClock;                      /*< PM_RTC_LSE or PM_RTC_LSI >*/
+    uint32_t RtcFreq;                       /*< RTCCLK, Hz: 32768 for LSE >*/
+    uint32_t PreemptPriority;               /*< RTC wakeup interrupt >*/
+    uint32_t MinResidencyUs[PM_STATE_COUNT];/*< Break-even: shortest stay that saves energy >*/
+    uint32_t WakeUs[PM_STATE_COUNT];        /*< Wake latency assumed until a larger one is measured >*/
+} PM_InitTypeDef;
+
+/**
+ * @brief: Statistics of one state
+ */
+typedef struct
+{
+    uint32_t Entries;
+    uint32_t TimerWakes;        /*< Woken by the wakeup timer, the others by an interrupt >*/
+    uint64_t ResidencyUs;       /*< Time in the state, wake included >*/
+    uint32_t WakeLastUs;        /*< Wakeup timer event -> clocks restored, last and worst >*/
+    uint32_t WakeMaxUs;
+} PM_StateStatsTypeDef;
+
+/**
+ * @brief: Power manager statistics
+ */
+typedef struct
+{
+    PM_StateStatsTypeDef State[PM_STATE_COUNT];
+    uint32_t Vetoes;            /*< Budget fit STOP but a hold or a DMA kept it out >*/
+    uint32_t ClockErrors;       /*< HSE or PLL did not come back, left on HSI >*/
+} PM_StatsTypeDef;
+
+/*------------------------------ Power manager APIs ----------------------------------*/
+HAL_StatusTypeDef PM_Init(const PM_InitTypeDef *Init);
+uint32_t PM_Idle(uint32_t BudgetUs);
+
+void PM_Hold(PM_StateTypeDef State);
+void PM_Release(PM_StateTypeDef State);
+
+uint32_t PM_GetWakeLatency(PM_StateTypeDef State);
+void PM_GetStats(PM_StatsTypeDef *Stats);
+void PM_ResetStats(void);
+
+void PM_RTC_WKUP_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _POWER_H_
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   Statistical PC-sampling profiler on TIM7
+ * @note    The TIM7 update interrupt takes the PC and LR of the interrupted code from
+ *          its exception frame (PSP or MSP, from EXC_RETURN) and appends them to a ring.
+ *          No function has to be instrumented: over many samples, the share of samples
+ *          in a function is its share of CPU time. LR gives the caller while the sampled
+ *          function has not reused it. The host tool checks each LR against the call
+ *          instruction before it and drops the callers that don't hold up.
+ *
+ *          Give TIM7 a priority above the code to profile, ideally the highest, so that
+ *          ISRs get sampled too. Code running with interrupts masked (PRIMASK, or BASEPRI
+ *          at or above the profiler priority) can't be sampled: its time shows up on
+ *          the instruction that unmasks. The period is dithered by up to 1/16 so that
+ *          sampling does not lock onto periodic work such as a 1 kHz tick.
+ *
+ *          Read out: dump the RAM, then run Tools/prof/prof_flame.py with the dump and
+ *          the ELF. It writes a flame graph (SVG), folded stacks and a hot-spot table.
+ *          Addresses are looked up in the ELF symbols, so it works with code in flash
+ *          (STM32F407VGTX_FLASH.ld), in RAM (STM32F407VGTX_RAM.ld) and for .RamFunc.
+ *
+ *          PROF_Init() installs PROF_TIM_IRQHandler() in the RAM vector table. TIM7
+ *          clock must be enabled by the caller (__HAL_RCC_TIM7_CLK_ENABLE()).
+ */
+
+#ifndef PROF_DEPTH
+#define PROF_DEPTH              2048U       /*< Samples kept, power of 2 >*/
+#endif
+
+#define PROF_MAGIC              0x31465250U /*< "PRF1" >*/
+#define PROF_PC_HANDLER         0x1U        /*< Set in Pc: sampled in handler mode (an ISR) >*/
+
+#define PROF_RATE_MIN           16U         /*< Hz >*/
+#define PROF_RATE_MAX           100000U
+
+/**
+ * @brief: One sample
+ */
+typedef struct
+{
+    uint32_t Pc;                /*< Interrupted instruction, bit 0 = PROF_PC_HANDLER >*/
+    uint32_t Lr;                /*< LR of the interrupted code: caller, stale, or EXC_RETURN >*/
+} PROF_SampleTypeDef;
+
+/**
+ * @brief: Sample ring as laid out in RAM, read by the host tool
+ */
+typedef struct
+{
+    uint32_t Magic;             /*< PROF_MAGIC >*/
+    uint32_t Depth;             /*< PROF_DEPTH >*/
+    uint32_t Check;             /*< Magic ^ Depth ^ address of Sample >*/
+    uint32_t RateHz;
+    __IO uint32_t Head;         /*< Samples ever taken, the next goes to Sample[Head % Depth] >*/
+    uint32_t Reserved;
+    PROF_SampleTypeDef Sample[PROF_DEPTH];
+} PROF_BufferTypeDef;
+
+/*------------------------------ Profiler APIs ----------------------------------*/
+HAL_StatusTypeDef PROF_Init(uint32_t RateHz, uint32_t PreemptPriority);
+HAL_StatusTypeDef PROF_Start(void);
+HAL_StatusTypeDef PROF_Stop(void);
+void PROF_Reset(void);
+const PROF_BufferTypeDef *PROF_GetBuffer(void);
+
+void PROF_TIM_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _PROFILER_H_
\ No newline at end of file
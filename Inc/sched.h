@@ -0,0 +1,62 @@
+#ifndef _SCHED_H_
+#define _SCHED_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+#include "lfqueue.h"
+
+/**
+ * @brief   Run-to-completion priority scheduler
+ * @note    One task per priority level, SCHED_PRIORITY_MAX levels, higher value runs first.
+ *          SCHED_Post() (thread or ISR) queues an event for a task in a lock-free MPSC
+ *          queue, sets its bit in the ready mask and pends PendSV. PendSV (lowest priority) dispatches: it picks the
+ *          highest ready level with CLZ and runs the task handler to completion, once per
+ *          queued event. Tasks never block, do not preempt each other, and are preempted
+ *          by every interrupt. When nothing is ready SCHED_Run() calls SCHED_IdleHook(),
+ *          WFI by default, PM_Idle() when overridden for the power manager.
+ *
+ *          SCHED_Init() installs the PendSV handler in the RAM vector table,
+ *          so it cannot be used together with the preemptive kernel.
+ */
+
+#define SCHED_PRIORITY_MAX      32U     /*< Ready mask is one word >*/
+
+typedef void (*SCHED_TaskFuncTypeDef)(uint32_t Event);
+
+/**
+ * @brief: Task control block
+ * @note   Event storage is provided by the caller: QueueSize events and as many
+ *         sequence numbers, QueueSize must be a power of 2.
+ */
+typedef struct
+{
+    SCHED_TaskFuncTypeDef Handler;
+    uint32_t            Priority;       /*< 0 ~ SCHED_PRIORITY_MAX - 1 >*/
+    LFQ_MpscTypeDef     Events;         /*< Posted events, rejected ones counted in Events.Dropped >*/
+
+    /* Statistics */
+    uint32_t            RunCount;
+    uint32_t            LastCycles;     /*< Execution time of the last run, core cycles >*/
+    uint32_t            WcetCycles;     /*< Worst-case execution time seen, core cycles >*/
+    ATOMIC_U32TypeDef   QueueMax;       /*< Highest queue depth seen >*/
+} SCHED_TaskTypeDef;
+
+/*------------------------------ Scheduler APIs ----------------------------------*/
+HAL_StatusTypeDef SCHED_Init(void);
+HAL_StatusTypeDef SCHED_TaskCreate(SCHED_TaskTypeDef *Task, uint32_t Priority, SCHED_TaskFuncTypeDef Handler,
+                                   uint32_t *Queue, ATOMIC_U32TypeDef *Seq, uint32_t QueueSize);
+HAL_StatusTypeDef SCHED_Post(SCHED_TaskTypeDef *Task, uint32_t Event);
+void SCHED_Run(void) __attribute__((noreturn));
+void SCHED_IdleHook(void);
+
+uint32_t SCHED_GetReadyMask(void);
+void SCHED_ResetStats(SCHED_TaskTypeDef *Task);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _SCHED_H_
\ No newline at end of file
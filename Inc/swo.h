@@ -0,0 +1,109 @@
+#ifndef _SWO_H_
+#define _SWO_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   ITM trace output over SWO (PB3)
+ * @note    A stimulus port write puts a packet into the ITM FIFO. The TPIU then sends it
+ *          out on the SWO pin as NRZ (UART-like) at HCLK / (ACPR + 1), with the formatter
+ *          bypassed, and the core does not wait for it. A write costs a few cycles, so it
+ *          can be used in ISRs. The access width (8, 16 or 32-bit) sets the payload size.
+ *
+ *          Channels:
+ *          - SWO_PORT_LOG: text, 4 characters per 32-bit write. This is port 0, the one
+ *            SWO viewers show as a console.
+ *          - SWO_PORT_EVENT: markers. A 16-bit write is an event id alone, a 32-bit
+ *            write is an id (upper half) with a 16-bit argument.
+ *          - SWO_PORT_WATCH + n: 32-bit value of watch slot n.
+ *
+ *          SWO_Event*() and SWO_Watch() never wait: when the FIFO is full the packet is
+ *          dropped and they return 0. SWO_Log*() waits for room (bounded), so it is
+ *          meant for thread context.
+ *
+ *          SWO_Init() sets up the TPIU and ITM from the current HCLK. Call SWO_UpdateClock()
+ *          after a HCLK change. The probe must sample at SWO_GetBaudRate(). PB3 is TRACESWO
+ *          after reset; if it was remapped, map it back with GPIO_MUX_TRACESWO_PB3.
+ *          With SWO_STDIO defined, _write() (printf) goes to the log channel.
+ *
+ *          Tools/swo/swo_decode.py decodes a captured SWO byte stream.
+ */
+
+#define SWO_PORT_LOG            0U
+#define SWO_PORT_EVENT          1U
+#define SWO_PORT_WATCH          8U          /*< Watch slot n is port 8 + n >*/
+#define SWO_WATCH_SLOTS         8U
+
+#define SWO_PORTS_ALL           ((1UL << SWO_PORT_LOG) | (1UL << SWO_PORT_EVENT) | \
+                                 (((1UL << SWO_WATCH_SLOTS) - 1U) << SWO_PORT_WATCH))
+
+/**
+ * @brief: SWO configuration
+ */
+typedef struct
+{
+    uint32_t BaudRate;          /*< SWO bit rate, at most HCLK >*/
+    uint32_t PortMask;          /*< Stimulus ports enabled, e.g. SWO_PORTS_ALL >*/
+    uint32_t Timestamps;        /*< ENABLE: local timestamp packets, in core cycles >*/
+} SWO_InitTypeDef;
+
+/*------------------------------ SWO APIs ----------------------------------*/
+HAL_StatusTypeDef SWO_Init(const SWO_InitTypeDef *Init);
+HAL_StatusTypeDef SWO_UpdateClock(void);
+uint32_t SWO_GetBaudRate(void);
+
+void SWO_Log(const char *Str);
+void SWO_LogWrite(const char *Data, uint32_t Len);
+
+/**
+ * @brief   Non-blocking stimulus port writes
+ * @note    The FIFO check and the write run with interrupts masked, so that a
+ *          preempting write can't fill the FIFO between the two and make this one
+ *          get lost.
+ * @retval  1 if sent, 0 if the port is disabled or the FIFO is full
+ */
+#define SWO_WRITE_DEFINE(WIDTH, TYPE, MEMBER)                               \
+__STATIC_INLINE uint32_t SWO_Write##WIDTH(uint32_t Port, TYPE Value)        \
+{                                                                           \
+    uint32_t primask, sent = 0U;                                            \
+                                                                            \
+    if ((ITM->TER & (1UL << Port)) != 0U) {                                 \
+        primask = __get_PRIMASK();                                          \
+        __disable_irq();                                                    \
+        if (ITM->PORT[Port].u32 != 0U) {                                    \
+            ITM->PORT[Port].MEMBER = Value;                                 \
+            sent = 1U;                                                      \
+        }                                                                   \
+        __set_PRIMASK(primask);                                             \
+    }                                                                       \
+    return sent;                                                            \
+}
+
+SWO_WRITE_DEFINE(8, uint8_t, u8)
+SWO_WRITE_DEFINE(16, uint16_t, u16)
+SWO_WRITE_DEFINE(32, uint32_t, u32)
+
+__STATIC_INLINE uint32_t SWO_Event(uint16_t Id)
+{
+    return SWO_Write16(SWO_PORT_EVENT, Id);
+}
+
+__STATIC_INLINE uint32_t SWO_EventArg(uint16_t Id, uint16_t Arg)
+{
+    return SWO_Write32(SWO_PORT_EVENT, ((uint32_t)Id << 16U) | Arg);
+}
+
+__STATIC_INLINE uint32_t SWO_Watch(uint32_t Slot, uint32_t Value)
+{
+    return SWO_Write32(SWO_PORT_WATCH + Slot, Value);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _SWO_H_
\ No newline at end of file
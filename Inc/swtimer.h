@@ -0,0 +1,80 @@
+#ifndef _SWTIMER_H_
+#define _SWTIMER_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   Software timers on a hierarchical timing wheel
+ * @note    SWT_LEVELS wheels of SWT_WHEEL_SIZE slots: level 0 holds timers due within
+ *          64 ticks, level n those due within 64^(n+1) ticks. When the lower wheel wraps,
+ *          the next slot of the upper wheel is cascaded down. Start, stop and expiry
+ *          are O(1) list operations (cascading moves each timer at most SWT_LEVELS - 1
+ *          times), whatever the number of timers.
+ *
+ *          The wheel is driven by SWT_Advance() with the current tick of the system
+ *          timebase (e.g. K_GetTick() from the kernel tick). Expired timers are moved to
+ *          a pending list and SWT_ExpiredHook() is called; their callbacks run later from
+ *          SWT_Process(), in whatever deferred context the application picks (a
+ *          scheduler task, a thread, the main loop). SWT_GetNextDeadline() tells a
+ *          tickless timebase how long it may sleep.
+ *
+ *          Timeouts are limited to SWT_MAX_TIMEOUT ticks.
+ */
+
+#define SWT_WHEEL_BITS          6U
+#define SWT_WHEEL_SIZE          (1UL << SWT_WHEEL_BITS)
+#define SWT_LEVELS              4U
+#define SWT_MAX_TIMEOUT         0x7FFFFFFFUL
+#define SWT_NO_DEADLINE         0xFFFFFFFFUL    /*< SWT_GetNextDeadline(): no timer running >*/
+
+/**
+ * @brief: Timer state
+ */
+typedef enum
+{
+    SWT_STATE_IDLE      = 0x00U,
+    SWT_STATE_ARMED     = 0x01U,    /*< On the wheel >*/
+    SWT_STATE_PENDING   = 0x02U,    /*< Expired, callback not run yet >*/
+} SWT_StateTypeDef;
+
+struct SWT_Timer;
+typedef void (*SWT_CallbackTypeDef)(struct SWT_Timer *Timer, void *Arg);
+
+/**
+ * @brief: Timer, storage provided by the caller
+ */
+typedef struct SWT_Timer
+{
+    struct SWT_Timer    *Next;
+    struct SWT_Timer    *Prev;
+    uint32_t            Expires;        /*< Absolute tick >*/
+    uint32_t            Period;         /*< 0 = one-shot >*/
+    SWT_CallbackTypeDef Callback;
+    void                *Arg;
+    uint8_t             State;          /*< SWT_StateTypeDef >*/
+    uint8_t             Level;          /*< Position on the wheel while armed >*/
+    uint8_t             Slot;
+} SWT_TimerTypeDef;
+
+/*------------------------------ Timer APIs ----------------------------------*/
+HAL_StatusTypeDef SWT_Init(uint32_t Now, uint32_t PreemptPriority);
+HAL_StatusTypeDef SWT_Create(SWT_TimerTypeDef *Timer, SWT_CallbackTypeDef Callback, void *Arg);
+HAL_StatusTypeDef SWT_Start(SWT_TimerTypeDef *Timer, uint32_t Timeout, uint32_t Period);
+HAL_StatusTypeDef SWT_Stop(SWT_TimerTypeDef *Timer);
+uint32_t SWT_IsActive(const SWT_TimerTypeDef *Timer);
+uint32_t SWT_GetActiveCount(void);
+
+uint32_t SWT_Advance(uint32_t Now);
+uint32_t SWT_Process(void);
+uint32_t SWT_GetNextDeadline(void);
+void SWT_ExpiredHook(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _SWTIMER_H_
\ No newline at end of file
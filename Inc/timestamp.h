@@ -0,0 +1,44 @@
+#ifndef _TIMESTAMP_H_
+#define _TIMESTAMP_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   64-bit hardware timestamps on TIM2 or TIM5
+ * @note    The 32-bit counter runs at the full timer clock (PSC = 0) and is extended
+ *          to 64 bits by counting update events. Input capture channels latch the
+ *          counter on GPIO edges in hardware, so the timestamp does not depend on
+ *          interrupt latency. Map the pin to the channel first, e.g. with
+ *          GPIO_MUX_TIM2_CH1_PA0 / GPIO_MUX_TIM5_CH1_PA0.
+ *
+ *          TS_Init() installs TS_IRQHandler() in the RAM vector table.
+ */
+
+#define TS_CAPTURE_DEPTH        8U      /*< Timestamps buffered per capture channel, power of 2 >*/
+
+/*------------------------------ Timestamp APIs ----------------------------------*/
+HAL_StatusTypeDef TS_Init(TIM_TypeDef *TIMx, uint32_t PreemptPriority);
+void TS_Resync(void);
+uint32_t TS_GetClockFreq(void);
+
+uint64_t TS_GetTicks(void);
+uint64_t TS_TicksToNs(uint64_t Ticks);
+uint64_t TS_GetNs(void);
+
+HAL_StatusTypeDef TS_CaptureStart(uint32_t Channel, uint32_t Polarity, uint32_t Filter);
+HAL_StatusTypeDef TS_CaptureStop(uint32_t Channel);
+uint32_t TS_CaptureRead(uint32_t Channel, uint64_t *pTimestamp);
+uint32_t TS_CaptureGetOverruns(uint32_t Channel);
+void TS_CaptureCallback(uint32_t Channel, uint64_t Timestamp);
+
+void TS_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _TIMESTAMP_H_
\ No newline at end of file
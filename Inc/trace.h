@@ -0,0 +1,122 @@
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   Event trace recorder: cycle-stamped events in a RAM ring that survives reset
+ * @note    An event is 8 bytes: DWT CYCCNT and one info word (kind, id, 16-bit argument).
+ *          Recording one masks interrupts for a few instructions (index, two stores), so
+ *          it can stay enabled in production firmware and be called from any ISR.
+ *          Events are in order in the ring, and their timestamps are too.
+ *
+ *          The ring is in .noinit, which the startup code does not clear. TRC_Init() keeps
+ *          what a previous run recorded if the header is intact and the reset was not a
+ *          power-on or brown-out one. It then appends a TRC_ID_RESET marker with the RCC_CSR
+ *          reset flags and clears them (RMVF), so that the next reset reports its own cause:
+ *          code that needs the flags reads RCC_CSR before TRC_Init(), or reads the marker.
+ *          TRC_Freeze() stops recording, e.g. from a fault handler, and the ring stays
+ *          frozen across resets until TRC_Clear(). The events that led up to a crash or
+ *          a watchdog reset can be read out afterwards.
+ *
+ *          The HAL records through HAL_TRACE() (see stm32f4xx_hal_conf.h), compiled in
+ *          with USE_HAL_TRACE. HAL_GPIO_Init and HAL_GPIO_EXTI_IRQHandler record, and
+ *          so do thread switches in the kernel. Handlers add their own spans with
+ *          TRC_IsrEnter() / TRC_IsrExit(), and drivers add state changes with
+ *          TRC_ID_USER ids.
+ *
+ *          Read out: dump the RAM (e.g. gdb "dump binary memory ram.bin 0x20000000
+ *          0x20020000") and convert it with Tools/trace/trace2perfetto.py. It finds the
+ *          ring by its header and writes Chrome trace JSON for ui.perfetto.dev or
+ *          chrome://tracing.
+ */
+
+#ifndef TRC_DEPTH
+#define TRC_DEPTH               1024U       /*< Events kept, power of 2 >*/
+#endif
+
+#define TRC_MAGIC               0x31435254U /*< "TRC1" >*/
+
+/**
+ * @defgroup TRC_Kind
+ * @note    BEGIN/END pairs with the same id nest on one track, as preemption does.
+ */
+#define TRC_KIND_INSTANT        0U
+#define TRC_KIND_BEGIN          1U
+#define TRC_KIND_END            2U
+#define TRC_KIND_COUNTER        3U          /*< Argument is the new value >*/
+
+/**
+ * @defgroup TRC_Id
+ * @note    14 bits. The converter names the ids below, plus TRC_ID_USER and up
+ *          when given a name.
+ */
+#define TRC_ID_RESET            0x0001U     /*< Arg: RCC_CSR >> 24 (reset flags) >*/
+#define TRC_ID_ISR              0x0002U     /*< Arg: exception number (IRQn + 16) >*/
+#define TRC_ID_THREAD           0x0003U     /*< Arg: thread control block address >> 2 >*/
+#define TRC_ID_EXTI             0x0010U     /*< Arg: pin mask >*/
+#define TRC_ID_GPIO_INIT        0x0020U     /*< + port index, Arg: pin mask >*/
+#define TRC_ID_USER             0x1000U
+
+#define TRC_INFO(KIND, ID, ARG) ((((uint32_t)(KIND) & 0x3U) << 30U) | (((uint32_t)(ID) & 0x3FFFU) << 16U) | \
+                                 ((uint32_t)(ARG) & 0xFFFFU))
+
+/**
+ * @brief: One event
+ */
+typedef struct
+{
+    uint32_t Cycles;            /*< DWT CYCCNT >*/
+    uint32_t Info;              /*< Kind 31-30, id 29-16, argument 15-0, see TRC_INFO() >*/
+} TRC_EventTypeDef;
+
+/**
+ * @brief: Ring as laid out in RAM, read by the host converter
+ */
+typedef struct
+{
+    uint32_t Magic;             /*< TRC_MAGIC >*/
+    uint32_t Depth;             /*< TRC_DEPTH >*/
+    uint32_t Check;             /*< Magic ^ Depth ^ address of Event: header is not stale RAM >*/
+    uint32_t CpuHz;             /*< HCLK at TRC_Init(), CYCCNT rate >*/
+    __IO uint32_t Head;         /*< Events ever recorded, the next goes to Event[Head % Depth] >*/
+    __IO uint32_t Frozen;
+    TRC_EventTypeDef Event[TRC_DEPTH];
+} TRC_BufferTypeDef;
+
+/*------------------------------ Trace APIs ----------------------------------*/
+void TRC_Init(void);
+void TRC_Record(uint32_t Info);
+void TRC_Freeze(void);
+void TRC_Clear(void);
+const TRC_BufferTypeDef *TRC_GetBuffer(void);
+
+__STATIC_INLINE void TRC_Instant(uint32_t Id, uint32_t Arg)
+{
+    TRC_Record(TRC_INFO(TRC_KIND_INSTANT, Id, Arg));
+}
+
+__STATIC_INLINE void TRC_Counter(uint32_t Id, uint32_t Value)
+{
+    TRC_Record(TRC_INFO(TRC_KIND_COUNTER, Id, Value));
+}
+
+__STATIC_INLINE void TRC_IsrEnter(void)
+{
+    TRC_Record(TRC_INFO(TRC_KIND_BEGIN, TRC_ID_ISR, __get_IPSR()));
+}
+
+__STATIC_INLINE void TRC_IsrExit(void)
+{
+    TRC_Record(TRC_INFO(TRC_KIND_END, TRC_ID_ISR, __get_IPSR()));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _TRACE_H_
\ No newline at end of file
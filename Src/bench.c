@@ -0,0 +1,558 @@
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef BENCH_HOST
+#include <time.h>
+#else
+#include "kernel.h"
+#endif
+
+/**
+ * @brief: Private macros
+ */
+#define BENCH_TIMER_DWT         0U
+#define BENCH_TIMER_SYSTICK     1U
+#define BENCH_TIMER_NS          2U          /*< Host monotonic clock >*/
+
+#define BENCH_IRQn              RNG_IRQn    /*< Pended by software for the latency case, unused otherwise >*/
+#define BENCH_SYS_WRITE0        0x04U       /*< Semihosting: write a zero-terminated string >*/
+#define BENCH_SYS_EXIT          0x18U       /*< Semihosting: end of the program >*/
+#define BENCH_ADP_EXIT          0x20026U    /*< ADP_Stopped_ApplicationExit >*/
+#define BENCH_LINE_MAX          192U
+#define BENCH_K_PRIORITY        2U          /*< Suite thread and its peer, equal: K_Yield() alternates them >*/
+
+/* Keep the compiler from dropping or merging the work under test */
+#define BENCH_BARRIER(PTR)      __asm__ volatile ("" : : "r"(PTR) : "memory")
+
+/**
+ * @brief: Suite state
+ */
+typedef struct
+{
+    uint32_t    Timer;              /*< BENCH_TIMER_xxx >*/
+    uint32_t    Overhead;           /*< Ticks of two back to back BENCH_Now() >*/
+    __IO uint32_t IrqStamp;
+    __IO uint32_t IrqFired;
+} BENCH_TypeDef;
+
+static BENCH_TypeDef bench;
+
+/* Work areas */
+static uint32_t benchSrc[4096U / 4U];
+static uint32_t benchDst[4096U / 4U];
+static uint16_t benchSamples[256];
+static uint32_t benchDualSamples[256];
+static DAC_DDSTypeDef benchDds[2];
+#ifdef BENCH_HOST
+static GPIO_TypeDef benchGpio;              /*< Register file of the simulated port >*/
+#define BENCH_GPIO              (&benchGpio)
+#else
+#define BENCH_GPIO              GPIOD
+static K_ThreadTypeDef benchThread;
+static K_ThreadTypeDef benchPeer;
+static uint32_t benchThreadStack[2048U / 4U] __attribute__((aligned(8)));
+static uint32_t benchPeerStack[512U / 4U] __attribute__((aligned(8)));
+#endif
+
+/**
+ * @brief: Private functions
+ */
+static void BENCH_TimerInit(void);
+static uint32_t BENCH_Elapsed(uint32_t Start, uint32_t End);
+static void BENCH_Print(const char *Text);
+static void BENCH_Exit(void) __attribute__((noreturn));
+static void BENCH_Report(const BENCH_CaseTypeDef *Case, const BENCH_ResultTypeDef *Result, uint32_t First);
+static uint32_t BENCH_GpioInit(uint32_t Iterations);
+static uint32_t BENCH_GpioWrite(uint32_t Iterations);
+static uint32_t BENCH_GpioToggle(uint32_t Iterations);
+static uint32_t BENCH_Memcpy16(uint32_t Iterations);
+static uint32_t BENCH_Memcpy256(uint32_t Iterations);
+static uint32_t BENCH_Memcpy4096(uint32_t Iterations);
+static uint32_t BENCH_Memset256(uint32_t Iterations);
+static uint32_t BENCH_Memset4096(uint32_t Iterations);
+static uint32_t BENCH_Dds256(uint32_t Iterations);
+static uint32_t BENCH_DdsDual256(uint32_t Iterations);
+static uint32_t BENCH_MallocFree32(uint32_t Iterations);
+static uint32_t BENCH_MallocFree512(uint32_t Iterations);
+#ifndef BENCH_HOST
+static uint32_t BENCH_IrqLatency(uint32_t Iterations);
+static void BENCH_IrqHandler(void);
+static uint32_t BENCH_KernelYield(uint32_t Iterations);
+static uint32_t BENCH_KernelPendSV(uint32_t Iterations);
+static void BENCH_KernelStart(uint32_t First);
+static void BENCH_KernelThread(void *Arg);
+static void BENCH_PeerThread(void *Arg);
+#endif
+
+/**
+ * @brief: The suite, in report order
+ */
+static const BENCH_CaseTypeDef benchCases[] =
+{
+    { "gpio_init",          BENCH_GpioInit,         100U,   0U,     0U },
+    { "gpio_write",         BENCH_GpioWrite,        1000U,  0U,     0U },
+    { "gpio_toggle",        BENCH_GpioToggle,       1000U,  0U,     0U },
+#ifndef BENCH_HOST
+    { "irq_latency",        BENCH_IrqLatency,       16U,    0U,     1U },
+#endif
+    { "memcpy_16",          BENCH_Memcpy16,         1000U,  16U,    0U },
+    { "memcpy_256",         BENCH_Memcpy256,        200U,   256U,   0U },
+    { "memcpy_4096",        BENCH_Memcpy4096,       20U,    4096U,  0U },
+    { "memset_256",         BENCH_Memset256,        200U,   256U,   0U },
+    { "memset_4096",        BENCH_Memset4096,       20U,    4096U,  0U },
+    { "dds_sine_256",       BENCH_Dds256,           20U,    0U,     0U },
+    { "dds_dual_256",       BENCH_DdsDual256,       20U,    0U,     0U },
+    { "malloc_free_32",     BENCH_MallocFree32,     200U,   0U,     0U },
+    { "malloc_free_512",    BENCH_MallocFree512,    200U,   0U,     0U },
+};
+
+#ifndef BENCH_HOST
+/**
+ * @brief: Run last, from a kernel thread: once started the kernel keeps the CPU
+ */
+static const BENCH_CaseTypeDef benchKernelCases[] =
+{
+    { "k_yield",            BENCH_KernelYield,      32U,    0U,     0U },
+    { "k_pendsv",           BENCH_KernelPendSV,     32U,    0U,     1U },
+};
+#endif
+
+/*------------------------------------------- Suite -------------------------------------------*/
+/**
+ * @brief   Run every case and report the JSON document, then end the program
+ */
+void BENCH_Run(void)
+{
+    static const char * const timers[] = { "dwt", "systick", "ns" };
+    BENCH_ResultTypeDef result;
+    char line[BENCH_LINE_MAX];
+    uint32_t i, first = 1U;
+
+    BENCH_TimerInit();
+    benchDds[0].Waveform = DAC_DDS_WAVE_SINE;
+    benchDds[0].Increment = HAL_DACEx_DDSTuningWord(1000U, 100000U);
+    benchDds[0].Amplitude = 2047U;
+    benchDds[0].Offset = 2048U;
+    benchDds[1] = benchDds[0];
+    benchDds[1].Waveform = DAC_DDS_WAVE_TRIANGLE;
+#ifndef BENCH_HOST
+    __HAL_RCC_GPIOD_CLK_ENABLE();
+#endif
+
+    (void)snprintf(line, sizeof(line),
+                   "{\"suite\":\"stm32f407-hal\",\"target\":\"%s\",\"timer\":\"%s\",\"clock_hz\":%lu,\"samples\":%lu,\"results\":[\n",
+#ifdef BENCH_HOST
+                   "host", timers[bench.Timer], 1000000000UL,
+#else
+                   "stm32f407", timers[bench.Timer], (unsigned long)HAL_RCC_GetHCLKFreq(),
+#endif
+                   (unsigned long)BENCH_SAMPLES);
+    BENCH_Print(line);
+
+    for (i = 0U; i < (sizeof(benchCases) / sizeof(benchCases[0])); i++)
+    {
+        if (BENCH_RunCase(&benchCases[i], &result) != HAL_OK) {
+            continue;
+        }
+        BENCH_Report(&benchCases[i], &result, first);
+        first = 0U;
+    }
+#ifndef BENCH_HOST
+    BENCH_KernelStart(first);       /* Returns only if the kernel cannot start */
+#endif
+    BENCH_Print("\n]}\n");
+    BENCH_Exit();
+}
+
+/**
+ * @brief   One warm-up and BENCH_SAMPLES timed samples of a case
+ * @param   Result - Per operation, hundredths of a tick
+ * @retval  HAL_ERROR if the case cannot run here (e.g. vector table not in RAM)
+ */
+HAL_StatusTypeDef BENCH_RunCase(const BENCH_CaseTypeDef *Case, BENCH_ResultTypeDef *Result)
+{
+    uint32_t samples[BENCH_SAMPLES];
+    uint32_t i, j, start, ticks, value;
+
+    for (i = 0U; i <= BENCH_SAMPLES; i++)
+    {
+        start = BENCH_Now();
+        ticks = Case->Run(Case->Iterations);
+        if (Case->SelfTimed == 0U) {
+            ticks = BENCH_Elapsed(start, BENCH_Now());
+            ticks = (ticks > bench.Overhead) ? (ticks - bench.Overhead) : 0U;
+        }
+        else if (ticks == 0xFFFFFFFFU) {
+            return HAL_ERROR;
+        }
+        if (i == 0U) {
+            continue;       /* warm-up: caches, allocator, branch history */
+        }
+
+        /* Insertion sort as the samples come */
+        value = (uint32_t)(((uint64_t)ticks * 100U) / Case->Iterations);
+        for (j = i - 1U; (j > 0U) && (samples[j - 1U] > value); j--) {
+            samples[j] = samples[j - 1U];
+        }
+        samples[j] = value;
+    }
+    Result->Min = samples[0];
+    Result->Median = samples[BENCH_SAMPLES / 2U];
+    Result->Max = samples[BENCH_SAMPLES - 1U];
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Current tick of the suite timer (cycles on target, ns on the host)
+ */
+uint32_t BENCH_Now(void)
+{
+#ifdef BENCH_HOST
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+#else
+    if (bench.Timer == BENCH_TIMER_DWT) {
+        return DWT->CYCCNT;
+    }
+    return SysTick->LOAD - SysTick->VAL;
+#endif
+}
+
+/*------------------------------------------- Cases -------------------------------------------*/
+static uint32_t BENCH_GpioInit(uint32_t Iterations)
+{
+    GPIO_InitTypeDef init = {0};
+
+    init.Pin = GPIO_PIN_12 | GPIO_PIN_13 | GPIO_PIN_14 | GPIO_PIN_15;
+    init.Mode = GPIO_MODE_OUTPUT_PP;
+    init.Pull = GPIO_NOPULL;
+    init.Speed = GPIO_SPEED_FREQ_HIGH;
+    while (Iterations-- != 0U) {
+        HAL_GPIO_Init(BENCH_GPIO, &init);
+    }
+    return 0U;
+}
+
+static uint32_t BENCH_GpioWrite(uint32_t Iterations)
+{
+    for (; Iterations >= 2U; Iterations -= 2U)
+    {
+        HAL_GPIO_WritePin(BENCH_GPIO, GPIO_PIN_12, GPIO_PIN_SET);
+        HAL_GPIO_WritePin(BENCH_GPIO, GPIO_PIN_12, GPIO_PIN_RESET);
+    }
+    return 0U;
+}
+
+static uint32_t BENCH_GpioToggle(uint32_t Iterations)
+{
+    while (Iterations-- != 0U) {
+        HAL_GPIO_TogglePin(BENCH_GPIO, GPIO_PIN_13);
+    }
+    return 0U;
+}
+
+static uint32_t BENCH_Memcpy16(uint32_t Iterations)
+{
+    while (Iterations-- != 0U) {
+        memcpy(benchDst, benchSrc, 16U);
+        BENCH_BARRIER(benchDst);
+    }
+    return 0U;
+}
+
+static uint32_t BENCH_Memcpy256(uint32_t Iterations)
+{
+    while (Iterations-- != 0U) {
+        memcpy(benchDst, benchSrc, 256U);
+        BENCH_BARRIER(benchDst);
+    }
+    return 0U;
+}
+
+static uint32_t BENCH_Memcpy4096(uint32_t Iterations)
+{
+    while (Iterations-- != 0U) {
+        memcpy(benchDst, benchSrc, 4096U);
+        BENCH_BARRIER(benchDst);
+    }
+    return 0U;
+}
+
+static uint32_t BENCH_Memset256(uint32_t Iterations)
+{
+    while (Iterations-- != 0U) {
+        memset(benchDst, (int)Iterations, 256U);
+        BENCH_BARRIER(benchDst);
+    }
+    return 0U;
+}
+
+static uint32_t BENCH_Memset4096(uint32_t Iterations)
+{
+    while (Iterations-- != 0U) {
+        memset(benchDst, (int)Iterations, 4096U);
+        BENCH_BARRIER(benchDst);
+    }
+    return 0U;
+}
+
+static uint32_t BENCH_Dds256(uint32_t Iterations)
+{
+    while (Iterations-- != 0U) {
+        HAL_DACEx_DDSSynthesize(&benchDds[0], benchSamples, 256U);
+        BENCH_BARRIER(benchSamples);
+    }
+    return 0U;
+}
+
+static uint32_t BENCH_DdsDual256(uint32_t Iterations)
+{
+    while (Iterations-- != 0U) {
+        HAL_DACEx_DDSSynthesizeDual(&benchDds[0], &benchDds[1], benchDualSamples, 256U);
+        BENCH_BARRIER(benchDualSamples);
+    }
+    return 0U;
+}
+
+static uint32_t BENCH_MallocFree32(uint32_t Iterations)
+{
+    void *p;
+
+    while (Iterations-- != 0U) {
+        p = malloc(32U);
+        BENCH_BARRIER(p);
+        free(p);
+    }
+    return 0U;
+}
+
+static uint32_t BENCH_MallocFree512(uint32_t Iterations)
+{
+    void *p;
+
+    while (Iterations-- != 0U) {
+        p = malloc(512U);
+        BENCH_BARRIER(p);
+        free(p);
+    }
+    return 0U;
+}
+
+#ifndef BENCH_HOST
+/**
+ * @brief   Pend an interrupt by software and time it to the handler's first read of the timer
+ * @note    Includes the STIR write, the 12-cycle exception entry and the handler call.
+ * @retval  Ticks of all Iterations, 0xFFFFFFFF if the vector table is not in RAM
+ */
+static uint32_t BENCH_IrqLatency(uint32_t Iterations)
+{
+    pNVIC_HandlerTypeDef previous;
+    uint32_t start, total = 0U;
+
+    if (HAL_NVIC_SetVector(BENCH_IRQn, BENCH_IrqHandler, &previous) != HAL_OK) {
+        return 0xFFFFFFFFU;
+    }
+    HAL_NVIC_SetPriority(BENCH_IRQn, 0U, 0U);
+    HAL_NVIC_EnableIRQ(BENCH_IRQn);
+
+    while (Iterations-- != 0U)
+    {
+        bench.IrqFired = 0U;
+        start = BENCH_Now();
+        WRITE_REG(NVIC->STIR, (uint32_t)BENCH_IRQn);
+        while (bench.IrqFired == 0U) {
+        }
+        total += BENCH_Elapsed(start, bench.IrqStamp);
+    }
+
+    HAL_NVIC_DisableIRQ(BENCH_IRQn);
+    (void)HAL_NVIC_SetVector(BENCH_IRQn, previous, NULL);
+    return total;
+}
+
+static void BENCH_IrqHandler(void)
+{
+    bench.IrqStamp = BENCH_Now();
+    bench.IrqFired = 1U;
+}
+
+/**
+ * @brief   K_Yield() from one thread to another of the same priority: the whole path,
+ *          call, ready list update, PendSV and return in the other thread
+ * @note    Each K_Yield() here is two switches, to the peer and back.
+ */
+static uint32_t BENCH_KernelYield(uint32_t Iterations)
+{
+    for (; Iterations >= 2U; Iterations -= 2U) {
+        K_Yield();
+    }
+    return 0U;
+}
+
+/**
+ * @brief   The PendSV part of a switch, as K_GetStats() reports it (LastSwitchCycles)
+ * @retval  Cycles of the Iterations switches into this thread, 0xFFFFFFFF if CYCCNT
+ *          does not count (the kernel measures with it)
+ */
+static uint32_t BENCH_KernelPendSV(uint32_t Iterations)
+{
+    K_StatsTypeDef stats;
+    uint32_t total = 0U;
+
+    if (bench.Timer != BENCH_TIMER_DWT) {
+        return 0xFFFFFFFFU;
+    }
+    while (Iterations-- != 0U)
+    {
+        K_Yield();
+        K_GetStats(&stats);
+        total += stats.LastSwitchCycles;
+    }
+    return total;
+}
+
+/**
+ * @brief   Start the kernel with the suite thread and its peer, the suite thread ends the run
+ * @note    K_Init() needs the vector table in RAM, like the interrupt case. The kernel
+ *          takes SysTick over: BENCH_Elapsed() follows its reload value.
+ */
+static void BENCH_KernelStart(uint32_t First)
+{
+    HAL_NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_4);
+    if ((K_Init() != HAL_OK) ||
+        (K_ThreadCreate(&benchThread, "bench", BENCH_KernelThread, (void *)(uintptr_t)First,
+                        benchThreadStack, sizeof(benchThreadStack), BENCH_K_PRIORITY) != HAL_OK) ||
+        (K_ThreadCreate(&benchPeer, "peer", BENCH_PeerThread, NULL,
+                        benchPeerStack, sizeof(benchPeerStack), BENCH_K_PRIORITY) != HAL_OK)) {
+        return;
+    }
+    K_Start();
+}
+
+static void BENCH_KernelThread(void *Arg)
+{
+    BENCH_ResultTypeDef result;
+    uint32_t i, first = (uint32_t)(uintptr_t)Arg;
+
+    for (i = 0U; i < (sizeof(benchKernelCases) / sizeof(benchKernelCases[0])); i++)
+    {
+        if (BENCH_RunCase(&benchKernelCases[i], &result) != HAL_OK) {
+            continue;
+        }
+        BENCH_Report(&benchKernelCases[i], &result, first);
+        first = 0U;
+    }
+    BENCH_Print("\n]}\n");
+    BENCH_Exit();
+}
+
+/* Created after the suite thread, so it runs only when that one yields */
+static void BENCH_PeerThread(void *Arg)
+{
+    UNUSED(Arg);
+    for (;;) {
+        K_Yield();
+    }
+}
+#endif
+
+/*------------------------------------------- Private functions -------------------------------------------*/
+/* DWT when CYCCNT counts, else SysTick free-running on the core clock */
+static void BENCH_TimerInit(void)
+{
+    uint32_t i, start;
+
+#ifdef BENCH_HOST
+    bench.Timer = BENCH_TIMER_NS;
+#else
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+    start = DWT->CYCCNT;
+    __NOP(); __NOP(); __NOP(); __NOP();
+    if (DWT->CYCCNT != start)
+    {
+        bench.Timer = BENCH_TIMER_DWT;
+    }
+    else
+    {
+        SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+        SysTick->VAL = 0U;
+        SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+        bench.Timer = BENCH_TIMER_SYSTICK;
+    }
+#endif
+
+    bench.Overhead = 0xFFFFFFFFU;
+    for (i = 0U; i < 8U; i++)
+    {
+        start = BENCH_Now();
+        start = BENCH_Elapsed(start, BENCH_Now());
+        if (start < bench.Overhead) {
+            bench.Overhead = start;
+        }
+    }
+}
+
+/* SysTick counts down from LOAD: 24 bits for the suite, the tick period once the kernel runs */
+static uint32_t BENCH_Elapsed(uint32_t Start, uint32_t End)
+{
+#ifndef BENCH_HOST
+    if ((bench.Timer == BENCH_TIMER_SYSTICK) && (End < Start)) {
+        return End + SysTick->LOAD + 1U - Start;
+    }
+#endif
+    return End - Start;
+}
+
+/* One result object of the JSON document */
+static void BENCH_Report(const BENCH_CaseTypeDef *Case, const BENCH_ResultTypeDef *Result, uint32_t First)
+{
+    char line[BENCH_LINE_MAX];
+
+    (void)snprintf(line, sizeof(line),
+                   "%s{\"name\":\"%s\",\"iterations\":%lu,\"bytes\":%lu,\"min\":%lu.%02lu,\"median\":%lu.%02lu,\"max\":%lu.%02lu}",
+                   (First != 0U) ? "" : ",\n", Case->Name,
+                   (unsigned long)Case->Iterations, (unsigned long)Case->Bytes,
+                   (unsigned long)(Result->Min / 100U), (unsigned long)(Result->Min % 100U),
+                   (unsigned long)(Result->Median / 100U), (unsigned long)(Result->Median % 100U),
+                   (unsigned long)(Result->Max / 100U), (unsigned long)(Result->Max % 100U));
+    BENCH_Print(line);
+}
+
+static void BENCH_Print(const char *Text)
+{
+#ifdef BENCH_HOST
+    (void)fputs(Text, stdout);
+#else
+    register uint32_t r0 __asm__("r0") = BENCH_SYS_WRITE0;
+    register const char *r1 __asm__("r1") = Text;
+
+    __asm__ volatile ("bkpt 0xAB" : "+r"(r0) : "r"(r1) : "memory");
+#endif
+}
+
+static void BENCH_Exit(void)
+{
+#ifdef BENCH_HOST
+    (void)fflush(stdout);
+    exit(0);
+#else
+    register uint32_t r0 __asm__("r0") = BENCH_SYS_EXIT;
+    register uint32_t r1 __asm__("r1") = BENCH_ADP_EXIT;
+
+    __asm__ volatile ("bkpt 0xAB" : "+r"(r0) : "r"(r1) : "memory");
+    for (;;) {
+    }
+#endif
+}
+
+#ifdef BENCH_HOST
+int main(void)
+{
+    BENCH_Run();
+}
+#endif
\ No newline at end of file
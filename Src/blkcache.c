@@ -0,0 +1,529 @@
+#include "blkcache.h"
+#include <string.h>
+
+/**
+ * @brief: Private macros
+ */
+#define BLKC_OP_NONE            0U
+#define BLKC_OP_READ            1U
+#define BLKC_OP_WRITE           2U
+#define BLKC_OP_ERASE           3U
+
+#define BLKC_MAX_SLOTS          32768U
+#define BLKC_BUCKET(CACHE, LBA) ((LBA) & ((CACHE)->SlotCount - 1U))
+#define BLKC_DATA(CACHE, SLOT)  (&(CACHE)->Data[(SLOT) * BLK_BLOCK_SIZE])
+
+/**
+ * @brief: Private functions
+ */
+static uint32_t BLKC_Lookup(BLKC_CacheTypeDef *Cache, uint32_t Lba);
+static void BLKC_Insert(BLKC_CacheTypeDef *Cache, uint32_t Slot, uint32_t Lba);
+static void BLKC_Remove(BLKC_CacheTypeDef *Cache, uint32_t Slot);
+static void BLKC_Drop(BLKC_CacheTypeDef *Cache, uint32_t Slot);
+static void BLKC_Touch(BLKC_SlotTypeDef *Slot);
+static HAL_StatusTypeDef BLKC_Poll(BLKC_CacheTypeDef *Cache);
+static HAL_StatusTypeDef BLKC_Wait(BLKC_CacheTypeDef *Cache);
+static uint32_t BLKC_Follows(BLKC_CacheTypeDef *Cache, uint32_t Prev, uint32_t Next);
+static HAL_StatusTypeDef BLKC_StartWrite(BLKC_CacheTypeDef *Cache, uint32_t Slot);
+static HAL_StatusTypeDef BLKC_StartWriteBack(BLKC_CacheTypeDef *Cache);
+static uint32_t BLKC_Victim(BLKC_CacheTypeDef *Cache);
+static HAL_StatusTypeDef BLKC_Fill(BLKC_CacheTypeDef *Cache, uint32_t Lba, uint32_t *Slot);
+
+/*------------------------------------------- Init -------------------------------------------*/
+/**
+ * @brief   Set up an empty cache
+ * @param   Data - SlotCount * BLK_BLOCK_SIZE bytes, word aligned (DMA)
+ * @param   Slots - SlotCount descriptors
+ * @param   SlotCount - Power of 2, 2 ~ 32768
+ * @param   ReadAhead - Extra blocks fetched on a sequential read miss, 0 = none
+ * @note    DirtyThreshold starts at half the slots: big enough for long runs, and leaves
+ *          the other half to absorb writes while a run is being written back.
+ */
+HAL_StatusTypeDef BLKC_Init(BLKC_CacheTypeDef *Cache, BLK_DeviceTypeDef *Device, void *Data,
+                            BLKC_SlotTypeDef *Slots, uint32_t SlotCount, uint32_t ReadAhead)
+{
+    uint32_t i;
+
+    if ((Cache == NULL) || (Device == NULL) || (Data == NULL) || (Slots == NULL) ||
+        (SlotCount < 2U) || (SlotCount > BLKC_MAX_SLOTS) || ((SlotCount & (SlotCount - 1U)) != 0U) ||
+        (((uintptr_t)Data & 3U) != 0U)) {
+        return HAL_ERROR;
+    }
+    memset(Cache, 0, sizeof(*Cache));
+    Cache->Device = Device;
+    Cache->Data = (uint8_t *)Data;
+    Cache->Slots = Slots;
+    Cache->SlotCount = SlotCount;
+    Cache->ReadAhead = ReadAhead;
+    Cache->DirtyThreshold = SlotCount / 2U;
+    Cache->NextRead = 0xFFFFFFFFUL;
+
+    for (i = 0U; i < SlotCount; i++) {
+        Slots[i].Lba = 0U;
+        Slots[i].Next = BLKC_NIL;
+        Slots[i].Head = BLKC_NIL;
+        Slots[i].Flags = 0U;
+    }
+
+    return HAL_OK;
+}
+
+/*------------------------------------------- Access -------------------------------------------*/
+/**
+ * @brief   Read blocks through the cache
+ * @note    Each miss costs one device command (plus read-ahead in the same command), and
+ *          may have to wait for a write-back in flight first.
+ */
+HAL_StatusTypeDef BLKC_Read(BLKC_CacheTypeDef *Cache, uint32_t Lba, void *Buffer, uint32_t Count)
+{
+    uint8_t *dst = (uint8_t *)Buffer;
+    uint32_t slot;
+
+    if ((Count > Cache->Device->BlockCount) || (Lba > (Cache->Device->BlockCount - Count))) {
+        return HAL_ERROR;
+    }
+    for (; Count != 0U; Count--, Lba++, dst += BLK_BLOCK_SIZE)
+    {
+        slot = BLKC_Lookup(Cache, Lba);
+        if (slot != BLKC_NIL) {
+            Cache->Stats.Hits++;
+            BLKC_Touch(&Cache->Slots[slot]);
+        }
+        else {
+            Cache->Stats.Misses++;
+            if (BLKC_Fill(Cache, Lba, &slot) != HAL_OK) {
+                return HAL_ERROR;
+            }
+        }
+        memcpy(dst, BLKC_DATA(Cache, slot), BLK_BLOCK_SIZE);
+        Cache->NextRead = Lba + 1U;
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Write blocks into the cache
+ * @note    Whole blocks only, so a miss never reads the device. Returns once the data is
+ *          in the cache; it reaches the device through the background write-back or
+ *          BLKC_Flush(). Stalls only when no slot is free or clean, i.e. when the device
+ *          is slower than the writer.
+ */
+HAL_StatusTypeDef BLKC_Write(BLKC_CacheTypeDef *Cache, uint32_t Lba, const void *Buffer, uint32_t Count)
+{
+    const uint8_t *src = (const uint8_t *)Buffer;
+    BLKC_SlotTypeDef *s;
+    uint32_t slot;
+
+    if ((Count > Cache->Device->BlockCount) || (Lba > (Cache->Device->BlockCount - Count))) {
+        return HAL_ERROR;
+    }
+    for (; Count != 0U; Count--, Lba++, src += BLK_BLOCK_SIZE)
+    {
+        slot = BLKC_Lookup(Cache, Lba);
+        if (slot != BLKC_NIL)
+        {
+            Cache->Stats.Hits++;
+            BLKC_Touch(&Cache->Slots[slot]);
+            /* Being written back: the device may still be reading it */
+            while ((Cache->Slots[slot].Flags & BLKC_SLOT_BUSY) != 0U) {
+                Cache->Stats.Stalls++;
+                (void)BLKC_Wait(Cache);
+            }
+        }
+        else
+        {
+            Cache->Stats.Misses++;
+            slot = BLKC_Victim(Cache);
+            if (slot == BLKC_NIL) {
+                return HAL_ERROR;
+            }
+            BLKC_Insert(Cache, slot, Lba);
+        }
+        s = &Cache->Slots[slot];
+        memcpy(BLKC_DATA(Cache, slot), src, BLK_BLOCK_SIZE);
+        if ((s->Flags & BLKC_SLOT_DIRTY) == 0U) {
+            Cache->DirtyCount++;
+        }
+        s->Flags |= BLKC_SLOT_VALID | BLKC_SLOT_DIRTY;
+
+        /* Start the write-back as soon as there is enough for a long run */
+        if (Cache->DirtyCount >= Cache->DirtyThreshold) {
+            (void)BLKC_Service(Cache);
+        }
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Tell the device a range is about to be rewritten
+ * @note    The cached copies of the range are dropped (dirty ones included, the range's
+ *          content is undefined afterwards) and the device erases it in the background,
+ *          e.g. the next file extent of a logger. Devices without Erase ignore it.
+ */
+HAL_StatusTypeDef BLKC_PreErase(BLKC_CacheTypeDef *Cache, uint32_t Lba, uint32_t Count)
+{
+    uint32_t i;
+
+    if ((Count == 0U) || (Count > Cache->Device->BlockCount) || (Lba > (Cache->Device->BlockCount - Count))) {
+        return HAL_ERROR;
+    }
+    if (BLKC_Wait(Cache) == HAL_ERROR) {
+        return HAL_ERROR;
+    }
+    for (i = 0U; i < Cache->SlotCount; i++) {
+        if (((Cache->Slots[i].Flags & BLKC_SLOT_VALID) != 0U) &&
+            ((Cache->Slots[i].Lba - Lba) < Count)) {
+            BLKC_Drop(Cache, i);
+        }
+    }
+    if (Cache->Device->Erase == NULL) {
+        return HAL_OK;
+    }
+    if (Cache->Device->Erase(Cache->Device, Lba, Count) != HAL_OK) {
+        Cache->Stats.Errors++;
+        return HAL_ERROR;
+    }
+    Cache->BusyOp = BLKC_OP_ERASE;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Write every dirty block back and wait for the device
+ */
+HAL_StatusTypeDef BLKC_Flush(BLKC_CacheTypeDef *Cache)
+{
+    for (;;)
+    {
+        if (BLKC_Wait(Cache) == HAL_ERROR) {
+            return HAL_ERROR;
+        }
+        if (Cache->DirtyCount == 0U) {
+            return HAL_OK;
+        }
+        if (BLKC_StartWriteBack(Cache) != HAL_OK) {
+            return HAL_ERROR;
+        }
+    }
+}
+
+/**
+ * @brief   Background work, never waits: complete the command in flight and start the
+ *          next write-back if DirtyThreshold is reached
+ * @note    Below the threshold dirty blocks stay in the cache, so that they go out in
+ *          long runs; call BLKC_Flush() for durability points (file close, power fail).
+ * @retval  HAL_ERROR once if a command failed (its blocks stay dirty and are retried)
+ */
+HAL_StatusTypeDef BLKC_Service(BLKC_CacheTypeDef *Cache)
+{
+    HAL_StatusTypeDef status = BLKC_Poll(Cache);
+
+    if (status == HAL_ERROR) {
+        return HAL_ERROR;
+    }
+    if ((status == HAL_OK) && (Cache->DirtyCount >= Cache->DirtyThreshold) && (Cache->DirtyCount != 0U)) {
+        return BLKC_StartWriteBack(Cache);
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Drop every block, dirty ones included (e.g. card removed)
+ */
+void BLKC_Invalidate(BLKC_CacheTypeDef *Cache)
+{
+    uint32_t i;
+
+    (void)BLKC_Wait(Cache);
+    for (i = 0U; i < Cache->SlotCount; i++) {
+        Cache->Slots[i].Next = BLKC_NIL;
+        Cache->Slots[i].Head = BLKC_NIL;
+        Cache->Slots[i].Flags = 0U;
+    }
+    Cache->DirtyCount = 0U;
+    Cache->NextRead = 0xFFFFFFFFUL;
+}
+
+/*------------------------------------------- Private functions -------------------------------------------*/
+static uint32_t BLKC_Lookup(BLKC_CacheTypeDef *Cache, uint32_t Lba)
+{
+    uint32_t slot = Cache->Slots[BLKC_BUCKET(Cache, Lba)].Head;
+
+    while ((slot != BLKC_NIL) && (Cache->Slots[slot].Lba != Lba)) {
+        slot = Cache->Slots[slot].Next;
+    }
+    return slot;
+}
+
+static void BLKC_Insert(BLKC_CacheTypeDef *Cache, uint32_t Slot, uint32_t Lba)
+{
+    BLKC_SlotTypeDef *head = &Cache->Slots[BLKC_BUCKET(Cache, Lba)];
+
+    Cache->Slots[Slot].Lba = Lba;
+    Cache->Slots[Slot].Next = head->Head;
+    Cache->Slots[Slot].Flags = BLKC_SLOT_VALID;
+    head->Head = (uint16_t)Slot;
+}
+
+static void BLKC_Remove(BLKC_CacheTypeDef *Cache, uint32_t Slot)
+{
+    uint16_t *link = &Cache->Slots[BLKC_BUCKET(Cache, Cache->Slots[Slot].Lba)].Head;
+
+    while (*link != Slot) {
+        link = &Cache->Slots[*link].Next;
+    }
+    *link = Cache->Slots[Slot].Next;
+    Cache->Slots[Slot].Next = BLKC_NIL;
+}
+
+/* Forget a valid, idle slot */
+static void BLKC_Drop(BLKC_CacheTypeDef *Cache, uint32_t Slot)
+{
+    if ((Cache->Slots[Slot].Flags & BLKC_SLOT_DIRTY) != 0U) {
+        Cache->DirtyCount--;
+    }
+    BLKC_Remove(Cache, Slot);
+    Cache->Slots[Slot].Flags = 0U;
+}
+
+/* Hit: second chance, except on the first use of a read-ahead block, which is its load */
+static void BLKC_Touch(BLKC_SlotTypeDef *Slot)
+{
+    if ((Slot->Flags & BLKC_SLOT_AHEAD) != 0U) {
+        Slot->Flags &= (uint8_t)~BLKC_SLOT_AHEAD;
+    }
+    else {
+        Slot->Flags |= BLKC_SLOT_REF;
+    }
+}
+
+/*
+ * Complete the command in flight once the device is done: a write-back leaves its
+ * slots clean (dirty again for a retry if it failed), a failed read leaves them free.
+ * HAL_BUSY while it runs.
+ */
+static HAL_StatusTypeDef BLKC_Poll(BLKC_CacheTypeDef *Cache)
+{
+    HAL_StatusTypeDef status;
+    uint32_t i;
+
+    if (Cache->BusyOp == BLKC_OP_NONE) {
+        return HAL_OK;
+    }
+    status = Cache->Device->Poll(Cache->Device);
+    if (status == HAL_BUSY) {
+        return HAL_BUSY;
+    }
+
+    for (i = Cache->BusyFirst; i < (Cache->BusyFirst + Cache->BusyCount); i++)
+    {
+        Cache->Slots[i].Flags &= (uint8_t)~BLKC_SLOT_BUSY;
+        if (Cache->BusyOp == BLKC_OP_WRITE) {
+            if (status == HAL_OK) {
+                Cache->Slots[i].Flags &= (uint8_t)~BLKC_SLOT_DIRTY;
+                Cache->DirtyCount--;
+            }
+        }
+        else if (status != HAL_OK) {
+            Cache->Slots[i].Flags = 0U;
+        }
+    }
+    if (status != HAL_OK) {
+        Cache->Stats.Errors++;
+    }
+    Cache->BusyOp = BLKC_OP_NONE;
+    Cache->BusyCount = 0U;
+
+    return status;
+}
+
+static HAL_StatusTypeDef BLKC_Wait(BLKC_CacheTypeDef *Cache)
+{
+    HAL_StatusTypeDef status;
+
+    do {
+        status = BLKC_Poll(Cache);
+    } while (status == HAL_BUSY);
+
+    return status;
+}
+
+/* Next can join Prev's write-back run: both dirty and idle, consecutive blocks */
+static uint32_t BLKC_Follows(BLKC_CacheTypeDef *Cache, uint32_t Prev, uint32_t Next)
+{
+    const BLKC_SlotTypeDef *p = &Cache->Slots[Prev];
+    const BLKC_SlotTypeDef *n = &Cache->Slots[Next];
+
+    return (((p->Flags & (BLKC_SLOT_DIRTY | BLKC_SLOT_BUSY)) == BLKC_SLOT_DIRTY) &&
+            ((n->Flags & (BLKC_SLOT_DIRTY | BLKC_SLOT_BUSY)) == BLKC_SLOT_DIRTY) &&
+            (n->Lba == (p->Lba + 1U))) ? 1U : 0U;
+}
+
+/*
+ * Write back the run of consecutive slots holding consecutive dirty blocks around Slot,
+ * as one command. Runs do not wrap around the end of the slot array (not contiguous).
+ */
+static HAL_StatusTypeDef BLKC_StartWrite(BLKC_CacheTypeDef *Cache, uint32_t Slot)
+{
+    uint32_t max = Cache->Device->MaxBlocks;
+    uint32_t first = Slot;
+    uint32_t last = Slot;
+    uint32_t i;
+
+    while ((first > 0U) && ((last - first + 1U) < max) && (BLKC_Follows(Cache, first - 1U, first) != 0U)) {
+        first--;
+    }
+    while (((last + 1U) < Cache->SlotCount) && ((last - first + 1U) < max) && (BLKC_Follows(Cache, last, last + 1U) != 0U)) {
+        last++;
+    }
+
+    if (Cache->Device->Write(Cache->Device, Cache->Slots[first].Lba, BLKC_DATA(Cache, first), last - first + 1U) != HAL_OK) {
+        Cache->Stats.Errors++;
+        return HAL_ERROR;
+    }
+    for (i = first; i <= last; i++) {
+        Cache->Slots[i].Flags |= BLKC_SLOT_BUSY;
+    }
+    Cache->BusyOp = BLKC_OP_WRITE;
+    Cache->BusyFirst = first;
+    Cache->BusyCount = last - first + 1U;
+    Cache->Stats.WriteCommands++;
+    Cache->Stats.WrittenBlocks += Cache->BusyCount;
+
+    return HAL_OK;
+}
+
+/* Write back the oldest dirty run: the first one ahead of the hand */
+static HAL_StatusTypeDef BLKC_StartWriteBack(BLKC_CacheTypeDef *Cache)
+{
+    uint32_t mask = Cache->SlotCount - 1U;
+    uint32_t i, slot;
+
+    for (i = 0U; i < Cache->SlotCount; i++) {
+        slot = (Cache->Hand + i) & mask;
+        if ((Cache->Slots[slot].Flags & (BLKC_SLOT_DIRTY | BLKC_SLOT_BUSY)) == BLKC_SLOT_DIRTY) {
+            return BLKC_StartWrite(Cache, slot);
+        }
+    }
+    return HAL_OK;
+}
+
+/*
+ * CLOCK: take the first slot at the hand that is free, or clean and not referenced
+ * since the last pass. Dirty slots on the way are written back if the device is idle.
+ * After two full turns without a candidate every slot is dirty or busy: wait for
+ * the command in flight, which frees its run.
+ * The slot is returned free (out of the hash, no flags), BLKC_NIL on device error.
+ */
+static uint32_t BLKC_Victim(BLKC_CacheTypeDef *Cache)
+{
+    uint32_t mask = Cache->SlotCount - 1U;
+    uint32_t scanned = 0U;
+    BLKC_SlotTypeDef *s;
+    uint32_t slot;
+
+    (void)BLKC_Poll(Cache);
+
+    for (;;)
+    {
+        slot = Cache->Hand;
+        s = &Cache->Slots[slot];
+        Cache->Hand = (slot + 1U) & mask;
+
+        if ((s->Flags & BLKC_SLOT_BUSY) != 0U) {
+            /* skip */
+        }
+        else if ((s->Flags & BLKC_SLOT_DIRTY) != 0U) {
+            if (Cache->BusyOp == BLKC_OP_NONE) {
+                (void)BLKC_StartWrite(Cache, slot);
+            }
+        }
+        else if ((s->Flags & BLKC_SLOT_REF) != 0U) {
+            s->Flags &= (uint8_t)~BLKC_SLOT_REF;
+        }
+        else {
+            if ((s->Flags & BLKC_SLOT_VALID) != 0U) {
+                BLKC_Remove(Cache, slot);
+            }
+            s->Flags = 0U;
+            return slot;
+        }
+
+        if (++scanned >= (2U * Cache->SlotCount)) {
+            scanned = 0U;
+            Cache->Stats.Stalls++;
+            if ((Cache->BusyOp == BLKC_OP_NONE) || (BLKC_Wait(Cache) != HAL_OK)) {
+                /* nothing in flight could be started, or it failed */
+                return BLKC_NIL;
+            }
+        }
+    }
+}
+
+/*
+ * Read miss: fetch Lba into a free slot, plus the following blocks into the next slots
+ * if the read is sequential, as far as those slots are reusable (free or clean and not
+ * referenced) and the blocks are not cached yet. One device command.
+ */
+static HAL_StatusTypeDef BLKC_Fill(BLKC_CacheTypeDef *Cache, uint32_t Lba, uint32_t *Slot)
+{
+    BLK_DeviceTypeDef *dev = Cache->Device;
+    uint32_t ahead = (Lba == Cache->NextRead) ? Cache->ReadAhead : 0U;
+    uint32_t slot, count, i;
+    BLKC_SlotTypeDef *s;
+
+    slot = BLKC_Victim(Cache);
+    if (slot == BLKC_NIL) {
+        return HAL_ERROR;
+    }
+    for (count = 1U; count <= ahead; count++)
+    {
+        if (((slot + count) >= Cache->SlotCount) || (count >= dev->MaxBlocks) ||
+            ((Lba + count) >= dev->BlockCount)) {
+            break;
+        }
+        s = &Cache->Slots[slot + count];
+        if (((s->Flags & (BLKC_SLOT_DIRTY | BLKC_SLOT_BUSY | BLKC_SLOT_REF)) != 0U) ||
+            (BLKC_Lookup(Cache, Lba + count) != BLKC_NIL)) {
+            break;
+        }
+        if ((s->Flags & BLKC_SLOT_VALID) != 0U) {
+            BLKC_Remove(Cache, slot + count);
+        }
+        s->Flags = 0U;
+    }
+    Cache->Hand = (slot + count) & (Cache->SlotCount - 1U);
+
+    /* One command at a time: finish a write-back (possibly started by the victim search) */
+    if (BLKC_Wait(Cache) == HAL_ERROR) {
+        return HAL_ERROR;
+    }
+    if (dev->Read(dev, Lba, BLKC_DATA(Cache, slot), count) != HAL_OK) {
+        Cache->Stats.Errors++;
+        return HAL_ERROR;
+    }
+    for (i = 0U; i < count; i++) {
+        Cache->Slots[slot + i].Flags = BLKC_SLOT_BUSY;
+    }
+    Cache->BusyOp = BLKC_OP_READ;
+    Cache->BusyFirst = slot;
+    Cache->BusyCount = count;
+    Cache->Stats.ReadCommands++;
+    Cache->Stats.ReadAheadBlocks += count - 1U;
+
+    if (BLKC_Wait(Cache) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    for (i = 0U; i < count; i++) {
+        BLKC_Insert(Cache, slot + i, Lba + i);
+        if (i != 0U) {
+            Cache->Slots[slot + i].Flags |= BLKC_SLOT_AHEAD;
+        }
+    }
+    *Slot = slot;
+
+    return HAL_OK;
+}
\ No newline at end of file
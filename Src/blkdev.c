@@ -0,0 +1,222 @@
+#include "blkdev.h"
+#include <string.h>
+
+/**
+ * @brief: Private macros
+ */
+#define BLK_OP_NONE             0U
+#define BLK_OP_READ             1U
+#define BLK_OP_WRITE            2U
+#define BLK_OP_ERASE            3U
+
+/**
+ * @brief: Private functions
+ */
+static HAL_StatusTypeDef BLK_RamStart(BLK_RamDeviceTypeDef *Ram, uint32_t Op, uint32_t Lba, void *Buffer, uint32_t Count);
+static HAL_StatusTypeDef BLK_RamRead(BLK_DeviceTypeDef *Dev, uint32_t Lba, void *Buffer, uint32_t Count);
+static HAL_StatusTypeDef BLK_RamWrite(BLK_DeviceTypeDef *Dev, uint32_t Lba, const void *Buffer, uint32_t Count);
+static HAL_StatusTypeDef BLK_RamErase(BLK_DeviceTypeDef *Dev, uint32_t Lba, uint32_t Count);
+static HAL_StatusTypeDef BLK_RamPoll(BLK_DeviceTypeDef *Dev);
+#ifndef BLK_HOST
+static HAL_StatusTypeDef BLK_SdRead(BLK_DeviceTypeDef *Dev, uint32_t Lba, void *Buffer, uint32_t Count);
+static HAL_StatusTypeDef BLK_SdWrite(BLK_DeviceTypeDef *Dev, uint32_t Lba, const void *Buffer, uint32_t Count);
+static HAL_StatusTypeDef BLK_SdErase(BLK_DeviceTypeDef *Dev, uint32_t Lba, uint32_t Count);
+static HAL_StatusTypeDef BLK_SdPoll(BLK_DeviceTypeDef *Dev);
+#endif
+
+/*------------------------------------------- RAM disk -------------------------------------------*/
+/**
+ * @brief   Set up a RAM disk
+ * @param   Storage - BlockCount * BLK_BLOCK_SIZE bytes
+ * @param   MaxBlocks - Largest command, e.g. SD_MAX_XFER_BLOCKS to model the SD card
+ * @param   Latency - Poll() calls each command stays busy, 0 = completes on the first poll
+ */
+HAL_StatusTypeDef BLK_RamInit(BLK_RamDeviceTypeDef *Ram, void *Storage, uint32_t BlockCount,
+                              uint32_t MaxBlocks, uint32_t Latency)
+{
+    if ((Ram == NULL) || (Storage == NULL) || (BlockCount == 0U) || (MaxBlocks == 0U)) {
+        return HAL_ERROR;
+    }
+    memset(Ram, 0, sizeof(*Ram));
+    Ram->Dev.BlockCount = BlockCount;
+    Ram->Dev.MaxBlocks = MaxBlocks;
+    Ram->Dev.Read = BLK_RamRead;
+    Ram->Dev.Write = BLK_RamWrite;
+    Ram->Dev.Erase = BLK_RamErase;
+    Ram->Dev.Poll = BLK_RamPoll;
+    Ram->Storage = (uint8_t *)Storage;
+    Ram->Latency = Latency;
+
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef BLK_RamStart(BLK_RamDeviceTypeDef *Ram, uint32_t Op, uint32_t Lba, void *Buffer, uint32_t Count)
+{
+    if (Ram->Op != BLK_OP_NONE) {
+        return HAL_BUSY;
+    }
+    if ((Count == 0U) || (Count > Ram->Dev.MaxBlocks) || (Lba >= Ram->Dev.BlockCount) ||
+        (Count > (Ram->Dev.BlockCount - Lba))) {
+        return HAL_ERROR;
+    }
+    Ram->Op = Op;
+    Ram->Lba = Lba;
+    Ram->Count = Count;
+    Ram->Buffer = Buffer;
+    Ram->Remaining = Ram->Latency;
+    Ram->Commands++;
+
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef BLK_RamRead(BLK_DeviceTypeDef *Dev, uint32_t Lba, void *Buffer, uint32_t Count)
+{
+    return BLK_RamStart((BLK_RamDeviceTypeDef *)Dev, BLK_OP_READ, Lba, Buffer, Count);
+}
+
+static HAL_StatusTypeDef BLK_RamWrite(BLK_DeviceTypeDef *Dev, uint32_t Lba, const void *Buffer, uint32_t Count)
+{
+    return BLK_RamStart((BLK_RamDeviceTypeDef *)Dev, BLK_OP_WRITE, Lba, (void *)Buffer, Count);
+}
+
+static HAL_StatusTypeDef BLK_RamErase(BLK_DeviceTypeDef *Dev, uint32_t Lba, uint32_t Count)
+{
+    BLK_RamDeviceTypeDef *ram = (BLK_RamDeviceTypeDef *)Dev;
+
+    /* Erase is not limited to MaxBlocks */
+    if ((ram->Op != BLK_OP_NONE) || (Lba >= Dev->BlockCount) || (Count > (Dev->BlockCount - Lba))) {
+        return (ram->Op != BLK_OP_NONE) ? HAL_BUSY : HAL_ERROR;
+    }
+    ram->Op = BLK_OP_ERASE;
+    ram->Lba = Lba;
+    ram->Count = Count;
+    ram->Remaining = ram->Latency;
+    ram->Commands++;
+
+    return HAL_OK;
+}
+
+/* The data moves when the command completes, as with DMA the buffer must not change before */
+static HAL_StatusTypeDef BLK_RamPoll(BLK_DeviceTypeDef *Dev)
+{
+    BLK_RamDeviceTypeDef *ram = (BLK_RamDeviceTypeDef *)Dev;
+    uint8_t *blocks;
+    uint32_t bytes;
+
+    if (ram->Op == BLK_OP_NONE) {
+        return HAL_OK;
+    }
+    if (ram->Remaining != 0U) {
+        ram->Remaining--;
+        return HAL_BUSY;
+    }
+
+    blocks = ram->Storage + (ram->Lba * BLK_BLOCK_SIZE);
+    bytes = ram->Count * BLK_BLOCK_SIZE;
+    switch (ram->Op)
+    {
+        case BLK_OP_READ:
+            memcpy(ram->Buffer, blocks, bytes);
+            ram->BlocksRead += ram->Count;
+            break;
+
+        case BLK_OP_WRITE:
+            memcpy(blocks, ram->Buffer, bytes);
+            ram->BlocksWritten += ram->Count;
+            break;
+
+        default:
+            memset(blocks, 0xFF, bytes);
+            break;
+    }
+    ram->Op = BLK_OP_NONE;
+
+    return HAL_OK;
+}
+
+#ifndef BLK_HOST
+/*------------------------------------------- SD card -------------------------------------------*/
+/**
+ * @brief   Bind a block device to an initialized SD handle (HAL_SD_Init() done)
+ * @note    SDIO_IRQHandler must call HAL_SD_IRQHandler(hsd).
+ */
+HAL_StatusTypeDef BLK_SdInit(BLK_SdDeviceTypeDef *Sd, SD_HandleTypeDef *hsd)
+{
+    if ((Sd == NULL) || (hsd == NULL) || (hsd->State != HAL_SD_STATE_READY)) {
+        return HAL_ERROR;
+    }
+    Sd->Dev.BlockCount = hsd->Card.BlockCount;
+    Sd->Dev.MaxBlocks = SD_MAX_XFER_BLOCKS;
+    Sd->Dev.Read = BLK_SdRead;
+    Sd->Dev.Write = BLK_SdWrite;
+    Sd->Dev.Erase = BLK_SdErase;
+    Sd->Dev.Poll = BLK_SdPoll;
+    Sd->hsd = hsd;
+    Sd->Programming = 0U;
+
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef BLK_SdRead(BLK_DeviceTypeDef *Dev, uint32_t Lba, void *Buffer, uint32_t Count)
+{
+    BLK_SdDeviceTypeDef *sd = (BLK_SdDeviceTypeDef *)Dev;
+
+    return HAL_SD_ReadBlocks_DMA(sd->hsd, (uint8_t *)Buffer, Lba, Count);
+}
+
+static HAL_StatusTypeDef BLK_SdWrite(BLK_DeviceTypeDef *Dev, uint32_t Lba, const void *Buffer, uint32_t Count)
+{
+    BLK_SdDeviceTypeDef *sd = (BLK_SdDeviceTypeDef *)Dev;
+    HAL_StatusTypeDef status = HAL_SD_WriteBlocks_DMA(sd->hsd, (const uint8_t *)Buffer, Lba, Count);
+
+    if (status == HAL_OK) {
+        sd->Programming = 1U;
+    }
+    return status;
+}
+
+static HAL_StatusTypeDef BLK_SdErase(BLK_DeviceTypeDef *Dev, uint32_t Lba, uint32_t Count)
+{
+    BLK_SdDeviceTypeDef *sd = (BLK_SdDeviceTypeDef *)Dev;
+    HAL_StatusTypeDef status;
+
+    if (Count == 0U) {
+        return HAL_ERROR;
+    }
+    status = HAL_SD_Erase(sd->hsd, Lba, Lba + Count - 1U);
+    if (status == HAL_OK) {
+        sd->Programming = 1U;
+    }
+    return status;
+}
+
+/* DMA part from the driver state, then CMD13 until the card is back in transfer state */
+static HAL_StatusTypeDef BLK_SdPoll(BLK_DeviceTypeDef *Dev)
+{
+    BLK_SdDeviceTypeDef *sd = (BLK_SdDeviceTypeDef *)Dev;
+    HAL_SD_CardStateTypeDef state;
+
+    if (HAL_SD_GetState(sd->hsd) == HAL_SD_STATE_BUSY) {
+        return HAL_BUSY;
+    }
+    if (HAL_SD_GetError(sd->hsd) != HAL_SD_ERROR_NONE) {
+        sd->hsd->ErrorCode = HAL_SD_ERROR_NONE;
+        sd->Programming = 0U;
+        return HAL_ERROR;
+    }
+    if (sd->Programming != 0U)
+    {
+        state = HAL_SD_GetCardState(sd->hsd);
+        if ((state == HAL_SD_CARD_PROGRAMMING) || (state == HAL_SD_CARD_RECEIVING)) {
+            return HAL_BUSY;
+        }
+        sd->Programming = 0U;
+        if (state != HAL_SD_CARD_TRANSFER) {
+            sd->hsd->ErrorCode = HAL_SD_ERROR_NONE;
+            return HAL_ERROR;
+        }
+    }
+
+    return HAL_OK;
+}
+#endif
\ No newline at end of file
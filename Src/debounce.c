@@ -0,0 +1,242 @@
+#include "debounce.h"
+
+/**
+ * @brief: Debouncer state
+ */
+typedef struct
+{
+    TIM_HandleTypeDef htim;
+    uint32_t RateHz;
+    __IO uint32_t PortCount;                /*< Ports sampled, grows only >*/
+    uint8_t Slot[GPIO_PORT_I + 1U];         /*< GPIO index -> Port[] index + 1, 0 = not debounced >*/
+    DEB_PortTypeDef Port[DEB_PORTS_MAX];
+} DEB_TypeDef;
+
+static DEB_TypeDef deb;
+
+/** @brief: Private macros */
+#define DEB_TIM                 TIM6
+#define DEB_TICK_HZ             1000000U    /*< Timer counts in µs >*/
+#define DEB_RELEASED_Pos        16U
+
+/** @brief: Private functions */
+static DEB_PortTypeDef *DEB_FindPort(GPIO_TypeDef *GPIOx)
+{
+    uint32_t index = GPIO_GET_INDEX(GPIOx);
+
+    if ((index > GPIO_PORT_I) || (GPIO_PORT_INSTANCE(index) != GPIOx) || (deb.Slot[index] == 0U)) {
+        return NULL;
+    }
+    return &deb.Port[deb.Slot[index] - 1U];
+}
+
+/**
+ * @brief   Write a stable time into the Limit bit planes and restart the counters of Pins
+ */
+static void DEB_SetLimit(DEB_PortTypeDef *Port, uint32_t Pins, uint32_t Samples)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t i;
+
+    __disable_irq();
+    for (i = 0U; i < DEB_COUNTER_BITS; i++) {
+        Port->Limit[i] = (Port->Limit[i] & ~Pins) | ((((Samples >> i) & 1U) != 0U) ? Pins : 0U);
+        Port->Count[i] &= ~Pins;
+    }
+    __set_PRIMASK(primask);
+}
+
+static uint32_t DEB_MsToSamples(uint32_t Ms)
+{
+    uint32_t samples = (uint32_t)((((uint64_t)Ms * deb.RateHz) + 999U) / 1000U);
+
+    return (samples == 0U) ? 1U : samples;
+}
+
+/**
+ * @brief   Set up TIM6 to sample at RateHz, stopped, and forget every port
+ * @param   RateHz          - DEB_RATE_MIN ~ DEB_RATE_MAX, 1 kHz is typical
+ * @param   PreemptPriority - Preemption priority of TIM6
+ * @retval  HAL_ERROR if the rate is out of range or the vector table is not in SRAM
+ */
+HAL_StatusTypeDef DEB_Init(uint32_t RateHz, uint32_t PreemptPriority)
+{
+    uint32_t clk = HAL_TIM_GetClockFreq(DEB_TIM);
+    uint32_t i;
+
+    if ((RateHz < DEB_RATE_MIN) || (RateHz > DEB_RATE_MAX) || (clk < DEB_TICK_HZ)) {
+        return HAL_ERROR;
+    }
+
+    deb.RateHz = RateHz;
+    deb.PortCount = 0U;
+    for (i = 0U; i <= GPIO_PORT_I; i++) {
+        deb.Slot[i] = 0U;
+    }
+
+    deb.htim.Instance = DEB_TIM;
+    deb.htim.Init.Prescaler = (clk / DEB_TICK_HZ) - 1U;
+    deb.htim.Init.CounterMode = TIM_COUNTERMODE_UP;
+    deb.htim.Init.Period = (DEB_TICK_HZ / RateHz) - 1U;
+    deb.htim.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    deb.htim.Init.RepetitionCounter = 0U;
+    deb.htim.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    if (HAL_TIM_Base_Init(&deb.htim) != HAL_OK) {
+        return HAL_ERROR;
+    }
+
+    if (HAL_NVIC_SetVector(TIM6_DAC_IRQn, DEB_TIM_IRQHandler, NULL) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    HAL_NVIC_SetPriority(TIM6_DAC_IRQn, PreemptPriority, 0U);
+    HAL_NVIC_EnableIRQ(TIM6_DAC_IRQn);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Debounce Pins of a port, with the DEB_STABLE_MS_DEFAULT stable time
+ * @note    The pins must already be configured as inputs. Their debounced state starts
+ *          as the current input level, without edges. May be called while sampling.
+ * @param   ActiveLow - Pins that are pressed when low
+ * @retval  HAL_ERROR if the port is already debounced or DEB_PORTS_MAX are in use
+ */
+HAL_StatusTypeDef DEB_AddPort(GPIO_TypeDef *GPIOx, uint16_t Pins, uint16_t ActiveLow)
+{
+    uint32_t index = GPIO_GET_INDEX(GPIOx);
+    uint32_t samples;
+    DEB_PortTypeDef *port;
+    uint32_t i;
+
+    if ((index > GPIO_PORT_I) || (GPIO_PORT_INSTANCE(index) != GPIOx) || (deb.Slot[index] != 0U) ||
+        (deb.PortCount >= DEB_PORTS_MAX) || (Pins == 0U)) {
+        return HAL_ERROR;
+    }
+
+    port = &deb.Port[deb.PortCount];
+    port->GPIOx = GPIOx;
+    port->Pins = Pins;
+    port->ActiveLow = ActiveLow & Pins;
+    port->State = GPIOx->IDR & Pins;
+    samples = DEB_MsToSamples(DEB_STABLE_MS_DEFAULT);
+    samples = (samples > DEB_SAMPLES_MAX) ? DEB_SAMPLES_MAX : samples;
+    for (i = 0U; i < DEB_COUNTER_BITS; i++) {
+        port->Count[i] = 0U;
+        port->Limit[i] = (((samples >> i) & 1U) != 0U) ? Pins : 0U;
+    }
+    ATOMIC_Store(&port->Edges, 0U);
+
+    /* Publish the port only once it is complete */
+    deb.Slot[index] = (uint8_t)(deb.PortCount + 1U);
+    __DMB();
+    deb.PortCount++;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Time an input of Pins must hold before it is taken
+ * @param   Ms - Rounded up to whole samples
+ * @retval  HAL_ERROR if the port is not debounced or Ms is more than DEB_SAMPLES_MAX samples
+ */
+HAL_StatusTypeDef DEB_SetStableTime(GPIO_TypeDef *GPIOx, uint16_t Pins, uint32_t Ms)
+{
+    DEB_PortTypeDef *port = DEB_FindPort(GPIOx);
+    uint32_t samples = DEB_MsToSamples(Ms);
+
+    if ((port == NULL) || (samples > DEB_SAMPLES_MAX)) {
+        return HAL_ERROR;
+    }
+    DEB_SetLimit(port, Pins & port->Pins, samples);
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef DEB_Start(void)
+{
+    return HAL_TIM_Base_Start_IT(&deb.htim);
+}
+
+HAL_StatusTypeDef DEB_Stop(void)
+{
+    return HAL_TIM_Base_Stop_IT(&deb.htim);
+}
+
+/**
+ * @brief   Debounced pins of a port that are active (pressed)
+ */
+uint16_t DEB_GetActive(GPIO_TypeDef *GPIOx)
+{
+    DEB_PortTypeDef *port = DEB_FindPort(GPIOx);
+
+    return (port != NULL) ? (uint16_t)((port->State ^ port->ActiveLow) & port->Pins) : 0U;
+}
+
+/**
+ * @brief   Take the edges seen on a port since the last call
+ * @param   Pressed  - Pins that became active, may be NULL
+ * @param   Released - Pins that became inactive, may be NULL
+ * @retval  Non-zero if there was any edge
+ * @note    A pin that bounced through a whole press and release between two calls
+ *          shows up in both.
+ */
+uint32_t DEB_GetEdges(GPIO_TypeDef *GPIOx, uint16_t *Pressed, uint16_t *Released)
+{
+    DEB_PortTypeDef *port = DEB_FindPort(GPIOx);
+    uint32_t edges = (port != NULL) ? ATOMIC_Exchange(&port->Edges, 0U) : 0U;
+
+    if (Pressed != NULL) {
+        *Pressed = (uint16_t)edges;
+    }
+    if (Released != NULL) {
+        *Released = (uint16_t)(edges >> DEB_RELEASED_Pos);
+    }
+    return edges;
+}
+
+/**
+ * @brief   Take one sample of every port and advance the debouncers
+ * @note    Branch free per port: Count[] is a 4-bit ripple adder across bit planes,
+ *          masked by delta so that the pins matching the debounced state restart at 0.
+ */
+void DEB_Sample(void)
+{
+    DEB_PortTypeDef *port = deb.Port;
+    DEB_PortTypeDef *end = deb.Port + deb.PortCount;
+    uint32_t delta, carry, c0, c1, c2, c3, done, active;
+
+    for (; port < end; port++) {
+        delta = (port->GPIOx->IDR ^ port->State) & port->Pins;
+
+        /* Count += 1 where delta, 0 elsewhere */
+        carry = port->Count[0];
+        c0 = ~carry & delta;
+        carry &= delta;
+        c1 = (port->Count[1] ^ carry) & delta;
+        carry &= port->Count[1];
+        c2 = (port->Count[2] ^ carry) & delta;
+        carry &= port->Count[2];
+        c3 = (port->Count[3] ^ carry) & delta;
+
+        /* Stable long enough: Count == Limit */
+        done = delta & ~((c0 ^ port->Limit[0]) | (c1 ^ port->Limit[1]) |
+                         (c2 ^ port->Limit[2]) | (c3 ^ port->Limit[3]));
+        port->Count[0] = c0 & ~done;
+        port->Count[1] = c1 & ~done;
+        port->Count[2] = c2 & ~done;
+        port->Count[3] = c3 & ~done;
+
+        port->State ^= done;
+        active = port->State ^ port->ActiveLow;
+        ATOMIC_FetchOr(&port->Edges, (done & active) | ((done & ~active) << DEB_RELEASED_Pos));
+    }
+}
+
+/**
+ * @brief   TIM6 update: one sample
+ */
+void DEB_TIM_IRQHandler(void)
+{
+    WRITE_REG(DEB_TIM->SR, (uint32_t)~TIM_SR_UIF);
+    DEB_Sample();
+}
\ No newline at end of file
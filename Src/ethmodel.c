@@ -0,0 +1,269 @@
+#include "ethmodel.h"
+
+#ifdef ETH_HOST
+#include <string.h>
+
+/**
+ * @brief: Private macros
+ */
+#define ETHM_FCS_SIZE           4U
+#define ETHM_NORMAL_FLAGS       (ETH_DMASR_TS | ETH_DMASR_TBUS | ETH_DMASR_RS | ETH_DMASR_ERS)
+#define ETHM_ABNORMAL_FLAGS     (ETH_DMASR_TPSS | ETH_DMASR_TJTS | ETH_DMASR_ROS | ETH_DMASR_TUS | \
+                                 ETH_DMASR_RBUS | ETH_DMASR_RPSS | ETH_DMASR_RWTS | ETH_DMASR_ETS | \
+                                 ETH_DMASR_FBES)
+
+/**
+ * @brief: Private functions
+ */
+static void ETHM_Flag(ETHM_ModelTypeDef *Model, uint32_t Flags);
+static uint32_t ETHM_Next(ETHM_ModelTypeDef *Model, uint32_t Index, uint32_t Count, uint32_t EndOfRing);
+static uint32_t ETHM_CheckBuffer(ETHM_ModelTypeDef *Model, const ETH_DMADescTypeDef *Desc, uint32_t Size);
+
+/*------------------------------------------- Model -------------------------------------------*/
+/**
+ * @brief   Attach the model after HAL_ETH_Init(), both DMA pointers at the ring starts
+ */
+void ETHM_Init(ETHM_ModelTypeDef *Model, ETH_HandleTypeDef *heth)
+{
+    memset(Model, 0, sizeof(*Model));
+    Model->heth = heth;
+}
+
+/**
+ * @brief   A frame arrives from the wire
+ * @param   Frame - Destination address to payload end; the model appends a zero FCS
+ * @param   Flags - See @ref ETHM_Rx_Flags
+ * @retval  HAL_OK stored, HAL_BUSY missed (no descriptor, RBUS raised), HAL_ERROR
+ *          receiver stopped or frame truncated (DE)
+ */
+HAL_StatusTypeDef ETHM_Receive(ETHM_ModelTypeDef *Model, const void *Frame, uint32_t Length, uint32_t Flags)
+{
+    ETH_HandleTypeDef *heth = Model->heth;
+    ETH_DMADescTypeDef *desc;
+    uint32_t total = Length + ETHM_FCS_SIZE;
+    uint32_t done = 0U;
+    uint32_t first = 1U;
+    uint32_t index;
+    uint32_t size;
+    uint32_t chunk;
+    uint32_t payload;
+    uint32_t status;
+    uint32_t next;
+
+    if (((heth->Instance->DMAOMR & ETH_DMAOMR_SR) == 0U) || ((heth->Instance->MACCR & ETH_MACCR_RE) == 0U)) {
+        return HAL_ERROR;
+    }
+    for (;;)
+    {
+        index = Model->RxIndex;
+        desc = &heth->Init.RxDesc[index];
+        if ((desc->Status & ETH_DMARXDESC_OWN) == 0U)
+        {
+            /* Suspended; only a frame start can be missed, truncation is handled below */
+            ETHM_Flag(Model, ETH_DMASR_RBUS);
+            Model->MissedFrames++;
+            return HAL_BUSY;
+        }
+        size = desc->Control & ETH_DMARXDESC_RBS1;
+        if (ETHM_CheckBuffer(Model, desc, size) != 0U) {
+            return HAL_ERROR;
+        }
+
+        chunk = ((total - done) < size) ? (total - done) : size;
+        payload = (done < Length) ? (Length - done) : 0U;
+        if (payload > chunk) {
+            payload = chunk;
+        }
+        memcpy(desc->Buf, (const uint8_t *)Frame + done, payload);
+        memset((uint8_t *)desc->Buf + payload, 0, chunk - payload);        /* FCS */
+        done += chunk;
+
+        status = (first != 0U) ? ETH_DMARXDESC_FS : 0U;
+        first = 0U;
+        next = ETHM_Next(Model, index, heth->Init.RxDescCount, desc->Control & ETH_DMARXDESC_RER);
+        Model->RxIndex = next;
+
+        if (done < total)
+        {
+            if ((heth->Init.RxDesc[next].Status & ETH_DMARXDESC_OWN) != 0U) {
+                desc->Status = status;
+                continue;
+            }
+            /* The next descriptor is not ours: the frame is cut here */
+            desc->Status = status | ETH_DMARXDESC_LS | ETH_DMARXDESC_DE | ETH_DMARXDESC_ES |
+                           (done << ETH_DMARXDESC_FL_Pos);
+            ETHM_Flag(Model, ETH_DMASR_RS | ETH_DMASR_RBUS);
+            Model->Truncated++;
+            return HAL_ERROR;
+        }
+
+        status |= ETH_DMARXDESC_LS | (total << ETH_DMARXDESC_FL_Pos);
+        if ((Flags & ETHM_RX_CRC_ERROR) != 0U) {
+            status |= ETH_DMARXDESC_CE | ETH_DMARXDESC_ES;
+        }
+        if ((Flags & ETHM_RX_IP) != 0U) {
+            status |= ETH_DMARXDESC_FT;
+        }
+        else if ((heth->Instance->MACCR & ETH_MACCR_IPCO) != 0U) {
+            status |= ETH_DMARXDESC_IPHCE | ETH_DMARXDESC_PCE;      /* not IPv4/IPv6 */
+        }
+        desc->Status = status;
+
+        /* DIC: the receive watchdog raises RS later, unless a frame without DIC comes first */
+        if ((desc->Control & ETH_DMARXDESC_DIC) == 0U) {
+            ETHM_Flag(Model, ETH_DMASR_RS);
+            Model->RxWatchdog = 0U;
+        }
+        else if (Model->RxWatchdog == 0U) {
+            Model->RxWatchdog = heth->Instance->DMARSWTR & ETH_DMARSWTR_RSWTC;
+        }
+        return HAL_OK;
+    }
+}
+
+/**
+ * @brief   The DMA sends the next frame queued in the TX ring
+ * @param   Frame - Receives the frame as it would go on the wire (without FCS)
+ * @param   Size - Room in Frame
+ * @param   Checksum - Receives the checksum insertion requested (CIC), may be NULL
+ * @retval  Frame length, 0 if nothing to send (TBUS raised) or the frame broke the rules
+ */
+uint32_t ETHM_Transmit(ETHM_ModelTypeDef *Model, void *Frame, uint32_t Size, uint32_t *Checksum)
+{
+    ETH_HandleTypeDef *heth = Model->heth;
+    ETH_DMADescTypeDef *desc;
+    uint32_t index = Model->TxIndex;
+    uint32_t length = 0U;
+    uint32_t descs = 0U;
+    uint32_t status;
+    uint32_t chunk;
+    uint32_t i;
+
+    if ((heth->Instance->DMAOMR & ETH_DMAOMR_ST) == 0U) {
+        return 0U;
+    }
+    desc = &heth->Init.TxDesc[index];
+    if ((desc->Status & ETH_DMATXDESC_OWN) == 0U) {
+        ETHM_Flag(Model, ETH_DMASR_TBUS);
+        return 0U;
+    }
+    if ((desc->Status & ETH_DMATXDESC_FS) == 0U) {
+        Model->Violations++;
+        return 0U;
+    }
+    if (Checksum != NULL) {
+        *Checksum = desc->Status & ETH_DMATXDESC_CIC;
+    }
+
+    /* Gather up to LS, every descriptor of the frame must be ours already */
+    for (;;)
+    {
+        desc = &heth->Init.TxDesc[index];
+        status = desc->Status;
+        chunk = desc->Control & ETH_DMATXDESC_TBS1;
+        if (((status & ETH_DMATXDESC_OWN) == 0U) || (ETHM_CheckBuffer(Model, desc, chunk) != 0U) ||
+            ((descs != 0U) && ((status & ETH_DMATXDESC_FS) != 0U)) || (descs == heth->Init.TxDescCount)) {
+            if ((status & ETH_DMATXDESC_OWN) == 0U) {
+                Model->Violations++;
+            }
+            return 0U;
+        }
+        if ((length + chunk) <= Size) {
+            memcpy((uint8_t *)Frame + length, desc->Buf, chunk);
+        }
+        length += chunk;
+        descs++;
+        index = ETHM_Next(Model, index, heth->Init.TxDescCount, status & ETH_DMATXDESC_TER);
+        if ((status & ETH_DMATXDESC_LS) != 0U) {
+            break;
+        }
+    }
+
+    /* Sent: hand the descriptors back in order, status on the last one */
+    index = Model->TxIndex;
+    for (i = 0U; i < descs; i++)
+    {
+        desc = &heth->Init.TxDesc[index];
+        status = desc->Status & ~(ETH_DMATXDESC_OWN | ETH_DMATXDESC_ES);
+        desc->Status = status;
+        index = ETHM_Next(Model, index, heth->Init.TxDescCount, status & ETH_DMATXDESC_TER);
+    }
+    Model->TxIndex = index;
+    if ((status & ETH_DMATXDESC_IC) != 0U) {
+        ETHM_Flag(Model, ETH_DMASR_TS);
+    }
+    return (length <= Size) ? length : 0U;
+}
+
+/**
+ * @brief   Let time pass for the receive watchdog
+ * @param   Units - RSWTC units (256 HCLK cycles each)
+ */
+void ETHM_Tick(ETHM_ModelTypeDef *Model, uint32_t Units)
+{
+    if (Model->RxWatchdog == 0U) {
+        return;
+    }
+    if (Units >= Model->RxWatchdog) {
+        Model->RxWatchdog = 0U;
+        ETHM_Flag(Model, ETH_DMASR_RS);
+    }
+    else {
+        Model->RxWatchdog -= Units;
+    }
+}
+
+/**
+ * @brief   State of the ETH interrupt line (enabled flags through their summary)
+ */
+uint32_t ETHM_IrqPending(ETHM_ModelTypeDef *Model)
+{
+    uint32_t sr = Model->heth->Instance->DMASR;
+    uint32_t ier = Model->heth->Instance->DMAIER;
+
+    if (((ier & ETH_DMAIER_NISE) != 0U) && ((sr & ier & ETHM_NORMAL_FLAGS) != 0U)) {
+        return 1U;
+    }
+    if (((ier & ETH_DMAIER_AISE) != 0U) && ((sr & ier & ETHM_ABNORMAL_FLAGS) != 0U)) {
+        return 1U;
+    }
+    return 0U;
+}
+
+/*------------------------------------------- Private functions -------------------------------------------*/
+/* DMASR flag plus its summary bit (the enable bits share the flag positions) */
+static void ETHM_Flag(ETHM_ModelTypeDef *Model, uint32_t Flags)
+{
+    uint32_t summary = 0U;
+
+    if ((Flags & ETHM_NORMAL_FLAGS) != 0U) {
+        summary |= ETH_DMASR_NIS;
+    }
+    if ((Flags & ETHM_ABNORMAL_FLAGS) != 0U) {
+        summary |= ETH_DMASR_AIS;
+    }
+    Model->heth->Instance->DMASR |= Flags | summary;
+}
+
+static uint32_t ETHM_Next(ETHM_ModelTypeDef *Model, uint32_t Index, uint32_t Count, uint32_t EndOfRing)
+{
+    if (EndOfRing != 0U) {
+        return 0U;
+    }
+    if ((Index + 1U) == Count) {
+        /* Real hardware would walk past the array */
+        Model->Violations++;
+        return 0U;
+    }
+    return Index + 1U;
+}
+
+static uint32_t ETHM_CheckBuffer(ETHM_ModelTypeDef *Model, const ETH_DMADescTypeDef *Desc, uint32_t Size)
+{
+    if ((Desc->Buf == NULL) || (Size == 0U) || (Desc->Buffer1 != (uint32_t)(uintptr_t)Desc->Buf)) {
+        Model->Violations++;
+        return 1U;
+    }
+    return 0U;
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,230 @@
+#include "ethphy.h"
+#include <string.h>
+
+/**
+ * @brief: Private macros
+ */
+#define ETHPHY_RESET_POLLS          1000U       /* MDIO reads (~30 us each) for BMCR.RESET to clear */
+
+#define LAN8742_PSCSR               0x1FU       /* PHY special control/status */
+#define LAN8742_PSCSR_100M          0x0008U
+#define LAN8742_PSCSR_FULL          0x0010U
+
+#define DP83848_PHYSTS              0x10U       /* PHY status */
+#define DP83848_PHYSTS_10M          0x0002U
+#define DP83848_PHYSTS_FULL         0x0004U
+#define DP83848_RBR                 0x17U       /* RMII and bypass */
+#define DP83848_RBR_RMII_MODE       0x0020U
+
+/**
+ * @brief: Private functions
+ */
+static HAL_StatusTypeDef ETHPHY_Read(ETHPHY_HandleTypeDef *Phy, uint32_t Reg, uint32_t *Value);
+static HAL_StatusTypeDef ETHPHY_Write(ETHPHY_HandleTypeDef *Phy, uint32_t Reg, uint32_t Value);
+static HAL_StatusTypeDef ETHPHY_GetModeStandard(ETHPHY_HandleTypeDef *Phy, uint32_t *Speed, uint32_t *Duplex);
+static HAL_StatusTypeDef LAN8742_Init(ETHPHY_HandleTypeDef *Phy);
+static HAL_StatusTypeDef LAN8742_GetMode(ETHPHY_HandleTypeDef *Phy, uint32_t *Speed, uint32_t *Duplex);
+static HAL_StatusTypeDef DP83848_Init(ETHPHY_HandleTypeDef *Phy);
+static HAL_StatusTypeDef DP83848_GetMode(ETHPHY_HandleTypeDef *Phy, uint32_t *Speed, uint32_t *Duplex);
+
+const ETHPHY_DriverTypeDef ETHPHY_LAN8742 = { LAN8742_Init, LAN8742_GetMode };
+const ETHPHY_DriverTypeDef ETHPHY_DP83848 = { DP83848_Init, DP83848_GetMode };
+
+/*------------------------------------------- PHY -------------------------------------------*/
+/**
+ * @brief   Find and reset the PHY, then start auto-negotiation of all 10/100 modes
+ * @note    HAL_ETH_Init() done (MDC clock). The link comes up later, see ETHPHY_Poll().
+ * @param   Address - 0 ~ 31 or ETHPHY_ADDRESS_ANY
+ * @param   Driver - &ETHPHY_LAN8742, &ETHPHY_DP83848, or NULL
+ * @retval  HAL_OK, HAL_ERROR if no PHY answers or the reset does not complete
+ */
+HAL_StatusTypeDef ETHPHY_Init(ETHPHY_HandleTypeDef *Phy, ETH_HandleTypeDef *heth, uint32_t Address,
+                              const ETHPHY_DriverTypeDef *Driver)
+{
+    uint32_t first = (Address == ETHPHY_ADDRESS_ANY) ? 0U : Address;
+    uint32_t end = (Address == ETHPHY_ADDRESS_ANY) ? 32U : (Address + 1U);
+    uint32_t id1 = 0xFFFFU;
+    uint32_t id2 = 0xFFFFU;
+    uint32_t value;
+    uint32_t polls = ETHPHY_RESET_POLLS;
+
+    if ((Phy == NULL) || (heth == NULL) || (first > 31U)) {
+        return HAL_ERROR;
+    }
+    memset(Phy, 0, sizeof(*Phy));
+    Phy->heth = heth;
+    Phy->Driver = Driver;
+
+    /* Nobody drives MDIO at an empty address: reads return all ones */
+    for (Phy->Address = first; Phy->Address < end; Phy->Address++)
+    {
+        if ((ETHPHY_Read(Phy, ETHPHY_PHYID1, &id1) == HAL_OK) && (ETHPHY_Read(Phy, ETHPHY_PHYID2, &id2) == HAL_OK) &&
+            (id1 != 0xFFFFU) && (id1 != 0U)) {
+            break;
+        }
+    }
+    if (Phy->Address == end) {
+        return HAL_ERROR;
+    }
+    Phy->Id = (id1 << 16) | id2;
+
+    if (ETHPHY_Write(Phy, ETHPHY_BMCR, ETHPHY_BMCR_RESET) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    do {
+        if (ETHPHY_Read(Phy, ETHPHY_BMCR, &value) != HAL_OK) {
+            return HAL_ERROR;
+        }
+    } while (((value & ETHPHY_BMCR_RESET) != 0U) && (--polls != 0U));
+    if (polls == 0U) {
+        return HAL_ERROR;
+    }
+
+    if ((Driver != NULL) && (Driver->Init != NULL) && (Driver->Init(Phy) != HAL_OK)) {
+        return HAL_ERROR;
+    }
+    if (ETHPHY_Write(Phy, ETHPHY_ANAR, ETHPHY_AN_100FD | ETHPHY_AN_100HD | ETHPHY_AN_10FD |
+                                       ETHPHY_AN_10HD | ETHPHY_AN_SELECTOR) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    return ETHPHY_Write(Phy, ETHPHY_BMCR, ETHPHY_BMCR_ANENABLE | ETHPHY_BMCR_ANRESTART);
+}
+
+/**
+ * @brief   Follow the link, reconfigure and restart the MAC when it changes
+ * @note    Link down stops the MAC (the rings keep their frames). Link up waits for the
+ *          end of auto-negotiation, then sets the negotiated mode and starts the MAC.
+ * @param   Changed - Set to 1 if LinkUp, Speed or Duplex changed, may be NULL
+ */
+HAL_StatusTypeDef ETHPHY_Poll(ETHPHY_HandleTypeDef *Phy, uint32_t *Changed)
+{
+    uint32_t bmsr;
+    uint32_t speed;
+    uint32_t duplex;
+    uint32_t up;
+
+    if (Changed != NULL) {
+        *Changed = 0U;
+    }
+    /* First read returns the latched low (link lost since the last poll) */
+    if ((ETHPHY_Read(Phy, ETHPHY_BMSR, &bmsr) != HAL_OK) || (ETHPHY_Read(Phy, ETHPHY_BMSR, &bmsr) != HAL_OK)) {
+        return HAL_ERROR;
+    }
+    up = ((bmsr & ETHPHY_BMSR_LINK) != 0U) && ((bmsr & ETHPHY_BMSR_ANCOMPLETE) != 0U);
+
+    if (up == 0U)
+    {
+        if (Phy->LinkUp != 0U)
+        {
+            Phy->LinkUp = 0U;
+            (void)HAL_ETH_Stop(Phy->heth);
+            if (Changed != NULL) {
+                *Changed = 1U;
+            }
+        }
+        return HAL_OK;
+    }
+
+    if ((Phy->Driver != NULL) && (Phy->Driver->GetMode != NULL)) {
+        if (Phy->Driver->GetMode(Phy, &speed, &duplex) != HAL_OK) {
+            return HAL_ERROR;
+        }
+    }
+    else if (ETHPHY_GetModeStandard(Phy, &speed, &duplex) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    if ((Phy->LinkUp != 0U) && (speed == Phy->Speed) && (duplex == Phy->Duplex)) {
+        return HAL_OK;
+    }
+
+    if (HAL_ETH_GetState(Phy->heth) == HAL_ETH_STATE_STARTED) {
+        (void)HAL_ETH_Stop(Phy->heth);
+    }
+    HAL_ETH_SetLink(Phy->heth, speed, duplex);
+    Phy->Speed = speed;
+    Phy->Duplex = duplex;
+    Phy->LinkUp = 1U;
+    if (Changed != NULL) {
+        *Changed = 1U;
+    }
+    return HAL_ETH_Start(Phy->heth);
+}
+
+/*------------------------------------------- Private functions -------------------------------------------*/
+static HAL_StatusTypeDef ETHPHY_Read(ETHPHY_HandleTypeDef *Phy, uint32_t Reg, uint32_t *Value)
+{
+    return HAL_ETH_ReadPHYRegister(Phy->heth, Phy->Address, Reg, Value);
+}
+
+static HAL_StatusTypeDef ETHPHY_Write(ETHPHY_HandleTypeDef *Phy, uint32_t Reg, uint32_t Value)
+{
+    return HAL_ETH_WritePHYRegister(Phy->heth, Phy->Address, Reg, Value);
+}
+
+/* Best mode both link partners advertise */
+static HAL_StatusTypeDef ETHPHY_GetModeStandard(ETHPHY_HandleTypeDef *Phy, uint32_t *Speed, uint32_t *Duplex)
+{
+    uint32_t anar;
+    uint32_t anlpar;
+    uint32_t common;
+
+    if ((ETHPHY_Read(Phy, ETHPHY_ANAR, &anar) != HAL_OK) || (ETHPHY_Read(Phy, ETHPHY_ANLPAR, &anlpar) != HAL_OK)) {
+        return HAL_ERROR;
+    }
+    common = anar & anlpar;
+    *Speed = ((common & (ETHPHY_AN_100FD | ETHPHY_AN_100HD)) != 0U) ? ETH_SPEED_100M : ETH_SPEED_10M;
+    if (*Speed == ETH_SPEED_100M) {
+        *Duplex = ((common & ETHPHY_AN_100FD) != 0U) ? ETH_DUPLEX_FULL : ETH_DUPLEX_HALF;
+    }
+    else {
+        *Duplex = ((common & ETHPHY_AN_10FD) != 0U) ? ETH_DUPLEX_FULL : ETH_DUPLEX_HALF;
+    }
+    return HAL_OK;
+}
+
+/* RMII only parts */
+static HAL_StatusTypeDef LAN8742_Init(ETHPHY_HandleTypeDef *Phy)
+{
+    return (Phy->heth->Init.MediaInterface == ETH_MEDIA_INTERFACE_RMII) ? HAL_OK : HAL_ERROR;
+}
+
+static HAL_StatusTypeDef LAN8742_GetMode(ETHPHY_HandleTypeDef *Phy, uint32_t *Speed, uint32_t *Duplex)
+{
+    uint32_t pscsr;
+
+    if (ETHPHY_Read(Phy, LAN8742_PSCSR, &pscsr) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    *Speed = ((pscsr & LAN8742_PSCSR_100M) != 0U) ? ETH_SPEED_100M : ETH_SPEED_10M;
+    *Duplex = ((pscsr & LAN8742_PSCSR_FULL) != 0U) ? ETH_DUPLEX_FULL : ETH_DUPLEX_HALF;
+    return HAL_OK;
+}
+
+/* The RMII strap is often left open: set the mode the MAC uses */
+static HAL_StatusTypeDef DP83848_Init(ETHPHY_HandleTypeDef *Phy)
+{
+    uint32_t rbr;
+
+    if (ETHPHY_Read(Phy, DP83848_RBR, &rbr) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    if (Phy->heth->Init.MediaInterface == ETH_MEDIA_INTERFACE_RMII) {
+        rbr |= DP83848_RBR_RMII_MODE;
+    }
+    else {
+        rbr &= ~DP83848_RBR_RMII_MODE;
+    }
+    return ETHPHY_Write(Phy, DP83848_RBR, rbr);
+}
+
+static HAL_StatusTypeDef DP83848_GetMode(ETHPHY_HandleTypeDef *Phy, uint32_t *Speed, uint32_t *Duplex)
+{
+    uint32_t physts;
+
+    if (ETHPHY_Read(Phy, DP83848_PHYSTS, &physts) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    *Speed = ((physts & DP83848_PHYSTS_10M) != 0U) ? ETH_SPEED_10M : ETH_SPEED_100M;
+    *Duplex = ((physts & DP83848_PHYSTS_FULL) != 0U) ? ETH_DUPLEX_FULL : ETH_DUPLEX_HALF;
+    return HAL_OK;
+}
\ No newline at end of file
@@ -0,0 +1,247 @@
+#include "flashdev.h"
+#include <string.h>
+
+/**
+ * @brief: Private functions
+ */
+static HAL_StatusTypeDef FDEV_SimProgram(FDEV_DeviceTypeDef *Dev, uint32_t Offset, const void *Data, uint32_t Length);
+static HAL_StatusTypeDef FDEV_SimErase(FDEV_DeviceTypeDef *Dev, uint32_t Sector);
+#ifndef FDEV_HOST
+static HAL_StatusTypeDef FDEV_FlashProgram(FDEV_DeviceTypeDef *Dev, uint32_t Offset, const void *Data, uint32_t Length);
+static HAL_StatusTypeDef FDEV_FlashErase(FDEV_DeviceTypeDef *Dev, uint32_t Sector);
+#endif
+
+/*------------------------------------------- Region -------------------------------------------*/
+/**
+ * @brief   Write bytes at any offset and alignment, combining partial units
+ * @note    Meant for writers that move forward (log appends). Call FDEV_Flush() at the
+ *          end of a logical update, the last partial unit stays in the buffer until then.
+ * @retval  HAL_OK, HAL_ERROR if out of range or the backend failed
+ */
+HAL_StatusTypeDef FDEV_Write(FDEV_DeviceTypeDef *Dev, uint32_t Offset, const void *Data, uint32_t Length)
+{
+    const uint8_t *src = (const uint8_t *)Data;
+    uint32_t unit = Dev->ProgramUnit;
+    uint32_t size = Dev->SectorSize * Dev->SectorCount;
+    uint32_t base;
+    uint32_t chunk;
+
+    if ((Offset > size) || (Length > (size - Offset))) {
+        return HAL_ERROR;
+    }
+    Dev->Writes++;
+
+    while (Length != 0U)
+    {
+        base = Offset & ~(unit - 1U);
+        if ((Dev->BufferDirty != 0U) && (Dev->BufferOffset != base)) {
+            if (FDEV_Flush(Dev) != HAL_OK) {
+                return HAL_ERROR;
+            }
+        }
+
+        /* Aligned whole units: no need to go through the buffer */
+        if ((Dev->BufferDirty == 0U) && (Offset == base) && (Length >= unit))
+        {
+            chunk = Length & ~(unit - 1U);
+            if (Dev->Program(Dev, Offset, src, chunk) != HAL_OK) {
+                return HAL_ERROR;
+            }
+            Dev->Units += chunk / unit;
+        }
+        else
+        {
+            if (Dev->BufferDirty == 0U)
+            {
+                memcpy(Dev->Buffer, Dev->Memory + base, unit);
+                Dev->BufferOffset = base;
+                Dev->BufferDirty = 1U;
+            }
+            chunk = unit - (Offset - base);
+            if (chunk > Length) {
+                chunk = Length;
+            }
+            memcpy((uint8_t *)Dev->Buffer + (Offset - base), src, chunk);
+        }
+        Offset += chunk;
+        src += chunk;
+        Length -= chunk;
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief   Program the buffered partial unit, if any
+ */
+HAL_StatusTypeDef FDEV_Flush(FDEV_DeviceTypeDef *Dev)
+{
+    if (Dev->BufferDirty == 0U) {
+        return HAL_OK;
+    }
+    Dev->BufferDirty = 0U;
+    if (Dev->Program(Dev, Dev->BufferOffset, Dev->Buffer, Dev->ProgramUnit) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    Dev->Units++;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Erase one sector of the region, dropping buffered bytes that belong to it
+ */
+HAL_StatusTypeDef FDEV_Erase(FDEV_DeviceTypeDef *Dev, uint32_t Sector)
+{
+    if (Sector >= Dev->SectorCount) {
+        return HAL_ERROR;
+    }
+    if ((Dev->BufferDirty != 0U) && ((Dev->BufferOffset / Dev->SectorSize) == Sector)) {
+        Dev->BufferDirty = 0U;
+    }
+    Dev->Erases++;
+
+    return Dev->Erase(Dev, Sector);
+}
+
+/*------------------------------------------- Simulation -------------------------------------------*/
+/**
+ * @brief   Set up a simulated region, contents as given (fill Storage with 0xFF for a
+ *          blank part, or keep it from before a simulated power cut)
+ * @param   Storage - SectorCount * SectorSize bytes
+ * @param   ProgramUnit - 1, 2, 4 or 8, as FLASH_HandleTypeDef.ProgramSize
+ */
+HAL_StatusTypeDef FDEV_SimInit(FDEV_SimDeviceTypeDef *Sim, void *Storage, uint32_t SectorSize,
+                               uint32_t SectorCount, uint32_t ProgramUnit)
+{
+    if ((Sim == NULL) || (Storage == NULL) || (SectorCount == 0U) || (ProgramUnit == 0U) ||
+        (ProgramUnit > sizeof(Sim->Dev.Buffer)) || ((ProgramUnit & (ProgramUnit - 1U)) != 0U) ||
+        ((SectorSize % ProgramUnit) != 0U)) {
+        return HAL_ERROR;
+    }
+    memset(Sim, 0, sizeof(*Sim));
+    Sim->Dev.Memory = (const uint8_t *)Storage;
+    Sim->Dev.SectorSize = SectorSize;
+    Sim->Dev.SectorCount = SectorCount;
+    Sim->Dev.ProgramUnit = ProgramUnit;
+    Sim->Dev.Program = FDEV_SimProgram;
+    Sim->Dev.Erase = FDEV_SimErase;
+    Sim->Storage = (uint8_t *)Storage;
+
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef FDEV_SimProgram(FDEV_DeviceTypeDef *Dev, uint32_t Offset, const void *Data, uint32_t Length)
+{
+    FDEV_SimDeviceTypeDef *sim = (FDEV_SimDeviceTypeDef *)Dev;
+    const uint8_t *src = (const uint8_t *)Data;
+    uint8_t *dst;
+    uint32_t i;
+
+    if (sim->PowerLost != 0U) {
+        return HAL_ERROR;
+    }
+    if ((((Offset | Length) & (Dev->ProgramUnit - 1U)) != 0U) ||
+        (Offset > (Dev->SectorSize * Dev->SectorCount)) || (Length > ((Dev->SectorSize * Dev->SectorCount) - Offset))) {
+        sim->Violations++;
+        return HAL_ERROR;
+    }
+
+    for (; Length != 0U; Length -= Dev->ProgramUnit, Offset += Dev->ProgramUnit, src += Dev->ProgramUnit)
+    {
+        dst = &sim->Storage[Offset];
+        for (i = 0U; i < Dev->ProgramUnit; i++)
+        {
+            if ((dst[i] & src[i]) != src[i]) {
+                sim->Violations++;
+                return HAL_ERROR;
+            }
+        }
+        for (i = 0U; i < Dev->ProgramUnit; i++) {
+            dst[i] &= src[i];
+        }
+        if ((sim->FailAfter != 0U) && (--sim->FailAfter == 0U)) {
+            sim->PowerLost = 1U;
+            return HAL_ERROR;
+        }
+    }
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef FDEV_SimErase(FDEV_DeviceTypeDef *Dev, uint32_t Sector)
+{
+    FDEV_SimDeviceTypeDef *sim = (FDEV_SimDeviceTypeDef *)Dev;
+
+    if (sim->PowerLost != 0U) {
+        return HAL_ERROR;
+    }
+    memset(&sim->Storage[Sector * Dev->SectorSize], 0xFF, Dev->SectorSize);
+    if (sim->EraseCounts != NULL) {
+        sim->EraseCounts[Sector]++;
+    }
+    return HAL_OK;
+}
+
+#ifndef FDEV_HOST
+/*------------------------------------------- Internal flash -------------------------------------------*/
+/**
+ * @brief   Use internal flash sectors FirstSector ~ FirstSector + SectorCount - 1
+ * @note    The sectors must have the same size: 0 ~ 3 (16 KB) or 5 ~ 11 (128 KB) ranges.
+ *          They must not hold code, the linker script has to leave them out.
+ * @param   hflash - HAL_FLASH_Init() done, sets ProgramUnit
+ */
+HAL_StatusTypeDef FDEV_FlashInit(FDEV_FlashDeviceTypeDef *Flash, FLASH_HandleTypeDef *hflash,
+                                 uint32_t FirstSector, uint32_t SectorCount)
+{
+    uint32_t i;
+
+    if ((Flash == NULL) || (hflash == NULL) || (SectorCount == 0U) || (FirstSector >= FLASH_SECTOR_COUNT) ||
+        (SectorCount > (FLASH_SECTOR_COUNT - FirstSector))) {
+        return HAL_ERROR;
+    }
+    for (i = 1U; i < SectorCount; i++)
+    {
+        if (HAL_FLASH_GetSectorSize(FirstSector + i) != HAL_FLASH_GetSectorSize(FirstSector)) {
+            return HAL_ERROR;
+        }
+    }
+    memset(Flash, 0, sizeof(*Flash));
+    Flash->Dev.Memory = (const uint8_t *)HAL_FLASH_GetSectorAddress(FirstSector);
+    Flash->Dev.SectorSize = HAL_FLASH_GetSectorSize(FirstSector);
+    Flash->Dev.SectorCount = SectorCount;
+    Flash->Dev.ProgramUnit = hflash->ProgramSize;
+    Flash->Dev.Program = FDEV_FlashProgram;
+    Flash->Dev.Erase = FDEV_FlashErase;
+    Flash->hflash = hflash;
+    Flash->FirstSector = FirstSector;
+
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef FDEV_FlashProgram(FDEV_DeviceTypeDef *Dev, uint32_t Offset, const void *Data, uint32_t Length)
+{
+    FDEV_FlashDeviceTypeDef *flash = (FDEV_FlashDeviceTypeDef *)Dev;
+    HAL_StatusTypeDef status;
+
+    if (HAL_FLASH_Unlock(flash->hflash) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    status = HAL_FLASH_Program(flash->hflash, (uint32_t)Dev->Memory + Offset, Data, Length);
+    HAL_FLASH_Lock(flash->hflash);
+
+    return status;
+}
+
+static HAL_StatusTypeDef FDEV_FlashErase(FDEV_DeviceTypeDef *Dev, uint32_t Sector)
+{
+    FDEV_FlashDeviceTypeDef *flash = (FDEV_FlashDeviceTypeDef *)Dev;
+    HAL_StatusTypeDef status;
+
+    if (HAL_FLASH_Unlock(flash->hflash) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    status = HAL_FLASH_EraseSector(flash->hflash, flash->FirstSector + Sector);
+    HAL_FLASH_Lock(flash->hflash);
+
+    return status;
+}
+#endif
\ No newline at end of file
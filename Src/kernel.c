@@ -0,0 +1,878 @@
+#include "kernel.h"
+#include "memstat.h"
+
+/**
+ * @brief: Private defines
+ */
+#define K_BASEPRI               (K_MAX_SYSCALL_PRIORITY << (8U - __NVIC_PRIO_BITS))
+#define K_LOWEST_PRIORITY       ((1UL << __NVIC_PRIO_BITS) - 1UL)
+#define K_EXC_RETURN_THREAD_PSP 0xFFFFFFFDU     /*< Thread mode, PSP, basic frame >*/
+#define K_INITIAL_XPSR          0x01000000U     /*< Thumb bit >*/
+#define K_IDLE_MIN_TICKS        2U              /*< Shorter idle periods keep the normal tick >*/
+
+/**
+ * @brief: Kernel state
+ */
+typedef struct
+{
+    K_ThreadTypeDef     *ReadyList[K_PRIORITY_MAX];
+    uint32_t            ReadyMask;
+    K_ThreadTypeDef     *DelayList;         /*< Sorted by WakeTick >*/
+    __IO uint32_t       Tick;
+    uint32_t            Started;
+    uint32_t            CyclesPerTick;
+    uint32_t            MaxIdleTicks;       /*< Longest sleep SysTick (24 bit) can time >*/
+    K_StatsTypeDef      Stats;
+    K_ThreadTypeDef     Idle;
+    K_ThreadTypeDef     *AllThreads;        /*< Linked by AllNext, newest first >*/
+} K_TypeDef;
+
+static K_TypeDef k;
+static uint32_t k_idle_stack[K_IDLE_STACK_SIZE / 4U] __attribute__((aligned(8)));
+
+/* Shared with the PendSV/SVC assembly */
+K_ThreadTypeDef * volatile K_CurrentThread;
+volatile uint32_t K_SwitchCycles[2];       /*< [0] CYCCNT at PendSV entry, [1] cycles of the last switch >*/
+
+void K_SwitchContext(void);
+static void K_PendSVHandler(void);
+static void K_SVCHandler(void);
+static void K_SysTickHandler(void);
+static void K_StartFirstThread(void) __attribute__((noreturn));
+static void K_IdleThread(void *Arg);
+static void K_ThreadExit(void);
+
+/*---------------------------------- Lists ----------------------------------*/
+static void K_ListInsertTail(K_ThreadTypeDef **pHead, K_ThreadTypeDef *Thread)
+{
+    K_ThreadTypeDef *head = *pHead;
+
+    if (head == NULL) {
+        Thread->Next = Thread;
+        Thread->Prev = Thread;
+        *pHead = Thread;
+    }
+    else {
+        Thread->Next = head;
+        Thread->Prev = head->Prev;
+        head->Prev->Next = Thread;
+        head->Prev = Thread;
+    }
+}
+
+/* Behind every thread of higher or equal priority */
+static void K_ListInsertPrio(K_ThreadTypeDef **pHead, K_ThreadTypeDef *Thread)
+{
+    K_ThreadTypeDef *head = *pHead;
+    K_ThreadTypeDef *it = head;
+
+    if (head == NULL) {
+        K_ListInsertTail(pHead, Thread);
+        return;
+    }
+    do {
+        if (it->Priority < Thread->Priority) {
+            break;
+        }
+        it = it->Next;
+    } while (it != head);
+
+    Thread->Next = it;
+    Thread->Prev = it->Prev;
+    it->Prev->Next = Thread;
+    it->Prev = Thread;
+    if ((it == head) && (head->Priority < Thread->Priority)) {
+        *pHead = Thread;
+    }
+}
+
+static void K_ListRemove(K_ThreadTypeDef **pHead, K_ThreadTypeDef *Thread)
+{
+    if (Thread->Next == Thread) {
+        *pHead = NULL;
+    }
+    else {
+        Thread->Prev->Next = Thread->Next;
+        Thread->Next->Prev = Thread->Prev;
+        if (*pHead == Thread) {
+            *pHead = Thread->Next;
+        }
+    }
+    Thread->Next = NULL;
+    Thread->Prev = NULL;
+}
+
+static void K_ReadyAdd(K_ThreadTypeDef *Thread)
+{
+    Thread->State = K_STATE_READY;
+    K_ListInsertTail(&k.ReadyList[Thread->Priority], Thread);
+    k.ReadyMask |= 1UL << Thread->Priority;
+}
+
+static void K_ReadyRemove(K_ThreadTypeDef *Thread)
+{
+    K_ListRemove(&k.ReadyList[Thread->Priority], Thread);
+    if (k.ReadyList[Thread->Priority] == NULL) {
+        k.ReadyMask &= ~(1UL << Thread->Priority);
+    }
+}
+
+static void K_DelayAdd(K_ThreadTypeDef *Thread, uint32_t Ticks)
+{
+    K_ThreadTypeDef **pp = &k.DelayList;
+
+    Thread->WakeTick = k.Tick + Ticks;
+    while ((*pp != NULL) && ((int32_t)((*pp)->WakeTick - Thread->WakeTick) <= 0)) {
+        pp = &(*pp)->DelayNext;
+    }
+    Thread->DelayNext = *pp;
+    *pp = Thread;
+    Thread->Delayed = 1U;
+}
+
+static void K_DelayRemove(K_ThreadTypeDef *Thread)
+{
+    K_ThreadTypeDef **pp = &k.DelayList;
+
+    while (*pp != NULL) {
+        if (*pp == Thread) {
+            *pp = Thread->DelayNext;
+            break;
+        }
+        pp = &(*pp)->DelayNext;
+    }
+    Thread->DelayNext = NULL;
+    Thread->Delayed = 0U;
+}
+
+/*---------------------------------- Scheduling ----------------------------------*/
+static inline K_ThreadTypeDef *K_HighestReady(void)
+{
+    /* The idle thread is always ready, so the mask is never 0 */
+    return k.ReadyList[31U - __CLZ(k.ReadyMask)];
+}
+
+/* Request a switch if the thread that should run is not the current one */
+static void K_Schedule(void)
+{
+    if ((k.Started != 0U) && (K_HighestReady() != K_CurrentThread)) {
+        SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    }
+}
+
+/**
+ * @brief   Move the current thread off the ready list onto a wait list and/or the timeout list
+ * @note    Called inside a critical section. The switch happens when the caller leaves it,
+ *          the result is in K_CurrentThread->WaitResult once the thread runs again.
+ */
+static void K_BlockCurrent(K_ThreadTypeDef **WaitList, uint32_t Timeout)
+{
+    K_ThreadTypeDef *cur = K_CurrentThread;
+
+    K_ReadyRemove(cur);
+    cur->State = K_STATE_BLOCKED;
+    cur->WaitResult = HAL_TIMEOUT;
+    cur->WaitList = WaitList;
+    if (WaitList != NULL) {
+        K_ListInsertPrio(WaitList, cur);
+    }
+    if (Timeout != K_WAIT_FOREVER) {
+        K_DelayAdd(cur, Timeout);
+    }
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+static void K_Wake(K_ThreadTypeDef *Thread, HAL_StatusTypeDef Result)
+{
+    if (Thread->WaitList != NULL) {
+        K_ListRemove(Thread->WaitList, Thread);
+        Thread->WaitList = NULL;
+    }
+    if (Thread->Delayed != 0U) {
+        K_DelayRemove(Thread);
+    }
+    Thread->WaitResult = Result;
+    K_ReadyAdd(Thread);
+}
+
+/**
+ * @brief   Change the effective priority, keeping ready/wait lists ordered
+ */
+static void K_SetPriority(K_ThreadTypeDef *Thread, uint32_t Priority)
+{
+    if (Thread->Priority == Priority) {
+        return;
+    }
+    if (Thread->State == K_STATE_READY) {
+        K_ReadyRemove(Thread);
+        Thread->Priority = Priority;
+        K_ReadyAdd(Thread);
+    }
+    else if (Thread->WaitList != NULL) {
+        K_ListRemove(Thread->WaitList, Thread);
+        Thread->Priority = Priority;
+        K_ListInsertPrio(Thread->WaitList, Thread);
+    }
+    else {
+        Thread->Priority = Priority;
+    }
+}
+
+/* Base priority, raised to the best waiter of every mutex still held */
+static uint32_t K_InheritedPriority(const K_ThreadTypeDef *Thread)
+{
+    uint32_t prio = Thread->BasePriority;
+    const K_MutexTypeDef *m;
+
+    for (m = Thread->MutexHeld; m != NULL; m = m->NextHeld) {
+        if ((m->Waiters != NULL) && (m->Waiters->Priority > prio)) {
+            prio = m->Waiters->Priority;
+        }
+    }
+    return prio;
+}
+
+/**
+ * @brief   Re-evaluate the owner of a mutex after its waiters changed, and follow the
+ *          chain when that owner is itself blocked on another mutex
+ */
+static void K_MutexPropagate(K_MutexTypeDef *Mutex)
+{
+    K_ThreadTypeDef *owner = Mutex->Owner;
+    uint32_t prio;
+
+    while (owner != NULL) {
+        prio = K_InheritedPriority(owner);
+        if (prio == owner->Priority) {
+            break;
+        }
+        K_SetPriority(owner, prio);
+        owner = (owner->BlockedMutex != NULL) ? owner->BlockedMutex->Owner : NULL;
+    }
+}
+
+/**
+ * @brief   Advance the kernel time and wake the threads whose timeout expired
+ * @note    Called with the kernel interrupts masked.
+ */
+static void K_TickAdvance(uint32_t Ticks)
+{
+    K_ThreadTypeDef *t;
+    K_MutexTypeDef *m;
+
+    k.Tick += Ticks;
+    while (((t = k.DelayList) != NULL) && ((int32_t)(k.Tick - t->WakeTick) >= 0)) {
+        m = t->BlockedMutex;
+        t->BlockedMutex = NULL;
+        K_Wake(t, HAL_TIMEOUT);
+        if (m != NULL) {
+            K_MutexPropagate(m);     /* owner loses what it inherited from this thread */
+        }
+    }
+    K_Schedule();
+}
+
+/**
+ * @brief   Pick the next thread, called from PendSV with the old context saved
+ * @note    The stack of the outgoing thread is checked here: PSP below the guard band
+ *          or a damaged canary means it overflowed (the Cortex-M4 has no PSPLIM).
+ */
+void K_SwitchContext(void)
+{
+    K_ThreadTypeDef *cur = K_CurrentThread;
+
+    if ((cur->Sp < (uint32_t *)((uint8_t *)cur->StackBase + K_STACK_GUARD)) || (cur->StackBase[0] != K_STACK_CANARY)) {
+        K_StackOverflowHook(cur);
+    }
+
+    /* Cycles of the previous switch, written by the PendSV exit path */
+    if (K_SwitchCycles[1] > k.Stats.MaxSwitchCycles) {
+        k.Stats.MaxSwitchCycles = K_SwitchCycles[1];
+    }
+
+    cur = K_HighestReady();
+    if (cur != K_CurrentThread) {
+        HAL_TRACE(TRC_KIND_INSTANT, TRC_ID_THREAD, (uint32_t)(uintptr_t)cur >> 2U);
+    }
+    cur->SwitchCount++;
+    k.Stats.SwitchCount++;
+    K_CurrentThread = cur;
+}
+
+/*---------------------------------- Public APIs ----------------------------------*/
+/**
+ * @brief   Initialize the kernel
+ * @note    Enables the FPU with lazy context stacking and the DWT cycle counter,
+ *          and installs the kernel exception handlers.
+ */
+HAL_StatusTypeDef K_Init(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < K_PRIORITY_MAX; i++) {
+        k.ReadyList[i] = NULL;
+    }
+    k.ReadyMask = 0U;
+    k.DelayList = NULL;
+    k.AllThreads = NULL;
+    k.Tick = 0U;
+    k.Started = 0U;
+    K_CurrentThread = NULL;
+
+    /* FP context is stacked only when a thread used the FPU, and lazily (space reserved,
+       registers written only if the handler itself touches the FPU) */
+    SET_BIT(SCB->CPACR, SCB_CPACR_CP10_CP11_Msk);
+    SET_BIT(FPU->FPCCR, FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk);
+    __DSB();
+    __ISB();
+
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+
+    if ((HAL_NVIC_SetVector(SVCall_IRQn, K_SVCHandler, NULL) != HAL_OK) ||
+        (HAL_NVIC_SetVector(PendSV_IRQn, K_PendSVHandler, NULL) != HAL_OK) ||
+        (HAL_NVIC_SetVector(SysTick_IRQn, K_SysTickHandler, NULL) != HAL_OK)) {
+        return HAL_ERROR;
+    }
+
+    return K_ThreadCreate(&k.Idle, "idle", K_IdleThread, NULL, k_idle_stack, sizeof(k_idle_stack), 0U);
+}
+
+/**
+ * @brief   Create a thread, ready to run
+ * @param   Stack     - Stack memory, 8-byte aligned
+ * @param   StackSize - Size in bytes, must leave room for the guard band and a full FP frame
+ * @param   Priority  - 1 ~ K_PRIORITY_MAX - 1 (0 is reserved for the idle thread)
+ */
+HAL_StatusTypeDef K_ThreadCreate(K_ThreadTypeDef *Thread, const char *Name, K_ThreadFuncTypeDef Entry, void *Arg,
+                                 uint32_t *Stack, uint32_t StackSize, uint32_t Priority)
+{
+    K_ThreadTypeDef *it;
+    uint32_t *sp;
+    uint32_t key;
+
+    if ((Thread == NULL) || (Entry == NULL) || (Stack == NULL) || (((uint32_t)Stack & 0x7U) != 0U) ||
+        (StackSize < (K_STACK_GUARD + 256U)) || (Priority >= K_PRIORITY_MAX) ||
+        ((Priority == 0U) && (Thread != &k.Idle))) {
+        return HAL_ERROR;
+    }
+
+    Thread->StackBase = Stack;
+    Thread->StackSize = StackSize;
+    Thread->BasePriority = Priority;
+    Thread->Priority = Priority;
+    Thread->WaitList = NULL;
+    Thread->DelayNext = NULL;
+    Thread->Delayed = 0U;
+    Thread->BlockedMutex = NULL;
+    Thread->MutexHeld = NULL;
+    Thread->WaitResult = HAL_OK;
+    Thread->Name = Name;
+    Thread->SwitchCount = 0U;
+    MEM_Paint(Stack, StackSize);
+    Stack[0] = K_STACK_CANARY;
+
+    /* Initial frame as PendSV restores it: r4-r11, EXC_RETURN, then the hardware frame */
+    sp = (uint32_t *)(((uint32_t)Stack + StackSize) & ~0x7UL);
+    *--sp = K_INITIAL_XPSR;
+    *--sp = (uint32_t)Entry & ~0x1UL;   /* PC */
+    *--sp = (uint32_t)K_ThreadExit;     /* LR */
+    *--sp = 0U;                         /* R12 */
+    *--sp = 0U;                         /* R3 */
+    *--sp = 0U;                         /* R2 */
+    *--sp = 0U;                         /* R1 */
+    *--sp = (uint32_t)Arg;              /* R0 */
+    *--sp = K_EXC_RETURN_THREAD_PSP;
+    sp -= 8U;                           /* R4-R11 */
+    Thread->Sp = sp;
+
+    key = HAL_NVIC_EnterCritical(K_MAX_SYSCALL_PRIORITY);
+    /* A terminated thread's control block may be created again: link it once */
+    for (it = k.AllThreads; (it != NULL) && (it != Thread); it = it->AllNext) {
+    }
+    if (it == NULL) {
+        Thread->AllNext = k.AllThreads;
+        k.AllThreads = Thread;
+    }
+    K_ReadyAdd(Thread);
+    K_Schedule();
+    HAL_NVIC_ExitCritical(key);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Start the tick and switch to the highest priority thread, never returns
+ * @note    The main stack is reset to its top: it is only used by interrupts from now on.
+ */
+void K_Start(void)
+{
+    /* Nothing kernel-aware may run until the first thread is up, SVC clears BASEPRI */
+    (void)HAL_NVIC_EnterCritical(K_MAX_SYSCALL_PRIORITY);
+
+    HAL_NVIC_SetPriority(SVCall_IRQn, 0U, 0U);
+    HAL_NVIC_SetPriority(PendSV_IRQn, K_LOWEST_PRIORITY, 0U);
+    HAL_NVIC_SetPriority(SysTick_IRQn, K_LOWEST_PRIORITY, 0U);
+
+    k.CyclesPerTick = HAL_RCC_GetHCLKFreq() / K_TICK_HZ;
+    k.MaxIdleTicks = SysTick_LOAD_RELOAD_Msk / k.CyclesPerTick;
+    (void)SysTick_Config(k.CyclesPerTick);
+    HAL_NVIC_SetPriority(SysTick_IRQn, K_LOWEST_PRIORITY, 0U);
+
+    K_CurrentThread = K_HighestReady();
+    K_CurrentThread->SwitchCount++;
+    k.Started = 1U;
+
+    K_StartFirstThread();
+}
+
+K_ThreadTypeDef *K_ThreadSelf(void)
+{
+    return K_CurrentThread;
+}
+
+/**
+ * @brief   Walk every thread created, the idle thread included
+ * @param   Thread - NULL for the first one
+ * @retval  NULL after the last one
+ */
+K_ThreadTypeDef *K_ThreadNext(const K_ThreadTypeDef *Thread)
+{
+    return (Thread == NULL) ? k.AllThreads : Thread->AllNext;
+}
+
+/**
+ * @brief   Deepest stack use of a thread so far
+ * @note    The stack is painted by K_ThreadCreate(). Scans up from the canary to the
+ *          first word written, so it costs the unused part of the stack.
+ * @retval  Bytes above the canary, the initial frame included
+ */
+uint32_t K_ThreadStackPeak(const K_ThreadTypeDef *Thread)
+{
+    uint32_t size = Thread->StackSize & ~0x3UL;
+
+    return size - 4U - MEM_Unused(Thread->StackBase + 1, size - 4U);
+}
+
+/**
+ * @brief   Block the calling thread for a number of ticks (0 = yield)
+ */
+void K_Sleep(uint32_t Ticks)
+{
+    uint32_t key;
+
+    if (Ticks == 0U) {
+        K_Yield();
+        return;
+    }
+    key = HAL_NVIC_EnterCritical(K_MAX_SYSCALL_PRIORITY);
+    K_BlockCurrent(NULL, Ticks);
+    HAL_NVIC_ExitCritical(key);
+}
+
+/**
+ * @brief   Let the other ready threads of the same priority run
+ */
+void K_Yield(void)
+{
+    uint32_t key = HAL_NVIC_EnterCritical(K_MAX_SYSCALL_PRIORITY);
+    K_ThreadTypeDef *cur = K_CurrentThread;
+
+    K_ReadyRemove(cur);
+    K_ReadyAdd(cur);
+    K_Schedule();
+    HAL_NVIC_ExitCritical(key);
+}
+
+uint32_t K_GetTick(void)
+{
+    return k.Tick;
+}
+
+/*---------------------------------- Semaphore ----------------------------------*/
+HAL_StatusTypeDef K_SemInit(K_SemaphoreTypeDef *Sem, uint32_t InitialCount, uint32_t MaxCount)
+{
+    if ((Sem == NULL) || (MaxCount == 0U) || (InitialCount > MaxCount)) {
+        return HAL_ERROR;
+    }
+    Sem->Count = InitialCount;
+    Sem->MaxCount = MaxCount;
+    Sem->Waiters = NULL;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Take a semaphore
+ * @param   Timeout - Ticks, K_NO_WAIT (only value allowed from interrupts) or K_WAIT_FOREVER
+ * @retval  HAL_OK, HAL_BUSY (not available, K_NO_WAIT) or HAL_TIMEOUT
+ */
+HAL_StatusTypeDef K_SemTake(K_SemaphoreTypeDef *Sem, uint32_t Timeout)
+{
+    uint32_t key = HAL_NVIC_EnterCritical(K_MAX_SYSCALL_PRIORITY);
+
+    if (Sem->Count > 0U) {
+        Sem->Count--;
+        HAL_NVIC_ExitCritical(key);
+        return HAL_OK;
+    }
+    if (Timeout == K_NO_WAIT) {
+        HAL_NVIC_ExitCritical(key);
+        return HAL_BUSY;
+    }
+    K_BlockCurrent(&Sem->Waiters, Timeout);
+    HAL_NVIC_ExitCritical(key);
+
+    return K_CurrentThread->WaitResult;
+}
+
+/**
+ * @brief   Give a semaphore, from a thread or an interrupt
+ * @note    A waiting thread gets the count directly, highest priority first.
+ * @retval  HAL_ERROR if the count is already MaxCount
+ */
+HAL_StatusTypeDef K_SemGive(K_SemaphoreTypeDef *Sem)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+    uint32_t key = HAL_NVIC_EnterCritical(K_MAX_SYSCALL_PRIORITY);
+
+    if (Sem->Waiters != NULL) {
+        K_Wake(Sem->Waiters, HAL_OK);
+        K_Schedule();
+    }
+    else if (Sem->Count < Sem->MaxCount) {
+        Sem->Count++;
+    }
+    else {
+        status = HAL_ERROR;
+    }
+    HAL_NVIC_ExitCritical(key);
+
+    return status;
+}
+
+/*---------------------------------- Mutex ----------------------------------*/
+HAL_StatusTypeDef K_MutexInit(K_MutexTypeDef *Mutex)
+{
+    if (Mutex == NULL) {
+        return HAL_ERROR;
+    }
+    Mutex->Owner = NULL;
+    Mutex->LockCount = 0U;
+    Mutex->Waiters = NULL;
+    Mutex->NextHeld = NULL;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Lock a mutex (threads only)
+ * @note    While a thread waits, the owner (and whoever that owner waits for) runs
+ *          at least at the waiter's priority, so a medium priority thread cannot
+ *          hold up the high priority one.
+ * @retval  HAL_OK, HAL_BUSY (K_NO_WAIT) or HAL_TIMEOUT
+ */
+HAL_StatusTypeDef K_MutexLock(K_MutexTypeDef *Mutex, uint32_t Timeout)
+{
+    K_ThreadTypeDef *cur;
+    uint32_t key = HAL_NVIC_EnterCritical(K_MAX_SYSCALL_PRIORITY);
+
+    cur = K_CurrentThread;
+    if (Mutex->Owner == NULL) {
+        Mutex->Owner = cur;
+        Mutex->LockCount = 1U;
+        Mutex->NextHeld = cur->MutexHeld;
+        cur->MutexHeld = Mutex;
+        HAL_NVIC_ExitCritical(key);
+        return HAL_OK;
+    }
+    if (Mutex->Owner == cur) {
+        Mutex->LockCount++;
+        HAL_NVIC_ExitCritical(key);
+        return HAL_OK;
+    }
+    if (Timeout == K_NO_WAIT) {
+        HAL_NVIC_ExitCritical(key);
+        return HAL_BUSY;
+    }
+
+    cur->BlockedMutex = Mutex;
+    K_BlockCurrent(&Mutex->Waiters, Timeout);
+    K_MutexPropagate(Mutex);
+    HAL_NVIC_ExitCritical(key);
+
+    /* Ownership was handed over by K_MutexUnlock(), or the timeout expired */
+    return K_CurrentThread->WaitResult;
+}
+
+/**
+ * @brief   Unlock a mutex held by the calling thread
+ * @note    Ownership goes straight to the highest priority waiter.
+ * @retval  HAL_ERROR if the caller is not the owner
+ */
+HAL_StatusTypeDef K_MutexUnlock(K_MutexTypeDef *Mutex)
+{
+    K_ThreadTypeDef *cur, *next;
+    K_MutexTypeDef **pp;
+    uint32_t key = HAL_NVIC_EnterCritical(K_MAX_SYSCALL_PRIORITY);
+
+    cur = K_CurrentThread;
+    if (Mutex->Owner != cur) {
+        HAL_NVIC_ExitCritical(key);
+        return HAL_ERROR;
+    }
+    if (--Mutex->LockCount != 0U) {
+        HAL_NVIC_ExitCritical(key);
+        return HAL_OK;
+    }
+
+    for (pp = &cur->MutexHeld; *pp != NULL; pp = &(*pp)->NextHeld) {
+        if (*pp == Mutex) {
+            *pp = Mutex->NextHeld;
+            break;
+        }
+    }
+
+    next = Mutex->Waiters;
+    if (next != NULL) {
+        next->BlockedMutex = NULL;
+        K_Wake(next, HAL_OK);
+        Mutex->Owner = next;
+        Mutex->LockCount = 1U;
+        Mutex->NextHeld = next->MutexHeld;
+        next->MutexHeld = Mutex;
+        K_SetPriority(next, K_InheritedPriority(next));
+    }
+    else {
+        Mutex->Owner = NULL;
+    }
+    K_SetPriority(cur, K_InheritedPriority(cur));
+    K_Schedule();
+    HAL_NVIC_ExitCritical(key);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Kernel statistics
+ * @note    LastSwitchCycles / MaxSwitchCycles measure PendSV from entry to exception
+ *          return (save, select, restore), FP registers included when they are saved.
+ */
+void K_GetStats(K_StatsTypeDef *Stats)
+{
+    uint32_t key = HAL_NVIC_EnterCritical(K_MAX_SYSCALL_PRIORITY);
+
+    *Stats = k.Stats;
+    Stats->LastSwitchCycles = K_SwitchCycles[1];
+    if (Stats->LastSwitchCycles > Stats->MaxSwitchCycles) {
+        Stats->MaxSwitchCycles = Stats->LastSwitchCycles;
+    }
+    HAL_NVIC_ExitCritical(key);
+}
+
+/**
+ * @brief   Called when a thread overflowed its stack, the default stops here
+ */
+__weak void K_StackOverflowHook(K_ThreadTypeDef *Thread)
+{
+    UNUSED(Thread);
+    __disable_irq();
+    for (;;) {
+    }
+}
+
+/*---------------------------------- Threads ----------------------------------*/
+/* A thread returned from its entry function */
+static void K_ThreadExit(void)
+{
+    uint32_t key = HAL_NVIC_EnterCritical(K_MAX_SYSCALL_PRIORITY);
+
+    K_ReadyRemove(K_CurrentThread);
+    K_CurrentThread->State = K_STATE_TERMINATED;
+    K_Schedule();
+    HAL_NVIC_ExitCritical(key);
+    for (;;) {
+    }
+}
+
+/**
+ * @brief   Tickless idle
+ * @note    SysTick is stopped, reloaded to expire at the next wake-up (at most MaxIdleTicks
+ *          away) and the core sleeps. On wake-up the ticks that really passed are
+ *          accounted and SysTick is realigned on the tick boundary. Runs with PRIMASK
+ *          set so WFI still wakes on any interrupt but no handler runs before the
+ *          tick count is corrected.
+ */
+static void K_IdleSleep(void)
+{
+    uint32_t expected, reload, ctrl, completed, decrements;
+    int32_t delta;
+
+    __disable_irq();
+    if ((k.ReadyMask & ~1UL) != 0U) {
+        __enable_irq();
+        return;
+    }
+    expected = k.MaxIdleTicks;
+    if (k.DelayList != NULL) {
+        delta = (int32_t)(k.DelayList->WakeTick - k.Tick);
+        if (delta < (int32_t)expected) {
+            expected = (delta > 0) ? (uint32_t)delta : 0U;
+        }
+    }
+    if ((expected < K_IDLE_MIN_TICKS) || ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U)) {
+        __DSB();
+        __WFI();
+        __enable_irq();
+        return;
+    }
+
+    CLEAR_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Msk);
+    reload = SysTick->VAL + (k.CyclesPerTick * (expected - 1U));
+    SysTick->LOAD = reload;
+    SysTick->VAL = 0U;
+    SET_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Msk);
+
+    __DSB();
+    __WFI();
+    __ISB();
+
+    ctrl = SysTick->CTRL;       /* reading clears COUNTFLAG */
+    SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+    if ((ctrl & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
+    {
+        /* Slept the whole period, the pending SysTick interrupt accounts for the last tick */
+        decrements = reload - SysTick->VAL;
+        SysTick->LOAD = (decrements < k.CyclesPerTick) ? ((k.CyclesPerTick - 1U) - decrements) : (k.CyclesPerTick - 1U);
+        completed = expected - 1U;
+    }
+    else
+    {
+        /* Woken by another interrupt: count whole ticks, run to the next tick boundary */
+        decrements = (expected * k.CyclesPerTick) - SysTick->VAL;
+        completed = decrements / k.CyclesPerTick;
+        SysTick->LOAD = ((completed + 1U) * k.CyclesPerTick) - decrements;
+    }
+    SysTick->VAL = 0U;
+    SET_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Msk);
+    SysTick->LOAD = k.CyclesPerTick - 1U;      /* used from the next reload on */
+
+    k.Stats.IdleSleeps++;
+    k.Stats.IdleTicksSuppressed += completed;
+    K_TickAdvance(completed);
+    __enable_irq();
+}
+
+static void K_IdleThread(void *Arg)
+{
+    UNUSED(Arg);
+    for (;;) {
+        K_IdleSleep();
+    }
+}
+
+/*---------------------------------- Exception handlers ----------------------------------*/
+static void K_SysTickHandler(void)
+{
+    uint32_t key = HAL_NVIC_EnterCritical(K_MAX_SYSCALL_PRIORITY);
+
+    K_TickAdvance(1U);
+    HAL_NVIC_ExitCritical(key);
+}
+
+/**
+ * @brief   Context switch
+ * @note    EXC_RETURN bit 4 = 0 means the hardware stacked an extended frame (the thread
+ *          has an FP context): only then s16-s31 are saved/restored here.
+ *          K_SwitchContext() runs with the kernel interrupts masked.
+ *          CYCCNT is sampled at entry and exit for K_GetStats().
+ */
+__attribute__((naked)) static void K_PendSVHandler(void)
+{
+    __ASM volatile (
+    "   ldr     r1, 2f                  \n"
+    "   ldr     r1, [r1]                \n"
+    "   ldr     r2, 3f                  \n"
+    "   str     r1, [r2]                \n"     /* K_SwitchCycles[0] = CYCCNT */
+    "   mrs     r0, psp                 \n"
+    "   isb                             \n"
+    "   ldr     r3, 1f                  \n"
+    "   ldr     r2, [r3]                \n"     /* r2 = K_CurrentThread */
+    "   tst     lr, #0x10               \n"
+    "   it      eq                      \n"
+    "   vstmdbeq r0!, {s16-s31}         \n"
+    "   stmdb   r0!, {r4-r11, lr}       \n"
+    "   str     r0, [r2]                \n"     /* ->Sp */
+    "   mov     r0, %0                  \n"
+    "   msr     basepri, r0             \n"
+    "   dsb                             \n"
+    "   isb                             \n"
+    "   bl      K_SwitchContext         \n"
+    "   mov     r0, #0                  \n"
+    "   msr     basepri, r0             \n"
+    "   ldr     r3, 1f                  \n"
+    "   ldr     r1, [r3]                \n"
+    "   ldr     r0, [r1]                \n"     /* new ->Sp */
+    "   ldmia   r0!, {r4-r11, lr}       \n"
+    "   tst     lr, #0x10               \n"
+    "   it      eq                      \n"
+    "   vldmiaeq r0!, {s16-s31}         \n"
+    "   msr     psp, r0                 \n"
+    "   isb                             \n"
+    "   ldr     r1, 2f                  \n"
+    "   ldr     r1, [r1]                \n"
+    "   ldr     r2, 3f                  \n"
+    "   ldr     r0, [r2]                \n"
+    "   sub     r1, r1, r0              \n"
+    "   str     r1, [r2, #4]            \n"     /* K_SwitchCycles[1] = CYCCNT - entry */
+    "   bx      lr                      \n"
+    "   .align  2                       \n"
+    "1: .word   K_CurrentThread         \n"
+    "2: .word   0xE0001004              \n"     /* DWT->CYCCNT */
+    "3: .word   K_SwitchCycles          \n"
+    :: "i" (K_BASEPRI)
+    );
+}
+
+/**
+ * @brief   SVC 0: restore the first thread and return to thread mode on PSP
+ */
+__attribute__((naked)) static void K_SVCHandler(void)
+{
+    __ASM volatile (
+    "   ldr     r3, 1f                  \n"
+    "   ldr     r1, [r3]                \n"
+    "   ldr     r0, [r1]                \n"
+    "   ldmia   r0!, {r4-r11, lr}       \n"
+    "   msr     psp, r0                 \n"
+    "   isb                             \n"
+    "   mov     r0, #0                  \n"
+    "   msr     basepri, r0             \n"
+    "   bx      lr                      \n"
+    "   .align  2                       \n"
+    "1: .word   K_CurrentThread         \n"
+    );
+}
+
+/**
+ * @brief   Reset MSP to the top of the main stack (first word of the vector table),
+ *          enable interrupts and enter the first thread through SVC
+ */
+__attribute__((naked)) static void K_StartFirstThread(void)
+{
+    __ASM volatile (
+    "   ldr     r0, =0xE000ED08         \n"
+    "   ldr     r0, [r0]                \n"
+    "   ldr     r0, [r0]                \n"
+    "   msr     msp, r0                 \n"
+    "   mov     r0, #0                  \n"
+    "   msr     control, r0             \n"     /* clear FPCA, privileged */
+    "   isb                             \n"
+    "   cpsie   i                       \n"
+    "   cpsie   f                       \n"
+    "   dsb                             \n"
+    "   isb                             \n"
+    "   svc     0                       \n"
+    "   nop                             \n"
+    "   .ltorg                          \n"
+    );
+}
\ No newline at end of file
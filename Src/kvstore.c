@@ -0,0 +1,463 @@
+#include "kvstore.h"
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief: Private macros
+ */
+#define KV_MAGIC                0x4B56534CU     /* "KVSL" */
+#define KV_ALIGN                8U              /* Records start on x64 units */
+#define KV_TOMBSTONE            0x8000U         /* Length flag: key deleted */
+#define KV_LENGTH_MASK          0x7FFFU
+#define KV_KEY_BLANK            0xFFFFU
+
+#define KV_RECORD_SIZE(LEN)     ((sizeof(KV_RecordTypeDef) + (LEN) + (KV_ALIGN - 1U)) & ~(KV_ALIGN - 1U))
+#define KV_RECORD_MAX           KV_RECORD_SIZE(KV_VALUE_MAX)
+#define KV_NEXT(KV, SECTOR)     (((SECTOR) + 1U) % (KV)->Dev->SectorCount)
+
+/**
+ * @brief: Private types
+ */
+typedef struct
+{
+    uint32_t EraseCount;        /* Programmed after the erase, with Magic */
+    uint32_t Magic;
+    uint32_t Sequence;          /* Programmed when the sector becomes the head */
+    uint32_t SequenceCheck;     /* ~Sequence, tells a cut activation from a real one */
+} KV_SectorHeaderTypeDef;
+
+typedef struct
+{
+    uint16_t Key;
+    uint16_t Length;            /* Value bytes | KV_TOMBSTONE */
+    uint32_t Crc;               /* Over Key, Length and the value */
+} KV_RecordTypeDef;
+
+/**
+ * @brief: Private functions
+ */
+static uint32_t KV_Scan(KV_StoreTypeDef *Kv, uint32_t Sector);
+static HAL_StatusTypeDef KV_Seal(KV_StoreTypeDef *Kv, uint32_t Location);
+static void KV_Apply(KV_StoreTypeDef *Kv, uint32_t Key, uint32_t Location);
+static HAL_StatusTypeDef KV_Append(KV_StoreTypeDef *Kv, uint32_t Key, uint32_t Length, const void *Value);
+static HAL_StatusTypeDef KV_WriteRecord(KV_StoreTypeDef *Kv, uint32_t Key, uint32_t Length, const void *Value);
+static HAL_StatusTypeDef KV_Advance(KV_StoreTypeDef *Kv);
+static HAL_StatusTypeDef KV_Reclaim(KV_StoreTypeDef *Kv, uint32_t Sector);
+static HAL_StatusTypeDef KV_Format(KV_StoreTypeDef *Kv, uint32_t Sector, uint32_t EraseCount);
+static HAL_StatusTypeDef KV_Activate(KV_StoreTypeDef *Kv, uint32_t Sector, uint32_t Sequence);
+static const KV_RecordTypeDef *KV_Record(KV_StoreTypeDef *Kv, uint32_t Location);
+static uint32_t KV_Crc(const KV_RecordTypeDef *Record, const void *Value);
+
+/*------------------------------------------- Store -------------------------------------------*/
+/**
+ * @brief   Open the store on a flash region, formatting it if it holds none
+ * @note    Scans the whole log to build the index (reads only, ~1 ms per 100 KB). Sectors
+ *          with a damaged header are erased, a torn record header is sealed, an
+ *          interrupted reclaim is finished. Records of keys >= KeyCount are ignored and
+ *          dropped when their sector is reclaimed.
+ * @param   Dev - 2 ~ KV_MAX_SECTORS sectors, each at least 4 records of KV_VALUE_MAX
+ * @param   Index - KeyCount entries, owned by the store
+ * @param   KeyCount - 1 ~ 0xFFFF
+ */
+HAL_StatusTypeDef KV_Mount(KV_StoreTypeDef *Kv, FDEV_DeviceTypeDef *Dev, uint32_t *Index, uint32_t KeyCount)
+{
+    const KV_SectorHeaderTypeDef *header;
+    KV_SectorTypeDef *sector;
+    uint32_t maxErase = 0U;
+    uint32_t active = 0U;
+    uint32_t used;
+    uint32_t s;
+    uint32_t i;
+
+    if ((Kv == NULL) || (Dev == NULL) || (Index == NULL) || (KeyCount == 0U) || (KeyCount > KV_KEY_BLANK) ||
+        (Dev->SectorCount < 2U) || (Dev->SectorCount > KV_MAX_SECTORS) || ((KV_ALIGN % Dev->ProgramUnit) != 0U) ||
+        (Dev->SectorSize < (sizeof(KV_SectorHeaderTypeDef) + (4U * KV_RECORD_MAX)))) {
+        return HAL_ERROR;
+    }
+    memset(Kv, 0, sizeof(*Kv));
+    Kv->Dev = Dev;
+    Kv->Index = Index;
+    Kv->KeyCount = KeyCount;
+    Kv->Capacity = (Dev->SectorCount - 1U) * (Dev->SectorSize - sizeof(KV_SectorHeaderTypeDef) - KV_RECORD_MAX);
+    for (i = 0U; i < KeyCount; i++) {
+        Index[i] = KV_NONE;
+    }
+
+    /* Headers: spare (Sequence blank), active, or damaged (erase or activation cut, or no
+       store yet) which is left with a KV_NONE erase count and formatted */
+    for (s = 0U; s < Dev->SectorCount; s++)
+    {
+        header = (const KV_SectorHeaderTypeDef *)(Dev->Memory + (s * Dev->SectorSize));
+        sector = &Kv->Sectors[s];
+        sector->Sequence = KV_NONE;
+        sector->EraseCount = KV_NONE;
+        if (header->Magic != KV_MAGIC) {
+            continue;
+        }
+        if ((header->Sequence == KV_NONE) && (header->SequenceCheck == KV_NONE)) {
+            sector->EraseCount = header->EraseCount;
+        }
+        else if ((header->Sequence != KV_NONE) && (header->Sequence == ~header->SequenceCheck)) {
+            sector->EraseCount = header->EraseCount;
+            sector->Sequence = header->Sequence;
+            if ((active == 0U) || ((int32_t)(sector->Sequence - Kv->Sectors[Kv->Head].Sequence) > 0)) {
+                Kv->Head = s;
+            }
+            active++;
+        }
+        if ((sector->EraseCount != KV_NONE) && (sector->EraseCount > maxErase)) {
+            maxErase = sector->EraseCount;
+        }
+    }
+    for (s = 0U; s < Dev->SectorCount; s++)
+    {
+        if ((Kv->Sectors[s].EraseCount == KV_NONE) && (KV_Format(Kv, s, maxErase + 1U) != HAL_OK)) {
+            return HAL_ERROR;
+        }
+    }
+
+    if (active == 0U)
+    {
+        Kv->Head = 0U;
+        Kv->HeadUsed = sizeof(KV_SectorHeaderTypeDef);
+        return KV_Activate(Kv, 0U, 1U);
+    }
+
+    /* Oldest first, so the index ends up at the latest record of each key */
+    s = Kv->Head;
+    for (i = 0U; i < Dev->SectorCount; i++)
+    {
+        s = KV_NEXT(Kv, s);
+        if (Kv->Sectors[s].Sequence == KV_NONE) {
+            continue;
+        }
+        used = KV_Scan(Kv, s);
+        if (s == Kv->Head) {
+            Kv->HeadUsed = used;
+        }
+    }
+
+    /* No spare left: cut between moving the head and erasing the oldest sector */
+    s = KV_NEXT(Kv, Kv->Head);
+    if (Kv->Sectors[s].Sequence != KV_NONE) {
+        return KV_Reclaim(Kv, s);
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief   Store a value, nothing is written if it is unchanged
+ * @retval  HAL_OK, HAL_ERROR if out of range, the store is full or flash failed
+ */
+HAL_StatusTypeDef KV_Set(KV_StoreTypeDef *Kv, uint32_t Key, const void *Value, uint32_t Length)
+{
+    const KV_RecordTypeDef *record;
+
+    if ((Key >= Kv->KeyCount) || (Length > KV_VALUE_MAX) || ((Value == NULL) && (Length != 0U))) {
+        return HAL_ERROR;
+    }
+    if (Kv->Index[Key] != KV_NONE)
+    {
+        record = KV_Record(Kv, Kv->Index[Key]);
+        if ((record->Length == Length) && ((Length == 0U) || (memcmp(record + 1, Value, Length) == 0))) {
+            return HAL_OK;
+        }
+    }
+    return KV_Append(Kv, Key, Length, Value);
+}
+
+/**
+ * @brief   Read a value
+ * @param   Size - Room in Value
+ * @param   Length - Receives the value length, may be NULL
+ * @retval  HAL_OK, HAL_ERROR if the key has no value or it does not fit in Size
+ */
+HAL_StatusTypeDef KV_Get(KV_StoreTypeDef *Kv, uint32_t Key, void *Value, uint32_t Size, uint32_t *Length)
+{
+    const KV_RecordTypeDef *record;
+
+    if ((Key >= Kv->KeyCount) || (Kv->Index[Key] == KV_NONE)) {
+        return HAL_ERROR;
+    }
+    record = KV_Record(Kv, Kv->Index[Key]);
+    if ((record->Length & KV_TOMBSTONE) != 0U) {
+        return HAL_ERROR;
+    }
+    if (Length != NULL) {
+        *Length = record->Length;
+    }
+    if (record->Length > Size) {
+        return HAL_ERROR;
+    }
+    memcpy(Value, record + 1, record->Length);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Remove a key (appends a tombstone, kept until its sector is the oldest)
+ */
+HAL_StatusTypeDef KV_Delete(KV_StoreTypeDef *Kv, uint32_t Key)
+{
+    if (Key >= Kv->KeyCount) {
+        return HAL_ERROR;
+    }
+    if ((Kv->Index[Key] == KV_NONE) || ((KV_Record(Kv, Kv->Index[Key])->Length & KV_TOMBSTONE) != 0U)) {
+        return HAL_OK;
+    }
+    return KV_Append(Kv, Key, KV_TOMBSTONE, NULL);
+}
+
+/*------------------------------------------- Private functions -------------------------------------------*/
+/* Index the valid records of a sector, returns where appends can go on. A torn record
+   (cut while programmed) is stepped over if its length is sane; the free space after
+   the last record must then be checked blank, else the sector takes no more appends.
+   A header cut before its length was complete is the last thing programmed: it is
+   sealed (KV_Seal) and the log goes on after it, the head keeps taking appends, so a
+   reclaim cut short can always be finished */
+static uint32_t KV_Scan(KV_StoreTypeDef *Kv, uint32_t Sector)
+{
+    const KV_RecordTypeDef *record;
+    uint32_t base = Sector * Kv->Dev->SectorSize;
+    uint32_t offset = sizeof(KV_SectorHeaderTypeDef);
+    uint32_t torn = 0U;
+    uint32_t length;
+    uint32_t end;
+
+    while ((offset + sizeof(KV_RecordTypeDef)) <= Kv->Dev->SectorSize)
+    {
+        record = KV_Record(Kv, base + offset);
+        if ((record->Key == KV_KEY_BLANK) && (record->Length == 0xFFFFU) && (record->Crc == KV_NONE)) {
+            break;
+        }
+        length = record->Length & KV_LENGTH_MASK;
+        if ((length > KV_VALUE_MAX) || (KV_RECORD_SIZE(length) > (Kv->Dev->SectorSize - offset))) {
+            if (KV_Seal(Kv, base + offset) != HAL_OK) {
+                return Kv->Dev->SectorSize;
+            }
+            continue;
+        }
+        if (record->Crc == KV_Crc(record, record + 1)) {
+            KV_Apply(Kv, record->Key, base + offset);
+        }
+        else {
+            torn = 1U;
+        }
+        offset += KV_RECORD_SIZE(length);
+    }
+
+    for (end = offset; (torn != 0U) && (end < Kv->Dev->SectorSize); end += sizeof(uint32_t))
+    {
+        if (*(const uint32_t *)(Kv->Dev->Memory + base + end) != 0xFFFFFFFFU) {
+            return Kv->Dev->SectorSize;
+        }
+    }
+    return offset;
+}
+
+/* Program a torn header to 0: a record of length 0 whose CRC never matches, which scans
+   step over. Only if nothing follows it in the sector, else the length it was meant to
+   have is needed to find the next record */
+static HAL_StatusTypeDef KV_Seal(KV_StoreTypeDef *Kv, uint32_t Location)
+{
+    static const KV_RecordTypeDef zero = { 0U, 0U, 0U };
+    uint32_t end = ((Location / Kv->Dev->SectorSize) + 1U) * Kv->Dev->SectorSize;
+    uint32_t offset;
+
+    for (offset = Location + sizeof(KV_RecordTypeDef); offset < end; offset += sizeof(uint32_t))
+    {
+        if (*(const uint32_t *)(Kv->Dev->Memory + offset) != 0xFFFFFFFFU) {
+            return HAL_ERROR;
+        }
+    }
+    if ((FDEV_Write(Kv->Dev, Location, &zero, sizeof(zero)) != HAL_OK) || (FDEV_Flush(Kv->Dev) != HAL_OK) ||
+        (memcmp(KV_Record(Kv, Location), &zero, sizeof(zero)) != 0)) {
+        return HAL_ERROR;
+    }
+    return HAL_OK;
+}
+
+/* Point the index at a newer record of the key, moving the live byte count with it */
+static void KV_Apply(KV_StoreTypeDef *Kv, uint32_t Key, uint32_t Location)
+{
+    uint32_t size;
+    uint32_t old;
+
+    if (Key >= Kv->KeyCount) {
+        return;
+    }
+    old = Kv->Index[Key];
+    if (old != KV_NONE)
+    {
+        size = KV_RECORD_SIZE(KV_Record(Kv, old)->Length & KV_LENGTH_MASK);
+        Kv->Sectors[old / Kv->Dev->SectorSize].Live -= size;
+        Kv->LiveBytes -= size;
+    }
+    size = KV_RECORD_SIZE(KV_Record(Kv, Location)->Length & KV_LENGTH_MASK);
+    Kv->Sectors[Location / Kv->Dev->SectorSize].Live += size;
+    Kv->LiveBytes += size;
+    Kv->Index[Key] = Location;
+}
+
+/* New record for a key, moving the head on first if it does not fit */
+static HAL_StatusTypeDef KV_Append(KV_StoreTypeDef *Kv, uint32_t Key, uint32_t Length, const void *Value)
+{
+    uint32_t size = KV_RECORD_SIZE(Length & KV_LENGTH_MASK);
+    uint32_t old = 0U;
+    uint32_t turns = 0U;
+
+    if (Kv->Index[Key] != KV_NONE) {
+        old = KV_RECORD_SIZE(KV_Record(Kv, Kv->Index[Key])->Length & KV_LENGTH_MASK);
+    }
+    if (((Kv->LiveBytes - old) + size) > Kv->Capacity) {
+        return HAL_ERROR;
+    }
+    while ((Kv->HeadUsed + size) > Kv->Dev->SectorSize)
+    {
+        if ((++turns > Kv->Dev->SectorCount) || (KV_Advance(Kv) != HAL_OK)) {
+            return HAL_ERROR;
+        }
+    }
+    Kv->Sets++;
+
+    return KV_WriteRecord(Kv, Key, Length, Value);
+}
+
+/* Program a record at the head and index it. A failed write leaves the head full */
+static HAL_StatusTypeDef KV_WriteRecord(KV_StoreTypeDef *Kv, uint32_t Key, uint32_t Length, const void *Value)
+{
+    uint32_t location = (Kv->Head * Kv->Dev->SectorSize) + Kv->HeadUsed;
+    KV_RecordTypeDef record;
+
+    record.Key = (uint16_t)Key;
+    record.Length = (uint16_t)Length;
+    record.Crc = KV_Crc(&record, Value);
+
+    if ((FDEV_Write(Kv->Dev, location, &record, sizeof(record)) != HAL_OK) ||
+        (FDEV_Write(Kv->Dev, location + sizeof(record), Value, Length & KV_LENGTH_MASK) != HAL_OK) ||
+        (FDEV_Flush(Kv->Dev) != HAL_OK)) {
+        Kv->HeadUsed = Kv->Dev->SectorSize;
+        return HAL_ERROR;
+    }
+    Kv->HeadUsed += KV_RECORD_SIZE(Length & KV_LENGTH_MASK);
+    KV_Apply(Kv, Key, location);
+
+    return HAL_OK;
+}
+
+/* Move the head to the spare sector, then reclaim the oldest to get a spare again */
+static HAL_StatusTypeDef KV_Advance(KV_StoreTypeDef *Kv)
+{
+    uint32_t next = KV_NEXT(Kv, Kv->Head);
+
+    if ((Kv->Sectors[next].Sequence != KV_NONE) ||
+        (KV_Activate(Kv, next, Kv->Sectors[Kv->Head].Sequence + 1U) != HAL_OK)) {
+        return HAL_ERROR;
+    }
+    Kv->Head = next;
+    Kv->HeadUsed = sizeof(KV_SectorHeaderTypeDef);
+
+    return KV_Reclaim(Kv, KV_NEXT(Kv, next));
+}
+
+/* Copy the live records of a sector to the head and erase it. Tombstones in the oldest
+   sector have nothing older left to hide and are dropped */
+static HAL_StatusTypeDef KV_Reclaim(KV_StoreTypeDef *Kv, uint32_t Sector)
+{
+    const KV_RecordTypeDef *record;
+    uint32_t base = Sector * Kv->Dev->SectorSize;
+    uint32_t offset = sizeof(KV_SectorHeaderTypeDef);
+    uint32_t size;
+
+    if (Kv->Sectors[Sector].Sequence == KV_NONE) {
+        return HAL_OK;
+    }
+    while ((Kv->Sectors[Sector].Live != 0U) && ((offset + sizeof(KV_RecordTypeDef)) <= Kv->Dev->SectorSize))
+    {
+        record = KV_Record(Kv, base + offset);
+        size = KV_RECORD_SIZE(record->Length & KV_LENGTH_MASK);
+        if ((record->Key < Kv->KeyCount) && (Kv->Index[record->Key] == (base + offset)))
+        {
+            if ((record->Length & KV_TOMBSTONE) != 0U)
+            {
+                Kv->Index[record->Key] = KV_NONE;
+                Kv->Sectors[Sector].Live -= size;
+                Kv->LiveBytes -= size;
+            }
+            else if (((Kv->HeadUsed + size) > Kv->Dev->SectorSize) ||
+                     (KV_WriteRecord(Kv, record->Key, record->Length, record + 1) != HAL_OK)) {
+                return HAL_ERROR;
+            }
+        }
+        offset += size;
+    }
+    Kv->Reclaims++;
+
+    return KV_Format(Kv, Sector, Kv->Sectors[Sector].EraseCount + 1U);
+}
+
+/* Erase and mark as spare */
+static HAL_StatusTypeDef KV_Format(KV_StoreTypeDef *Kv, uint32_t Sector, uint32_t EraseCount)
+{
+    KV_SectorHeaderTypeDef header;
+
+    header.EraseCount = EraseCount;
+    header.Magic = KV_MAGIC;
+    Kv->Sectors[Sector].Sequence = KV_NONE;
+    Kv->Sectors[Sector].EraseCount = EraseCount;
+    Kv->Sectors[Sector].Live = 0U;
+
+    if ((FDEV_Erase(Kv->Dev, Sector) != HAL_OK) ||
+        (FDEV_Write(Kv->Dev, Sector * Kv->Dev->SectorSize, &header, 2U * sizeof(uint32_t)) != HAL_OK)) {
+        return HAL_ERROR;
+    }
+    return FDEV_Flush(Kv->Dev);
+}
+
+/* Spare becomes part of the log */
+static HAL_StatusTypeDef KV_Activate(KV_StoreTypeDef *Kv, uint32_t Sector, uint32_t Sequence)
+{
+    uint32_t words[2];
+
+    words[0] = Sequence;
+    words[1] = ~Sequence;
+    if (FDEV_Write(Kv->Dev, (Sector * Kv->Dev->SectorSize) + offsetof(KV_SectorHeaderTypeDef, Sequence),
+                   words, sizeof(words)) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    Kv->Sectors[Sector].Sequence = Sequence;
+
+    return FDEV_Flush(Kv->Dev);
+}
+
+static const KV_RecordTypeDef *KV_Record(KV_StoreTypeDef *Kv, uint32_t Location)
+{
+    return (const KV_RecordTypeDef *)(Kv->Dev->Memory + Location);
+}
+
+/* CRC-32 (IEEE, reflected), 4 bits at a time */
+static uint32_t KV_Crc(const KV_RecordTypeDef *Record, const void *Value)
+{
+    static const uint32_t table[16] = {
+        0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+        0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU
+    };
+    const uint8_t *data = (const uint8_t *)Record;
+    uint32_t length = 4U;
+    uint32_t crc = 0xFFFFFFFFU;
+    uint32_t pass;
+
+    /* Key and Length, then the value */
+    for (pass = 0U; pass < 2U; pass++)
+    {
+        while (length-- != 0U)
+        {
+            crc ^= *data++;
+            crc = (crc >> 4) ^ table[crc & 0x0FU];
+            crc = (crc >> 4) ^ table[crc & 0x0FU];
+        }
+        data = (const uint8_t *)Value;
+        length = Record->Length & KV_LENGTH_MASK;
+    }
+    return ~crc;
+}
\ No newline at end of file
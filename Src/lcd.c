@@ -0,0 +1,350 @@
+#include "lcd.h"
+
+/**
+ * @brief: LCD state
+ */
+typedef struct
+{
+    FSMC_NORSRAM_HandleTypeDef hsram;
+    DMA_HandleTypeDef hdma;
+    __IO uint16_t *Command;             /*< Bank base: RS low >*/
+    __IO uint16_t *Data;                /*< RS line set >*/
+    uint32_t Width;
+    uint32_t Height;
+    const uint16_t *Src;                /*< Next pixels to send >*/
+    uint32_t SrcInc;                    /*< 1 for a blit, 0 for a fill >*/
+    uint32_t Left;                      /*< Pixels left in the current run >*/
+    uint32_t Runs;                      /*< Runs left after the current one >*/
+    uint32_t RunLength;                 /*< Pixels per run: a row, or the whole region if contiguous >*/
+    uint32_t Skip;                      /*< Pixels between two runs in the framebuffer >*/
+    uint16_t FillColor;
+    __IO uint32_t Busy;
+} LCD_TypeDef;
+
+static LCD_TypeDef lcd;
+
+/** @brief: Private macros */
+#define LCD_RS_LINE_MAX         24U
+#define LCD_IS_CCM(ADDR)        (((uint32_t)(ADDR) >> 28U) == 0x1U)     /*< CCM RAM, out of DMA reach >*/
+#define LCD_IS_DMA2_STREAM(S)   (((uint32_t)(S) >= DMA2_Stream0_BASE) && ((uint32_t)(S) <= DMA2_Stream7_BASE))
+
+/** @brief: Private functions */
+static HAL_StatusTypeDef LCD_Next(void);
+static void LCD_DmaCplt(DMA_HandleTypeDef *hdma);
+static void LCD_DmaError(DMA_HandleTypeDef *hdma);
+
+static IRQn_Type LCD_DmaIRQn(const DMA_Stream_TypeDef *Stream)
+{
+    uint32_t index = ((uint32_t)Stream - DMA2_Stream0_BASE) / 0x18U;
+
+    return (index < 5U) ? (IRQn_Type)((uint32_t)DMA2_Stream0_IRQn + index) :
+                          (IRQn_Type)((uint32_t)DMA2_Stream5_IRQn + index - 5U);
+}
+
+/**
+ * @brief   Set up the FSMC bank and the DMA stream for the panel
+ * @retval  HAL_ERROR on a bad configuration, timing out of range at the current HCLK,
+ *          or the vector table not in SRAM
+ */
+HAL_StatusTypeDef LCD_Init(const LCD_InitTypeDef *Init)
+{
+    IRQn_Type irqn;
+
+    if ((Init == NULL) || !IS_FSMC_NORSRAM_BANK(Init->Bank) || (Init->RsLine > LCD_RS_LINE_MAX) ||
+        (Init->Width == 0U) || (Init->Height == 0U) || !LCD_IS_DMA2_STREAM(Init->DmaStream)) {
+        return HAL_ERROR;
+    }
+
+    /* Mode 1: the address phase is the strobe high time, the data phase the strobe low time */
+    lcd.hsram.Bank = Init->Bank;
+    lcd.hsram.Init.MemoryType = FSMC_MEMORY_TYPE_SRAM;
+    lcd.hsram.Init.DataWidth = FSMC_DATA_WIDTH_16;
+    lcd.hsram.Init.WriteEnable = FSMC_WRITE_ENABLE;
+    lcd.hsram.Init.AddressSetupNs = (Init->ReadCycleNs > Init->ReadLowNs) ? (Init->ReadCycleNs - Init->ReadLowNs) : 0U;
+    lcd.hsram.Init.DataSetupNs = Init->ReadLowNs;
+    lcd.hsram.Init.BusTurnNs = 0U;
+    lcd.hsram.Init.WriteAddressSetupNs = (Init->WriteCycleNs > Init->WriteLowNs) ? (Init->WriteCycleNs - Init->WriteLowNs) : 0U;
+    lcd.hsram.Init.WriteDataSetupNs = Init->WriteLowNs;
+    if (HAL_FSMC_NORSRAM_Init(&lcd.hsram) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    /* 16-bit bus: HADDR bit n + 1 drives A[n] */
+    lcd.Command = (__IO uint16_t *)lcd.hsram.BaseAddress;
+    lcd.Data = (__IO uint16_t *)(lcd.hsram.BaseAddress | (2UL << Init->RsLine));
+    lcd.Width = Init->Width;
+    lcd.Height = Init->Height;
+    lcd.Busy = 0U;
+
+    /* Memory to memory: the "peripheral" side is the source, the memory side the data address.
+       Low priority, a display refresh should not hold back peripheral streams. */
+    lcd.hdma.Instance = Init->DmaStream;
+    lcd.hdma.Init.Channel = DMA_CHANNEL_0;
+    lcd.hdma.Init.Direction = DMA_MEMORY_TO_MEMORY;
+    lcd.hdma.Init.PeriphInc = DMA_PINC_ENABLE;
+    lcd.hdma.Init.MemInc = DMA_MINC_DISABLE;
+    lcd.hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    lcd.hdma.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    lcd.hdma.Init.Mode = DMA_NORMAL;
+    lcd.hdma.Init.Priority = DMA_PRIORITY_LOW;
+    lcd.hdma.Init.FIFOMode = DMA_FIFOMODE_ENABLE;           /* direct mode is not allowed memory to memory */
+    lcd.hdma.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_HALFFULL;
+    lcd.hdma.Init.MemBurst = DMA_MBURST_SINGLE;
+    lcd.hdma.Init.PeriphBurst = DMA_PBURST_SINGLE;
+    lcd.hdma.XferCpltCallback = LCD_DmaCplt;
+    lcd.hdma.XferHalfCpltCallback = NULL;
+    lcd.hdma.XferM1CpltCallback = NULL;
+    lcd.hdma.XferErrorCallback = LCD_DmaError;
+    if (HAL_DMA_Init(&lcd.hdma) != HAL_OK) {
+        return HAL_ERROR;
+    }
+
+    irqn = LCD_DmaIRQn(Init->DmaStream);
+    if (HAL_NVIC_SetVector(irqn, LCD_DMA_IRQHandler, NULL) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    HAL_NVIC_SetPriority(irqn, Init->DmaPreemptPriority, 0U);
+    HAL_NVIC_EnableIRQ(irqn);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Recompute the bus timing after HCLK changed, see HAL_FSMC_NORSRAM_UpdateClock()
+ */
+HAL_StatusTypeDef LCD_UpdateClock(void)
+{
+    if (lcd.Busy != 0U) {
+        return HAL_BUSY;
+    }
+    return HAL_FSMC_NORSRAM_UpdateClock(&lcd.hsram);
+}
+
+/**
+ * @brief   New panel size, after an orientation change (MADCTL row/column exchange)
+ */
+HAL_StatusTypeDef LCD_SetSize(uint32_t Width, uint32_t Height)
+{
+    if ((Width == 0U) || (Height == 0U)) {
+        return HAL_ERROR;
+    }
+    if (lcd.Busy != 0U) {
+        return HAL_BUSY;
+    }
+    lcd.Width = Width;
+    lcd.Height = Height;
+    return HAL_OK;
+}
+
+/*------------------------------ Bus access ----------------------------------*/
+/**
+ * @note    No check against a running blit: the caller knows the bus is free.
+ */
+void LCD_WriteCommand(uint16_t Command)
+{
+    *lcd.Command = Command;
+}
+
+void LCD_WriteData(uint16_t Data)
+{
+    *lcd.Data = Data;
+}
+
+uint16_t LCD_ReadData(void)
+{
+    return *lcd.Data;
+}
+
+/**
+ * @brief   Send a DCS command with its parameter bytes
+ */
+HAL_StatusTypeDef LCD_Command(uint8_t Command, const uint8_t *Params, uint32_t Count)
+{
+    uint32_t i;
+
+    if ((Params == NULL) && (Count != 0U)) {
+        return HAL_ERROR;
+    }
+    if (lcd.Busy != 0U) {
+        return HAL_BUSY;
+    }
+    *lcd.Command = Command;
+    for (i = 0U; i < Count; i++) {
+        *lcd.Data = Params[i];
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief   Select a region and start a memory write: the next data writes are its pixels,
+ *          left to right then top to bottom
+ */
+HAL_StatusTypeDef LCD_SetWindow(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height)
+{
+    uint32_t x1 = X + Width - 1U;
+    uint32_t y1 = Y + Height - 1U;
+
+    if ((Width == 0U) || (Height == 0U) || (X >= lcd.Width) || (Y >= lcd.Height) ||
+        (Width > (lcd.Width - X)) || (Height > (lcd.Height - Y))) {
+        return HAL_ERROR;
+    }
+    if (lcd.Busy != 0U) {
+        return HAL_BUSY;
+    }
+
+    *lcd.Command = LCD_DCS_CASET;
+    *lcd.Data = (uint16_t)(X >> 8U);
+    *lcd.Data = (uint16_t)(X & 0xFFU);
+    *lcd.Data = (uint16_t)(x1 >> 8U);
+    *lcd.Data = (uint16_t)(x1 & 0xFFU);
+    *lcd.Command = LCD_DCS_RASET;
+    *lcd.Data = (uint16_t)(Y >> 8U);
+    *lcd.Data = (uint16_t)(Y & 0xFFU);
+    *lcd.Data = (uint16_t)(y1 >> 8U);
+    *lcd.Data = (uint16_t)(y1 & 0xFFU);
+    *lcd.Command = LCD_DCS_RAMWR;
+
+    return HAL_OK;
+}
+
+/*------------------------------ DMA transfers ----------------------------------*/
+/**
+ * @brief   Open the window and start the first transfer of a region
+ * @param   SrcInc - 1: Src is Width x Height pixels, rows Stride apart. 0: Src is one pixel
+ */
+static HAL_StatusTypeDef LCD_Start(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height,
+                                   const uint16_t *Src, uint32_t Stride, uint32_t SrcInc)
+{
+    HAL_StatusTypeDef status = LCD_SetWindow(X, Y, Width, Height);
+
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    /* Rows that follow each other in the framebuffer (or a fill) go as one run */
+    lcd.Src = Src;
+    lcd.SrcInc = SrcInc;
+    if ((SrcInc == 0U) || (Stride == Width)) {
+        lcd.RunLength = Width * Height;
+        lcd.Runs = 0U;
+    }
+    else {
+        lcd.RunLength = Width;
+        lcd.Runs = Height - 1U;
+    }
+    lcd.Skip = Stride - Width;
+    lcd.Left = lcd.RunLength;
+
+    lcd.hdma.Init.PeriphInc = (SrcInc != 0U) ? DMA_PINC_ENABLE : DMA_PINC_DISABLE;
+    if (HAL_DMA_Init(&lcd.hdma) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    lcd.Busy = 1U;
+    if (LCD_Next() != HAL_OK) {
+        lcd.Busy = 0U;
+        return HAL_ERROR;
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief   Start the next transfer: the rest of the run, up to LCD_DMA_MAX pixels
+ */
+static HAL_StatusTypeDef LCD_Next(void)
+{
+    uint32_t count;
+
+    if (lcd.Left == 0U) {
+        lcd.Src += lcd.Skip;
+        lcd.Left = lcd.RunLength;
+        lcd.Runs--;
+    }
+    count = (lcd.Left > LCD_DMA_MAX) ? LCD_DMA_MAX : lcd.Left;
+    if (HAL_DMA_Start_IT(&lcd.hdma, (uint32_t)lcd.Src, (uint32_t)lcd.Data, count) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    lcd.Src += count * lcd.SrcInc;
+    lcd.Left -= count;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Send a framebuffer region, in the background
+ * @param   Pixels - First pixel of the region, RGB565 in the controller byte order
+ * @param   Stride - Pixels from one row of the framebuffer to the next, >= Width
+ * @retval  HAL_BUSY while a blit or fill runs, HAL_ERROR if the region is off the panel
+ */
+HAL_StatusTypeDef LCD_Blit(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height,
+                           const uint16_t *Pixels, uint32_t Stride)
+{
+    if ((Pixels == NULL) || LCD_IS_CCM(Pixels) || (Stride < Width)) {
+        return HAL_ERROR;
+    }
+    return LCD_Start(X, Y, Width, Height, Pixels, Stride, 1U);
+}
+
+/**
+ * @brief   Paint a region with one color, in the background
+ */
+HAL_StatusTypeDef LCD_Fill(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, uint16_t Color)
+{
+    if (lcd.Busy != 0U) {
+        return HAL_BUSY;
+    }
+    lcd.FillColor = Color;
+    return LCD_Start(X, Y, Width, Height, &lcd.FillColor, Width, 0U);
+}
+
+uint32_t LCD_IsBusy(void)
+{
+    return lcd.Busy;
+}
+
+/**
+ * @brief   Wait for the running blit or fill to end
+ * @param   Timeout - Polls
+ */
+HAL_StatusTypeDef LCD_WaitIdle(uint32_t Timeout)
+{
+    while (lcd.Busy != 0U) {
+        if (Timeout-- == 0U) {
+            return HAL_TIMEOUT;
+        }
+    }
+    return HAL_OK;
+}
+
+static void LCD_DmaCplt(DMA_HandleTypeDef *hdma)
+{
+    UNUSED(hdma);
+
+    if ((lcd.Left == 0U) && (lcd.Runs == 0U)) {
+        lcd.Busy = 0U;
+        LCD_BlitCpltCallback(HAL_OK);
+    }
+    else if (LCD_Next() != HAL_OK) {
+        lcd.Busy = 0U;
+        LCD_BlitCpltCallback(HAL_ERROR);
+    }
+}
+
+static void LCD_DmaError(DMA_HandleTypeDef *hdma)
+{
+    UNUSED(hdma);
+
+    lcd.Busy = 0U;
+    LCD_BlitCpltCallback(HAL_ERROR);
+}
+
+/**
+ * @brief   The last transfer of a blit or fill is done (HAL_OK) or failed (HAL_ERROR)
+ * @note    Called from the DMA interrupt. The next blit may be started from here.
+ */
+__weak void LCD_BlitCpltCallback(HAL_StatusTypeDef Status)
+{
+    UNUSED(Status);
+}
+
+void LCD_DMA_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&lcd.hdma);
+}
\ No newline at end of file
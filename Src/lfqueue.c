@@ -0,0 +1,161 @@
+#include <string.h>
+#include "lfqueue.h"
+
+static inline uint32_t LFQ_IsPowerOf2(uint32_t Size)
+{
+    return ((Size != 0U) && ((Size & (Size - 1U)) == 0U)) ? 1U : 0U;
+}
+
+/*---------------------------------- SPSC ----------------------------------*/
+/**
+ * @brief   Initialize a single producer / single consumer ring
+ * @param   Buffer   - Size * ItemSize bytes
+ * @param   Size     - Number of items, power of 2
+ * @retval  1 on success, 0 on bad parameters
+ */
+uint32_t LFQ_SpscInit(LFQ_SpscTypeDef *Queue, void *Buffer, uint32_t ItemSize, uint32_t Size)
+{
+    if ((Queue == NULL) || (Buffer == NULL) || (ItemSize == 0U) || (LFQ_IsPowerOf2(Size) == 0U)) {
+        return 0U;
+    }
+    Queue->Buffer = (uint8_t *)Buffer;
+    Queue->ItemSize = ItemSize;
+    Queue->Mask = Size - 1U;
+    ATOMIC_Store(&Queue->Head, 0U);
+    ATOMIC_Store(&Queue->Tail, 0U);
+    return 1U;
+}
+
+/**
+ * @brief   Copy an item in (producer side)
+ * @retval  1 if queued, 0 if full
+ */
+uint32_t LFQ_SpscPush(LFQ_SpscTypeDef *Queue, const void *Item)
+{
+    uint32_t head = ATOMIC_Load(&Queue->Head);      /* own index */
+    uint32_t tail = ATOMIC_Load(&Queue->Tail);      /* acquire: the consumer is done with the slot */
+
+    if ((head - tail) > Queue->Mask) {
+        return 0U;
+    }
+    memcpy(&Queue->Buffer[(head & Queue->Mask) * Queue->ItemSize], Item, Queue->ItemSize);
+    ATOMIC_Store(&Queue->Head, head + 1U);         /* release: publish the item */
+    return 1U;
+}
+
+/**
+ * @brief   Copy the oldest item out (consumer side)
+ * @retval  1 if an item was read, 0 if empty
+ */
+uint32_t LFQ_SpscPop(LFQ_SpscTypeDef *Queue, void *Item)
+{
+    uint32_t tail = ATOMIC_Load(&Queue->Tail);
+    uint32_t head = ATOMIC_Load(&Queue->Head);
+
+    if (head == tail) {
+        return 0U;
+    }
+    memcpy(Item, &Queue->Buffer[(tail & Queue->Mask) * Queue->ItemSize], Queue->ItemSize);
+    ATOMIC_Store(&Queue->Tail, tail + 1U);         /* release: the slot may be reused */
+    return 1U;
+}
+
+uint32_t LFQ_SpscCount(LFQ_SpscTypeDef *Queue)
+{
+    uint32_t tail = ATOMIC_Load(&Queue->Tail);
+
+    return ATOMIC_Load(&Queue->Head) - tail;
+}
+
+/*---------------------------------- MPSC ----------------------------------*/
+/**
+ * @brief   Initialize a multi producer / single consumer queue
+ * @note    Slot i is free for the producer that claims position p when Seq[i] == p,
+ *          and holds an item for the consumer at position p when Seq[i] == p + 1.
+ * @param   Buffer   - Size * ItemSize bytes
+ * @param   Seq      - Size sequence numbers
+ * @param   Size     - Number of items, power of 2
+ * @retval  1 on success, 0 on bad parameters
+ */
+uint32_t LFQ_MpscInit(LFQ_MpscTypeDef *Queue, void *Buffer, ATOMIC_U32TypeDef *Seq, uint32_t ItemSize, uint32_t Size)
+{
+    uint32_t i;
+
+    if ((Queue == NULL) || (Buffer == NULL) || (Seq == NULL) || (ItemSize == 0U) || (LFQ_IsPowerOf2(Size) == 0U)) {
+        return 0U;
+    }
+    Queue->Buffer = (uint8_t *)Buffer;
+    Queue->Seq = Seq;
+    Queue->ItemSize = ItemSize;
+    Queue->Mask = Size - 1U;
+    for (i = 0U; i < Size; i++) {
+        ATOMIC_Store(&Seq[i], i);
+    }
+    ATOMIC_Store(&Queue->Head, 0U);
+    ATOMIC_Store(&Queue->Tail, 0U);
+    ATOMIC_Store(&Queue->Dropped, 0U);
+    return 1U;
+}
+
+/**
+ * @brief   Copy an item in, from any context
+ * @retval  1 if queued, 0 if full (counted in Dropped)
+ */
+uint32_t LFQ_MpscPush(LFQ_MpscTypeDef *Queue, const void *Item)
+{
+    uint32_t pos = ATOMIC_Load(&Queue->Head);
+    uint32_t slot;
+    int32_t diff;
+
+    for (;;) {
+        slot = pos & Queue->Mask;
+        diff = (int32_t)(ATOMIC_Load(&Queue->Seq[slot]) - pos);
+        if (diff == 0) {
+            /* Free: claim it, on failure pos is reloaded with the current Head */
+            if (ATOMIC_CompareExchange(&Queue->Head, &pos, pos + 1U) != 0U) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            /* Still holds the item from one lap ago */
+            (void)ATOMIC_FetchAdd(&Queue->Dropped, 1U);
+            return 0U;
+        }
+        else {
+            /* Another producer claimed it already */
+            pos = ATOMIC_Load(&Queue->Head);
+        }
+    }
+
+    memcpy(&Queue->Buffer[slot * Queue->ItemSize], Item, Queue->ItemSize);
+    ATOMIC_Store(&Queue->Seq[slot], pos + 1U);     /* release: publish to the consumer */
+    return 1U;
+}
+
+/**
+ * @brief   Copy the oldest item out (single consumer)
+ * @retval  1 if an item was read, 0 if empty or the oldest slot is still being written
+ */
+uint32_t LFQ_MpscPop(LFQ_MpscTypeDef *Queue, void *Item)
+{
+    uint32_t pos = ATOMIC_Load(&Queue->Tail);
+    uint32_t slot = pos & Queue->Mask;
+
+    if (ATOMIC_Load(&Queue->Seq[slot]) != (pos + 1U)) {
+        return 0U;
+    }
+    memcpy(Item, &Queue->Buffer[slot * Queue->ItemSize], Queue->ItemSize);
+    ATOMIC_Store(&Queue->Seq[slot], pos + Queue->Mask + 1U);   /* free for the next lap */
+    ATOMIC_Store(&Queue->Tail, pos + 1U);
+    return 1U;
+}
+
+/**
+ * @brief   Number of claimed slots, including those still being written
+ */
+uint32_t LFQ_MpscCount(LFQ_MpscTypeDef *Queue)
+{
+    uint32_t tail = ATOMIC_Load(&Queue->Tail);
+
+    return ATOMIC_Load(&Queue->Head) - tail;
+}
\ No newline at end of file
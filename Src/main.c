@@ -1,4 +1,7 @@
 #include "main.h"
+#ifdef BENCH
+#include "bench.h"
+#endif
 
 void Error_Handler();
 void SystemClock_Config(void);
@@ -13,6 +16,9 @@ int main(void)
     //HAL_Init();
     
     SystemClock_Config();
+#ifdef BENCH
+    BENCH_Run();
+#endif
 
     MX_GPIO_Init();
     MX_I2C1_Init();
@@ -33,9 +39,9 @@ void SystemClock_Config(void)
     // RCC_OscInitTypeDef RCC_OscInitStruct = {0};
     // RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
 
-    // /* Configure Power Clock (for standby, sleep,...)*/
-    // __HAL_RCC_PWR_CLK_ENABLE();
-    // __HAL_RCC_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+    /* Configure Power Clock (for standby, sleep,...)*/
+    __HAL_RCC_PWR_CLK_ENABLE();
+    __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
 
     // /* Configure Oscillator */
     // RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
@@ -0,0 +1,109 @@
+#include <malloc.h>
+#include "memstat.h"
+
+/**
+ * @brief: Memory statistics state
+ */
+typedef struct
+{
+    uint32_t *StackLow;         /*< Deepest main stack word seen written, NULL before the first scan >*/
+} MEM_TypeDef;
+
+static MEM_TypeDef mem;
+
+/* Linker script symbols */
+extern uint32_t _end;
+extern uint32_t _estack;
+extern uint32_t _Min_Stack_Size;
+
+/* sysmem.c */
+extern void *_sbrk(ptrdiff_t incr);
+extern void *_sbrk_peak(void);
+
+/**
+ * @brief   Fill a region with MEM_PAINT
+ * @param   Base - Word aligned
+ * @param   Size - Bytes, multiple of 4
+ */
+void MEM_Paint(uint32_t *Base, uint32_t Size)
+{
+    uint32_t *end = Base + (Size / 4U);
+
+    while (Base < end) {
+        *Base++ = MEM_PAINT;
+    }
+}
+
+/**
+ * @brief   Untouched bytes at the bottom of a painted stack
+ * @note    Scans up from Base to the first overwritten word.
+ * @retval  Bytes still painted, Size if the region was never written
+ */
+uint32_t MEM_Unused(const uint32_t *Base, uint32_t Size)
+{
+    const uint32_t *p = Base;
+    const uint32_t *end = Base + (Size / 4U);
+
+    while ((p < end) && (*p == MEM_PAINT)) {
+        p++;
+    }
+    return (uint32_t)((const uint8_t *)p - (const uint8_t *)Base);
+}
+
+/**
+ * @brief   Deepest main stack use so far
+ * @note    Scans down from the last mark (or the current MSP on the first call) and stops
+ *          after MEM_PAINT_RUN painted words in a row, or at the heap break.
+ * @retval  Bytes below _estack
+ */
+uint32_t MEM_GetStackPeak(void)
+{
+    uint32_t *floor = (uint32_t *)_sbrk_peak();
+    uint32_t *msp = (uint32_t *)__get_MSP();
+    uint32_t *p;
+    uint32_t run = 0U;
+
+    if ((mem.StackLow == NULL) || (msp < mem.StackLow)) {
+        mem.StackLow = msp;
+    }
+    p = mem.StackLow;
+    while ((p > floor) && (run < MEM_PAINT_RUN)) {
+        p--;
+        if (*p == MEM_PAINT) {
+            run++;
+        }
+        else {
+            run = 0U;
+            mem.StackLow = p;
+        }
+    }
+    return (uint32_t)((uint8_t *)&_estack - (uint8_t *)mem.StackLow);
+}
+
+/**
+ * @brief   Main stack and heap figures
+ * @note    Heap figures come from newlib's mallinfo(), which walks the free lists:
+ *          not for an ISR. Holes are free chunks below the top one. Only the top
+ *          chunk can be handed back to the stack, the holes only fit smaller blocks.
+ */
+void MEM_GetStats(MEM_StatsTypeDef *Stats)
+{
+    struct mallinfo info = mallinfo();
+    uint32_t holes, gap, used;
+
+    Stats->StackPeak = MEM_GetStackPeak();
+    Stats->StackReserved = (uint32_t)&_Min_Stack_Size;
+    Stats->HeapPeak = (uint32_t)((uint8_t *)_sbrk_peak() - (uint8_t *)&_end);
+    Stats->HeapArena = (uint32_t)((uint8_t *)_sbrk(0) - (uint8_t *)&_end);
+    Stats->HeapInUse = (uint32_t)info.uordblks;
+    Stats->HeapFree = (uint32_t)info.fordblks;
+    Stats->HeapTopFree = (uint32_t)info.keepcost;
+    /* ordblks counts the top chunk too when there is one */
+    Stats->HeapFreeChunks = (uint32_t)info.ordblks - (((info.keepcost != 0) && (info.ordblks != 0)) ? 1U : 0U);
+    holes = (Stats->HeapFree > Stats->HeapTopFree) ? (Stats->HeapFree - Stats->HeapTopFree) : 0U;
+    Stats->Fragmentation = (Stats->HeapFree != 0U) ? ((holes * 100U) / Stats->HeapFree) : 0U;
+
+    gap = (uint32_t)((uint8_t *)&_estack - (uint8_t *)&_end);
+    used = Stats->StackPeak + Stats->HeapPeak;
+    Stats->Headroom = (gap > used) ? (gap - used) : 0U;
+}
\ No newline at end of file
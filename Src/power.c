@@ -0,0 +1,451 @@
+#include "power.h"
+#include "atomic.h"
+#include <string.h>
+
+/**
+ * @brief: Private macros
+ */
+#define PM_EXTI_RTC_WKUP        (1UL << 22)     /*< EXTI line of the RTC wakeup timer >*/
+#define PM_WUCKSEL_DIV2         (0x3UL << RTC_CR_WUCKSEL_Pos)   /*< Wakeup timer on RTCCLK / 2 >*/
+#define PM_WUT_MAX_TICKS        0x10000U        /*< 16-bit wakeup counter >*/
+#define PM_RTC_SPAN_S           60U             /*< RTC time read as seconds + sub-seconds: 1 minute span >*/
+#define PM_LSE_TIMEOUT          50000000U       /*< BDCR polls, crystal start up to 2 s >*/
+#define PM_OSC_TIMEOUT          100000U         /*< CR / CFGR / ISR polls: HSE start, PLL lock, RTC sync >*/
+
+/* Flags of RTC_ISR are cleared by writing 0, 1 leaves them. INIT is kept at 0. */
+#define PM_RTC_CLEAR_FLAG(FLAG) WRITE_REG(RTC->ISR, ~(uint32_t)((FLAG) | RTC_ISR_INIT))
+
+/**
+ * @brief: Power manager state
+ */
+typedef struct
+{
+    PM_InitTypeDef      Init;
+    ATOMIC_U32TypeDef   Holds[PM_STATE_COUNT];
+    uint32_t            PredivS;        /*< RTC sub-second counter reload >*/
+    uint32_t            SsrHz;          /*< RTC sub-second counter rate >*/
+    uint32_t            WutHz;          /*< Wakeup timer rate, RTCCLK / 2 >*/
+    uint32_t            WutMaxTicks;    /*< Longest wakeup period, kept inside the RTC read span >*/
+    uint32_t            GuardUs;        /*< Wakeup timer arming delay and rounding >*/
+    uint32_t            HclkMHz;        /*< For the SLEEP cycle counts >*/
+    PM_StatsTypeDef     Stats;
+} PM_TypeDef;
+
+static PM_TypeDef pm;
+
+/**
+ * @brief: Private functions
+ */
+static PM_StateTypeDef PM_Select(uint32_t BudgetUs);
+static uint32_t PM_Sleep(void);
+static uint32_t PM_Stop(PM_StateTypeDef State, uint32_t BudgetUs);
+static HAL_StatusTypeDef PM_RestoreClocks(uint32_t Cr, uint32_t Cfgr, uint32_t Acr);
+static uint32_t PM_DmaActive(void);
+static HAL_StatusTypeDef PM_WakeupArm(uint32_t Ticks);
+static void PM_WakeupDisarm(void);
+static uint32_t PM_RtcNow(void);
+static uint32_t PM_RtcElapsedUs(uint32_t Start, uint32_t End);
+static void PM_UpdateHclk(void);
+static HAL_StatusTypeDef PM_Poll(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value, uint32_t Timeout);
+
+/*------------------------------------------- Init -------------------------------------------*/
+/**
+ * @brief   Start the RTC on LSE or LSI and set up the wakeup timer and its interrupt
+ * @note    Enables the PWR clock and the backup domain access. The backup domain is
+ *          reset if the RTC ran from another clock. With LSE this waits for the
+ *          crystal (up to 2 s on a cold start).
+ *          Call again after changing the system clock: SLEEP times are counted in
+ *          core cycles.
+ * @param   Init - Copied
+ * @retval  HAL_ERROR on a bad RtcFreq or an oscillator that does not start
+ */
+HAL_StatusTypeDef PM_Init(const PM_InitTypeDef *Init)
+{
+    uint32_t preDivA, sel;
+
+    if ((Init == NULL) || (Init->RtcFreq < 1000U) || (Init->RtcFreq > 1000000U) ||
+        ((Init->RtcClock != PM_RTC_LSE) && (Init->RtcClock != PM_RTC_LSI))) {
+        return HAL_ERROR;
+    }
+    memset(&pm, 0, sizeof(pm));
+    pm.Init = *Init;
+
+    /* Sub-second counter as fast as PREDIV_S (15 bits) allows, calendar at 1 Hz */
+    preDivA = (Init->RtcFreq - 1U) / 32768U;
+    pm.SsrHz = Init->RtcFreq / (preDivA + 1U);
+    pm.PredivS = pm.SsrHz - 1U;
+    pm.WutHz = Init->RtcFreq / 2U;
+    pm.WutMaxTicks = (pm.WutHz * (PM_RTC_SPAN_S / 2U) < PM_WUT_MAX_TICKS) ? (pm.WutHz * (PM_RTC_SPAN_S / 2U))
+                                                                        : PM_WUT_MAX_TICKS;
+    pm.GuardUs = (3000000U + pm.WutHz - 1U) / pm.WutHz;
+    PM_UpdateHclk();
+
+    __HAL_RCC_PWR_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess();
+
+    /* RTCSEL is write-once until a backup domain reset */
+    sel = (Init->RtcClock == PM_RTC_LSE) ? RCC_BDCR_RTCSEL_LSE : RCC_BDCR_RTCSEL_LSI;
+    if ((READ_BIT(RCC->BDCR, RCC_BDCR_RTCSEL) != sel) && (READ_BIT(RCC->BDCR, RCC_BDCR_RTCSEL) != 0U))
+    {
+        SET_BIT(RCC->BDCR, RCC_BDCR_BDRST);
+        CLEAR_BIT(RCC->BDCR, RCC_BDCR_BDRST);
+    }
+    if (Init->RtcClock == PM_RTC_LSE)
+    {
+        SET_BIT(RCC->BDCR, RCC_BDCR_LSEON);
+        if (PM_Poll(&RCC->BDCR, RCC_BDCR_LSERDY, RCC_BDCR_LSERDY, PM_LSE_TIMEOUT) != HAL_OK) {
+            return HAL_ERROR;
+        }
+    }
+    else
+    {
+        SET_BIT(RCC->CSR, RCC_CSR_LSION);
+        if (PM_Poll(&RCC->CSR, RCC_CSR_LSIRDY, RCC_CSR_LSIRDY, PM_OSC_TIMEOUT) != HAL_OK) {
+            return HAL_ERROR;
+        }
+    }
+    MODIFY_REG(RCC->BDCR, RCC_BDCR_RTCSEL, sel);
+    SET_BIT(RCC->BDCR, RCC_BDCR_RTCEN);
+
+    /* Prescalers in init mode, in two writes; shadow registers bypassed so the time can
+       be read right after STOP without waiting for RSF */
+    WRITE_REG(RTC->WPR, RTC_WPR_KEY1);
+    WRITE_REG(RTC->WPR, RTC_WPR_KEY2);
+    SET_BIT(RTC->ISR, RTC_ISR_INIT);
+    if (PM_Poll(&RTC->ISR, RTC_ISR_INITF, RTC_ISR_INITF, PM_OSC_TIMEOUT) != HAL_OK) {
+        WRITE_REG(RTC->WPR, 0xFFU);
+        return HAL_ERROR;
+    }
+    WRITE_REG(RTC->PRER, pm.PredivS);
+    WRITE_REG(RTC->PRER, pm.PredivS | (preDivA << RTC_PRER_PREDIV_A_Pos));
+    CLEAR_BIT(RTC->CR, RTC_CR_WUTE);
+    if (PM_Poll(&RTC->ISR, RTC_ISR_WUTWF, RTC_ISR_WUTWF, PM_OSC_TIMEOUT) != HAL_OK) {
+        WRITE_REG(RTC->WPR, 0xFFU);
+        return HAL_ERROR;
+    }
+    MODIFY_REG(RTC->CR, RTC_CR_WUCKSEL, PM_WUCKSEL_DIV2 | RTC_CR_BYPSHAD | RTC_CR_WUTIE);
+    CLEAR_BIT(RTC->ISR, RTC_ISR_INIT);
+    WRITE_REG(RTC->WPR, 0xFFU);
+    PM_RTC_CLEAR_FLAG(RTC_ISR_WUTF);
+
+    /* Wakeup timer -> EXTI 22 rising edge -> RTC_WKUP interrupt */
+    SET_BIT(EXTI->IMR, PM_EXTI_RTC_WKUP);
+    SET_BIT(EXTI->RTSR, PM_EXTI_RTC_WKUP);
+    CLEAR_BIT(EXTI->FTSR, PM_EXTI_RTC_WKUP);
+    WRITE_REG(EXTI->PR, PM_EXTI_RTC_WKUP);
+    if (HAL_NVIC_SetVector(RTC_WKUP_IRQn, PM_RTC_WKUP_IRQHandler, NULL) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    HAL_NVIC_SetPriority(RTC_WKUP_IRQn, Init->PreemptPriority, 0U);
+    HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
+
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+
+    return HAL_OK;
+}
+
+/*------------------------------------------- Idle -------------------------------------------*/
+/**
+ * @brief   Sleep in the deepest state that fits the budget
+ * @note    Call with interrupts masked (PRIMASK), after checking there is nothing to
+ *          run. Returns on the first interrupt, with the clocks restored and still
+ *          masked; the interrupt runs once the caller unmasks.
+ * @param   BudgetUs - Time until the next deadline, PM_FOREVER if none
+ * @retval  Time asleep in us, for the caller's timebase (SysTick stops in STOP)
+ */
+uint32_t PM_Idle(uint32_t BudgetUs)
+{
+    PM_StateTypeDef state;
+
+    if ((BudgetUs == 0U) || (pm.Holds[PM_STATE_SLEEP] != 0U)) {
+        return 0U;
+    }
+    state = PM_Select(BudgetUs);
+    if (state == PM_STATE_SLEEP) {
+        return PM_Sleep();
+    }
+    return PM_Stop(state, BudgetUs);
+}
+
+/**
+ * @brief   Keep the idle loop out of a state and every deeper one
+ * @note    Counted, callable from interrupts. PM_STATE_STOP while a peripheral that
+ *          needs its clock is busy, PM_STATE_STOP_LP for a short wake latency,
+ *          PM_STATE_SLEEP to not sleep at all.
+ */
+void PM_Hold(PM_StateTypeDef State)
+{
+    (void)ATOMIC_FetchAdd(&pm.Holds[State], 1U);
+}
+
+void PM_Release(PM_StateTypeDef State)
+{
+    (void)ATOMIC_FetchSub(&pm.Holds[State], 1U);
+}
+
+/**
+ * @brief   Wake latency the decision uses: configured or worst measured, plus guard
+ */
+uint32_t PM_GetWakeLatency(PM_StateTypeDef State)
+{
+    uint32_t wake = pm.Init.WakeUs[State];
+
+    if (State == PM_STATE_SLEEP) {
+        return wake;
+    }
+    if (pm.Stats.State[State].WakeMaxUs > wake) {
+        wake = pm.Stats.State[State].WakeMaxUs;
+    }
+    return wake + pm.GuardUs;
+}
+
+void PM_GetStats(PM_StatsTypeDef *Stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *Stats = pm.Stats;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief   Clear the statistics, the measured wake latencies included
+ */
+void PM_ResetStats(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    memset(&pm.Stats, 0, sizeof(pm.Stats));
+    __set_PRIMASK(primask);
+}
+
+/*------------------------------------------- IRQ handler -------------------------------------------*/
+/**
+ * @brief   RTC wakeup: only clears the flags, the wake itself is the point
+ */
+void PM_RTC_WKUP_IRQHandler(void)
+{
+    PM_RTC_CLEAR_FLAG(RTC_ISR_WUTF);
+    WRITE_REG(EXTI->PR, PM_EXTI_RTC_WKUP);
+}
+
+/*------------------------------------------- Private functions -------------------------------------------*/
+/* Deepest STOP state whose residency and wake fit, not held; SLEEP otherwise */
+static PM_StateTypeDef PM_Select(uint32_t BudgetUs)
+{
+    uint32_t state, fit = 0U;
+
+    for (state = PM_STATE_STOP_LP; state > PM_STATE_SLEEP; state--)
+    {
+        if (((uint64_t)pm.Init.MinResidencyUs[state] + PM_GetWakeLatency((PM_StateTypeDef)state)) > BudgetUs) {
+            continue;
+        }
+        fit = 1U;
+        if ((pm.Holds[PM_STATE_STOP] != 0U) || ((state == PM_STATE_STOP_LP) && (pm.Holds[PM_STATE_STOP_LP] != 0U))) {
+            continue;
+        }
+        if (PM_DmaActive() != 0U) {
+            break;
+        }
+        return (PM_StateTypeDef)state;
+    }
+    if (fit != 0U) {
+        pm.Stats.Vetoes++;
+    }
+    return PM_STATE_SLEEP;
+}
+
+/* WFI, timed with the cycle counter */
+static uint32_t PM_Sleep(void)
+{
+    PM_StateStatsTypeDef *stats = &pm.Stats.State[PM_STATE_SLEEP];
+    uint32_t start, us;
+
+    start = DWT->CYCCNT;
+    HAL_PWR_EnterSLEEPMode();
+    us = (DWT->CYCCNT - start) / pm.HclkMHz;
+
+    stats->Entries++;
+    stats->ResidencyUs += us;
+    return us;
+}
+
+/* STOP with the wakeup timer armed one wake latency before the deadline */
+static uint32_t PM_Stop(PM_StateTypeDef State, uint32_t BudgetUs)
+{
+    PM_StateStatsTypeDef *stats = &pm.Stats.State[State];
+    uint32_t ticks, armedUs, cr, cfgr, acr, start, end, elapsed, wake, timerWake;
+    uint64_t sleepUs;
+
+    sleepUs = (uint64_t)BudgetUs - PM_GetWakeLatency(State);
+    ticks = (BudgetUs == PM_FOREVER) ? pm.WutMaxTicks : (uint32_t)((sleepUs * pm.WutHz) / 1000000U);
+    if (ticks > pm.WutMaxTicks) {
+        ticks = pm.WutMaxTicks;
+    }
+    if (ticks == 0U) {
+        ticks = 1U;
+    }
+    if (PM_WakeupArm(ticks) != HAL_OK) {
+        return PM_Sleep();
+    }
+    armedUs = (uint32_t)(((uint64_t)ticks * 1000000U) / pm.WutHz);
+
+    cr = READ_REG(RCC->CR);
+    cfgr = READ_REG(RCC->CFGR);
+    acr = READ_REG(FLASH->ACR) & ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+    start = PM_RtcNow();
+
+    HAL_PWR_EnterSTOPMode((State == PM_STATE_STOP_LP) ? (PWR_LOWPOWERREGULATOR_ON | PWR_FLASH_POWERDOWN)
+                                                      : PWR_MAINREGULATOR_ON);
+
+    if (PM_RestoreClocks(cr, cfgr, acr) != HAL_OK) {
+        pm.Stats.ClockErrors++;
+    }
+    end = PM_RtcNow();
+    timerWake = READ_BIT(RTC->ISR, RTC_ISR_WUTF);
+    PM_WakeupDisarm();
+    PM_UpdateHclk();
+
+    elapsed = PM_RtcElapsedUs(start, end);
+    stats->Entries++;
+    stats->ResidencyUs += elapsed;
+    if (timerWake != 0U)
+    {
+        wake = (elapsed > armedUs) ? (elapsed - armedUs) : 0U;
+        stats->TimerWakes++;
+        stats->WakeLastUs = wake;
+        if (wake > stats->WakeMaxUs) {
+            stats->WakeMaxUs = wake;
+        }
+    }
+    return elapsed;
+}
+
+/**
+ * @brief   Back to the clock tree saved before STOP
+ * @note    STOP leaves HSE and the PLL off and SW on HSI; the dividers, PLLCFGR and
+ *          the flash wait states are kept. The wait states are written back before the
+ *          switch in case they were lowered meanwhile.
+ */
+static HAL_StatusTypeDef PM_RestoreClocks(uint32_t Cr, uint32_t Cfgr, uint32_t Acr)
+{
+    if ((Cfgr & RCC_CFGR_SWS) == RCC_CFGR_SWS_HSI) {
+        return HAL_OK;
+    }
+    if ((Cr & RCC_CR_HSEON) != 0U)
+    {
+        SET_BIT(RCC->CR, RCC_CR_HSEON);
+        if (PM_Poll(&RCC->CR, RCC_CR_HSERDY, RCC_CR_HSERDY, PM_OSC_TIMEOUT) != HAL_OK) {
+            return HAL_ERROR;
+        }
+    }
+    if ((Cr & RCC_CR_PLLON) != 0U)
+    {
+        SET_BIT(RCC->CR, RCC_CR_PLLON);
+        if (PM_Poll(&RCC->CR, RCC_CR_PLLRDY, RCC_CR_PLLRDY, PM_OSC_TIMEOUT) != HAL_OK) {
+            return HAL_ERROR;
+        }
+    }
+    WRITE_REG(FLASH->ACR, Acr);
+    MODIFY_REG(RCC->CFGR, RCC_CFGR_SW, Cfgr & RCC_CFGR_SW);
+
+    return PM_Poll(&RCC->CFGR, RCC_CFGR_SWS, Cfgr & RCC_CFGR_SWS, PM_OSC_TIMEOUT);
+}
+
+/* A DMA stream or the Ethernet DMA running: their clocks must stay on */
+static uint32_t PM_DmaActive(void)
+{
+    static DMA_Stream_TypeDef * const streams[2] = { DMA1_Stream0, DMA2_Stream0 };
+    static const uint32_t enable[2] = { RCC_AHB1ENR_DMA1EN, RCC_AHB1ENR_DMA2EN };
+    uint32_t ahb1enr = READ_REG(RCC->AHB1ENR);
+    uint32_t i, s;
+
+    for (i = 0U; i < 2U; i++)
+    {
+        if ((ahb1enr & enable[i]) == 0U) {
+            continue;
+        }
+        for (s = 0U; s < 8U; s++)
+        {
+            if (READ_BIT(streams[i][s].CR, DMA_SxCR_EN) != 0U) {
+                return 1U;
+            }
+        }
+    }
+    if (((ahb1enr & RCC_AHB1ENR_ETHMACEN) != 0U) && (READ_BIT(ETH->DMAOMR, ETH_DMAOMR_ST | ETH_DMAOMR_SR) != 0U)) {
+        return 1U;
+    }
+    return 0U;
+}
+
+/* Wakeup timer reload can only be written with the timer off and WUTWF set (~2 RTCCLK) */
+static HAL_StatusTypeDef PM_WakeupArm(uint32_t Ticks)
+{
+    HAL_StatusTypeDef status;
+
+    WRITE_REG(RTC->WPR, RTC_WPR_KEY1);
+    WRITE_REG(RTC->WPR, RTC_WPR_KEY2);
+    CLEAR_BIT(RTC->CR, RTC_CR_WUTE);
+    status = PM_Poll(&RTC->ISR, RTC_ISR_WUTWF, RTC_ISR_WUTWF, PM_OSC_TIMEOUT);
+    if (status == HAL_OK)
+    {
+        WRITE_REG(RTC->WUTR, Ticks - 1U);
+        PM_RTC_CLEAR_FLAG(RTC_ISR_WUTF);
+        WRITE_REG(EXTI->PR, PM_EXTI_RTC_WKUP);
+        SET_BIT(RTC->CR, RTC_CR_WUTE);
+    }
+    WRITE_REG(RTC->WPR, 0xFFU);
+
+    return status;
+}
+
+/* A wakeup flag already set stays for the interrupt handler */
+static void PM_WakeupDisarm(void)
+{
+    WRITE_REG(RTC->WPR, RTC_WPR_KEY1);
+    WRITE_REG(RTC->WPR, RTC_WPR_KEY2);
+    CLEAR_BIT(RTC->CR, RTC_CR_WUTE);
+    WRITE_REG(RTC->WPR, 0xFFU);
+}
+
+/**
+ * @brief   RTC time within the minute, in sub-second counter ticks
+ * @note    SSR counts down and TR is bumped when it reloads: read until SSR is the
+ *          same on both sides of TR.
+ */
+static uint32_t PM_RtcNow(void)
+{
+    uint32_t ss, tr;
+
+    do {
+        ss = READ_REG(RTC->SSR);
+        tr = READ_REG(RTC->TR);
+    } while (ss != READ_REG(RTC->SSR));
+
+    return (((_FLD2VAL(RTC_TR_ST, tr) * 10U) + _FLD2VAL(RTC_TR_SU, tr)) * pm.SsrHz) + (pm.PredivS - ss);
+}
+
+static uint32_t PM_RtcElapsedUs(uint32_t Start, uint32_t End)
+{
+    uint32_t span = PM_RTC_SPAN_S * pm.SsrHz;
+    uint32_t ticks = ((End + span) - Start) % span;
+
+    return (uint32_t)(((uint64_t)ticks * 1000000U) / pm.SsrHz);
+}
+
+static void PM_UpdateHclk(void)
+{
+    pm.HclkMHz = HAL_RCC_GetHCLKFreq() / 1000000U;
+    if (pm.HclkMHz == 0U) {
+        pm.HclkMHz = 1U;
+    }
+}
+
+static HAL_StatusTypeDef PM_Poll(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value, uint32_t Timeout)
+{
+    while ((READ_BIT(*Reg, Mask) != Value) && (--Timeout != 0U)) {
+    }
+    return (Timeout != 0U) ? HAL_OK : HAL_TIMEOUT;
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "profiler.h"
+
+/**
+ * @brief: Profiler state
+ */
+typedef struct
+{
+    TIM_HandleTypeDef htim;
+    uint32_t Period;            /*< Timer ticks per sample, mean >*/
+    uint32_t JitterMask;        /*< Dither range, 2^n - 1 <= Period / 16 >*/
+    uint32_t Lfsr;
+} PROF_TypeDef;
+
+static PROF_TypeDef prof;
+static PROF_BufferTypeDef prof_buffer;
+
+/** @brief: Private macros */
+#define PROF_TIM                TIM7
+#define PROF_TICK_HZ            1000000U    /*< Timer counts in µs >*/
+#define PROF_CHECK()            (PROF_MAGIC ^ PROF_DEPTH ^ (uint32_t)(uintptr_t)prof_buffer.Sample)
+
+/** @brief: Private functions */
+void PROF_Sample(const uint32_t *Frame, uint32_t ExcReturn);
+
+/**
+ * @brief   Set up TIM7 to sample at RateHz, stopped
+ * @param   RateHz          - PROF_RATE_MIN ~ PROF_RATE_MAX. 1 ~ 10 kHz is typical:
+ *                            each sample costs about 40 cycles.
+ * @param   PreemptPriority - Preemption priority of TIM7, above what is profiled
+ * @retval  HAL_ERROR if the rate is out of range or the vector table is not in SRAM
+ */
+HAL_StatusTypeDef PROF_Init(uint32_t RateHz, uint32_t PreemptPriority)
+{
+    uint32_t clk = HAL_TIM_GetClockFreq(PROF_TIM);
+
+    if ((RateHz < PROF_RATE_MIN) || (RateHz > PROF_RATE_MAX) || (clk < PROF_TICK_HZ)) {
+        return HAL_ERROR;
+    }
+
+    prof.Period = PROF_TICK_HZ / RateHz;
+    prof.JitterMask = 0U;
+    while (((prof.JitterMask << 1U) | 1U) <= (prof.Period / 16U)) {
+        prof.JitterMask = (prof.JitterMask << 1U) | 1U;
+    }
+    prof.Lfsr = 0xACE1U;
+
+    prof.htim.Instance = PROF_TIM;
+    prof.htim.Init.Prescaler = (clk / PROF_TICK_HZ) - 1U;
+    prof.htim.Init.CounterMode = TIM_COUNTERMODE_UP;
+    prof.htim.Init.Period = prof.Period - 1U;
+    prof.htim.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    prof.htim.Init.RepetitionCounter = 0U;
+    prof.htim.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;   /* dithered period applies from the next one */
+    if (HAL_TIM_Base_Init(&prof.htim) != HAL_OK) {
+        return HAL_ERROR;
+    }
+
+    prof_buffer.Magic = PROF_MAGIC;
+    prof_buffer.Depth = PROF_DEPTH;
+    prof_buffer.Check = PROF_CHECK();
+    prof_buffer.RateHz = RateHz;
+    prof_buffer.Head = 0U;
+
+    if (HAL_NVIC_SetVector(TIM7_IRQn, PROF_TIM_IRQHandler, NULL) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    HAL_NVIC_SetPriority(TIM7_IRQn, PreemptPriority, 0U);
+    HAL_NVIC_EnableIRQ(TIM7_IRQn);
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef PROF_Start(void)
+{
+    return HAL_TIM_Base_Start_IT(&prof.htim);
+}
+
+HAL_StatusTypeDef PROF_Stop(void)
+{
+    return HAL_TIM_Base_Stop_IT(&prof.htim);
+}
+
+/**
+ * @brief   Drop the samples taken so far
+ */
+void PROF_Reset(void)
+{
+    prof_buffer.Head = 0U;
+}
+
+const PROF_BufferTypeDef *PROF_GetBuffer(void)
+{
+    return &prof_buffer;
+}
+
+/**
+ * @brief   Record one sample, tail-called by PROF_TIM_IRQHandler()
+ * @note    Frame[5] and Frame[6] are the stacked LR and PC, also in an extended (FP)
+ *          frame. Only this handler writes the ring, nothing to mask.
+ * @param   Frame     - Exception frame of the interrupted code
+ * @param   ExcReturn - EXC_RETURN, bit 3 clear when returning to handler mode
+ */
+void PROF_Sample(const uint32_t *Frame, uint32_t ExcReturn)
+{
+    PROF_SampleTypeDef *sample;
+    uint32_t head;
+
+    WRITE_REG(PROF_TIM->SR, (uint32_t)~TIM_SR_UIF);
+
+    /* 16-bit Galois LFSR: next period in Period +/- JitterMask / 2 */
+    prof.Lfsr = (prof.Lfsr >> 1U) ^ ((0U - (prof.Lfsr & 1U)) & 0xB400U);
+    WRITE_REG(PROF_TIM->ARR, prof.Period - 1U + (prof.Lfsr & prof.JitterMask) - (prof.JitterMask >> 1U));
+
+    head = prof_buffer.Head;
+    sample = &prof_buffer.Sample[head & (PROF_DEPTH - 1U)];
+    sample->Pc = (Frame[6] & ~PROF_PC_HANDLER) | (((ExcReturn & 0x8U) == 0U) ? PROF_PC_HANDLER : 0U);
+    sample->Lr = Frame[5];
+    prof_buffer.Head = head + 1U;
+}
+
+/**
+ * @brief   TIM7 update: find the exception frame and hand it to PROF_Sample()
+ * @note    EXC_RETURN bit 2 tells which stack the frame was pushed on. The branch keeps
+ *          LR = EXC_RETURN, so PROF_Sample() returns from the exception itself.
+ */
+__attribute__((naked)) void PROF_TIM_IRQHandler(void)
+{
+    __ASM volatile (
+    "   tst     lr, #4                  \n"
+    "   ite     eq                      \n"
+    "   mrseq   r0, msp                 \n"
+    "   mrsne   r0, psp                 \n"
+    "   mov     r1, lr                  \n"
+    "   b       PROF_Sample             \n"
+    );
+}
\ No newline at end of file
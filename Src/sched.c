@@ -0,0 +1,193 @@
+#include "sched.h"
+
+/**
+ * @brief: Scheduler state
+ */
+typedef struct
+{
+    ATOMIC_U32TypeDef   ReadyMask;      /*< Bit n set = task of priority n has queued events >*/
+    SCHED_TaskTypeDef   *Task[SCHED_PRIORITY_MAX];
+} SCHED_TypeDef;
+
+static SCHED_TypeDef sched;
+
+static void SCHED_PendSVHandler(void);
+
+/**
+ * @brief   Atomic set/clear of ready bits
+ * @note    LDREX/STREX instead of masking interrupts: any exception between the two
+ *          clears the exclusive monitor and the update is simply retried.
+ */
+static inline void SCHED_ReadySet(uint32_t Mask)
+{
+    (void)ATOMIC_FetchOr(&sched.ReadyMask, Mask);
+}
+
+static inline void SCHED_ReadyClear(uint32_t Mask)
+{
+    (void)ATOMIC_FetchAnd(&sched.ReadyMask, ~Mask);
+}
+
+/**
+ * @brief   Install the dispatcher on PendSV and start the cycle counter used for WCET
+ * @retval  HAL_ERROR if the vector table is not in SRAM
+ */
+HAL_StatusTypeDef SCHED_Init(void)
+{
+    uint32_t i;
+
+    sched.ReadyMask = 0U;
+    for (i = 0U; i < SCHED_PRIORITY_MAX; i++) {
+        sched.Task[i] = NULL;
+    }
+
+    if (HAL_NVIC_SetVector(PendSV_IRQn, SCHED_PendSVHandler, NULL) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    /* Dispatch only once every interrupt handler is done */
+    HAL_NVIC_SetPriority(PendSV_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL, 0U);
+
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Register a task at a priority level
+ * @param   Task      - Task control block (kept by the scheduler)
+ * @param   Priority  - 0 ~ SCHED_PRIORITY_MAX - 1, must be free
+ * @param   Handler   - Called once per event, must return
+ * @param   Queue     - Event storage, QueueSize events
+ * @param   Seq       - QueueSize slot sequence numbers
+ * @param   QueueSize - Power of 2
+ */
+HAL_StatusTypeDef SCHED_TaskCreate(SCHED_TaskTypeDef *Task, uint32_t Priority, SCHED_TaskFuncTypeDef Handler,
+                                   uint32_t *Queue, ATOMIC_U32TypeDef *Seq, uint32_t QueueSize)
+{
+    if ((Task == NULL) || (Handler == NULL) || (Priority >= SCHED_PRIORITY_MAX) || (sched.Task[Priority] != NULL) ||
+        (LFQ_MpscInit(&Task->Events, Queue, Seq, sizeof(uint32_t), QueueSize) == 0U)) {
+        return HAL_ERROR;
+    }
+
+    Task->Handler = Handler;
+    Task->Priority = Priority;
+    SCHED_ResetStats(Task);
+
+    sched.Task[Priority] = Task;
+    return HAL_OK;
+}
+
+/**
+ * @brief   Queue an event for a task and request a dispatch
+ * @note    Callable from thread mode, tasks and interrupts of any priority, nothing is
+ *          masked. The event is published before the ready bit is set: the dispatcher
+ *          may run it before the bit shows up, the bit is then stale and dropped by the
+ *          dispatcher, never the event.
+ * @retval  HAL_BUSY if the task queue is full (counted in Task->Events.Dropped)
+ */
+HAL_StatusTypeDef SCHED_Post(SCHED_TaskTypeDef *Task, uint32_t Event)
+{
+    uint32_t depth, max;
+
+    if (LFQ_MpscPush(&Task->Events, &Event) == 0U) {
+        return HAL_BUSY;
+    }
+
+    depth = LFQ_MpscCount(&Task->Events);
+    max = ATOMIC_Load(&Task->QueueMax);
+    while ((depth > max) && (ATOMIC_CompareExchange(&Task->QueueMax, &max, depth) == 0U)) {
+    }
+
+    SCHED_ReadySet(1UL << Task->Priority);
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Idle loop, to be called from main() after the tasks are created
+ * @note    All work runs in PendSV, thread mode only sleeps, through SCHED_IdleHook().
+ *          The ready mask is checked with interrupts masked: an event posted after the
+ *          check leaves PendSV pending, which ends the sleep at once.
+ */
+void SCHED_Run(void)
+{
+    /* Events posted before the scheduler was started */
+    if (sched.ReadyMask != 0U) {
+        SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    }
+    for (;;)
+    {
+        __disable_irq();
+        if (ATOMIC_Load(&sched.ReadyMask) == 0U) {
+            SCHED_IdleHook();
+        }
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief   Nothing is ready: sleep until an interrupt
+ * @note    Called from SCHED_Run() with interrupts masked; a pending interrupt still
+ *          wakes the core, its handler runs once the hook returns. The default is WFI.
+ *          With the power manager, override it to pass the time to the next deadline
+ *          to PM_Idle() (see power.h) and move the timebase forward by the time slept.
+ */
+__weak void SCHED_IdleHook(void)
+{
+    __WFI();
+}
+
+uint32_t SCHED_GetReadyMask(void)
+{
+    return sched.ReadyMask;
+}
+
+void SCHED_ResetStats(SCHED_TaskTypeDef *Task)
+{
+    Task->RunCount = 0U;
+    Task->LastCycles = 0U;
+    Task->WcetCycles = 0U;
+    ATOMIC_Store(&Task->QueueMax, LFQ_MpscCount(&Task->Events));
+    ATOMIC_Store(&Task->Events.Dropped, 0U);
+}
+
+/**
+ * @brief   Dispatcher
+ * @note    Re-selects the highest ready level after every event, so an event posted
+ *          to a higher priority task during a run is handled next.
+ *          A level with nothing to pop has its ready bit cleared: it was drained, or its
+ *          oldest slot is still being written by a poster this PendSV preempted, which
+ *          sets the bit again once done. A post that completed between the failed pop
+ *          and the clear is caught by the second pop, so an event is never stranded.
+ */
+static void SCHED_PendSVHandler(void)
+{
+    uint32_t ready, prio, event, start, cycles;
+    SCHED_TaskTypeDef *task;
+
+    while ((ready = ATOMIC_Load(&sched.ReadyMask)) != 0U)
+    {
+        prio = 31U - __CLZ(ready);
+        task = sched.Task[prio];
+
+        if (LFQ_MpscPop(&task->Events, &event) == 0U) {
+            SCHED_ReadyClear(1UL << prio);
+            if (LFQ_MpscPop(&task->Events, &event) == 0U) {
+                continue;
+            }
+            SCHED_ReadySet(1UL << prio);
+        }
+
+        start = DWT->CYCCNT;
+        task->Handler(event);
+        cycles = DWT->CYCCNT - start;
+
+        task->RunCount++;
+        task->LastCycles = cycles;
+        if (cycles > task->WcetCycles) {
+            task->WcetCycles = cycles;
+        }
+    }
+}
\ No newline at end of file
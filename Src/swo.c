@@ -0,0 +1,167 @@
+#include "swo.h"
+
+/**
+ * @brief: SWO state
+ */
+typedef struct
+{
+    uint32_t BaudRate;          /*< Requested >*/
+    uint32_t ActualBaudRate;    /*< HCLK / (ACPR + 1) >*/
+} SWO_TypeDef;
+
+static SWO_TypeDef swo;
+
+/** @brief: Private macros */
+#define SWO_BAUD_TOLERANCE      3U          /*< Percent, what a UART-style receiver takes >*/
+#define SWO_LOG_SPIN            100000U     /*< FIFO polls before a log write is dropped >*/
+#define SWO_BUSY_SPIN           100000U
+
+/**
+ * @brief   Route the ITM through the TPIU to the SWO pin
+ * @note    Overrides a debugger's own TPIU setup, so the probe must be set to the
+ *          same bit rate. Sync packets are sent every 2^24 cycles (DWT SYNCTAP), which
+ *          lets a decoder attached mid-stream find the packet boundaries.
+ * @param   Init - Bit rate, ports, timestamps
+ * @retval  HAL_ERROR if the bit rate can't be made from HCLK within 3%
+ */
+HAL_StatusTypeDef SWO_Init(const SWO_InitTypeDef *Init)
+{
+    uint32_t spin = SWO_BUSY_SPIN;
+
+    assert_param(Init->BaudRate != 0U);
+
+    swo.BaudRate = Init->BaudRate;
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    /* TRACE_MODE 0: asynchronous, only TRACESWO is driven */
+    MODIFY_REG(DBGMCU->CR, DBGMCU_CR_TRACE_IOEN | DBGMCU_CR_TRACE_MODE, DBGMCU_CR_TRACE_IOEN);
+
+    WRITE_REG(TPI->SPPR, TPI_SPPR_TXMODE_NRZ);
+    WRITE_REG(TPI->FFCR, TPI_FFCR_TRIGIN_Msk);
+    if (SWO_UpdateClock() != HAL_OK) {
+        return HAL_ERROR;
+    }
+
+    WRITE_REG(ITM->LAR, ITM_LAR_KEY);
+    WRITE_REG(ITM->TCR, 0U);
+    while (((ITM->TCR & ITM_TCR_BUSY_Msk) != 0U) && (--spin != 0U)) {
+    }
+
+    MODIFY_REG(DWT->CTRL, DWT_CTRL_SYNCTAP_Msk, _VAL2FLD(DWT_CTRL_SYNCTAP, 1U));
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+
+    WRITE_REG(ITM->TPR, 0U);
+    WRITE_REG(ITM->TER, Init->PortMask);
+    WRITE_REG(ITM->TCR, _VAL2FLD(ITM_TCR_TRACEBUSID, 1U) | ITM_TCR_SYNCENA_Msk | ITM_TCR_ITMENA_Msk |
+                        ((Init->Timestamps == ENABLE) ? ITM_TCR_TSENA_Msk : 0U));
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Recompute the SWO prescaler from the current HCLK
+ * @note    The prescaler is rounded to the nearest divider, the bit rate the probe
+ *          must use is SWO_GetBaudRate().
+ * @retval  HAL_ERROR if the bit rate is out of reach (left unchanged)
+ */
+HAL_StatusTypeDef SWO_UpdateClock(void)
+{
+    uint32_t hclk = HAL_RCC_GetHCLKFreq();
+    uint32_t div, actual, error;
+
+    if ((swo.BaudRate == 0U) || (swo.BaudRate > hclk)) {
+        return HAL_ERROR;
+    }
+    div = (hclk + (swo.BaudRate / 2U)) / swo.BaudRate;
+    if ((div - 1U) > _FLD2VAL(TPI_ACPR_PRESCALER, TPI_ACPR_PRESCALER_Msk)) {
+        return HAL_ERROR;
+    }
+    actual = hclk / div;
+    error = (actual > swo.BaudRate) ? (actual - swo.BaudRate) : (swo.BaudRate - actual);
+    if ((uint64_t)error * 100U > (uint64_t)swo.BaudRate * SWO_BAUD_TOLERANCE) {
+        return HAL_ERROR;
+    }
+
+    WRITE_REG(TPI->ACPR, div - 1U);
+    swo.ActualBaudRate = actual;
+
+    return HAL_OK;
+}
+
+uint32_t SWO_GetBaudRate(void)
+{
+    return swo.ActualBaudRate;
+}
+
+/**
+ * @brief   Wait for room in the FIFO and write, interrupts masked between the two
+ * @retval  0 if the port is disabled or the FIFO stayed full
+ */
+static uint32_t SWO_LogPut(uint32_t Value, uint32_t Size)
+{
+    uint32_t spin = SWO_LOG_SPIN;
+
+    if ((ITM->TER & (1UL << SWO_PORT_LOG)) == 0U) {
+        return 0U;
+    }
+    while (spin-- != 0U) {
+        if (((Size == 4U) ? SWO_Write32(SWO_PORT_LOG, Value) :
+             (Size == 2U) ? SWO_Write16(SWO_PORT_LOG, (uint16_t)Value) :
+                            SWO_Write8(SWO_PORT_LOG, (uint8_t)Value)) != 0U) {
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/**
+ * @brief   Write text to the log channel
+ * @note    Packed in 32-bit writes, little endian, so 4 characters take one 5-byte
+ *          packet instead of four 2-byte ones. The tail goes out as 16 and 8-bit writes.
+ */
+void SWO_LogWrite(const char *Data, uint32_t Len)
+{
+    uint32_t word;
+
+    while (Len >= 4U) {
+        word = (uint32_t)(uint8_t)Data[0] | ((uint32_t)(uint8_t)Data[1] << 8U) |
+               ((uint32_t)(uint8_t)Data[2] << 16U) | ((uint32_t)(uint8_t)Data[3] << 24U);
+        if (SWO_LogPut(word, 4U) == 0U) {
+            return;
+        }
+        Data += 4U;
+        Len -= 4U;
+    }
+    if (Len >= 2U) {
+        word = (uint32_t)(uint8_t)Data[0] | ((uint32_t)(uint8_t)Data[1] << 8U);
+        if (SWO_LogPut(word, 2U) == 0U) {
+            return;
+        }
+        Data += 2U;
+        Len -= 2U;
+    }
+    if (Len != 0U) {
+        (void)SWO_LogPut((uint8_t)Data[0], 1U);
+    }
+}
+
+void SWO_Log(const char *Str)
+{
+    const char *end = Str;
+
+    while (*end != '\0') {
+        end++;
+    }
+    SWO_LogWrite(Str, (uint32_t)(end - Str));
+}
+
+#ifdef SWO_STDIO
+/**
+ * @brief   newlib output hook, replaces the byte-at-a-time one in syscalls.c
+ */
+int _write(int file, char *ptr, int len)
+{
+    (void)file;
+    SWO_LogWrite(ptr, (uint32_t)len);
+    return len;
+}
+#endif
\ No newline at end of file
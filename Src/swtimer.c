@@ -0,0 +1,412 @@
+#include "swtimer.h"
+
+#define SWT_WHEEL_MASK          (SWT_WHEEL_SIZE - 1UL)
+#define SWT_RANGE               (1UL << (SWT_WHEEL_BITS * SWT_LEVELS))     /*< Ticks covered by the wheels >*/
+
+/**
+ * @brief: Timer service state
+ */
+typedef struct
+{
+    SWT_TimerTypeDef    *Slot[SWT_LEVELS][SWT_WHEEL_SIZE];
+    uint64_t            Bitmap[SWT_LEVELS];     /*< Bit n set = Slot[level][n] not empty >*/
+    SWT_TimerTypeDef    *PendingHead;           /*< Expired, waiting for SWT_Process() >*/
+    SWT_TimerTypeDef    *PendingTail;
+    uint32_t            Current;                /*< Next tick to process >*/
+    uint32_t            Active;                 /*< Armed + pending timers >*/
+    uint32_t            Priority;
+} SWT_TypeDef;
+
+static SWT_TypeDef swt;
+
+/*---------------------------------- Lists ----------------------------------*/
+static void SWT_SlotInsert(SWT_TimerTypeDef *Timer, uint32_t Level, uint32_t Slot)
+{
+    SWT_TimerTypeDef *head = swt.Slot[Level][Slot];
+
+    Timer->Prev = NULL;
+    Timer->Next = head;
+    if (head != NULL) {
+        head->Prev = Timer;
+    }
+    swt.Slot[Level][Slot] = Timer;
+    swt.Bitmap[Level] |= (uint64_t)1U << Slot;
+    Timer->Level = (uint8_t)Level;
+    Timer->Slot = (uint8_t)Slot;
+    Timer->State = SWT_STATE_ARMED;
+}
+
+static void SWT_SlotRemove(SWT_TimerTypeDef *Timer)
+{
+    if (Timer->Prev != NULL) {
+        Timer->Prev->Next = Timer->Next;
+    }
+    else {
+        swt.Slot[Timer->Level][Timer->Slot] = Timer->Next;
+        if (Timer->Next == NULL) {
+            swt.Bitmap[Timer->Level] &= ~((uint64_t)1U << Timer->Slot);
+        }
+    }
+    if (Timer->Next != NULL) {
+        Timer->Next->Prev = Timer->Prev;
+    }
+}
+
+static void SWT_PendingAppend(SWT_TimerTypeDef *Timer)
+{
+    Timer->Next = NULL;
+    Timer->Prev = swt.PendingTail;
+    if (swt.PendingTail != NULL) {
+        swt.PendingTail->Next = Timer;
+    }
+    else {
+        swt.PendingHead = Timer;
+    }
+    swt.PendingTail = Timer;
+    Timer->State = SWT_STATE_PENDING;
+}
+
+static void SWT_PendingRemove(SWT_TimerTypeDef *Timer)
+{
+    if (Timer->Prev != NULL) {
+        Timer->Prev->Next = Timer->Next;
+    }
+    else {
+        swt.PendingHead = Timer->Next;
+    }
+    if (Timer->Next != NULL) {
+        Timer->Next->Prev = Timer->Prev;
+    }
+    else {
+        swt.PendingTail = Timer->Prev;
+    }
+}
+
+/*---------------------------------- Wheel ----------------------------------*/
+/**
+ * @brief   Put an armed timer on the wheel, relative to the tick being processed
+ * @note    Level n is picked by the distance to the expiry, the slot by the expiry bits
+ *          of that level. Timers already due go to the current level 0 slot.
+ */
+static void SWT_Insert(SWT_TimerTypeDef *Timer)
+{
+    uint32_t expires = Timer->Expires;
+    uint32_t delta = expires - swt.Current;
+    uint32_t level;
+
+    if ((int32_t)delta < 0) {
+        expires = swt.Current;
+        delta = 0U;
+    }
+    else if (delta >= SWT_RANGE) {
+        /* Parked at the far end of the top wheel, re-placed when cascaded */
+        expires = swt.Current + (SWT_RANGE - 1UL);
+        delta = SWT_RANGE - 1UL;
+    }
+
+    for (level = 0U; level < (SWT_LEVELS - 1U); level++) {
+        if (delta < (1UL << (SWT_WHEEL_BITS * (level + 1U)))) {
+            break;
+        }
+    }
+    SWT_SlotInsert(Timer, level, (expires >> (SWT_WHEEL_BITS * level)) & SWT_WHEEL_MASK);
+}
+
+/* Distance from From to the first set bit of Map going up (cyclic), SWT_WHEEL_SIZE if none */
+static uint32_t SWT_FirstSet(uint64_t Map, uint32_t From)
+{
+    uint64_t rot;
+    uint32_t word;
+
+    if (Map == 0U) {
+        return SWT_WHEEL_SIZE;
+    }
+    rot = (Map >> From) | (Map << ((SWT_WHEEL_SIZE - From) & SWT_WHEEL_MASK));
+    word = (uint32_t)rot;
+    if (word != 0U) {
+        return 31U - __CLZ(word & (0U - word));
+    }
+    word = (uint32_t)(rot >> 32);
+    return 63U - __CLZ(word & (0U - word));
+}
+
+/**
+ * @brief   Ticks from Current to the next tick that has work (an expiry or a cascade)
+ * @retval  SWT_NO_DEADLINE if the wheel is empty
+ */
+static uint32_t SWT_NextEvent(void)
+{
+    uint32_t level, shift, unit, base, dist, best = SWT_NO_DEADLINE;
+
+    for (level = 0U; level < SWT_LEVELS; level++) {
+        if (swt.Bitmap[level] == 0U) {
+            continue;
+        }
+        shift = SWT_WHEEL_BITS * level;
+        unit = 1UL << shift;
+        /* Slots of upper levels are processed on the tick boundaries of that level */
+        base = (swt.Current + unit - 1U) & ~(unit - 1U);
+        dist = SWT_FirstSet(swt.Bitmap[level], (base >> shift) & SWT_WHEEL_MASK);
+        dist = (base - swt.Current) + (dist << shift);
+        if (dist < best) {
+            best = dist;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief   Process tick Current: cascade the upper wheels on their boundaries, then
+ *          move the level 0 slot to the pending list
+ * @retval  Number of timers expired
+ */
+static uint32_t SWT_RunTick(void)
+{
+    SWT_TimerTypeDef *t, *next;
+    uint32_t level, slot, count = 0U;
+
+    for (level = 1U; level < SWT_LEVELS; level++) {
+        if ((swt.Current & ((1UL << (SWT_WHEEL_BITS * level)) - 1UL)) != 0U) {
+            break;
+        }
+        slot = (swt.Current >> (SWT_WHEEL_BITS * level)) & SWT_WHEEL_MASK;
+        t = swt.Slot[level][slot];
+        swt.Slot[level][slot] = NULL;
+        swt.Bitmap[level] &= ~((uint64_t)1U << slot);
+        for (; t != NULL; t = next) {
+            next = t->Next;
+            SWT_Insert(t);
+        }
+    }
+
+    slot = swt.Current & SWT_WHEEL_MASK;
+    t = swt.Slot[0][slot];
+    swt.Slot[0][slot] = NULL;
+    swt.Bitmap[0] &= ~((uint64_t)1U << slot);
+    for (; t != NULL; t = next) {
+        next = t->Next;
+        SWT_PendingAppend(t);
+        count++;
+    }
+
+    swt.Current++;
+    return count;
+}
+
+/*---------------------------------- Public APIs ----------------------------------*/
+/**
+ * @brief   Initialize the timer service
+ * @param   Now             - Current tick of the timebase
+ * @param   PreemptPriority - Highest interrupt priority (lowest number) that calls SWT APIs,
+ *                            the critical sections mask up to it
+ */
+HAL_StatusTypeDef SWT_Init(uint32_t Now, uint32_t PreemptPriority)
+{
+    uint32_t level, slot;
+
+    if ((PreemptPriority == 0U) || (PreemptPriority >= (1UL << __NVIC_PRIO_BITS))) {
+        return HAL_ERROR;
+    }
+    for (level = 0U; level < SWT_LEVELS; level++) {
+        for (slot = 0U; slot < SWT_WHEEL_SIZE; slot++) {
+            swt.Slot[level][slot] = NULL;
+        }
+        swt.Bitmap[level] = 0U;
+    }
+    swt.PendingHead = NULL;
+    swt.PendingTail = NULL;
+    swt.Current = Now + 1U;
+    swt.Active = 0U;
+    swt.Priority = PreemptPriority;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef SWT_Create(SWT_TimerTypeDef *Timer, SWT_CallbackTypeDef Callback, void *Arg)
+{
+    if ((Timer == NULL) || (Callback == NULL)) {
+        return HAL_ERROR;
+    }
+    Timer->Next = NULL;
+    Timer->Prev = NULL;
+    Timer->Expires = 0U;
+    Timer->Period = 0U;
+    Timer->Callback = Callback;
+    Timer->Arg = Arg;
+    Timer->State = SWT_STATE_IDLE;
+    return HAL_OK;
+}
+
+/**
+ * @brief   (Re)start a timer
+ * @note    A running or pending timer is restarted with the new values.
+ * @param   Timeout - Ticks from now to the first expiry, 1 ~ SWT_MAX_TIMEOUT
+ * @param   Period  - Reload in ticks for a periodic timer, 0 for a one-shot.
+ *                    Periodic expiries are spaced from the previous due tick, not from
+ *                    when the callback ran, so they do not drift.
+ */
+HAL_StatusTypeDef SWT_Start(SWT_TimerTypeDef *Timer, uint32_t Timeout, uint32_t Period)
+{
+    uint32_t key;
+
+    if ((Timer == NULL) || (Timeout == 0U) || (Timeout > SWT_MAX_TIMEOUT) || (Period > SWT_MAX_TIMEOUT)) {
+        return HAL_ERROR;
+    }
+
+    key = HAL_NVIC_EnterCritical(swt.Priority);
+    if (Timer->State == SWT_STATE_ARMED) {
+        SWT_SlotRemove(Timer);
+    }
+    else if (Timer->State == SWT_STATE_PENDING) {
+        SWT_PendingRemove(Timer);
+    }
+    else {
+        swt.Active++;
+    }
+    Timer->Expires = (swt.Current - 1U) + Timeout;
+    Timer->Period = Period;
+    SWT_Insert(Timer);
+    HAL_NVIC_ExitCritical(key);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief   Stop a timer, a pending callback is cancelled too
+ * @retval  HAL_OK, HAL_ERROR if the timer was not running
+ */
+HAL_StatusTypeDef SWT_Stop(SWT_TimerTypeDef *Timer)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+    uint32_t key = HAL_NVIC_EnterCritical(swt.Priority);
+
+    if (Timer->State == SWT_STATE_ARMED) {
+        SWT_SlotRemove(Timer);
+    }
+    else if (Timer->State == SWT_STATE_PENDING) {
+        SWT_PendingRemove(Timer);
+    }
+    else {
+        status = HAL_ERROR;
+    }
+    if (status == HAL_OK) {
+        Timer->State = SWT_STATE_IDLE;
+        swt.Active--;
+    }
+    HAL_NVIC_ExitCritical(key);
+
+    return status;
+}
+
+uint32_t SWT_IsActive(const SWT_TimerTypeDef *Timer)
+{
+    return (Timer->State != SWT_STATE_IDLE) ? 1U : 0U;
+}
+
+uint32_t SWT_GetActiveCount(void)
+{
+    return swt.Active;
+}
+
+/**
+ * @brief   Bring the wheel up to tick Now, from the timebase interrupt
+ * @note    Ticks without work are skipped, so after a tickless sleep the cost depends
+ *          on the number of timers due, not on how long the sleep was.
+ *          Calls SWT_ExpiredHook() when timers were moved to the pending list.
+ * @retval  Number of timers expired
+ */
+uint32_t SWT_Advance(uint32_t Now)
+{
+    uint32_t key, next, count = 0U;
+
+    while ((int32_t)(Now - swt.Current) >= 0) {
+        key = HAL_NVIC_EnterCritical(swt.Priority);
+        next = SWT_NextEvent();
+        if (next > (Now - swt.Current)) {
+            swt.Current = Now + 1U;
+            HAL_NVIC_ExitCritical(key);
+            break;
+        }
+        swt.Current += next;
+        count += SWT_RunTick();
+        HAL_NVIC_ExitCritical(key);
+    }
+
+    if (count != 0U) {
+        SWT_ExpiredHook();
+    }
+    return count;
+}
+
+/**
+ * @brief   Run the callbacks of expired timers, from the deferred context
+ * @note    Periodic timers are re-armed before their callback runs; the callback may
+ *          stop or restart its own timer.
+ * @retval  Number of callbacks run
+ */
+uint32_t SWT_Process(void)
+{
+    SWT_TimerTypeDef *t;
+    SWT_CallbackTypeDef callback;
+    void *arg;
+    uint32_t key, count = 0U;
+
+    for (;;) {
+        key = HAL_NVIC_EnterCritical(swt.Priority);
+        t = swt.PendingHead;
+        if (t == NULL) {
+            HAL_NVIC_ExitCritical(key);
+            break;
+        }
+        SWT_PendingRemove(t);
+        if (t->Period != 0U) {
+            t->Expires += t->Period;
+            SWT_Insert(t);
+        }
+        else {
+            t->State = SWT_STATE_IDLE;
+            swt.Active--;
+        }
+        callback = t->Callback;
+        arg = t->Arg;
+        HAL_NVIC_ExitCritical(key);
+
+        callback(t, arg);
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief   Ticks a tickless timebase may sleep from the last SWT_Advance() tick
+ * @note    Cascade points of the upper wheels count as deadlines, so the result can be
+ *          earlier than the first expiry; the wheel then reports the next one.
+ * @retval  0 if callbacks are pending, SWT_NO_DEADLINE if no timer is running
+ */
+uint32_t SWT_GetNextDeadline(void)
+{
+    uint32_t next;
+    uint32_t key = HAL_NVIC_EnterCritical(swt.Priority);
+
+    if (swt.PendingHead != NULL) {
+        next = 0U;
+    }
+    else {
+        next = SWT_NextEvent();
+        if (next != SWT_NO_DEADLINE) {
+            next += 1U;
+        }
+    }
+    HAL_NVIC_ExitCritical(key);
+
+    return next;
+}
+
+/**
+ * @brief   Timers expired, SWT_Process() should be scheduled
+ * @note    Called from SWT_Advance() (timebase interrupt). The default does nothing,
+ *          for when SWT_Process() is polled from the main loop.
+ */
+__weak void SWT_ExpiredHook(void)
+{
+}
\ No newline at end of file
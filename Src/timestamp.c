@@ -0,0 +1,251 @@
+#include "timestamp.h"
+
+/**
+ * @brief: Capture buffer of one channel (written by the IRQ, read by the application)
+ */
+typedef struct
+{
+    uint64_t Buffer[TS_CAPTURE_DEPTH];
+    __IO uint32_t Head;
+    __IO uint32_t Tail;
+    __IO uint32_t Overruns;     /*< Edges lost: buffer full or hardware over-capture >*/
+} TS_CaptureRingTypeDef;
+
+/**
+ * @brief: Timestamp service state
+ */
+typedef struct
+{
+    TIM_HandleTypeDef htim;
+    __IO uint32_t Overflows;    /*< Upper 32 bits of the timestamp >*/
+    uint32_t ClockFreq;         /*< Cached timer clock, Hz >*/
+    uint32_t NsPerTick;         /*< Integer part of 1e9 / ClockFreq >*/
+    uint32_t NsPerTickFrac;     /*< Fractional part, Q0.32 >*/
+    TS_CaptureRingTypeDef Capture[4];
+} TS_TypeDef;
+
+static TS_TypeDef ts;
+
+/**
+ * @brief   Start the free-running 64-bit timestamp counter
+ * @note    The timer clock must be enabled by the caller (__HAL_RCC_TIM2_CLK_ENABLE()).
+ *          PreemptPriority should be high: the update interrupt has ~25 s (at 84 MHz)
+ *          of slack, but captures are extended to 64 bits in the same handler.
+ * @param   TIMx - TIM2 or TIM5
+ * @param   PreemptPriority - Preemption priority of the timer interrupt
+ * @retval  HAL status
+ */
+HAL_StatusTypeDef TS_Init(TIM_TypeDef *TIMx, uint32_t PreemptPriority)
+{
+    IRQn_Type irqn = (TIMx == TIM2) ? TIM2_IRQn : TIM5_IRQn;
+
+    if (!IS_TIM_32B_COUNTER_INSTANCE(TIMx)) {
+        return HAL_ERROR;
+    }
+
+    ts.htim.Instance = TIMx;
+    ts.htim.Init.Prescaler = 0U;
+    ts.htim.Init.CounterMode = TIM_COUNTERMODE_UP;
+    ts.htim.Init.Period = 0xFFFFFFFFU;
+    ts.htim.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    ts.htim.Init.RepetitionCounter = 0U;
+    ts.htim.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    if (HAL_TIM_Base_Init(&ts.htim) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    ts.Overflows = 0U;
+    TS_Resync();
+
+    if (HAL_NVIC_SetVector(irqn, TS_IRQHandler, NULL) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    HAL_NVIC_SetPriority(irqn, PreemptPriority, 0U);
+    HAL_NVIC_EnableIRQ(irqn);
+
+    return HAL_TIM_Base_Start_IT(&ts.htim);
+}
+
+/**
+ * @brief   Re-read the timer clock after a system clock change
+ * @note    Counter keeps counting across the change, but ticks taken before it
+ *          are converted with the new frequency afterwards.
+ *          ns per tick is kept as 32.32 fixed point (rounded), the conversion
+ *          error stays below 1 ns per ~10 s of ticks at 168 MHz.
+ */
+void TS_Resync(void)
+{
+    uint64_t ns_q32;
+
+    ts.ClockFreq = HAL_TIM_GetClockFreq(ts.htim.Instance);
+    ns_q32 = ((1000000000ULL << 32U) + (ts.ClockFreq / 2U)) / ts.ClockFreq;
+    ts.NsPerTick = (uint32_t)(ns_q32 >> 32U);
+    ts.NsPerTickFrac = (uint32_t)ns_q32;
+}
+
+uint32_t TS_GetClockFreq(void)
+{
+    return ts.ClockFreq;
+}
+
+/**
+ * @brief   Current 64-bit tick count
+ * @note    Callable from any context, including with interrupts masked:
+ *          - retry if the overflow interrupt ran between reading the two halves,
+ *          - if the counter wrapped but the interrupt has not run yet (UIF still set)
+ *            and CNT is in its lower half, the wrap happened before CNT was read.
+ *          This holds as long as the update interrupt is never held off for half
+ *          a counter period.
+ */
+uint64_t TS_GetTicks(void)
+{
+    TIM_TypeDef *TIMx = ts.htim.Instance;
+    uint32_t hi, lo, upper;
+
+    do {
+        hi = ts.Overflows;
+        lo = TIMx->CNT;
+        upper = hi;
+        if (((TIMx->SR & TIM_SR_UIF) != 0U) && (lo < 0x80000000U)) {
+            upper++;
+        }
+    } while (hi != ts.Overflows);
+
+    return ((uint64_t)upper << 32U) | lo;
+}
+
+uint64_t TS_TicksToNs(uint64_t Ticks)
+{
+    uint32_t lo = (uint32_t)Ticks;
+    uint32_t hi = (uint32_t)(Ticks >> 32U);
+
+    return (Ticks * ts.NsPerTick) + ((uint64_t)hi * ts.NsPerTickFrac) +
+           (((uint64_t)lo * ts.NsPerTickFrac) >> 32U);
+}
+
+uint64_t TS_GetNs(void)
+{
+    return TS_TicksToNs(TS_GetTicks());
+}
+
+/**
+ * @brief   Latch the counter on edges of a channel input
+ * @param   Channel  - TIM_CHANNEL_1 ~ TIM_CHANNEL_4
+ * @param   Polarity - TIM_ICPOLARITY_RISING / FALLING / BOTHEDGE
+ * @param   Filter   - Input filter 0x0 ~ 0xF (0 = none, shortest capture latency)
+ */
+HAL_StatusTypeDef TS_CaptureStart(uint32_t Channel, uint32_t Polarity, uint32_t Filter)
+{
+    TIM_IC_InitTypeDef ic;
+    TS_CaptureRingTypeDef *ring = &ts.Capture[Channel >> 2U];
+
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    ring->Head = 0U;
+    ring->Tail = 0U;
+    ring->Overruns = 0U;
+
+    ic.ICPolarity = Polarity;
+    ic.ICSelection = TIM_ICSELECTION_DIRECTTI;
+    ic.ICPrescaler = TIM_ICPSC_DIV1;
+    ic.ICFilter = Filter;
+    if (HAL_TIM_IC_ConfigChannel(&ts.htim, &ic, Channel) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    return HAL_TIM_IC_Start_IT(&ts.htim, Channel);
+}
+
+HAL_StatusTypeDef TS_CaptureStop(uint32_t Channel)
+{
+    assert_param(IS_TIM_CHANNELS(Channel));
+
+    /* Counter keeps running: IC_Stop only stops it when no channel is enabled,
+       so disable the channel by hand */
+    __HAL_TIM_DISABLE_IT(&ts.htim, TIM_DIER_CC1IE << (Channel >> 2U));
+    CLEAR_BIT(ts.htim.Instance->CCER, TIM_CCER_CC1E << Channel);
+    return HAL_OK;
+}
+
+/**
+ * @brief   Pop the oldest captured timestamp of a channel
+ * @retval  1 if a timestamp was returned, 0 if none is pending
+ */
+uint32_t TS_CaptureRead(uint32_t Channel, uint64_t *pTimestamp)
+{
+    TS_CaptureRingTypeDef *ring = &ts.Capture[Channel >> 2U];
+    uint32_t tail = ring->Tail;
+
+    if (tail == ring->Head) {
+        return 0U;
+    }
+    *pTimestamp = ring->Buffer[tail & (TS_CAPTURE_DEPTH - 1U)];
+    __DMB();    /* slot read before it is handed back to the IRQ */
+    ring->Tail = tail + 1U;
+    return 1U;
+}
+
+uint32_t TS_CaptureGetOverruns(uint32_t Channel)
+{
+    return ts.Capture[Channel >> 2U].Overruns;
+}
+
+/**
+ * @brief   Called from the timer interrupt for every captured edge
+ * @param   Channel - TIM_CHANNEL_x
+ * @param   Timestamp - 64-bit tick count of the edge
+ */
+__weak void TS_CaptureCallback(uint32_t Channel, uint64_t Timestamp)
+{
+    UNUSED(Channel);
+    UNUSED(Timestamp);
+}
+
+/**
+ * @brief   Timestamp timer interrupt
+ * @note    Overflow count and UIF change together with interrupts masked, so a reader
+ *          preempting this handler never sees the new count with UIF still set.
+ *          A 32-bit capture is extended with the current 64-bit time: the edge is
+ *          (now - capture) mod 2^32 ticks in the past.
+ */
+void TS_IRQHandler(void)
+{
+    TIM_TypeDef *TIMx = ts.htim.Instance;
+    uint32_t pending = TIMx->SR & TIMx->DIER;
+    uint32_t primask, ch;
+
+    if ((pending & TIM_SR_UIF) != 0U)
+    {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        WRITE_REG(TIMx->SR, (uint32_t)~TIM_SR_UIF);
+        ts.Overflows++;
+        __set_PRIMASK(primask);
+    }
+
+    for (ch = 0U; ch < 4U; ch++)
+    {
+        if ((pending & (TIM_SR_CC1IF << ch)) != 0U)
+        {
+            TS_CaptureRingTypeDef *ring = &ts.Capture[ch];
+            uint32_t capture = (&TIMx->CCR1)[ch];     /* reading CCRx clears CCxIF */
+            uint64_t now = TS_GetTicks();
+            uint64_t stamp = now - (uint32_t)((uint32_t)now - capture);
+            uint32_t head = ring->Head;
+
+            /* An edge arrived before CCRx was read: one timestamp is gone */
+            if ((TIMx->SR & (TIM_SR_CC1OF << ch)) != 0U) {
+                WRITE_REG(TIMx->SR, (uint32_t)~(TIM_SR_CC1OF << ch));
+                ring->Overruns++;
+            }
+
+            if ((head - ring->Tail) < TS_CAPTURE_DEPTH) {
+                ring->Buffer[head & (TS_CAPTURE_DEPTH - 1U)] = stamp;
+                __DMB();    /* slot written before it is published */
+                ring->Head = head + 1U;
+            }
+            else {
+                ring->Overruns++;
+            }
+            TS_CaptureCallback(ch << 2U, stamp);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "trace.h"
+
+/**
+ * @brief: Recorder state, in .bss: recording is off until TRC_Init()
+ */
+typedef struct
+{
+    __IO uint32_t Running;
+} TRC_TypeDef;
+
+static TRC_TypeDef trc;
+
+static TRC_BufferTypeDef trc_buffer __attribute__((section(".noinit")));
+
+/** @brief: Private macros */
+#define TRC_CHECK()             (TRC_MAGIC ^ TRC_DEPTH ^ (uint32_t)(uintptr_t)trc_buffer.Event)
+#define TRC_COLD_RESET          (RCC_CSR_PORRSTF | RCC_CSR_BORRSTF)
+
+/**
+ * @brief   Start recording, keeping the events of the previous run if any
+ * @note    Enables the DWT cycle counter. Call it early, after the clock setup: the
+ *          header stores HCLK for the converter.
+ * @note    Clears the RCC_CSR reset flags (RMVF): they stay set until cleared, and the
+ *          next reset would look like a power-on one too.
+ */
+void TRC_Init(void)
+{
+    uint32_t csr = RCC->CSR;
+
+    SET_BIT(RCC->CSR, RCC_CSR_RMVF);
+    SET_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+
+    if ((trc_buffer.Magic != TRC_MAGIC) || (trc_buffer.Depth != TRC_DEPTH) ||
+        (trc_buffer.Check != TRC_CHECK()) || ((csr & TRC_COLD_RESET) != 0U)) {
+        TRC_Clear();
+    }
+    trc_buffer.CpuHz = HAL_RCC_GetHCLKFreq();
+    trc.Running = 1U;
+
+    TRC_Instant(TRC_ID_RESET, csr >> 24U);
+}
+
+/**
+ * @brief   Append one event, see TRC_INFO()
+ * @note    Stamped inside the critical section, so stamps follow ring order.
+ */
+void TRC_Record(uint32_t Info)
+{
+    TRC_EventTypeDef *event;
+    uint32_t primask;
+
+    if ((trc.Running == 0U) || (trc_buffer.Frozen != 0U)) {
+        return;
+    }
+    primask = __get_PRIMASK();
+    __disable_irq();
+    event = &trc_buffer.Event[trc_buffer.Head & (TRC_DEPTH - 1U)];
+    event->Cycles = DWT->CYCCNT;
+    event->Info = Info;
+    trc_buffer.Head++;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief   Stop recording until TRC_Clear(), resets included
+ */
+void TRC_Freeze(void)
+{
+    trc_buffer.Frozen = 1U;
+}
+
+/**
+ * @brief   Empty the ring and record again
+ */
+void TRC_Clear(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    trc_buffer.Magic = TRC_MAGIC;
+    trc_buffer.Depth = TRC_DEPTH;
+    trc_buffer.Check = TRC_CHECK();
+    trc_buffer.Head = 0U;
+    trc_buffer.Frozen = 0U;
+    __set_PRIMASK(primask);
+}
+
+const TRC_BufferTypeDef *TRC_GetBuffer(void)
+{
+    return &trc_buffer;
+}
\ No newline at end of file
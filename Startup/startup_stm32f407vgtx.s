@@ -91,6 +91,44 @@ LoopFillZerobss:
   cmp r2, r4
   bcc FillZerobss
 
+/* Paint the RAM between the heap start and the stack top with MEM_PAINT (memstat.h):
+   the main stack high-water mark is where the pattern stops. Nothing is on the stack yet. */
+  ldr r2, =_end
+  mov r4, sp
+  ldr r3, =0xA5A5A5A5
+  b LoopPaintStack
+
+PaintStack:
+  str  r3, [r2]
+  adds r2, r2, #4
+
+LoopPaintStack:
+  cmp r2, r4
+  bcc PaintStack
+
+/* Copy the vector table from flash into SRAM and point VTOR to the copy,
+   so handlers can be swapped at runtime and vector fetch avoids flash wait states */
+  ldr r0, =_svector_ram
+  ldr r1, =_evector_ram
+  ldr r2, =_sisr_vector
+  movs r3, #0
+  b LoopCopyVectorInit
+
+CopyVectorInit:
+  ldr r4, [r2, r3]
+  str r4, [r0, r3]
+  adds r3, r3, #4
+
+LoopCopyVectorInit:
+  adds r4, r0, r3
+  cmp r4, r1
+  bcc CopyVectorInit
+
+  ldr r1, =0xE000ED08   /* SCB->VTOR */
+  str r0, [r1]
+  dsb
+  isb
+
 /* Call static constructors */
   bl __libc_init_array
 /* Call the application's entry point.*/
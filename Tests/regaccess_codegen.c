@@ -0,0 +1,43 @@
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief   Code generation of the register macros against hand-written accesses
+ * @note    Compiled to assembly only, run_host.sh checks that each <case>_macro function
+ *          is instruction for instruction the same as its <case>_hand twin.
+ */
+#define REG32(ADDR)             (*(volatile uint32_t *)(ADDR))
+
+/* Write-only register store */
+void bsrr_macro(uint32_t Pins)
+{
+    WRITE_REG(GPIOD->BSRR, Pins);
+}
+
+void bsrr_hand(uint32_t Pins)
+{
+    REG32(GPIOD_BASE + 0x18U) = Pins;
+}
+
+/* Several fields of one register in a single read and write */
+void fields_macro(void)
+{
+    MODIFY_REG(SysTick->CTRL, SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk,
+               _VAL2FLD(SysTick_CTRL_CLKSOURCE, 1U) | _VAL2FLD(SysTick_CTRL_TICKINT, 1U) |
+               _VAL2FLD(SysTick_CTRL_ENABLE, 1U));
+}
+
+void fields_hand(void)
+{
+    REG32(SysTick_BASE) = REG32(SysTick_BASE) | 0x7U;
+}
+
+/* Clear of a write-only flag register */
+void lifcr_macro(void)
+{
+    CLEAR_REG(DMA2->LIFCR);
+}
+
+void lifcr_hand(void)
+{
+    REG32(DMA2_BASE + 0x08U) = 0U;
+}
\ No newline at end of file
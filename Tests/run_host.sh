@@ -0,0 +1,77 @@
+#!/bin/sh
+# Build and run the host tests. Modules with a host stand-in (simulated flash, block
+# device, ETH DMA model, C11 atomics) are tested against it, register access is
+# checked at compile time and on the generated code, the map report on a fixture map.
+#   usage: run_host.sh [test ...]   (default: all of them)
+#   CC     - host compiler (default cc)
+#   PYTHON - for the tools (default python3)
+set -e
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+OUT=${OUT:-$ROOT/Tests/out}
+# The target headers turn 32-bit register values into pointers, harmless on the host
+CFLAGS="-O2 -g -std=gnu11 -Wall -Wextra -Werror -Wno-int-to-pointer-cast -Wno-pointer-to-int-cast \
+    -iquote $ROOT/Inc -iquote $ROOT/Tests -I$ROOT/Drivers/CMSIS/Include -I$ROOT/Drivers/HAL_Driver/Inc"
+mkdir -p "$OUT"
+
+# Instructions of one function in a gcc -S listing, without labels and directives
+body() {
+    awk -v fn="$2" '$0 == fn ":" { on = 1; next }
+                    on && /^\t\.size/ { exit }
+                    on && !/^\t\./ && !/^\.L/ { print }' "$1"
+}
+
+test_regaccess() {
+    ${CC:-cc} $CFLAGS "$ROOT/Tests/test_regaccess.c" -o "$OUT/test_regaccess"
+    "$OUT/test_regaccess"
+    for case in 1 2 3 4 5 6; do
+        if ${CC:-cc} $CFLAGS -DREGACCESS_FAIL=$case -fsyntax-only "$ROOT/Tests/test_regaccess.c" 2>/dev/null; then
+            echo "regaccess: invalid access $case compiled" >&2
+            return 1
+        fi
+    done
+
+    ${CC:-cc} $CFLAGS -S "$ROOT/Tests/regaccess_codegen.c" -o "$OUT/regaccess_codegen.s"
+    for fn in bsrr fields lifcr; do
+        body "$OUT/regaccess_codegen.s" ${fn}_macro > "$OUT/${fn}_macro.s"
+        body "$OUT/regaccess_codegen.s" ${fn}_hand > "$OUT/${fn}_hand.s"
+        if [ ! -s "$OUT/${fn}_macro.s" ] || ! diff -u "$OUT/${fn}_hand.s" "$OUT/${fn}_macro.s"; then
+            echo "regaccess: ${fn}_macro differs from ${fn}_hand" >&2
+            return 1
+        fi
+    done
+}
+
+test_lfqueue() {
+    ${CC:-cc} $CFLAGS -DATOMIC_HOST -pthread "$ROOT/Tests/test_lfqueue.c" "$ROOT/Src/lfqueue.c" -o "$OUT/test_lfqueue"
+    "$OUT/test_lfqueue"
+}
+
+test_blkcache() {
+    ${CC:-cc} $CFLAGS -DBLK_HOST "$ROOT/Tests/test_blkcache.c" "$ROOT/Src/blkcache.c" "$ROOT/Src/blkdev.c" -o "$OUT/test_blkcache"
+    "$OUT/test_blkcache"
+}
+
+test_ethring() {
+    ${CC:-cc} $CFLAGS -DETH_HOST "$ROOT/Tests/test_ethring.c" "$ROOT/Src/ethmodel.c" \
+        "$ROOT/Drivers/HAL_Driver/Src/stm32f4xx_hal_eth.c" -o "$OUT/test_ethring"
+    "$OUT/test_ethring"
+}
+
+test_kvstore() {
+    ${CC:-cc} $CFLAGS -DFDEV_HOST "$ROOT/Tests/test_kvstore.c" "$ROOT/Src/kvstore.c" "$ROOT/Src/flashdev.c" -o "$OUT/test_kvstore"
+    "$OUT/test_kvstore"
+}
+
+# Host ld link of the STM32F407VGTX_FLASH.ld layout: .bss, .noinit and the heap/stack
+# reservation after .data >RAM AT> FLASH get a load address but take no FLASH
+test_mapreport() {
+    ${PYTHON:-python3} "$ROOT/Tools/mem/map_report.py" "$ROOT/Tests/test_mapreport.map" > "$OUT/mapreport.txt"
+    diff -u "$ROOT/Tests/test_mapreport.txt" "$OUT/mapreport.txt"
+}
+
+TESTS=${*:-"regaccess lfqueue blkcache ethring kvstore mapreport"}
+for t in $TESTS; do
+    echo "== $t"
+    test_$t
+done
+echo "all passed"
@@ -0,0 +1,32 @@
+#ifndef _TEST_H_
+#define _TEST_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief   Host test helpers, see run_host.sh
+ * @note    A test is a plain program: it exits non-zero at the first failed check.
+ */
+#define TEST_ASSERT(COND)       do { \
+                                    if (!(COND)) { \
+                                        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND); \
+                                        exit(1); \
+                                    } \
+                                } while (0)
+
+/**
+ * @brief   Small deterministic PRNG (xorshift32), so that a failing seed can be replayed
+ */
+static inline uint32_t TEST_Rand(uint32_t *State)
+{
+    uint32_t x = *State;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *State = x;
+    return x;
+}
+
+#endif // _TEST_H_
\ No newline at end of file
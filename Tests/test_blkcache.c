@@ -0,0 +1,125 @@
+#include <string.h>
+#include "blkcache.h"
+#include "test.h"
+
+/**
+ * @brief   Block cache against the RAM disk (BLK_HOST), checked against a plain array
+ * @note    Random reads, writes, flushes, pre-erases, invalidations and background
+ *          service calls. The model holds what a read must return: reads are checked
+ *          on every call, and after each flush the whole disk must equal the model.
+ *          Run with several geometries, so that runs get cut by MaxBlocks and by the
+ *          end of the slot array, and the device is slow or instant.
+ */
+#define TEST_BLOCKS             256U
+#define TEST_MAX_SLOTS          64U
+#define TEST_MAX_COUNT          12U         /*< Blocks per read / write call >*/
+#define TEST_OPS                20000U      /*< Per configuration >*/
+
+typedef struct
+{
+    uint32_t SlotCount;
+    uint32_t MaxBlocks;
+    uint32_t Latency;
+    uint32_t ReadAhead;
+    uint32_t Seed;
+} TEST_ConfigTypeDef;
+
+static const TEST_ConfigTypeDef configs[] =
+{
+    { 16U,  8U,   3U,  4U, 1U },
+    { 2U,   1U,   0U,  0U, 2U },
+    { 4U,   128U, 1U,  3U, 3U },
+    { 64U,  16U,  10U, 8U, 4U },
+    { 32U,  4U,   0U,  31U, 5U },
+};
+
+static uint8_t disk[TEST_BLOCKS * BLK_BLOCK_SIZE];
+static uint8_t model[TEST_BLOCKS * BLK_BLOCK_SIZE];
+static uint32_t data[(TEST_MAX_SLOTS * BLK_BLOCK_SIZE) / 4U];
+static uint8_t buffer[TEST_MAX_COUNT * BLK_BLOCK_SIZE];
+
+static void TEST_Run(const TEST_ConfigTypeDef *Config)
+{
+    static BLKC_SlotTypeDef slots[TEST_MAX_SLOTS];
+    BLK_RamDeviceTypeDef ram;
+    BLKC_CacheTypeDef cache;
+    uint32_t seed = Config->Seed;
+    uint32_t op, lba, count, i;
+
+    memset(disk, 0xFF, sizeof(disk));
+    memset(model, 0xFF, sizeof(model));
+    TEST_ASSERT(BLK_RamInit(&ram, disk, TEST_BLOCKS, Config->MaxBlocks, Config->Latency) == HAL_OK);
+    TEST_ASSERT(BLKC_Init(&cache, &ram.Dev, data, slots, Config->SlotCount, Config->ReadAhead) == HAL_OK);
+
+    for (op = 0U; op < TEST_OPS; op++)
+    {
+        count = (TEST_Rand(&seed) % TEST_MAX_COUNT) + 1U;
+        lba = TEST_Rand(&seed) % (TEST_BLOCKS - count + 1U);
+        /* Sequential runs now and then, for the read-ahead and the long write-backs */
+        if (((TEST_Rand(&seed) & 3U) == 0U) && (cache.NextRead < (TEST_BLOCKS - count))) {
+            lba = cache.NextRead;
+        }
+
+        switch (TEST_Rand(&seed) % 16U)
+        {
+            case 0U: case 1U: case 2U: case 3U: case 4U: case 5U:
+                TEST_ASSERT(BLKC_Read(&cache, lba, buffer, count) == HAL_OK);
+                TEST_ASSERT(memcmp(buffer, &model[lba * BLK_BLOCK_SIZE], count * BLK_BLOCK_SIZE) == 0);
+                break;
+
+            case 6U: case 7U: case 8U: case 9U: case 10U: case 11U:
+                for (i = 0U; i < (count * BLK_BLOCK_SIZE); i++) {
+                    buffer[i] = (uint8_t)TEST_Rand(&seed);
+                }
+                TEST_ASSERT(BLKC_Write(&cache, lba, buffer, count) == HAL_OK);
+                memcpy(&model[lba * BLK_BLOCK_SIZE], buffer, count * BLK_BLOCK_SIZE);
+                break;
+
+            case 12U:
+                TEST_ASSERT(BLKC_Flush(&cache) == HAL_OK);
+                TEST_ASSERT(cache.DirtyCount == 0U);
+                TEST_ASSERT(memcmp(disk, model, sizeof(disk)) == 0);
+                break;
+
+            case 13U:
+                /* The RAM disk erases to 0xFF, dirty copies of the range are dropped */
+                TEST_ASSERT(BLKC_PreErase(&cache, lba, count) == HAL_OK);
+                memset(&model[lba * BLK_BLOCK_SIZE], 0xFF, count * BLK_BLOCK_SIZE);
+                break;
+
+            case 14U:
+                if ((TEST_Rand(&seed) & 7U) == 0U) {
+                    /* Unflushed writes are lost: the disk is the truth again */
+                    BLKC_Invalidate(&cache);
+                    TEST_ASSERT(cache.DirtyCount == 0U);
+                    memcpy(model, disk, sizeof(model));
+                }
+                break;
+
+            default:
+                TEST_ASSERT(BLKC_Service(&cache) == HAL_OK);
+                break;
+        }
+        TEST_ASSERT(cache.DirtyCount <= cache.SlotCount);
+    }
+
+    TEST_ASSERT(BLKC_Flush(&cache) == HAL_OK);
+    TEST_ASSERT(memcmp(disk, model, sizeof(disk)) == 0);
+    TEST_ASSERT(cache.Stats.Errors == 0U);
+    TEST_ASSERT(cache.Stats.WrittenBlocks == ram.BlocksWritten);
+    printf("blkcache: %2u slots, max %3u, latency %2u: %u hits, %u misses, %u writes of %.1f blocks, %u stalls\n",
+           (unsigned)Config->SlotCount, (unsigned)Config->MaxBlocks, (unsigned)Config->Latency,
+           (unsigned)cache.Stats.Hits, (unsigned)cache.Stats.Misses, (unsigned)cache.Stats.WriteCommands,
+           (cache.Stats.WriteCommands != 0U) ? ((double)cache.Stats.WrittenBlocks / cache.Stats.WriteCommands) : 0.0,
+           (unsigned)cache.Stats.Stalls);
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(configs) / sizeof(configs[0])); i++) {
+        TEST_Run(&configs[i]);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,419 @@
+#include <string.h>
+#include "ethmodel.h"
+#include "test.h"
+
+/**
+ * @brief   ETH descriptor rings against the DMA model (ETH_HOST)
+ * @note    First the hand-off rules one at a time: a queued TX frame is owned by the DMA
+ *          as a whole and only reclaimed once sent, a full TX ring is refused and counted
+ *          then freed by the reclaim in HAL_ETH_Transmit(), an RX ring without buffers
+ *          misses frames and signals RBUS. Then a random mix of all of it, with RX
+ *          allocation failures, CRC errors and the receive watchdog: every frame must
+ *          come out once, in order and intact, every token once, in order, and the
+ *          model must never see the driver break the hand-off (Violations).
+ */
+#define TEST_RX_DESC            6U
+#define TEST_TX_DESC            5U
+#define TEST_RX_BUFFERS         (TEST_RX_DESC + 4U)
+#define TEST_TX_INFLIGHT        TEST_TX_DESC            /*< One fragment each at most >*/
+#define TEST_FRAGMENTS_MAX      3U
+#define TEST_FRAGMENT_MAX       200U
+#define TEST_RX_FRAME_MAX       1500U
+#define TEST_FRAME_MAX          (TEST_FRAGMENTS_MAX * TEST_FRAGMENT_MAX)
+#define TEST_STEPS              200000U
+
+/**
+ * @brief: TX frame in flight, its fragments live here until the token comes back
+ */
+typedef struct
+{
+    uint32_t Seq;
+    uint32_t Length;
+    ETH_BufferTypeDef Fragments[TEST_FRAGMENTS_MAX];
+    uint8_t Data[TEST_FRAME_MAX];
+} TEST_TxFrameTypeDef;
+
+static ETH_TypeDef regs;
+static ETH_HandleTypeDef heth;
+static ETHM_ModelTypeDef model;
+static ETH_DMADescTypeDef rxDesc[TEST_RX_DESC];
+static ETH_DMADescTypeDef txDesc[TEST_TX_DESC];
+
+static uint32_t rxBuffers[TEST_RX_BUFFERS][ETH_RX_BUF_SIZE / 4U];
+static void *rxPool[TEST_RX_BUFFERS];
+static uint32_t rxPoolCount;
+static uint32_t rxAllocFail;            /*< Allocator refuses while set >*/
+static uint32_t rxCallbacks;
+
+static TEST_TxFrameTypeDef txFrames[TEST_TX_INFLIGHT];
+static uint32_t txQueued;               /*< Frames accepted by HAL_ETH_Transmit() >*/
+static uint32_t txSent;                 /*< Frames out of ETHM_Transmit() >*/
+static uint32_t txFreed;                /*< Tokens returned >*/
+
+static uint32_t seed = 12345U;
+
+/*------------------------------------------- Callbacks -------------------------------------------*/
+void *HAL_ETH_RxAllocateCallback(ETH_HandleTypeDef *h)
+{
+    UNUSED(h);
+    if ((rxAllocFail != 0U) || (rxPoolCount == 0U)) {
+        return NULL;
+    }
+    return rxPool[--rxPoolCount];
+}
+
+/* Tokens are the frame numbers: they must come back in queue order, sent frames only */
+void HAL_ETH_TxFreeCallback(ETH_HandleTypeDef *h, void *Token)
+{
+    UNUSED(h);
+    TEST_ASSERT((uint32_t)(uintptr_t)Token == txFreed);
+    TEST_ASSERT(txFreed < txSent);
+    txFreed++;
+}
+
+void HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *h)
+{
+    UNUSED(h);
+    rxCallbacks++;
+}
+
+/*------------------------------------------- Helpers -------------------------------------------*/
+static void TEST_Setup(uint32_t RxCoalesceFrames, uint32_t TxCoalesceFrames)
+{
+    uint32_t i;
+
+    memset(&regs, 0, sizeof(regs));
+    memset(&heth, 0, sizeof(heth));
+    heth.Instance = &regs;
+    heth.Init.MediaInterface = ETH_MEDIA_INTERFACE_RMII;
+    heth.Init.ChecksumOffload = ENABLE;
+    heth.Init.RxCoalesceFrames = RxCoalesceFrames;
+    heth.Init.RxCoalesceUsecs = 100U;
+    heth.Init.TxCoalesceFrames = TxCoalesceFrames;
+    heth.Init.RxDesc = rxDesc;
+    heth.Init.RxDescCount = TEST_RX_DESC;
+    heth.Init.TxDesc = txDesc;
+    heth.Init.TxDescCount = TEST_TX_DESC;
+    heth.Init.RxBufferSize = ETH_RX_BUF_SIZE;
+
+    for (i = 0U; i < TEST_RX_BUFFERS; i++) {
+        rxPool[i] = rxBuffers[i];
+    }
+    rxPoolCount = TEST_RX_BUFFERS;
+    rxAllocFail = 0U;
+    rxCallbacks = 0U;
+    txQueued = 0U;
+    txSent = 0U;
+    txFreed = 0U;
+
+    TEST_ASSERT(HAL_ETH_Init(&heth) == HAL_OK);
+    TEST_ASSERT(HAL_ETH_Start(&heth) == HAL_OK);
+    ETHM_Init(&model, &heth);
+    TEST_ASSERT(rxPoolCount == (TEST_RX_BUFFERS - TEST_RX_DESC));
+}
+
+static void TEST_Irq(void)
+{
+    while (ETHM_IrqPending(&model) != 0U) {
+        HAL_ETH_IRQHandler(&heth);
+    }
+}
+
+static void TEST_Pattern(uint8_t *Data, uint32_t Length, uint32_t Seq)
+{
+    uint32_t i;
+
+    for (i = 0U; i < Length; i++) {
+        Data[i] = (uint8_t)((Seq * 31U) + (i * 7U) + (i >> 8));
+    }
+}
+
+/* Queue frame txQueued with Fragments fragments of random sizes */
+static HAL_StatusTypeDef TEST_Transmit(uint32_t Fragments)
+{
+    TEST_TxFrameTypeDef *frame = &txFrames[txQueued % TEST_TX_INFLIGHT];
+    ETH_TxFrameTypeDef tx;
+    uint32_t offset = 0U;
+    uint32_t length;
+    uint32_t i;
+    HAL_StatusTypeDef status;
+
+    for (i = 0U; i < Fragments; i++) {
+        length = (TEST_Rand(&seed) % TEST_FRAGMENT_MAX) + 1U;
+        frame->Fragments[i].Data = &frame->Data[offset];
+        frame->Fragments[i].Length = length;
+        offset += length;
+    }
+    TEST_Pattern(frame->Data, offset, txQueued);
+
+    tx.Fragments = frame->Fragments;
+    tx.FragmentCount = Fragments;
+    tx.Checksum = ETH_TX_CSUM_FULL;
+    tx.Token = (void *)(uintptr_t)txQueued;
+    status = HAL_ETH_Transmit(&heth, &tx);
+    if (status == HAL_OK) {
+        frame->Seq = txQueued;
+        frame->Length = offset;
+        txQueued++;
+    }
+    return status;
+}
+
+/* The DMA sends one frame: the next queued one, or nothing */
+static uint32_t TEST_Send(void)
+{
+    uint8_t wire[TEST_FRAME_MAX];
+    uint32_t checksum = 0U;
+    uint32_t length = ETHM_Transmit(&model, wire, sizeof(wire), &checksum);
+    const TEST_TxFrameTypeDef *frame;
+
+    if (length == 0U) {
+        TEST_ASSERT(txSent == txQueued);
+        return 0U;
+    }
+    TEST_ASSERT(txSent < txQueued);
+    frame = &txFrames[txSent % TEST_TX_INFLIGHT];
+    TEST_ASSERT(frame->Seq == txSent);
+    TEST_ASSERT(length == frame->Length);
+    TEST_ASSERT(memcmp(wire, frame->Data, length) == 0);
+    TEST_ASSERT(checksum == ETH_TX_CSUM_FULL);
+    txSent++;
+    return 1U;
+}
+
+/* Read one frame, which must be frame Seq of Length bytes; its buffer goes back to the pool */
+static void TEST_Read(uint32_t Seq, uint32_t Length)
+{
+    static uint8_t expect[TEST_RX_FRAME_MAX];
+    ETH_RxFrameTypeDef frame;
+
+    TEST_ASSERT(HAL_ETH_ReadFrame(&heth, &frame) == HAL_OK);
+    TEST_Pattern(expect, Length, Seq);
+    TEST_ASSERT(frame.Length == Length);
+    TEST_ASSERT(memcmp(frame.Buffer, expect, Length) == 0);
+    TEST_ASSERT(frame.Checksum == ETH_RX_CSUM_OK);
+    TEST_ASSERT(rxPoolCount < TEST_RX_BUFFERS);
+    rxPool[rxPoolCount++] = frame.Buffer;
+}
+
+/*------------------------------------------- Tests -------------------------------------------*/
+/* A queued frame belongs to the DMA until sent, then its token comes back once */
+static void TEST_TxHandOff(void)
+{
+    uint32_t i;
+
+    TEST_Setup(1U, 1U);
+    TEST_ASSERT(TEST_Transmit(3U) == HAL_OK);
+    for (i = 0U; i < 3U; i++) {
+        TEST_ASSERT((txDesc[i].Status & ETH_DMATXDESC_OWN) != 0U);
+        TEST_ASSERT(txDesc[i].Buf == txFrames[0].Fragments[i].Data);
+    }
+    TEST_ASSERT((txDesc[0].Status & ETH_DMATXDESC_FS) != 0U);
+    TEST_ASSERT((txDesc[2].Status & (ETH_DMATXDESC_LS | ETH_DMATXDESC_IC)) == (ETH_DMATXDESC_LS | ETH_DMATXDESC_IC));
+    TEST_ASSERT((txDesc[3].Status & ETH_DMATXDESC_OWN) == 0U);
+
+    /* Not sent yet: nothing to reclaim */
+    TEST_ASSERT(HAL_ETH_ReleaseTxBuffers(&heth) == 0U);
+    TEST_ASSERT(heth.TxUsed == 3U);
+
+    TEST_ASSERT(TEST_Send() == 1U);
+    TEST_ASSERT(TEST_Send() == 0U);
+    for (i = 0U; i < 3U; i++) {
+        TEST_ASSERT((txDesc[i].Status & ETH_DMATXDESC_OWN) == 0U);
+    }
+    TEST_Irq();
+    TEST_ASSERT(HAL_ETH_ReleaseTxBuffers(&heth) == 1U);
+    TEST_ASSERT(HAL_ETH_ReleaseTxBuffers(&heth) == 0U);
+    TEST_ASSERT((txFreed == 1U) && (heth.TxUsed == 0U) && (heth.Stats.TxFrames == 1U));
+    TEST_ASSERT(txDesc[2].Token == NULL);
+
+    /* The next frame wraps around the end of ring */
+    TEST_ASSERT(TEST_Transmit(3U) == HAL_OK);
+    TEST_ASSERT((txDesc[4].Status & ETH_DMATXDESC_TER) != 0U);
+    TEST_ASSERT(TEST_Send() == 1U);
+    TEST_ASSERT(HAL_ETH_ReleaseTxBuffers(&heth) == 1U);
+    TEST_ASSERT(model.Violations == 0U);
+}
+
+/* A full ring refuses and counts; once the DMA sent a frame, Transmit reclaims by itself */
+static void TEST_TxRingFull(void)
+{
+    uint32_t i;
+
+    TEST_Setup(1U, 2U);
+    for (i = 0U; i < TEST_TX_DESC; i++) {
+        TEST_ASSERT(TEST_Transmit(1U) == HAL_OK);
+    }
+    TEST_ASSERT(TEST_Transmit(1U) == HAL_BUSY);
+    TEST_ASSERT(TEST_Transmit(2U) == HAL_BUSY);
+    TEST_ASSERT((heth.Stats.TxRingFull == 2U) && (txFreed == 0U));
+
+    TEST_ASSERT(TEST_Send() == 1U);
+    TEST_ASSERT(TEST_Transmit(2U) == HAL_BUSY);
+    TEST_ASSERT((heth.Stats.TxRingFull == 3U) && (txFreed == 1U));
+    TEST_ASSERT(TEST_Transmit(1U) == HAL_OK);
+
+    /* Only every second frame asks for the completion interrupt */
+    TEST_ASSERT((txDesc[3].Status & ETH_DMATXDESC_IC) != 0U);
+    TEST_ASSERT((txDesc[4].Status & ETH_DMATXDESC_IC) == 0U);
+    TEST_ASSERT((txDesc[0].Status & ETH_DMATXDESC_IC) != 0U);
+
+    while (TEST_Send() != 0U) {
+    }
+    TEST_ASSERT(HAL_ETH_ReleaseTxBuffers(&heth) == TEST_TX_DESC);
+    TEST_ASSERT((txFreed == txQueued) && (heth.TxUsed == 0U));
+    TEST_ASSERT(model.Violations == 0U);
+}
+
+/* With every RX buffer taken the DMA misses frames and raises RBUS; reads bring it back */
+static void TEST_RxRingFull(void)
+{
+    static uint8_t frame[TEST_RX_FRAME_MAX];
+    uint32_t i;
+
+    TEST_Setup(1U, 1U);
+    for (i = 0U; i < TEST_RX_DESC; i++) {
+        TEST_Pattern(frame, 100U + i, i);
+        TEST_ASSERT(ETHM_Receive(&model, frame, 100U + i, ETHM_RX_IP) == HAL_OK);
+    }
+    TEST_Pattern(frame, 100U, 99U);
+    TEST_ASSERT(ETHM_Receive(&model, frame, 100U, ETHM_RX_IP) == HAL_BUSY);
+    TEST_ASSERT(model.MissedFrames == 1U);
+    TEST_Irq();
+    TEST_ASSERT((heth.Stats.RxNoBuffer == 1U) && (rxCallbacks != 0U));
+
+    /* Buffers run out too: the descriptors stay empty until the pool has some again */
+    rxAllocFail = 1U;
+    for (i = 0U; i < TEST_RX_DESC; i++) {
+        TEST_Read(i, 100U + i);
+    }
+    TEST_ASSERT((heth.RxEmpty == TEST_RX_DESC) && (heth.Stats.RxAllocFailed != 0U));
+    TEST_ASSERT(ETHM_Receive(&model, frame, 100U, ETHM_RX_IP) == HAL_BUSY);
+    rxAllocFail = 0U;
+    TEST_ASSERT(HAL_ETH_RxRefill(&heth) == TEST_RX_DESC);
+
+    /* A bad frame is dropped by the driver, its buffer goes straight back to the DMA */
+    TEST_Pattern(frame, 200U, 7U);
+    TEST_ASSERT(ETHM_Receive(&model, frame, 200U, ETHM_RX_CRC_ERROR) == HAL_OK);
+    TEST_Pattern(frame, 300U, 8U);
+    TEST_ASSERT(ETHM_Receive(&model, frame, 300U, ETHM_RX_IP) == HAL_OK);
+    TEST_Read(8U, 300U);
+    TEST_ASSERT((heth.Stats.RxErrors == 1U) && (heth.RxEmpty == 0U));
+    TEST_ASSERT(model.Violations == 0U);
+}
+
+/* Random interleaving of both sides, coalesced interrupts */
+static void TEST_Random(void)
+{
+    static uint8_t frame[TEST_RX_FRAME_MAX];
+    uint32_t rxLength[TEST_RX_DESC];        /*< Good frames stored, not read yet, in order >*/
+    uint32_t rxSeq[TEST_RX_DESC];
+    uint32_t rxStored = 0U;
+    uint32_t rxNext = 0U;
+    uint32_t rxFrames = 0U;
+    uint32_t missed = 0U;
+    uint32_t ringFull = 0U;
+    uint32_t step, length, flags, frags, i;
+    HAL_StatusTypeDef status;
+    ETH_RxFrameTypeDef rx;
+
+    TEST_Setup(3U, 2U);
+    for (step = 0U; step < TEST_STEPS; step++)
+    {
+        switch (TEST_Rand(&seed) % 10U)
+        {
+            case 0U:
+            case 1U:
+                frags = (TEST_Rand(&seed) % TEST_FRAGMENTS_MAX) + 1U;
+                status = TEST_Transmit(frags);
+                if (status == HAL_BUSY) {
+                    TEST_ASSERT((TEST_TX_DESC - heth.TxUsed) < frags);
+                    ringFull++;
+                }
+                else {
+                    TEST_ASSERT(status == HAL_OK);
+                }
+                break;
+
+            case 2U:
+            case 3U:
+                (void)TEST_Send();
+                break;
+
+            case 4U:
+                (void)HAL_ETH_ReleaseTxBuffers(&heth);
+                break;
+
+            case 5U:
+            case 6U:
+                length = (TEST_Rand(&seed) % (TEST_RX_FRAME_MAX - 60U)) + 60U;
+                flags = ((TEST_Rand(&seed) % 8U) == 0U) ? ETHM_RX_CRC_ERROR : ETHM_RX_IP;
+                TEST_Pattern(frame, length, rxFrames);
+                status = ETHM_Receive(&model, frame, length, flags);
+                if (status == HAL_BUSY) {
+                    missed++;
+                }
+                else {
+                    TEST_ASSERT(status == HAL_OK);
+                    if (flags == ETHM_RX_IP) {
+                        TEST_ASSERT(rxStored < TEST_RX_DESC);
+                        rxSeq[(rxNext + rxStored) % TEST_RX_DESC] = rxFrames;
+                        rxLength[(rxNext + rxStored) % TEST_RX_DESC] = length;
+                        rxStored++;
+                    }
+                }
+                rxFrames++;
+                break;
+
+            case 7U:
+            case 8U:
+                if (rxStored != 0U) {
+                    TEST_Read(rxSeq[rxNext], rxLength[rxNext]);
+                    rxNext = (rxNext + 1U) % TEST_RX_DESC;
+                    rxStored--;
+                }
+                else {
+                    TEST_ASSERT(HAL_ETH_ReadFrame(&heth, &rx) == HAL_BUSY);
+                }
+                break;
+
+            default:
+                rxAllocFail = ((TEST_Rand(&seed) % 4U) == 0U) ? 1U : 0U;
+                ETHM_Tick(&model, TEST_Rand(&seed) % 64U);
+                TEST_Irq();
+                break;
+        }
+        TEST_ASSERT(model.Violations == 0U);
+        TEST_ASSERT((heth.TxUsed <= TEST_TX_DESC) && (heth.RxEmpty <= TEST_RX_DESC));
+        TEST_ASSERT((txFreed <= txSent) && (txSent <= txQueued));
+    }
+
+    /* Drain both rings */
+    rxAllocFail = 0U;
+    while (TEST_Send() != 0U) {
+    }
+    (void)HAL_ETH_ReleaseTxBuffers(&heth);
+    TEST_ASSERT((txFreed == txQueued) && (heth.TxUsed == 0U));
+    for (i = 0U; i < rxStored; i++) {
+        TEST_Read(rxSeq[(rxNext + i) % TEST_RX_DESC], rxLength[(rxNext + i) % TEST_RX_DESC]);
+    }
+    TEST_ASSERT(HAL_ETH_ReadFrame(&heth, &rx) == HAL_BUSY);
+    TEST_ASSERT(rxPoolCount + (TEST_RX_DESC - heth.RxEmpty) == TEST_RX_BUFFERS);
+
+    TEST_ASSERT(heth.Stats.TxRingFull == ringFull);
+    TEST_ASSERT(heth.Stats.TxFrames == txQueued);
+    TEST_ASSERT(model.MissedFrames == missed);
+    TEST_ASSERT(heth.Stats.RxFrames + heth.Stats.RxErrors + missed == rxFrames);
+    printf("ethring: %u TX frames (%u ring full), %u RX frames (%u missed, %u dropped), %u interrupts\n",
+           (unsigned)txQueued, (unsigned)ringFull, (unsigned)rxFrames, (unsigned)missed,
+           (unsigned)heth.Stats.RxErrors, (unsigned)heth.Stats.Interrupts);
+}
+
+int main(void)
+{
+    TEST_TxHandOff();
+    TEST_TxRingFull();
+    TEST_RxRingFull();
+    TEST_Random();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include <string.h>
+#include "kvstore.h"
+#include "test.h"
+
+/**
+ * @brief   KV store power-cut fuzz on the simulated flash (FDEV_HOST)
+ * @note    Random sets and deletes, with the power cut after a random number of program
+ *          units, anywhere: in a record, a reclaim, a sector activation or format, or
+ *          the recovery of the previous cut during KV_Mount(). After each cut the store
+ *          is mounted again from the same flash contents and must come up, with every
+ *          completed update in place; the one cut short may have happened or not.
+ *          The simulated flash refuses 0 -> 1 programming and misaligned units
+ *          (Violations), every program unit size is tried.
+ */
+#define TEST_SECTOR_SIZE        8192U
+#define TEST_SECTORS_MAX        4U
+#define TEST_KEYS               12U
+#define TEST_VALUE_SMALL        96U         /*< Most values, many records per sector >*/
+#define TEST_CUTS               150U        /*< Per configuration >*/
+#define TEST_OPS_MAX            400U        /*< Between two cuts, if the cut does not come first >*/
+
+typedef struct
+{
+    uint32_t ProgramUnit;
+    uint32_t SectorCount;
+    uint32_t Seed;
+} TEST_ConfigTypeDef;
+
+/**
+ * @brief: Expected value of a key
+ */
+typedef struct
+{
+    uint32_t Present;
+    uint32_t Length;
+    uint8_t  Data[KV_VALUE_MAX];
+} TEST_ValueTypeDef;
+
+static uint8_t flash[TEST_SECTOR_SIZE * TEST_SECTORS_MAX];
+static FDEV_SimDeviceTypeDef sim;
+static KV_StoreTypeDef kv;
+static uint32_t kvIndex[TEST_KEYS];
+static TEST_ValueTypeDef expect[TEST_KEYS];
+static uint32_t reclaims;               /*< Over all the mounts of a run >*/
+static uint32_t mountCuts;
+
+/* Power back on: same flash contents, a new store on them */
+static void TEST_Mount(const TEST_ConfigTypeDef *Config, uint32_t FailAfter)
+{
+    HAL_StatusTypeDef status;
+
+    reclaims += kv.Reclaims;
+    do {
+        TEST_ASSERT(FDEV_SimInit(&sim, flash, TEST_SECTOR_SIZE, Config->SectorCount, Config->ProgramUnit) == HAL_OK);
+        sim.FailAfter = FailAfter;
+        status = KV_Mount(&kv, &sim.Dev, kvIndex, TEST_KEYS);
+        TEST_ASSERT(sim.Violations == 0U);
+        /* Only a new cut may stop the mount, the recovery is then done again */
+        TEST_ASSERT((status == HAL_OK) || (sim.PowerLost != 0U));
+        mountCuts += (status != HAL_OK) ? 1U : 0U;
+        FailAfter = 0U;
+    } while (status != HAL_OK);
+}
+
+static uint32_t TEST_Matches(uint32_t Key, const TEST_ValueTypeDef *Value)
+{
+    static uint8_t data[KV_VALUE_MAX];
+    uint32_t length = 0U;
+
+    if (KV_Get(&kv, Key, data, sizeof(data), &length) != HAL_OK) {
+        return (Value->Present == 0U) ? 1U : 0U;
+    }
+    return ((Value->Present != 0U) && (length == Value->Length) && (memcmp(data, Value->Data, length) == 0)) ? 1U : 0U;
+}
+
+static void TEST_Check(void)
+{
+    uint32_t key;
+
+    for (key = 0U; key < TEST_KEYS; key++) {
+        TEST_ASSERT(TEST_Matches(key, &expect[key]) != 0U);
+    }
+}
+
+static void TEST_Run(const TEST_ConfigTypeDef *Config)
+{
+    static TEST_ValueTypeDef next;
+    uint32_t seed = Config->Seed;
+    uint32_t cut, op, key, i;
+    uint32_t failAfter;
+    HAL_StatusTypeDef status;
+
+    memset(flash, 0xFF, sizeof(flash));
+    memset(expect, 0, sizeof(expect));
+    memset(&kv, 0, sizeof(kv));
+    reclaims = 0U;
+    mountCuts = 0U;
+    TEST_Mount(Config, 0U);
+
+    for (cut = 0U; cut < TEST_CUTS; cut++)
+    {
+        /* A few records' worth, so that cuts land in reclaims and activations too */
+        failAfter = (TEST_Rand(&seed) % ((4U * TEST_SECTOR_SIZE) / Config->ProgramUnit)) + 1U;
+        sim.FailAfter = failAfter;
+
+        for (op = 0U; (op < TEST_OPS_MAX) && (sim.PowerLost == 0U); op++)
+        {
+            key = TEST_Rand(&seed) % TEST_KEYS;
+            if ((TEST_Rand(&seed) % 8U) == 0U)
+            {
+                next.Present = 0U;
+                next.Length = 0U;
+                status = KV_Delete(&kv, key);
+            }
+            else
+            {
+                next.Present = 1U;
+                next.Length = ((TEST_Rand(&seed) % 16U) == 0U) ? (TEST_Rand(&seed) % (KV_VALUE_MAX + 1U)) :
+                                                                 (TEST_Rand(&seed) % (TEST_VALUE_SMALL + 1U));
+                for (i = 0U; i < next.Length; i++) {
+                    next.Data[i] = (uint8_t)TEST_Rand(&seed);
+                }
+                status = KV_Set(&kv, key, next.Data, next.Length);
+            }
+            TEST_ASSERT(sim.Violations == 0U);
+
+            if (status == HAL_OK) {
+                memcpy(&expect[key], &next, sizeof(next));
+                continue;
+            }
+            /* Cut in the middle of it: after the restart it is either done or not */
+            TEST_ASSERT(sim.PowerLost != 0U);
+            TEST_Mount(Config, (TEST_Rand(&seed) % 2U == 0U) ? ((TEST_Rand(&seed) % 8U) + 1U) : 0U);
+            if (TEST_Matches(key, &next) != 0U) {
+                memcpy(&expect[key], &next, sizeof(next));
+            }
+        }
+        if (sim.PowerLost == 0U) {
+            /* Clean restart */
+            TEST_Mount(Config, 0U);
+        }
+        TEST_Check();
+    }
+    printf("kvstore: unit %u, %u sectors, seed %2u: %u reclaims, %u mounts cut\n",
+           (unsigned)Config->ProgramUnit, (unsigned)Config->SectorCount, (unsigned)Config->Seed,
+           (unsigned)(reclaims + kv.Reclaims), (unsigned)mountCuts);
+}
+
+int main(void)
+{
+    static const uint32_t units[] = { 1U, 2U, 4U, 8U };
+    TEST_ConfigTypeDef config;
+    uint32_t u, s;
+
+    for (u = 0U; u < (sizeof(units) / sizeof(units[0])); u++)
+    {
+        for (s = 1U; s <= 16U; s++)
+        {
+            config.ProgramUnit = units[u];
+            config.SectorCount = 3U + (s & 1U);
+            config.Seed = s;
+            TEST_Run(&config);
+        }
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include "lfqueue.h"
+#include "test.h"
+
+/**
+ * @brief   LFQ stress test with real threads on the C11 atomics (ATOMIC_HOST)
+ * @note    Every producer pushes its id and a running sequence number. The consumer
+ *          checks that each producer's items arrive complete, in order, without gaps
+ *          or duplicates. Pushes rejected on a full queue are retried, so every item
+ *          must come out exactly once.
+ */
+#define TEST_PRODUCERS          4U
+#define TEST_ITEMS              1000000U    /*< Per producer >*/
+#define TEST_QUEUE_SIZE         64U         /*< Small, to keep the queue full and wrapping >*/
+
+typedef struct
+{
+    uint32_t Producer;
+    uint32_t Seq;
+    uint32_t Check;                         /*< Producer ^ Seq ^ TEST_MAGIC, catches torn copies >*/
+} TEST_ItemTypeDef;
+
+#define TEST_MAGIC              0x5A5AA5A5U
+
+static LFQ_MpscTypeDef mpsc;
+static TEST_ItemTypeDef mpscBuffer[TEST_QUEUE_SIZE];
+static ATOMIC_U32TypeDef mpscSeq[TEST_QUEUE_SIZE];
+
+static LFQ_SpscTypeDef spsc;
+static TEST_ItemTypeDef spscBuffer[TEST_QUEUE_SIZE];
+
+static ATOMIC_U32TypeDef go;
+
+static void *TEST_MpscProducer(void *Arg)
+{
+    TEST_ItemTypeDef item;
+
+    item.Producer = (uint32_t)(uintptr_t)Arg;
+    while (ATOMIC_Load(&go) == 0U) {
+        sched_yield();
+    }
+    for (item.Seq = 0U; item.Seq < TEST_ITEMS; item.Seq++) {
+        item.Check = item.Producer ^ item.Seq ^ TEST_MAGIC;
+        while (LFQ_MpscPush(&mpsc, &item) == 0U) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *TEST_SpscProducer(void *Arg)
+{
+    TEST_ItemTypeDef item = { 0U, 0U, 0U };
+
+    (void)Arg;
+    for (item.Seq = 0U; item.Seq < TEST_ITEMS; item.Seq++) {
+        item.Check = item.Seq ^ TEST_MAGIC;
+        while (LFQ_SpscPush(&spsc, &item) == 0U) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void TEST_Mpsc(void)
+{
+    pthread_t thread[TEST_PRODUCERS];
+    uint32_t next[TEST_PRODUCERS];
+    TEST_ItemTypeDef item;
+    uint32_t received = 0U;
+    uint32_t i;
+
+    TEST_ASSERT(LFQ_MpscInit(&mpsc, mpscBuffer, mpscSeq, sizeof(TEST_ItemTypeDef), TEST_QUEUE_SIZE) == 1U);
+    TEST_ASSERT(LFQ_MpscPop(&mpsc, &item) == 0U);
+
+    memset(next, 0, sizeof(next));
+    ATOMIC_Store(&go, 0U);
+    for (i = 0U; i < TEST_PRODUCERS; i++) {
+        TEST_ASSERT(pthread_create(&thread[i], NULL, TEST_MpscProducer, (void *)(uintptr_t)i) == 0);
+    }
+    ATOMIC_Store(&go, 1U);
+
+    while (received < (TEST_PRODUCERS * TEST_ITEMS)) {
+        if (LFQ_MpscPop(&mpsc, &item) == 0U) {
+            sched_yield();
+            continue;
+        }
+        TEST_ASSERT(item.Producer < TEST_PRODUCERS);
+        TEST_ASSERT(item.Check == (item.Producer ^ item.Seq ^ TEST_MAGIC));
+        TEST_ASSERT(item.Seq == next[item.Producer]);
+        next[item.Producer]++;
+        received++;
+    }
+    for (i = 0U; i < TEST_PRODUCERS; i++) {
+        TEST_ASSERT(pthread_join(thread[i], NULL) == 0);
+        TEST_ASSERT(next[i] == TEST_ITEMS);
+    }
+    TEST_ASSERT(LFQ_MpscPop(&mpsc, &item) == 0U);
+    TEST_ASSERT(LFQ_MpscCount(&mpsc) == 0U);
+    printf("mpsc: %u producers x %u items, %u pushes rejected on full\n",
+           TEST_PRODUCERS, TEST_ITEMS, (unsigned)ATOMIC_Load(&mpsc.Dropped));
+}
+
+static void TEST_Spsc(void)
+{
+    pthread_t thread;
+    TEST_ItemTypeDef item;
+    uint32_t next = 0U;
+
+    TEST_ASSERT(LFQ_SpscInit(&spsc, spscBuffer, sizeof(TEST_ItemTypeDef), TEST_QUEUE_SIZE) == 1U);
+    TEST_ASSERT(LFQ_SpscInit(&spsc, spscBuffer, sizeof(TEST_ItemTypeDef), TEST_QUEUE_SIZE - 1U) == 0U);
+    TEST_ASSERT(LFQ_SpscInit(&spsc, spscBuffer, sizeof(TEST_ItemTypeDef), TEST_QUEUE_SIZE) == 1U);
+
+    TEST_ASSERT(pthread_create(&thread, NULL, TEST_SpscProducer, NULL) == 0);
+    while (next < TEST_ITEMS) {
+        if (LFQ_SpscPop(&spsc, &item) == 0U) {
+            sched_yield();
+            continue;
+        }
+        TEST_ASSERT(item.Check == (item.Seq ^ TEST_MAGIC));
+        TEST_ASSERT(item.Seq == next);
+        TEST_ASSERT(LFQ_SpscCount(&spsc) <= TEST_QUEUE_SIZE);
+        next++;
+    }
+    TEST_ASSERT(pthread_join(thread, NULL) == 0);
+    TEST_ASSERT(LFQ_SpscPop(&spsc, &item) == 0U);
+    printf("spsc: %u items\n", TEST_ITEMS);
+}
+
+int main(void)
+{
+    TEST_Mpsc();
+    TEST_Spsc();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "stm32f4xx_hal.h"
+#include "test.h"
+
+/**
+ * @brief   Register access rules, on a register file in RAM
+ * @note    Built once as is (must compile and pass), then once per REGACCESS_FAIL case,
+ *          each of which must be rejected by the compiler.
+ */
+static GPIO_TypeDef gpio;
+static DMA_TypeDef dma;
+
+int main(void)
+{
+    uint32_t x = 0U;
+
+#if REGACCESS_FAIL == 1
+    x = gpio.BSRR;                          /* read of a write-only register */
+#elif REGACCESS_FAIL == 2
+    gpio.BSRR = 1U;                         /* store bypassing WRITE_REG() */
+#elif REGACCESS_FAIL == 3
+    MODIFY_REG(gpio.BSRR, 1U, 2U);          /* RMW needs a read */
+#elif REGACCESS_FAIL == 4
+    SET_BIT(dma.LIFCR, 1U);
+#elif REGACCESS_FAIL == 5
+    x = READ_REG(dma.HIFCR);
+#elif REGACCESS_FAIL == 6
+    WRITE_REG(gpio.IDR, 1U);                /* store to a read-only register */
+#endif
+
+    WRITE_REG(gpio.BSRR, 0x00010002U);
+    TEST_ASSERT(gpio.BSRR.Value == 0x00010002U);
+    CLEAR_REG(gpio.BSRR);
+    TEST_ASSERT(gpio.BSRR.Value == 0U);
+    WRITE_REG(dma.LIFCR, 0x3DU);
+    TEST_ASSERT(dma.LIFCR.Value == 0x3DU);
+
+    /* Plain registers keep working the same way */
+    WRITE_REG(gpio.MODER, 0xA8000000U);
+    MODIFY_REG(gpio.MODER, 0x3U << 2U, 0x1U << 2U);
+    TEST_ASSERT(READ_REG(gpio.MODER) == 0xA8000004U);
+    CLEAR_REG(gpio.ODR);
+    SET_BIT(gpio.ODR, 0x8U);
+    TEST_ASSERT(gpio.ODR == 0x8U);
+    TEST_ASSERT(_FLD2VAL(SysTick_CTRL_CLKSOURCE, _VAL2FLD(SysTick_CTRL_CLKSOURCE, 1U)) == 1U);
+
+    return (int)x;
+}
\ No newline at end of file
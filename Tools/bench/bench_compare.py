@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""Compare a benchmark run (Src/bench.c JSON) against a stored baseline.
+
+The run output may be mixed with other console text (QEMU, semihosting): the JSON
+document is taken from the first '{"suite"' to the last '}'.
+
+A case regresses when its metric grows by more than --threshold percent and by more
+than --floor ticks (sub-tick noise on very short cases is not a regression).
+Exit status: 0 no regression, 1 regression or missing case, 2 unusable input.
+"""
+import argparse
+import json
+import sys
+
+
+def load_run(path):
+    text = sys.stdin.read() if path == "-" else open(path, encoding="utf-8", errors="replace").read()
+    start = text.find('{"suite"')
+    end = text.rfind("}")
+    if start < 0 or end < start:
+        raise ValueError("no benchmark JSON in %s" % path)
+    return json.loads(text[start:end + 1])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("run", help="benchmark output, '-' for stdin")
+    parser.add_argument("baseline", help="baseline JSON")
+    parser.add_argument("--threshold", type=float, default=5.0, help="allowed growth, percent (default 5)")
+    parser.add_argument("--floor", type=float, default=1.0, help="ignore changes below this many ticks (default 1)")
+    parser.add_argument("--metric", choices=("min", "median", "max"), default="median")
+    parser.add_argument("--update", action="store_true", help="store the run as the new baseline")
+    args = parser.parse_args()
+
+    try:
+        run = load_run(args.run)
+    except (OSError, ValueError) as err:
+        print("bench: %s" % err, file=sys.stderr)
+        return 2
+
+    if args.update:
+        with open(args.baseline, "w", encoding="utf-8") as out:
+            json.dump(run, out, indent=1)
+            out.write("\n")
+        print("bench: baseline %s updated (%d cases)" % (args.baseline, len(run["results"])))
+        return 0
+
+    try:
+        with open(args.baseline, encoding="utf-8") as f:
+            base = json.load(f)
+    except OSError:
+        print("bench: no baseline %s, record one with --update" % args.baseline, file=sys.stderr)
+        return 2
+    for key in ("target", "timer", "clock_hz"):
+        if base.get(key) != run.get(key):
+            print("bench: %s differs from the baseline (%s vs %s)" % (key, run.get(key), base.get(key)), file=sys.stderr)
+            return 2
+
+    results = {r["name"]: r for r in run["results"]}
+    failed = 0
+    print("%-18s %12s %12s %8s" % ("case", "baseline", "run", "change"))
+    for ref in base["results"]:
+        cur = results.pop(ref["name"], None)
+        if cur is None:
+            print("%-18s %12.2f %12s %8s  MISSING" % (ref["name"], ref[args.metric], "-", "-"))
+            failed += 1
+            continue
+        old, new = ref[args.metric], cur[args.metric]
+        change = ((new - old) * 100.0 / old) if old else 0.0
+        status = ""
+        if (new - old) > args.floor and change > args.threshold:
+            status = "  REGRESSION"
+            failed += 1
+        elif (old - new) > args.floor and -change > args.threshold:
+            status = "  faster"
+        print("%-18s %12.2f %12.2f %+7.1f%%%s" % (ref["name"], old, new, change, status))
+    for name, cur in results.items():
+        print("%-18s %12s %12.2f %8s  new" % (name, "-", cur[args.metric], "-"))
+
+    print("bench: %s, %s %s, threshold %.1f%%" % ("FAIL" if failed else "ok", args.metric, run["timer"], args.threshold))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
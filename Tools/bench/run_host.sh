@@ -0,0 +1,26 @@
+#!/bin/sh
+# Build the suite for the host (GPIO registers simulated in RAM), run it and compare
+# with the stored host baseline. Host times are in ns and depend on the machine:
+# record a baseline per machine with UPDATE=1.
+#   THRESHOLD - allowed growth in percent (default 15, a host is noisier than QEMU)
+set -e
+ROOT=$(cd "$(dirname "$0")/../.." && pwd)
+OUT=${OUT:-$ROOT/Tools/bench/out}
+BASELINE=${BASELINE:-$ROOT/Tools/bench/baselines/host.json}
+mkdir -p "$OUT"
+
+# The target headers turn 32-bit register values into pointers, harmless on the host
+${CC:-cc} -O2 -std=gnu11 -Wall -Wextra -Werror -Wno-int-to-pointer-cast -Wno-pointer-to-int-cast -DBENCH_HOST \
+    -iquote "$ROOT/Inc" -I"$ROOT/Drivers/CMSIS/Include" -I"$ROOT/Drivers/HAL_Driver/Inc" \
+    -ffunction-sections -Wl,--gc-sections \
+    "$ROOT/Src/bench.c" \
+    "$ROOT/Drivers/HAL_Driver/Src/stm32f4xx_hal_gpio.c" \
+    "$ROOT/Drivers/HAL_Driver/Src/stm32f4xx_hal_dac.c" \
+    -o "$OUT/bench_host"
+"$OUT/bench_host" > "$OUT/host.json"
+
+if [ -n "$UPDATE" ]; then
+    exec python3 "$ROOT/Tools/bench/bench_compare.py" "$OUT/host.json" "$BASELINE" --update
+fi
+exec python3 "$ROOT/Tools/bench/bench_compare.py" "$OUT/host.json" "$BASELINE" \
+    --metric min --threshold "${THRESHOLD:-15}"
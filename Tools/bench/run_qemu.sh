@@ -0,0 +1,23 @@
+#!/bin/sh
+# Run a firmware image built with BENCH defined under QEMU and compare with the QEMU
+# baseline. netduinoplus2 is an STM32F405: same core, flash and SRAM map as the
+# F407, with unmodelled peripherals reading as zero. -icount makes the SysTick
+# cycle counts deterministic, so the default threshold can be tight.
+#   usage: run_qemu.sh firmware.elf
+#   THRESHOLD - allowed growth in percent (default 5)
+#   UPDATE=1  - store the run as the baseline
+set -e
+ROOT=$(cd "$(dirname "$0")/../.." && pwd)
+ELF=${1:?usage: run_qemu.sh firmware.elf}
+OUT=${OUT:-$ROOT/Tools/bench/out}
+BASELINE=${BASELINE:-$ROOT/Tools/bench/baselines/qemu.json}
+mkdir -p "$OUT"
+
+timeout "${TIMEOUT:-120}" ${QEMU:-qemu-system-arm} -M netduinoplus2 -nographic -monitor none -serial null \
+    -icount shift=0 -semihosting-config enable=on,target=native \
+    -kernel "$ELF" > "$OUT/qemu.log"
+
+if [ -n "$UPDATE" ]; then
+    exec python3 "$ROOT/Tools/bench/bench_compare.py" "$OUT/qemu.log" "$BASELINE" --update
+fi
+exec python3 "$ROOT/Tools/bench/bench_compare.py" "$OUT/qemu.log" "$BASELINE" --threshold "${THRESHOLD:-5}"
@@ -0,0 +1,275 @@
+#!/usr/bin/env python3
+"""Section sizes per module from a GNU ld map file.
+
+    map_report.py firmware.map [--objects] [--sort flash|ram|name] [--csv]
+    map_report.py firmware.map --diff old.map
+
+The map comes from the link, e.g. -Wl,-Map=firmware.map (STM32CubeIDE writes one
+next to the ELF). Every input section placed in a memory region is charged to the
+object that brought it in. Archive members are grouped under their archive
+(libc_nano.a, libm.a, ...) unless --objects is given.
+
+    text    code, wherever it runs (.text, .RamFunc)
+    rodata  constants, vector table, init/fini arrays, unwind tables
+    data    initialized variables: RAM, plus their initial value in FLASH
+    bss     zeroed or uninitialized RAM (.bss, COMMON, .noinit, reservations)
+
+FLASH and RAM are the bytes each module takes in read-only and writable regions,
+the FLASH copy of .data included. Space the linker script reserves itself, such
+as the heap and stack minimum in ._user_heap_stack, shows up as "(linker script)";
+padding between input sections (alignment) as "(fill)".
+
+Regions are read from the map's Memory Configuration: writable ones count as RAM.
+With --diff, only modules whose figures changed are listed, largest change first.
+"""
+import argparse
+import csv
+import os
+import re
+import sys
+
+COLUMNS = ("text", "rodata", "data", "bss", "flash", "ram")
+LINKER, FILL = "(linker script)", "(fill)"
+
+RE_REGION = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S+))?\s*$")
+RE_OUTPUT = re.compile(r"^(\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?)?\s*$")
+RE_INPUT = re.compile(r"^ (\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S.*?))?)?\s*$")
+RE_WRAPPED = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S.*?))?\s*$")
+RE_ARCHIVE = re.compile(r"^(.*\.a)\((.*)\)$")
+
+TEXT = (".text", ".RamFunc", ".glue_7", ".vfp11_veneer", ".v4_bx", ".iplt")
+RODATA = (".rodata", ".isr_vector", ".ARM.extab", ".ARM.exidx", ".preinit_array", ".init_array", ".fini_array")
+BSS = (".bss", "COMMON", ".noinit")
+
+
+class Region:
+    def __init__(self, name, origin, length, attrs):
+        self.name, self.origin, self.length = name, origin, length
+        self.writable = "w" in attrs.lower()
+        self.used = 0
+
+    def holds(self, addr):
+        return self.origin <= addr < self.origin + self.length
+
+
+class MapFile:
+    def __init__(self, path, objects=False):
+        self.objects = objects
+        self.regions = []
+        self.modules = {}
+        with open(path, encoding="utf-8", errors="replace") as f:
+            self._parse(f.read().splitlines())
+        if not self.regions:
+            raise ValueError("%s: no Memory Configuration, not a GNU ld map?" % path)
+
+    def region(self, addr):
+        for r in self.regions:
+            if r.holds(addr):
+                return r
+        return None
+
+    def module(self, name):
+        name = name.strip()
+        m = RE_ARCHIVE.match(name)
+        if m:
+            name = "%s(%s)" % (os.path.basename(m.group(1)), m.group(2)) if self.objects else os.path.basename(m.group(1))
+        elif name.startswith("./"):
+            name = name[2:]
+        return self.modules.setdefault(name, dict.fromkeys(COLUMNS, 0))
+
+    def charge(self, owner, section, output, vma, size, reserved=False):
+        """Charge size bytes of an input section placed in output at vma.
+
+        Only sections with contents have a copy at their load address: after a
+        >RAM AT> FLASH section ld prints one on the .bss, .noinit and reservations
+        that follow too, but nothing is stored there. A reservation (reserved) in a
+        writable region is bss, unless its output section is .data-like.
+        """
+        region = self.region(vma)
+        if region is None or size == 0:
+            return                          # debug info, discarded, or outside every region
+        lma = output["lma"] + (vma - output["vma"]) if output["lma"] is not None else vma
+        load = self.region(lma) if lma != vma else None
+        if section.startswith(TEXT):
+            kind = "text"
+        elif section.startswith(RODATA):
+            kind = "rodata"
+        elif section.startswith(BSS):
+            kind = "bss"
+        elif section.startswith(".data"):
+            kind = "data"
+        elif region.writable:
+            kind = "data" if load is not None and not reserved else "bss"
+        else:
+            kind = "rodata"
+        if kind == "bss":
+            load = None
+        mod = self.module(owner)
+        mod[kind] += size
+        mod["ram" if region.writable else "flash"] += size
+        region.used += size
+        if load is not None:
+            mod["ram" if load.writable else "flash"] += size
+            load.used += size
+
+    def _parse(self, lines):
+        state = None
+        output = None                       # current output section
+        pending = None                      # section name wrapped onto the next line
+        for line in lines:
+            if line.startswith("Memory Configuration"):
+                state = "memory"
+                continue
+            if line.startswith("Linker script and memory map"):
+                state = "map"
+                continue
+            if state == "memory":
+                m = RE_REGION.match(line)
+                if m and m.group(1) not in ("Name", "*default*"):
+                    self.regions.append(Region(m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4) or ""))
+                continue
+            if state != "map" or not line.strip():
+                continue
+
+            if not line[0].isspace():
+                self._close(output)
+                output, pending = None, None
+                m = RE_OUTPUT.match(line)
+                if m and m.group(2) is not None:
+                    output = self._open(m.group(1), m.group(2), m.group(3), m.group(4))
+                elif m and line.startswith("."):
+                    pending = ("output", m.group(1))
+                continue
+
+            if pending and pending[0] == "output":
+                m = re.match(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?\s*$", line)
+                output = self._open(pending[1], m.group(1), m.group(2), m.group(3)) if m else None
+                pending = None
+                continue
+            if output is None:
+                continue
+
+            if pending:
+                m = RE_WRAPPED.match(line)
+                if m:
+                    self._input(output, pending[1], int(m.group(1), 16), int(m.group(2), 16), m.group(3))
+                pending = None
+                if m:
+                    continue
+            m = RE_INPUT.match(line)
+            if not m:
+                continue
+            name = m.group(1)
+            if m.group(2) is not None:
+                self._input(output, name, int(m.group(2), 16), int(m.group(3), 16), m.group(4))
+            elif name.startswith(".") or name == "COMMON":
+                pending = ("input", name)
+        self._close(output)
+
+    def _open(self, name, vma, size, lma):
+        return {"name": name, "vma": int(vma, 16), "size": int(size, 16),
+                "lma": int(lma, 16) if lma else None, "placed": 0, "inputs": 0, "fills": []}
+
+    def _input(self, output, name, vma, size, owner):
+        if name == "*fill*":
+            output["fills"].append((vma, size))     # owner known once the section is closed
+        elif not owner:
+            return
+        else:
+            self.charge(owner, name, output, vma, size)
+            output["inputs"] += 1
+        output["placed"] += size
+
+    def _close(self, output):
+        """Charge the padding and whatever the output section holds beyond its input sections.
+
+        ld prints a reservation like . = . + _Min_Stack_Size as *fill* too: in a section
+        without input sections all of it is the script's, elsewhere it is alignment. Padding
+        is of the kind of its output section.
+        """
+        if output is None:
+            return
+        owner = FILL if output["inputs"] else LINKER
+        for vma, size in output["fills"]:
+            self.charge(owner, output["name"], output, vma, size, owner == LINKER)
+        if output["size"] > output["placed"]:
+            self.charge(LINKER, output["name"], output, output["vma"] + output["placed"], output["size"] - output["placed"], True)
+
+
+def table(rows, header):
+    widths = [max(len(str(r[i])) for r in [header] + rows) for i in range(len(header))]
+    fmt = "  ".join("%-*s" if i == 0 else "%*s" for i in range(len(header)))
+    out = []
+    for r in [header] + rows:
+        out.append(fmt % tuple(v for pair in zip(widths, r) for v in pair))
+    return "\n".join(out)
+
+
+def report(mapfile, sort, as_csv):
+    key = {"flash": lambda kv: (-kv[1]["flash"], kv[0]), "ram": lambda kv: (-kv[1]["ram"], kv[0]),
+           "name": lambda kv: kv[0]}[sort]
+    mods = sorted(mapfile.modules.items(), key=key)
+    total = dict((c, sum(m[c] for _, m in mods)) for c in COLUMNS)
+    if as_csv:
+        w = csv.writer(sys.stdout, lineterminator="\n")
+        w.writerow(("module",) + COLUMNS)
+        for name, m in mods:
+            w.writerow([name] + [m[c] for c in COLUMNS])
+        return
+    rows = [[name] + [m[c] for c in COLUMNS] for name, m in mods]
+    rows.append(["total"] + [total[c] for c in COLUMNS])
+    print(table(rows, ["module"] + list(COLUMNS)))
+    print()
+    print(table([[r.name, r.used, r.length, "%.1f%%" % (100.0 * r.used / r.length if r.length else 0.0)]
+                 for r in mapfile.regions], ["region", "used", "size", "use"]))
+
+
+def diff(new, old, as_csv):
+    names = set(new.modules) | set(old.modules)
+    zero = dict.fromkeys(COLUMNS, 0)
+    rows = []
+    for name in names:
+        a, b = old.modules.get(name, zero), new.modules.get(name, zero)
+        delta = [b[c] - a[c] for c in COLUMNS]
+        if any(delta):
+            rows.append((name, delta))
+    rows.sort(key=lambda r: (-(abs(r[1][4]) + abs(r[1][5])), r[0]))
+    if as_csv:
+        w = csv.writer(sys.stdout, lineterminator="\n")
+        w.writerow(("module",) + COLUMNS)
+        for name, delta in rows:
+            w.writerow([name] + delta)
+        return
+    if not rows:
+        print("no change")
+        return
+    total = [sum(d[i] for _, d in rows) for i in range(len(COLUMNS))]
+    print(table([[name] + ["%+d" % v for v in d] for name, d in rows] + [["total"] + ["%+d" % v for v in total]],
+                ["module"] + list(COLUMNS)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("map", help="GNU ld map file")
+    parser.add_argument("--objects", action="store_true", help="one row per archive member")
+    parser.add_argument("--sort", choices=("flash", "ram", "name"), default="flash", help="row order (default flash)")
+    parser.add_argument("--csv", action="store_true", help="CSV on stdout")
+    parser.add_argument("--diff", metavar="OLD", help="changes since an older map")
+    args = parser.parse_args()
+
+    try:
+        new = MapFile(args.map, args.objects)
+        old = MapFile(args.diff, args.objects) if args.diff else None
+    except (OSError, ValueError) as err:
+        print("map: %s" % err, file=sys.stderr)
+        return 2
+
+    if old is not None:
+        diff(new, old, args.csv)
+    else:
+        report(new, args.sort, args.csv)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+"""Symbolize Src/profiler.c samples against the ELF and draw a flame graph.
+
+    prof_flame.py ram.bin firmware.elf -o flame.svg [--folded stacks.txt] [--top 20]
+
+The sample ring is found in the RAM dump by its header (PROF_MAGIC, checked
+against --base), e.g. from gdb: dump binary memory ram.bin 0x20000000 0x20020000
+
+Each sample gives the interrupted PC and LR. The stack drawn is
+    [thread] or [isr] ; caller ; function
+The caller comes from LR, and only when LR points into another function right
+after a call instruction (BL, or BLX through a register). Otherwise LR is stale,
+because the function already called something that returned, and the caller is
+left out. LR = EXC_RETURN means the function was entered by an exception.
+
+The folded output is the flamegraph.pl / speedscope input format.
+"""
+import argparse
+import bisect
+import html
+import struct
+import sys
+import zlib
+
+PROF_MAGIC = 0x31465250
+HEADER = struct.Struct("<6I")           # Magic, Depth, Check, RateHz, Head, Reserved
+SAMPLE = struct.Struct("<II")           # Pc, Lr
+
+SHT_PROGBITS, SHT_SYMTAB = 1, 2
+SHF_EXECINSTR = 0x4
+STT_FUNC = 2
+
+
+class Elf:
+    """Just enough of an ELF32 little-endian reader: function symbols and code bytes."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            raise ValueError("%s: not a 32-bit little-endian ELF" % path)
+        shoff, = struct.unpack_from("<I", data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", data, 0x2E)
+        sections = [struct.unpack_from("<10I", data, shoff + i * shentsize) for i in range(shnum)]
+
+        self.code = []                  # (addr, bytes) of executable sections
+        funcs = {}
+        for name, stype, flags, addr, off, size, link, info, align, entsize in sections:
+            if stype == SHT_PROGBITS and flags & SHF_EXECINSTR:
+                self.code.append((addr, data[off:off + size]))
+            if stype == SHT_SYMTAB:
+                stroff = sections[link][4]
+                for i in range(size // 16):
+                    st_name, value, sz, st_info, _, shndx = struct.unpack_from("<IIIBBH", data, off + i * 16)
+                    if st_info & 0xF != STT_FUNC or shndx == 0:
+                        continue
+                    end = data.index(b"\0", stroff + st_name)
+                    funcs[value & ~1] = (data[stroff + st_name:end].decode("utf-8", "replace"), sz)
+        if not funcs:
+            raise ValueError("%s: no function symbols (stripped?)" % path)
+        self.starts = sorted(funcs)
+        self.funcs = [funcs[a] for a in self.starts]
+
+    def function(self, addr):
+        """(start, name) of the function holding addr, None outside every function."""
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i < 0:
+            return None
+        name, size = self.funcs[i]
+        start = self.starts[i]
+        limit = start + size if size else (self.starts[i + 1] if i + 1 < len(self.starts) else start)
+        return (start, name) if addr < limit else None
+
+    def halfword(self, addr):
+        for base, blob in self.code:
+            if base <= addr and addr + 2 <= base + len(blob):
+                return struct.unpack_from("<H", blob, addr - base)[0]
+        return None
+
+
+def call_target(elf, ret):
+    """What the instruction before return address ret called: an address, 'indirect' or None (no call)."""
+    hw = elf.halfword(ret - 2)
+    if hw is not None and (hw & 0xFF87) == 0x4780:
+        return "indirect"               # BLX Rm
+    hw1, hw2 = elf.halfword(ret - 4), hw
+    if hw1 is None or hw2 is None or (hw1 & 0xF800) != 0xF000 or (hw2 & 0xD000) != 0xD000:
+        return None                     # not BL (BLX imm switches to ARM, no such code here)
+    s = (hw1 >> 10) & 1
+    i1 = 1 - (((hw2 >> 13) & 1) ^ s)
+    i2 = 1 - (((hw2 >> 11) & 1) ^ s)
+    imm = (s << 24) | (i1 << 23) | (i2 << 22) | ((hw1 & 0x3FF) << 12) | ((hw2 & 0x7FF) << 1)
+    if s:
+        imm -= 1 << 25
+    return ret + imm
+
+
+def find_ring(data, base):
+    for off in range(0, len(data) - HEADER.size, 4):
+        if struct.unpack_from("<I", data, off)[0] != PROF_MAGIC:
+            continue
+        magic, depth, check, rate, head, _ = HEADER.unpack_from(data, off)
+        if check == (magic ^ depth ^ (base + off + HEADER.size)) & 0xFFFFFFFF:
+            if off + HEADER.size + depth * SAMPLE.size > len(data):
+                raise ValueError("sample ring runs past the end of the dump")
+            return off + HEADER.size, depth, rate, head
+    raise ValueError("no sample ring found (wrong --base, or PROF_Init() never ran)")
+
+
+def fold(elf, samples):
+    stacks = {}
+    for pc, lr in samples:
+        root = "[isr]" if pc & 1 else "[thread]"
+        pc &= ~1
+        func = elf.function(pc)
+        name = func[1] if func else "[0x%08X]" % pc
+        frames = [root]
+        if lr >= 0xFFFFFFE0:
+            frames.append("[exception]")
+        elif func:
+            target = call_target(elf, lr & ~1)
+            caller = elf.function(lr & ~1)
+            # A stale LR points into the sampled function itself, after a call it made.
+            # Outside of it and after a call, it is the caller (or one that tail-called).
+            if caller and caller[0] != func[0] and target is not None:
+                frames.append(caller[1])
+        frames.append(name)
+        key = ";".join(frames)
+        stacks[key] = stacks.get(key, 0) + 1
+    return stacks
+
+
+def flame_svg(stacks, title, width=1200, row=18):
+    """Flame graph: width is sample share, one row per frame, root at the bottom."""
+    tree = {}
+    for key, count in stacks.items():
+        node = tree
+        for frame in key.split(";"):
+            child = node.setdefault(frame, [0, {}])
+            child[0] += count
+            node = child[1]
+    total = sum(n[0] for n in tree.values()) or 1
+    levels = max(len(k.split(";")) for k in stacks) if stacks else 1
+    height = (levels + 2) * row
+    rects = []
+
+    def walk(node, x, level):
+        for frame, (count, children) in sorted(node.items()):
+            w = count * width / total
+            y = height - (level + 1) * row
+            hue = zlib.crc32(frame.encode()) & 0xFFFF
+            color = "rgb(%d,%d,%d)" % (205 + hue % 50, 80 + (hue >> 4) % 120, 40 + (hue >> 8) % 40)
+            label = html.escape(frame)
+            text = label if w > 7 * len(frame) else ""
+            rects.append('<g><title>%s: %d samples (%.1f%%)</title><rect x="%.1f" y="%d" width="%.1f" height="%d" '
+                         'fill="%s" rx="2"/><text x="%.1f" y="%d">%s</text></g>'
+                         % (label, count, 100.0 * count / total, x, y, max(w - 0.5, 0.1), row - 1, color,
+                            x + 3, y + row - 5, text))
+            walk(children, x, level + 1)
+            x += w
+
+    walk(tree, 0.0, 0)
+    return ('<?xml version="1.0" standalone="no"?>\n'
+            '<svg xmlns="http://www.w3.org/2000/svg" width="%d" height="%d" font-family="monospace" font-size="11">\n'
+            '<text x="%d" y="%d" text-anchor="middle" font-size="14">%s</text>\n%s\n</svg>\n'
+            % (width, height, width // 2, row, html.escape(title), "\n".join(rects)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="binary RAM dump")
+    parser.add_argument("elf", help="firmware ELF, with symbols")
+    parser.add_argument("-o", "--output", default="flame.svg", help="flame graph SVG (default flame.svg)")
+    parser.add_argument("--base", type=lambda v: int(v, 0), default=0x20000000, help="address of the dump start")
+    parser.add_argument("--folded", help="also write folded stacks")
+    parser.add_argument("--top", type=int, default=15, help="hot functions listed (default 15)")
+    args = parser.parse_args()
+
+    try:
+        elf = Elf(args.elf)
+        with open(args.dump, "rb") as f:
+            data = f.read()
+        off, depth, rate, head = find_ring(data, args.base)
+    except (OSError, ValueError) as err:
+        print("prof: %s" % err, file=sys.stderr)
+        return 2
+
+    count = min(head, depth)
+    samples = [SAMPLE.unpack_from(data, off + (i % depth) * SAMPLE.size) for i in range(head - count, head)]
+    if not samples:
+        print("prof: no samples (PROF_Start() not called?)", file=sys.stderr)
+        return 1
+    stacks = fold(elf, samples)
+
+    title = "%d samples at %d Hz (%.2f s)%s" % (count, rate, count / float(rate),
+                                                ", %d older overwritten" % (head - count) if head > count else "")
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(flame_svg(stacks, title))
+    if args.folded:
+        with open(args.folded, "w", encoding="utf-8") as f:
+            for key in sorted(stacks):
+                f.write("%s %d\n" % (key, stacks[key]))
+
+    self_time = {}
+    for key, n in stacks.items():
+        leaf = key.rsplit(";", 1)[-1]
+        self_time[leaf] = self_time.get(leaf, 0) + n
+    print(title)
+    print("%8s %7s  %s" % ("samples", "share", "function"))
+    for name, n in sorted(self_time.items(), key=lambda kv: -kv[1])[:args.top]:
+        print("%8d %6.1f%%  %s" % (n, 100.0 * n / count, name))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Decode a captured SWO byte stream (ITM packets, TPIU formatter bypassed).
+
+Channels follow Inc/swo.h:
+  port 0      log text, printed line by line
+  port 1      events: 16-bit id, or 32-bit id << 16 | argument
+  port 8..15  watch slots, 32-bit values
+other ports are printed raw. With local timestamps on (SWO_InitTypeDef.Timestamps),
+lines carry the cycle count since the start of the capture, or microseconds with
+--hclk. A timestamp packet follows the packets it dates, so output is held back
+until it arrives.
+
+Capture the raw stream with the probe at SWO_GetBaudRate(), e.g. OpenOCD
+'tpiu config internal swo.bin uart off <hclk> <baud>' or a UART adapter on PB3.
+"""
+import argparse
+import sys
+
+PORT_LOG = 0
+PORT_EVENT = 1
+PORT_WATCH = 8
+WATCH_SLOTS = 8
+
+
+def packets(data):
+    """Yield ('sync'|'overflow'|'ts'|'sw'|'hw', a, b) from the raw byte stream."""
+    i, n = 0, len(data)
+    while i < n:
+        h = data[i]
+        i += 1
+        if h == 0x00:
+            # Synchronisation: a run of zero bytes closed by 0x80
+            while i < n and data[i] == 0x00:
+                i += 1
+            if i < n and data[i] == 0x80:
+                i += 1
+            yield ("sync", 0, 0)
+        elif h == 0x70:
+            yield ("overflow", 0, 0)
+        elif (h & 0x0F) == 0x00:
+            if h & 0x80:
+                # Local timestamp format 1: continuation bytes, 7 bits each
+                value, shift = 0, 0
+                while i < n:
+                    b = data[i]
+                    i += 1
+                    value |= (b & 0x7F) << shift
+                    shift += 7
+                    if not b & 0x80:
+                        break
+                yield ("ts", value, (h >> 4) & 0x3)
+            else:
+                # Local timestamp format 2: 3-bit delta in the header
+                yield ("ts", (h >> 4) & 0x7, 0)
+        elif (h & 0x0B) == 0x08 or h in (0x94, 0xB4):
+            # Extension or global timestamp: skip the continuation bytes
+            if h & 0x80:
+                while i < n:
+                    b = data[i]
+                    i += 1
+                    if not b & 0x80:
+                        break
+        elif h & 0x03:
+            size = (1, 2, 4)[(h & 0x03) - 1]
+            if i + size > n:
+                return
+            value = int.from_bytes(data[i:i + size], "little")
+            i += size
+            yield ("hw" if h & 0x04 else "sw", h >> 3, (value, size))
+
+
+def parse_names(items, what):
+    names = {}
+    for item in items:
+        key, sep, name = item.partition("=")
+        if not sep:
+            raise SystemExit("swo: --%s expects N=name, got %r" % (what, item))
+        names[int(key, 0)] = name
+    return names
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("capture", help="raw SWO bytes, '-' for stdin")
+    parser.add_argument("--hclk", type=float, help="core clock in Hz, timestamps printed in us")
+    parser.add_argument("--event", action="append", default=[], metavar="ID=NAME", help="name an event id")
+    parser.add_argument("--watch", action="append", default=[], metavar="SLOT=NAME", help="name a watch slot")
+    args = parser.parse_args()
+
+    data = sys.stdin.buffer.read() if args.capture == "-" else open(args.capture, "rb").read()
+    events = parse_names(args.event, "event")
+    watches = parse_names(args.watch, "watch")
+
+    now = 0
+    timed = False
+    line = bytearray()
+    pending = []
+    stats = {"overflow": 0, "hw": 0}
+
+    def flush():
+        if timed and args.hclk:
+            stamp = "%12.3f us  " % (now * 1e6 / args.hclk)
+        elif timed:
+            stamp = "%12d cyc  " % now
+        else:
+            stamp = ""
+        for text in pending:
+            sys.stdout.write(stamp + text + "\n")
+        del pending[:]
+
+    for kind, a, b in packets(data):
+        if kind == "ts":
+            now += a
+            timed = True
+            flush()
+        elif kind == "overflow":
+            stats["overflow"] += 1
+            pending.append("-- overflow, packets lost")
+        elif kind == "hw":
+            stats["hw"] += 1
+        elif kind == "sw":
+            value, size = b
+            if a == PORT_LOG:
+                line += value.to_bytes(size, "little")
+                while b"\n" in line:
+                    text, _, line = line.partition(b"\n")
+                    pending.append("log    " + text.decode("utf-8", "replace").rstrip("\r"))
+            elif a == PORT_EVENT:
+                ev, arg = (value >> 16, value & 0xFFFF) if size == 4 else (value, None)
+                pending.append("event  %s%s" % (events.get(ev, "0x%04X" % ev), "" if arg is None else " arg=%d" % arg))
+            elif PORT_WATCH <= a < PORT_WATCH + WATCH_SLOTS:
+                slot = a - PORT_WATCH
+                signed = value - (1 << 32) if value & 0x80000000 else value
+                pending.append("watch  %s = %d (0x%08X)" % (watches.get(slot, "slot%d" % slot), signed, value))
+            else:
+                pending.append("port%-2d 0x%0*X" % (a, size * 2, value))
+    if line:
+        pending.append("log    " + line.decode("utf-8", "replace"))
+    flush()
+    if stats["overflow"] or stats["hw"]:
+        print("swo: %d overflow(s), %d hardware packet(s) skipped" % (stats["overflow"], stats["hw"]), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+"""Convert a RAM dump holding the Src/trace.c event ring to Chrome trace JSON.
+
+Open the output in ui.perfetto.dev or chrome://tracing. The ring is found by its
+header (TRC_MAGIC, checked against the dump base address), so dump the whole SRAM:
+    gdb: dump binary memory ram.bin 0x20000000 0x20020000
+
+Tracks:
+  Interrupts  ISR spans (TRC_IsrEnter/Exit) with EXTI handling nested in them
+  Threads     the running kernel thread
+  Events      instants: resets, HAL_GPIO_Init, user instants
+  user ids    one track per TRC_ID_USER id with spans, counters as counter tracks
+
+Events before a TRC_ID_RESET marker belong to the previous run. CYCCNT restarts
+at reset, so each run is laid out after the previous one.
+"""
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+TRC_MAGIC = 0x31435254
+HEADER = struct.Struct("<6I")           # Magic, Depth, Check, CpuHz, Head, Frozen
+EVENT = struct.Struct("<II")            # Cycles, Info
+
+KIND_INSTANT, KIND_BEGIN, KIND_END, KIND_COUNTER = range(4)
+ID_RESET, ID_ISR, ID_THREAD, ID_EXTI, ID_GPIO_INIT, ID_USER = 0x0001, 0x0002, 0x0003, 0x0010, 0x0020, 0x1000
+
+TID_IRQ, TID_THREAD, TID_EVENTS = 1, 2, 3
+RESET_FLAGS = ["RMVF", "BOR", "PIN", "POR", "SFT", "IWDG", "WWDG", "LPWR"]
+CORE_EXCEPTIONS = {2: "NMI", 3: "HardFault", 4: "MemManage", 5: "BusFault", 6: "UsageFault",
+                   11: "SVCall", 12: "DebugMonitor", 14: "PendSV", 15: "SysTick"}
+
+DEVICE_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                             "..", "..", "Drivers", "CMSIS", "Include", "stm32f407xx.h")
+
+
+def irq_names():
+    """Exception number -> name, from the IRQn_Type enum of the device header."""
+    names = dict(CORE_EXCEPTIONS)
+    try:
+        with open(DEVICE_HEADER, encoding="utf-8", errors="replace") as f:
+            for m in re.finditer(r"^\s*(\w+)_IRQn\s*=\s*(-?\d+)", f.read(), re.M):
+                names[int(m.group(2)) + 16] = m.group(1)
+    except OSError:
+        pass
+    return names
+
+
+def find_ring(data, base):
+    for off in range(0, len(data) - HEADER.size, 4):
+        if struct.unpack_from("<I", data, off)[0] != TRC_MAGIC:
+            continue
+        magic, depth, check, hz, head, frozen = HEADER.unpack_from(data, off)
+        events_addr = base + off + HEADER.size
+        if check != (magic ^ depth ^ events_addr) & 0xFFFFFFFF:
+            continue
+        if off + HEADER.size + depth * EVENT.size > len(data):
+            raise ValueError("ring at 0x%08X runs past the end of the dump" % (base + off))
+        return off, depth, hz, head, frozen
+    raise ValueError("no trace ring found (wrong --base, or TRC_Init() never ran)")
+
+
+def parse_names(items):
+    names = {}
+    for item in items:
+        key, sep, name = item.partition("=")
+        if not sep:
+            raise SystemExit("trace: expected ID=name, got %r" % item)
+        names[int(key, 0)] = name
+    return names
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="binary RAM dump")
+    parser.add_argument("-o", "--output", default="-", help="JSON output, default stdout")
+    parser.add_argument("--base", type=lambda v: int(v, 0), default=0x20000000, help="address of the dump start")
+    parser.add_argument("--hclk", type=float, help="CYCCNT rate, Hz (default: from the ring header)")
+    parser.add_argument("--name", action="append", default=[], metavar="ID=NAME", help="name a user event id")
+    parser.add_argument("--thread", action="append", default=[], metavar="ADDR=NAME", help="name a thread by TCB address")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as f:
+        data = f.read()
+    try:
+        off, depth, hz, head, frozen = find_ring(data, args.base)
+    except ValueError as err:
+        print("trace: %s" % err, file=sys.stderr)
+        return 2
+    hz = args.hclk or hz or 1e6
+    user_names = parse_names(args.name)
+    thread_names = parse_names(args.thread)
+    irqs = irq_names()
+
+    count = min(head, depth)
+    events_off = off + HEADER.size
+    out = []
+    depth_of = {}                       # tid -> open BEGIN spans
+    tracks = {TID_IRQ: "Interrupts", TID_THREAD: "Threads", TID_EVENTS: "Events"}
+    thread = None
+    epoch = 0                           # cycles before the current run
+    last = None                         # (raw cycles, absolute cycles) of the previous event
+    now = 0
+
+    def us(cycles):
+        return cycles * 1e6 / hz
+
+    def emit(ph, tid, name, **extra):
+        if ph == "B":
+            depth_of[tid] = depth_of.get(tid, 0) + 1
+        elif ph == "E":
+            if not depth_of.get(tid):
+                return                  # its BEGIN was overwritten in the ring
+            depth_of[tid] -= 1
+        ev = {"ph": ph, "pid": 1, "tid": tid, "ts": us(now), "name": name}
+        ev.update(extra)
+        out.append(ev)
+
+    def close_all():
+        for tid, n in list(depth_of.items()):
+            for _ in range(n):
+                emit("E", tid, "")
+
+    for i in range(head - count, head):
+        cycles, info = EVENT.unpack_from(data, events_off + (i % depth) * EVENT.size)
+        kind, ev_id, arg = info >> 30, (info >> 16) & 0x3FFF, info & 0xFFFF
+
+        if ev_id == ID_RESET and last is not None:
+            close_all()
+            thread = None
+            epoch = last[1] + 1
+            last = None
+        if last is None:
+            now = epoch
+        else:
+            now = last[1] + ((cycles - last[0]) & 0xFFFFFFFF)
+        last = (cycles, now)
+
+        if ev_id == ID_RESET:
+            flags = [RESET_FLAGS[b] for b in range(1, 8) if arg & (1 << b)]
+            emit("i", TID_EVENTS, "reset", s="g", args={"flags": " ".join(flags) or "none"})
+        elif ev_id == ID_ISR:
+            emit({KIND_BEGIN: "B", KIND_END: "E"}.get(kind, "i"), TID_IRQ, irqs.get(arg, "exception %d" % arg))
+        elif ev_id == ID_EXTI:
+            emit({KIND_BEGIN: "B", KIND_END: "E"}.get(kind, "i"), TID_IRQ, "EXTI", args={"pins": "0x%04X" % arg})
+        elif ev_id == ID_THREAD:
+            addr = 0x20000000 | (arg << 2)
+            if thread is not None:
+                emit("E", TID_THREAD, "")
+            thread = thread_names.get(addr, "thread 0x%08X" % addr)
+            emit("B", TID_THREAD, thread)
+        elif ID_GPIO_INIT <= ev_id < ID_GPIO_INIT + 9:
+            emit("i", TID_EVENTS, "HAL_GPIO_Init GPIO%c" % chr(ord("A") + ev_id - ID_GPIO_INIT),
+                 s="t", args={"pins": "0x%04X" % arg})
+        else:
+            name = user_names.get(ev_id, "event 0x%04X" % ev_id)
+            if kind == KIND_COUNTER:
+                emit("C", TID_EVENTS, name, args={"value": arg})
+            elif kind == KIND_INSTANT:
+                emit("i", TID_EVENTS, name, s="t", args={"arg": arg})
+            else:
+                tid = 0x10000 + ev_id
+                tracks.setdefault(tid, name)
+                emit("B" if kind == KIND_BEGIN else "E", tid, name, args={"arg": arg})
+    close_all()
+
+    meta = [{"ph": "M", "pid": 1, "name": "process_name", "args": {"name": "stm32f407"}}]
+    meta += [{"ph": "M", "pid": 1, "tid": tid, "name": "thread_name", "args": {"name": name}}
+             for tid, name in sorted(tracks.items())]
+    doc = {"traceEvents": meta + out, "displayTimeUnit": "ns",
+           "otherData": {"cpu_hz": hz, "recorded": head, "kept": count, "frozen": bool(frozen)}}
+
+    text = json.dumps(doc, indent=None, separators=(",", ":"))
+    if args.output == "-":
+        sys.stdout.write(text + "\n")
+    else:
+        with open(args.output, "w", encoding="utf-8") as f:
+            f.write(text + "\n")
+    print("trace: %d of %d events%s, %.0f Hz" % (count, head, ", frozen" if frozen else "", hz), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())